@@ -1,6 +1,7 @@
 /*######################################################################
 # Use:
 #   o Holds the Median Q-score functions for scoreReads & findCoInft
+#   o Holds the Q-score run kernels (SSE2, AVX2, NEON, or scalar)
 ######################################################################*/
 
 #include "FCIStatsFun.h"
@@ -9,6 +10,13 @@
 ' SOF: FCIStatsFun
 '    fun-1 findQScores: find Q-score of read using q-score entry
 '    fun-2 qHistToMed: Find median Q-score from a q-score histogram
+'    fun-3 qRunHist: Add a run of Q-scores to a histogram & sum them
+'    fun-4 qRunCntKeep: Count bases in a run that pass Q-score checks
+'    fun-5 qRunStats: qRunHist & qRunCntKeep in one call
+'    fun-6 qRunCntKeepScalar: Scalar kernel for qRunCntKeep
+'    fun-7 qRunCntKeepSSE2: SSE2 kernel for qRunCntKeep
+'    fun-8 qRunCntKeepAVX2: AVX2 kernel for qRunCntKeep
+'    fun-9 qRunCntKeepNEON: NEON kernel for qRunCntKeep
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*######################################################################
@@ -45,14 +53,16 @@ void findQScores(
     if(((*samStruct->qCStr ^ '*') | (*(samStruct->qCStr+1) ^ '\t')) ==0)
         return;       /*No Q-score entry*/
 
-    while(*seqQCStr > 32)
-    { /*loop through the Q-score entry*/
-        ++(samStruct->seqQHistUInt[*seqQCStr - Q_ADJUST]);
-        samStruct->totalQScoreULng += (*seqQCStr - Q_ADJUST);
-        ++seqQCStr;
-        ++lenReadULng;
-    } /*loop through the Q-score entry*/
-    
+    while(seqQCStr[lenReadULng] > 32)
+        ++lenReadULng; /*Find the end of the Q-score entry*/
+
+    samStruct->totalQScoreULng =
+        qRunHist(
+            seqQCStr,
+            (uint32_t) lenReadULng,
+            samStruct->seqQHistUInt
+        ); /*Build the histogram & sum the Q-scores*/
+
     /*Find the mean and median*/
     samStruct->meanQFlt =
         samStruct->totalQScoreULng / ((float) lenReadULng);
@@ -109,3 +119,554 @@ float qHistToMed(
 
     return 0; /*Just in case was all 0's in the array*/
 } /*qHistToMedian*/
+
+/*######################################################################
+# Output:
+#    modifies: qHistAryUI to have the Q-score of each base added
+#    returns: sum of the Q-scores in the run
+# Note:
+#    - Histograms do not vectorize (each base is a scattered add), so
+#      this is a tight scalar loop. Two histograms are used on long
+#      runs, so back to back bases with the same Q-score do not wait
+#      on each other's add
+######################################################################*/
+unsigned long qRunHist(
+    char *qCStr,          /*Q-score entry (run) to add*/
+    uint32_t lenUI,       /*Number of Q-scores in the run*/
+    uint32_t *qHistAryUI  /*Histogram to add the Q-scores to*/
+) /*Adds a run of Q-scores to a histogram & sums them*/
+{ /*qRunHist*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-3 Sec-1 Sub-1 TOC: qRunHist
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t baseUI = 0;
+    uint32_t oddHistAryUI[MAX_Q_SCORE]; /*Second histogram*/
+    unsigned long sumUL = 0;
+    unsigned long oddSumUL = 0;
+    unsigned char *qUCStr = (unsigned char *) qCStr;
+
+    if(lenUI < 256)
+    { /*If is a short run (most cigar entries)*/
+        for(baseUI = 0; baseUI < lenUI; ++baseUI)
+        { /*Loop: Add each Q-score*/
+            ++qHistAryUI[qUCStr[baseUI] - Q_ADJUST];
+            sumUL += qUCStr[baseUI];
+        } /*Loop: Add each Q-score*/
+
+        return sumUL - Q_ADJUST * (unsigned long) lenUI;
+    } /*If is a short run (most cigar entries)*/
+
+    for(baseUI = 0; baseUI < MAX_Q_SCORE; ++baseUI)
+        oddHistAryUI[baseUI] = 0;
+
+    for(baseUI = 0; baseUI + 1 < lenUI; baseUI += 2)
+    { /*Loop: Add two Q-scores at a time*/
+        ++qHistAryUI[qUCStr[baseUI] - Q_ADJUST];
+        ++oddHistAryUI[qUCStr[baseUI + 1] - Q_ADJUST];
+        sumUL += qUCStr[baseUI];
+        oddSumUL += qUCStr[baseUI + 1];
+    } /*Loop: Add two Q-scores at a time*/
+
+    if(baseUI < lenUI)
+    { /*If have an odd number of Q-scores*/
+        ++qHistAryUI[qUCStr[baseUI] - Q_ADJUST];
+        sumUL += qUCStr[baseUI];
+    } /*If have an odd number of Q-scores*/
+
+    for(baseUI = 0; baseUI < MAX_Q_SCORE; ++baseUI)
+        qHistAryUI[baseUI] += oddHistAryUI[baseUI];
+
+    return sumUL + oddSumUL - Q_ADJUST * (unsigned long) lenUI;
+} /*qRunHist*/
+
+/*######################################################################
+# Output:
+#    returns: Number of bases in the run with a Q-score over minQI &
+#             a paired reference Q-score between refMinQI & refMaxQI
+# Note:
+#    - qCStr or refQCStr can be 0 to skip that check
+#    - The thresholds are converted to ranges of Q-score characters,
+#      so the kernels only need unsigned byte compares
+#    - Runs under 16 bases (most cigar entries) are counted inline,
+#      since setting up a kernel costs more than the run
+######################################################################*/
+uint32_t qRunCntKeep(
+    char *qCStr,      /*Read Q-scores (0 to not check)*/
+    char *refQCStr,   /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,   /*Number of bases in the run*/
+    int32_t minQI,    /*Read Q-scores must be over this*/
+    int32_t refMinQI, /*Reference Q-scores must be over this*/
+    int32_t refMaxQI  /*Reference Q-scores must be under this*/
+) /*Counts the bases in a run that pass the Q-score thresholds*/
+{ /*qRunCntKeep*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-4 TOC:
+    #    fun-4 sec-1: Count short runs inline
+    #    fun-4 sec-2: Convert the thresholds to character ranges
+    #    fun-4 sec-3: Run the best kernel for this CPU
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-4 Sec-1: Count short runs inline
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    int32_t qLoI = 0;
+    int32_t refLoI = 0;
+    int32_t refHiI = 0;
+    uint32_t cntUI = 0;
+    int32_t tmpQI = 0;
+    unsigned char *qUCStr = (unsigned char *) qCStr;
+    unsigned char *refUCStr = (unsigned char *) refQCStr;
+
+    if(lenUI < 16)
+    { /*If is a short run (most cigar entries)*/
+        for(uint32_t baseUI = 0; baseUI < lenUI; ++baseUI)
+        { /*Loop: Check each base*/
+            tmpQI = 1;
+
+            if(qUCStr != 0)
+                tmpQI &= (qUCStr[baseUI] - Q_ADJUST > minQI);
+
+            if(refUCStr != 0)
+                tmpQI &=
+                    (refUCStr[baseUI] - Q_ADJUST > refMinQI) &
+                    (refUCStr[baseUI] - Q_ADJUST < refMaxQI);
+
+            cntUI += tmpQI;
+        } /*Loop: Check each base*/
+
+        return cntUI;
+    } /*If is a short run (most cigar entries)*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-4 Sec-2: Convert the thresholds to character ranges
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Q - Q_ADJUST > minQI is the same as Q >= minQI + Q_ADJUST + 1*/
+    qLoI = minQI + Q_ADJUST + 1;
+    refLoI = refMinQI + Q_ADJUST + 1;
+    refHiI = refMaxQI + Q_ADJUST - 1;
+
+    if(qCStr != 0 && qLoI > 255)
+        return 0; /*No Q-score character is this high*/
+
+    if(refQCStr != 0 && (refLoI > 255 || refHiI < 0 || refLoI > refHiI))
+        return 0; /*No reference Q-score can be kept*/
+
+    if(qLoI <= 0)
+        qCStr = 0;      /*Every Q-score is kept*/
+
+    if(refLoI <= 0 && refHiI >= 255)
+        refQCStr = 0;   /*Every reference Q-score is kept*/
+
+    if(qCStr == 0 && refQCStr == 0)
+        return lenUI;   /*Nothing to check*/
+
+    if(qLoI < 0)
+        qLoI = 0;
+    if(refLoI < 0)
+        refLoI = 0;
+    if(refHiI > 255)
+        refHiI = 255;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-4 Sec-3: Run the best kernel for this CPU
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    #ifdef qAVX2Bl
+        if(lenUI >= 32 && __builtin_cpu_supports("avx2"))
+            return
+                qRunCntKeepAVX2(
+                    qCStr,
+                    refQCStr,
+                    lenUI,
+                    (uint8_t) qLoI,
+                    (uint8_t) refLoI,
+                    (uint8_t) refHiI
+                );
+    #endif
+
+    #ifdef qSSE2Bl
+        if(lenUI >= 16)
+            return
+                qRunCntKeepSSE2(
+                    qCStr,
+                    refQCStr,
+                    lenUI,
+                    (uint8_t) qLoI,
+                    (uint8_t) refLoI,
+                    (uint8_t) refHiI
+                );
+    #endif
+
+    #ifdef qNEONBl
+        if(lenUI >= 16)
+            return
+                qRunCntKeepNEON(
+                    qCStr,
+                    refQCStr,
+                    lenUI,
+                    (uint8_t) qLoI,
+                    (uint8_t) refLoI,
+                    (uint8_t) refHiI
+                );
+    #endif
+
+    return
+        qRunCntKeepScalar(
+            qCStr,
+            refQCStr,
+            lenUI,
+            (uint8_t) qLoI,
+            (uint8_t) refLoI,
+            (uint8_t) refHiI
+        );
+} /*qRunCntKeep*/
+
+/*######################################################################
+# Output:
+#    modifies: qHistAryUI to have the Q-score of each base added
+#    modifies: keptUI to the number of bases qRunCntKeep would keep
+#    returns: sum of the Q-scores in the run
+# Note:
+#    - Runs under 16 bases (most cigar entries) are added & counted in
+#      one loop, so they do not pay for calling qRunHist & qRunCntKeep
+######################################################################*/
+unsigned long qRunStats(
+    char *qCStr,          /*Read Q-scores (run) to add & check*/
+    char *refQCStr,       /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,       /*Number of bases in the run*/
+    int32_t minQI,        /*Read Q-scores must be over this*/
+    int32_t refMinQI,     /*Reference Q-scores must be over this*/
+    int32_t refMaxQI,     /*Reference Q-scores must be under this*/
+    uint32_t *qHistAryUI, /*Histogram to add the Q-scores to*/
+    uint32_t *keptUI      /*Set to the number of bases to keep*/
+) /*Adds a run of Q-scores to a histogram & counts the bases to keep*/
+{ /*qRunStats*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-5 Sec-1 Sub-1 TOC: qRunStats
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    int32_t qI = 0;
+    int32_t refLoI = 0;
+    uint32_t refSpanUI = 0;
+    uint32_t cntUI = 0;
+    unsigned long sumUL = 0;
+    unsigned char *qUCStr = (unsigned char *) qCStr;
+    unsigned char *refUCStr = (unsigned char *) refQCStr;
+
+    if(lenUI >= 16)
+    { /*If is a long run, use the kernels*/
+        *keptUI =
+            qRunCntKeep(
+                qCStr,
+                refQCStr,
+                lenUI,
+                minQI,
+                refMinQI,
+                refMaxQI
+            );
+
+        return qRunHist(qCStr, lenUI, qHistAryUI);
+    } /*If is a long run, use the kernels*/
+
+    /*refMinQI < Q < refMaxQI is one unsigned compare:
+      (Q - (refMinQI + 1)) < refMaxQI - refMinQI - 1*/
+    refLoI = refMinQI + 1;
+    refSpanUI = 0;
+
+    if(refMaxQI - refMinQI - 1 > 0)
+        refSpanUI = (uint32_t) (refMaxQI - refMinQI - 1);
+
+    if(refUCStr == 0)
+    { /*If not checking the reference, every base passes it*/
+        refUCStr = qUCStr;
+        refLoI = -256;
+        refSpanUI = 1024;
+    } /*If not checking the reference, every base passes it*/
+
+    for(uint32_t baseUI = 0; baseUI < lenUI; ++baseUI)
+    { /*Loop: Add & check each base*/
+        qI = qUCStr[baseUI] - Q_ADJUST;
+        ++qHistAryUI[qI];
+        sumUL += qUCStr[baseUI];
+
+        cntUI +=
+              (qI > minQI)
+            & ((uint32_t) (refUCStr[baseUI] - Q_ADJUST - refLoI)
+                  < refSpanUI);
+    } /*Loop: Add & check each base*/
+
+    *keptUI = cntUI;
+    return sumUL - Q_ADJUST * (unsigned long) lenUI;
+} /*qRunStats*/
+
+/*######################################################################
+# Output:
+#    returns: Number of bases with qLoUC <= qCStr[base] &
+#             refLoUC <= refQCStr[base] <= refHiUC
+######################################################################*/
+uint32_t qRunCntKeepScalar(
+    char *qCStr,      /*Read Q-scores (0 to not check)*/
+    char *refQCStr,   /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,   /*Number of bases in the run*/
+    uint8_t qLoUC,    /*Lowest read Q-score character to keep*/
+    uint8_t refLoUC,  /*Lowest reference Q-score character to keep*/
+    uint8_t refHiUC   /*Highest reference Q-score character to keep*/
+) /*Counts the bases in a run in the Q-score ranges (scalar)*/
+{ /*qRunCntKeepScalar*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-6 Sec-1 Sub-1 TOC: qRunCntKeepScalar
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t cntUI = 0;
+    uint8_t keepUC = 0;
+    unsigned char *qUCStr = (unsigned char *) qCStr;
+    unsigned char *refUCStr = (unsigned char *) refQCStr;
+
+    for(uint32_t baseUI = 0; baseUI < lenUI; ++baseUI)
+    { /*Loop: Check each base*/
+        keepUC = 1;
+
+        if(qUCStr != 0)
+            keepUC &= (qUCStr[baseUI] >= qLoUC);
+
+        if(refUCStr != 0)
+            keepUC &=
+                (refUCStr[baseUI] >= refLoUC) &
+                (refUCStr[baseUI] <= refHiUC);
+
+        cntUI += keepUC;
+    } /*Loop: Check each base*/
+
+    return cntUI;
+} /*qRunCntKeepScalar*/
+
+#ifdef qSSE2Bl
+/*######################################################################
+# Output:
+#    returns: Number of bases with qLoUC <= qCStr[base] &
+#             refLoUC <= refQCStr[base] <= refHiUC
+# Note:
+#    - x >= lo is max(x, lo) == x for unsigned bytes & x <= hi is
+#      min(x, hi) == x. SSE2 has no unsigned byte compare
+######################################################################*/
+uint32_t qRunCntKeepSSE2(
+    char *qCStr,      /*Read Q-scores (0 to not check)*/
+    char *refQCStr,   /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,   /*Number of bases in the run*/
+    uint8_t qLoUC,    /*Lowest read Q-score character to keep*/
+    uint8_t refLoUC,  /*Lowest reference Q-score character to keep*/
+    uint8_t refHiUC   /*Highest reference Q-score character to keep*/
+) /*Counts the bases in a run in the Q-score ranges (SSE2)*/
+{ /*qRunCntKeepSSE2*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-7 Sec-1 Sub-1 TOC: qRunCntKeepSSE2
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t cntUI = 0;
+    uint32_t baseUI = 0;
+    __m128i qLoVect = _mm_set1_epi8((char) qLoUC);
+    __m128i refLoVect = _mm_set1_epi8((char) refLoUC);
+    __m128i refHiVect = _mm_set1_epi8((char) refHiUC);
+    __m128i keepVect;
+    __m128i qVect;
+
+    for(baseUI = 0; baseUI + 16 <= lenUI; baseUI += 16)
+    { /*Loop: Check 16 bases at a time*/
+        keepVect = _mm_set1_epi8(-1);
+
+        if(qCStr != 0)
+        { /*If checking the read Q-scores*/
+            qVect = _mm_loadu_si128((__m128i *) (qCStr + baseUI));
+
+            keepVect =
+                _mm_cmpeq_epi8(_mm_max_epu8(qVect, qLoVect), qVect);
+        } /*If checking the read Q-scores*/
+
+        if(refQCStr != 0)
+        { /*If checking the reference Q-scores*/
+            qVect = _mm_loadu_si128((__m128i *) (refQCStr + baseUI));
+
+            keepVect =
+                _mm_and_si128(
+                    keepVect,
+                    _mm_cmpeq_epi8(_mm_max_epu8(qVect,refLoVect),qVect)
+                );
+
+            keepVect =
+                _mm_and_si128(
+                    keepVect,
+                    _mm_cmpeq_epi8(_mm_min_epu8(qVect,refHiVect),qVect)
+                );
+        } /*If checking the reference Q-scores*/
+
+        cntUI += __builtin_popcount(_mm_movemask_epi8(keepVect));
+    } /*Loop: Check 16 bases at a time*/
+
+    return
+          cntUI
+        + qRunCntKeepScalar(
+              qCStr == 0 ? 0 : qCStr + baseUI,
+              refQCStr == 0 ? 0 : refQCStr + baseUI,
+              lenUI - baseUI,
+              qLoUC,
+              refLoUC,
+              refHiUC
+          ); /*Check the bases at the end*/
+} /*qRunCntKeepSSE2*/
+#endif
+
+#ifdef qAVX2Bl
+/*######################################################################
+# Output:
+#    returns: Number of bases with qLoUC <= qCStr[base] &
+#             refLoUC <= refQCStr[base] <= refHiUC
+# Note:
+#    - Only call if __builtin_cpu_supports("avx2") is true
+######################################################################*/
+__attribute__((target("avx2")))
+uint32_t qRunCntKeepAVX2(
+    char *qCStr,      /*Read Q-scores (0 to not check)*/
+    char *refQCStr,   /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,   /*Number of bases in the run*/
+    uint8_t qLoUC,    /*Lowest read Q-score character to keep*/
+    uint8_t refLoUC,  /*Lowest reference Q-score character to keep*/
+    uint8_t refHiUC   /*Highest reference Q-score character to keep*/
+) /*Counts the bases in a run in the Q-score ranges (AVX2)*/
+{ /*qRunCntKeepAVX2*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-8 Sec-1 Sub-1 TOC: qRunCntKeepAVX2
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t cntUI = 0;
+    uint32_t baseUI = 0;
+    __m256i qLoVect = _mm256_set1_epi8((char) qLoUC);
+    __m256i refLoVect = _mm256_set1_epi8((char) refLoUC);
+    __m256i refHiVect = _mm256_set1_epi8((char) refHiUC);
+    __m256i keepVect;
+    __m256i qVect;
+
+    for(baseUI = 0; baseUI + 32 <= lenUI; baseUI += 32)
+    { /*Loop: Check 32 bases at a time*/
+        keepVect = _mm256_set1_epi8(-1);
+
+        if(qCStr != 0)
+        { /*If checking the read Q-scores*/
+            qVect = _mm256_loadu_si256((__m256i *) (qCStr + baseUI));
+
+            keepVect =
+               _mm256_cmpeq_epi8(_mm256_max_epu8(qVect,qLoVect),qVect);
+        } /*If checking the read Q-scores*/
+
+        if(refQCStr != 0)
+        { /*If checking the reference Q-scores*/
+            qVect = _mm256_loadu_si256((__m256i *) (refQCStr + baseUI));
+
+            keepVect =
+                _mm256_and_si256(
+                    keepVect,
+                    _mm256_cmpeq_epi8(
+                        _mm256_max_epu8(qVect, refLoVect),
+                        qVect
+                    )
+                );
+
+            keepVect =
+                _mm256_and_si256(
+                    keepVect,
+                    _mm256_cmpeq_epi8(
+                        _mm256_min_epu8(qVect, refHiVect),
+                        qVect
+                    )
+                );
+        } /*If checking the reference Q-scores*/
+
+        cntUI +=
+            __builtin_popcount(
+                (uint32_t) _mm256_movemask_epi8(keepVect)
+            );
+    } /*Loop: Check 32 bases at a time*/
+
+    return
+          cntUI
+        + qRunCntKeepScalar(
+              qCStr == 0 ? 0 : qCStr + baseUI,
+              refQCStr == 0 ? 0 : refQCStr + baseUI,
+              lenUI - baseUI,
+              qLoUC,
+              refLoUC,
+              refHiUC
+          ); /*Check the bases at the end*/
+} /*qRunCntKeepAVX2*/
+#endif
+
+#ifdef qNEONBl
+/*######################################################################
+# Output:
+#    returns: Number of bases with qLoUC <= qCStr[base] &
+#             refLoUC <= refQCStr[base] <= refHiUC
+######################################################################*/
+uint32_t qRunCntKeepNEON(
+    char *qCStr,      /*Read Q-scores (0 to not check)*/
+    char *refQCStr,   /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,   /*Number of bases in the run*/
+    uint8_t qLoUC,    /*Lowest read Q-score character to keep*/
+    uint8_t refLoUC,  /*Lowest reference Q-score character to keep*/
+    uint8_t refHiUC   /*Highest reference Q-score character to keep*/
+) /*Counts the bases in a run in the Q-score ranges (NEON)*/
+{ /*qRunCntKeepNEON*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    # Fun-9 Sec-1 Sub-1 TOC: qRunCntKeepNEON
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t cntUI = 0;
+    uint32_t baseUI = 0;
+    uint8x16_t oneVect = vdupq_n_u8(1);
+    uint8x16_t qLoVect = vdupq_n_u8(qLoUC);
+    uint8x16_t refLoVect = vdupq_n_u8(refLoUC);
+    uint8x16_t refHiVect = vdupq_n_u8(refHiUC);
+    uint8x16_t keepVect;
+    uint8x16_t qVect;
+
+    for(baseUI = 0; baseUI + 16 <= lenUI; baseUI += 16)
+    { /*Loop: Check 16 bases at a time*/
+        keepVect = vdupq_n_u8(0xff);
+
+        if(qCStr != 0)
+        { /*If checking the read Q-scores*/
+            qVect = vld1q_u8((uint8_t *) (qCStr + baseUI));
+            keepVect = vcgeq_u8(qVect, qLoVect);
+        } /*If checking the read Q-scores*/
+
+        if(refQCStr != 0)
+        { /*If checking the reference Q-scores*/
+            qVect = vld1q_u8((uint8_t *) (refQCStr + baseUI));
+            keepVect = vandq_u8(keepVect, vcgeq_u8(qVect, refLoVect));
+            keepVect = vandq_u8(keepVect, vcleq_u8(qVect, refHiVect));
+        } /*If checking the reference Q-scores*/
+
+        /*Each kept base is 0xff, so & 1 & add up the 16 lanes*/
+        cntUI += vaddvq_u8(vandq_u8(keepVect, oneVect));
+    } /*Loop: Check 16 bases at a time*/
+
+    return
+          cntUI
+        + qRunCntKeepScalar(
+              qCStr == 0 ? 0 : qCStr + baseUI,
+              refQCStr == 0 ? 0 : refQCStr + baseUI,
+              lenUI - baseUI,
+              qLoUC,
+              refLoUC,
+              refHiUC
+          ); /*Check the bases at the end*/
+} /*qRunCntKeepNEON*/
+#endif
@@ -1,11 +1,17 @@
 /*######################################################################
 # Use:
 #   o Holds the Median Q-score functions for scoreReads & findCoInft
+#   o Holds the Q-score run kernels used when scoring alignments.
+#     These have SSE2, AVX2 (picked at run time), & NEON versions. A
+#     scalar version is used for other CPUs or when compiled with
+#     -DNOSIMD
 # Includes:
 #   - "samEntryStruct.h"
 #   o "cStrToNumberFun.h"
 #   o "printErrors.h"
 # C standard libraries
+#   - <emmintrin.h> (SSE2) or <arm_neon.h> (NEON)
+#   - <immintrin.h> (AVX2)
 #   o <stdlib.h>
 #   o <stdio.h>
 #   o <string.h>
@@ -17,6 +23,19 @@
 
 #include "samEntryStruct.h"
 
+/*Pick the vector kernels this compiler & CPU can use*/
+#ifndef NOSIMD
+    #if defined(__GNUC__) && defined(__SSE2__)
+        #include <emmintrin.h>
+        #include <immintrin.h>
+        #define qSSE2Bl 1 /*x86 always has SSE2 on 64 bit*/
+        #define qAVX2Bl 1 /*Checked at run time*/
+    #elif defined(__GNUC__) && defined(__aarch64__)
+        #include <arm_neon.h>
+        #define qNEONBl 1 /*aarch64 always has NEON*/
+    #endif
+#endif
+
 /*######################################################################
 # output:
 #    returns: The read length (unsigned long)
@@ -37,4 +56,103 @@ float qHistToMed(
     uint32_t readLenUInt     /*Number of bases in the read*/
 ); /*converts histogram of q-scores into samStruct into median Q-score*/
 
+/*######################################################################
+# Output:
+#    modifies: qHistAryUI to have the Q-score of each base added
+#    returns: sum of the Q-scores in the run
+######################################################################*/
+unsigned long qRunHist(
+    char *qCStr,          /*Q-score entry (run) to add*/
+    uint32_t lenUI,       /*Number of Q-scores in the run*/
+    uint32_t *qHistAryUI  /*Histogram to add the Q-scores to*/
+); /*Adds a run of Q-scores to a histogram & sums them*/
+
+/*######################################################################
+# Output:
+#    returns: Number of bases in the run with a Q-score over minQI &
+#             a paired reference Q-score between refMinQI & refMaxQI
+# Note:
+#    - qCStr or refQCStr can be 0 to skip that check
+#    - Is the same as checking each base with the scalar code, but
+#      uses SSE2, AVX2, or NEON when the CPU has it
+######################################################################*/
+uint32_t qRunCntKeep(
+    char *qCStr,      /*Read Q-scores (0 to not check)*/
+    char *refQCStr,   /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,   /*Number of bases in the run*/
+    int32_t minQI,    /*Read Q-scores must be over this*/
+    int32_t refMinQI, /*Reference Q-scores must be over this*/
+    int32_t refMaxQI  /*Reference Q-scores must be under this*/
+); /*Counts the bases in a run that pass the Q-score thresholds*/
+
+/*######################################################################
+# Output:
+#    modifies: qHistAryUI to have the Q-score of each base added
+#    modifies: keptUI to the number of bases qRunCntKeep would keep
+#    returns: sum of the Q-scores in the run
+# Note:
+#    - Is qRunHist & qRunCntKeep in one call (faster on short runs)
+######################################################################*/
+unsigned long qRunStats(
+    char *qCStr,          /*Read Q-scores (run) to add & check*/
+    char *refQCStr,       /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,       /*Number of bases in the run*/
+    int32_t minQI,        /*Read Q-scores must be over this*/
+    int32_t refMinQI,     /*Reference Q-scores must be over this*/
+    int32_t refMaxQI,     /*Reference Q-scores must be under this*/
+    uint32_t *qHistAryUI, /*Histogram to add the Q-scores to*/
+    uint32_t *keptUI      /*Set to the number of bases to keep*/
+); /*Adds a run of Q-scores to a histogram & counts the bases to keep*/
+
+/*######################################################################
+# Output:
+#    returns: Number of bases with qLoUC <= qCStr[base] &
+#             refLoUC <= refQCStr[base] <= refHiUC
+# Note:
+#    - Use qRunCntKeep; this is the scalar kernel it falls back on.
+#      The SSE2, AVX2, & NEON kernels have the same input & output.
+#      They are only compiled on CPUs that have them.
+######################################################################*/
+uint32_t qRunCntKeepScalar(
+    char *qCStr,      /*Read Q-scores (0 to not check)*/
+    char *refQCStr,   /*Paired reference Q-scores (0 to not check)*/
+    uint32_t lenUI,   /*Number of bases in the run*/
+    uint8_t qLoUC,    /*Lowest read Q-score character to keep*/
+    uint8_t refLoUC,  /*Lowest reference Q-score character to keep*/
+    uint8_t refHiUC   /*Highest reference Q-score character to keep*/
+); /*Counts the bases in a run in the Q-score ranges (scalar)*/
+
+#ifdef qSSE2Bl
+    uint32_t qRunCntKeepSSE2(
+        char *qCStr,      /*Read Q-scores (0 to not check)*/
+        char *refQCStr,   /*Paired reference Q-scores (0 to skip)*/
+        uint32_t lenUI,   /*Number of bases in the run*/
+        uint8_t qLoUC,    /*Lowest read Q-score to keep*/
+        uint8_t refLoUC,  /*Lowest reference Q-score to keep*/
+        uint8_t refHiUC   /*Highest reference Q-score to keep*/
+    ); /*Counts the bases in a run in the Q-score ranges (SSE2)*/
+#endif
+
+#ifdef qAVX2Bl
+    uint32_t qRunCntKeepAVX2(
+        char *qCStr,      /*Read Q-scores (0 to not check)*/
+        char *refQCStr,   /*Paired reference Q-scores (0 to skip)*/
+        uint32_t lenUI,   /*Number of bases in the run*/
+        uint8_t qLoUC,    /*Lowest read Q-score to keep*/
+        uint8_t refLoUC,  /*Lowest reference Q-score to keep*/
+        uint8_t refHiUC   /*Highest reference Q-score to keep*/
+    ); /*Counts the bases in a run in the Q-score ranges (AVX2)*/
+#endif
+
+#ifdef qNEONBl
+    uint32_t qRunCntKeepNEON(
+        char *qCStr,      /*Read Q-scores (0 to not check)*/
+        char *refQCStr,   /*Paired reference Q-scores (0 to skip)*/
+        uint32_t lenUI,   /*Number of bases in the run*/
+        uint8_t qLoUC,    /*Lowest read Q-score to keep*/
+        uint8_t refLoUC,  /*Lowest reference Q-score to keep*/
+        uint8_t refHiUC   /*Highest reference Q-score to keep*/
+    ); /*Counts the bases in a run in the Q-score ranges (NEON)*/
+#endif
+
 #endif
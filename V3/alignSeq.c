@@ -0,0 +1,555 @@
+/*######################################################################
+# Name: alignSeq.c
+# Use:
+#    - Aligns each query in a fasta or fastq file to the first sequence
+#      in a reference fasta file. Both strands of the query are aligned
+#      & the best one is printed as a sam entry (eqx cigar).
+# Input:
+#    -ref:
+#        - Fasta file with the reference (first entry)      [Required]
+#    -query:
+#        - Fasta or fastq file with the queries             [Required]
+#    -out:
+#        - File to save the alignments to                   [stdout]
+#    -global:                                               [No]
+#        - Do a global alignment (semi-global by default)
+#    -match, -snp, -gap-open, -gap-extend:
+#        - Scores for the alignment (see defaultSettings.h)
+#    -no-clip:                                              [No]
+#        - Do not soft mask ends that lower the score
+# Output:
+#    - stdout or -out: sam file
+# Includes:
+#    - "alignmentsFun.h"
+#    - "sequenceFun.h"
+#    - "cStrToNumberFun.h"
+#    - "defaultSettings.h"
+#    o "twoBitArrays.h"
+# C standard libraries:
+#   - <string.h>
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOP:
+'   main Main function to glue everything together
+'   fun-1 checkInput: Checks the user input [returns: 1 if valid]
+'   fun-2 printAlnSam: Prints an alignment as a sam entry
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <string.h>
+#include "alignmentsFun.h"
+#include "sequenceFun.h"
+#include "cStrToNumberFun.h"
+#include "defaultSettings.h"
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies: Each input variable to hold user input
+|    - Returns:
+|        o 0: No input
+|        o 1: if valid input
+|        o 2: if an invalid parameter was input
+|        o 4: if an invalid score was input
+|    - Sets: errCStr to point to the invalid input
+\---------------------------------------------------------------------*/
+char checkInput(
+    int *lenArgsInt,        /*Number arguments user input*/
+    char *argsCStr[],       /*Array with user arguments*/
+    char **refPathCStr,     /*Gets the reference fasta file*/
+    char **qryPathCStr,     /*Gets the query fasta/fastq file*/
+    char **outPathCStr,     /*Gets the file to print to*/
+    struct alnSet *setST,   /*Gets the alignment settings*/
+    char **errCStr          /*Gets the invalid argument*/
+); /*Checks & extracts user input*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Prints: The alignment in alnST as a sam entry to outFILE. If
+|      alnST is 0, then the query is printed as unmapped
+\---------------------------------------------------------------------*/
+void printAlnSam(
+    struct seqStruct *qryST, /*Query aligned*/
+    struct seqStruct *refST, /*Reference aligned to*/
+    struct alnStruct *alnST, /*Alignment to print (0 for unmapped)*/
+    char revBl,              /*1: query was reverse complemented*/
+    FILE *outFILE            /*File to print the entry to*/
+); /*Prints an alignment as a sam entry*/
+
+int main(int lenArgsInt, char *argsPtrCStr[])
+{ /*main function*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Main TOC: main
+    '    main sec-1: Variable declarations
+    '    main sec-2: Read in and check user input
+    '    main sec-3: Read in the reference & open the files
+    '    main sec-4: Align each query (both strands)
+    '    main sec-5: Clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-1: Variable declarations
+    ^    main sec-1 sub-1: normal variable declerations
+    ^    main sec-1 sub-2: help message
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Main Sec-1 Sub-1: normal variable declerations
+    \******************************************************************/
+
+    char *refPathCStr = 0;  /*Reference fasta file*/
+    char *qryPathCStr = 0;  /*Query fasta/fastq file*/
+    char *outPathCStr = 0;  /*File to print alignments to*/
+    char *errCStr = 0;      /*Invalid argument*/
+    char errChar = 0;
+    uint8_t errUC = 0;
+    uint8_t revErrUC = 0;
+
+    struct alnSet setST;
+    struct alnStruct fwdAlnST; /*Forward alignment*/
+    struct alnStruct revAlnST; /*Reverse complement alignment*/
+    struct seqStruct refST;
+    struct seqStruct qryST;
+    struct twoBitAry refBitST;
+    struct twoBitAry qryBitST;
+    struct twoBitAry revBitST;
+
+    FILE *refFILE = 0;
+    FILE *qryFILE = 0;
+    FILE *outFILE = stdout;
+
+    /******************************************************************\
+    * Main Sec-1 Sub-2: help message
+    \******************************************************************/
+
+    char
+        *helpMesgCStr = "\
+            \n Command: alignSeq -ref ref.fasta -query reads.fastq\
+            \n Use:\
+            \n    - Aligns each query to the first reference sequence\
+            \n      (both strands) & prints the best alignment as a\
+            \n      sam entry with an eqx cigar\
+            \n Output:\
+            \n    - stdout: sam file (or -out)\
+            \n Input:\
+            \n    -ref:                                      [Required]\
+            \n        - Fasta file with the reference (first entry)\
+            \n    -query:                                    [Required]\
+            \n        - Fasta or fastq file with the queries\
+            \n    -out:                                      [stdout]\
+            \n        - File to print the alignments to\
+            \n    -global:                                   [No]\
+            \n        - Global alignment (semi-global by default)\
+            \n    -match:                                    [2]\
+            \n        - Score for a match\
+            \n    -snp:                                      [4]\
+            \n        - Penalty for a mismatch\
+            \n    -gap-open:                                 [4]\
+            \n        - Penalty for opening a gap\
+            \n    -gap-extend:                               [2]\
+            \n        - Penalty for each base in a gap\
+            \n    -no-clip:                                  [No]\
+            \n        - Do not soft mask ends that lower the score\
+            \n";
+
+    initAlnSet(&setST);
+    initAlnStruct(&fwdAlnST);
+    initAlnStruct(&revAlnST);
+    initSeqST(&refST);
+    initSeqST(&qryST);
+    initTwoBitAry(&refBitST);
+    initTwoBitAry(&qryBitST);
+    initTwoBitAry(&revBitST);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-2: Read in and check user input
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errChar =
+        checkInput(
+            &lenArgsInt,
+            argsPtrCStr,
+            &refPathCStr,
+            &qryPathCStr,
+            &outPathCStr,
+            &setST,
+            &errCStr
+        ); /*Get user input*/
+
+    if(errChar == 0)
+    { /*If user requested the help message*/
+        fprintf(stderr, "%s\nNo input arguments\n", helpMesgCStr);
+        exit(-1);
+    } /*If user requested the help message*/
+
+    if(errChar & 2)
+    { /*if the user input an invalid input*/
+        if(
+            strcmp(errCStr, "-h") == 0 ||
+            strcmp(errCStr, "--h") == 0 ||
+            strcmp(errCStr, "-help") == 0 ||
+            strcmp(errCStr, "--help") == 0
+        ) { /*If user requested the help message*/
+            fprintf(stdout, "%s\n", helpMesgCStr);
+            exit(0);
+        } /*If user requested the help message*/
+
+        if(
+            strcmp(errCStr, "-v") == 0 ||
+            strcmp(errCStr, "-V") == 0 ||
+            strcmp(errCStr, "-Version") == 0 ||
+            strcmp(errCStr, "-version") == 0
+        ) { /*If the user is requesting the version number*/
+            fprintf(
+                stdout,
+                "alignSeq built from findCoInft version: %.8f\n",
+                defVersion
+            );
+            exit(0);
+        } /*If the user is requesting the version number*/
+
+        fprintf(stderr, "%s\n%s is invalid\n", helpMesgCStr, errCStr);
+        exit(-1);
+    } /*if the user input an invalid input*/
+
+    if(errChar & 4)
+    { /*If the user input an invalid score*/
+        fprintf(stderr, "%s is not a valid score\n", errCStr);
+        exit(-1);
+    } /*If the user input an invalid score*/
+
+    if(refPathCStr == 0 || qryPathCStr == 0)
+    { /*If the user did not provide both files*/
+        fprintf(
+            stderr,
+            "%s\n-ref & -query are required\n",
+            helpMesgCStr
+        );
+        exit(-1);
+    } /*If the user did not provide both files*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-3: Read in the reference & open the files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    refFILE = fopen(refPathCStr, "r");
+
+    if(refFILE == 0)
+    { /*If could not open the reference*/
+        fprintf(stderr, "Unable to open reference (%s)\n", refPathCStr);
+        exit(-1);
+    } /*If could not open the reference*/
+
+    errUC = readSeqST(refFILE, &refST);
+    fclose(refFILE);
+
+    if(errUC != 1)
+    { /*If could not read in the reference*/
+        fprintf(stderr, "Unable to read reference (%s)\n", refPathCStr);
+        freeSeqST(&refST);
+        exit(-1);
+    } /*If could not read in the reference*/
+
+    if(seqToTwoBitAry(refST.seqCStr, refST.lenSeqUL, &refBitST) & 64)
+    { /*If ran out of memory*/
+        fprintf(stderr, "Memory allocation error\n");
+        freeSeqST(&refST);
+        exit(-1);
+    } /*If ran out of memory*/
+
+    qryFILE = fopen(qryPathCStr, "r");
+
+    if(qryFILE == 0)
+    { /*If could not open the queries*/
+        fprintf(stderr, "Unable to open queries (%s)\n", qryPathCStr);
+        freeSeqST(&refST);
+        freeTwoBitAry(&refBitST);
+        exit(-1);
+    } /*If could not open the queries*/
+
+    if(outPathCStr != 0)
+    { /*If the user provided an output file*/
+        outFILE = fopen(outPathCStr, "w");
+
+        if(outFILE == 0)
+        { /*If could not open the output file*/
+            fprintf(
+                stderr,
+                "Unable to open the output file for writing (%s)\n",
+                outPathCStr
+            );
+            fclose(qryFILE);
+            freeSeqST(&refST);
+            freeTwoBitAry(&refBitST);
+            exit(-1);
+        } /*If could not open the output file*/
+    } /*If the user provided an output file*/
+
+    fprintf(outFILE, "@HD\tVN:1.6\tSO:unsorted\n");
+    fprintf(
+        outFILE,
+        "@SQ\tSN:%s\tLN:%lu\n",
+        refST.idCStr,
+        refST.lenSeqUL
+    );
+    fprintf(
+        outFILE,
+        "@PG\tID:alignSeq\tPN:alignSeq\tVN:%.8f\n",
+        defVersion
+    );
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-4: Align each query (both strands)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errUC = readSeqST(qryFILE, &qryST);
+
+    while(errUC == 1)
+    { /*Loop: Align each query*/
+        errUC = seqToTwoBitAry(qryST.seqCStr,qryST.lenSeqUL,&qryBitST);
+        errUC |= revCompTwoBitAry(&qryBitST, &revBitST);
+
+        if(errUC & 64)
+            break;
+
+        errUC =
+            alignTwoBit(
+                &qryBitST,
+                qryST.seqCStr,
+                &refBitST,
+                refST.seqCStr,
+                &setST,
+                &fwdAlnST
+            );
+
+        if(errUC & 64)
+            break;
+
+        revCompSeqST(&qryST);
+
+        revErrUC =
+            alignTwoBit(
+                &revBitST,
+                qryST.seqCStr,
+                &refBitST,
+                refST.seqCStr,
+                &setST,
+                &revAlnST
+            );
+
+        if(revErrUC & 64)
+        { /*If ran out of memory*/
+            errUC = 64;
+            break;
+        } /*If ran out of memory*/
+
+        if(errUC != 1)
+            printAlnSam(&qryST, &refST, 0, 0, outFILE);
+
+        else if(revAlnST.scoreL > fwdAlnST.scoreL)
+            printAlnSam(&qryST, &refST, &revAlnST, 1, outFILE);
+
+        else
+        { /*Else: The forward alignment is better*/
+            revCompSeqST(&qryST); /*Back to the forward strand*/
+            printAlnSam(&qryST, &refST, &fwdAlnST, 0, outFILE);
+        } /*Else: The forward alignment is better*/
+
+        errUC = readSeqST(qryFILE, &qryST);
+    } /*Loop: Align each query*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-5: Clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fclose(qryFILE);
+
+    if(outFILE != stdout)
+        fclose(outFILE);
+
+    freeAlnStruct(&fwdAlnST);
+    freeAlnStruct(&revAlnST);
+    freeSeqST(&refST);
+    freeSeqST(&qryST);
+    freeTwoBitAry(&refBitST);
+    freeTwoBitAry(&qryBitST);
+    freeTwoBitAry(&revBitST);
+
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        fprintf(stderr, "Memory allocation error\n");
+        exit(-1);
+    } /*If had a memory allocation error*/
+
+    exit(0);
+} /*main function*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies: Each input variable to hold user input
+|    - Returns:
+|        o 0: No input
+|        o 1: if valid input
+|        o 2: if an invalid parameter was input
+|        o 4: if an invalid score was input
+|    - Sets: errCStr to point to the invalid input
+\---------------------------------------------------------------------*/
+char checkInput(
+    int *lenArgsInt,        /*Number arguments user input*/
+    char *argsCStr[],       /*Array with user arguments*/
+    char **refPathCStr,     /*Gets the reference fasta file*/
+    char **qryPathCStr,     /*Gets the query fasta/fastq file*/
+    char **outPathCStr,     /*Gets the file to print to*/
+    struct alnSet *setST,   /*Gets the alignment settings*/
+    char **errCStr          /*Gets the invalid argument*/
+) /*Checks & extracts user input*/
+{ /*checkInput*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: checkInput
+    '    fun-1 sec-1: Variable declerations
+    '    fun-1 sec-2: Look through user input
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *tmpCStr = 0;
+    char *singleArgCStr = 0;
+    int16_t *scoreI = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-2: Look through user input
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(*lenArgsInt < 2)
+        return 0; /*no arguments input*/
+
+    for(int intArg = 1; intArg < *lenArgsInt; intArg++)
+    { /*loop through all user input arguments*/
+        singleArgCStr = argsCStr[intArg + 1];
+        tmpCStr = argsCStr[intArg];
+        scoreI = 0;
+
+        if(strcmp(tmpCStr, "-ref") == 0)
+            *refPathCStr = singleArgCStr;
+
+        else if(strcmp(tmpCStr, "-query") == 0)
+            *qryPathCStr = singleArgCStr;
+
+        else if(strcmp(tmpCStr, "-out") == 0)
+            *outPathCStr = singleArgCStr;
+
+        else if(strcmp(tmpCStr, "-global") == 0)
+        { /*If doing a global alignment*/
+            setST->globalBl = 1;
+            intArg--; /*Account for incurment at end of loop*/
+        } /*If doing a global alignment*/
+
+        else if(strcmp(tmpCStr, "-no-clip") == 0)
+        { /*If not soft masking low scoring ends*/
+            setST->clipEndsBl = 0;
+            intArg--; /*Account for incurment at end of loop*/
+        } /*If not soft masking low scoring ends*/
+
+        else if(strcmp(tmpCStr, "-match") == 0)
+            scoreI = &setST->matchI;
+
+        else if(strcmp(tmpCStr, "-snp") == 0)
+            scoreI = &setST->snpI;
+
+        else if(strcmp(tmpCStr, "-gap-open") == 0)
+            scoreI = &setST->gapOpenI;
+
+        else if(strcmp(tmpCStr, "-gap-extend") == 0)
+            scoreI = &setST->gapExtI;
+
+        else
+        { /*Else is invalid input*/
+            *errCStr = tmpCStr;
+            return 2;
+        } /*Else is invalid input*/
+
+        if(scoreI != 0)
+        { /*If this was a score*/
+            if(singleArgCStr == 0)
+            { /*If the user did not give a score*/
+                *errCStr = tmpCStr;
+                return 4;
+            } /*If the user did not give a score*/
+
+            tmpCStr = cStrToInt16(singleArgCStr, scoreI);
+
+            if(*tmpCStr != '\0' || *scoreI < 0 || *scoreI > 1000)
+            { /*If the score is not a small positive number*/
+                *errCStr = singleArgCStr;
+                return 4;
+            } /*If the score is not a small positive number*/
+        } /*If this was a score*/
+
+        intArg++; /*Move to the parameter, so next input is a flag*/
+    } /*loop through all user input arguments*/
+
+    return 1; /*input is valid*/
+} /*checkInput*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Prints: The alignment in alnST as a sam entry to outFILE. If
+|      alnST is 0, then the query is printed as unmapped
+\---------------------------------------------------------------------*/
+void printAlnSam(
+    struct seqStruct *qryST, /*Query aligned*/
+    struct seqStruct *refST, /*Reference aligned to*/
+    struct alnStruct *alnST, /*Alignment to print (0 for unmapped)*/
+    char revBl,              /*1: query was reverse complemented*/
+    FILE *outFILE            /*File to print the entry to*/
+) /*Prints an alignment as a sam entry*/
+{ /*printAlnSam*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: Sec-1 Sub-1: printAlnSam
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *qCStr = qryST->qCStr;
+
+    if(qCStr == 0 || *qCStr == '\0')
+        qCStr = "*";
+
+    if(alnST == 0)
+    { /*If printing an unmapped query*/
+        fprintf(
+            outFILE,
+            "%s\t4\t*\t0\t0\t*\t*\t0\t0\t%s\t%s\n",
+            qryST->idCStr,
+            qryST->seqCStr,
+            qCStr
+        );
+        return;
+    } /*If printing an unmapped query*/
+
+    fprintf(
+        outFILE,
+        "%s\t%u\t%s\t%lu\t60\t%s\t*\t0\t0\t%s\t%s",
+        qryST->idCStr,
+        revBl ? 16 : 0,
+        refST->idCStr,
+        alnST->refStartUL + 1,
+        alnST->cigarCStr,
+        qryST->seqCStr,
+        qCStr
+    );
+
+    fprintf(
+        outFILE,
+        "\tNM:i:%u\tAS:i:%ld\n",
+        alnST->numSnpUI + alnST->numInsUI + alnST->numDelUI,
+        alnST->scoreL
+    );
+
+    return;
+} /*printAlnSam*/
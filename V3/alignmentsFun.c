@@ -0,0 +1,1323 @@
+/*######################################################################
+# Use:
+#   o Holds the pairwise aligner (scalar & striped SSE2 kernels), its
+#     trace back, & the functions to make the eqx cigar
+######################################################################*/
+
+#include "alignmentsFun.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF TOC: Start of Functions
+'   o fun-1 initAlnSet:
+'     - Sets an alnSet to the default settings
+'   o fun-2 initAlnStruct:
+'     - Sets all variables in an alnStruct to defaults (no buffers)
+'   o fun-3 freeAlnStruct:
+'     - Frees the buffers in an alnStruct
+'   o fun-4 alignTwoBit:
+'     - Aligns a query to a reference & makes the eqx cigar
+'   o fun-5 alnFitsInt16:
+'     - Checks if every score in an alignment fits in 16 bits
+'   o fun-6 alnScalar:
+'     - Scalar kernel; scores all cells & keeps their directions
+'   o fun-7 alnStripedSSE2:
+'     - Striped SSE2 kernel; scores all cells & keeps their directions
+'   o fun-8 alnTraceBack:
+'     - Follows the cell directions back from the best cell
+'   o fun-9 alnClipEnds:
+'     - Soft masks the ends of an alignment that lower the score
+'   o fun-10 alnOpsToCigar:
+'     - Makes the eqx cigar & counts the matches, SNPs, & indels
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o setST to have the default scores & settings
+\---------------------------------------------------------------------*/
+void initAlnSet(
+    struct alnSet *setST /*Settings to initialize*/
+) /*Sets an alnSet to the default settings*/
+{ /*initAlnSet*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: Sec-1 Sub-1: initAlnSet
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    setST->matchI = defAlnMatchI;
+    setST->snpI = defAlnSnpI;
+    setST->gapOpenI = defAlnGapOpenI;
+    setST->gapExtI = defAlnGapExtI;
+    setST->globalBl = defAlnGlobalBl;
+    setST->clipEndsBl = defAlnClipEndsBl;
+    setST->maxCellsUL = defAlnMaxCellsUL;
+    return;
+} /*initAlnSet*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o All variables in alnST to be 0 (does not free)
+\---------------------------------------------------------------------*/
+void initAlnStruct(
+    struct alnStruct *alnST /*Structure to initialize*/
+) /*Sets all variables in an alnStruct to defaults (no buffers)*/
+{ /*initAlnStruct*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: Sec-1 Sub-1: initAlnStruct
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    alnST->vectAryI = 0;
+    alnST->lenVectUL = 0;
+    alnST->scalarAryI = 0;
+    alnST->lenScalarUL = 0;
+    alnST->codeAryUC = 0;
+    alnST->lenCodeUL = 0;
+    alnST->dirAryUC = 0;
+    alnST->lenDirUL = 0;
+    alnST->opCStr = 0;
+    alnST->lenOpUL = 0;
+    alnST->cigarCStr = 0;
+    alnST->lenCigarUL = 0;
+
+    alnST->segLenUL = 0;
+    alnST->lanesUL = 0;
+
+    alnST->scoreL = 0;
+    alnST->refStartUL = 0;
+    alnST->refEndUL = 0;
+    alnST->qryStartUL = 0;
+    alnST->qryEndUL = 0;
+    alnST->numOpsUL = 0;
+    alnST->numMatchUI = 0;
+    alnST->numSnpUI = 0;
+    alnST->numInsUI = 0;
+    alnST->numDelUI = 0;
+    return;
+} /*initAlnStruct*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Frees: All buffers in alnST & then initializes alnST
+\---------------------------------------------------------------------*/
+void freeAlnStruct(
+    struct alnStruct *alnST /*Structure to free*/
+) /*Frees the buffers in an alnStruct*/
+{ /*freeAlnStruct*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: freeAlnStruct
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(alnST->vectAryI);
+    free(alnST->scalarAryI);
+    free(alnST->codeAryUC);
+    free(alnST->dirAryUC);
+    free(alnST->opCStr);
+    free(alnST->cigarCStr);
+    initAlnStruct(alnST);
+    return;
+} /*freeAlnStruct*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if aligned the query
+|        o 2 if the query or reference has no bases
+|        o 4 if the alignment has more than setST->maxCellsUL cells
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o alnST to have the alignment, its score, & its eqx cigar
+\---------------------------------------------------------------------*/
+uint8_t alignTwoBit(
+    struct twoBitAry *qryST, /*Packed query*/
+    char *qrySeqCStr,        /*Query text (for the =/X cigar entries)*/
+    struct twoBitAry *refST, /*Packed reference*/
+    char *refSeqCStr,        /*Reference text (for the =/X entries)*/
+    struct alnSet *setST,    /*Scores & settings to align with*/
+    struct alnStruct *alnST  /*Buffers & gets the alignment*/
+) /*Aligns a query to a reference & makes the eqx cigar*/
+{ /*alignTwoBit*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: alignTwoBit
+    '   fun-4 sec-1: Check the sizes & unpack the query
+    '   fun-4 sec-2: Score the cells (SSE2 or scalar)
+    '   fun-4 sec-3: Trace back, clip the ends, & make the cigar
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Check the sizes & unpack the query
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long lenQryUL = qryST->lenSeqUL;
+    unsigned long lenRefUL = refST->lenSeqUL;
+    unsigned long endQryUL = 0; /*Row the alignment ends on*/
+    unsigned long endRefUL = 0; /*Column the alignment ends on*/
+    uint8_t errUC = 0;
+    uint8_t *tmpAryUC = 0;
+
+    if(lenQryUL == 0 || lenRefUL == 0)
+        return 2;
+
+    if(lenQryUL * lenRefUL > setST->maxCellsUL)
+        return 4;
+
+    if(lenQryUL > alnST->lenCodeUL)
+    { /*If need a larger buffer for the query codes*/
+        tmpAryUC =
+            realloc(alnST->codeAryUC, lenQryUL * sizeof(uint8_t));
+
+        if(tmpAryUC == 0)
+            return 64;
+
+        alnST->codeAryUC = tmpAryUC;
+        alnST->lenCodeUL = lenQryUL;
+    } /*If need a larger buffer for the query codes*/
+
+    twoBitAryToCodes(qryST, 0, lenQryUL, alnST->codeAryUC);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Score the cells (SSE2 or scalar)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errUC = 0;
+
+    #ifdef alnSSE2Bl
+        if(alnFitsInt16(lenQryUL, lenRefUL, setST))
+            errUC =
+                alnStripedSSE2(
+                    alnST->codeAryUC,
+                    lenQryUL,
+                    refST,
+                    setST,
+                    alnST,
+                    &endQryUL,
+                    &endRefUL
+                );
+    #endif
+
+    if(errUC == 0)
+        errUC =
+            alnScalar(
+                alnST->codeAryUC,
+                lenQryUL,
+                refST,
+                setST,
+                alnST,
+                &endQryUL,
+                &endRefUL
+            );
+
+    if(errUC & 64)
+        return 64;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-3: Trace back, clip the ends, & make the cigar
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errUC =
+        alnTraceBack(
+            qrySeqCStr,
+            lenQryUL,
+            refSeqCStr,
+            lenRefUL,
+            endQryUL,
+            endRefUL,
+            setST,
+            alnST
+        );
+
+    if(errUC & 64)
+        return 64;
+
+    if(!setST->globalBl && setST->clipEndsBl)
+        alnClipEnds(setST, alnST);
+
+    return alnOpsToCigar(setST, alnST);
+} /*alignTwoBit*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if every score is between -32000 & 32000
+|        o 0 if a score could overflow a 16 bit integer
+\---------------------------------------------------------------------*/
+uint8_t alnFitsInt16(
+    unsigned long lenQryUL, /*Number of bases in the query*/
+    unsigned long lenRefUL, /*Number of bases in the reference*/
+    struct alnSet *setST    /*Scores to align with*/
+) /*Checks if every score in an alignment fits in 16 bits*/
+{ /*alnFitsInt16*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: alnFitsInt16
+    '   - H is at most match * (shortest length) & at least the
+    '     diagonal (SNP) path plus one gap (the global edges are one
+    '     gap). E & F are at most one gap open below H. The 8 adds
+    '     room for the padding lanes
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long openUL =
+        (unsigned long) (setST->gapOpenI + setST->gapExtI);
+    unsigned long minUL = lenQryUL;
+    unsigned long maxUL = lenRefUL;
+    unsigned long scoreUL = (unsigned long) setST->matchI;
+
+    if(lenRefUL < lenQryUL)
+    { /*If the reference is shorter*/
+        minUL = lenRefUL;
+        maxUL = lenQryUL;
+    } /*If the reference is shorter*/
+
+    if((unsigned long) setST->snpI > scoreUL)
+        scoreUL = (unsigned long) setST->snpI;
+
+    if(openUL > scoreUL)
+        scoreUL = openUL;
+
+    return
+          (minUL + 8) * scoreUL
+        + maxUL * (unsigned long) setST->gapExtI
+        + (openUL << 1)
+      < 32000;
+} /*alnFitsInt16*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if scored the alignment
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o dirAryUC, segLenUL (query length), & lanesUL (1) in alnST
+|        o endQryUL & endRefUL to have the cell the alignment ends at
+|          (row & column, so index 1)
+|        o alnST->scoreL to have the score of that cell
+\---------------------------------------------------------------------*/
+uint8_t alnScalar(
+    uint8_t *qryAryUC,       /*Query as one byte two bit codes*/
+    unsigned long lenQryUL,  /*Number of bases in the query*/
+    struct twoBitAry *refST, /*Packed reference*/
+    struct alnSet *setST,    /*Scores & settings to align with*/
+    struct alnStruct *alnST, /*Buffers & gets the directions*/
+    unsigned long *endQryUL, /*Gets the row the alignment ends on*/
+    unsigned long *endRefUL  /*Gets the column the alignment ends on*/
+) /*Scalar kernel; scores all cells & keeps their directions*/
+{ /*alnScalar*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: alnScalar
+    '   fun-6 sec-1: Variable declarations & get memory
+    '   fun-6 sec-2: Set up the first column (query vs nothing)
+    '   fun-6 sec-3: Score each column & keep each cells direction
+    '   fun-6 sec-4: Find the end of the alignment
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-1: Variable declarations & get memory
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long lenRefUL = refST->lenSeqUL;
+    unsigned long needUL = (lenQryUL + 1) << 1;
+    int32_t openI = setST->gapOpenI + setST->gapExtI;
+    int32_t extI = setST->gapExtI;
+    int32_t minI = -(1 << 28); /*Stands in for negative infinity*/
+
+    int32_t *hAryI = 0;  /*Scores in the last column (then current)*/
+    int32_t *eAryI = 0;  /*Deletion scores for the current column*/
+    int32_t hDiagI = 0;  /*H(i - 1, j - 1)*/
+    int32_t hTopI = 0;   /*H(0, j)*/
+    int32_t hI = 0;
+    int32_t eI = 0;
+    int32_t fI = 0;
+    int32_t eOpenI = 0;
+    int32_t fOpenI = 0;
+    int32_t bestI = 0;
+    uint8_t refUC = 0;
+    uint8_t dirUC = 0;
+    uint8_t *dirUCPtr = 0;
+
+    int32_t *tmpAryI = 0;
+    uint8_t *tmpAryUC = 0;
+
+    if(needUL > alnST->lenScalarUL)
+    { /*If need more memory for the score columns*/
+        tmpAryI = realloc(alnST->scalarAryI, needUL * sizeof(int32_t));
+
+        if(tmpAryI == 0)
+            return 64;
+
+        alnST->scalarAryI = tmpAryI;
+        alnST->lenScalarUL = needUL;
+    } /*If need more memory for the score columns*/
+
+    needUL = lenQryUL * lenRefUL;
+
+    if(needUL > alnST->lenDirUL)
+    { /*If need more memory for the directions*/
+        tmpAryUC = realloc(alnST->dirAryUC, needUL * sizeof(uint8_t));
+
+        if(tmpAryUC == 0)
+            return 64;
+
+        alnST->dirAryUC = tmpAryUC;
+        alnST->lenDirUL = needUL;
+    } /*If need more memory for the directions*/
+
+    hAryI = alnST->scalarAryI;
+    eAryI = alnST->scalarAryI + lenQryUL + 1;
+    alnST->segLenUL = lenQryUL;
+    alnST->lanesUL = 1;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-2: Set up the first column (query vs nothing)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    hAryI[0] = 0;
+
+    for(unsigned long ulRow = 1; ulRow <= lenQryUL; ++ulRow)
+    { /*Loop: Set up H(i, 0) & E(i, 0)*/
+        if(setST->globalBl)
+            hAryI[ulRow] = -(openI + (int32_t) (ulRow - 1) * extI);
+        else
+            hAryI[ulRow] = 0;
+
+        eAryI[ulRow] = minI;
+    } /*Loop: Set up H(i, 0) & E(i, 0)*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-3: Score each column & keep each cells direction
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    bestI = minI;
+    *endQryUL = lenQryUL;
+    *endRefUL = lenRefUL;
+    dirUCPtr = alnST->dirAryUC;
+
+    for(unsigned long ulCol = 1; ulCol <= lenRefUL; ++ulCol)
+    { /*Loop: Score each column (reference base)*/
+        refUC = getTwoBitAryBase(refST, ulCol - 1);
+
+        if(setST->globalBl)
+            hTopI = -(openI + (int32_t) (ulCol - 1) * extI);
+        else
+            hTopI = 0;
+
+        hDiagI = hAryI[0];
+        hAryI[0] = hTopI;
+        fI = minI;
+        hI = hTopI; /*H(i - 1, j) for the first row*/
+
+        for(unsigned long ulRow = 1; ulRow <= lenQryUL; ++ulRow)
+        { /*Loop: Score each cell in the column*/
+            /*E(i, j) from H(i, j - 1) & E(i, j - 1)*/
+            eOpenI = hAryI[ulRow] - openI;
+            eI = eAryI[ulRow] - extI;
+            dirUC = 0;
+
+            if(eI > eOpenI)
+                dirUC |= alnDelExtUC;
+            else
+                eI = eOpenI;
+
+            /*F(i, j) from H(i - 1, j) & F(i - 1, j)*/
+            fOpenI = hI - openI;
+            fI -= extI;
+
+            if(fI > fOpenI)
+                dirUC |= alnInsExtUC;
+            else
+                fI = fOpenI;
+
+            /*H(i, j); ties go to the diagonal & then deletions*/
+            if(qryAryUC[ulRow - 1] == refUC)
+                hI = hDiagI + setST->matchI;
+            else
+                hI = hDiagI - setST->snpI;
+
+            if(eI > hI)
+            { /*If a deletion is better*/
+                hI = eI;
+                dirUC |= alnDelUC;
+            } /*If a deletion is better*/
+
+            if(fI > hI)
+            { /*If an insertion is better*/
+                hI = fI;
+                dirUC = (dirUC & ~alnSrcMaskUC) | alnInsUC;
+            } /*If an insertion is better*/
+
+            hDiagI = hAryI[ulRow];
+            hAryI[ulRow] = hI;
+            eAryI[ulRow] = eI;
+            *dirUCPtr = dirUC;
+            ++dirUCPtr;
+        } /*Loop: Score each cell in the column*/
+
+        /*The last row (whole query aligned) can end semi-global*/
+        if(!setST->globalBl && hI > bestI)
+        { /*If this is the best end so far*/
+            bestI = hI;
+            *endQryUL = lenQryUL;
+            *endRefUL = ulCol;
+        } /*If this is the best end so far*/
+    } /*Loop: Score each column (reference base)*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-4: Find the end of the alignment
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(setST->globalBl)
+        bestI = hAryI[lenQryUL];
+
+    else
+    { /*Else: the last column (whole reference) can also end*/
+        for(unsigned long ulRow = 1; ulRow < lenQryUL; ++ulRow)
+        { /*Loop: Check the last column*/
+            if(hAryI[ulRow] > bestI)
+            { /*If this is a better end*/
+                bestI = hAryI[ulRow];
+                *endQryUL = ulRow;
+                *endRefUL = lenRefUL;
+            } /*If this is a better end*/
+        } /*Loop: Check the last column*/
+    } /*Else: the last column (whole reference) can also end*/
+
+    alnST->scoreL = bestI;
+    return 1;
+} /*alnScalar*/
+
+#ifdef alnSSE2Bl
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if scored the alignment
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o dirAryUC, segLenUL, & lanesUL (8) in alnST. The cells in
+|          each column are striped (Farrar), so query base i is in
+|          segment i % segLenUL & lane i / segLenUL
+|        o endQryUL, endRefUL, & alnST->scoreL (see alnScalar)
+| Note:
+|    - Only call when alnFitsInt16 is true for the alignment
+\---------------------------------------------------------------------*/
+uint8_t alnStripedSSE2(
+    uint8_t *qryAryUC,       /*Query as one byte two bit codes*/
+    unsigned long lenQryUL,  /*Number of bases in the query*/
+    struct twoBitAry *refST, /*Packed reference*/
+    struct alnSet *setST,    /*Scores & settings to align with*/
+    struct alnStruct *alnST, /*Buffers & gets the directions*/
+    unsigned long *endQryUL, /*Gets the row the alignment ends*/
+    unsigned long *endRefUL  /*Gets the column alignment ends*/
+) /*Striped SSE2 kernel; scores all cells & keeps directions*/
+{ /*alnStripedSSE2*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: alnStripedSSE2
+    '   fun-7 sec-1: Variable declarations & get memory
+    '   fun-7 sec-2: Build the query profile
+    '   fun-7 sec-3: Set up the first column (query vs nothing)
+    '   fun-7 sec-4: Score each column (main pass)
+    '   fun-7 sec-5: Carry insertions across the lanes (lazy F)
+    '   fun-7 sec-6: Find each cells direction
+    '   fun-7 sec-7: Find the end of the alignment
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-1: Variable declarations & get memory
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long lenRefUL = refST->lenSeqUL;
+    unsigned long segLenUL = (lenQryUL + 7) >> 3;
+    unsigned long colUL = segLenUL << 3; /*int16_t's in a column*/
+    unsigned long needUL = colUL * 10;
+    unsigned long qryUL = 0;
+    unsigned long lastUL = 0; /*Index of the last query base*/
+    int16_t openI = setST->gapOpenI + setST->gapExtI;
+    int16_t extI = setST->gapExtI;
+    int16_t hTopI = 0;     /*H(0, j)*/
+    int16_t hLastTopI = 0; /*H(0, j - 1)*/
+    int32_t bestI = -32768;
+    uint8_t refUC = 0;
+    uint8_t *dirUCPtr = 0;
+    char doneBl = 0; /*Marks when lazy F can stop*/
+
+    /*Each is a column of segLenUL vectors in vectAryI*/
+    int16_t *profAryI = 0;  /*Query profile (4 columns, one per base)*/
+    int16_t *hAryI = 0;     /*H for the current column*/
+    int16_t *hLastAryI = 0; /*H for the last column*/
+    int16_t *eAryI = 0;     /*E for the next column*/
+    int16_t *eCellAryI = 0; /*E for the current column*/
+    int16_t *fCellAryI = 0; /*F for the current column*/
+    int16_t *diagAryI = 0;  /*Match/SNP scores for the current column*/
+    int16_t *swapAryI = 0;
+
+    __m128i openVect = _mm_set1_epi16(openI);
+    __m128i extVect = _mm_set1_epi16(extI);
+    __m128i minVect = _mm_set1_epi16(-32768);
+    __m128i oneVect = _mm_set1_epi16(1);
+    __m128i twoVect = _mm_set1_epi16(2);
+    __m128i delExtVect = _mm_set1_epi16(alnDelExtUC);
+    __m128i insExtVect = _mm_set1_epi16(alnInsExtUC);
+    __m128i hVect;
+    __m128i eVect;
+    __m128i fVect;
+    __m128i diagVect;
+    __m128i tmpVect;
+    __m128i dirVect;
+
+    int16_t *tmpAryI = 0;
+    uint8_t *tmpAryUC = 0;
+
+    if(needUL > alnST->lenVectUL)
+    { /*If need more memory for the vectors*/
+        tmpAryI = realloc(alnST->vectAryI, needUL * sizeof(int16_t));
+
+        if(tmpAryI == 0)
+            return 64;
+
+        alnST->vectAryI = tmpAryI;
+        alnST->lenVectUL = needUL;
+    } /*If need more memory for the vectors*/
+
+    needUL = colUL * lenRefUL;
+
+    if(needUL > alnST->lenDirUL)
+    { /*If need more memory for the directions*/
+        tmpAryUC = realloc(alnST->dirAryUC, needUL * sizeof(uint8_t));
+
+        if(tmpAryUC == 0)
+            return 64;
+
+        alnST->dirAryUC = tmpAryUC;
+        alnST->lenDirUL = needUL;
+    } /*If need more memory for the directions*/
+
+    profAryI = alnST->vectAryI;
+    hAryI = profAryI + (colUL << 2);
+    hLastAryI = hAryI + colUL;
+    eAryI = hLastAryI + colUL;
+    eCellAryI = eAryI + colUL;
+    fCellAryI = eCellAryI + colUL;
+    diagAryI = fCellAryI + colUL;
+
+    alnST->segLenUL = segLenUL;
+    alnST->lanesUL = 8;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-2: Build the query profile
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint8_t baseUC = 0; baseUC < 4; ++baseUC)
+    { /*Loop: Make a profile column for each base*/
+        for(unsigned long ulSeg = 0; ulSeg < segLenUL; ++ulSeg)
+        { /*Loop: Fill each segment*/
+            for(unsigned long ulLane = 0; ulLane < 8; ++ulLane)
+            { /*Loop: Fill each lane*/
+                qryUL = ulLane * segLenUL + ulSeg;
+                tmpAryI = profAryI + baseUC * colUL + (ulSeg << 3);
+
+                if(qryUL >= lenQryUL)
+                    tmpAryI[ulLane] = 0; /*Padding*/
+                else if(qryAryUC[qryUL] == baseUC)
+                    tmpAryI[ulLane] = setST->matchI;
+                else
+                    tmpAryI[ulLane] = -setST->snpI;
+            } /*Loop: Fill each lane*/
+        } /*Loop: Fill each segment*/
+    } /*Loop: Make a profile column for each base*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-3: Set up the first column (query vs nothing)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(unsigned long ulSeg = 0; ulSeg < segLenUL; ++ulSeg)
+    { /*Loop: Set H(i, 0) & E(i, 1) for each segment*/
+        for(unsigned long ulLane = 0; ulLane < 8; ++ulLane)
+        { /*Loop: Set each lane*/
+            qryUL = ulLane * segLenUL + ulSeg; /*Row - 1*/
+
+            if(setST->globalBl)
+                hAryI[(ulSeg << 3) + ulLane] =
+                    (int16_t) -(openI + (int16_t) qryUL * extI);
+            else
+                hAryI[(ulSeg << 3) + ulLane] = 0;
+
+            eAryI[(ulSeg << 3) + ulLane] =
+                hAryI[(ulSeg << 3) + ulLane] - openI;
+        } /*Loop: Set each lane*/
+    } /*Loop: Set H(i, 0) & E(i, 1) for each segment*/
+
+    lastUL = lenQryUL - 1;
+    lastUL = ((lastUL % segLenUL) << 3) + lastUL / segLenUL;
+    *endQryUL = lenQryUL;
+    *endRefUL = lenRefUL;
+    dirUCPtr = alnST->dirAryUC;
+    hTopI = 0;
+
+    for(unsigned long ulCol = 1; ulCol <= lenRefUL; ++ulCol)
+    { /*Loop: Score each column (reference base)*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-7 Sec-4: Score each column (main pass)
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        refUC = getTwoBitAryBase(refST, ulCol - 1);
+        tmpAryI = profAryI + refUC * colUL;
+
+        swapAryI = hLastAryI;
+        hLastAryI = hAryI;
+        hAryI = swapAryI;
+
+        hLastTopI = hTopI;
+
+        if(setST->globalBl)
+            hTopI = (int16_t) -(openI + (int16_t) (ulCol - 1) * extI);
+        else
+            hTopI = 0;
+
+        /*The first segment gets its diagonal from the last segment*/
+        diagVect =
+            _mm_loadu_si128(
+                (__m128i *) (hLastAryI + ((segLenUL - 1) << 3))
+            );
+        diagVect = _mm_slli_si128(diagVect, 2);
+        diagVect = _mm_insert_epi16(diagVect, hLastTopI, 0);
+
+        fVect = _mm_insert_epi16(minVect, hTopI - openI, 0);
+
+        for(unsigned long ulSeg = 0; ulSeg < segLenUL; ++ulSeg)
+        { /*Loop: Score each segment in the column*/
+            diagVect =
+                _mm_adds_epi16(
+                    diagVect,
+                    _mm_loadu_si128((__m128i *) (tmpAryI + (ulSeg<<3)))
+                );
+
+            eVect = _mm_loadu_si128((__m128i *) (eAryI + (ulSeg << 3)));
+
+            _mm_storeu_si128(
+                (__m128i *) (diagAryI + (ulSeg << 3)),
+                diagVect
+            );
+            _mm_storeu_si128(
+                (__m128i *) (eCellAryI + (ulSeg << 3)),
+                eVect
+            );
+            _mm_storeu_si128(
+                (__m128i *) (fCellAryI + (ulSeg << 3)),
+                fVect
+            );
+
+            hVect = _mm_max_epi16(diagVect, eVect);
+            hVect = _mm_max_epi16(hVect, fVect);
+            _mm_storeu_si128((__m128i *) (hAryI + (ulSeg << 3)), hVect);
+
+            /*E for the next column & F for the next segment*/
+            tmpVect = _mm_subs_epi16(hVect, openVect);
+            eVect =
+                _mm_max_epi16(_mm_subs_epi16(eVect, extVect), tmpVect);
+            fVect =
+                _mm_max_epi16(_mm_subs_epi16(fVect, extVect), tmpVect);
+            _mm_storeu_si128((__m128i *) (eAryI + (ulSeg << 3)), eVect);
+
+            diagVect =
+                _mm_loadu_si128((__m128i *) (hLastAryI + (ulSeg << 3)));
+        } /*Loop: Score each segment in the column*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-7 Sec-5: Carry insertions across the lanes (lazy F)
+        ^   - The main pass only carries F down a lane. Each pass here
+        ^     moves the F past the end of each lane to the next lane.
+        ^   - Stop once F <= H - open in every lane (Farrar). The F's
+        ^     after this are already right & a cell where the carried
+        ^     F is not kept can not be reached by the trace back, since
+        ^     its F is not its H & is not extended to the next row
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        doneBl = 0;
+
+        for(unsigned long ulPass = 0; ulPass < 8 && !doneBl; ++ulPass)
+        { /*Loop: Carry F to the next lane*/
+            fVect = _mm_slli_si128(fVect, 2);
+            fVect = _mm_insert_epi16(fVect, -32768, 0);
+
+            for(unsigned long ulSeg = 0; ulSeg < segLenUL; ++ulSeg)
+            { /*Loop: Raise F in each segment*/
+                hVect = _mm_loadu_si128((__m128i *)(hAryI+(ulSeg<<3)));
+                tmpVect = _mm_subs_epi16(hVect, openVect);
+
+                if(!_mm_movemask_epi8(_mm_cmpgt_epi16(fVect, tmpVect)))
+                { /*If F can no longer change the alignment*/
+                    doneBl = 1;
+                    break;
+                } /*If F can no longer change the alignment*/
+
+                tmpVect =
+                    _mm_loadu_si128(
+                        (__m128i *) (fCellAryI + (ulSeg << 3))
+                    );
+                tmpVect = _mm_max_epi16(tmpVect, fVect);
+                _mm_storeu_si128(
+                    (__m128i *) (fCellAryI + (ulSeg << 3)),
+                    tmpVect
+                );
+
+                hVect = _mm_max_epi16(hVect, tmpVect);
+                _mm_storeu_si128((__m128i *)(hAryI+(ulSeg<<3)),hVect);
+
+                eVect = _mm_loadu_si128((__m128i *)(eAryI+(ulSeg<<3)));
+                eVect =
+                    _mm_max_epi16(
+                        eVect,
+                        _mm_subs_epi16(hVect, openVect)
+                    );
+                _mm_storeu_si128((__m128i *)(eAryI+(ulSeg<<3)),eVect);
+
+                fVect = _mm_subs_epi16(fVect, extVect);
+            } /*Loop: Raise F in each segment*/
+        } /*Loop: Carry F to the next lane*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-7 Sec-6: Find each cells direction
+        ^   - Source: diagonal if H == match/SNP score, else deletion
+        ^     if H == E, else insertion (same order as alnScalar)
+        ^   - An indel is an extension if it is not the open from the
+        ^     cell before it
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        /*H(i - 1, j) for the first segment*/
+        tmpVect =
+            _mm_loadu_si128((__m128i *) (hAryI + ((segLenUL-1) << 3)));
+        tmpVect = _mm_slli_si128(tmpVect, 2);
+        tmpVect = _mm_insert_epi16(tmpVect, hTopI, 0);
+
+        for(unsigned long ulSeg = 0; ulSeg < segLenUL; ++ulSeg)
+        { /*Loop: Find the directions for each segment*/
+            hVect = _mm_loadu_si128((__m128i *) (hAryI + (ulSeg << 3)));
+            eVect =
+                _mm_loadu_si128((__m128i *) (eCellAryI + (ulSeg << 3)));
+            fVect =
+                _mm_loadu_si128((__m128i *) (fCellAryI + (ulSeg << 3)));
+            diagVect =
+                _mm_loadu_si128((__m128i *) (diagAryI + (ulSeg << 3)));
+
+            /*Source: 0 (diagonal), 1 (deletion), or 2 (insertion)*/
+            diagVect = _mm_cmpeq_epi16(hVect, diagVect);
+            dirVect = _mm_cmpeq_epi16(hVect, eVect);
+            dirVect =
+                _mm_or_si128(
+                    _mm_and_si128(dirVect, oneVect),
+                    _mm_andnot_si128(dirVect, twoVect)
+                );
+            dirVect = _mm_andnot_si128(diagVect, dirVect);
+
+            /*Insertion extension: F != H(i - 1, j) - open*/
+            tmpVect = _mm_subs_epi16(tmpVect, openVect);
+            tmpVect = _mm_cmpeq_epi16(fVect, tmpVect);
+            dirVect =
+                _mm_or_si128(
+                    dirVect,
+                    _mm_andnot_si128(tmpVect, insExtVect)
+                );
+
+            /*Deletion extension: E != H(i, j - 1) - open*/
+            tmpVect =
+                _mm_loadu_si128((__m128i *) (hLastAryI + (ulSeg << 3)));
+            tmpVect = _mm_subs_epi16(tmpVect, openVect);
+            tmpVect = _mm_cmpeq_epi16(eVect, tmpVect);
+            dirVect =
+                _mm_or_si128(
+                    dirVect,
+                    _mm_andnot_si128(tmpVect, delExtVect)
+                );
+
+            _mm_storel_epi64(
+                (__m128i *) dirUCPtr,
+                _mm_packs_epi16(dirVect, dirVect)
+            );
+            dirUCPtr += 8;
+
+            tmpVect = hVect; /*H(i - 1, j) for the next segment*/
+        } /*Loop: Find the directions for each segment*/
+
+        /*The last row (whole query aligned) can end semi-global*/
+        if(!setST->globalBl && hAryI[lastUL] > bestI)
+        { /*If this is the best end so far*/
+            bestI = hAryI[lastUL];
+            *endQryUL = lenQryUL;
+            *endRefUL = ulCol;
+        } /*If this is the best end so far*/
+    } /*Loop: Score each column (reference base)*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-7: Find the end of the alignment
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(setST->globalBl)
+        bestI = hAryI[lastUL];
+
+    else
+    { /*Else: the last column (whole reference) can also end*/
+        for(unsigned long ulRow = 1; ulRow < lenQryUL; ++ulRow)
+        { /*Loop: Check the last column*/
+            qryUL = ulRow - 1;
+            qryUL = ((qryUL % segLenUL) << 3) + qryUL / segLenUL;
+
+            if(hAryI[qryUL] > bestI)
+            { /*If this is a better end*/
+                bestI = hAryI[qryUL];
+                *endQryUL = ulRow;
+                *endRefUL = lenRefUL;
+            } /*If this is a better end*/
+        } /*Loop: Check the last column*/
+    } /*Else: the last column (whole reference) can also end*/
+
+    alnST->scoreL = bestI;
+    return 1;
+} /*alnStripedSSE2*/
+#endif
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found the alignment
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o opCStr, numOpsUL, & the start & end positions in alnST
+\---------------------------------------------------------------------*/
+uint8_t alnTraceBack(
+    char *qrySeqCStr,        /*Query text*/
+    unsigned long lenQryUL,  /*Number of bases in the query*/
+    char *refSeqCStr,        /*Reference text*/
+    unsigned long lenRefUL,  /*Number of bases in the reference*/
+    unsigned long endQryUL,  /*Row the alignment ends on*/
+    unsigned long endRefUL,  /*Column the alignment ends on*/
+    struct alnSet *setST,    /*Settings used for the alignment*/
+    struct alnStruct *alnST  /*Has the directions; gets the alignment*/
+) /*Follows the cell directions back from the best cell*/
+{ /*alnTraceBack*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: alnTraceBack
+    '   fun-8 sec-1: Variable declarations & get memory
+    '   fun-8 sec-2: Soft mask the query bases after the end
+    '   fun-8 sec-3: Follow the directions back to the first row/column
+    '   fun-8 sec-4: Handle the bases before the start & reverse
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-1: Variable declarations & get memory
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long needUL = lenQryUL + lenRefUL + 1;
+    unsigned long rowUL = endQryUL;
+    unsigned long colUL = endRefUL;
+    unsigned long segLenUL = alnST->segLenUL;
+    unsigned long lanesUL = alnST->lanesUL;
+    unsigned long numOpsUL = 0;
+    uint8_t dirUC = 0;
+    uint8_t stateUC = alnDiagUC; /*Matrix (H, E, or F) am on*/
+    char swapC = 0;
+    char *opCStr = 0;
+    char *tmpCStr = 0;
+
+    if(needUL > alnST->lenOpUL)
+    { /*If need more memory for the operations*/
+        tmpCStr = realloc(alnST->opCStr, needUL * sizeof(char));
+
+        if(tmpCStr == 0)
+            return 64;
+
+        alnST->opCStr = tmpCStr;
+        alnST->lenOpUL = needUL;
+    } /*If need more memory for the operations*/
+
+    opCStr = alnST->opCStr;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Soft mask the query bases after the end
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Operations are added backwards & reversed at the end*/
+    for(unsigned long ulBase = endQryUL; ulBase < lenQryUL; ++ulBase)
+    { /*Loop: Mask the query bases after the end*/
+        opCStr[numOpsUL] = 'S';
+        ++numOpsUL;
+    } /*Loop: Mask the query bases after the end*/
+
+    alnST->qryEndUL = endQryUL;
+    alnST->refEndUL = endRefUL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Follow the directions back to the first row/column
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(rowUL > 0 && colUL > 0)
+    { /*Loop: Trace back the alignment*/
+        dirUC =
+            alnST->dirAryUC[
+                  (colUL - 1) * segLenUL * lanesUL
+                + ((rowUL - 1) % segLenUL) * lanesUL
+                + (rowUL - 1) / segLenUL
+            ];
+
+        switch(stateUC)
+        { /*Switch: Check which matrix am on*/
+            case alnDiagUC:
+            /*Case: On H; move diagonal or change matrix*/
+                stateUC = dirUC & alnSrcMaskUC;
+
+                if(stateUC != alnDiagUC)
+                    break;
+
+                if(   (qrySeqCStr[rowUL - 1] & ~32)
+                   == (refSeqCStr[colUL - 1] & ~32)
+                ) opCStr[numOpsUL] = '=';
+
+                else
+                    opCStr[numOpsUL] = 'X';
+
+                ++numOpsUL;
+                --rowUL;
+                --colUL;
+                break;
+            /*Case: On H; move diagonal or change matrix*/
+
+            case alnDelUC:
+            /*Case: On E (deletion); move left*/
+                opCStr[numOpsUL] = 'D';
+                ++numOpsUL;
+                --colUL;
+
+                if(!(dirUC & alnDelExtUC))
+                    stateUC = alnDiagUC;
+
+                break;
+            /*Case: On E (deletion); move left*/
+
+            default:
+            /*Case: On F (insertion); move up*/
+                opCStr[numOpsUL] = 'I';
+                ++numOpsUL;
+                --rowUL;
+
+                if(!(dirUC & alnInsExtUC))
+                    stateUC = alnDiagUC;
+
+                break;
+            /*Case: On F (insertion); move up*/
+        } /*Switch: Check which matrix am on*/
+    } /*Loop: Trace back the alignment*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-4: Handle the bases before the start & reverse
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Global alignments pay for leading gaps, semi-global do not*/
+    for(unsigned long ulBase = 0; ulBase < rowUL; ++ulBase)
+    { /*Loop: Add the query bases before the start*/
+        opCStr[numOpsUL] = setST->globalBl ? 'I' : 'S';
+        ++numOpsUL;
+    } /*Loop: Add the query bases before the start*/
+
+    if(setST->globalBl)
+    { /*If global, add the reference bases before the start*/
+        for(unsigned long ulBase = 0; ulBase < colUL; ++ulBase)
+        { /*Loop: Delete the reference bases before the start*/
+            opCStr[numOpsUL] = 'D';
+            ++numOpsUL;
+        } /*Loop: Delete the reference bases before the start*/
+
+        alnST->refStartUL = 0;
+        alnST->qryStartUL = 0;
+    } /*If global, add the reference bases before the start*/
+
+    else
+    { /*Else: semi-global, the alignment starts here*/
+        alnST->refStartUL = colUL;
+        alnST->qryStartUL = rowUL;
+    } /*Else: semi-global, the alignment starts here*/
+
+    for(unsigned long ulOp = 0; ulOp < (numOpsUL >> 1); ++ulOp)
+    { /*Loop: Reverse the operations*/
+        swapC = opCStr[ulOp];
+        opCStr[ulOp] = opCStr[numOpsUL - ulOp - 1];
+        opCStr[numOpsUL - ulOp - 1] = swapC;
+    } /*Loop: Reverse the operations*/
+
+    opCStr[numOpsUL] = '\0';
+    alnST->numOpsUL = numOpsUL;
+    return 1;
+} /*alnTraceBack*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o opCStr in alnST to have ends that lower the score soft
+|          masked (I's & =/X's become S's & D's are removed)
+|        o refStartUL, refEndUL, qryStartUL, & qryEndUL in alnST
+\---------------------------------------------------------------------*/
+void alnClipEnds(
+    struct alnSet *setST,   /*Scores used for the alignment*/
+    struct alnStruct *alnST /*Alignment to clip*/
+) /*Soft masks the ends of an alignment that lower the score*/
+{ /*alnClipEnds*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: alnClipEnds
+    '   - A semi-global alignment can only skip the start of the
+    '     query or of the reference, not both. So, a read with an
+    '     adapter on a shifted reference has a low scoring start
+    '   fun-9 sec-1: Find the lowest scoring prefix & suffix
+    '   fun-9 sec-2: Mask the prefix & suffix & remove their deletions
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-1: Find the lowest scoring prefix & suffix
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *opCStr = alnST->opCStr;
+    unsigned long numOpsUL = alnST->numOpsUL;
+    unsigned long firstUL = 0;   /*First operation not masked*/
+    unsigned long lastUL = 0;    /*One past last operation not masked*/
+    unsigned long cutStartUL = 0;/*Operations to mask at the start*/
+    unsigned long cutEndUL = 0;  /*First operation to mask at the end*/
+    unsigned long outUL = 0;
+    long scoreL = 0;
+    long minL = 0;
+    char lastOpC = 0;
+    int32_t openI = setST->gapOpenI + setST->gapExtI;
+
+    while(firstUL < numOpsUL && opCStr[firstUL] == 'S')
+        ++firstUL;
+
+    lastUL = numOpsUL;
+
+    while(lastUL > firstUL && opCStr[lastUL - 1] == 'S')
+        --lastUL;
+
+    cutStartUL = firstUL;
+
+    for(unsigned long ulOp = firstUL; ulOp < lastUL; ++ulOp)
+    { /*Loop: Find the lowest scoring prefix*/
+        switch(opCStr[ulOp])
+        { /*Switch: Score the operation*/
+            case '=': scoreL += setST->matchI; break;
+            case 'X': scoreL -= setST->snpI; break;
+            default:
+                scoreL -= opCStr[ulOp] == lastOpC
+                        ? setST->gapExtI
+                        : openI;
+        } /*Switch: Score the operation*/
+
+        lastOpC = opCStr[ulOp];
+
+        if(scoreL < minL)
+        { /*If this is the lowest prefix so far*/
+            minL = scoreL;
+            cutStartUL = ulOp + 1;
+        } /*If this is the lowest prefix so far*/
+    } /*Loop: Find the lowest scoring prefix*/
+
+    scoreL = 0;
+    minL = 0;
+    lastOpC = 0;
+    cutEndUL = lastUL;
+
+    for(unsigned long ulOp = lastUL; ulOp > cutStartUL; --ulOp)
+    { /*Loop: Find the lowest scoring suffix*/
+        switch(opCStr[ulOp - 1])
+        { /*Switch: Score the operation*/
+            case '=': scoreL += setST->matchI; break;
+            case 'X': scoreL -= setST->snpI; break;
+            default:
+                scoreL -= opCStr[ulOp - 1] == lastOpC
+                        ? setST->gapExtI
+                        : openI;
+        } /*Switch: Score the operation*/
+
+        lastOpC = opCStr[ulOp - 1];
+
+        if(scoreL < minL)
+        { /*If this is the lowest suffix so far*/
+            minL = scoreL;
+            cutEndUL = ulOp - 1;
+        } /*If this is the lowest suffix so far*/
+    } /*Loop: Find the lowest scoring suffix*/
+
+    if(cutStartUL == firstUL && cutEndUL == lastUL)
+        return; /*Nothing to clip*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-2: Mask the prefix & suffix & remove their deletions
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(unsigned long ulOp = 0; ulOp < numOpsUL; ++ulOp)
+    { /*Loop: Mask the clipped operations*/
+        if(ulOp >= cutStartUL && ulOp < cutEndUL)
+        { /*If this operation is kept*/
+            opCStr[outUL] = opCStr[ulOp];
+            ++outUL;
+            continue;
+        } /*If this operation is kept*/
+
+        switch(opCStr[ulOp])
+        { /*Switch: Mask the operation*/
+            case 'S':
+                opCStr[outUL] = 'S';
+                ++outUL;
+                break;
+
+            case 'I':
+                opCStr[outUL] = 'S';
+                ++outUL;
+
+                if(ulOp < cutStartUL)
+                    ++alnST->qryStartUL;
+                else
+                    --alnST->qryEndUL;
+
+                break;
+
+            case 'D':
+                if(ulOp < cutStartUL)
+                    ++alnST->refStartUL;
+                else
+                    --alnST->refEndUL;
+
+                break;
+
+            default: /*= or X*/
+                opCStr[outUL] = 'S';
+                ++outUL;
+
+                if(ulOp < cutStartUL)
+                { /*If masking the start*/
+                    ++alnST->qryStartUL;
+                    ++alnST->refStartUL;
+                } /*If masking the start*/
+
+                else
+                { /*Else: masking the end*/
+                    --alnST->qryEndUL;
+                    --alnST->refEndUL;
+                } /*Else: masking the end*/
+        } /*Switch: Mask the operation*/
+    } /*Loop: Mask the clipped operations*/
+
+    opCStr[outUL] = '\0';
+    alnST->numOpsUL = outUL;
+    return;
+} /*alnClipEnds*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if made the cigar
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o cigarCStr, scoreL, & the match, SNP, & indel counts in alnST
+\---------------------------------------------------------------------*/
+uint8_t alnOpsToCigar(
+    struct alnSet *setST,   /*Scores used for the alignment*/
+    struct alnStruct *alnST /*Alignment to make the cigar for*/
+) /*Makes the eqx cigar & counts the matches, SNPs, & indels*/
+{ /*alnOpsToCigar*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: alnOpsToCigar
+    '   fun-10 sec-1: Get memory for the cigar
+    '   fun-10 sec-2: Count each run of operations & add it to the cigar
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-1: Get memory for the cigar
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Worst case is one entry per operation; at most 20 digits*/
+    unsigned long needUL = alnST->numOpsUL * 2 + 24;
+    unsigned long runUL = 0;
+    unsigned long cigarUL = 0;
+    char *opCStr = alnST->opCStr;
+    char *tmpCStr = 0;
+    char numCStr[24];
+    int lenNumI = 0;
+
+    if(needUL > alnST->lenCigarUL)
+    { /*If need more memory for the cigar*/
+        tmpCStr = realloc(alnST->cigarCStr, needUL * sizeof(char));
+
+        if(tmpCStr == 0)
+            return 64;
+
+        alnST->cigarCStr = tmpCStr;
+        alnST->lenCigarUL = needUL;
+    } /*If need more memory for the cigar*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-2: Count each run of operations & add it to the cigar
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    alnST->numMatchUI = 0;
+    alnST->numSnpUI = 0;
+    alnST->numInsUI = 0;
+    alnST->numDelUI = 0;
+    alnST->scoreL = 0;
+
+    for(unsigned long ulOp = 0; ulOp < alnST->numOpsUL; ulOp += runUL)
+    { /*Loop: Add each run of operations*/
+        runUL = 1;
+
+        while(opCStr[ulOp + runUL] == opCStr[ulOp])
+            ++runUL;
+
+        switch(opCStr[ulOp])
+        { /*Switch: Count & score the run*/
+            case '=':
+                alnST->numMatchUI += runUL;
+                alnST->scoreL += (long) runUL * setST->matchI;
+                break;
+
+            case 'X':
+                alnST->numSnpUI += runUL;
+                alnST->scoreL -= (long) runUL * setST->snpI;
+                break;
+
+            case 'I':
+                alnST->numInsUI += runUL;
+                alnST->scoreL -=
+                    setST->gapOpenI + (long) runUL * setST->gapExtI;
+                break;
+
+            case 'D':
+                alnST->numDelUI += runUL;
+                alnST->scoreL -=
+                    setST->gapOpenI + (long) runUL * setST->gapExtI;
+                break;
+        } /*Switch: Count & score the run*/
+
+        lenNumI = sprintf(numCStr, "%lu", runUL);
+
+        if(cigarUL + lenNumI + 2 > alnST->lenCigarUL)
+        { /*If need more memory (only for very long runs)*/
+            needUL = alnST->lenCigarUL * 2 + lenNumI + 2;
+            tmpCStr = realloc(alnST->cigarCStr, needUL * sizeof(char));
+
+            if(tmpCStr == 0)
+                return 64;
+
+            alnST->cigarCStr = tmpCStr;
+            alnST->lenCigarUL = needUL;
+        } /*If need more memory (only for very long runs)*/
+
+        memcpy(alnST->cigarCStr + cigarUL, numCStr, lenNumI);
+        cigarUL += lenNumI;
+        alnST->cigarCStr[cigarUL] = opCStr[ulOp];
+        ++cigarUL;
+    } /*Loop: Add each run of operations*/
+
+    alnST->cigarCStr[cigarUL] = '\0';
+    return 1;
+} /*alnOpsToCigar*/
@@ -0,0 +1,283 @@
+/*######################################################################
+# Name: alignmentsFun
+# Use:
+#   o Holds a pairwise aligner with affine gap penalties. It does a
+#     global or a semi-global (end gaps are free) alignment of a query
+#     to a reference & outputs an eqx cigar (=, X, I, D, S).
+#   o The scores are found with a striped (Farrar) SSE2 kernel, eight
+#     16 bit cells at a time, when the CPU has SSE2 & the scores fit
+#     in 16 bits. A scalar kernel is used otherwise or when compiled
+#     with -DNOSIMD. Both keep a direction byte for each cell, so they
+#     share the trace back & give the same alignment.
+#   o This is used in place of minimap2 when comparing a read to the
+#     best read or a consensus to another consensus. These are short
+#     (a few hundred bases to a few kb), so launching minimap2 costs
+#     more than the alignment.
+# Includes:
+#   - "twoBitArrays.h"
+#   - "defaultSettings.h"
+# C standard libraries:
+#   - <emmintrin.h> (SSE2)
+#   - <string.h>
+#   - <stdio.h>
+#   o <stdlib.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef ALIGNMENTSFUN_H
+#define ALIGNMENTSFUN_H
+
+#include <string.h>
+#include <stdio.h>
+#include "twoBitArrays.h"    /*Packed sequences the aligner uses*/
+#include "defaultSettings.h" /*Default alignment scores*/
+
+/*Pick the vector kernel this compiler & CPU can use*/
+#ifndef NOSIMD
+    #if defined(__GNUC__) && defined(__SSE2__)
+        #include <emmintrin.h>
+        #define alnSSE2Bl 1 /*x86 always has SSE2 on 64 bit*/
+    #endif
+#endif
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' alignmentsFun SOH: Start Of Header
+'   o st-1 alnSet:
+'     - Scores & settings for an alignment
+'   o st-2 alnStruct:
+'     - Buffers for the aligner & the alignment it found
+'   o fun-1 initAlnSet:
+'     - Sets an alnSet to the default settings
+'   o fun-2 initAlnStruct:
+'     - Sets all variables in an alnStruct to defaults (no buffers)
+'   o fun-3 freeAlnStruct:
+'     - Frees the buffers in an alnStruct
+'   o fun-4 alignTwoBit:
+'     - Aligns a query to a reference & makes the eqx cigar
+'   o fun-5 alnFitsInt16:
+'     - Checks if every score in an alignment fits in 16 bits
+'   o fun-6 alnScalar:
+'     - Scalar kernel; scores all cells & keeps their directions
+'   o fun-7 alnStripedSSE2:
+'     - Striped SSE2 kernel; scores all cells & keeps their directions
+'   o fun-8 alnTraceBack:
+'     - Follows the cell directions back from the best cell
+'   o fun-9 alnClipEnds:
+'     - Soft masks the ends of an alignment that lower the score
+'   o fun-10 alnOpsToCigar:
+'     - Makes the eqx cigar & counts the matches, SNPs, & indels
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*Direction bits kept for each cell*/
+#define alnDiagUC 0     /*Best score came from a match or SNP*/
+#define alnDelUC 1      /*Best score came from a deletion (E)*/
+#define alnInsUC 2      /*Best score came from an insertion (F)*/
+#define alnSrcMaskUC 3  /*Bits holding where the best score came from*/
+#define alnDelExtUC 4   /*The deletion extended a deletion*/
+#define alnInsExtUC 8   /*The insertion extended an insertion*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: alnSet
+| Use:
+|   - Holds the scores & settings for an alignment. A gap of n bases
+|     costs gapOpenI + n * gapExtI (same as minimap2)
+\---------------------------------------------------------------------*/
+typedef struct alnSet
+{ /*alnSet*/
+    int16_t matchI;    /*Score for a match*/
+    int16_t snpI;      /*Penalty for a mismatch*/
+    int16_t gapOpenI;  /*Penalty for opening a gap*/
+    int16_t gapExtI;   /*Penalty for each base in a gap*/
+    char globalBl;     /*1: Global, 0: semi-global (free end gaps)*/
+    char clipEndsBl;   /*1: Soft mask ends that lower the score
+                         (semi-global only)*/
+    unsigned long maxCellsUL; /*Most cells (query * ref) to align*/
+}alnSet;
+
+/*---------------------------------------------------------------------\
+| Struct-2: alnStruct
+| Use:
+|   - Holds the buffers the aligner reuses & the last alignment found.
+|     Positions are index 0 & the ends are one past the last base
+\---------------------------------------------------------------------*/
+typedef struct alnStruct
+{ /*alnStruct*/
+    /*Buffers*/
+    int16_t *vectAryI;       /*Striped profile & score columns*/
+    unsigned long lenVectUL; /*Number of int16_t's vectAryI holds*/
+    int32_t *scalarAryI;     /*Scalar score columns*/
+    unsigned long lenScalarUL;/*Number of int32_t's scalarAryI has*/
+    uint8_t *codeAryUC;      /*Query bases as two bit codes*/
+    unsigned long lenCodeUL; /*Size of codeAryUC*/
+    uint8_t *dirAryUC;       /*Direction byte for each cell*/
+    unsigned long lenDirUL;  /*Size of dirAryUC*/
+    char *opCStr;            /*One operation per base (forward)*/
+    unsigned long lenOpUL;   /*Size of opCStr*/
+    char *cigarCStr;         /*eqx cigar for the alignment*/
+    unsigned long lenCigarUL;/*Size of cigarCStr*/
+
+    /*Layout of dirAryUC (segments * lanes rows for each column)*/
+    unsigned long segLenUL;  /*Vectors in a column*/
+    unsigned long lanesUL;   /*Cells in a vector*/
+
+    /*Alignment*/
+    long scoreL;             /*Score of the alignment*/
+    unsigned long refStartUL;/*First reference base aligned*/
+    unsigned long refEndUL;  /*One past the last reference base*/
+    unsigned long qryStartUL;/*First query base aligned (not masked)*/
+    unsigned long qryEndUL;  /*One past the last query base aligned*/
+    unsigned long numOpsUL;  /*Number of operations in opCStr*/
+    uint32_t numMatchUI;     /*Number of matches*/
+    uint32_t numSnpUI;       /*Number of mismatches*/
+    uint32_t numInsUI;       /*Number of inserted bases*/
+    uint32_t numDelUI;       /*Number of deleted bases*/
+}alnStruct;
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o setST to have the default scores & settings
+\---------------------------------------------------------------------*/
+void initAlnSet(
+    struct alnSet *setST /*Settings to initialize*/
+); /*Sets an alnSet to the default settings*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o All variables in alnST to be 0 (does not free)
+\---------------------------------------------------------------------*/
+void initAlnStruct(
+    struct alnStruct *alnST /*Structure to initialize*/
+); /*Sets all variables in an alnStruct to defaults (no buffers)*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Frees: All buffers in alnST & then initializes alnST
+\---------------------------------------------------------------------*/
+void freeAlnStruct(
+    struct alnStruct *alnST /*Structure to free*/
+); /*Frees the buffers in an alnStruct*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if aligned the query
+|        o 2 if the query or reference has no bases
+|        o 4 if the alignment has more than setST->maxCellsUL cells
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o alnST to have the alignment, its score, & its eqx cigar
+\---------------------------------------------------------------------*/
+uint8_t alignTwoBit(
+    struct twoBitAry *qryST, /*Packed query*/
+    char *qrySeqCStr,        /*Query text (for the =/X cigar entries)*/
+    struct twoBitAry *refST, /*Packed reference*/
+    char *refSeqCStr,        /*Reference text (for the =/X entries)*/
+    struct alnSet *setST,    /*Scores & settings to align with*/
+    struct alnStruct *alnST  /*Buffers & gets the alignment*/
+); /*Aligns a query to a reference & makes the eqx cigar*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if every score is between -32000 & 32000 (SSE2 is ok)
+|        o 0 if a score could overflow a 16 bit integer
+\---------------------------------------------------------------------*/
+uint8_t alnFitsInt16(
+    unsigned long lenQryUL, /*Number of bases in the query*/
+    unsigned long lenRefUL, /*Number of bases in the reference*/
+    struct alnSet *setST    /*Scores to align with*/
+); /*Checks if every score in an alignment fits in 16 bits*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if scored the alignment
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o dirAryUC, segLenUL (query length), & lanesUL (1) in alnST
+|        o endQryUL & endRefUL to have the cell the alignment ends at
+|          (row & column, so index 1)
+|        o alnST->scoreL to have the score of that cell
+\---------------------------------------------------------------------*/
+uint8_t alnScalar(
+    uint8_t *qryAryUC,       /*Query as one byte two bit codes*/
+    unsigned long lenQryUL,  /*Number of bases in the query*/
+    struct twoBitAry *refST, /*Packed reference*/
+    struct alnSet *setST,    /*Scores & settings to align with*/
+    struct alnStruct *alnST, /*Buffers & gets the directions*/
+    unsigned long *endQryUL, /*Gets the row the alignment ends on*/
+    unsigned long *endRefUL  /*Gets the column the alignment ends on*/
+); /*Scalar kernel; scores all cells & keeps their directions*/
+
+#ifdef alnSSE2Bl
+    /*-----------------------------------------------------------------\
+    | Output:
+    |    - Returns:
+    |        o 1 if scored the alignment
+    |        o 64 for memory allocation errors
+    |    - Modifies:
+    |        o dirAryUC, segLenUL, & lanesUL (8) in alnST. The cells in
+    |          each column are striped (Farrar), so query base i is in
+    |          segment i % segLenUL & lane i / segLenUL
+    |        o endQryUL, endRefUL, & alnST->scoreL (see alnScalar)
+    | Note:
+    |    - Only call when alnFitsInt16 is true for the alignment
+    \-----------------------------------------------------------------*/
+    uint8_t alnStripedSSE2(
+        uint8_t *qryAryUC,       /*Query as one byte two bit codes*/
+        unsigned long lenQryUL,  /*Number of bases in the query*/
+        struct twoBitAry *refST, /*Packed reference*/
+        struct alnSet *setST,    /*Scores & settings to align with*/
+        struct alnStruct *alnST, /*Buffers & gets the directions*/
+        unsigned long *endQryUL, /*Gets the row the alignment ends*/
+        unsigned long *endRefUL  /*Gets the column alignment ends*/
+    ); /*Striped SSE2 kernel; scores all cells & keeps directions*/
+#endif
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found the alignment
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o opCStr, numOpsUL, & the start & end positions in alnST
+\---------------------------------------------------------------------*/
+uint8_t alnTraceBack(
+    char *qrySeqCStr,        /*Query text*/
+    unsigned long lenQryUL,  /*Number of bases in the query*/
+    char *refSeqCStr,        /*Reference text*/
+    unsigned long lenRefUL,  /*Number of bases in the reference*/
+    unsigned long endQryUL,  /*Row the alignment ends on*/
+    unsigned long endRefUL,  /*Column the alignment ends on*/
+    struct alnSet *setST,    /*Settings used for the alignment*/
+    struct alnStruct *alnST  /*Has the directions; gets the alignment*/
+); /*Follows the cell directions back from the best cell*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o opCStr in alnST to have ends that lower the score soft
+|          masked (I's & =/X's become S's & D's are removed)
+|        o refStartUL, refEndUL, qryStartUL, & qryEndUL in alnST
+\---------------------------------------------------------------------*/
+void alnClipEnds(
+    struct alnSet *setST,   /*Scores used for the alignment*/
+    struct alnStruct *alnST /*Alignment to clip*/
+); /*Soft masks the ends of an alignment that lower the score*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if made the cigar
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o cigarCStr, scoreL, & the match, SNP, & indel counts in alnST
+\---------------------------------------------------------------------*/
+uint8_t alnOpsToCigar(
+    struct alnSet *setST,   /*Scores used for the alignment*/
+    struct alnStruct *alnST /*Alignment to make the cigar for*/
+); /*Makes the eqx cigar & counts the matches, SNPs, & indels*/
+
+#endif
@@ -0,0 +1,449 @@
+/*######################################################################
+# Name: benchQScores.c
+# Use:
+#    - Checks that the Q-score run kernels in FCIStatsFun (scalar,
+#      SSE2, AVX2, & NEON) give the same counts & histograms as the
+#      per base loop checkMatches & checkSNPs used before them. Then
+#      times the per base loop against qRunStats (what checkMatches &
+#      checkSNPs now call).
+# Input:
+#    -rounds:
+#        - Number of times to time each run length           [20000]
+#    -seed:
+#        - Seed for the random Q-scores                      [1026]
+# Output:
+#    - stdout: kernel check & the nano seconds per base for each
+#      run length
+#    - Returns 1 if a kernel did not match the per base loop
+# Includes:
+#    - "FCIStatsFun.h"
+#    o "samEntryStruct.h"
+# C standard libraries:
+#   - <time.h>
+#   o <stdlib.h>
+#   o <string.h>
+#   o <stdint.h>
+#   o <stdio.h>
+######################################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOP:
+'   main Main function to glue everything together
+'   fun-1 benchQRand: Gets the next random number
+'   fun-2 oldRunKeep: The per base loop from checkMatches/checkSNPs
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <time.h>
+#include "FCIStatsFun.h"
+
+#define benchQBuffLen 4096 /*Q-scores made for each test*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: the next number in the sequence
+|    - Modifies: stateULng to the next state
+\---------------------------------------------------------------------*/
+uint64_t benchQRand(
+    uint64_t *stateULng  /*State of the random number generator*/
+); /*Gets the next random number*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: Number of bases kept
+|    - Modifies: qHistAryUI & totalQUL to have the Q-scores added
+\---------------------------------------------------------------------*/
+uint32_t oldRunKeep(
+    char *qCStr,          /*Read Q-scores*/
+    char *refQCStr,       /*Reference Q-scores (0 for no reference)*/
+    uint32_t lenUI,       /*Number of bases in the run*/
+    uint8_t minQUC,       /*Min Q-score to keep a base*/
+    char snpBl,           /*1: SNP check; 0: match check*/
+    uint32_t *qHistAryUI, /*Histogram to add the Q-scores to*/
+    unsigned long *totalQUL /*Sum of the Q-scores*/
+); /*The per base loop from checkMatches/checkSNPs*/
+
+int main(int lenArgsInt, char *argsPtrCStr[])
+{ /*main function*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Main TOC: main
+    '    main sec-1: Variable declarations
+    '    main sec-2: Read in user input & make the Q-scores
+    '    main sec-3: Check the kernels against the per base loop
+    '    main sec-4: Time the per base loop & the kernels
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-1: Variable declarations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long roundsUL = 20000;
+    unsigned long seedUL = 1026;
+    uint64_t stateULng = 0;
+
+    char qCStr[benchQBuffLen];
+    char refQCStr[benchQBuffLen];
+    uint32_t lenAryUI[] = {4, 16, 48, 256, 1024, 4096};
+    uint8_t numLensUC = sizeof(lenAryUI) / sizeof(uint32_t);
+
+    uint32_t oldHistAryUI[MAX_Q_SCORE];
+    uint32_t newHistAryUI[MAX_Q_SCORE];
+    uint32_t statsHistAryUI[MAX_Q_SCORE];
+    unsigned long statsTotalUL = 0;
+    uint32_t statsCntUI = 0;
+    unsigned long oldTotalUL = 0;
+    unsigned long newTotalUL = 0;
+    uint32_t oldCntUI = 0;
+    uint32_t newCntUI = 0;
+    uint32_t kernCntUI = 0;
+    uint32_t lenUI = 0;
+    uint32_t startUI = 0;
+    unsigned long numErrUL = 0;
+    unsigned long numChecksUL = 0;
+    volatile uint32_t sinkUI = 0; /*Keeps the timed loops*/
+
+    int32_t refMinQI = 0;
+    int32_t refMaxQI = 0;
+    char *useRefCStr = 0;
+    clock_t startClock = 0;
+    double oldSecDbl = 0;
+    double newSecDbl = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-2: Read in user input & make the Q-scores
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(int intArg = 1; intArg + 1 < lenArgsInt; intArg += 2)
+    { /*Loop: Read in the user input*/
+        if(strcmp(argsPtrCStr[intArg], "-rounds") == 0)
+            roundsUL = strtoul(argsPtrCStr[intArg + 1], 0, 10);
+
+        else if(strcmp(argsPtrCStr[intArg], "-seed") == 0)
+            seedUL = strtoul(argsPtrCStr[intArg + 1], 0, 10);
+
+        else
+        { /*Else is an invalid parameter*/
+            fprintf(
+                stderr,
+                "%s is not valid (-rounds 20000 -seed 1026)\n",
+                argsPtrCStr[intArg]
+            );
+
+            exit(1);
+        } /*Else is an invalid parameter*/
+    } /*Loop: Read in the user input*/
+
+    stateULng = seedUL | 1; /*xorshift can not have a 0 state*/
+
+    for(uint32_t uiBase = 0; uiBase < benchQBuffLen; ++uiBase)
+    { /*Loop: Make nanopore like Q-scores (most are 5 to 30)*/
+        qCStr[uiBase] = Q_ADJUST + benchQRand(&stateULng) % 94;
+
+        if(benchQRand(&stateULng) % 4)
+            qCStr[uiBase] = Q_ADJUST + 5 + benchQRand(&stateULng) % 26;
+
+        refQCStr[uiBase] = Q_ADJUST + benchQRand(&stateULng) % 94;
+    } /*Loop: Make nanopore like Q-scores (most are 5 to 30)*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-3: Check the kernels against the per base loop
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t minQUI = 0; minQUI < 256; ++minQUI)
+    { /*Loop: Check every min Q-score*/
+      for(uint8_t modeUC = 0; modeUC < 4; ++modeUC)
+      { /*Loop: Check match & SNP modes with & without a reference*/
+        useRefCStr = (modeUC & 2) ? refQCStr : 0;
+
+        if(modeUC & 1)
+        { /*If checking SNPs*/
+            refMinQI = -256;
+            refMaxQI = (int32_t) minQUI - 1;
+        } /*If checking SNPs*/
+
+        else
+        { /*Else checking matches*/
+            refMinQI = (int32_t) minQUI + 1;
+            refMaxQI = 256;
+        } /*Else checking matches*/
+
+        if(minQUI & 1)
+            lenUI = minQUI % 16;      /*Short runs (inline paths)*/
+        else
+            lenUI = (minQUI * 37) % 700; /*Odd lengths check ends*/
+        startUI = (minQUI * 13) % 64; /*Unaligned starts*/
+
+        for(uint8_t uCQ = 0; uCQ < MAX_Q_SCORE; ++uCQ)
+        { /*Loop: Blank the histograms*/
+            oldHistAryUI[uCQ] = 0;
+            newHistAryUI[uCQ] = 0;
+        } /*Loop: Blank the histograms*/
+
+        oldTotalUL = 0;
+
+        oldCntUI =
+            oldRunKeep(
+                qCStr + startUI,
+                useRefCStr == 0 ? 0 : useRefCStr + startUI,
+                lenUI,
+                (uint8_t) minQUI,
+                modeUC & 1,
+                oldHistAryUI,
+                &oldTotalUL
+            );
+
+        newTotalUL = qRunHist(qCStr + startUI, lenUI, newHistAryUI);
+
+        newCntUI =
+            qRunCntKeep(
+                qCStr + startUI,
+                useRefCStr == 0 ? 0 : useRefCStr + startUI,
+                lenUI,
+                (uint8_t) minQUI,
+                refMinQI,
+                refMaxQI
+            );
+
+        for(uint8_t uCQ = 0; uCQ < MAX_Q_SCORE; ++uCQ)
+            statsHistAryUI[uCQ] = 0;
+
+        statsTotalUL =
+            qRunStats(
+                qCStr + startUI,
+                useRefCStr == 0 ? 0 : useRefCStr + startUI,
+                lenUI,
+                (uint8_t) minQUI,
+                refMinQI,
+                refMaxQI,
+                statsHistAryUI,
+                &statsCntUI
+            );
+
+        ++numChecksUL;
+
+        if(
+              oldCntUI != newCntUI
+           || oldCntUI != statsCntUI
+           || oldTotalUL != newTotalUL
+           || oldTotalUL != statsTotalUL
+           || memcmp(oldHistAryUI, newHistAryUI, sizeof(oldHistAryUI))
+           || memcmp(oldHistAryUI, statsHistAryUI, sizeof(oldHistAryUI))
+        ) { /*If the kernels did not match the per base loop*/
+            fprintf(
+                stderr,
+                "Mismatch: min Q %u mode %u: %u vs %u bases\n",
+                minQUI,
+                modeUC,
+                oldCntUI,
+                newCntUI
+            );
+
+            ++numErrUL;
+        } /*If the kernels did not match the per base loop*/
+
+        /*Check each kernel directly (qRunCntKeep uses the best one)*/
+        if(minQUI + Q_ADJUST + 1 > 255 || modeUC & 1)
+            continue; /*Thresholds only the dispatcher handles*/
+
+        kernCntUI =
+            qRunCntKeepScalar(
+                qCStr + startUI,
+                useRefCStr == 0 ? 0 : useRefCStr + startUI,
+                lenUI,
+                minQUI + Q_ADJUST + 1,
+                refMinQI + Q_ADJUST + 1 > 255 ? 255 : refMinQI+Q_ADJUST+1,
+                255
+            );
+
+        numErrUL += (kernCntUI != oldCntUI && refMinQI + Q_ADJUST < 255);
+
+        #ifdef qSSE2Bl
+            numErrUL +=
+                kernCntUI !=
+                qRunCntKeepSSE2(
+                    qCStr + startUI,
+                    useRefCStr == 0 ? 0 : useRefCStr + startUI,
+                    lenUI,
+                    minQUI + Q_ADJUST + 1,
+                    refMinQI+Q_ADJUST+1 > 255 ? 255 : refMinQI+Q_ADJUST+1,
+                    255
+                );
+        #endif
+
+        #ifdef qAVX2Bl
+            if(__builtin_cpu_supports("avx2"))
+                numErrUL +=
+                    kernCntUI !=
+                    qRunCntKeepAVX2(
+                        qCStr + startUI,
+                        useRefCStr == 0 ? 0 : useRefCStr + startUI,
+                        lenUI,
+                        minQUI + Q_ADJUST + 1,
+                        refMinQI + Q_ADJUST + 1 > 255 ?
+                            255 : refMinQI + Q_ADJUST + 1,
+                        255
+                    );
+        #endif
+
+        #ifdef qNEONBl
+            numErrUL +=
+                kernCntUI !=
+                qRunCntKeepNEON(
+                    qCStr + startUI,
+                    useRefCStr == 0 ? 0 : useRefCStr + startUI,
+                    lenUI,
+                    minQUI + Q_ADJUST + 1,
+                    refMinQI+Q_ADJUST+1 > 255 ? 255 : refMinQI+Q_ADJUST+1,
+                    255
+                );
+        #endif
+      } /*Loop: Check match & SNP modes with & without a reference*/
+    } /*Loop: Check every min Q-score*/
+
+    printf("Kernel:");
+
+    #ifdef qAVX2Bl
+        if(__builtin_cpu_supports("avx2"))
+            printf(" AVX2");
+    #endif
+    #ifdef qSSE2Bl
+        printf(" SSE2");
+    #endif
+    #ifdef qNEONBl
+        printf(" NEON");
+    #endif
+
+    printf(
+        " scalar\nChecks: %lu; mismatches: %lu\n\n",
+        numChecksUL,
+        numErrUL
+    );
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-4: Time the per base loop & the kernels
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    printf("run-length\tloop-ns-per-base\tkernel-ns-per-base\n");
+
+    for(uint8_t uCLen = 0; uCLen < numLensUC; ++uCLen)
+    { /*Loop: Time each run length*/
+        lenUI = lenAryUI[uCLen];
+
+        startClock = clock();
+
+        for(unsigned long ulRnd = 0; ulRnd < roundsUL; ++ulRnd)
+        { /*Loop: Time the per base loop*/
+            startUI = ulRnd % (benchQBuffLen - lenUI + 1);
+
+            sinkUI +=
+                oldRunKeep(
+                    qCStr + startUI,
+                    refQCStr + startUI,
+                    lenUI,
+                    10,
+                    0,
+                    oldHistAryUI,
+                    &oldTotalUL
+                );
+        } /*Loop: Time the per base loop*/
+
+        oldSecDbl = (double) (clock() - startClock) / CLOCKS_PER_SEC;
+        startClock = clock();
+
+        for(unsigned long ulRnd = 0; ulRnd < roundsUL; ++ulRnd)
+        { /*Loop: Time the kernels*/
+            startUI = ulRnd % (benchQBuffLen - lenUI + 1);
+
+            newTotalUL +=
+                qRunStats(
+                    qCStr + startUI,
+                    refQCStr + startUI,
+                    lenUI,
+                    10,
+                    11,
+                    256,
+                    newHistAryUI,
+                    &newCntUI
+                );
+
+            sinkUI += newCntUI;
+        } /*Loop: Time the kernels*/
+
+        newSecDbl = (double) (clock() - startClock) / CLOCKS_PER_SEC;
+
+        printf(
+            "%u\t%.3f\t%.3f\n",
+            lenUI,
+            oldSecDbl * 1e9 / ((double) roundsUL * lenUI),
+            newSecDbl * 1e9 / ((double) roundsUL * lenUI)
+        );
+    } /*Loop: Time each run length*/
+
+    if(numErrUL > 0)
+        exit(1);
+
+    exit(0);
+} /*main function*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: the next number in the sequence
+|    - Modifies: stateULng to the next state
+\---------------------------------------------------------------------*/
+uint64_t benchQRand(
+    uint64_t *stateULng  /*State of the random number generator*/
+) /*Gets the next random number*/
+{ /*benchQRand*/
+    *stateULng ^= *stateULng >> 12;
+    *stateULng ^= *stateULng << 25;
+    *stateULng ^= *stateULng >> 27;
+    return *stateULng * 0x2545F4914F6CDD1DULL;
+} /*benchQRand*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: Number of bases kept
+|    - Modifies: qHistAryUI & totalQUL to have the Q-scores added
+| Note:
+|    - This is the loop checkMatches & checkSNPs had before the
+|      kernels, with a Q-score entry & the reference always used
+\---------------------------------------------------------------------*/
+uint32_t oldRunKeep(
+    char *qCStr,          /*Read Q-scores*/
+    char *refQCStr,       /*Reference Q-scores (0 for no reference)*/
+    uint32_t lenUI,       /*Number of bases in the run*/
+    uint8_t minQUC,       /*Min Q-score to keep a base*/
+    char snpBl,           /*1: SNP check; 0: match check*/
+    uint32_t *qHistAryUI, /*Histogram to add the Q-scores to*/
+    unsigned long *totalQUL /*Sum of the Q-scores*/
+) /*The per base loop from checkMatches/checkSNPs*/
+{ /*oldRunKeep*/
+    uint32_t cntUI = 0;
+    uint8_t keepBool = 0;
+    int32_t tmpQInt = 0;
+    int32_t refQInt = 0;
+
+    for(uint32_t uIntBase = 0; uIntBase < lenUI; ++uIntBase)
+    { /*Loop through all bases*/
+        tmpQInt = qCStr[uIntBase] - Q_ADJUST;
+        keepBool = ((uint32_t)(minQUC - tmpQInt) >> 31);
+
+        if(refQCStr != 0 && snpBl)
+        { /*If checking a SNP*/
+            refQInt = (refQCStr[uIntBase] - Q_ADJUST + 1);
+            keepBool &= ((uint32_t) (refQInt - minQUC) >> 31);
+        } /*If checking a SNP*/
+
+        else if(refQCStr != 0)
+        { /*Else if checking a match*/
+            refQInt = (refQCStr[uIntBase] - Q_ADJUST - 1);
+            keepBool &= ((uint32_t) (minQUC - refQInt) >> 31);
+        } /*Else if checking a match*/
+
+        cntUI += keepBool;
+        ++(qHistAryUI[tmpQInt]);
+        *totalQUL += tmpQInt;
+    } /*Loop through all bases*/
+
+    return cntUI;
+} /*oldRunKeep*/
@@ -0,0 +1,692 @@
+/*######################################################################
+# Name: benchSimReads.c
+# Use:
+#    - Makes a deterministic set of synthetic amplicon reads from a
+#      fasta file of references (such as the reference pairs in
+#      dataAnalysis). The same seed always gives the same reads, so
+#      findCoInft runs on different commits can be compared (make
+#      bench).
+# Input:
+#    -ref:
+#        - Fasta with the references to simulate reads for [Required]
+#        - The number of reads for each reference is set by the
+#          depth=number in its header (even split if no depth=)
+#    -num-reads:
+#        - Number of reads to simulate                      [2000]
+#    -seed:
+#        - Seed for the random number generator             [1026]
+#    -error:
+#        - Chance a base has an error (substitution,        [0.05]
+#          insertion, or deletion)
+#    -flank:
+#        - Number of random bases before & after the         [30]
+#          amplicon (adapter/barcode)
+#    -primers:
+#        - File to save primers for the first reference     [None]
+#          to (first & last -primer-len bases)
+#    -primer-len:
+#        - Length of each primer in -primers                 [20]
+#    -out:
+#        - File to save the reads to                     [stdout]
+# Output:
+#    - Fastq file with the reads. The header of each read has the
+#      reference it was made from (ref=name).
+# Includes:
+#    - "defaultSettings.h"
+# C standard libraries:
+#   - <stdlib.h>
+#   - <string.h>
+#   - <stdint.h>
+#   - <stdio.h>
+######################################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOP:
+'   main Main function to glue everything together
+'   fun-1 checkInput: Checks the user input
+'   fun-2 simRandUL: Gets the next random number
+'   fun-3 readSimRefs: Reads in the references & their depths
+'   fun-4 compBase: Complements a base
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "defaultSettings.h" /*For version number*/
+
+#define maxSimRefs 64 /*Max references in -ref*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies: Each input variable to hold user input
+|    - Returns:
+|        o 0 if no input was given
+|        o The parameter that was invalid
+|        o 1 (cast to char *) if all input was valid
+\---------------------------------------------------------------------*/
+char * checkInput(
+    int lenArgsInt,          /*Number arguments user input*/
+    char *argsCStr[],        /*Array with user arguments*/
+    char **refPathCStr,      /*Fasta file with references*/
+    char **outPathCStr,      /*File to save reads to*/
+    char **primPathCStr,     /*File to save primers to*/
+    unsigned long *numReadsUL, /*Number of reads to simulate*/
+    unsigned long *seedUL,     /*Seed for the random numbers*/
+    double *errDbl,            /*Error rate of each base*/
+    unsigned long *flankUL,    /*Random bases around the amplicon*/
+    unsigned long *primLenUL   /*Length of the primers*/
+); /*Checks & extracts user input*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: the next number in the sequence
+|    - Modifies: stateULng to the next state
+| Note:
+|    - Is xorshift64*, so the reads do not depend on the C library
+\---------------------------------------------------------------------*/
+uint64_t simRandUL(
+    uint64_t *stateULng  /*State of the random number generator*/
+); /*Gets the next random number*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of references read in
+|        o 0 if could not open the file, no references, or memory error
+|    - Modifies:
+|        o refAryCStr to have each reference sequence (upper case)
+|        o nameAryCStr to have each reference name
+|        o lenRefAryUL & depthAryUL to have the lengths & depths
+\---------------------------------------------------------------------*/
+unsigned long readSimRefs(
+    char *refPathCStr,        /*Fasta file with the references*/
+    char *refAryCStr[],       /*Gets the sequences (maxSimRefs)*/
+    char nameAryCStr[][128],  /*Gets the names (maxSimRefs)*/
+    unsigned long *lenRefAryUL, /*Gets the sequence lengths*/
+    unsigned long *depthAryUL   /*Gets the depth= from each header*/
+); /*Reads in the references & their depths*/
+
+/*---------------------------------------------------------------------\
+| Output: Returns: the complement of baseC (N for non-ATGC)
+\---------------------------------------------------------------------*/
+char compBase(
+    char baseC
+); /*Complements a base*/
+
+int main(int lenArgsInt, char *argsPtrCStr[])
+{ /*main function*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Main TOC: main
+    '    main sec-1: Variable declarations
+    '    main sec-2: Read in and check user input
+    '    main sec-3: Read in the references & print the primers
+    '    main sec-4: Simulate the reads
+    '    main sec-5: Clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-1: Variable declarations
+    ^    main sec-1 sub-1: normal variable declerations
+    ^    main sec-1 sub-2: help message
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Main Sec-1 Sub-1: normal variable declerations
+    \******************************************************************/
+
+    char *refPathCStr = 0;     /*References to simulate reads for*/
+    char *outPathCStr = 0;     /*File to print reads to*/
+    char *primPathCStr = 0;    /*File to print primers to*/
+    char *inputErrCStr = 0;    /*Invalid parameter from checkInput*/
+    unsigned long numReadsUL = 2000;
+    unsigned long seedUL = 1026;
+    unsigned long flankUL = 30;
+    unsigned long primLenUL = 20;
+    double errDbl = 0.05;
+    uint64_t errCutULng = 0;   /*errDbl scaled to a random number*/
+
+    char *refAryCStr[maxSimRefs];
+    char nameAryCStr[maxSimRefs][128];
+    unsigned long lenRefAryUL[maxSimRefs];
+    unsigned long depthAryUL[maxSimRefs];
+    unsigned long numRefsUL = 0;
+    unsigned long totalDepthUL = 0;
+    unsigned long maxLenUL = 0;
+
+    char *seqCStr = 0;         /*Sequence of the read being made*/
+    char *qCStr = 0;           /*Q-score entry of the read being made*/
+    unsigned long lenSeqUL = 0;
+    unsigned long refUL = 0;
+    unsigned long posUL = 0;
+    uint64_t stateULng = 0;    /*State of the random number generator*/
+    uint64_t randULng = 0;
+    char tmpC = 0;
+
+    FILE *outFILE = stdout;
+    FILE *primFILE = 0;
+
+    /******************************************************************\
+    * Main Sec-1 Sub-2: help message
+    \******************************************************************/
+
+    char
+        *helpMesgCStr = "\
+            \n Command: benchSimReads -ref refs.fasta [options ...]\
+            \n Use:\
+            \n    - Makes deterministic synthetic amplicon reads for\
+            \n      benchmarking findCoInft (make bench)\
+            \n Output:\
+            \n    - stdout: fastq with the reads (ref=name in header)\
+            \n Input:\
+            \n    -ref:                                      [Required]\
+            \n        - Fasta with references. depth=number in a\
+            \n          header sets the share of reads for it\
+            \n    -num-reads:                                [2000]\
+            \n        - Number of reads to make\
+            \n    -seed:                                     [1026]\
+            \n        - Seed for the random number generator\
+            \n    -error:                                    [0.05]\
+            \n        - Chance of an error at each base\
+            \n    -flank:                                    [30]\
+            \n        - Random bases before & after the amplicon\
+            \n    -primers:                                  [None]\
+            \n        - Save primers for the first reference to\
+            \n          this file (for findCoInft -primers)\
+            \n    -primer-len:                               [20]\
+            \n        - Length of each primer\
+            \n    -out:                                      [stdout]\
+            \n        - File to print the reads to\
+            \n";
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-2: Read in and check user input
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    inputErrCStr =
+        checkInput(
+            lenArgsInt,
+            argsPtrCStr,
+            &refPathCStr,
+            &outPathCStr,
+            &primPathCStr,
+            &numReadsUL,
+            &seedUL,
+            &errDbl,
+            &flankUL,
+            &primLenUL
+    ); /*Get user input*/
+
+    if(inputErrCStr == 0)
+    { /*If no input was given*/
+        fprintf(stderr, "%s\nNo input arguments\n", helpMesgCStr);
+        exit(-1);
+    } /*If no input was given*/
+
+    if(inputErrCStr != (char *) 1)
+    { /*If the user input an invalid input*/
+        if(
+            strcmp(inputErrCStr, "-h") == 0 ||
+            strcmp(inputErrCStr, "--h") == 0 ||
+            strcmp(inputErrCStr, "-help") == 0 ||
+            strcmp(inputErrCStr, "--help") == 0
+        ) { /*If user requested the help message*/
+            fprintf(stdout, "%s\n", helpMesgCStr);
+            exit(0);
+        } /*If user requested the help message*/
+
+        if(
+            strcmp(inputErrCStr, "-v") == 0 ||
+            strcmp(inputErrCStr, "-V") == 0 ||
+            strcmp(inputErrCStr, "-Version") == 0 ||
+            strcmp(inputErrCStr, "-version") == 0
+        ) { /*If the user is requesting the version number*/
+            fprintf(
+                stdout,
+                "benchSimReads built from findCoInft version: %.8f\n",
+                defVersion
+            );
+            exit(0);
+        } /*If the user is requesting the version number*/
+
+        fprintf(
+            stderr,
+            "%s\n%s is invalid\n",
+            helpMesgCStr,
+            inputErrCStr
+        );
+        exit(-1);
+    } /*If the user input an invalid input*/
+
+    if(refPathCStr == 0)
+    { /*If no references were input*/
+        fprintf(stderr, "No references were input with -ref\n");
+        exit(-1);
+    } /*If no references were input*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-3: Read in the references & print the primers
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    numRefsUL =
+        readSimRefs(
+            refPathCStr,
+            refAryCStr,
+            nameAryCStr,
+            lenRefAryUL,
+            depthAryUL
+    ); /*Read in the references*/
+
+    if(numRefsUL == 0)
+    { /*If could not read in the references*/
+        fprintf(stderr, "Could not read references in %s\n",refPathCStr);
+        exit(-1);
+    } /*If could not read in the references*/
+
+    for(refUL = 0; refUL < numRefsUL; ++refUL)
+    { /*Loop: Find the longest reference & the total depth*/
+        totalDepthUL += depthAryUL[refUL];
+
+        if(lenRefAryUL[refUL] > maxLenUL)
+            maxLenUL = lenRefAryUL[refUL];
+    } /*Loop: Find the longest reference & the total depth*/
+
+    if(primPathCStr != 0)
+    { /*If printing out primers for the first reference*/
+        if(primLenUL > lenRefAryUL[0])
+            primLenUL = lenRefAryUL[0];
+
+        primFILE = fopen(primPathCStr, "w");
+
+        if(primFILE == 0)
+        { /*If could not open the primer file*/
+            fprintf(stderr, "Could not open %s\n", primPathCStr);
+            exit(-1);
+        } /*If could not open the primer file*/
+
+        fprintf(primFILE, ">forward\n%.*s\n>reverse\n", (int) primLenUL,
+                refAryCStr[0]);
+
+        for(posUL = lenRefAryUL[0]; posUL > lenRefAryUL[0]-primLenUL;)
+            fputc(compBase(refAryCStr[0][--posUL]), primFILE);
+
+        fputc('\n', primFILE);
+        fclose(primFILE);
+    } /*If printing out primers for the first reference*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-4: Simulate the reads
+    ^    main sec-4 sub-1: Set up the buffers & output file
+    ^    main sec-4 sub-2: Pick a reference & add the first flank
+    ^    main sec-4 sub-3: Copy the reference with errors
+    ^    main sec-4 sub-4: Add the last flank & reverse half the reads
+    ^    main sec-4 sub-5: Print the read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Main Sec-4 Sub-1: Set up the buffers & output file
+    \******************************************************************/
+
+    /*Worst case every base has an insertion*/
+    seqCStr = malloc(sizeof(char) * (2 * maxLenUL + 2 * flankUL + 1));
+    qCStr = malloc(sizeof(char) * (2 * maxLenUL + 2 * flankUL + 1));
+
+    if(seqCStr == 0 || qCStr == 0)
+    { /*If had a memory allocation error*/
+        fprintf(stderr, "Memory allocation error\n");
+        exit(-1);
+    } /*If had a memory allocation error*/
+
+    if(outPathCStr != 0)
+    { /*If printing the reads to a file*/
+        outFILE = fopen(outPathCStr, "w");
+
+        if(outFILE == 0)
+        { /*If could not open the output file*/
+            fprintf(stderr, "Could not open %s\n", outPathCStr);
+            exit(-1);
+        } /*If could not open the output file*/
+    } /*If printing the reads to a file*/
+
+    /*Avoid a zero state, which xorshift can not leave*/
+    stateULng = (uint64_t) seedUL * 0x9E3779B97F4A7C15ULL + 1;
+    errCutULng = (uint64_t) (errDbl * 1000000);
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Make each read*/
+
+        /**************************************************************\
+        * Main Sec-4 Sub-2: Pick a reference & add the first flank
+        \**************************************************************/
+
+        /*Pick the reference by its share of the depth*/
+        randULng = simRandUL(&stateULng) % totalDepthUL;
+
+        for(refUL = 0; randULng >= depthAryUL[refUL]; ++refUL)
+            randULng -= depthAryUL[refUL];
+
+        lenSeqUL = 0;
+
+        for(posUL = 0; posUL < flankUL; ++posUL)
+        { /*Loop: Add the first flank*/
+            seqCStr[lenSeqUL] = "ACGT"[simRandUL(&stateULng) & 3];
+            qCStr[lenSeqUL] = 33 + 5 + simRandUL(&stateULng) % 20;
+            ++lenSeqUL;
+        } /*Loop: Add the first flank*/
+
+        /**************************************************************\
+        * Main Sec-4 Sub-3: Copy the reference with errors
+        \**************************************************************/
+
+        for(posUL = 0; posUL < lenRefAryUL[refUL]; ++posUL)
+        { /*Loop: Copy the reference*/
+            randULng = simRandUL(&stateULng) % 1000000;
+
+            if(randULng >= errCutULng)
+            { /*If this base has no error*/
+                seqCStr[lenSeqUL] = refAryCStr[refUL][posUL];
+                qCStr[lenSeqUL] = 33 + 10 + simRandUL(&stateULng) % 21;
+                ++lenSeqUL;
+                continue;
+            } /*If this base has no error*/
+
+            /*40% substitutions, 30% insertions, 30% deletions*/
+            randULng = simRandUL(&stateULng) % 10;
+
+            if(randULng >= 7)
+                continue; /*Deletion*/
+
+            if(randULng >= 4)
+            { /*If inserting a base*/
+                seqCStr[lenSeqUL] = "ACGT"[simRandUL(&stateULng) & 3];
+                qCStr[lenSeqUL] = 33 + 2 + simRandUL(&stateULng) % 8;
+                ++lenSeqUL;
+
+                seqCStr[lenSeqUL] = refAryCStr[refUL][posUL];
+                qCStr[lenSeqUL] = 33 + 10 + simRandUL(&stateULng) % 21;
+                ++lenSeqUL;
+                continue;
+            } /*If inserting a base*/
+
+            /*Substitution, pick one of the three other bases*/
+            tmpC = refAryCStr[refUL][posUL];
+
+            do{
+                seqCStr[lenSeqUL] = "ACGT"[simRandUL(&stateULng) & 3];
+            } while(seqCStr[lenSeqUL] == tmpC);
+
+            qCStr[lenSeqUL] = 33 + 2 + simRandUL(&stateULng) % 8;
+            ++lenSeqUL;
+        } /*Loop: Copy the reference*/
+
+        /**************************************************************\
+        * Main Sec-4 Sub-4: Add the last flank & reverse half the reads
+        \**************************************************************/
+
+        for(posUL = 0; posUL < flankUL; ++posUL)
+        { /*Loop: Add the last flank*/
+            seqCStr[lenSeqUL] = "ACGT"[simRandUL(&stateULng) & 3];
+            qCStr[lenSeqUL] = 33 + 5 + simRandUL(&stateULng) % 20;
+            ++lenSeqUL;
+        } /*Loop: Add the last flank*/
+
+        seqCStr[lenSeqUL] = '\0';
+        qCStr[lenSeqUL] = '\0';
+
+        if(simRandUL(&stateULng) & 1)
+        { /*If making a reverse complement read*/
+            for(posUL = 0; posUL < lenSeqUL / 2; ++posUL)
+            { /*Loop: Reverse complement the read*/
+                tmpC = compBase(seqCStr[posUL]);
+                seqCStr[posUL] = compBase(seqCStr[lenSeqUL - posUL - 1]);
+                seqCStr[lenSeqUL - posUL - 1] = tmpC;
+
+                tmpC = qCStr[posUL];
+                qCStr[posUL] = qCStr[lenSeqUL - posUL - 1];
+                qCStr[lenSeqUL - posUL - 1] = tmpC;
+            } /*Loop: Reverse complement the read*/
+
+            if(lenSeqUL & 1)
+                seqCStr[posUL] = compBase(seqCStr[posUL]);
+        } /*If making a reverse complement read*/
+
+        /**************************************************************\
+        * Main Sec-4 Sub-5: Print the read
+        \**************************************************************/
+
+        /*Nanopore style (uuid) read ids, which fqGetIds expects*/
+        fprintf(
+            outFILE,
+            "@%08lx-%04lx-%04lx-%04lx-%012lx ref=%s\n%s\n+\n%s\n",
+            (unsigned long) (simRandUL(&stateULng) & 0xffffffff),
+            (unsigned long) (simRandUL(&stateULng) & 0xffff),
+            (unsigned long) (simRandUL(&stateULng) & 0xffff),
+            (unsigned long) (simRandUL(&stateULng) & 0xffff),
+            (unsigned long) (simRandUL(&stateULng) & 0xffffffffffffULL),
+            nameAryCStr[refUL],
+            seqCStr,
+            qCStr
+        );
+    } /*Loop: Make each read*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Main Sec-5: Clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(outFILE != stdout)
+        fclose(outFILE);
+
+    for(refUL = 0; refUL < numRefsUL; ++refUL)
+        free(refAryCStr[refUL]);
+
+    free(seqCStr);
+    free(qCStr);
+    exit(0);
+} /*main*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies: Each input variable to hold user input
+|    - Returns:
+|        o 0 if no input was given
+|        o The parameter that was invalid
+|        o 1 (cast to char *) if all input was valid
+\---------------------------------------------------------------------*/
+char * checkInput(
+    int lenArgsInt,          /*Number arguments user input*/
+    char *argsCStr[],        /*Array with user arguments*/
+    char **refPathCStr,      /*Fasta file with references*/
+    char **outPathCStr,      /*File to save reads to*/
+    char **primPathCStr,     /*File to save primers to*/
+    unsigned long *numReadsUL, /*Number of reads to simulate*/
+    unsigned long *seedUL,     /*Seed for the random numbers*/
+    double *errDbl,            /*Error rate of each base*/
+    unsigned long *flankUL,    /*Random bases around the amplicon*/
+    unsigned long *primLenUL   /*Length of the primers*/
+) /*Checks & extracts user input*/
+{ /*checkInput*/
+    char *parmCStr = 0;
+    char *inputCStr = 0;
+
+    if(lenArgsInt < 2)
+        return 0;
+
+    for(int intArg = 1; intArg < lenArgsInt; intArg += 2)
+    { /*Loop: Read in the user input*/
+        parmCStr = argsCStr[intArg];
+
+        if(intArg + 1 >= lenArgsInt)
+            return parmCStr; /*Parameter is missing its argument*/
+
+        inputCStr = argsCStr[intArg + 1];
+
+        if(strcmp(parmCStr, "-ref") == 0)
+            *refPathCStr = inputCStr;
+
+        else if(strcmp(parmCStr, "-out") == 0)
+            *outPathCStr = inputCStr;
+
+        else if(strcmp(parmCStr, "-primers") == 0)
+            *primPathCStr = inputCStr;
+
+        else if(strcmp(parmCStr, "-num-reads") == 0)
+            *numReadsUL = strtoul(inputCStr, 0, 10);
+
+        else if(strcmp(parmCStr, "-seed") == 0)
+            *seedUL = strtoul(inputCStr, 0, 10);
+
+        else if(strcmp(parmCStr, "-error") == 0)
+            sscanf(inputCStr, "%lf", errDbl);
+
+        else if(strcmp(parmCStr, "-flank") == 0)
+            *flankUL = strtoul(inputCStr, 0, 10);
+
+        else if(strcmp(parmCStr, "-primer-len") == 0)
+            *primLenUL = strtoul(inputCStr, 0, 10);
+
+        else
+            return parmCStr;
+    } /*Loop: Read in the user input*/
+
+    return (char *) 1;
+} /*checkInput*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: the next number in the sequence
+|    - Modifies: stateULng to the next state
+\---------------------------------------------------------------------*/
+uint64_t simRandUL(
+    uint64_t *stateULng  /*State of the random number generator*/
+) /*Gets the next random number*/
+{ /*simRandUL*/
+    *stateULng ^= *stateULng >> 12;
+    *stateULng ^= *stateULng << 25;
+    *stateULng ^= *stateULng >> 27;
+    return *stateULng * 0x2545F4914F6CDD1DULL;
+} /*simRandUL*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of references read in
+|        o 0 if could not open the file, no references, or memory error
+|    - Modifies:
+|        o refAryCStr to have each reference sequence (upper case)
+|        o nameAryCStr to have each reference name
+|        o lenRefAryUL & depthAryUL to have the lengths & depths
+\---------------------------------------------------------------------*/
+unsigned long readSimRefs(
+    char *refPathCStr,        /*Fasta file with the references*/
+    char *refAryCStr[],       /*Gets the sequences (maxSimRefs)*/
+    char nameAryCStr[][128],  /*Gets the names (maxSimRefs)*/
+    unsigned long *lenRefAryUL, /*Gets the sequence lengths*/
+    unsigned long *depthAryUL   /*Gets the depth= from each header*/
+) /*Reads in the references & their depths*/
+{ /*readSimRefs*/
+    char lineCStr[4096];
+    char *tmpCStr = 0;
+    char *depthCStr = 0;
+    char *newCStr = 0;          /*For resizing a sequence*/
+    unsigned long numRefsUL = 0;
+    unsigned long sizeUL = 0;   /*Size of the current sequence buffer*/
+    unsigned long *lenUL = 0;
+    FILE *refFILE = fopen(refPathCStr, "r");
+
+    if(refFILE == 0)
+        return 0;
+
+    while(fgets(lineCStr, 4096, refFILE))
+    { /*Loop: Read in the fasta file*/
+        if(lineCStr[0] == '>')
+        { /*If is a new reference*/
+            if(numRefsUL >= maxSimRefs)
+                break;
+
+            /*Name ends at the first white space*/
+            for(sizeUL = 1; lineCStr[sizeUL] > 32 && sizeUL < 128;)
+            { /*Loop: Copy the name*/
+                nameAryCStr[numRefsUL][sizeUL - 1] = lineCStr[sizeUL];
+                ++sizeUL;
+            } /*Loop: Copy the name*/
+
+            nameAryCStr[numRefsUL][sizeUL - 1] = '\0';
+
+            depthCStr = strstr(lineCStr, "depth=");
+            depthAryUL[numRefsUL] = 1;
+
+            if(depthCStr != 0)
+                depthAryUL[numRefsUL] = strtoul(depthCStr + 6, 0, 10);
+
+            sizeUL = 4096;
+            refAryCStr[numRefsUL] = malloc(sizeof(char) * sizeUL);
+            lenRefAryUL[numRefsUL] = 0;
+            lenUL = &lenRefAryUL[numRefsUL];
+            ++numRefsUL;
+
+            if(refAryCStr[numRefsUL - 1] == 0)
+                break;
+
+            continue;
+        } /*If is a new reference*/
+
+        if(lenUL == 0)
+            continue; /*No header yet*/
+
+        for(tmpCStr = lineCStr; *tmpCStr != '\0'; ++tmpCStr)
+        { /*Loop: Copy the sequence*/
+            if(*tmpCStr <= 32)
+                continue; /*White space*/
+
+            if(*lenUL + 1 >= sizeUL)
+            { /*If need a larger buffer*/
+                sizeUL <<= 1;
+                newCStr =
+                    realloc(refAryCStr[numRefsUL-1], sizeof(char)*sizeUL);
+
+                if(newCStr == 0)
+                { /*If had a memory allocation error*/
+                    fclose(refFILE);
+                    return 0;
+                } /*If had a memory allocation error*/
+
+                refAryCStr[numRefsUL - 1] = newCStr;
+            } /*If need a larger buffer*/
+
+            refAryCStr[numRefsUL - 1][*lenUL] = *tmpCStr & ~32;
+            ++(*lenUL);
+            refAryCStr[numRefsUL - 1][*lenUL] = '\0';
+        } /*Loop: Copy the sequence*/
+    } /*Loop: Read in the fasta file*/
+
+    fclose(refFILE);
+
+    for(sizeUL = 0; sizeUL < numRefsUL; ++sizeUL)
+    { /*Loop: Make sure every reference was read in*/
+        if(refAryCStr[sizeUL] == 0 || lenRefAryUL[sizeUL] == 0)
+            return 0;
+
+        if(depthAryUL[sizeUL] == 0)
+            depthAryUL[sizeUL] = 1;
+    } /*Loop: Make sure every reference was read in*/
+
+    return numRefsUL;
+} /*readSimRefs*/
+
+/*---------------------------------------------------------------------\
+| Output: Returns: the complement of baseC (N for non-ATGC)
+\---------------------------------------------------------------------*/
+char compBase(
+    char baseC
+) /*Complements a base*/
+{ /*compBase*/
+    switch(baseC)
+    { /*Switch: Find the complement*/
+        case 'A': return 'T';
+        case 'T': return 'A';
+        case 'C': return 'G';
+        case 'G': return 'C';
+        default: return 'N';
+    } /*Switch: Find the complement*/
+} /*compBase*/
@@ -0,0 +1,139 @@
+/*######################################################################
+# Use:
+#   o Times the stages of findCoInft for benchmarking (-bench-tsv).
+######################################################################*/
+
+#include "benchTimeFun.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' benchTimeFun SOF:
+'   fun-1 enableBenchTime:
+'     o Turns on the stage timers
+'   fun-2 getBenchTime:
+'     o Gets the current time (0 if timers are off)
+'   fun-3 addBenchTime:
+'     o Adds the time since a getBenchTime call to a stage
+'   fun-4 printBenchTimes:
+'     o Appends the time spent in each stage to a tsv file
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*The timers are shared by all threads, so they are kept here instead
+  of being passed down through buildCon & the clustering functions*/
+static char benchOnBl = 0;
+static unsigned long benchCallsAryUL[benchNumStagesUC];
+static double benchSecAryDbl[benchNumStagesUC];
+static pthread_mutex_t benchMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *benchStageAryCStr[benchNumStagesUC] =
+{ /*Names printed for each stage*/
+    "trimPrimers",
+    "binReads",
+    "fqGetBestReadByMedQ",
+    "findBestXReads",
+    "simpleMajCon",
+    "binReadToCon",
+    "cmpCons",
+    "mergeCons",
+    "readGraph",
+    "buildConWithPoa"
+}; /*Names printed for each stage*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: the stage timers to be on & zeroed
+\---------------------------------------------------------------------*/
+void enableBenchTime(
+) /*Turns on the stage timers*/
+{ /*enableBenchTime*/
+    for(uint8_t uCStage = 0; uCStage < benchNumStagesUC; ++uCStage)
+    { /*Loop: Zero the timers*/
+        benchCallsAryUL[uCStage] = 0;
+        benchSecAryDbl[uCStage] = 0;
+    } /*Loop: Zero the timers*/
+
+    benchOnBl = 1;
+} /*enableBenchTime*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Seconds from a fixed (monotonic) point in time
+|        o 0 if the stage timers are off
+\---------------------------------------------------------------------*/
+double getBenchTime(
+) /*Gets the current time (0 if timers are off)*/
+{ /*getBenchTime*/
+    struct timespec timeST;
+
+    if(!benchOnBl)
+        return 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &timeST);
+    return (double) timeST.tv_sec + (double) timeST.tv_nsec / 1e9;
+} /*getBenchTime*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o The timer for stageUC to have one more call & the seconds
+|          since startDbl. Nothing is done if the timers are off
+\---------------------------------------------------------------------*/
+void addBenchTime(
+    uint8_t stageUC, /*Stage to add the time to (bench...UC)*/
+    double startDbl  /*Time from getBenchTime at the stage start*/
+) /*Adds the time since a getBenchTime call to a stage*/
+{ /*addBenchTime*/
+    double endDbl = 0;
+
+    if(!benchOnBl || stageUC >= benchNumStagesUC)
+        return;
+
+    endDbl = getBenchTime();
+
+    pthread_mutex_lock(&benchMutex);
+    ++benchCallsAryUL[stageUC];
+    benchSecAryDbl[stageUC] += endDbl - startDbl;
+    pthread_mutex_unlock(&benchMutex);
+} /*addBenchTime*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if printed the times
+|        o 2 if could not open tsvPathCStr
+|    - Prints:
+|        o A header (if tsvPathCStr is empty or new) & one line per
+|          stage to tsvPathCStr, then a "total" line
+\---------------------------------------------------------------------*/
+uint8_t printBenchTimes(
+    char *tsvPathCStr, /*Tsv file to append the times to*/
+    char *runCStr,     /*Name of this run (first column)*/
+    double startDbl    /*Time from getBenchTime at the run start*/
+) /*Appends the time spent in each stage to a tsv file*/
+{ /*printBenchTimes*/
+    double endDbl = getBenchTime();
+    FILE *tsvFILE = fopen(tsvPathCStr, "a");
+
+    if(tsvFILE == 0)
+        return 2;
+
+    fseek(tsvFILE, 0, SEEK_END);
+
+    if(ftell(tsvFILE) == 0)
+        fprintf(tsvFILE, "run\tstage\tcalls\tseconds\n");
+
+    for(uint8_t uCStage = 0; uCStage < benchNumStagesUC; ++uCStage)
+    { /*Loop: Print out the time for each stage*/
+        fprintf(
+            tsvFILE,
+            "%s\t%s\t%lu\t%.6f\n",
+            runCStr,
+            benchStageAryCStr[uCStage],
+            benchCallsAryUL[uCStage],
+            benchSecAryDbl[uCStage]
+        );
+    } /*Loop: Print out the time for each stage*/
+
+    fprintf(tsvFILE,"%s\ttotal\t1\t%.6f\n",runCStr,endDbl - startDbl);
+    fclose(tsvFILE);
+    return 1;
+} /*printBenchTimes*/
@@ -0,0 +1,91 @@
+/*######################################################################
+# Use:
+#   o Times the stages of findCoInft for benchmarking (-bench-tsv).
+#     Each stage keeps the number of calls & the total seconds spent
+#     in it. Timing is off until enableBenchTime is called, so the
+#     timers cost one branch per call in a normal run.
+# Includes:
+#   - <stdio.h>
+#   - <stdint.h>
+#   - <pthread.h>
+#   - <time.h>
+######################################################################*/
+
+#ifndef BENCHTIMEFUN_H
+#define BENCHTIMEFUN_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' benchTimeFun SOH: Start Of Header
+'   o fun-1 enableBenchTime:
+'     - Turns on the stage timers
+'   o fun-2 getBenchTime:
+'     - Gets the current time (0 if timers are off)
+'   o fun-3 addBenchTime:
+'     - Adds the time since a getBenchTime call to a stage
+'   o fun-4 printBenchTimes:
+'     - Appends the time spent in each stage to a tsv file
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*Stages that are timed. The order is the order printed*/
+#define benchTrimPrimersUC 0   /*trimPrimers on the input reads*/
+#define benchBinReadsUC 1      /*binReads or binReadsThreaded*/
+#define benchBestReadUC 2      /*fqGetBestReadByMedQ (or stats/arena)*/
+#define benchBestXReadsUC 3    /*findBestXReads*/
+#define benchMajConUC 4        /*simpleMajCon*/
+#define benchReadToConUC 5     /*binReadToCon*/
+#define benchCmpConsUC 6       /*cmpCons & cmpAllCons*/
+#define benchMergeConsUC 7     /*Main Sec-8 merging of clusters*/
+#define benchClustGraphUC 8    /*graphSplitBin (read graph clusters)*/
+#define benchPoaConUC 9        /*buildConWithPoa*/
+#define benchNumStagesUC 10
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: the stage timers to be on & zeroed
+\---------------------------------------------------------------------*/
+void enableBenchTime(); /*Turns on the stage timers*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Seconds from a fixed (monotonic) point in time
+|        o 0 if the stage timers are off
+\---------------------------------------------------------------------*/
+double getBenchTime(); /*Gets the current time (0 if timers are off)*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o The timer for stageUC to have one more call & the seconds
+|          since startDbl. Nothing is done if the timers are off
+| Note:
+|    - Safe to call from the clustering threads. Stages run on
+|      several threads add up thread seconds, not wall seconds
+\---------------------------------------------------------------------*/
+void addBenchTime(
+    uint8_t stageUC, /*Stage to add the time to (bench...UC)*/
+    double startDbl  /*Time from getBenchTime at the stage start*/
+); /*Adds the time since a getBenchTime call to a stage*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if printed the times
+|        o 2 if could not open tsvPathCStr
+|    - Prints:
+|        o A header (if tsvPathCStr is empty or new) & one line per
+|          stage to tsvPathCStr. The line is:
+|          run  stage  calls  seconds
+|        o A "total" line with the seconds from startDbl to now
+\---------------------------------------------------------------------*/
+uint8_t printBenchTimes(
+    char *tsvPathCStr, /*Tsv file to append the times to*/
+    char *runCStr,     /*Name of this run (first column)*/
+    double startDbl    /*Time from getBenchTime at the run start*/
+); /*Appends the time spent in each stage to a tsv file*/
+
+#endif
@@ -42,9 +42,13 @@ char * getUserInput(
     char *prefCStr,                      /*Holds user supplied prefix*/
     char **fqPathCStr,                   /*Holds path to fastq file*/
     char **refsPathCStr,                 /*Holds path to references*/
+    char **refCacheCStr,                 /*Directory for ref indexes*/
     char *threadsCStr,                   /*Number threads for minimap2*/
     char *rmSupAlnBl,       /*Remove reads with supplemenat alignments*/
+    char *threadBinBl,                   /*1: Score reads on threads*/
     char *trimBl,                        /*1 trim reads, 0 do not*/
+    char *statsTsvBl,                    /*1: Export stats as tsv*/
+    char *gzipOutBl,                     /*1: gzip the kept bins*/
     unsigned long *minReadsPerBinUL,       /*Min # reads to keep a bin*/
     struct minAlnStats *readToRefMinStats  /*Binning scoring settings*/
 ); /*Reads in user input*/
@@ -77,22 +81,30 @@ int main(
 
     char *fqPathCStr = 0;        /*Fastq file to bin*/
     char *refsPathCStr = 0;      /*References to bin with*/
+    char *refCacheCStr = 0;      /*Directory with cached ref indexes*/
+    char refIdxCStr[1024];       /*Cached index to bin with*/
     char trimBl = 0;             /*1: trim reads, 0: do not*/
     char prefixCStr[128] = defPrefix;  /*Prefix to name the bins*/
     char threadsCStr[16] = defThreads; /*Number of threads to use*/
     char rmSupAlnBl = rmReadsWithSupAln;
        /*if rmSupAlnBl = 1, Remove reads with supplementary alignments*/
+    char threadBinBl = defThreadBinBl;
+       /*if threadBinBl = 1, score reads on -threads threads*/
+    char statsTsvBl = 0;  /*1: Export the kept bins stats as tsvs*/
+    char gzipOutBl = defGzipOutBl; /*1: gzip the kept bins fastqs*/
 
     char minimap2CmdCStr[1024]; /*To check if minimap2 exists*/
     char minimap2VersionCStr[1024]; /*holds minimap2 version*/
     char *inputErrC = 0;
     char *tmpCStr = 0;
     char readCntNameCStr[256]; /*Name of the read count file*/
+    char statTsvCStr[256];     /*Name of a bins exported stats file*/
     unsigned char errUC = 0;
 
     unsigned long minReadsPerBinUL = minReadsPerBin;
 
     FILE *readCountFILE = 0;
+    FILE *statTsvFILE = 0;
 
     struct readBin *binTree = 0; /*Holds output bins, will be freeded*/
 
@@ -110,12 +122,17 @@ int main(
             \n Use: Bins reads by a set of input references.\
             \n    -fastq:\
             \n        - Fastq file with reads to search      [Required]\
+            \n        - Can be gzip or bgzip compressed\
             \n    -ref:\
             \n        -Fasta file with references for bining [Required]\
             \n    -prefix:\
             \n        - Prefix to add to file names          [Out]\
             \n    -threads:\
             \n        - Number of threads to use             [3]\
+            \n    -ref-cache:\
+            \n        - Directory to keep minimap2 indexes   [None]\
+            \n          in. The index for -ref is made once\
+            \n          & reused by later runs.\
             \n    -min-reads-per-bin:\
             \n        - Min number of reads needed to keep   [100]\
             \n          a bin or a cluster\
@@ -137,12 +154,28 @@ int main(
             \n       - If this setting is off, then supplemental\
             \n         alignments are just ignored.\
             \n       - This setting requires running minimap2 with\
-            \n         just one thread for binning.\
+            \n         just one thread for binning, unless\
+            \n         -thread-bin is used.\
+            \n    -thread-bin                   [No]\
+            \n       - Bin with all -threads. minimap2 gets\
+            \n         every thread & reads are scored on\
+            \n         -threads threads.\
+            \n       - -rm-sup-reads finds reads with\
+            \n         supplemental alignments by read id.\
+            \n    -stats-tsv                    [No]\
+            \n       - Also print each kept bins stats as a\
+            \n         tsv (prefix--ref--stats.tsv).\
+            \n    -gzip-out                     [No]\
+            \n       - Compress the kept bins fastq files\
+            \n         with bgzip (or pigz or gzip).\
             \n Additional Help messages:\
             \n    -h-bin:\
             \n        - Print out the parameters for the binning step.\
             \n Output:\
             \n    - fastq files: With the reads for each co-infection\
+            \n    - prefix--ref--stats.bin:\
+            \n        o Binary stats (mapq, Q-scores, ...) for\
+            \n          each read in the bin (see -stats-tsv)\
             \n    - prefix--read-counts.tsv:\
             \n        o File with number of reads per kept cluster\
             \n        o Also has the read counts for each discard bin\
@@ -275,9 +308,13 @@ int main(
             prefixCStr,           /*Holds user supplied prefix*/
             &fqPathCStr,          /*Holds path to fastq file*/
             &refsPathCStr,        /*Holds path to references*/
+            &refCacheCStr,        /*Directory for ref indexes*/
             threadsCStr,          /*Number threads for minimap2*/
             &rmSupAlnBl,    /*Remove reads with supplemenat alignments*/
+            &threadBinBl,         /*1: Score reads on threads*/
             &trimBl,              /*1 trim reads, 0 do not*/
+            &statsTsvBl,          /*1: Export stats as tsv*/
+            &gzipOutBl,           /*1: gzip the kept bins*/
             &minReadsPerBinUL,    /*Min # reads to keep a bin*/
             &minStats             /*scoreReads variables*/
     ); /*Get user input*/
@@ -350,19 +387,56 @@ int main(
     ^ Main Sec-5: Bin reads
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    binTree =
-        binReads(
-            fqPathCStr,        /*Fastq file to bin*/
-            refsPathCStr,      /*References to bin with*/
-            prefixCStr,
-            threadsCStr,       /*Number threads to use with minimap2*/
-            rmSupAlnBl,   /*Remove reads with supplementary alignments*/
-            trimBl,       /*1: trim reads, 0: do not*/
-            &samStruct, /*Holds minimap2 output*/
-            &oldStruct, /*Holds previous line of minimap2 output*/
-            &minStats,
-            &errUC     /*Reports any errors*/
-    ); /*Bin reads using the provided references*/
+    if(refCacheCStr != 0)
+    { /*If using a cached reference index*/
+        errUC =
+            getMapRefCache(
+                refsPathCStr,
+                refCacheCStr,
+                minStats.inMapBl,
+                refIdxCStr
+            ); /*Find or make the index*/
+
+        if(errUC & 1)
+            refsPathCStr = refIdxCStr; /*Bin with the saved index*/
+        else
+            fprintf(
+                stderr,
+                "Could not cache the -ref index in %s, using %s\n",
+                refCacheCStr,
+                refsPathCStr
+            ); /*Let user know the index is not cached*/
+
+        errUC = 0;
+    } /*If using a cached reference index*/
+
+    if(threadBinBl & 1)
+        binTree =
+            binReadsThreaded(
+                fqPathCStr,   /*Fastq file to bin*/
+                refsPathCStr, /*References to bin with*/
+                prefixCStr,
+                threadsCStr,  /*Number threads to use*/
+                rmSupAlnBl,   /*Remove reads with supplementary alignments*/
+                trimBl,       /*1: trim reads, 0: do not*/
+                &minStats,
+                &errUC        /*Reports any errors*/
+        ); /*Bin reads using the provided references & threads*/
+
+    else
+        binTree =
+            binReads(
+                fqPathCStr,   /*Fastq file to bin*/
+                refsPathCStr, /*References to bin with*/
+                prefixCStr,
+                threadsCStr,  /*Number threads to use with minimap2*/
+                rmSupAlnBl,   /*Remove reads with supplementary alignments*/
+                trimBl,       /*1: trim reads, 0: do not*/
+                &samStruct,   /*Holds minimap2 output*/
+                &oldStruct,   /*Holds previous line of minimap2 output*/
+                &minStats,
+                &errUC        /*Reports any errors*/
+        ); /*Bin reads using the provided references*/
 
     /*No longer need the samEntry structures*/
     freeStackSamEntry(&samStruct);
@@ -412,6 +486,39 @@ int main(
 
         if(binTree->numReadsULng >= minReadsPerBinUL)
         { /*If this bin is good, make sure files doe not get deleted*/
+            if(statsTsvBl & 1)
+            { /*If exporting the bins stats as a tsv*/
+                tmpCStr =
+                    cStrCpInvsDelm(statTsvCStr, binTree->statPathCStr);
+                strcpy(tmpCStr - 4, ".tsv"); /*Replace ".bin"*/
+                statTsvFILE = fopen(statTsvCStr, "w");
+
+                if(
+                      statTsvFILE == 0
+                   || !(
+                        statRecToTsv(
+                            binTree->statPathCStr,
+                            binTree->fqPathCStr,
+                            binTree->refIdCStr,
+                            statTsvFILE
+                        ) & 1
+                      )
+                ) fprintf(stdout, "Could not make %s\n", statTsvCStr);
+
+                if(statTsvFILE != 0)
+                    fclose(statTsvFILE);
+            } /*If exporting the bins stats as a tsv*/
+
+            if(gzipOutBl & 1)
+            { /*If compressing the kept bins fastq*/
+                if(!(gzipFqFile(binTree->fqPathCStr, threadsCStr) & 1))
+                    fprintf(
+                        stdout,
+                        "Could not gzip %s\n",
+                        binTree->fqPathCStr
+                    );
+            } /*If compressing the kept bins fastq*/
+
             binTree->fqPathCStr[0] = '\0';
             binTree->statPathCStr[0] = '\0';
             fprintf(readCountFILE, "\tkept\n");
@@ -445,9 +552,13 @@ char * getUserInput(
     char *prefCStr,                      /*Holds user supplied prefix*/
     char **fqPathCStr,                   /*Holds path to fastq file*/
     char **refsPathCStr,                 /*Holds path to references*/
+    char **refCacheCStr,                 /*Directory for ref indexes*/
     char *threadsCStr,                   /*Number threads for minimap2*/
     char *rmSupAlnBl,       /*Remove reads with supplemenat alignments*/
+    char *threadBinBl,                   /*1: Score reads on threads*/
     char *trimBl,                        /*1 trim reads, 0 do not*/
+    char *statsTsvBl,                    /*1: Export stats as tsv*/
+    char *gzipOutBl,                     /*1: gzip the kept bins*/
     unsigned long *minReadsPerBinUL,     /*Min # reads to keep a bin*/
     struct minAlnStats *readToRefMinStats  /*Binning scoring settings*/
 ) /*Reads in user input*/
@@ -494,6 +605,14 @@ char * getUserInput(
         else if(strcmp(parmCStr, "-ref") == 0)
             *refsPathCStr = inputCStr;  /*references*/
 
+        else if(strcmp(parmCStr, "-ref-cache") == 0)
+        { /*Else if caching the reference index*/
+            if(strlen(inputCStr) > 900)
+                return parmCStr; /*Index path would not fit*/
+
+            *refCacheCStr = inputCStr;
+        } /*Else if caching the reference index*/
+
         else if(strcmp(parmCStr, "-prefix") == 0)
             strcpy(prefCStr, inputCStr);     /*Have prefix to use*/
 
@@ -509,12 +628,30 @@ char * getUserInput(
             --intArg;
         } /*Else if removing supplemntal alignments*/
 
+        else if(strcmp(parmCStr, "-thread-bin") == 0)
+        { /*Else if scoring reads on threads*/
+            *threadBinBl = 1;
+            --intArg;
+        } /*Else if scoring reads on threads*/
+
         else if(strcmp(parmCStr, "-trim") == 0)
         { /*Else if trimming the reads*/
             *trimBl = !(*trimBl);
             --intArg;
         } /*Else if trimming the reads*/
 
+        else if(strcmp(parmCStr, "-stats-tsv") == 0)
+        { /*Else if exporting the stats as tsvs*/
+            *statsTsvBl = 1;
+            --intArg;
+        } /*Else if exporting the stats as tsvs*/
+
+        else if(strcmp(parmCStr, "-gzip-out") == 0)
+        { /*Else if compressing the kept bins*/
+            *gzipOutBl = 1;
+            --intArg;
+        } /*Else if compressing the kept bins*/
+
         /**************************************************************\
         * Fun-1 Sec-2 Sub-2: Percent difference settings
         \**************************************************************/
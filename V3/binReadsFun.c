@@ -13,6 +13,32 @@
 '     o Bins reads to a consensus to from a cluster.
 '     o This differes from binReads in that it is extracting reads from
 '       the former bin and it does not produce a stats file.
+'   fun-3 initBinFILECache:
+'     o Sets up the open file cache binReads uses
+'   fun-4 closeOldBinFILEs:
+'     o Closes the files of the least recently used bin in the cache
+'   fun-5 getBinFILEs:
+'     o Gets (opens if needed) the fastq & stats files for a bin
+'   fun-6 freeBinFILECache:
+'     o Closes all open files in the cache & frees the cache
+'   fun-7 initIdHashSet:
+'     o Sets up an empty read id set
+'   fun-8 addIdToHashSet:
+'     o Adds a read id to a read id set
+'   fun-9 findIdInHashSet:
+'     o Checks if a read id is in a read id set
+'   fun-10 freeIdHashSet:
+'     o Frees the memory used by a read id set
+'   fun-11 binReadsThread:
+'     o Trims, scores, & checks a set of sam entries for binReads
+'   fun-12 rmIdsFromBin:
+'     o Removes reads in a read id set from a bins fastq & stats file
+'   fun-13 binReadsThreaded:
+'     o Bins reads to a set of references with multiple threads. Reads
+'       with supplementary alignments are found by read id
+'   fun-14 binReadsToCons:
+'     o Maps a bins reads to all of its clusters consensuses at once &
+'       assigns each read to the consensus it mapped best to
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*---------------------------------------------------------------------\
@@ -66,7 +92,6 @@ struct readBin * binReads(
     char dupBL = 0;        /*Was the last read a duplicate*/
     uint8_t zeroUChar = 0;    /*For when I need to pass a 0 as a pointer*/
     char funErrUC = 0;     /*Holding err output from called functions*/
-    unsigned char printStatsHeadUC = 0;/*tells to print stat file head*/
 
     struct samEntry *tmpSam = 0;       /*For swaping newSam and oldSam*/
     struct samEntry *samZeroStruct = 0; /*Points were avoiding ref*/
@@ -76,10 +101,13 @@ struct readBin * binReads(
 
     struct readBinStack binStack[200]; /*Stack for read bin AVL tree*/
 
-    FILE *stdinFILE = 0;
+    struct samMap samMapST; /*minimap2 or built in mapper output*/
+
     FILE *fqBinFILE = 0;
     FILE *statFILE = 0;
 
+    struct binFILECache binCache; /*Keeps bin files open between reads*/
+
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-1 Sec-2: Run minimap2 & read in first line of output
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
@@ -99,10 +127,25 @@ struct readBin * binReads(
 
     tmpCStr = cpParmAndArg(tmpCStr, refsPathCStr, fqPathCStr);
 
-    stdinFILE = popen(minimap2CMDCStr, "r"); /*run minimap2*/
+    /*Run minimap2 or the built in mapper (-in-map)*/
+    funErrUC =
+        openSamMap(
+            &samMapST,
+            minimap2CMDCStr,
+            refsPathCStr,
+            fqPathCStr,
+            minStats->inMapBl,
+            0
+        );
+
+    /*Removing supplementals keeps the last entry, while the next entry
+      is read in, so each entry needs its own copy of the line*/
+    samMapST.copyLineBl = rmSupAlnBl & 1;
 
     blankSamEntry(oldSam); /*Remove old stats in sam file*/
-    funErrUC = readSamLine(oldSam, stdinFILE);
+
+    if(!(funErrUC & 64))
+        funErrUC = readSamMap(oldSam, &samMapST);
         /*get the first line from minimap2*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -111,7 +154,7 @@ struct readBin * binReads(
 
     if(!(funErrUC & 1))
     { /*If an error occured*/
-        pclose(stdinFILE);    /*No longer need open (due to error*/
+        closeSamMap(&samMapST);    /*No longer need open (due to error*/
 
         if(!(funErrUC & 64))
         { /*If errored out*/
@@ -126,9 +169,9 @@ struct readBin * binReads(
         } /*If had memory allocation error*/
     } /*If an error occured*/
 
-    if(*(oldSam->samEntryCStr) != '@')
+    if(*(oldSam->lineCStr) != '@')
     { /*If their is no header line, minimap2 likely errored out*/
-        pclose(stdinFILE);
+        closeSamMap(&samMapST);
         *errUC = 2;
         return 0;
     } /*If minimap2 did not produce a header, it likely error out*/
@@ -139,10 +182,10 @@ struct readBin * binReads(
 
     while(funErrUC & 1)
     { /*While not past the first header*/
-        if(*oldSam->samEntryCStr == '@')
+        if(*oldSam->lineCStr == '@')
         { /*If was a header*/
             blankSamEntry(oldSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(oldSam, stdinFILE); /*read new line*/
+            funErrUC = readSamMap(oldSam, &samMapST); /*read new line*/
             continue; /*Is a header line, move to next line in file*/
         } /*If was a header*/
 
@@ -160,7 +203,7 @@ struct readBin * binReads(
 
             /*Read the next sam entry*/
             blankSamEntry(oldSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(oldSam, stdinFILE);
+            funErrUC = readSamMap(oldSam, &samMapST);
             continue;
         } /*If entry did not have a sequence, discard*/
 
@@ -180,7 +223,7 @@ struct readBin * binReads(
         if(rmSupAlnBl & 1)
         { /*If removing all reads with supplemental alignments*/
             blankSamEntry(newSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(newSam, stdinFILE);
+            funErrUC = readSamMap(newSam, &samMapST);
         } /*If removing all reads with supplemental alignments*/
 
         else 
@@ -198,11 +241,20 @@ struct readBin * binReads(
     ^      reads with supplemental alignments
     ^   fun-1 sec-5 sub-2: Trim and score sam file alignment
     ^   fun-1 sec-5 sub-3: Set up bin file names
-    ^   fun-1 sec-5 sub-4: Check if can open the bin & stats file
-    ^   fun-1 sec-5 sub-5: Append reads to file & add to tree
+    ^   fun-1 sec-5 sub-4: Add read to the tree of bins
+    ^   fun-1 sec-5 sub-5: Get the open bin & stats file for the bin
     ^   fun-1 sec-5 sub-6: Print out the stats and fastq entry
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    /*Bin files are kept open till the end, instead of opening and
+      closing both files for every read*/
+    if(!(initBinFILECache(&binCache) & 1))
+    { /*If had a memory allocation error*/
+        closeSamMap(&samMapST);
+        *errUC = 64;
+        return 0;
+    } /*If had a memory allocation error*/
+
     /******************************************************************\
     * Fun-1 Sec-5 Sub-1: Detect if supplmental & if removing all reads
     *    with supplementals, remove
@@ -212,17 +264,17 @@ struct readBin * binReads(
     { /*While their is a samfile entry to read in*/
         dupBL = 0; /*So that I know I can print out the last read*/
 
-        if(*newSam->samEntryCStr == '@')
+        if(*newSam->lineCStr == '@')
         { /*If was a header*/
             blankSamEntry(newSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(newSam, stdinFILE);
+            funErrUC = readSamMap(newSam, &samMapST);
             continue; /*Is a header line, move to next line in file*/
         } /*If was a header*/
 
         if(newSam->flagUSht & (2048 | 256 | 4))
         { /*If is supplemental (2048), secondary (256), or no map (4)*/
             blankSamEntry(newSam); /*Remove old stats in sam file*/
-            funErrUC = readSamLine(newSam, stdinFILE);
+            funErrUC = readSamMap(newSam, &samMapST);
 
             if((rmSupAlnBl & newSam->flagUSht) & 2048)
             { /*If is a supplemental alignment & remove supplementals*/
@@ -232,7 +284,7 @@ struct readBin * binReads(
                 { /*While the entries are duplicates*/
                     /*Remove previous reads stats & get next alignment*/
                     blankSamEntry(newSam);
-                    funErrUC = readSamLine(newSam, stdinFILE);
+                    funErrUC = readSamMap(newSam, &samMapST);
 
                     if(!(funErrUC & 1))
                         break;      /*end of file or other error*/
@@ -242,7 +294,7 @@ struct readBin * binReads(
 
                 if(funErrUC & 1)
                 { /*If need to grab the next line still*/
-                    funErrUC = readSamLine(oldSam, stdinFILE);
+                    funErrUC = readSamMap(oldSam, &samMapST);
                     dupBL = 0;
                 } /*If need to grab the next line still*/
 
@@ -291,7 +343,7 @@ struct readBin * binReads(
 
             /*Remove old stats, not keeping and get next alinment*/
             blankSamEntry(newSam);
-            funErrUC = readSamLine(newSam, stdinFILE);
+            funErrUC = readSamMap(newSam, &samMapST);
             continue;
         } /*If the read is under the min quality, discard*/
 
@@ -311,35 +363,10 @@ struct readBin * binReads(
         tmpCStr = cStrCpInvsDelm(statFileCStr, prefixCStr);
         tmpCStr = cStrCpInvsDelm(tmpCStr, "--");
         tmpCStr = cStrCpInvsDelm(tmpCStr, refIdCStr);
-        cStrCpInvsDelm(tmpCStr, "--stats.tsv");/*Add stats file ending*/
-
-        /**************************************************************\
-        * Fun-1 Sec-5 Sub-4: Check if can open the bin & stats file
-        \**************************************************************/
-
-        statFILE = fopen(statFileCStr, "a");
-
-        if(statFILE == 0)
-        { /*If can not open the stats file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            *errUC = 4;
-            return 0;
-        } /*If can not open the stats file*/
-
-        fqBinFILE = fopen(binFileCStr, "a");
-
-        if(fqBinFILE == 0)
-        { /*If can not open the fastq binning file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            fclose(statFILE);
-            *errUC = 8;
-            return 0;
-        } /*If can not open the stats file*/
+        cStrCpInvsDelm(tmpCStr, "--stats.bin");/*Add stats file ending*/
 
         /**************************************************************\
-        * Fun-1 Sec-5 Sub-5: Append reads to file & add to tree
+        * Fun-1 Sec-5 Sub-4: Add read to the tree of bins
         \**************************************************************/
 
         tmpBin =
@@ -353,36 +380,39 @@ struct readBin * binReads(
 
         if(tmpBin == 0)
         { /*If a memory error occured*/
+            freeBinFILECache(&binCache);
             freeBinTree(&binTree);
-            fclose(statFILE);
-            fclose(fqBinFILE);
-            pclose(stdinFILE);
+            closeSamMap(&samMapST);
             *errUC = 64;
             return 0;
         } /*If a memory error occured*/
 
         /**************************************************************\
-        * Fun-1 Sec-5 Sub-6: Print out the stats and fastq entry
+        * Fun-1 Sec-5 Sub-5: Get the open bin & stats file for the bin
         \**************************************************************/
 
-        if(tmpBin->numReadsULng == 1) /*This is a new bin*/
-            printStatsHeadUC = 1;  /*Add header to stats file*/
-        else
-            printStatsHeadUC = 0; /*Else do not print the header*/
+        funErrUC = getBinFILEs(&binCache, tmpBin, &fqBinFILE, &statFILE);
+
+        if(!(funErrUC & 1))
+        { /*If can not open the stats or fastq file*/
+            freeBinFILECache(&binCache);
+            freeBinTree(&binTree);
+            closeSamMap(&samMapST);
+            *errUC = funErrUC; /*4: stats file, 8: fastq file*/
+            return 0;
+        } /*If can not open the stats or fastq file*/
+
+        /**************************************************************\
+        * Fun-1 Sec-5 Sub-6: Print out the stats and fastq entry
+        \**************************************************************/
 
         /*Print out the old sam entry (is not a duplicate)*/
         /*Add sequence and stats to their files*/
         samToFq(tmpSam, fqBinFILE); /*Print sequence to fastq file*/
 
         /*Print the stats to its bin file*/
-        printSamStats(tmpSam, &printStatsHeadUC, statFILE);
-
-        fclose(fqBinFILE);
-        fclose(statFILE);
+        printStatRec(tmpSam, statFILE);
 
-        fqBinFILE = 0;  /*So program knows that no file is open*/
-        statFILE = 0;   /*So program knows that no file is open*/
-            
         blankSamEntry(tmpSam); /*Remove old stats in sam file*/
  
         if(rmSupAlnBl & 1)
@@ -394,18 +424,19 @@ struct readBin * binReads(
         } /*If doing a chimera removal*/
 
         /*Read in the next line*/
-        funErrUC = readSamLine(newSam, stdinFILE);
+        funErrUC = readSamMap(newSam, &samMapST);
     } /*While their is a samfile entry to read in*/
 
-    pclose(stdinFILE);
+    closeSamMap(&samMapST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-1 Sec-6: Print out the last read
     ^   fun-1 sec-6 sub-1: Check if should keep last read
     ^   fun-1 sec-6 sub-2: Prepare the fastq & stats file names
-    ^   fun-1 sec-6 sub-3: Check if can open fastq & stats file
-    ^   fun-1 sec-6 sub-4: Add read to the tree of bins
+    ^   fun-1 sec-6 sub-3: Add read to the tree of bins
+    ^   fun-1 sec-6 sub-4: Get the open fastq & stats file for the bin
     ^   fun-1 sec-6 sub-5: Print out the read & its stats to the bin
+    ^   fun-1 sec-6 sub-6: Close all the bin files
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /******************************************************************\
@@ -416,7 +447,10 @@ struct readBin * binReads(
     { /*If I have a final read to print out*/
         if(checkRead(minStats, oldSam) == 0 ||
           !(checkIfKeepRead(minStats, oldSam) & 1)
-        ) return binTree; /*If is a low quality read*/
+        ) { /*If is a low quality read*/
+            freeBinFILECache(&binCache); /*Flush & close bin files*/
+            return binTree;
+        } /*If is a low quality read*/
 
         /**************************************************************\
         * Fun-1 Sec-6 Sub-2: Prepare the fastq & stats file names
@@ -434,41 +468,16 @@ struct readBin * binReads(
         tmpCStr = cStrCpInvsDelm(statFileCStr, prefixCStr);
         tmpCStr = cStrCpInvsDelm(tmpCStr, "--");
         tmpCStr = cStrCpInvsDelm(tmpCStr, refIdCStr);
-        cStrCpInvsDelm(tmpCStr, "--stats.tsv");/*Add stats file ending*/
-
-        /**************************************************************\
-        * Fun-1 Sec-6 Sub-3: Check if can open fastq & stats file
-        \**************************************************************/
-
-        statFILE = fopen(statFileCStr, "a");
-
-        if(statFILE == 0)
-        { /*If can not open the stats file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            *errUC = 4;
-            return 0;
-        } /*If can not open the stats file*/
-
-        fqBinFILE = fopen(binFileCStr, "a");
-
-        if(fqBinFILE == 0)
-        { /*If can not open the fastq binning file*/
-            freeBinTree(&binTree);
-            pclose(stdinFILE);
-            fclose(statFILE);
-            *errUC = 8;
-            return 0;
-        } /*If can not open the stats file*/
+        cStrCpInvsDelm(tmpCStr, "--stats.bin");/*Add stats file ending*/
 
         /**************************************************************\
-        * Fun-1 Sec-6 Sub-4: Add read to the tree of bins
+        * Fun-1 Sec-6 Sub-3: Add read to the tree of bins
         \**************************************************************/
 
         tmpBin =
             insBinIntoTree(
                 refIdCStr,
-                prefixCStr,       /*Fastq file for the bin*/
+                binFileCStr,       /*Fastq file for the bin*/
                 statFileCStr,      /*Stats file for the bin*/
                 &binTree, /*Root of bin tree*/
                 binStack  /*Stack to use in rebalencing tree*/
@@ -476,14 +485,26 @@ struct readBin * binReads(
 
         if(tmpBin == 0)
         { /*If a memory error occured*/
+            freeBinFILECache(&binCache);
             freeBinTree(&binTree);
-            fclose(statFILE);
-            fclose(fqBinFILE);
-            pclose(stdinFILE);
             *errUC = 64;
             return 0;
         } /*If a memory error occured*/
 
+        /**************************************************************\
+        * Fun-1 Sec-6 Sub-4: Get the open fastq & stats file for the bin
+        \**************************************************************/
+
+        funErrUC = getBinFILEs(&binCache, tmpBin, &fqBinFILE, &statFILE);
+
+        if(!(funErrUC & 1))
+        { /*If can not open the stats or fastq file*/
+            freeBinFILECache(&binCache);
+            freeBinTree(&binTree);
+            *errUC = funErrUC; /*4: stats file, 8: fastq file*/
+            return 0;
+        } /*If can not open the stats or fastq file*/
+
         /**************************************************************\
         * Fun-1 Sec-6 Sub-5: Print out the read & its stats to the bin
         \**************************************************************/
@@ -493,12 +514,14 @@ struct readBin * binReads(
         samToFq(oldSam, fqBinFILE); /*Print sequence to fastq file*/
 
         /*Print the stats to its bin file*/
-        printSamStats(oldSam, &printStatsHeadUC, statFILE);
-
-        fclose(fqBinFILE);
-        fclose(statFILE);
+        printStatRec(oldSam, statFILE);
     } /*If I have a final read to print out*/
 
+    /******************************************************************\
+    * Fun-1 Sec-6 Sub-6: Close all the bin files
+    \******************************************************************/
+
+    freeBinFILECache(&binCache); /*Flush & close bin files*/
     return binTree;
 } /*binReads*/
 
@@ -509,6 +532,8 @@ struct readBin * binReads(
 |    Modifies:
 |        - fastq in binClust->fqPathCStr to be the fastq for the cluster
 |        - fastq in binTree->fqPathCStr to not have clustered reads
+|        - With a read arena (binTree->arenaST), the read lists in
+|          binTree & binClust instead. Fastq files are left alone
 \---------------------------------------------------------------------*/
 uint8_t binReadToCon(
     const uint8_t *clustUChar,      /*Cluster on*/
@@ -536,24 +561,31 @@ uint8_t binReadToCon(
     uint8_t errUChar = 0;
     uint8_t oneUChar = 1;
     uint8_t zeroUChar = 0;
-    uint8_t headBool = 0; /*Tells if frist round in stats file*/
 
     char minimap2CmdCStr[2048];  /*Holds minimap2 command to run*/
     char *tmpCStr = 0;
-    char *tmpStatsCStr = "2023-01-17-1239-stats-tmp-01928327456123.tsv";
-    char *tmpFqCStr = "2023-01-17-1239-fastq-tmp-019283274561234.fastq";
+    char tmpStatsCStr[300];  /*Temporary stats file for this bin*/
+    char tmpFqCStr[300];     /*Temporary fastq file for this bin*/
 
     struct samEntry *zeroSam = 0; /*Just to tell no reference struct*/
 
     FILE *tmpStatsFILE = 0; /*Stats keeping*/
     FILE *clustFILE = 0;/*Holds reads that mapped to the consensuses*/
     FILE *otherBinFILE = 0;/*Holds reads that did not map*/
-    FILE *stdinFILE = 0;   /*Holds minimap2 output*/
+    struct samMap samMapST;/*Holds minimap2 or built in mapper output*/
+
+    /*For -read-arena, reads are moved between lists, not files*/
+    long binHeadL = -1;     /*Reads staying in the bin*/
+    long binTailL = -1;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-2 Sec-2: Set defaults & run minimap2
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    /*The mapper needs the bins fastq to match the arena*/
+    if(syncArenaFq(binTree) != 1)
+        return 2;
+
     binTree->numReadsULng = 0;  /*Reseting size after binning*/
     binClust->numReadsULng = 0; /*For counting number reads in bin*/
 
@@ -565,17 +597,32 @@ uint8_t binReadToCon(
         binTree->fqPathCStr
     ); /*Add the file names to the minimap2 command*/
 
-    stdinFILE = popen(minimap2CmdCStr, "r");
+    /*Run minimap2 or the built in mapper (-in-map)*/
+    errUChar =
+        openSamMap(
+            &samMapST,
+            minimap2CmdCStr,
+            binClust->consensusCStr,
+            binTree->fqPathCStr,
+            minStats->inMapBl,
+            0
+        );
 
     /*Remove the old stats data in the structures*/
     blankSamEntry(samStruct);
 
+    if(errUChar & 64)
+    { /*If had a memory allocation error*/
+        closeSamMap(&samMapST);
+        return 64;
+    } /*If had a memory allocation error*/
+
     /*Read First line so can check if errored out*/
-    errUChar = readSamLine(samStruct, stdinFILE);
+    errUChar = readSamMap(samStruct, &samMapST);
 
-    if(*samStruct->samEntryCStr != '@')
+    if(*samStruct->lineCStr != '@')
     { /*If their is no header*/
-        pclose(stdinFILE);
+        closeSamMap(&samMapST);
         return 2; /*Minimap2 failed*/        
     } /*If their is no header*/
 
@@ -590,8 +637,20 @@ uint8_t binReadToCon(
     * Fun-2 Sec-3 Sub-1: open the temporary files & bin stat file
     \******************************************************************/
 
-    tmpStatsFILE = fopen(tmpStatsCStr, "w"); /*Open the temp file*/
-    otherBinFILE = fopen(tmpFqCStr, "w"); /*file for discarded reads*/
+    /*Name temporary files after the bin, so bins can run at once*/
+    tmpCStr = cStrCpInvsDelm(tmpStatsCStr, binTree->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--clust-tmp.bin");
+
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, binTree->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--clust-tmp.fastq");
+
+    if(binTree->arenaST == 0)
+    { /*If not using a read arena*/
+        tmpStatsFILE = fopen(tmpStatsCStr, "wb"); /*Open the temp file*/
+        otherBinFILE = fopen(tmpFqCStr, "w"); /*file for unkept reads*/
+    } /*If not using a read arena*/
 
     /******************************************************************\
     * Fun-2 Sec-3 Sub-2: Build the clusters fastq name
@@ -606,7 +665,15 @@ uint8_t binReadToCon(
     tmpCStr = uCharToCStr(tmpCStr, *clustUChar);
     strcpy(tmpCStr, ".fastq"); /*Add fastq ending to cluster fastq*/
 
-    clustFILE = fopen(binClust->fqPathCStr, "w"); /*make cluster fastq*/
+    if(binTree->arenaST == 0)
+        clustFILE = fopen(binClust->fqPathCStr, "w"); /*cluster fastq*/
+    else
+    { /*Else the cluster is a read list in the bins arena*/
+        binClust->arenaST = binTree->arenaST;
+        binClust->headL = -1;
+        binClust->tailL = -1;
+        binClust->dirtyBl = 1; /*Fastq is written at end of clustBin*/
+    } /*Else the cluster is a read list in the bins arena*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-2 Sec-4: Check each minimap2 alignment to see if keeping
@@ -623,11 +690,11 @@ uint8_t binReadToCon(
     while(errUChar & 1)
     { /*While their is a samfile entry to read in*/
 
-        if(*samStruct->samEntryCStr == '@')
+        if(*samStruct->lineCStr == '@')
         { /*If was a header*/
             /*Read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMap(samStruct, &samMapST);
             continue; /*Is a header line, move to next line in file*/
         } /*If was a header*/
 
@@ -635,7 +702,7 @@ uint8_t binReadToCon(
         { /*If was a secondary or supplementary alignement, ignore*/
             /*Read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMap(samStruct, &samMapST);
             continue; /*Is a header line, move to next line in file*/
         } /*If was a secondary or supplementary alignement, ignore*/
 
@@ -643,13 +710,25 @@ uint8_t binReadToCon(
 
         if(samStruct->flagUSht & 4)
         { /*Make sure the read mapped to something*/
-            samToFq(samStruct, otherBinFILE);
-            printSamStats(samStruct, &headBool, tmpStatsFILE);
+            if(binTree->arenaST != 0)
+                moveArenaRead(
+                    binTree,
+                    &binHeadL,
+                    &binTailL,
+                    samStruct,
+                    1          /*Read stays in the bin*/
+                ); /*Move the read to the bins new read list*/
+            else
+            { /*Else need to print the read to the temporary files*/
+                samToFq(samStruct, otherBinFILE);
+                printStatRec(samStruct, tmpStatsFILE);
+            } /*Else need to print the read to the temporary files*/
+
             ++binTree->numReadsULng; /*Update total scores in bin*/
 
             /*Read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMap(samStruct, &samMapST);
             continue; /*Is a header line, move to next line in file*/
         } /*Make sure the read mapped to something*/
 
@@ -675,8 +754,19 @@ uint8_t binReadToCon(
         ) { /*If read does not belong in this cluster*/
             /*Print out fastq & stats to the temporary files
               These will be made into the bins fastq files later*/
-            samToFq(samStruct, otherBinFILE);
-            printSamStats(samStruct, &headBool, tmpStatsFILE);
+            if(binTree->arenaST != 0)
+                moveArenaRead(
+                    binTree,
+                    &binHeadL,
+                    &binTailL,
+                    samStruct,
+                    1          /*Read stays in the bin*/
+                ); /*Move the read to the bins new read list*/
+            else
+            { /*Else need to print the read to the temporary files*/
+                samToFq(samStruct, otherBinFILE);
+                printStatRec(samStruct, tmpStatsFILE);
+            } /*Else need to print the read to the temporary files*/
                 /*Need the Q-scores for future clustering steps 
                   Other stats not big deal
                   I would like to save the orginal stats, but the order
@@ -688,7 +778,17 @@ uint8_t binReadToCon(
 
         else
         { /*else teh read belongs to the cluster*/
-            samToFq(samStruct, clustFILE); /*Print read to cluster fq*/
+            if(binTree->arenaST != 0)
+                moveArenaRead(
+                    binTree,
+                    &binClust->headL,
+                    &binClust->tailL,
+                    samStruct,
+                    0          /*Read is no longer in the bin*/
+                ); /*Move the read to the clusters read list*/
+            else
+                samToFq(samStruct, clustFILE); /*Print to cluster fq*/
+
             ++binClust->numReadsULng; /*Adding another read to the bin*/
         } /*else teh read belongs to the cluster*/
 
@@ -698,14 +798,31 @@ uint8_t binReadToCon(
 
         /*Read in the next line*/
         blankSamEntry(samStruct);
-        errUChar = readSamLine(samStruct, stdinFILE);
+        errUChar = readSamMap(samStruct, &samMapST);
     } /*While their is a samfile entry to read in*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-2 Sec-5: Clean up and rename files
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    pclose(stdinFILE);
+    closeSamMap(&samMapST);
+
+    if(binTree->arenaST != 0)
+    { /*If using a read arena, only the read lists change*/
+        /*Reads the mapper did not output are dropped, as they would
+          be from the rewritten fastq file*/
+        for(
+            long readL = binTree->headL;
+            readL >= 0;
+            readL = binTree->arenaST->nextAryL[readL]
+        ) arenaHeapRemove(binTree->arenaST, readL);
+
+        binTree->headL = binHeadL;
+        binTree->tailL = binTailL;
+        binTree->dirtyBl = 1;
+        return 1;
+    } /*If using a read arena, only the read lists change*/
+
     fclose(clustFILE);
     fclose(otherBinFILE);
     fclose(tmpStatsFILE);
@@ -716,7 +833,1419 @@ uint8_t binReadToCon(
 
     /*Assign the temporary fastq & stats files to the bin*/
     rename(tmpFqCStr, binTree->fqPathCStr);
-    rename(tmpStatsCStr, binTree->statPathCStr);
+
+    if(binTree->statPathCStr[0] != '\0')
+        rename(tmpStatsCStr, binTree->statPathCStr);
+    else
+        remove(tmpStatsCStr); /*-skip-bin bins have no stats file*/
 
     return 1; /*No errors*/
 } /*binReadToCon*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - binCache to be set up with no open files
+\---------------------------------------------------------------------*/
+uint8_t initBinFILECache(
+    struct binFILECache *binCache /*Cache to set up*/
+) /*Sets up a binFILECache for use with binReads*/
+{ /*initBinFILECache*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: initBinFILECache
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct rlimit fileLimitST;
+
+    binCache->lenFileAryUI = defMaxOpenBins;
+    binCache->numOpenUI = 0;
+    binCache->useCntUL = 0;
+
+    /*Each bin needs two files & I need to leave some files for the
+      minimap2 pipe, the reference, and stdio*/
+    if(getrlimit(RLIMIT_NOFILE, &fileLimitST) == 0)
+    { /*If I could get the open file limit*/
+        if(fileLimitST.rlim_cur != RLIM_INFINITY &&
+           fileLimitST.rlim_cur < 2 * (rlim_t) defMaxOpenBins + 16
+        ) { /*If the limit is lower than my max*/
+            if(fileLimitST.rlim_cur > 18)
+                binCache->lenFileAryUI = (fileLimitST.rlim_cur - 16) / 2;
+            else
+                binCache->lenFileAryUI = 1;
+        } /*If the limit is lower than my max*/
+    } /*If I could get the open file limit*/
+
+    binCache->fileAry =
+        malloc(sizeof(struct binFILEs) * binCache->lenFileAryUI);
+
+    if(binCache->fileAry == 0)
+        return 64;
+
+    return 1;
+} /*initBinFILECache*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Closes: The files of the least recently used bin in binCache
+|    Modifies:
+|        - binCache->fileAry to have the last open bin in the closed
+|          bins position
+\---------------------------------------------------------------------*/
+void closeOldBinFILEs(
+    struct binFILECache *binCache /*Cache to close a bin in*/
+) /*Closes the least recently used bin in a binFILECache*/
+{ /*closeOldBinFILEs*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: Sec-1 Sub-1: closeOldBinFILEs
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint32_t oldUI = 0;    /*Least recently used bin*/
+    struct binFILEs *fileAry = binCache->fileAry;
+
+    if(binCache->numOpenUI == 0)
+        return;
+
+    for(uint32_t uiBin = 1; uiBin < binCache->numOpenUI; ++uiBin)
+    { /*Loop: Find the least recently used bin*/
+        if(fileAry[uiBin].lastUseUL < fileAry[oldUI].lastUseUL)
+            oldUI = uiBin;
+    } /*Loop: Find the least recently used bin*/
+
+    fclose(fileAry[oldUI].fqFILE);
+    fclose(fileAry[oldUI].statFILE);
+
+    --binCache->numOpenUI;
+    fileAry[oldUI] = fileAry[binCache->numOpenUI];
+
+    return;
+} /*closeOldBinFILEs*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 4: if could not open the stats file
+|        - 8: if could not open the fastq file
+|    Modifies:
+|        - fqFILE & statFILE to point to the bins open files
+|        - binCache to have the bins files (may close an old bin)
+\---------------------------------------------------------------------*/
+uint8_t getBinFILEs(
+    struct binFILECache *binCache, /*Cache with the open files*/
+    struct readBin *bin,           /*Bin to get the files for*/
+    FILE **fqFILE,                 /*Set to the bins fastq file*/
+    FILE **statFILE                /*Set to the bins stats file*/
+) /*Gets the open files for a bin, opens them if not open*/
+{ /*getBinFILEs*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: getBinFILEs
+    '    fun-5 sec-1: Variable declerations
+    '    fun-5 sec-2: Check if the bin already has open files
+    '    fun-5 sec-3: Open the stats & fastq file for the bin
+    '    fun-5 sec-4: Add the bin to the cache
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct binFILEs *fileAry = binCache->fileAry;
+
+    ++binCache->useCntUL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-2: Check if the bin already has open files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t uiBin = 0; uiBin < binCache->numOpenUI; ++uiBin)
+    { /*Loop: Check if the bin is open*/
+        if(fileAry[uiBin].bin == bin)
+        { /*If found the bin*/
+            fileAry[uiBin].lastUseUL = binCache->useCntUL;
+            *fqFILE = fileAry[uiBin].fqFILE;
+            *statFILE = fileAry[uiBin].statFILE;
+            return 1;
+        } /*If found the bin*/
+    } /*Loop: Check if the bin is open*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-3: Open the stats & fastq file for the bin
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(binCache->numOpenUI >= binCache->lenFileAryUI)
+        closeOldBinFILEs(binCache); /*Make room for this bin*/
+
+    *statFILE = fopen(bin->statPathCStr, "ab");
+
+    while(*statFILE == 0 && (errno == EMFILE || errno == ENFILE))
+    { /*While at the open file limit*/
+        if(binCache->numOpenUI == 0)
+            break;
+
+        closeOldBinFILEs(binCache);
+        *statFILE = fopen(bin->statPathCStr, "ab");
+    } /*While at the open file limit*/
+
+    if(*statFILE == 0)
+        return 4;
+
+    *fqFILE = fopen(bin->fqPathCStr, "a");
+
+    while(*fqFILE == 0 && (errno == EMFILE || errno == ENFILE))
+    { /*While at the open file limit*/
+        if(binCache->numOpenUI == 0)
+            break;
+
+        closeOldBinFILEs(binCache);
+        *fqFILE = fopen(bin->fqPathCStr, "a");
+    } /*While at the open file limit*/
+
+    if(*fqFILE == 0)
+    { /*If could not open the fastq file*/
+        fclose(*statFILE);
+        *statFILE = 0;
+        return 8;
+    } /*If could not open the fastq file*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-4: Add the bin to the cache
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fileAry[binCache->numOpenUI].bin = bin;
+    fileAry[binCache->numOpenUI].fqFILE = *fqFILE;
+    fileAry[binCache->numOpenUI].statFILE = *statFILE;
+    fileAry[binCache->numOpenUI].lastUseUL = binCache->useCntUL;
+    ++binCache->numOpenUI;
+
+    return 1;
+} /*getBinFILEs*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Closes: Every open file in binCache (flushes output)
+|    Frees: The file array in binCache
+\---------------------------------------------------------------------*/
+void freeBinFILECache(
+    struct binFILECache *binCache /*Cache to close & free*/
+) /*Closes all files in and frees a binFILECache*/
+{ /*freeBinFILECache*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: Sec-1 Sub-1: freeBinFILECache
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    for(uint32_t uiBin = 0; uiBin < binCache->numOpenUI; ++uiBin)
+    { /*Loop: Close all open files*/
+        fclose(binCache->fileAry[uiBin].fqFILE);
+        fclose(binCache->fileAry[uiBin].statFILE);
+    } /*Loop: Close all open files*/
+
+    free(binCache->fileAry);
+    binCache->fileAry = 0;
+    binCache->numOpenUI = 0;
+
+    return;
+} /*freeBinFILECache*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - idSet to be an empty set
+\---------------------------------------------------------------------*/
+uint8_t initIdHashSet(
+    struct idHashSet *idSet /*Set to initialize*/
+) /*Sets up an empty read id set*/
+{ /*initIdHashSet*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: Sec-1 Sub-1: initIdHashSet
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    idSet->numSlotsUL = defIdSetSizeUL;
+    idSet->numIdsUL = 0;
+    idSet->usedBuffUL = 0;
+    idSet->lenBuffUL = defIdSetSizeUL << 5; /*~32 bytes per read id*/
+
+    idSet->slotAryUL = calloc(idSet->numSlotsUL, sizeof(unsigned long));
+    idSet->idBuffCStr = malloc(sizeof(char) * idSet->lenBuffUL);
+
+    if(idSet->slotAryUL == 0 || idSet->idBuffCStr == 0)
+    { /*If had a memory allocation error*/
+        freeIdHashSet(idSet);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    return 1;
+} /*initIdHashSet*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if added the id (or the id was already in the set)
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - idSet to have idCStr (ends at the first white space)
+\---------------------------------------------------------------------*/
+uint8_t addIdToHashSet(
+    struct idHashSet *idSet, /*Set to add the read id to*/
+    char *idCStr             /*Read id to add*/
+) /*Adds a read id to a read id set*/
+{ /*addIdToHashSet*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: addIdToHashSet
+    '   fun-8 sec-1: Variable declerations
+    '   fun-8 sec-2: Grow the slot array if over half full
+    '   fun-8 sec-3: Copy the id to the id buffer
+    '   fun-8 sec-4: Add the id to the slot array
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long lenIdUL = 0;
+    unsigned long slotUL = 0;
+    unsigned long *newSlotAryUL = 0;
+    uint64_t hashULng = 0;
+    char *tmpCStr = 0;
+
+    if(findIdInHashSet(idSet, idCStr))
+        return 1; /*Already in the set*/
+
+    while(idCStr[lenIdUL] > 32)
+        ++lenIdUL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Grow the slot array if over half full
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if((idSet->numIdsUL + 1) << 1 > idSet->numSlotsUL)
+    { /*If need more slots*/
+        newSlotAryUL =
+            calloc(idSet->numSlotsUL << 1, sizeof(unsigned long));
+
+        if(newSlotAryUL == 0)
+            return 64;
+
+        for(unsigned long ulOld = 0; ulOld < idSet->numSlotsUL; ++ulOld)
+        { /*Loop: Move the ids to the new slots*/
+            if(idSet->slotAryUL[ulOld] == 0)
+                continue;
+
+            hashULng = 14695981039346656037ULL; /*FNV-1a*/
+            tmpCStr = idSet->idBuffCStr + idSet->slotAryUL[ulOld] - 1;
+
+            while(*tmpCStr != '\0')
+            { /*Loop: Hash the id*/
+                hashULng ^= (uint8_t) *tmpCStr;
+                hashULng *= 1099511628211ULL;
+                ++tmpCStr;
+            } /*Loop: Hash the id*/
+
+            slotUL = hashULng & ((idSet->numSlotsUL << 1) - 1);
+
+            while(newSlotAryUL[slotUL] != 0)
+                slotUL = (slotUL + 1) & ((idSet->numSlotsUL << 1) - 1);
+
+            newSlotAryUL[slotUL] = idSet->slotAryUL[ulOld];
+        } /*Loop: Move the ids to the new slots*/
+
+        free(idSet->slotAryUL);
+        idSet->slotAryUL = newSlotAryUL;
+        idSet->numSlotsUL <<= 1;
+    } /*If need more slots*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Copy the id to the id buffer
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(idSet->usedBuffUL + lenIdUL + 1 > idSet->lenBuffUL)
+    { /*If need a bigger id buffer*/
+        while(idSet->usedBuffUL + lenIdUL + 1 > idSet->lenBuffUL)
+            idSet->lenBuffUL <<= 1;
+
+        tmpCStr = realloc(idSet->idBuffCStr, idSet->lenBuffUL);
+
+        if(tmpCStr == 0)
+            return 64;
+
+        idSet->idBuffCStr = tmpCStr;
+    } /*If need a bigger id buffer*/
+
+    tmpCStr = idSet->idBuffCStr + idSet->usedBuffUL;
+    hashULng = 14695981039346656037ULL; /*FNV-1a*/
+
+    for(unsigned long ulChar = 0; ulChar < lenIdUL; ++ulChar)
+    { /*Loop: Copy & hash the id*/
+        tmpCStr[ulChar] = idCStr[ulChar];
+        hashULng ^= (uint8_t) idCStr[ulChar];
+        hashULng *= 1099511628211ULL;
+    } /*Loop: Copy & hash the id*/
+
+    tmpCStr[lenIdUL] = '\0';
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-4: Add the id to the slot array
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    slotUL = hashULng & (idSet->numSlotsUL - 1);
+
+    while(idSet->slotAryUL[slotUL] != 0)
+        slotUL = (slotUL + 1) & (idSet->numSlotsUL - 1);
+
+    idSet->slotAryUL[slotUL] = idSet->usedBuffUL + 1; /*0 is empty*/
+    idSet->usedBuffUL += lenIdUL + 1;
+    ++idSet->numIdsUL;
+
+    return 1;
+} /*addIdToHashSet*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if idCStr (ends at the first white space) is in idSet
+|        - 0: if idCStr is not in idSet
+\---------------------------------------------------------------------*/
+uint8_t findIdInHashSet(
+    struct idHashSet *idSet, /*Set to search*/
+    char *idCStr             /*Read id to find*/
+) /*Checks if a read id is in a read id set*/
+{ /*findIdInHashSet*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: Sec-1 Sub-1: findIdInHashSet
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t hashULng = 14695981039346656037ULL; /*FNV-1a*/
+    unsigned long slotUL = 0;
+    char *setIdCStr = 0;
+    char *tmpCStr = idCStr;
+
+    if(idSet->numIdsUL == 0)
+        return 0;
+
+    while(*tmpCStr > 32)
+    { /*Loop: Hash the id*/
+        hashULng ^= (uint8_t) *tmpCStr;
+        hashULng *= 1099511628211ULL;
+        ++tmpCStr;
+    } /*Loop: Hash the id*/
+
+    slotUL = hashULng & (idSet->numSlotsUL - 1);
+
+    while(idSet->slotAryUL[slotUL] != 0)
+    { /*Loop: Check each id with the same hash*/
+        setIdCStr = idSet->idBuffCStr + idSet->slotAryUL[slotUL] - 1;
+        tmpCStr = idCStr;
+
+        while(*setIdCStr != '\0' && *setIdCStr == *tmpCStr)
+        { /*Loop: Compare the ids*/
+            ++setIdCStr;
+            ++tmpCStr;
+        } /*Loop: Compare the ids*/
+
+        if(*setIdCStr == '\0' && *tmpCStr <= 32)
+            return 1;
+
+        slotUL = (slotUL + 1) & (idSet->numSlotsUL - 1);
+    } /*Loop: Check each id with the same hash*/
+
+    return 0;
+} /*findIdInHashSet*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Frees: The memory in idSet (not idSet itself)
+\---------------------------------------------------------------------*/
+void freeIdHashSet(
+    struct idHashSet *idSet /*Set to free*/
+) /*Frees the memory used by a read id set*/
+{ /*freeIdHashSet*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: Sec-1 Sub-1: freeIdHashSet
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(idSet->slotAryUL);
+    free(idSet->idBuffCStr);
+
+    idSet->slotAryUL = 0;
+    idSet->idBuffCStr = 0;
+    idSet->numSlotsUL = 0;
+    idSet->numIdsUL = 0;
+    idSet->lenBuffUL = 0;
+    idSet->usedBuffUL = 0;
+
+    return;
+} /*freeIdHashSet*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - samAry to have trimmed & scored entries
+|        - keepAryUC to be 1 for entries that are kept, else 0
+|    Returns: 0
+\---------------------------------------------------------------------*/
+void * binReadsThread(
+    void *parmST /*binReadsThreadST structer with entries to score*/
+) /*Trims, scores, & checks a set of sam entries for binReads*/
+{ /*binReadsThread*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-11 TOC: Sec-1 Sub-1: binReadsThread
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct binReadsThreadST *threadST = (struct binReadsThreadST *) parmST;
+    struct samEntry *samST = 0;
+    struct samEntry *samZeroStruct = 0; /*Not using reference*/
+    uint8_t zeroUChar = 0;
+
+    for(unsigned long ulSam = 0; ulSam < threadST->numSamUL; ++ulSam)
+    { /*Loop: Score each sam entry*/
+        samST = &threadST->samAry[ulSam];
+        threadST->keepAryUC[ulSam] = 0;
+
+        if((threadST->trimBl & 1) && trimSamEntry(samST) != 0)
+            continue; /*No sequence to trim*/
+
+        findQScores(samST); /*Find the Q-scores*/
+
+        scoreAln(
+            threadST->minStats, /*thesholds for read to reference map*/
+            samST,
+            samZeroStruct, /*Not using reference for scoring*/ 
+            &zeroUChar,    /*Not using reference, so no Q-score*/
+            &zeroUChar     /*Not using reference, so no deletions*/
+        );
+
+        if(
+             checkRead(threadST->minStats, samST) != 0
+          && (checkIfKeepRead(threadST->minStats, samST) & 1)
+        ) threadST->keepAryUC[ulSam] = 1;
+    } /*Loop: Score each sam entry*/
+
+    return 0;
+} /*binReadsThread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 2: if could not open or make the bins files
+|    Modifies:
+|        - The fastq & stats file in bin to not have reads in idSet
+|        - bin->numReadsULng to not count the removed reads
+\---------------------------------------------------------------------*/
+uint8_t rmIdsFromBin(
+    struct readBin *bin,    /*Bin to remove reads from*/
+    struct idHashSet *idSet /*Read ids to remove*/
+) /*Removes reads in a read id set from a bins fastq & stats file*/
+{ /*rmIdsFromBin*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-12 TOC: rmIdsFromBin
+    '   fun-12 sec-1: Variable declerations
+    '   fun-12 sec-2: Open the bins files & temporary files
+    '   fun-12 sec-3: Copy the reads not in idSet
+    '   fun-12 sec-4: Replace the bins files with the temporary files
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char buffCStr[1024];
+    char tmpFqCStr[300];
+    char tmpStatsCStr[300];
+    char *tmpCStr = 0;
+    char keepBl = 0;
+    char lineEndBl = 0;   /*1: At the end of a line*/
+    uint8_t lineUC = 0;
+    struct statRec recST;
+
+    FILE *fqFILE = 0;
+    FILE *statFILE = 0;
+    FILE *outFqFILE = 0;
+    FILE *outStatFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-2: Open the bins files & temporary files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, bin->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--sup-tmp.fastq");
+
+    tmpCStr = cStrCpInvsDelm(tmpStatsCStr, bin->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--sup-tmp.bin");
+
+    fqFILE = fopen(bin->fqPathCStr, "r");
+    statFILE = fopen(bin->statPathCStr, "rb");
+    outFqFILE = fopen(tmpFqCStr, "w");
+    outStatFILE = fopen(tmpStatsCStr, "wb");
+
+    if(!fqFILE || !statFILE || !outFqFILE || !outStatFILE)
+    { /*If could not open a file*/
+        if(fqFILE) fclose(fqFILE);
+        if(statFILE) fclose(statFILE);
+        if(outFqFILE) fclose(outFqFILE);
+        if(outStatFILE) fclose(outStatFILE);
+
+        remove(tmpFqCStr);
+        remove(tmpStatsCStr);
+        return 2;
+    } /*If could not open a file*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-3: Copy the reads not in idSet
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*The stats file has one record per read in the same order as the
+      fastq file (four lines per read)*/
+    keepBl = 1;
+    lineEndBl = 1; /*Start on the first reads header*/
+    lineUC = 0;
+
+    while(fgets(buffCStr, 1024, fqFILE))
+    { /*Loop: Copy each line*/
+        if(lineEndBl && lineUC == 0)
+        { /*If on a header, check the reads id & copy its stats*/
+            keepBl = !findIdInHashSet(idSet, buffCStr + 1);
+
+            if((readStatRec(statFILE, &recST) & 1) && keepBl)
+                fwrite(&recST, sizeof(struct statRec), 1, outStatFILE);
+
+            if(!keepBl)
+                --bin->numReadsULng;
+        } /*If on a header, check the reads id & copy its stats*/
+
+        if(keepBl)
+            fputs(buffCStr, outFqFILE);
+
+        tmpCStr = buffCStr;
+
+        while(*tmpCStr != '\0')
+            ++tmpCStr;
+
+        /*Lines longer than the buffer take more than one fgets*/
+        lineEndBl = (tmpCStr != buffCStr && tmpCStr[-1] == '\n');
+
+        if(lineEndBl)
+            lineUC = (lineUC + 1) & 3; /*Lines 0 to 3 of the read*/
+    } /*Loop: Copy each line*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-4: Replace the bins files with the temporary files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fclose(fqFILE);
+    fclose(statFILE);
+    fclose(outFqFILE);
+    fclose(outStatFILE);
+
+    remove(bin->fqPathCStr);
+    remove(bin->statPathCStr);
+    rename(tmpFqCStr, bin->fqPathCStr);
+    rename(tmpStatsCStr, bin->statPathCStr);
+
+    return 1;
+} /*rmIdsFromBin*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o errUC to hold error output (same as binReads)
+|   - Creates:
+|     o A fastq file with reads for each bin
+|     o A stats file with the stats from scoreReads for each bin
+|   - Returns:
+|     o Tree of bins that the reads mapped into
+|   - Note:
+|     o minimap2 gets all threads. Reads are trimmed & scored on
+|       threadsCStr threads, while the main thread reads the next
+|       batch of entries & prints the last batch to the bins.
+|     o Reads with supplementary alignments are found by read id, so
+|       they are removed from the bins after all reads are binned.
+\---------------------------------------------------------------------*/
+struct readBin * binReadsThreaded(
+    char *fqPathCStr,        /*Fastq file to bin*/
+    char *refsPathCStr,      /*References to bin with*/
+    char *prefixCStr,        /*Prefix to name the bins with*/
+    char *threadsCStr,       /*Number of threads to use*/
+    char rmSupAlnBl,         /*Remove supplementary alignments*/
+    char trimBl,             /*1: trim reads, 0: do not*/
+    struct minAlnStats *minStats,
+    unsigned char *errUC     /*Reports any errors*/
+) /*Bin reads with a set of references, using multiple threads*/
+{ /*binReadsThreaded*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-13 TOC: binReadsThreaded
+    '   fun-13 sec-1: Variable declerations
+    '   fun-13 sec-2: Allocate memory for the batches & threads
+    '   fun-13 sec-3: Run minimap2 & check for the header
+    '   fun-13 sec-4: Bin reads a batch at a time
+    '   fun-13 sec-5: Remove reads with supplementary alignments
+    '   fun-13 sec-6: Clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char minimap2CMDCStr[2048];
+    char binFileCStr[256];
+    char statFileCStr[256];
+    char refIdCStr[256];
+    char *tmpCStr = 0;
+    uint8_t funErrUC = 0;
+    char mapDoneBl = 0;    /*1: No more entries from minimap2*/
+    char scoringBl = 0;    /*1: Threads are scoring a batch*/
+
+    uint32_t threadsUI = 0;
+    uint32_t numStartedUI = 0;
+    unsigned long batchUL = 0;     /*Batch being read in*/
+    unsigned long numSamAryUL[2];  /*Number entries in each batch*/
+    unsigned long perThreadUL = 0; /*Entries each thread scores*/
+
+    struct samEntry *samAry[2];    /*Batch read in & batch scored*/
+    uint8_t *keepAryUC[2];         /*Marks entries kept in each batch*/
+    struct samEntry *samST = 0;
+
+    pthread_t *threadsAry = 0;
+    struct binReadsThreadST *threadAryST = 0;
+
+    struct readBin *tmpBin = 0;
+    struct readBin *binTree = 0;
+    struct readBin **binAry = 0;   /*All bins, for removing chimeras*/
+    struct readBin **tmpBinAry = 0;
+    unsigned long numBinsUL = 0;
+    unsigned long lenBinAryUL = 0;
+
+    struct readBinStack binStack[200]; /*Stack for read bin AVL tree*/
+    struct samMap samMapST; /*minimap2 or built in mapper output*/
+    struct binFILECache binCache; /*Keeps bin files open between reads*/
+    struct idHashSet supIdSet;    /*Reads with supplementary alignments*/
+
+    FILE *fqBinFILE = 0;
+    FILE *statFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-2: Allocate memory for the batches & threads
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    *errUC = 0;
+    cStrToUInt(threadsCStr, &threadsUI);
+
+    if(threadsUI < 1)
+        threadsUI = 1;
+
+    if(!(initIdHashSet(&supIdSet) & 1))
+    { /*If had a memory allocation error*/
+        *errUC = 64;
+        return 0;
+    } /*If had a memory allocation error*/
+
+    samAry[0] = calloc(defBinBatchUI << 1, sizeof(struct samEntry));
+    keepAryUC[0] = malloc(sizeof(uint8_t) * (defBinBatchUI << 1));
+    threadsAry = malloc(sizeof(pthread_t) * threadsUI);
+    threadAryST = malloc(sizeof(struct binReadsThreadST) * threadsUI);
+
+    if(samAry[0] == 0 || keepAryUC[0] == 0 || threadsAry == 0 ||
+       threadAryST == 0 || !(initBinFILECache(&binCache) & 1)
+    ) { /*If had a memory allocation error*/
+        free(samAry[0]);
+        free(keepAryUC[0]);
+        free(threadsAry);
+        free(threadAryST);
+        freeIdHashSet(&supIdSet);
+        *errUC = 64;
+        return 0;
+    } /*If had a memory allocation error*/
+
+    samAry[1] = samAry[0] + defBinBatchUI;
+    keepAryUC[1] = keepAryUC[0] + defBinBatchUI;
+    numSamAryUL[0] = 0;
+    numSamAryUL[1] = 0;
+
+    for(unsigned long ulSam = 0; ulSam < defBinBatchUI << 1; ++ulSam)
+        initSamEntry(&samAry[0][ulSam]);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-3: Run minimap2 & check for the header
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Chimeras are found by read id, so minimap2 can use all threads*/
+    tmpCStr = cStrCpInvsDelm(minimap2CMDCStr, minimap2CMD);
+    tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
+    tmpCStr = cpParmAndArg(tmpCStr, refsPathCStr, fqPathCStr);
+
+    funErrUC =
+        openSamMap(
+            &samMapST,
+            minimap2CMDCStr,
+            refsPathCStr,
+            fqPathCStr,
+            minStats->inMapBl,
+            0
+        );
+
+    /*The threads score a batch while the next batch is read in*/
+    samMapST.copyLineBl = 1;
+
+    if(!(funErrUC & 64))
+        funErrUC = readSamMap(&samAry[0][0], &samMapST);
+
+    if(funErrUC & 64)
+        *errUC = 64;
+    else if(!(funErrUC & 1) || *samAry[0][0].lineCStr != '@')
+        *errUC = 2; /*minimap2 errored out (no header)*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-4: Bin reads a batch at a time
+    ^   fun-13 sec-4 sub-1: Read in the next batch of primary entries
+    ^   fun-13 sec-4 sub-2: Wait for the last batch & start this batch
+    ^   fun-13 sec-4 sub-3: Print the kept reads in the last batch
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*The main thread reads a batch while the threads score the last
+      batch. Reads are printed in the order minimap2 output them*/
+    while(*errUC == 0)
+    { /*Loop: Bin reads a batch at a time*/
+
+        /**************************************************************\
+        * Fun-13 Sec-4 Sub-1: Read in the next batch of primary entries
+        \**************************************************************/
+
+        numSamAryUL[batchUL] = 0;
+
+        while(!mapDoneBl && numSamAryUL[batchUL] < defBinBatchUI)
+        { /*Loop: Read in the next batch*/
+            samST = &samAry[batchUL][numSamAryUL[batchUL]];
+            blankSamEntry(samST);
+            funErrUC = readSamMap(samST, &samMapST);
+
+            if(!(funErrUC & 1))
+            { /*If at the end of the file or had an error*/
+                mapDoneBl = 1;
+
+                if(funErrUC & 64)
+                    *errUC = 64;
+
+                break;
+            } /*If at the end of the file or had an error*/
+
+            if(*samST->lineCStr == '@')
+                continue; /*Header*/
+
+            if((rmSupAlnBl & 1) && (samST->flagUSht & 2048))
+            { /*If is a supplemental alignment & removing chimeras*/
+                if(addIdToHashSet(&supIdSet, samST->queryCStr) & 64)
+                { /*If had a memory allocation error*/
+                    mapDoneBl = 1;
+                    *errUC = 64;
+                    break;
+                } /*If had a memory allocation error*/
+            } /*If is a supplemental alignment & removing chimeras*/
+
+            if(samST->flagUSht & (2048 | 256 | 4))
+                continue; /*supplemental, secondary, or no map*/
+
+            ++numSamAryUL[batchUL];
+        } /*Loop: Read in the next batch*/
+
+        /**************************************************************\
+        * Fun-13 Sec-4 Sub-2: Wait for the last batch & start this batch
+        \**************************************************************/
+
+        for(uint32_t uiThread = 0; uiThread < numStartedUI; ++uiThread)
+            pthread_join(threadsAry[uiThread], 0);
+
+        numStartedUI = 0;
+        scoringBl = 0;
+
+        if(*errUC & 64)
+            break;
+
+        if(numSamAryUL[batchUL] > 0)
+        { /*If have entries to score*/
+            perThreadUL =
+                (numSamAryUL[batchUL] + threadsUI - 1) / threadsUI;
+
+            for(uint32_t uiThread = 0; uiThread < threadsUI; ++uiThread)
+            { /*Loop: Start the threads*/
+                if(perThreadUL * uiThread >= numSamAryUL[batchUL])
+                    break; /*No entries left for this thread*/
+
+                threadAryST[uiThread].samAry =
+                    samAry[batchUL] + perThreadUL * uiThread;
+                threadAryST[uiThread].keepAryUC =
+                    keepAryUC[batchUL] + perThreadUL * uiThread;
+                threadAryST[uiThread].numSamUL = perThreadUL;
+
+                if(perThreadUL*(uiThread + 1) > numSamAryUL[batchUL])
+                    threadAryST[uiThread].numSamUL =
+                        numSamAryUL[batchUL] - perThreadUL * uiThread;
+
+                threadAryST[uiThread].trimBl = trimBl;
+                threadAryST[uiThread].minStats = minStats;
+
+                if(
+                    pthread_create(
+                        &threadsAry[numStartedUI],
+                        0,
+                        binReadsThread,
+                        &threadAryST[uiThread]
+                    ) != 0
+                ) binReadsThread(&threadAryST[uiThread]); /*Score here*/
+                else
+                    ++numStartedUI;
+            } /*Loop: Start the threads*/
+
+            scoringBl = 1;
+        } /*If have entries to score*/
+
+        /**************************************************************\
+        * Fun-13 Sec-4 Sub-3: Print the kept reads in the last batch
+        \**************************************************************/
+
+        batchUL = !batchUL; /*Last batch (is scored)*/
+
+        for(unsigned long ulSam=0; ulSam < numSamAryUL[batchUL]; ++ulSam)
+        { /*Loop: Print each kept read in the last batch*/
+            if(!keepAryUC[batchUL][ulSam])
+                continue;
+
+            samST = &samAry[batchUL][ulSam];
+
+            if(findIdInHashSet(&supIdSet, samST->queryCStr))
+                continue; /*Already know read has a supplemental*/
+
+            /*Grab the reference id*/
+            cStrCpInvsDelm(refIdCStr, samST->refCStr);
+
+            /*Build the bin file name*/
+            tmpCStr = cStrCpInvsDelm(binFileCStr, prefixCStr);
+            tmpCStr = cStrCpInvsDelm(tmpCStr, "--");
+            tmpCStr = cStrCpInvsDelm(tmpCStr, refIdCStr);
+            cStrCpInvsDelm(tmpCStr, ".fastq"); /*Add in fastq ending*/
+
+            tmpCStr = cStrCpInvsDelm(statFileCStr, prefixCStr);
+            tmpCStr = cStrCpInvsDelm(tmpCStr, "--");
+            tmpCStr = cStrCpInvsDelm(tmpCStr, refIdCStr);
+            cStrCpInvsDelm(tmpCStr, "--stats.bin");/*stats file ending*/
+
+            tmpBin =
+                insBinIntoTree(
+                    refIdCStr,
+                    binFileCStr,       /*Fastq file for the bin*/
+                    statFileCStr,      /*Stats file for the bin*/
+                    &binTree, /*Root of bin tree*/
+                    binStack  /*Stack to use in rebalencing tree*/
+            ); /*Find or add bin to tree*/
+
+            if(tmpBin == 0)
+            { /*If a memory error occured*/
+                *errUC = 64;
+                break;
+            } /*If a memory error occured*/
+
+            if(tmpBin->numReadsULng == 1)
+            { /*If this is a new bin*/
+                if(numBinsUL >= lenBinAryUL)
+                { /*If need more room to store the bins*/
+                    lenBinAryUL += 64;
+                    tmpBinAry =
+                        realloc(
+                            binAry,
+                            sizeof(struct readBin *) * lenBinAryUL
+                        );
+
+                    if(tmpBinAry == 0)
+                    { /*If had a memory allocation error*/
+                        *errUC = 64;
+                        break;
+                    } /*If had a memory allocation error*/
+
+                    binAry = tmpBinAry;
+                } /*If need more room to store the bins*/
+
+                binAry[numBinsUL] = tmpBin;
+                ++numBinsUL;
+            } /*If this is a new bin*/
+
+            funErrUC =
+                getBinFILEs(&binCache, tmpBin, &fqBinFILE, &statFILE);
+
+            if(!(funErrUC & 1))
+            { /*If can not open the stats or fastq file*/
+                *errUC = funErrUC; /*4: stats file, 8: fastq file*/
+                break;
+            } /*If can not open the stats or fastq file*/
+
+            samToFq(samST, fqBinFILE); /*Print sequence to fastq file*/
+            printStatRec(samST, statFILE);
+        } /*Loop: Print each kept read in the last batch*/
+
+        if(*errUC != 0)
+            break;
+
+        if(!scoringBl && mapDoneBl)
+            break; /*Nothing left to score or print*/
+    } /*Loop: Bin reads a batch at a time*/
+
+    for(uint32_t uiThread = 0; uiThread < numStartedUI; ++uiThread)
+        pthread_join(threadsAry[uiThread], 0);
+
+    closeSamMap(&samMapST);
+    freeBinFILECache(&binCache); /*Flush & close bin files*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-5: Remove reads with supplementary alignments
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Supplemental alignments found after their read was printed*/
+    if(*errUC == 0 && supIdSet.numIdsUL > 0)
+    { /*If have reads with supplemental alignments*/
+        for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+        { /*Loop: Remove chimeric reads from each bin*/
+            if(!(rmIdsFromBin(binAry[ulBin], &supIdSet) & 1))
+            { /*If could not rewrite the bin*/
+                *errUC = 4;
+                break;
+            } /*If could not rewrite the bin*/
+        } /*Loop: Remove chimeric reads from each bin*/
+    } /*If have reads with supplemental alignments*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-6: Clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(unsigned long ulSam = 0; ulSam < defBinBatchUI << 1; ++ulSam)
+        freeStackSamEntry(&samAry[0][ulSam]);
+
+    free(samAry[0]);
+
+    free(keepAryUC[0]);
+    free(threadsAry);
+    free(threadAryST);
+    free(binAry);
+    freeIdHashSet(&supIdSet);
+
+    if(*errUC != 0)
+    { /*If had an error*/
+        freeBinTree(&binTree);
+        return 0;
+    } /*If had an error*/
+
+    *errUC = 1;
+    return binTree;
+} /*binReadsThreaded*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 2: for file errors (or the mapper failed)
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - fastq of each cluster in binTree->rightChild to hold the
+|          reads that mapped best to the clusters consensus
+|        - fastq & stats file in binTree to hold the reads that did not
+|          map to any consensus
+|        - numReadsULng in binTree & each cluster
+|    Note:
+|        - Uses the fastq files, so any read arena should be written
+|          out (doneFqArena) first
+\---------------------------------------------------------------------*/
+uint8_t binReadsToCons(
+    struct readBin *binTree,        /*Bin with the list of clusters*/
+    struct samEntry *samStruct,     /*To hold temporary input*/
+    struct minAlnStats *minStats,   /*Min stats needed to keep a read*/
+    char *threadsCStr            /*Number threads to use with Minimap2*/
+) /*Maps a bins reads to all its consensuses at once and assigns each
+    read to the consensus it mapped best to*/
+{ /*binReadsToCons*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-14 TOC: binReadsToCons
+    '    fun-14 sec-1: Variable declerations
+    '    fun-14 sec-2: Get the list of clusters in the bin
+    '    fun-14 sec-3: Make the consensus & read files to map
+    '    fun-14 sec-4: Run minimap2 & open the output files
+    '    fun-14 sec-5: Assign each read to its best consensus
+    '    fun-14 sec-6: Clean up and rename files
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUChar = 0;
+    uint8_t oneUChar = 1;
+    uint8_t zeroUChar = 0;
+    uint32_t clustUI = 0;     /*Cluster a read mapped to*/
+    uint32_t numClustUI = 0;  /*Number of clusters in the bin*/
+    size_t lenBuffST = 0;     /*Number of bytes read in while copying*/
+    int lastC = '\n';         /*Last character copied to a file*/
+
+    char minimap2CmdCStr[2048];  /*Holds minimap2 command to run*/
+    char *tmpCStr = 0;
+    char buffCStr[4096];     /*Buffer for copying files*/
+    char tmpStatsCStr[300];  /*Temporary stats file for this bin*/
+    char tmpFqCStr[300];     /*Temporary fastq file for this bin*/
+    char consFaCStr[300];    /*All consensuses in the bin*/
+    char poolFqCStr[300];    /*All reads in the bin & its clusters*/
+
+    struct samEntry *zeroSam = 0; /*Just to tell no reference struct*/
+    struct readBin *clustST = 0;
+    struct readBin **clustAryST = 0; /*Clusters in the bin*/
+
+    FILE *inFILE = 0;
+    FILE *outFILE = 0;
+    FILE *tmpStatsFILE = 0; /*Stats keeping*/
+    FILE *otherBinFILE = 0;/*Holds reads that did not map*/
+    FILE **clustAryFILE = 0;/*Fastq file for each cluster*/
+    struct samMap samMapST;/*Holds minimap2 or built in mapper output*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-2: Get the list of clusters in the bin
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(
+        clustST = binTree->rightChild;
+        clustST != 0;
+        clustST = clustST->rightChild
+    ) ++numClustUI;
+
+    if(numClustUI == 0)
+        return 1; /*Nothing to assign reads to*/
+
+    clustAryST = malloc(sizeof(struct readBin *) * numClustUI);
+    clustAryFILE = calloc(numClustUI, sizeof(FILE *));
+
+    if(clustAryST == 0 || clustAryFILE == 0)
+    { /*If had a memory allocation error*/
+        free(clustAryST);
+        free(clustAryFILE);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    clustST = binTree->rightChild;
+
+    for(uint32_t uiClust = 0; uiClust < numClustUI; ++uiClust)
+    { /*Loop: Get each cluster in the bin*/
+        clustAryST[uiClust] = clustST;
+        clustST = clustST->rightChild;
+    } /*Loop: Get each cluster in the bin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-3: Make the consensus & read files to map
+    ^    fun-14 sec-3 sub-1: Build the temporary file names
+    ^    fun-14 sec-3 sub-2: Copy the consensuses to one fasta
+    ^    fun-14 sec-3 sub-3: Pool the bins & clusters reads
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Fun-14 Sec-3 Sub-1: Build the temporary file names
+    \******************************************************************/
+
+    /*Name temporary files after the bin, so bins can run at once*/
+    tmpCStr = cStrCpInvsDelm(tmpStatsCStr, binTree->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--clust-tmp.bin");
+
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, binTree->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--clust-tmp.fastq");
+
+    tmpCStr = cStrCpInvsDelm(consFaCStr, binTree->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--cons-tmp.fasta");
+
+    tmpCStr = cStrCpInvsDelm(poolFqCStr, binTree->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--pool-tmp.fastq");
+
+    /******************************************************************\
+    * Fun-14 Sec-3 Sub-2: Copy the consensuses to one fasta
+    \******************************************************************/
+
+    outFILE = fopen(consFaCStr, "w");
+
+    if(outFILE == 0)
+    { /*If could not make the consensus file*/
+        free(clustAryST);
+        free(clustAryFILE);
+        return 2;
+    } /*If could not make the consensus file*/
+
+    for(uint32_t uiClust = 0; uiClust < numClustUI; ++uiClust)
+    { /*Loop: Copy each consensus into the consensus file*/
+        inFILE = fopen(clustAryST[uiClust]->consensusCStr, "r");
+
+        if(inFILE == 0)
+        { /*If could not open the consensus*/
+            errUChar = 2;
+            break;
+        } /*If could not open the consensus*/
+
+        /*The cluster index is the reference id, so the mapper output
+          can be traced back to the cluster*/
+        fprintf(outFILE, ">%u\n", uiClust);
+
+        /*Skip the header of the consensus*/
+        while((lastC = fgetc(inFILE)) != EOF && lastC != '\n') ;
+
+        lastC = '\n';
+
+        while((lenBuffST = fread(buffCStr,1,sizeof(buffCStr),inFILE)))
+        { /*Loop: Copy the consensus sequence*/
+            fwrite(buffCStr, 1, lenBuffST, outFILE);
+            lastC = buffCStr[lenBuffST - 1];
+        } /*Loop: Copy the consensus sequence*/
+
+        if(lastC != '\n')
+            fputc('\n', outFILE); /*So the next header is on its line*/
+
+        fclose(inFILE);
+    } /*Loop: Copy each consensus into the consensus file*/
+
+    fclose(outFILE);
+
+    if(errUChar & 2)
+    { /*If could not open a consensus*/
+        remove(consFaCStr);
+        free(clustAryST);
+        free(clustAryFILE);
+        return 2;
+    } /*If could not open a consensus*/
+
+    /******************************************************************\
+    * Fun-14 Sec-3 Sub-3: Pool the bins & clusters reads
+    \******************************************************************/
+
+    outFILE = fopen(poolFqCStr, "w");
+
+    if(outFILE == 0)
+    { /*If could not make the pooled fastq file*/
+        remove(consFaCStr);
+        free(clustAryST);
+        free(clustAryFILE);
+        return 2;
+    } /*If could not make the pooled fastq file*/
+
+    /*uiClust == numClustUI is the bins left over reads*/
+    for(uint32_t uiClust = 0; uiClust <= numClustUI; ++uiClust)
+    { /*Loop: Copy each fastq file to the pooled fastq*/
+        if(uiClust < numClustUI)
+            inFILE = fopen(clustAryST[uiClust]->fqPathCStr, "r");
+        else
+            inFILE = fopen(binTree->fqPathCStr, "r");
+
+        if(inFILE == 0)
+            continue; /*The bin may have no left over reads*/
+
+        while((lenBuffST = fread(buffCStr,1,sizeof(buffCStr),inFILE)))
+            fwrite(buffCStr, 1, lenBuffST, outFILE);
+
+        fclose(inFILE);
+    } /*Loop: Copy each fastq file to the pooled fastq*/
+
+    fclose(outFILE);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-4: Run minimap2 & open the output files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    tmpCStr = cStrCpInvsDelm(minimap2CmdCStr, minimap2CMD);
+    tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
+    cpParmAndArg(tmpCStr, consFaCStr, poolFqCStr);
+
+    /*Run minimap2 or the built in mapper (-in-map). minimap2CMD has
+      --secondary=no, so the primary alignment is the best consensus*/
+    errUChar =
+        openSamMap(
+            &samMapST,
+            minimap2CmdCStr,
+            consFaCStr,
+            poolFqCStr,
+            minStats->inMapBl,
+            0
+        );
+
+    /*Remove the old stats data in the structures*/
+    blankSamEntry(samStruct);
+
+    if(errUChar & 64)
+    { /*If had a memory allocation error*/
+        closeSamMap(&samMapST);
+        remove(consFaCStr);
+        remove(poolFqCStr);
+        free(clustAryST);
+        free(clustAryFILE);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /*Read First line so can check if errored out*/
+    errUChar = readSamMap(samStruct, &samMapST);
+
+    if(*samStruct->lineCStr != '@')
+    { /*If their is no header*/
+        closeSamMap(&samMapST);
+        remove(consFaCStr);
+        remove(poolFqCStr);
+        free(clustAryST);
+        free(clustAryFILE);
+        return 2; /*Minimap2 failed, the old files are still good*/
+    } /*If their is no header*/
+
+    tmpStatsFILE = fopen(tmpStatsCStr, "wb"); /*Open the temp file*/
+    otherBinFILE = fopen(tmpFqCStr, "w"); /*file for unkept reads*/
+
+    if(tmpStatsFILE == 0 || otherBinFILE == 0)
+        errUChar = 2;
+
+    for(uint32_t uiClust = 0; uiClust < numClustUI; ++uiClust)
+    { /*Loop: Open the clusters temporary fastq files*/
+        /*The old fastq files are kept until all reads are assigned*/
+        clustST = clustAryST[uiClust];
+        tmpCStr = cStrCpInvsDelm(buffCStr, clustST->fqPathCStr);
+        cStrCpInvsDelm(tmpCStr, "-tmp");
+
+        clustAryFILE[uiClust] = fopen(buffCStr, "w");
+
+        if(clustAryFILE[uiClust] == 0)
+            errUChar = 2;
+    } /*Loop: Open the clusters temporary fastq files*/
+
+    if(errUChar & 1)
+    { /*If have all files, reset the read counts for the new reads*/
+        binTree->numReadsULng = 0;
+
+        for(uint32_t uiClust = 0; uiClust < numClustUI; ++uiClust)
+            clustAryST[uiClust]->numReadsULng = 0;
+    } /*If have all files, reset the read counts for the new reads*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-5: Assign each read to its best consensus
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(errUChar & 1)
+    { /*While their is a samfile entry to read in*/
+
+        if(
+              *samStruct->lineCStr == '@'
+           || samStruct->flagUSht & 256
+           || samStruct->flagUSht & 2048
+        ) { /*If a header, secondary, or supplementary alignment*/
+            blankSamEntry(samStruct);
+            errUChar = readSamMap(samStruct, &samMapST);
+            continue;
+        } /*If a header, secondary, or supplementary alignment*/
+
+        findQScores(samStruct); /*Find the Q-scores*/
+        clustUI = numClustUI;   /*Marks the read as staying in the bin*/
+
+        if(!(samStruct->flagUSht & 4))
+        { /*If the read mapped to a consensus*/
+            scoreAln(
+                minStats,
+                samStruct,
+                zeroSam,    /*No reference for dels (no q-score)*/
+                &oneUChar,  /*Mapped read has Q-score*/
+                &zeroUChar  /*Reference has no q-score entry*/
+            ); /*Score the alignment*/
+
+            if(
+                   samStruct->mapqUChar >= minStats->minMapqUInt
+                && checkIfKeepRead(minStats, samStruct) & 1
+            ) cStrToUInt(samStruct->refCStr, &clustUI);
+
+            if(clustUI > numClustUI)
+                clustUI = numClustUI; /*Not one of the consensuses*/
+        } /*If the read mapped to a consensus*/
+
+        if(clustUI == numClustUI)
+        { /*If the read does not belong in any cluster*/
+            samToFq(samStruct, otherBinFILE);
+            printStatRec(samStruct, tmpStatsFILE);
+            ++binTree->numReadsULng; /*Update total scores in bin*/
+        } /*If the read does not belong in any cluster*/
+
+        else
+        { /*Else the read belongs to a cluster*/
+            samToFq(samStruct, clustAryFILE[clustUI]);
+            ++clustAryST[clustUI]->numReadsULng;
+        } /*Else the read belongs to a cluster*/
+
+        /*Read in the next line*/
+        blankSamEntry(samStruct);
+        errUChar = readSamMap(samStruct, &samMapST);
+    } /*While their is a samfile entry to read in*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-6: Clean up and rename files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    closeSamMap(&samMapST);
+
+    if(otherBinFILE != 0)
+        fclose(otherBinFILE);
+
+    if(tmpStatsFILE != 0)
+        fclose(tmpStatsFILE);
+
+    remove(consFaCStr);
+    remove(poolFqCStr);
+
+    for(uint32_t uiClust = 0; uiClust < numClustUI; ++uiClust)
+    { /*Loop: Swap in the clusters new fastq files*/
+        if(clustAryFILE[uiClust] != 0)
+            fclose(clustAryFILE[uiClust]);
+
+        clustST = clustAryST[uiClust];
+        tmpCStr = cStrCpInvsDelm(buffCStr, clustST->fqPathCStr);
+        cStrCpInvsDelm(tmpCStr, "-tmp");
+
+        if(errUChar & 2)
+            remove(buffCStr); /*Keep the old fastq file*/
+        else
+            rename(buffCStr, clustST->fqPathCStr);
+    } /*Loop: Swap in the clusters new fastq files*/
+
+    free(clustAryST);
+    free(clustAryFILE);
+
+    if(errUChar & 2)
+    { /*If could not open one of the output files*/
+        remove(tmpFqCStr);
+        remove(tmpStatsCStr);
+        return 2;
+    } /*If could not open one of the output files*/
+
+    /*Remove the bins old fastq & stats files*/
+    remove(binTree->fqPathCStr);
+    remove(binTree->statPathCStr);
+
+    /*Assign the temporary fastq & stats files to the bin*/
+    rename(tmpFqCStr, binTree->fqPathCStr);
+
+    if(binTree->statPathCStr[0] != '\0')
+        rename(tmpStatsCStr, binTree->statPathCStr);
+    else
+        remove(tmpStatsCStr); /*-skip-bin bins have no stats file*/
+
+    return 1; /*No errors*/
+} /*binReadsToCons*/
@@ -6,12 +6,17 @@
 #   - "trimSam.h"
 #   - "findCoInftBinTree.h"
 #   - "findCoInftChecks.h"
+#   - "readMapFun.h"
+#   - "fqArenaFun.h"
 #   o "samEntryStruct.h"
 #   o "defaultSettings.h"
 #   o "scoreReadsFun.h"
 #   o "cStrToNumberFun.h"
 #   o "printError.h"
 # C standard libraries:
+#     - <sys/resource.h>
+#     - <errno.h>
+#     - <pthread.h>
 #     o <string.h>
 #     o <stdlib.h>
 #     o <stdio.h>
@@ -25,6 +30,72 @@
 #include "findCoInftChecks.h" /*Checking functions for alignments*/
 #include "cStrFun.h"          /*C-string manipuplation*/
 #include "findCoInftBinTree.h"/*To build the readBin tree*/
+#include "readMapFun.h"       /*Runs minimap2 or the built in mapper*/
+#include "fqArenaFun.h"       /*Read lists for -read-arena*/
+#include <sys/resource.h>     /*getrlimit, for max open files*/
+#include <errno.h>            /*Checking if hit the open file limit*/
+#include <pthread.h>          /*Scoring reads on threads (-thread-bin)*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: binFILEs
+| Use:
+|    - Holds the open fastq & stats file for one bin, so binReads does
+|      not have to open and close both files for every read
+\---------------------------------------------------------------------*/
+typedef struct binFILEs
+{ /*binFILEs*/
+    struct readBin *bin;      /*Bin the files belong to (0 if unused)*/
+    FILE *fqFILE;             /*Open fastq file for the bin*/
+    FILE *statFILE;           /*Open stats file for the bin*/
+    unsigned long lastUseUL;  /*Last time used, for closing old files*/
+}binFILEs;
+
+/*---------------------------------------------------------------------\
+| Struct-2: binFILECache
+| Use:
+|    - Holds the open files for binReads. When more bins are open than
+|      the open file limit allows, the least recently used bin is
+|      closed. It is re-opened in append mode when needed again.
+\---------------------------------------------------------------------*/
+typedef struct binFILECache
+{ /*binFILECache*/
+    struct binFILEs *fileAry; /*Open files for each bin*/
+    uint32_t lenFileAryUI;    /*Max number of bins to keep open*/
+    uint32_t numOpenUI;       /*Number of bins with open files*/
+    unsigned long useCntUL;   /*Counter for finding least used bin*/
+}binFILECache;
+
+/*---------------------------------------------------------------------\
+| Struct-3: idHashSet
+| Use:
+|    - Holds a set of read ids (open addressing). binReadsThreaded uses
+|      it to remember which reads had supplementary alignments, since
+|      minimap2 output is not in read order with more than one thread.
+\---------------------------------------------------------------------*/
+typedef struct idHashSet
+{ /*idHashSet*/
+    char *idBuffCStr;         /*All read ids, each ends with '\0'*/
+    unsigned long lenBuffUL;  /*Bytes allocated to idBuffCStr*/
+    unsigned long usedBuffUL; /*Bytes used in idBuffCStr*/
+
+    unsigned long *slotAryUL; /*Start of id in idBuffCStr + 1 (0 empty)*/
+    unsigned long numSlotsUL; /*Size of slotAryUL (power of two)*/
+    unsigned long numIdsUL;   /*Number of ids in the set*/
+}idHashSet;
+
+/*---------------------------------------------------------------------\
+| Struct-4: binReadsThreadST
+| Use:
+|    - Holds the sam entries one thread in binReadsThreaded scores
+\---------------------------------------------------------------------*/
+typedef struct binReadsThreadST
+{ /*binReadsThreadST*/
+    struct samEntry *samAry;      /*Sam entries to score*/
+    uint8_t *keepAryUC;           /*Set to 1 if keeping the entry*/
+    unsigned long numSamUL;       /*Number of entries to score*/
+    char trimBl;                  /*1: trim reads, 0: do not*/
+    struct minAlnStats *minStats; /*Settings to keep a read (read only)*/
+}binReadsThreadST;
 
 /*---------------------------------------------------------------------\
 | Output:
@@ -61,6 +132,8 @@ struct readBin * binReads(
 |    Modifies:
 |        - fastq in binClust->fqPathCStr to be the fastq for the cluster
 |        - fastq in binTree->fqPathCStr to not have clustered reads
+|        - With a read arena (binTree->arenaST), the read lists in
+|          binTree & binClust instead. Fastq files are left alone
 \---------------------------------------------------------------------*/
 uint8_t binReadToCon(
     const uint8_t *clustUChar,      /*Cluster on*/
@@ -71,4 +144,173 @@ uint8_t binReadToCon(
     char *threadsCStr            /*Number threads to use with Minimap2*/
 ); /*Maps reads to consensus and keeps reads that meet user criteria*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 2: for file errors (or the mapper failed)
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - fastq of each cluster in binTree->rightChild to hold the
+|          reads that mapped best to the clusters consensus
+|        - fastq & stats file in binTree to hold the reads that did not
+|          map to any consensus
+|        - numReadsULng in binTree & each cluster
+|    Note:
+|        - Uses the fastq files, so any read arena should be written
+|          out (doneFqArena) first
+\---------------------------------------------------------------------*/
+uint8_t binReadsToCons(
+    struct readBin *binTree,        /*Bin with the list of clusters*/
+    struct samEntry *samStruct,     /*To hold temporary input*/
+    struct minAlnStats *minStats,   /*Min stats needed to keep a read*/
+    char *threadsCStr            /*Number threads to use with Minimap2*/
+); /*Maps a bins reads to all its consensuses at once and assigns each
+    read to the consensus it mapped best to*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - binCache to be set up with no open files
+\---------------------------------------------------------------------*/
+uint8_t initBinFILECache(
+    struct binFILECache *binCache /*Cache to set up*/
+); /*Sets up a binFILECache for use with binReads*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Closes: The files of the least recently used bin in binCache
+|    Modifies:
+|        - binCache->fileAry to have the last open bin in the closed
+|          bins position
+\---------------------------------------------------------------------*/
+void closeOldBinFILEs(
+    struct binFILECache *binCache /*Cache to close a bin in*/
+); /*Closes the least recently used bin in a binFILECache*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 4: if could not open the stats file
+|        - 8: if could not open the fastq file
+|    Modifies:
+|        - fqFILE & statFILE to point to the bins open files
+|        - binCache to have the bins files (may close an old bin)
+\---------------------------------------------------------------------*/
+uint8_t getBinFILEs(
+    struct binFILECache *binCache, /*Cache with the open files*/
+    struct readBin *bin,           /*Bin to get the files for*/
+    FILE **fqFILE,                 /*Set to the bins fastq file*/
+    FILE **statFILE                /*Set to the bins stats file*/
+); /*Gets the open files for a bin, opens them if not open*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Closes: Every open file in binCache (flushes output)
+|    Frees: The file array in binCache
+\---------------------------------------------------------------------*/
+void freeBinFILECache(
+    struct binFILECache *binCache /*Cache to close & free*/
+); /*Closes all files in and frees a binFILECache*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - idSet to be an empty set
+\---------------------------------------------------------------------*/
+uint8_t initIdHashSet(
+    struct idHashSet *idSet /*Set to initialize*/
+); /*Sets up an empty read id set*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if added the id (or the id was already in the set)
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - idSet to have idCStr (ends at the first white space)
+\---------------------------------------------------------------------*/
+uint8_t addIdToHashSet(
+    struct idHashSet *idSet, /*Set to add the read id to*/
+    char *idCStr             /*Read id to add*/
+); /*Adds a read id to a read id set*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if idCStr (ends at the first white space) is in idSet
+|        - 0: if idCStr is not in idSet
+\---------------------------------------------------------------------*/
+uint8_t findIdInHashSet(
+    struct idHashSet *idSet, /*Set to search*/
+    char *idCStr             /*Read id to find*/
+); /*Checks if a read id is in a read id set*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Frees: The memory in idSet (not idSet itself)
+\---------------------------------------------------------------------*/
+void freeIdHashSet(
+    struct idHashSet *idSet /*Set to free*/
+); /*Frees the memory used by a read id set*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - samAry to have trimmed & scored entries
+|        - keepAryUC to be 1 for entries that are kept, else 0
+|    Returns: 0
+\---------------------------------------------------------------------*/
+void * binReadsThread(
+    void *parmST /*binReadsThreadST structer with entries to score*/
+); /*Trims, scores, & checks a set of sam entries for binReads*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 2: if could not open or make the bins files
+|    Modifies:
+|        - The fastq & stats file in bin to not have reads in idSet
+|        - bin->numReadsULng to not count the removed reads
+\---------------------------------------------------------------------*/
+uint8_t rmIdsFromBin(
+    struct readBin *bin,    /*Bin to remove reads from*/
+    struct idHashSet *idSet /*Read ids to remove*/
+); /*Removes reads in a read id set from a bins fastq & stats file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o errUC to hold error output (same as binReads)
+|   - Creates:
+|     o A fastq file with reads for each bin
+|     o A stats file with the stats from scoreReads for each bin
+|   - Returns:
+|     o Tree of bins that the reads mapped into
+|   - Note:
+|     o minimap2 gets all threads. Reads are trimmed & scored on
+|       threadsCStr threads, while the main thread reads the next
+|       batch of entries & prints the last batch to the bins.
+|     o Reads with supplementary alignments are found by read id, so
+|       they are removed from the bins after all reads are binned.
+\---------------------------------------------------------------------*/
+struct readBin * binReadsThreaded(
+    char *fqPathCStr,        /*Fastq file to bin*/
+    char *refsPathCStr,      /*References to bin with*/
+    char *prefixCStr,        /*Prefix to name the bins with*/
+    char *threadsCStr,       /*Number of threads to use*/
+    char rmSupAlnBl,         /*Remove supplementary alignments*/
+    char trimBl,             /*1: trim reads, 0: do not*/
+    struct minAlnStats *minStats,
+    unsigned char *errUC     /*Reports any errors*/
+); /*Bin reads with a set of references, using multiple threads*/
+
 #endif
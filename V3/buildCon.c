@@ -157,6 +157,10 @@ int main(
             \n       - If you lower this your should also lower\
             \n         -min-read-read-map-length &\
             \n         -min-read-con-map-length\
+            \n    -no-pair-aln:                              [No]\
+            \n        - Compare reads to the best read with\
+            \n          minimap2 instead of the built in\
+            \n          pairwise aligner.\
             \n Additional Help messages:\
             \n    -h-build-consensus:\
             \n        - Print paramaters for building the consensus\
@@ -236,6 +240,17 @@ int main(
             \n    -rounds-racon:\
             \n        - Number of rounds to polish a         [4]\
             \n          consensus with racon\
+            \n    -enable-poa:                                  [No]\
+            \n        - Build the consensus with the built in\
+            \n          partial order alignment (POA). Runs\
+            \n          after the majority consensus & before\
+            \n          racon.\
+            \n    -rounds-poa:\
+            \n        - Number of rounds to build a          [2]\
+            \n          consensus with POA\
+            \n    -poa-band:                                    [64]\
+            \n        - Bases on each side of a reads\
+            \n          diagonal to align in POA.\
             \n    -enable-medaka:                               [No]\
             \n        - Do not use medaka to polish the\
             \n          consensus.\
@@ -434,6 +449,7 @@ int main(
     fastqStruct.topReadsCStr[0] = '\0';
     fastqStruct.consensusCStr[0] = '\0';
     fastqStruct.numReadsULng = 0;
+    fastqStruct.arenaST = 0; /*buildCon does not use a read arena*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Main Sec-3: Get user input
@@ -518,6 +534,7 @@ int main(
     if(!(
         conSetting.majConSet.useMajConBl |
         conSetting.raconSet.useRaconBl |
+        conSetting.poaSet.usePoaBl |
         conSetting.medakaSet.useMedakaBl
     )) { /*If the user said to ingore all consensus building steps*/
         printf("Current settings have turned off all consensus");
@@ -685,13 +702,13 @@ int main(
 
     if(statsPathCStr != 0)
     { /*If I need to copy over the stats file*/
+        /*Bins keep their stats as binary records*/
         tmpCStr = cStrCpInvsDelm(tmpPathCStr, prefixCStr);
-        tmpCStr = cStrCpInvsDelm(tmpCStr, "--stats.tsv");
+        tmpCStr = cStrCpInvsDelm(tmpCStr, "--stats.bin");
         stdinFILE = fopen(statsPathCStr, "r");
-        cpFILE = fopen(tmpPathCStr, "w");
+        cpFILE = fopen(tmpPathCStr, "wb");
 
-        while(fgets(tmpCmdCStr, 1024, stdinFILE))
-            fprintf(cpFILE, "%s", tmpCmdCStr);
+        statTsvToRec(stdinFILE, cpFILE);
 
         fclose(stdinFILE);
         fclose(cpFILE);
@@ -837,6 +854,12 @@ char * getUserInput(
 
         else if(strcmp(parmCStr, "-rounds-racon") == 0)
             cStrToUChar(inputCStr, &conSet->raconSet.rndsRaconUC);
+
+        else if(strcmp(parmCStr, "-rounds-poa") == 0)
+            cStrToUChar(inputCStr, &conSet->poaSet.rndsPoaUC);
+
+        else if(strcmp(parmCStr, "-poa-band") == 0)
+            cStrToUInt(inputCStr, &conSet->poaSet.bandUI);
  
         else if(strcmp(parmCStr, "-extra-consensus-steps") == 0)
             cStrToUInt(inputCStr, &conSet->numRndsToPolishUI);
@@ -844,6 +867,12 @@ char * getUserInput(
         else if(strcmp(parmCStr, "-min-con-length") == 0)
             conSet->minConLenUI = strtoul(inputCStr, &tmpCStr, 10);
 
+        else if(strcmp(parmCStr, "-no-pair-aln") == 0)
+        { /*Else if not using the pairwise aligner*/
+            readToReadMinStats->pairAlnBl = 0;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if not using the pairwise aligner*/
+
         else if(strcmp(parmCStr, "-disable-majority-consensus") == 0)
         { /*Else if user is ussing the best read instead of consensus*/
             conSet->majConSet.useMajConBl = 0;
@@ -856,6 +885,12 @@ char * getUserInput(
             --intArg; /*Account for this being a true or false*/
         } /*Else if user is ussing the best read instead of consensus*/
 
+        else if(strcmp(parmCStr, "-enable-poa") == 0)
+        { /*Else if user is using the built in POA*/
+            conSet->poaSet.usePoaBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if user is using the built in POA*/
+
         else if(strcmp(parmCStr, "-enable-medaka") == 0)
         { /*Else if user is ussing the best read instead of consensus*/
             conSet->medakaSet.useMedakaBl = 1;
@@ -13,21 +13,23 @@
 '          reference or the best read (highest medain Q) in the fastq
 '          file.
 '    fun-3 buildSingleCon:
-'        - Builds a consensus using: majority, racon, medaka functions
+'        - Builds a consensus using: majority, POA, racon, medaka
+'          functions
 '    fun-4 simpleMajCon:
-'        - Builds a majority consensus (ignores insertions)
+'        - Builds a majority consensus from a pileup of the top reads
 '    fun-5 buildConWithRacon:
 '        - Buids a consensus using racon
+'    fun-14 buildConWithPoa:
+'        - Builds a consensus with the built in partial order alignment
 '    fun-6 medakaPolish:
 '        - Polish a consensus with medaka using the best reads
 '    fun-7 cmpCons:
 '        - Compares two consensus (does recursive call if tree input
-'    fun-9 freeBaseStruct:
-'        - Frees a base struct from a linked list.
-'        - The freeded base is set to the alternate base if their is an
-'          alternate base or 0 if no alternative base is present.
-'        - Assumes alternateive bases (altBase) have nextBase set to
-'          0 (null).
+'    fun-8 cmpAllCons:
+'        - Compares all consensuses to each other with one minimap2
+'          call & marks the similar consensuses in a matrix
+'    fun-9 freeMajConPile:
+'        - Frees the pileup used to build a majority consensus
 '    fun-9 initMajConStruct:
 '        - Set default settings for struct holding majority consensus
 '          settings
@@ -42,6 +44,8 @@
 '    fun-12 initConBuildStruct:
 '        - Set default settings for struct holdoing consensus bulding
 '          settings.
+'    fun-15 initPoaStruct:
+'        - Set default settings for struct holding POA settings
 '~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #include "buildConFun.h"
@@ -93,6 +97,7 @@ unsigned char buildCon(
     char falseBl = 0;       /*So I can pass a FALSE (0) to functions*/
     char tmpBuffCStr[1024];
     unsigned char errUC = 0;
+    double startDbl = 0;    /*Start time of a stage (-bench-tsv)*/
 
     struct samEntry *zeroSam = 0; /*holds the reference (0 to ignore)*/
 
@@ -163,7 +168,23 @@ unsigned char buildCon(
 
         if(!(polishBl & 1))
         { /*if need to find another read*/
-            if(conSet->useStatBl & 1)
+            startDbl = getBenchTime();
+
+            if(conData->arenaST != 0)
+            { /*If the reads are in a read arena (-read-arena)*/
+                if(
+                      (conSet->useStatBl & 1)
+                   && conData->statPathCStr[0] == '\0'
+                ) return 8; /*If no stat file to extract reads with*/
+
+                errUC = arenaGetBestRead(conData, conSet->useStatBl);
+
+                /*findBestXReads maps to the bins fastq file*/
+                if((errUC & 1) && !(syncArenaFq(conData) & 1))
+                    errUC = 8; /*Could not write the fastq file*/
+            } /*If the reads are in a read arena (-read-arena)*/
+
+            else if(conSet->useStatBl & 1)
             { /*If using a stats file to extract reads*/
                 if(conData->statPathCStr[0] == '\0')
                     return 8; /*If no stat file to extract reads with*/
@@ -182,18 +203,23 @@ unsigned char buildCon(
                 errUC =
                     fqGetBestReadByMedQ(conData, samStruct,bestReadSam);
 
+            addBenchTime(benchBestReadUC, startDbl);
+
             if(!(errUC & 1))
             { /*If had an error*/
                 remove(conData->bestReadCStr);
                 return errUC;/*4, no Fq file, 8 write error, 64 memory*/
             } /*If had an error*/
 
+            startDbl = getBenchTime();
+
             errUC = 
                 findBestXReads(
                     &conSet->maxReadsToBuildConUL,
                     &conSet->numReadsForConUL, /*# of reads extracted*/
                     threadsCStr,      /*Number threads for minimap2*/
                     &falseBl,        /*Do not using mapping quality*/
+                    conSet->preselMultUI, /*Reads to map*/
                     minReadReadStats, /*Min stats to keep reads*/
                     samStruct,  /*Struct to use for reading sam file*/
                     zeroSam,    /*Do not use reference in scoring*/
@@ -202,6 +228,8 @@ unsigned char buildCon(
                     1           /*Make a name using the input fastq*/
             );  /*Extract top reads that mapped to selected best read*/
 
+            addBenchTime(benchBestXReadsUC, startDbl);
+
             if(conSet->numReadsForConUL < conSet->minReadsToBuildConUL)
             { /*If I did not extract enough reads*/
                 errUC = 16;
@@ -250,12 +278,15 @@ unsigned char buildCon(
             conData->consensusCStr[0] = '\0'; /*Remove old name*/
 
             /*Extract the reads for the next rebuild*/
+            startDbl = getBenchTime();
+
             errUC = 
                 findBestXReads(
                     &conSet->maxReadsToBuildConUL,
                     &conSet->numReadsForConUL, /*# of reads extracted*/
                     threadsCStr,     /*Number threads for minimap2*/
                     &trueBl,        /*will use mapq for reads here*/
+                    conSet->preselMultUI, /*Reads to map*/
                     minReadConStats,/*Min stats to keep reads*/
                     samStruct,  /*Struct to use for reading sam file*/
                     zeroSam,    /*Do not use reference in scoring*/
@@ -264,6 +295,8 @@ unsigned char buildCon(
                     1           /*Make a name using the input fastq*/
             );  /*Extract top reads that mapped to selected best read*/
 
+            addBenchTime(benchBestXReadsUC, startDbl);
+
             if(conSet->numReadsForConUL < conSet->minReadsToBuildConUL)
             { /*If need to get a new best read*/
                 polishBl = 0; /*do best read if reference fails*/
@@ -314,7 +347,14 @@ unsigned char buildCon(
         return errUC;  /*Failed to build a consensus*/
     } /*If I could not build a consensus*/
 
-    if(polishBl == 0)
+    if(polishBl == 0 && conData->arenaST != 0)
+    { /*If the best read is in a read arena*/
+        arenaAddBestRead(conData);
+        ++conData->numReadsULng; /*Account for adding back best read*/
+        remove(conData->bestReadCStr);
+    } /*If the best read is in a read arena*/
+
+    else if(polishBl == 0)
     { /*If had a best read file*/
         bestReadFILE = fopen(conData->bestReadCStr, "r");
         fqFILE = fopen(conData->fqPathCStr, "a");
@@ -338,6 +378,7 @@ unsigned char buildCon(
 |      - Fasta file with the consensus
 |    o Modifies:
 |      - clustOn->consensusCStr to have file name of created consensus 
+|      - clustOn->sketchST to have the k-mer sketch of the consensus
 |    o Returns:
 |      - 1 for success
 |      - 2 or 4 for file errors
@@ -358,8 +399,9 @@ unsigned char buildSingleCon(
     ' Fun-3 TOC: buildCon
     '     fun-3 sec-1: variable declerations
     '     fun-3 sec-2: Build majority consensus if asked for
-    '     fun-3 sec-3: Build consensus with racon if asked for
-    '     fun-3 sec-4: Build consensus with medaka if asked for
+    '     fun-3 sec-3: Build consensus with POA if asked for
+    '     fun-3 sec-4: Build consensus with racon if asked for
+    '     fun-3 sec-5: Build consensus with medaka if asked for
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -367,6 +409,7 @@ unsigned char buildSingleCon(
     \>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
     uint8_t errUC = 0;
+    double startDbl = 0;  /*Start time of a stage (-bench-tsv)*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-3 Sec-2: Build majority consensus if asked for
@@ -376,6 +419,8 @@ unsigned char buildSingleCon(
     { /*If need to build a simple majority consensus first*/
 
         /*Build the conssensus*/
+        startDbl = getBenchTime();
+
         errUC =
           simpleMajCon(
               &conSet->clustUC,
@@ -385,6 +430,8 @@ unsigned char buildSingleCon(
               &conSet->majConSet
         ); /*Build a simple majority consensus from input reads*/
 
+        addBenchTime(benchMajConUC, startDbl);
+
         if(!(errUC & 1))
             return errUC;
 
@@ -395,7 +442,33 @@ unsigned char buildSingleCon(
     } /*If need to build a simple majority consensus first*/
     
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-3 Sec-3: Build consensus with racon if asked for
+    ^ Fun-3 Sec-3: Build consensus with POA if asked for
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(conSet->poaSet.usePoaBl & 1)
+    { /*If building a consensus with the built in POA*/
+        startDbl = getBenchTime();
+
+        errUC =
+            buildConWithPoa(
+                &conSet->poaSet,
+                &conSet->clustUC,
+                clustOn
+        ); /*Build the consensus with partial order alignment*/
+
+        addBenchTime(benchPoaConUC, startDbl);
+
+        if(!(errUC & 1))
+            return errUC;
+
+        conSet->lenConUL = conSet->poaSet.lenConUL;
+
+        if(conSet->lenConUL < conSet->minConLenUI)
+            return 32; /*The consensus was to short*/
+    } /*If building a consensus with the built in POA*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-4: Build consensus with racon if asked for
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     if(conSet->raconSet.useRaconBl & 1)
@@ -415,7 +488,7 @@ unsigned char buildSingleCon(
 
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-3 Sec-4: Build consensus with medaka if asked for
+    ^ Fun-3 Sec-5: Build consensus with medaka if asked for
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     if(conSet->medakaSet.useMedakaBl & 1)
@@ -438,6 +511,11 @@ unsigned char buildSingleCon(
             return 32; /*The consensus was to short*/
     } /*If using medaka to polish*/
 
+    /*Sketch the consensus, so cmpCons can skip consensuses that are
+      clearly different. A missing file gives an empty sketch, which
+      cmpCons always maps*/
+    sketchFaFile(clustOn->consensusCStr, &clustOn->sketchST);
+
     return 1;
 } /*buildSingleCon*/
 
@@ -467,8 +545,9 @@ unsigned char simpleMajCon(
     '    fun-4 sec-2: Check if the bestRead and topReads files exist
     '        - Also reads in the reference sequence
     '    fun-4 sec-3: Prepare the minimap2 command
-    '    fun-4 sec-4: Make consensus array & initalize with reference
+    '    fun-4 sec-4: Make the pileup & initalize with reference
     '    fun-4 sec-5: Map reads to the reference read
+    '    fun-4 sec-6: Merge bases into a single majority consensus
     '    fun-4 sec-7: Print out cosensus & do clean up
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
@@ -479,27 +558,44 @@ unsigned char simpleMajCon(
     char qEntryBl = 0;           /*Marks if reference has Q-core entry*/
     char minimap2CmdCStr[2048];  /*Holds minimap2 command to run*/
     char *tmpCStr = 0;           /*Temp ptr for c-string manipulations*/
-    char *cigCStr = 0;           /*Reading the cigar entry*/
     char *seqCStr = 0;           /*Manipulating/reading the sequence*/
     char *qCStr = 0;             /*Manipulating/reading q-score entry*/
+    char *conNameCStr = 0;       /*Consensus file name for the header*/
+    char *colToBaseCStr = "ACGTN"; /*Base for each pileup column*/
 
     unsigned char qScoreUChar = 0; /*Holds the Q-score for a base*/
     uint8_t errUChar = 0;        /*Holds error messages from functions*/
+    uint8_t baseToColUC[256];    /*Pileup column for each base*/
+    uint8_t bestColUC = 0;       /*Column with the most support*/
 
     uint32_t cigEntryUInt = 0;  /*Holds number of bases in cigar entry*/
+    uint32_t uiCig = 0;         /*Cigar entry on*/
+    uint32_t uiBase = 0;        /*Base on in a match or SNP*/
+    uint32_t slotUI = 0;        /*Base on in an insertion*/
+    uint32_t *cntUI = 0;        /*Counts for the position on*/
+    uint32_t *insOffAryUI = 0;  /*Start of each positions insertions*/
+    uint32_t *insCntAryUI = 0;  /*Counts for each insertion base*/
 
     unsigned long minNumBasesUL = 0; /*Min read support to keep a base*/
     unsigned long minInsUL = 0;   /*Min read support to keep insertion*/
     unsigned long numSupReadsUL = 0; /*NumberOfReads supporting a base*/
     unsigned long numSeqUL = 0;      /*Number of mapped sequences*/
     unsigned long numMisSeqUL = 0;   /*Number of mapped sequences*/
+    unsigned long refPosUL = 0;      /*Position on the reference*/
+    unsigned long numSlotsUL = 0;    /*Number of insertion positions*/
 
-    struct baseStruct *headBase = 0; /*Head of the list of bases*/
-    struct baseStruct *incBase = 0;  /*First base at a position*/
-    struct baseStruct *lastBase = 0; /*Base before tmpBase*/
-    struct baseStruct *tmpBase = 0;  /*Base position working on*/
+    struct insBase *insST = 0;       /*Insertion adding to pileup*/
+    struct majConPile pileST;        /*Pileup for the consensus*/
 
     FILE *stdinFILE = 0;        /*For reading and writing files*/
+    struct samMap samMapST; /*minimap2 or built in mapper output*/
+
+    pileST.refSeqCStr = 0;
+    pileST.lenRefUL = 0;
+    pileST.baseCntAryUI = 0;
+    pileST.insAry = 0;
+    pileST.numInsUL = 0;
+    pileST.lenInsAryUL = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-2: Check if the bestRead and topReads files exist
@@ -535,41 +631,13 @@ unsigned char simpleMajCon(
         qEntryBl = 0;
     } /*Else reference is the consensus*/
 
+    fclose(stdinFILE);
+
     if(errUChar & 64)
-    { /*if had a memory allocation error*/
-        fclose(stdinFILE);
         return 64; /*Memory allocation error*/
-    } /*if had a memory allocation error*/
 
     if(!(errUChar & 1))
-    { /*If had an issue with the consensus*/
-        fclose(stdinFILE);
         return 2; /*issue with consensus*/
-    } /*If had an issue with the consensus*/
-
-    /*Make sure have doube the sequence + q-score size for insertions*/
-    if(samStruct->readLenUInt * 2 > samStruct->lenBuffULng)
-    { /*If need to increase the size of the buffer*/
-        samStruct->samEntryCStr =
-            realloc(
-                samStruct->samEntryCStr,
-                sizeof(char) * samStruct->readLenUInt * 2
-        ); /*Resize the structs buffer*/
-
-        if(samStruct->samEntryCStr == 0)
-        { /*If had a memory allocation wrror*/
-            fclose(stdinFILE);
-            return 64;
-        } /*If had a memory allocation wrror*/
-    } /*If need to increase the size of the buffer*/
-
-    /*Make the consensus array*/
-    fclose(stdinFILE);
-
-    if(errUChar & 64)
-        return 64;
-    if(!(errUChar & 1))
-        return 4; /*Invalide reference*/
 
     /*Check if can open the top reads file*/
     stdinFILE = fopen(binStruct->topReadsCStr, "r");
@@ -599,90 +667,107 @@ unsigned char simpleMajCon(
     );
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-4 Sec-4: Make the consensus array & initalize with reference
+    ^ Fun-4 Sec-4: Make the pileup & initalize with reference
+    ^    fun-4 sec-4 sub-1: Set up the base to pileup column table
+    ^    fun-4 sec-4 sub-2: Allocate memory for the pileup
+    ^    fun-4 sec-4 sub-3: Add the reference bases to the pileup
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    seqCStr = samStruct->seqCStr;
-    qCStr = samStruct->qCStr;
-    tmpBase = 0;
+    /******************************************************************\
+    * Fun-4 Sec-4 Sub-1: Set up the base to pileup column table
+    \******************************************************************/
 
-    /*Initalize base struct using the reference read*/
+    memset(baseToColUC, 4, 256); /*Anything not A, C, G, or T is 'N'*/
+    baseToColUC['A'] = 0;
+    baseToColUC['a'] = 0;
+    baseToColUC['C'] = 1;
+    baseToColUC['c'] = 1;
+    baseToColUC['G'] = 2;
+    baseToColUC['g'] = 2;
+    baseToColUC['T'] = 3;
+    baseToColUC['t'] = 3;
+    baseToColUC['U'] = 3;
+    baseToColUC['u'] = 3;
 
-    while(*seqCStr > 16)
-    { /*While have bases to read in*/
-        if(*seqCStr < 33)
-            continue;
+    /******************************************************************\
+    * Fun-4 Sec-4 Sub-2: Allocate memory for the pileup
+    \******************************************************************/
 
-        tmpBase = malloc(sizeof(struct baseStruct));
+    seqCStr = samStruct->seqCStr;
 
-        if(tmpBase == 0)
-        { /*If had a memory allocation error*/
-            lastBase = 0;       /*So function knows no previous bases*/
+    while(seqCStr[pileST.lenRefUL] > 32)
+        ++pileST.lenRefUL;
 
-            /*Free all the made bases*/
-            while(headBase != 0)
-                headBase = freeBaseStruct(&headBase, lastBase);
+    if(pileST.lenRefUL == 0)
+        return 2; /*No reference sequence*/
 
-            return 64;
-        } /*If had a memory allocation error*/
+    /*The sam entry buffer is reused by minimap2, so copy reference*/
+    pileST.refSeqCStr = malloc(sizeof(char) * (pileST.lenRefUL + 1));
+    pileST.baseCntAryUI =
+        calloc(pileST.lenRefUL * 5, sizeof(uint32_t));
 
-        if(headBase == 0)
-            headBase = tmpBase;           /*If is the first base*/
-        else
-            lastBase->nextBase = tmpBase; /*Set up list*/
+    if(pileST.refSeqCStr == 0 || pileST.baseCntAryUI == 0)
+    { /*If had a memory allocation error*/
+        freeMajConPile(&pileST);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    memcpy(pileST.refSeqCStr, seqCStr, pileST.lenRefUL);
+    pileST.refSeqCStr[pileST.lenRefUL] = '\0';
 
-        tmpBase->nextBase = 0; /*Only matches at this point*/
-        tmpBase->altBase = 0;  /*No inserts at this point*/
-        tmpBase->baseChar = *seqCStr;    /*Record the base*/
-        tmpBase->errTypeChar = 0;        /*match = 0, snp=1, ins=2*/
+    /******************************************************************\
+    * Fun-4 Sec-4 Sub-3: Add the reference bases to the pileup
+    \******************************************************************/
+
+    qCStr = samStruct->qCStr;
 
-        qScoreUChar = *qCStr - Q_ADJUST; /*Get the Q-score*/
+    for(refPosUL = 0; refPosUL < pileST.lenRefUL; ++refPosUL)
+    { /*Loop: Add reference bases to the pileup*/
+        qScoreUChar = qCStr[refPosUL] - Q_ADJUST; /*Get the Q-score*/
 
         /*qEntryBl ensures if only files if their was a Q-score entry*/
         if(qEntryBl && qScoreUChar < settings->minBaseQUC)
-        { /*If base is to low of quality to keep, make a blank struct*/
-            tmpBase->errTypeChar = 0;  /*match=0, snp=1, ins=2*/
-            tmpBase->numSupReadsUL = 0;
-        } /*If base is to low of quality to keep, make a blank struct*/
+            continue; /*Base is to low of quality to support*/
 
-        else
-            tmpBase->numSupReadsUL = 1;        /*match = 0, snp=1, ins=2*/
-
-        lastBase = tmpBase;
-        ++seqCStr;
-        ++qCStr;
-    } /*While have bases to read in*/
+        cntUI = pileST.baseCntAryUI + refPosUL * 5;
+        ++cntUI[baseToColUC[(uint8_t) pileST.refSeqCStr[refPosUL]]];
+    } /*Loop: Add reference bases to the pileup*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-5: Map reads to the reference read
     ^    fun-4 sec-5 sub-1: run miniamp2 and read in first line
     ^    fun-4 sec-5 sub-2: Read in sequence and position on first base
-    ^    fun-4 sec-5 sub-3: Add matches & SNPs to consensus array
-    ^    Fun-4 Sec-5 sub-4: Get base matching cigar (match/snp or ins)
-    ^    fun-4 sec-5 sub-5: Check if should keep base or discard
-    ^    fun-4 sec-5 sub-6: Find matching base at position
-    ^    fun-4 sec-5 sub-7: Make new base (no matching) or update count
-    ^    fun-4 sec-5 sub-8: Make sure on an insertion
-    ^    fun-4 sec-5 sub-9: Check if should keep ins
-    ^    fun-4 sec-5 sub-10: Find matching ins at pos
-    ^    fun-4 sec-5 sub-11: check if need to make ins
-    ^    fun-4 sec-5 sub-12: Ingnore deletions
-    ^    fun-4 sec-5 sub-13: Ingnore soft masking
+    ^    fun-4 sec-5 sub-3: Add matches & SNPs to the pileup
+    ^    fun-4 sec-5 sub-4: Add insertions to the insertion table
+    ^    fun-4 sec-5 sub-5: Ingnore deletions
+    ^    fun-4 sec-5 sub-6: Ingnore soft masking
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /******************************************************************\
     * Fun-4 Sec-5 Sub-1: run miniamp2 and read in first line
     \******************************************************************/
 
-    stdinFILE = popen(minimap2CmdCStr, "r");
+    /*Run minimap2 or the built in mapper (-in-map)*/
+    errUChar =
+        openSamMap(
+            &samMapST,
+            minimap2CmdCStr,
+            binStruct->bestReadCStr,
+            binStruct->topReadsCStr,
+            settings->inMapBl,
+            0
+        );
+
     blankSamEntry(samStruct); /*Make sure start with blank*/
 
     /*Read in a single sam file line to check if valid (header)*/
-    errUChar = readSamLine(samStruct, stdinFILE);
+    if(!(errUChar & 64))
+        errUChar = readSamMap(samStruct, &samMapST);
 
     if(!(errUChar & 1))
     { /*If an error occured*/
-        pclose(stdinFILE);
+        closeSamMap(&samMapST);
+        freeMajConPile(&pileST);
         return 32;
     } /*If an error occured*/
 
@@ -692,28 +777,27 @@ unsigned char simpleMajCon(
 
     while(errUChar & 1)
     { /*While have alignments to read in from the sam file*/
-        if(*samStruct->samEntryCStr == '@')
+        if(*samStruct->lineCStr == '@')
         { /*If on a header entry, read in next entry*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMap(samStruct, &samMapST);
             continue;
         } /*If on a header entry, read in next entry*/
 
-        cigCStr = samStruct->cigarCStr;
         seqCStr = samStruct->seqCStr;
         qCStr = samStruct->qCStr;
 
         if(*seqCStr == '*' || (*qCStr == '*' && *(qCStr + 1) == '\t'))
         { /*If no entry to check*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMap(samStruct, &samMapST);
             continue;
         } /*If no entry to check*/
 
         if(samStruct->flagUSht & 4)
         { /*If was an unampped read*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMap(samStruct, &samMapST);
             ++numMisSeqUL;
             ++numSeqUL;
             continue;
@@ -722,7 +806,7 @@ unsigned char simpleMajCon(
         if(samStruct->flagUSht & 2048)
         { /*If was an supplemental read*/
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE);
+            errUChar = readSamMap(samStruct, &samMapST);
             continue; /*Do not bother with supplemental alignments*/
             /*My logic is that this is PCR data, so any supplemental
               alignment is a repeat region, from rolling circle
@@ -731,327 +815,156 @@ unsigned char simpleMajCon(
               I want to ignore.*/
         } /*If was an supplemental read*/
 
-        /*Get first base in the list*/
         ++numSeqUL; /*Count the number of non-supplemental reads*/
-        incBase = headBase;
-        cigEntryUInt = samStruct->posOnRefUInt - 1;
-            /*-1 for 1 index for posOnRef, but 0 index fo incBase*/
 
-        while(cigEntryUInt > 0)
-        { /*While not on the starting base*/
-            incBase = incBase->nextBase;
-            --cigEntryUInt;
-        } /*While not on the starting base*/
+        /*-1 for 1 index for posOnRef, but 0 index for the pileup*/
+        refPosUL = samStruct->posOnRefUInt - 1;
 
-        while(*cigCStr != '\t')
+        if(samCigToAry(samStruct) & 64)
+        { /*If had a memory error packing the cigar*/
+            closeSamMap(&samMapST);
+            freeMajConPile(&pileST);
+            return 64;
+        } /*If had a memory error packing the cigar*/
+
+        for(uiCig = 0; uiCig < samStruct->lenCigUI; ++uiCig)
         { /*While not at the end of the sam alignment sequence*/
             /*Get the cigar entry*/
-            readCigEntry(&cigCStr, &cigEntryUInt);
+            cigEntryUInt = samStruct->cigAryUI[uiCig] >> CIG_LEN_SHIFT;
 
         /**************************************************************\
-        * Fun-4 Sec-5 Sub-3: Add matches & SNPs to consensus array
+        * Fun-4 Sec-5 Sub-3: Add matches & SNPs to the pileup
         \**************************************************************/
 
-            switch(*cigCStr)
+            switch(samStruct->cigAryUI[uiCig] & CIG_OP_MASK)
             { /*switch: check the error type & add bases to consensus*/
                 case 'X':              /*snp, similar loop to match*/
                 case '=':              /*Match, similar loop to snp*/
                 case '\t':             /*Match at end of cigar*/
-                /*Switch: Match, end of cigar match, snp, or insertion*/
-                    while(cigEntryUInt > 0)
-                    { /*While have bases to add to the bases list*/
-                        --cigEntryUInt;
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-4: Find first non-insertion
-                        \**********************************************/
-
-                        while(incBase->errTypeChar & 2)
-                        { /*Get off the insertion*/
-                            lastBase = incBase;
-                            incBase = incBase->nextBase;
-                        } /*Get off the insertion*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-5: Check if should keep base
-                        \**********************************************/
-
-                        tmpBase = incBase; /*Base position on*/
-                        qScoreUChar = *qCStr - Q_ADJUST; /*get Q-score*/
-
-                        if(qScoreUChar < settings->minBaseQUC)
-                        { /*If the base is low quality, skip*/
-                            /*Move to the next base in the list*/
-                            lastBase = incBase;
-                            incBase = incBase->nextBase;
-
-                            /*Move to the next base in the sam entry*/
-                            ++seqCStr;
-                            ++qCStr;
-                            continue; /*No support for position*/
-                        } /*If the base is low quality, skip*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-6: Find alt matching base
-                        \**********************************************/
-
-                        while(tmpBase->baseChar != *seqCStr)
-                        { /*While the bases are not equal*/
-                            if(tmpBase->baseChar == 0)
-                                break; /*Empty base*/
-
-                            lastBase = tmpBase;
-                            tmpBase = tmpBase->altBase;
-
-                            if(tmpBase == 0)
-                                break; /*Need to create a new base*/
-                        } /*While the bases are not equal*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-7: Make or update alt base
-                        \**********************************************/
-
-                        if(tmpBase == 0)
-                        { /*If need to create a new base*/
-                            lastBase->altBase =
-                                malloc(sizeof(struct baseStruct));
-
-                            tmpBase = lastBase->altBase;
-                            tmpBase->nextBase = 0; /*Is an alterantive*/
-                            tmpBase->altBase = 0;  /*No alternatives*/
-
-                            tmpBase->numSupReadsUL = 0;
-                            tmpBase->baseChar = *seqCStr;
-                            tmpBase->errTypeChar = 0;
-                        } /*If need to create a new base*/
-
-                        else if(tmpBase->baseChar == 0)
-                            tmpBase->baseChar = *seqCStr;
-
-                        ++tmpBase->numSupReadsUL;
-
-                        /*Move to the next base*/
-                        lastBase = incBase;
-                        incBase = incBase->nextBase;
-                        ++seqCStr;
-                        ++qCStr;
-                    } /*While have bases to add to the bases list*/
-            
+                /*Switch: Match, end of cigar match, snp*/
+                    /*Make sure the read does not go past the reference*/
+                    if(refPosUL + cigEntryUInt > pileST.lenRefUL)
+                    { /*If the read goes off the end of the reference*/
+                        if(refPosUL >= pileST.lenRefUL)
+                            cigEntryUInt = 0;
+                        else
+                            cigEntryUInt = pileST.lenRefUL - refPosUL;
+                    } /*If the read goes off the end of the reference*/
+
+                    cntUI = pileST.baseCntAryUI + refPosUL * 5;
+
+                    for(uiBase = 0; uiBase < cigEntryUInt; ++uiBase)
+                    { /*Loop: Add bases to the pileup*/
+                        qScoreUChar = qCStr[uiBase] - Q_ADJUST;
+
+                        /*Low quality bases give no support*/
+                        cntUI[baseToColUC[(uint8_t) seqCStr[uiBase]]] +=
+                            (qScoreUChar >= settings->minBaseQUC);
+
+                        cntUI += 5;
+                    } /*Loop: Add bases to the pileup*/
+
+                    refPosUL += cigEntryUInt;
+                    seqCStr += cigEntryUInt;
+                    qCStr += cigEntryUInt;
                     break;
-                /*Switch: Match, end of cigar match, snp, or insertion*/
+                /*Switch: Match, end of cigar match, snp*/
 
+                /******************************************************\
+                * Fun-4 Sec-5 Sub-4: Add insertions to insertion table
+                \******************************************************/
 
                 case 'I':   /*Is an insertion*/
                 /*Switch: for insertions*/
+                    for(slotUI = 0; slotUI < cigEntryUInt; ++slotUI)
+                    { /*Loop: Add insertion bases to the side table*/
+                        qScoreUChar = qCStr[slotUI] - Q_ADJUST;
 
-                    while(cigEntryUInt > 0)
-                    { /*While have bases to add to the bases list*/
-                        --cigEntryUInt;
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-8: Make sure on an insertion
-                        \**********************************************/
-
-                        /*Insertions at the ends will likely be treated
-                          as softmasks by minimap2. This means that
-                          incBase will != 0 for insertions
-                        */
-                        if(!(incBase->errTypeChar & 2))
-                        { /*If next base is not an insertion*/
-                            tmpBase=malloc(sizeof(struct baseStruct));
-
-                            if(lastBase->errTypeChar & 2)
-                            { /*If the last base was an ins*/ 
-                                tmpBase->nextBase = incBase->nextBase;
-                                incBase->nextBase = tmpBase;
-                                incBase = tmpBase;
-                            } /*If the last base was an ins*/ 
-
-                            else
-                            { /*else the last base was not an ins*/ 
-                                tmpBase->nextBase = incBase;
-                                lastBase->nextBase = tmpBase;
-                                incBase = tmpBase;
-                            } /*else the last base was not an ins*/ 
-
-                            /*Set defualts for the new base*/
-                            incBase->altBase = 0;
-                            incBase->errTypeChar = 2;
-                            incBase->baseChar = 0;
-                            incBase->numSupReadsUL = 0;
-                        } /*If next base is not an insertion*/
-
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-9: Check if should keep ins
-                        \**********************************************/
-    
-                        tmpBase = incBase; /*Base position on*/
-                        qScoreUChar = *qCStr - Q_ADJUST; /*get Q-score*/
-    
                         if(qScoreUChar < settings->minInsQUC)
-                        { /*If the base is low quality, skip*/
-                            /*Move to the next base in the list*/
-    
-                            /*This avoids scattered insertions*/
-                            if(
-                                cigEntryUInt > 0 &&  /*More insertions*/
-                                !(incBase->nextBase->errTypeChar & 2)
-                                    /*^^Next base is not an insertion*/
-                            ) { /*If have other insertions to process*/
-                                /*Make a new base for next insertion*/
-                                tmpBase =
-                                    malloc(sizeof(struct baseStruct));
-    
-                                tmpBase->nextBase = incBase->nextBase;
-                                incBase->nextBase = tmpBase;
-                                lastBase = incBase;
-                                incBase = tmpBase;
-    
-                                /*Set the defaulst for the new base*/
-                                incBase->altBase = 0;
-                                incBase->errTypeChar = 2;
-                                incBase->baseChar = 0;
-                                incBase->numSupReadsUL = 0;
-                            } /*If have other insertions to process*/
-    
+                            continue; /*Low quality, no support*/
+
+                        if(refPosUL > pileST.lenRefUL)
+                            break;    /*Insertion is past the reference*/
+
+                        if(pileST.numInsUL >= pileST.lenInsAryUL)
+                        { /*If need more memory for the insertions*/
+                            if(pileST.lenInsAryUL == 0)
+                                pileST.lenInsAryUL = 1024;
                             else
-                            { /*Else is safe to move to the next base*/
-                                lastBase = incBase;
-                                incBase = incBase->nextBase;
-                            } /*Else is safe to move to the next base*/
-    
-                            /*Move to the next base in the sam entry*/
-                            ++seqCStr;
-                            ++qCStr;
-                            continue;
-                        } /*If the base is low quality, skip*/
-    
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-10: Find matching ins at pos
-                        \**********************************************/
-    
-                        while(tmpBase->baseChar != *seqCStr)
-                        { /*While the bases are not equal*/
-                            if(tmpBase->baseChar == 0)
-                                break; /*Empty base*/
-    
-                            lastBase = tmpBase;
-                            tmpBase = tmpBase->altBase;
-    
-                            if(tmpBase == 0)
-                                 break; /*Need to create a new base*/
-                        } /*While the bases are not equal*/
-    
-                        /**********************************************\
-                        * Fun-4 Sec-5 Sub-11: check if need to make ins
-                        \**********************************************/
-    
-                        if(tmpBase == 0)
-                        { /*If need to create a new base*/
-                            lastBase->altBase =
-                                    malloc(sizeof(struct baseStruct));
-    
-                            tmpBase = lastBase->altBase;
-                            tmpBase->nextBase = 0; /*Is an alterantive*/
-                            tmpBase->altBase = 0;  /*No alternatives*/
-    
-                            tmpBase->errTypeChar = 2; /*Insertion*/
-                            tmpBase->baseChar = *seqCStr;
-                            tmpBase->numSupReadsUL = 0;
-                        } /*If need to create a new base*/
-    
-                        else if(tmpBase->baseChar == 0)
-                            tmpBase->baseChar = *seqCStr;
-    
-                        ++tmpBase->numSupReadsUL;
-    
-                        /*This avoids scattered deletions*/
-                        if(
-                            cigEntryUInt > 0 &&  /*More insertions*/
-                            !(incBase->nextBase->errTypeChar & 2)
-                                    /*^^Next base is not an insertion*/
-                        ) { /*If have other insertions to process*/
-                            /*Make a new base for next insertion*/
-                            tmpBase =
-                                malloc(sizeof(struct baseStruct));
-    
-                            tmpBase->nextBase = incBase->nextBase;
-                            incBase->nextBase = tmpBase;
-                            lastBase = incBase;
-                            incBase = tmpBase;
-    
-                            /*Set the defaulst for the new base*/
-                            incBase->altBase = 0;
-                            incBase->errTypeChar = 2;
-                            incBase->baseChar = 0;
-                            incBase->numSupReadsUL = 0;
-                        } /*If have other insertions to process*/
-    
-                        else /*Can move to the next base*/
-                        { /*Else is safe to move to the next base*/
-                            lastBase = incBase;
-                            incBase = incBase->nextBase;
-                        } /*Else is safe to move to the next base*/
-    
-                        ++seqCStr;
-                        ++qCStr;
-                    } /*While have bases to add to the bases list*/
-                
+                                pileST.lenInsAryUL <<= 1;
+
+                            insST =
+                                realloc(
+                                    pileST.insAry,
+                                    pileST.lenInsAryUL *
+                                        sizeof(struct insBase)
+                            ); /*Double the insertion table*/
+
+                            if(insST == 0)
+                            { /*If had a memory allocation error*/
+                                closeSamMap(&samMapST);
+                                freeMajConPile(&pileST);
+                                return 64;
+                            } /*If had a memory allocation error*/
+
+                            pileST.insAry = insST;
+                        } /*If need more memory for the insertions*/
+
+                        insST = pileST.insAry + pileST.numInsUL;
+                        insST->posUI = refPosUL;
+                        insST->slotUI = slotUI;
+                        insST->colUC =
+                            baseToColUC[(uint8_t) seqCStr[slotUI]];
+                        ++pileST.numInsUL;
+                    } /*Loop: Add insertion bases to the side table*/
+
+                    seqCStr += cigEntryUInt;
+                    qCStr += cigEntryUInt;
                     break;
                 /*Switch: for insertions*/
 
                 /******************************************************\
-                * Fun-4 Sec-5 Sub-12: Ignore deletions
+                * Fun-4 Sec-5 Sub-5: Ignore deletions
                 \******************************************************/
 
                 case 'D':
-                    /*Deletions will be marked as empty and will be 
-                      caught if their are to few bases, so can ignore.*/
-
-                    while(cigEntryUInt > 0)
-                    { /*While have bases to ignore*/
-                        --cigEntryUInt;
-
-                        /*Move past other sequences insertions*/
-                        while(incBase->errTypeChar & 2)
-                            incBase = incBase->nextBase; 
-
-                        lastBase = incBase;
-                        incBase = incBase->nextBase;
-                    } /*While have bases to ignore*/
-
+                    /*Deletions give no support to a position, so are
+                      caught if their are to few bases*/
+                    refPosUL += cigEntryUInt;
                     break;
 
                 /******************************************************\
-                * Fun-4 Sec-5 Sub-13: Ignore soft masking
+                * Fun-4 Sec-5 Sub-6: Ignore soft masking
                 \******************************************************/
 
                 case 'S':
                 /*Switch: ingnore soft maskes 'S'*/
-                    while(cigEntryUInt > 0)
-                    { /*While have bases to ignore*/
-                        --cigEntryUInt;
-                        ++seqCStr;
-                        ++qCStr;
-                    } /*While have bases to ignore*/
-
+                    seqCStr += cigEntryUInt;
+                    qCStr += cigEntryUInt;
                     break;
                 /*Switch: ingnore soft maskes 'S'*/
             } /*switch: check the error type & add bases to consensus*/
         } /*While not at the end of the sam alignment sequence*/
 
         blankSamEntry(samStruct);
-        errUChar = readSamLine(samStruct, stdinFILE);
+        errUChar = readSamMap(samStruct, &samMapST);
     } /*While have alignments to read in from the sam file*/
 
-    pclose(stdinFILE);
+    closeSamMap(&samMapST);
+
+    if(errUChar & 64)
+    { /*If had a memory error reading the sam file*/
+        freeMajConPile(&pileST);
+        return 64;
+    } /*If had a memory error reading the sam file*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-6: Merge bases into a single majority consensus
     ^    fun-4 sec-6 sub-1: Set up for deciding bases to keep
-    ^    fun-4 sec-6 sub-2: Find best alternate base for each position
-    ^    fun-4 sec-6 sub-3: Check if should keep base
-    ^    fun-4 sec-6 sub-4: Add the base & Q-score to the sequence
+    ^    fun-4 sec-6 sub-2: Count the insertion bases at each position
+    ^    fun-4 sec-6 sub-3: Make sure have room for the consensus
+    ^    fun-4 sec-6 sub-4: Add the kept insertions before a position
+    ^    fun-4 sec-6 sub-5: Add the majority base at each position
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /******************************************************************\
@@ -1063,79 +976,150 @@ unsigned char simpleMajCon(
     minInsUL = numSeqUL * settings->minReadsPercInsFlt;
     settings->lenConUL = 0;
 
-    seqCStr = samStruct->samEntryCStr;
-    samStruct->readLenUInt = 0;
-    lastBase = 0;                     /*For freeing the list*/
+    /*Each position has its insertions before it. The last entry is for
+      insertions after the reference*/
+    insOffAryUI = calloc(pileST.lenRefUL + 2, sizeof(uint32_t));
+
+    if(insOffAryUI == 0)
+    { /*If had a memory allocation error*/
+        freeMajConPile(&pileST);
+        return 64;
+    } /*If had a memory allocation error*/
 
     /******************************************************************\
-    * Fun-4 Sec-6 Sub-2: Find the best alternate base for each position
+    * Fun-4 Sec-6 Sub-2: Count the insertion bases at each position
     \******************************************************************/
 
-    while(headBase != 0)
-    { /*For all positions in the consensus, remove non-majority bases*/
-        incBase = headBase;         /*Move to 1st alternative base*/
-        tmpBase = headBase->altBase;
-        numSupReadsUL = incBase->numSupReadsUL;
-       
-        while(tmpBase != 0)
-        { /*While have bases to remove*/
-            numSupReadsUL += tmpBase->numSupReadsUL;
+    /*Find the longest insertion at each position*/
+    for(unsigned long ulIns = 0; ulIns < pileST.numInsUL; ++ulIns)
+    { /*Loop: Find the number of insertion bases at each position*/
+        insST = pileST.insAry + ulIns;
 
-            if(incBase->numSupReadsUL < tmpBase->numSupReadsUL) 
-                headBase = freeBaseStruct(&incBase, lastBase);
-                /*Freeing puts tmpBase were incBase is*/
+        if(insST->slotUI >= insOffAryUI[insST->posUI + 1])
+            insOffAryUI[insST->posUI + 1] = insST->slotUI + 1;
+    } /*Loop: Find the number of insertion bases at each position*/
 
-            else
-            { /*If removing the current base in the list*/
-                /*Need to make sure freeBaseStruct does nothing funny*/
-                incBase->altBase = tmpBase->altBase;
-                tmpBase->altBase = 0;
-                freeBaseStruct(&tmpBase, lastBase);
-            } /*If removing the current base in the list*/
+    /*Convert the insertion lengths to offsets in insCntAryUI*/
+    for(refPosUL = 1; refPosUL < pileST.lenRefUL + 2; ++refPosUL)
+        insOffAryUI[refPosUL] += insOffAryUI[refPosUL - 1];
+
+    numSlotsUL = insOffAryUI[pileST.lenRefUL + 1];
+
+    if(numSlotsUL > 0)
+    { /*If had insertions to count*/
+        insCntAryUI = calloc(numSlotsUL * 5, sizeof(uint32_t));
+
+        if(insCntAryUI == 0)
+        { /*If had a memory allocation error*/
+            free(insOffAryUI);
+            freeMajConPile(&pileST);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        for(unsigned long ulIns = 0; ulIns < pileST.numInsUL; ++ulIns)
+        { /*Loop: Add the insertion bases to the insertion counts*/
+            insST = pileST.insAry + ulIns;
+
+            ++insCntAryUI[
+                (insOffAryUI[insST->posUI] + insST->slotUI) * 5 +
+                insST->colUC
+            ];
+        } /*Loop: Add the insertion bases to the insertion counts*/
+    } /*If had insertions to count*/
+
+    /******************************************************************\
+    * Fun-4 Sec-6 Sub-3: Make sure have room for the consensus
+    \******************************************************************/
+
+    if(pileST.lenRefUL + numSlotsUL + 1 > samStruct->lenBuffULng)
+    { /*If need to increase the size of the buffer*/
+        tmpCStr =
+            realloc(
+                samStruct->samEntryCStr,
+                sizeof(char) * (pileST.lenRefUL + numSlotsUL + 2)
+        ); /*Resize the structs buffer*/
 
-            tmpBase = incBase->altBase; /*Move to next alternate base*/
-        } /*While have bases to remove*/
+        if(tmpCStr == 0)
+        { /*If had a memory allocation wrror*/
+            free(insOffAryUI);
+            free(insCntAryUI);
+            freeMajConPile(&pileST);
+            return 64;
+        } /*If had a memory allocation wrror*/
+
+        samStruct->samEntryCStr = tmpCStr;
+        samStruct->lenBuffULng = pileST.lenRefUL + numSlotsUL + 1;
+    } /*If need to increase the size of the buffer*/
+
+    seqCStr = samStruct->samEntryCStr;
+    samStruct->readLenUInt = 0;
+
+    for(refPosUL = 0; refPosUL <= pileST.lenRefUL; ++refPosUL)
+    { /*Loop: Find the majority base for each position*/
 
         /**************************************************************\
-        * Fun-4 Sec-6 Sub-3: Check if should keep base
+        * Fun-4 Sec-6 Sub-4: Add the kept insertions before a position
         \**************************************************************/
 
-        if(headBase->errTypeChar & 2)
-        { /*If is an insertion*/
-            /*Find the % of reads/supplemental alignments needed to
-              support this position*/
+        cntUI = insCntAryUI + insOffAryUI[refPosUL] * 5;
 
-            if(numSupReadsUL < minInsUL)
-            { /*If have to few insertions to have support*/
-                headBase = freeBaseStruct(&headBase, lastBase);
-                continue;                /*Move on to the next base*/       
-            } /*If have to few insertions to have support*/
-        } /*If is an insertion*/
+        for(
+            slotUI = insOffAryUI[refPosUL];
+            slotUI < insOffAryUI[refPosUL + 1];
+            ++slotUI
+        ) { /*Loop: Check each insertion base at this position*/
+            bestColUC = 0;
+            numSupReadsUL = 0;
 
-        else
-        { /*If is a match or SNP*/
-            /*Find the % of reads/supplemental alignments needed to
-              support this position*/
+            for(uint8_t ucCol = 0; ucCol < 5; ++ucCol)
+            { /*Loop: Find the insertion base with the most support*/
+                numSupReadsUL += cntUI[ucCol];
+                if(cntUI[ucCol] > cntUI[bestColUC]) bestColUC = ucCol;
+            } /*Loop: Find the insertion base with the most support*/
 
-            if(numSupReadsUL<minNumBasesUL)
-            { /*If have to few SNPs or matches to have support*/
-                headBase = freeBaseStruct(&headBase, lastBase);
-                continue;                /*Move on to the next base*/       
-            } /*If have to few SNPs or matches to have support*/
-        } /*If is a match or SNP*/
+            if(numSupReadsUL > 0 && numSupReadsUL >= minInsUL)
+            { /*If have enough support to keep the insertion*/
+                *seqCStr = colToBaseCStr[bestColUC];
+                ++seqCStr;
+                ++settings->lenConUL;
+            } /*If have enough support to keep the insertion*/
+
+            cntUI += 5;
+        } /*Loop: Check each insertion base at this position*/
+
+        if(refPosUL == pileST.lenRefUL)
+            break; /*Was the insertions after the reference*/
 
         /**************************************************************\
-        * Fun-4 Sec-6 Sub-4: Add the base & Q-score to the sequence
+        * Fun-4 Sec-6 Sub-5: Add the majority base at each position
         \**************************************************************/
 
-        /*Put the base into the sequence*/
-        *seqCStr = headBase->baseChar; /*Set the base*/
+        /*Ties go to the reference base*/
+        cntUI = pileST.baseCntAryUI + refPosUL * 5;
+        bestColUC = baseToColUC[(uint8_t) pileST.refSeqCStr[refPosUL]];
+        numSupReadsUL = 0;
+
+        for(uint8_t ucCol = 0; ucCol < 5; ++ucCol)
+        { /*Loop: Find the base with the most support*/
+            numSupReadsUL += cntUI[ucCol];
+            if(cntUI[ucCol] > cntUI[bestColUC]) bestColUC = ucCol;
+        } /*Loop: Find the base with the most support*/
+
+        if(numSupReadsUL < minNumBasesUL)
+            continue; /*To few reads support this position*/
+
+        if(bestColUC == baseToColUC[(uint8_t)pileST.refSeqCStr[refPosUL]])
+            *seqCStr = pileST.refSeqCStr[refPosUL];
+        else
+            *seqCStr = colToBaseCStr[bestColUC];
+
         ++seqCStr; /*Move to next sequence entry*/
         ++settings->lenConUL; /*count base in the consensus length*/
+    } /*Loop: Find the majority base for each position*/
 
-        /*Free base and move to the next base*/
-        headBase = freeBaseStruct(&headBase, lastBase);
-    } /*For all positions in the consensus, remove non-majority bases*/
+    free(insOffAryUI);
+    free(insCntAryUI);
+    freeMajConPile(&pileST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-4 Sec-7: Print out cosensus & do clean up
@@ -1149,9 +1133,19 @@ unsigned char simpleMajCon(
     /*Reset the sequence & q-score line pointers (for clairity)*/
     seqCStr = samStruct->samEntryCStr;
 
+    /*The consensus is made in the runs scratch directory, so the
+      directory is left out of the header*/
+    conNameCStr =
+        binStruct->consensusCStr + strlen(binStruct->consensusCStr);
+
+    while(
+          conNameCStr > binStruct->consensusCStr
+       && *(conNameCStr - 1) != '/'
+    ) --conNameCStr;
+
     /*Write consensus as fasta file*/
     stdinFILE = fopen(binStruct->consensusCStr, "w");
-    fprintf(stdinFILE, ">%s\n%s\n", binStruct->consensusCStr, seqCStr);
+    fprintf(stdinFILE, ">%s\n%s\n", conNameCStr, seqCStr);
     fclose(stdinFILE);
 
     return 1;
@@ -1190,8 +1184,8 @@ void buildConWithRacon(
         tmpConCStr[lenTmpBuffUS],   /*Hold the consensus name*/
         *tmpCStr = 0,
         *tmpFileCStr = 0,    /*For swapping consensus file names*/
-        *tmpFastaFileCStr = "tmp-2023-12-01-con-1563577017123412.fasta",
-        *tmpSamFileCStr = "tmp-2023-12-01-map-15635770171234122342.sam";
+        tmpFastaFileCStr[300], /*Temporary consensus named after bin*/
+        tmpSamFileCStr[300];   /*Temporary sam file named after bin*/
 
      unsigned long numBytesUL = 0; /*Number bytes read in by fread*/
      FILE *conFILE = 0; /*For counting the consensus length*/
@@ -1200,6 +1194,16 @@ void buildConWithRacon(
     ^ Fun-5 Sec-2: Set up the consensus name
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    /*Name the temporary files after the bin, so that bins can be
+      processed at the same time without sharing files*/
+    tmpCStr = cStrCpInvsDelm(tmpFastaFileCStr, conBin->fqPathCStr);
+    tmpCStr -= 6; /*Get to end of .fastq*/
+    cStrCpInvsDelm(tmpCStr, "--racon-tmp.fasta");
+
+    tmpCStr = cStrCpInvsDelm(tmpSamFileCStr, conBin->fqPathCStr);
+    tmpCStr -= 6; /*Get to end of .fastq*/
+    cStrCpInvsDelm(tmpCStr, "--racon-tmp.sam");
+
     /*Check if need to build the consensus name*/
     if(conBin->consensusCStr[0] == '\0')
     { /*If using the best read for the first round of racon*/
@@ -1597,8 +1601,13 @@ unsigned char medakaPolish(
 |        - readBin Struct with the closest consensus
 |    - Modifies:
 |        - closesConUint to hold the score of the most similar consensus
+|        - numSkipUL is incremented for each consensus skipped because
+|          its k-mer sketch was to different
 | Note:
 |    - clusters with ->balUChar < 0 will be ignored
+|    - Consensuses estimated (k-mer sketch) to be more than
+|      minStats->minDiffFlt + minStats->sketchMarginFlt different are
+|      not mapped
 \---------------------------------------------------------------------*/
 struct readBin * cmpCons(
     struct readBin *conBin,       /*Bin with consensus to compare*/
@@ -1606,7 +1615,8 @@ struct readBin * cmpCons(
     struct samEntry *samStruct,   /*Struct to hold input from minimap2*/
     struct samEntry *refStruct,   /*Struct to hold input from minimap2*/
     struct minAlnStats *minStats, /*Min stats needed to keep a error*/
-    char *threadsCStr            /*Number threads to use with Minimap2*/
+    char *threadsCStr,           /*Number threads to use with Minimap2*/
+    unsigned long *numSkipUL     /*Number of pairs the sketches skip*/
 ) /*Compares a consenses to a another consensus. This will do a
     recursive call if conBinTree has children*/
 { /*cmpCons*/
@@ -1635,6 +1645,7 @@ struct readBin * cmpCons(
 
     FILE
         *stdinFILE = 0; /*File to see if input files are valid*/
+    struct samMap samMapST; /*minimap2 or built in mapper output*/
 
     struct readBin
         *refBin = 0;
@@ -1768,6 +1779,18 @@ struct readBin * cmpCons(
                 continue;
             } /*If this cluster has been marked to be skipped*/
 
+            if(
+               !cmpKmerSketch(
+                   &conBin->sketchST,
+                   &refBin->sketchST,
+                   minStats->minDiffFlt + minStats->sketchMarginFlt
+               )
+            ) { /*If the consensuses are to different to merge*/
+                ++(*numSkipUL);
+                refBin = refBin->rightChild;
+                continue;
+            } /*If the consensuses are to different to merge*/
+
             blankSamEntry(samStruct);
 
             /*Prepare the minimap2 command*/
@@ -1779,32 +1802,51 @@ struct readBin * cmpCons(
                 refBin->consensusCStr
             );
 
-            stdinFILE = popen(minimap2CmdCStr, "r"); /*run minimap2*/
+            /*Run the aligner, minimap2, or the built in mapper*/
+            errUChar =
+                openSamMap(
+                    &samMapST,
+                    minimap2CmdCStr,
+                    conBin->consensusCStr,
+                    refBin->consensusCStr,
+                    minStats->inMapBl | (minStats->pairAlnBl << 1),
+                    0
+                );
 
             blankSamEntry(samStruct);
-            errUChar = readSamLine(samStruct, stdinFILE); /*1st line*/
 
-            if(*samStruct->samEntryCStr != '@')
+            if(!(errUChar & 64))
+                errUChar = readSamMap(samStruct, &samMapST); /*1st*/
+
+            if(*samStruct->lineCStr != '@')
             { /*If no header*/
-                pclose(stdinFILE);
+                closeSamMap(&samMapST);
                 return 0;
             } /*If no header*/
 
             while(errUChar & 1)
             { /*While on the haeder lines*/
                 blankSamEntry(samStruct);
-                errUChar = readSamLine(samStruct, stdinFILE);
+                errUChar = readSamMap(samStruct, &samMapST);
 
-                if(*samStruct->samEntryCStr != '@')
+                if(!(errUChar & 1))
+                    break; /*End of file or error*/
+
+                if(*samStruct->lineCStr != '@')
                 { /*If off the header entries*/
-                    pclose(stdinFILE);
+                    /*The map is closed before scoring, so keep line*/
+                    errUChar = copySamEntry(samStruct);
+
+                    if(errUChar & 1)
+                        closeSamMap(&samMapST);
+
                     break; /*If not a header*/
                 } /*If off the header entries*/
             } /*While on the haeder lines*/
 
-            if(*samStruct->samEntryCStr == '@')
+            if(!(errUChar & 1) || *samStruct->lineCStr == '@')
             { /*If their was only headers*/
-                pclose(stdinFILE);
+                closeSamMap(&samMapST);
                 continue;
             } /*If their was only headers*/
 
@@ -1834,74 +1876,360 @@ struct readBin * cmpCons(
 
 /*---------------------------------------------------------------------\
 | Output:
-|   o Returns:
-|     - The next base in the list (if altBase != 0, returns altBase)
-|   o Frees:
-|     - The baseToFree from memory
-|   o Modifies:
-|     - If their is an alternative base (baseToFree->altBase != 0)
-|         o lastBase->nextBase is set to baseToFree->altBase
-|         o bastToFree is set to bastToFree->altBase
-|     - If their is not alternative base (bastToFree->altBase == 0)
-|         o lastBase->nextBase is set to baseToFree->nextBase
-|         o bastToFree is set to 0
-| Note:
-|    o This function assumes that the next base pointer (nextBase) is
-|      is alwasy 0 (not set) for teh alternate base pointer (altBase==0)
+|    - Returns:
+|        o 1 if compared all consensuses
+|        o 2 if could not make the multi-fasta file
+|        o 32 if minimap2 did not output a sam file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o simAryC[i * numConUL + j] & simAryC[j * numConUL + i] are
+|          set to 1 if consensus i & j are to similar, else 0
+|    - File:
+|        o Makes allConFaCStr, which is removed at the end
 \---------------------------------------------------------------------*/
-struct baseStruct * freeBaseStruct(
-    struct baseStruct **baseToFree, /*Insertion list to free*/
-    struct baseStruct *lastBase     /*Base to assign pointers to*/
-) /*Frees an base from a linked list of bases*/
-{ /*freeBaseStruct*/
+uint8_t cmpAllCons(
+    struct readBin **conAry,      /*Clusters with consensuses*/
+    unsigned long numConUL,       /*Number of clusters in conAry*/
+    char *allConFaCStr,           /*Name of multi-fasta to make*/
+    char *simAryC,                /*Gets the similarity matrix*/
+    struct samEntry *samStruct,   /*Struct to hold input from minimap2*/
+    struct minAlnStats *minStats, /*Min stats needed to keep a error*/
+    char *threadsCStr            /*Number threads to use with Minimap2*/
+) /*Maps all consensuses to each other with one minimap2 call & marks
+    the pairs of consensuses that are to similar*/
+{ /*cmpAllCons*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-8 TOC: Sec-1 Sub-1: freeBaseStruct
+    ' Fun-8 TOC: cmpAllCons
+    '     fun-8 sec-1: Variable declerations
+    '     fun-8 sec-2: Read in consensuses & make the multi-fasta
+    '     fun-8 sec-3: Run minimap2 and check first line
+    '     fun-8 sec-4: Score each alignment & fill similarity matrix
+    '     fun-8 sec-5: Clean up
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    if(*baseToFree == 0)
-        return 0;
-    
-    if((*baseToFree)->altBase != 0)
-    { /*If have an alternative base to keep as the next base*/
-        (*baseToFree)->altBase->nextBase = (*baseToFree)->nextBase;
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    ^ Fun-8 Sec-1: Variable declerations
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-        if(lastBase != 0)
-        { /*If have a previous base*/
-            lastBase->nextBase = (*baseToFree)->altBase;
-            free(*baseToFree);
-            *baseToFree = lastBase->nextBase;
-        } /*If have a previous base*/
+    uint8_t errUChar = 0; /*For holding error returns from functions*/
+    uint8_t zeroUChar = 0;
 
-        else
-        { /*Else this was the first base*/
-            lastBase = (*baseToFree)->altBase;
-            free(*baseToFree);
-            *baseToFree = lastBase;
-        } /*Else this was the first base*/
+    char *tmpCStr = 0;
+    char *seqCStr = 0;       /*For removing new lines in a consensus*/
+    char *revSeqCStr = 0;    /*Reverse complement for secondary alns*/
+    char minimap2CmdCStr[2048];
+    char numConCStr[11];     /*Number of consensuses as a c-string*/
 
-        return *baseToFree;
-    } /*If have an alternative base to keep as the next base*/
+    char **seqAryCStr = 0;   /*Sequence of each consensus*/
+    unsigned long *lenSeqAryUL = 0; /*Length of each consensus*/
+    unsigned long maxLenUL = 0;     /*Longest consensus*/
+    long fileLenL = 0;
 
-    else
-    { /*Else if their is only a next base*/
-        if(lastBase != 0)
-        { /*If have a previous base in the list*/
-            lastBase->nextBase = (*baseToFree)->nextBase;
-            free(*baseToFree);
-            *baseToFree = 0; /*Tell that their are no alternate bases*/
-            return lastBase->nextBase;
-        } /*If have a previous base in the list*/
+    uint32_t qryUI = 0;      /*Index of the query consensus*/
+    uint32_t refUI = 0;      /*Index of the reference consensus*/
 
-        else
-        { /*Else baseToFree was the first base*/
-            lastBase = (*baseToFree)->nextBase;
-            free(*baseToFree);
-            *baseToFree = 0; /*Tell that their are no alternate bases*/
-            return lastBase;
-        } /*Else baseToFree was the first base*/
-    } /*Else if their is only a next base*/
-} /*freeBaseStruct*/
+    struct samEntry refST;   /*Holds the reference consensus*/
+
+    FILE *stdinFILE = 0;
+    struct samMap samMapST; /*minimap2 or built in mapper output*/
+
+    initSamEntry(&refST);
+    initSamMap(&samMapST);
+    memset(simAryC, 0, numConUL * numConUL * sizeof(char));
+
+    if(numConUL < 2)
+        return 1; /*Nothing to compare*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Read in consensuses & make the multi-fasta
+    ^    fun-8 sec-2 sub-1: Allocate memory for the consensuses
+    ^    fun-8 sec-2 sub-2: Read in each consensus
+    ^    fun-8 sec-2 sub-3: Write consensuses to the multi-fasta
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Fun-8 Sec-2 Sub-1: Allocate memory for the consensuses
+    \******************************************************************/
+
+    seqAryCStr = calloc(numConUL, sizeof(char *));
+    lenSeqAryUL = calloc(numConUL, sizeof(unsigned long));
+
+    if(seqAryCStr == 0 || lenSeqAryUL == 0)
+    { /*If had a memory allocation error*/
+        free(seqAryCStr);
+        free(lenSeqAryUL);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /******************************************************************\
+    * Fun-8 Sec-2 Sub-2: Read in each consensus
+    \******************************************************************/
+
+    for(unsigned long ulCon = 0; ulCon < numConUL; ++ulCon)
+    { /*Loop: Read in each consensus*/
+        stdinFILE = fopen(conAry[ulCon]->consensusCStr, "r");
+
+        if(stdinFILE == 0)
+            continue; /*No consensus, so nothing to compare*/
+
+        fseek(stdinFILE, 0, SEEK_END);
+        fileLenL = ftell(stdinFILE);
+        fseek(stdinFILE, 0, SEEK_SET);
+
+        if(fileLenL <= 0)
+        { /*If the file is empty*/
+            fclose(stdinFILE);
+            continue;
+        } /*If the file is empty*/
+
+        seqAryCStr[ulCon] = malloc(sizeof(char) * (fileLenL + 1));
+
+        if(seqAryCStr[ulCon] == 0)
+        { /*If had a memory allocation error*/
+            fclose(stdinFILE);
+            errUChar = 64;
+            goto cleanUp;
+        } /*If had a memory allocation error*/
+
+        fileLenL = fread(seqAryCStr[ulCon], 1, fileLenL, stdinFILE);
+        seqAryCStr[ulCon][fileLenL] = '\0';
+        fclose(stdinFILE);
+
+        /*Move past the header*/
+        tmpCStr = seqAryCStr[ulCon];
+
+        while(*tmpCStr != '\n' && *tmpCStr != '\0')
+            ++tmpCStr;
+
+        /*Copy the sequence to the start, removing any new lines*/
+        seqCStr = seqAryCStr[ulCon];
+
+        while(*tmpCStr != '\0')
+        { /*While have bases to copy*/
+            if(*tmpCStr > 32)
+            { /*If is a base*/
+                *seqCStr = *tmpCStr;
+                ++seqCStr;
+            } /*If is a base*/
+
+            ++tmpCStr;
+        } /*While have bases to copy*/
+
+        *seqCStr = '\0';
+        lenSeqAryUL[ulCon] = seqCStr - seqAryCStr[ulCon];
+
+        if(lenSeqAryUL[ulCon] > maxLenUL)
+            maxLenUL = lenSeqAryUL[ulCon];
+    } /*Loop: Read in each consensus*/
+
+    /*Secondary alignments have no sequence, so I need to make the
+      reverse complement for reverse secondary alignments*/
+    revSeqCStr = malloc(sizeof(char) * (maxLenUL + 1));
+
+    if(revSeqCStr == 0)
+    { /*If had a memory allocation error*/
+        errUChar = 64;
+        goto cleanUp;
+    } /*If had a memory allocation error*/
+
+    /******************************************************************\
+    * Fun-8 Sec-2 Sub-3: Write consensuses to the multi-fasta
+    \******************************************************************/
+
+    stdinFILE = fopen(allConFaCStr, "w");
+
+    if(stdinFILE == 0)
+    { /*If could not make the multi-fasta*/
+        errUChar = 2;
+        goto cleanUp;
+    } /*If could not make the multi-fasta*/
+
+    /*The index of each consensus is its name, so can find it later*/
+    for(unsigned long ulCon = 0; ulCon < numConUL; ++ulCon)
+    { /*Loop: Write each consensus to the multi-fasta*/
+        if(lenSeqAryUL[ulCon] == 0)
+            continue;
+
+        fprintf(stdinFILE, ">%lu\n%s\n", ulCon, seqAryCStr[ulCon]);
+    } /*Loop: Write each consensus to the multi-fasta*/
+
+    fclose(stdinFILE);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    ^ Fun-8 Sec-3: Run minimap2 and check first line
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*-N makes sure every other consensus can be reported*/
+    uIntToCStr(numConCStr, numConUL);
+
+    tmpCStr = cStrCpInvsDelm(minimap2CmdCStr, minimap2AllVsAllCMD);
+    tmpCStr = cpParmAndArg(tmpCStr, "-N", numConCStr);
+    tmpCStr = cpParmAndArg(tmpCStr, "-t", threadsCStr);
+    cpParmAndArg(tmpCStr, allConFaCStr, allConFaCStr);
+
+    /*Run minimap2 or the built in mapper (-in-map). The built in
+      mapper does the same all vs all reporting as -X -N*/
+    errUChar =
+        openSamMap(
+            &samMapST,
+            minimap2CmdCStr,
+            allConFaCStr,
+            allConFaCStr,
+            minStats->inMapBl,
+            1
+        );
+
+    blankSamEntry(samStruct);
+
+    if(!(errUChar & 64))
+        errUChar = readSamMap(samStruct, &samMapST); /*1st line*/
+
+    if(!(errUChar & 1) || *samStruct->lineCStr != '@')
+    { /*If minimap2 did not output a header*/
+        closeSamMap(&samMapST);
+        errUChar = (errUChar & 64) ? 64 : 32;
+        goto cleanUp;
+    } /*If minimap2 did not output a header*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    ^ Fun-8 Sec-4: Score each alignment & fill similarity matrix
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(errUChar & 1)
+    { /*While have alignments to score*/
+        if(*samStruct->lineCStr == '@' || samStruct->flagUSht & 4)
+        { /*If is a header or unmapped consensus*/
+            blankSamEntry(samStruct);
+            errUChar = readSamMap(samStruct, &samMapST);
+            continue;
+        } /*If is a header or unmapped consensus*/
+
+        cStrToUInt(samStruct->queryCStr, &qryUI);
+        cStrToUInt(samStruct->refCStr, &refUI);
+
+        if(
+            qryUI == refUI ||
+            qryUI >= numConUL ||
+            refUI >= numConUL ||
+            simAryC[qryUI * numConUL + refUI]
+        ) { /*If self mapping or already know the pair is similar*/
+            blankSamEntry(samStruct);
+            errUChar = readSamMap(samStruct, &samMapST);
+            continue;
+        } /*If self mapping or already know the pair is similar*/
+
+        if(*samStruct->seqCStr == '*')
+        { /*If is a secondary alignment (no sequence)*/
+            samStruct->seqCStr = seqAryCStr[qryUI];
+
+            if(samStruct->flagUSht & 16)
+            { /*If need the reverse complement*/
+                tmpCStr = seqAryCStr[qryUI] + lenSeqAryUL[qryUI] - 1;
+                seqCStr = revSeqCStr;
+
+                while(tmpCStr >= seqAryCStr[qryUI])
+                { /*While have bases to reverse complement*/
+                    switch(*tmpCStr & (~32))
+                    { /*Switch: find the complement base*/
+                        case 'A': *seqCStr = 'T'; break;
+                        case 'C': *seqCStr = 'G'; break;
+                        case 'G': *seqCStr = 'C'; break;
+                        case 'T': *seqCStr = 'A'; break;
+                        default:  *seqCStr = 'N'; break;
+                    } /*Switch: find the complement base*/
+
+                    ++seqCStr;
+                    --tmpCStr;
+                } /*While have bases to reverse complement*/
+
+                *seqCStr = '\0';
+                samStruct->seqCStr = revSeqCStr;
+            } /*If need the reverse complement*/
+
+            samStruct->readLenUInt = lenSeqAryUL[qryUI];
+            samStruct->unTrimReadLenUInt = lenSeqAryUL[qryUI];
+        } /*If is a secondary alignment (no sequence)*/
+
+        /*scoreAln assumes the Q-score entry is not null, so I am
+          setting it to the sequence. This is ok since I am telling
+          scoreAln that their is not Q-score for the reference*/
+        refST.seqCStr = seqAryCStr[refUI];
+        refST.qCStr = seqAryCStr[refUI];
+        refST.readLenUInt = lenSeqAryUL[refUI];
+
+        scoreAln(
+            minStats,
+            samStruct,
+            &refST,      /*Reference struct to score dels with*/ 
+            &zeroUChar,  /*Mapped consensus has no Q-score*/
+            &zeroUChar   /*Mapped consensus has no Q-score*/
+        ); /*Score the alignment*/
+
+        if(checkIfKeepRead(minStats, samStruct) & 1)
+        { /*If the consensuses look the same*/
+            simAryC[qryUI * numConUL + refUI] = 1;
+            simAryC[refUI * numConUL + qryUI] = 1;
+        } /*If the consensuses look the same*/
+
+        blankSamEntry(samStruct);
+        errUChar = readSamMap(samStruct, &samMapST);
+    } /*While have alignments to score*/
+
+    closeSamMap(&samMapST);
+
+    if(errUChar & 64)
+        goto cleanUp;
+
+    errUChar = 1;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+    ^ Fun-8 Sec-5: Clean up
+    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    cleanUp:
+
+    remove(allConFaCStr);
+
+    for(unsigned long ulCon = 0; ulCon < numConUL; ++ulCon)
+        free(seqAryCStr[ulCon]);
+
+    free(seqAryCStr);
+    free(lenSeqAryUL);
+    free(revSeqCStr);
+
+    return errUChar;
+} /*cmpAllCons*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   o Frees:
+|     - All heap allocated variables in pileST
+|   o Modifies:
+|     - Sets all pointers & lengths in pileST to 0
+\---------------------------------------------------------------------*/
+void freeMajConPile(
+    struct majConPile *pileST /*Pileup to free*/
+) /*Frees the heap variables in a majority consensus pileup*/
+{ /*freeMajConPile*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: Sec-1 Sub-1: freeMajConPile
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(pileST->refSeqCStr);
+    free(pileST->baseCntAryUI);
+    free(pileST->insAry);
+
+    pileST->refSeqCStr = 0;
+    pileST->baseCntAryUI = 0;
+    pileST->insAry = 0;
+    pileST->lenRefUL = 0;
+    pileST->numInsUL = 0;
+    pileST->lenInsAryUL = 0;
+
+    return;
+} /*freeMajConPile*/
 
 /*---------------------------------------------------------------------\
 | Output: Modifies: majConStruct to have default settings
@@ -1913,7 +2241,7 @@ void initMajConStruct(
 { /*initMajConStruct*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-9 TOC: Sec-1 Sub-1: initMajConStruct
+    ' Fun-10 TOC: Sec-1 Sub-1: initMajConStruct
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     majConSettings->useMajConBl = defUseMajCon;
@@ -1921,6 +2249,7 @@ void initMajConStruct(
     majConSettings->minInsQUC = majConMinInsQ;
     majConSettings->minReadsPercBaseFlt = percBasesPerPos;
     majConSettings->minReadsPercInsFlt = percInsPerPos;
+    majConSettings->inMapBl = defInMapBl;
 
     majConSettings->lenConUL = 0; /*counter*/
 
@@ -1937,7 +2266,7 @@ void initRaconStruct(
 { /*initRaconStruct*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-10 TOC: Sec-1 Sub-1: initRaconStruct
+    ' Fun-11 TOC: Sec-1 Sub-1: initRaconStruct
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     raconSettings->useRaconBl = defUseRaconCon;
@@ -1957,7 +2286,7 @@ void initMedakaStruct(
 { /*initMedakaStruct*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-11 TOC: Sec-1 Sub-1: initMedakaStruct
+    ' Fun-12 TOC: Sec-1 Sub-1: initMedakaStruct
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     medakaSettings->useMedakaBl = defUseMedakaCon;
@@ -1978,21 +2307,440 @@ void initConBuildStruct(
 { /*initConBuildStruct*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-12 TOC: Sec-1 Sub-1: initConBuildStruct
+    ' Fun-13 TOC: Sec-1 Sub-1: initConBuildStruct
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     consensusSettings->useStatBl = 0;
+    consensusSettings->readArenaBl = defReadArenaBl;
+    consensusSettings->batchAssignBl = defBatchAssignBl;
     consensusSettings->clustUC = 0;
     consensusSettings->minReadsToBuildConUL = minReadsPerBin;
     consensusSettings->numRndsToPolishUI = defNumPolish;
     consensusSettings->maxReadsToBuildConUL = defReadsPerCon;
+    consensusSettings->preselMultUI = defPreselMultUI;
     consensusSettings->minConLenUI = defMinConLen;
     consensusSettings->lenConUL = 0;
     consensusSettings->numReadsForConUL = 0;
+    consensusSettings->numSkipConUL = 0;
 
     initMajConStruct(&consensusSettings->majConSet);
     initRaconStruct(&consensusSettings->raconSet);
+    initPoaStruct(&consensusSettings->poaSet);
     initMedakaStruct(&consensusSettings->medakaSet);
 
     return;
 } /*initConBuildStruct*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Creates:
+|        o Fasta file with the consensus (name in conBin->consensusCStr)
+|    - Returns:
+|        o 1 if built a consensus
+|        o 2 if could not open or read the best read or consensus
+|        o 4 if could not open the top reads file
+|        o 16 if no reads aligned to the best read or consensus
+|        o 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+uint8_t buildConWithPoa(
+    struct poaStruct *settings, /*Settings for the POA consensus*/
+    unsigned char *clustUC,     /*Cluster on*/
+    struct readBin *conBin      /*Bin working on*/
+) /*Builds a consensus with the built in partial order alignment*/
+{ /*buildConWithPoa*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-14 TOC: buildConWithPoa
+    '    fun-14 sec-1: Variable declerations
+    '    fun-14 sec-2: Read in the best read or last consensus
+    '    fun-14 sec-3: Read in the top reads
+    '    fun-14 sec-4: Build the consensus for each round
+    '    fun-14 sec-5: Write the consensus & clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    char revBl = 0;             /*1: read is on the other strand*/
+    char *refFileCStr = conBin->consensusCStr;
+    char *conNameCStr = 0;      /*Consensus file name for the header*/
+    char *tmpCStr = 0;
+
+    char *idCStr = 0;
+    char *seqCStr = 0;
+    char *qCStr = 0;
+    unsigned long lenIdUL = 0;
+    unsigned long lenSeqUL = 0;
+    unsigned long lenQUL = 0;
+    uint32_t lenSeqUI = 0;
+
+    char *conCStr = 0;          /*Backbone for the round*/
+    char *newConCStr = 0;       /*Consensus built in the round*/
+    unsigned long lenConUL = 0;
+    unsigned long lenNewConUL = 0;
+    uint32_t lenConUI = 0;
+    long lenL = 0;
+
+    char *readsCStr = 0;        /*Top reads, one after another*/
+    unsigned long lenReadsUL = 0;
+    unsigned long usedReadsUL = 0;
+    unsigned long *startAryUL = 0; /*Start of each read in readsCStr*/
+    uint32_t *lenAryUI = 0;        /*Length of each read*/
+    unsigned long numReadsUL = 0;
+    unsigned long lenStartUL = 0;
+    unsigned long numAlnUL = 0;    /*Reads aligned in a round*/
+    void *tmpPtr = 0;
+
+    struct mapMinz *bbMinzAry = 0; /*Backbone minimizers*/
+    struct mapMinz *minzAry = 0;   /*Read minimizers*/
+    unsigned long lenBbMinzUL = 0;
+    unsigned long lenMinzUL = 0;
+    long numBbMinzL = 0;
+    long *diagAryL = 0;
+    unsigned long lenDiagUL = 0;
+    long diagL = 0;
+
+    struct poaGraph graphST;
+    FILE *inFILE = 0;
+
+    initPoaGraph(&graphST);
+    settings->lenConUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-2: Read in the best read or last consensus
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(conBin->consensusCStr[0] == '\0')
+    { /*If using the best read for the first round*/
+        tmpCStr =
+            cStrCpInvsDelm(conBin->consensusCStr, conBin->fqPathCStr);
+        tmpCStr -= 6; /*Get to end of .fastq*/
+        tmpCStr = cStrCpInvsDelm(tmpCStr, "--clust-");
+        tmpCStr = uCharToCStr(tmpCStr, *clustUC);
+        tmpCStr = cStrCpInvsDelm(tmpCStr, "--con.fasta");
+
+        refFileCStr = conBin->bestReadCStr;
+    } /*If using the best read for the first round*/
+
+    inFILE = fopen(refFileCStr, "r");
+
+    if(inFILE == 0)
+        return 2;
+
+    errUC =
+        readMapSeq(
+            inFILE,
+            &idCStr,
+            &lenIdUL,
+            &conCStr,
+            &lenConUL,
+            &qCStr,
+            &lenQUL,
+            &lenConUI
+        ); /*Read in the backbone*/
+
+    fclose(inFILE);
+    inFILE = 0;
+
+    if(!(errUC & 1))
+    { /*If could not read in the backbone*/
+        free(idCStr);
+        free(conCStr);
+        free(qCStr);
+        return errUC & 64 ? 64 : 2;
+    } /*If could not read in the backbone*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-3: Read in the top reads
+    ^   - The reads are kept in memory so each round does not need to
+    ^     read the file again
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    inFILE = fopen(conBin->topReadsCStr, "r");
+
+    if(inFILE == 0)
+        errUC = 4;
+
+    while(errUC & 1)
+    { /*Loop: Read in the top reads*/
+        errUC =
+            readMapSeq(
+                inFILE,
+                &idCStr,
+                &lenIdUL,
+                &seqCStr,
+                &lenSeqUL,
+                &qCStr,
+                &lenQUL,
+                &lenSeqUI
+            ); /*Read in the next read*/
+
+        if(!(errUC & 1))
+            break; /*End of file (2) or memory error (64)*/
+
+        if(numReadsUL >= lenStartUL)
+        { /*If need more room for the read starts*/
+            lenStartUL += 256;
+
+            tmpPtr =
+               realloc(startAryUL, lenStartUL * sizeof(unsigned long));
+
+            if(tmpPtr == 0)
+                errUC = 64;
+            else
+                startAryUL = tmpPtr;
+
+            tmpPtr = realloc(lenAryUI, lenStartUL * sizeof(uint32_t));
+
+            if(tmpPtr == 0)
+                errUC = 64;
+            else
+                lenAryUI = tmpPtr;
+        } /*If need more room for the read starts*/
+
+        if(usedReadsUL + lenSeqUI + 1 > lenReadsUL)
+        { /*If need more room for the reads*/
+            lenReadsUL = (usedReadsUL + lenSeqUI + 1) << 1;
+            tmpPtr = realloc(readsCStr, lenReadsUL * sizeof(char));
+
+            if(tmpPtr == 0)
+                errUC = 64;
+            else
+                readsCStr = tmpPtr;
+        } /*If need more room for the reads*/
+
+        if(errUC & 64)
+            break;
+
+        startAryUL[numReadsUL] = usedReadsUL;
+        lenAryUI[numReadsUL] = lenSeqUI;
+        ++numReadsUL;
+
+        tmpCStr = readsCStr + usedReadsUL;
+        cStrCpInvsDelm(tmpCStr, seqCStr);
+        usedReadsUL += lenSeqUI + 1;
+    } /*Loop: Read in the top reads*/
+
+    if(inFILE != 0)
+        fclose(inFILE);
+
+    free(idCStr);
+    free(seqCStr);
+    free(qCStr);
+
+    if(errUC == 2)
+        errUC = 1; /*Read in all the reads*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-4: Build the consensus for each round
+    ^   o fun-14 sec-4 sub-1: Start the graph from the backbone
+    ^   o fun-14 sec-4 sub-2: Align & add each read to the graph
+    ^   o fun-14 sec-4 sub-3: Get the consensus for the next round
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Fun-14 Sec-4 Sub-1: Start the graph from the backbone
+    \******************************************************************/
+
+    for(uint8_t ucRnd = 0; ucRnd < settings->rndsPoaUC; ++ucRnd)
+    { /*Loop: Build the consensus for each round*/
+        if(errUC != 1)
+            break;
+
+        if(poaSeqToGraph(&graphST, conCStr, lenConUI) & 64)
+        { /*If had a memory allocation error*/
+            errUC = 64;
+            break;
+        } /*If had a memory allocation error*/
+
+        numBbMinzL =
+            poaGetBbMinz(conCStr, lenConUI, &bbMinzAry, &lenBbMinzUL);
+
+        if(numBbMinzL < 0)
+        { /*If had a memory allocation error*/
+            errUC = 64;
+            break;
+        } /*If had a memory allocation error*/
+
+        /**************************************************************\
+        * Fun-14 Sec-4 Sub-2: Align & add each read to the graph
+        \**************************************************************/
+
+        numAlnUL = 0;
+
+        for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+        { /*Loop: Add each read to the graph*/
+            seqCStr = readsCStr + startAryUL[ulRead];
+            lenSeqUI = lenAryUI[ulRead];
+
+            errUC =
+                poaReadDiag(
+                    bbMinzAry,
+                    (unsigned long) numBbMinzL,
+                    seqCStr,
+                    lenSeqUI,
+                    &minzAry,
+                    &lenMinzUL,
+                    &diagAryL,
+                    &lenDiagUL,
+                    &revBl,
+                    &diagL
+                ); /*Find the reads strand & diagonal*/
+
+            if(errUC & 64)
+                break;
+
+            if(errUC & 2)
+            { /*If the read shares to little with the backbone*/
+                errUC = 1;
+                continue;
+            } /*If the read shares to little with the backbone*/
+
+            /*Keep the read on the backbones strand for later rounds*/
+            if(revBl)
+                poaRevCompSeq(seqCStr, lenSeqUI);
+
+            errUC =
+                poaAlignSeq(
+                    &graphST,
+                    seqCStr,
+                    lenSeqUI,
+                    diagL,
+                    settings->bandUI
+                ); /*Align the read to the graph*/
+
+            if(errUC & 64)
+                break;
+
+            if(errUC & 2)
+            { /*If the read did not align*/
+                errUC = 1;
+                continue;
+            } /*If the read did not align*/
+
+            errUC = poaAddAln(&graphST, seqCStr);
+
+            if(errUC & 64)
+                break;
+
+            if(errUC & 2)
+            { /*If the graph has a cycle (can not be sorted)*/
+                errUC = 16;
+                break;
+            } /*If the graph has a cycle (can not be sorted)*/
+
+            ++numAlnUL;
+        } /*Loop: Add each read to the graph*/
+
+        if(errUC != 1)
+            break;
+
+        if(numAlnUL == 0)
+        { /*If no reads aligned to the backbone*/
+            errUC = 16;
+            break;
+        } /*If no reads aligned to the backbone*/
+
+        /**************************************************************\
+        * Fun-14 Sec-4 Sub-3: Get the consensus for the next round
+        \**************************************************************/
+
+        lenL =
+            poaGetCon(
+                &graphST,
+                defPoaMinCovF,
+                &newConCStr,
+                &lenNewConUL
+            ); /*Get the heaviest path*/
+
+        if(lenL < 0)
+        { /*If had a memory allocation error*/
+            errUC = 64;
+            break;
+        } /*If had a memory allocation error*/
+
+        if(lenL == 0)
+        { /*If no bases had enough reads*/
+            errUC = 16;
+            break;
+        } /*If no bases had enough reads*/
+
+        /*Swap buffers, so the new consensus is the next backbone*/
+        tmpCStr = conCStr;
+        conCStr = newConCStr;
+        newConCStr = tmpCStr;
+
+        lenSeqUL = lenConUL;
+        lenConUL = lenNewConUL;
+        lenNewConUL = lenSeqUL;
+
+        lenConUI = (uint32_t) lenL;
+    } /*Loop: Build the consensus for each round*/
+
+    freePoaGraph(&graphST);
+    free(newConCStr);
+    free(readsCStr);
+    free(startAryUL);
+    free(lenAryUI);
+    free(bbMinzAry);
+    free(minzAry);
+    free(diagAryL);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-5: Write the consensus & clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(errUC != 1)
+    { /*If had an error*/
+        free(conCStr);
+        return errUC;
+    } /*If had an error*/
+
+    /*The consensus is made in the runs scratch directory, so the
+      directory is left out of the header*/
+    conNameCStr =
+        conBin->consensusCStr + strlen(conBin->consensusCStr);
+
+    while(
+          conNameCStr > conBin->consensusCStr
+       && *(conNameCStr - 1) != '/'
+    ) --conNameCStr;
+
+    inFILE = fopen(conBin->consensusCStr, "w");
+
+    if(inFILE == 0)
+    { /*If could not make the consensus file*/
+        free(conCStr);
+        return 2;
+    } /*If could not make the consensus file*/
+
+    fprintf(inFILE, ">%s\n%s\n", conNameCStr, conCStr);
+    fclose(inFILE);
+
+    settings->lenConUL = lenConUI;
+    free(conCStr);
+    return 1;
+} /*buildConWithPoa*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: poaStruct to have default settings
+\---------------------------------------------------------------------*/
+void initPoaStruct(
+    struct poaStruct *poaSettings
+    /*struct to set to default values in defaultSettings.h*/
+) /*Sets input structers variables to default settings*/
+{ /*initPoaStruct*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-15 TOC: Sec-1 Sub-1: initPoaStruct
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    poaSettings->usePoaBl = defUsePoaCon;
+    poaSettings->rndsPoaUC = defRoundsPoa;
+    poaSettings->bandUI = defPoaBandUI;
+    poaSettings->lenConUL = 0;
+
+    return;
+} /*initPoaStruct*/
@@ -6,6 +6,12 @@
 #   - "trimSam.h"
 #   - "fqAndFaFun.h"
 #   - "readExtract.h"
+#   - "readMapFun.h"
+#   - "fqArenaFun.h"
+#   - "benchTimeFun.h"
+#   - "poaConFun.h"
+#   - "kmerSketchFun.h"
+#   o "FCIStatsFun.h"
 #   o "defaultSettings.h"
 #   o "cStrFun.h"
 #   o "cStrToNumberFun.h"
@@ -24,6 +30,8 @@
 #   o <stdlib.h>
 #   o <stdio.h>
 #   o <stdint.h>
+#   o <pthread.h>
+#   o <time.h>
 ######################################################################*/
 
 #ifndef BUILDCONFUN_H
@@ -32,6 +40,11 @@
 #include "trimSam.h"
 #include "readExtract.h"
 #include "fqAndFaFun.h"
+#include "readMapFun.h"
+#include "fqArenaFun.h"
+#include "benchTimeFun.h"
+#include "poaConFun.h"
+#include "kmerSketchFun.h"
 
 /*---------------------------------------------------------------------\
 | Struct-1: majCon
@@ -46,6 +59,7 @@ typedef struct majConStruct
    float minReadsPercBaseFlt;/*Min % of supporting reads to keep base*/
    float minReadsPercInsFlt; /*Min % of supporting reads to keep ins*/
    unsigned long lenConUL;   /*Holds length of ouput consensus*/
+   char inMapBl;             /*1: Map with built in mapper (-in-map)*/
 }majConStruct;
 
 /*---------------------------------------------------------------------\
@@ -74,7 +88,21 @@ typedef struct medakaStruct
 }medakaStruct;
 
 /*---------------------------------------------------------------------\
-| Struct-4: conuildStruct
+| Struct-4: poaStruct
+| Use:
+|    - Holds settings for the built in partial order alignment (POA)
+|      consensus (poaConFun.h)
+\---------------------------------------------------------------------*/
+typedef struct poaStruct
+{ /*poaStruct*/
+   unsigned char usePoaBl;   /*1: use the POA consensus step*/
+   unsigned char rndsPoaUC;  /*Number of rounds to build with POA*/
+   uint32_t bandUI;          /*Bases on each side of a reads diagonal*/
+   unsigned long lenConUL;   /*Holds length of ouput consensus*/
+}poaStruct;
+
+/*---------------------------------------------------------------------\
+| Struct-5: conuildStruct
 | Use:
 |    - Holds settings for consensus building
 \---------------------------------------------------------------------*/
@@ -83,6 +111,11 @@ typedef struct conBuildStruct
     char useStatBl;
          /*1: Use a stats file instead of read median-Q for finding a
               good read to build with*/
+    char readArenaBl;
+         /*1: Keep a bins reads in memory while clustering it*/
+    char batchAssignBl;
+         /*1: Reassign all of a bins reads to its consensuses at once
+              after clustering*/
     unsigned char clustUC;
         /*The cluster number to assign to the consensus*/
     uint32_t numRndsToPolishUI;
@@ -91,6 +124,10 @@ typedef struct conBuildStruct
          /*Min number of reads needed to build a consensus*/
     uint64_t maxReadsToBuildConUL;
          /*Max number of reads to build a consensus with*/
+    uint32_t preselMultUI;
+         /*Only map preselMultUI * maxReadsToBuildConUL reads (the
+           ones most like the best read) to find the reads to build
+           with. 0 maps all reads*/
     uint64_t numReadsForConUL;
          /*Number of reads deticated to building the consensus*/
     /*Min length to keep consensus built by majority consensus*/
@@ -98,30 +135,47 @@ typedef struct conBuildStruct
 
     unsigned long lenConUL;   /*Holds length of ouput consensus*/
         /*Here so user does not need to access internal structers*/
+    unsigned long numSkipConUL;
+        /*Number of consensus pairs cmpCons skipped because their k-mer
+          sketches were to different*/
 
     /*Settings for the consensus building step*/
     struct majConStruct majConSet;
     struct raconStruct raconSet;
+    struct poaStruct poaSet;
     struct medakaStruct medakaSet;
 }condBuildStruct;
 
 /*---------------------------------------------------------------------\
-| Struct-5: baseStruct
+| Struct-6: insBase
+| Use:
+|    - Holds a single kept insertion base from a read. Insertions are
+|      kept in a side table, since most positions have no insertions.
+\---------------------------------------------------------------------*/
+typedef struct insBase
+{ /*insBase*/
+    uint32_t posUI;  /*Reference position the insertion is before*/
+    uint32_t slotUI; /*Base number in the insertion (0 is first base)*/
+    uint8_t colUC;   /*Pileup column for base (0=A,1=C,2=G,3=T,4=N)*/
+}insBase;
+
+/*---------------------------------------------------------------------\
+| Struct-7: majConPile
 | Use:
-|    - Holds the base, error type (if insertion or deletion), & a
-|      counter for number of reads with the same base.
+|    - Holds the pileup for the majority consensus. Each reference
+|      position has five counters (A, C, G, T, & other) in baseCntAryUI,
+|      so votes are added by indexing with the reads position.
 \---------------------------------------------------------------------*/
-typedef struct baseStruct
-{ /*baseStruct*/
-    char baseChar;     /*What is the base (0 for deletion)*/
-    char errTypeChar;  /*0 = match, 1 = SNP, 2 = insertion*/
-    
-   /*Recored number of reads that supported this base (good quality)*/
-   unsigned long numSupReadsUL;
+typedef struct majConPile
+{ /*majConPile*/
+    char *refSeqCStr;         /*Reference sequence for the pileup*/
+    unsigned long lenRefUL;   /*Number of bases in refSeqCStr*/
+    uint32_t *baseCntAryUI;   /*Counts, five entries per position*/
 
-   struct baseStruct *altBase; /*Alternate options for the base*/
-   struct baseStruct *nextBase; /*For linked lists*/
-}baseStruct;
+    struct insBase *insAry;   /*Kept insertion bases from all reads*/
+    unsigned long numInsUL;   /*Number of insertions in insAry*/
+    unsigned long lenInsAryUL;/*Number of insertions insAry can hold*/
+}majConPile;
 
 /*---------------------------------------------------------------------\
 | Output:
@@ -155,6 +209,7 @@ unsigned char buildCon(
 |      - Fasta file with the consensus
 |    o Modifies:
 |      - clustOn->consensusCStr to have file name of created consensus 
+|      - clustOn->sketchST to have the k-mer sketch of the consensus
 |    o Returns:
 |      - 1 for success
 |      - 2 or 4 for file errors
@@ -199,6 +254,23 @@ void buildConWithRacon(
     struct readBin *conBin          /*Bin working on*/
 ); /*Builds a consensus using racon*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|    - Creates:
+|        o Fasta file with the consensus (name in conBin->consensusCStr)
+|    - Returns:
+|        o 1 if built a consensus
+|        o 2 if could not open or read the best read or consensus
+|        o 4 if could not open the top reads file
+|        o 16 if no reads aligned to the best read or consensus
+|        o 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+uint8_t buildConWithPoa(
+    struct poaStruct *settings, /*Settings for the POA consensus*/
+    unsigned char *clustUC,     /*Cluster on*/
+    struct readBin *conBin      /*Bin working on*/
+); /*Builds a consensus with the built in partial order alignment*/
+
 /*---------------------------------------------------------------------\
 | Output:
 |    Modifies:
@@ -222,8 +294,13 @@ unsigned char medakaPolish(
 |        - readBin Struct with the closest consensus
 |    - Modifies:
 |        - closesConUint to hold the score of the most similar consensus
+|        - numSkipUL is incremented for each consensus skipped because
+|          its k-mer sketch was to different
 | Note:
 |    - clusters with ->balUChar < 0 will be ignored
+|    - Consensuses estimated (k-mer sketch) to be more than
+|      minStats->minDiffFlt + minStats->sketchMarginFlt different are
+|      not mapped
 \---------------------------------------------------------------------*/
 struct readBin * cmpCons(
     struct readBin *conBin,       /*Bin with consensus to compare*/
@@ -231,31 +308,45 @@ struct readBin * cmpCons(
     struct samEntry *samStruct,   /*Struct to hold input from minimap2*/
     struct samEntry *refStruct,   /*Struct to hold input from minimap2*/
     struct minAlnStats *minStats, /*Min stats needed to keep a error*/
-    char *threadsCStr            /*Number threads to use with Minimap2*/
+    char *threadsCStr,           /*Number threads to use with Minimap2*/
+    unsigned long *numSkipUL     /*Number of pairs the sketches skip*/
 ); /*Compares a consenses to a another consensus. This will do a
     recursive call if conBinTree has children*/
 
 /*---------------------------------------------------------------------\
 | Output:
-|   o Returns:
-|     - The next base in the list (if altBase != 0, returns altBase)
+|    - Returns:
+|        o 1 if compared all consensuses
+|        o 2 if could not make the multi-fasta file
+|        o 32 if minimap2 did not output a sam file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o simAryC[i * numConUL + j] & simAryC[j * numConUL + i] are
+|          set to 1 if consensus i & j are to similar, else 0
+|    - File:
+|        o Makes allConFaCStr, which is removed at the end
+\---------------------------------------------------------------------*/
+uint8_t cmpAllCons(
+    struct readBin **conAry,      /*Clusters with consensuses*/
+    unsigned long numConUL,       /*Number of clusters in conAry*/
+    char *allConFaCStr,           /*Name of multi-fasta to make*/
+    char *simAryC,                /*Gets the similarity matrix*/
+    struct samEntry *samStruct,   /*Struct to hold input from minimap2*/
+    struct minAlnStats *minStats, /*Min stats needed to keep a error*/
+    char *threadsCStr            /*Number threads to use with Minimap2*/
+); /*Maps all consensuses to each other with one minimap2 call & marks
+    the pairs of consensuses that are to similar*/
+
+/*---------------------------------------------------------------------\
+| Output:
 |   o Frees:
-|     - The baseToFree from memory
+|     - All heap allocated variables in pileST
 |   o Modifies:
-|     - If their is an alternative base (baseToFree->altBase != 0)
-|         o lastBase->nextBase is set to baseToFree->altBase
-|         o bastToFree is set to bastToFree->altBase
-|     - If their is not alternative base (bastToFree->altBase == 0)
-|         o lastBase->nextBase is set to baseToFree->nextBase
-|         o bastToFree is set to 0
-| Note:
-|    o This function assumes that the next base pointer (nextBase) is
-|      is alwasy 0 (not set) for teh alternate base pointer (altBase==0)
+|     - Sets all pointers & lengths in pileST to 0
 \---------------------------------------------------------------------*/
-struct baseStruct * freeBaseStruct(
-    struct baseStruct **baseToFree, /*Insertion list to free*/
-    struct baseStruct *lastBase     /*Base to assign pointers to*/
-); /*Frees an base from a linked list of bases*/
+void freeMajConPile(
+    struct majConPile *pileST /*Pileup to free*/
+); /*Frees the heap variables in a majority consensus pileup*/
 
 /*---------------------------------------------------------------------\
 | Output: Modifies: majConStruct to have default settings
@@ -273,6 +364,14 @@ void initRaconStruct(
     /*struct to set to default values in defaultSettings.h*/
 ); /*Sets input structers variables to default settings*/
 
+/*---------------------------------------------------------------------\
+| Output: Modifies: poaStruct to have default settings
+\---------------------------------------------------------------------*/
+void initPoaStruct(
+    struct poaStruct *poaSettings
+    /*struct to set to default values in defaultSettings.h*/
+); /*Sets input structers variables to default settings*/
+
 /*---------------------------------------------------------------------\
 | Output: Modifies: medakaStruct to have default settings
 \---------------------------------------------------------------------*/
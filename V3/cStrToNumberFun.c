@@ -26,6 +26,10 @@
 '        - Converts backwards numeric c-string to uint32_t
 '    fun-5 uCharToCStr:
 '        - Converts number in char to c-string
+'    fun-6 cStrToInt16:
+'        - Converts c-string to int16_t (short)
+'    fun-7 uIntToCStr:
+'        - Converts number in uint32_t to c-string
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*######################################################################
@@ -431,3 +435,40 @@ char * cStrToInt16(
 
     return cStrToCnvt;
 } // cStrToInt16
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - buffCStr to be c-string with the converted number
+|    Returns:
+|        - pointer to end of bufferCStr (will point to '\0')
+\----------------------------------------------------------------------*/
+char * uIntToCStr(
+    char *buffCStr,      /*Buffer to hold output c-string (11 elements)*/
+    uint32_t uIntToCnvt  /*Number to convert to numeric c-string*/
+) /*converts unsigned integer value to a numeric c-string*/
+{ /*uIntToCStr*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: Sec-1 Sub-1: uIntToCStr
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char backwardsCStr[10]; /*Holds digits in reverse order*/
+    uint8_t numDigitsUC = 0;
+
+    do { /*Loop till have converted every digit*/
+        backwardsCStr[numDigitsUC] = (uIntToCnvt % 10) + 48;
+        uIntToCnvt = uIntToCnvt / 10; /*Move to next digit*/
+        ++numDigitsUC;
+    } while(uIntToCnvt > 0); /*Loop till have converted every digit*/
+
+    while(numDigitsUC > 0)
+    { /*While have digits to copy (reverse order)*/
+        --numDigitsUC;
+        *buffCStr = backwardsCStr[numDigitsUC];
+        ++buffCStr;
+    } /*While have digits to copy (reverse order)*/
+
+    *buffCStr = '\0';
+    return buffCStr;
+} /*uIntToCStr*/
@@ -92,4 +92,16 @@ char * cStrToInt16(
    '  - Convert a c-string to an int16_t (short)
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - buffCStr to be c-string with the converted number
+|    Returns:
+|        - pointer to end of bufferCStr (will point to '\0')
+\----------------------------------------------------------------------*/
+char * uIntToCStr(
+    char *buffCStr,      /*Buffer to hold output c-string (11 elements)*/
+    uint32_t uIntToCnvt  /*Number to convert to numeric c-string*/
+); /*converts unsigned integer value to a numeric c-string*/
+
 #endif
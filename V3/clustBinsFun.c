@@ -0,0 +1,514 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF TOC: Start of Functions
+'   fun-1 clustBin:
+'     - Split a single bin into clusters and build their consensuses
+'   fun-2 clustBinsThread:
+'     - Cluster bins (with clustBin) until no bins are left
+'   fun-3 clustBins:
+'     - Cluster a set of bins, with one or more threads
+'~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "clustBinsFun.h"
+
+pthread_mutex_t clustBinsMutex; /*Locks the next bin counter*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - clustOn->rightChild to hold the list of clusters in the bin
+|        - keptReadsUL to hold the number of reads kept in clusters
+|        - With conSet->batchAssignBl, the clusters fastq files are
+|          remade by mapping all reads to all consensuses at once
+|    Note:
+|        - clustOn->leftChild is cleared while clustering, so only the
+|          clusters in this bin are compared. It is restored at the end.
+\---------------------------------------------------------------------*/
+uint8_t clustBin(
+    struct readBin *clustOn,       /*Bin to cluster*/
+    char skipClustBl,              /*1: Only build a consensus*/
+    char *threadsCStr,             /*Number threads for minimap2*/
+    struct conBuildStruct *conSet, /*Settings for consensus building*/
+    struct samEntry *samStruct,    /*Holds minimap2 output*/
+    struct samEntry *refStruct,    /*Holds best read or consensus*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats, /*Read cluster socring set*/
+    struct minAlnStats *conToConMinStats,  /*Consensus comparison set*/
+    unsigned long *keptReadsUL     /*Number of reads kept in clusters*/
+) /*Splits a bin into clusters & builds a consensus for each cluster*/
+{ /*clustBin*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: clustBin
+    '    fun-1 sec-1: Variable declerations
+    '    fun-1 sec-2: Set up readBin to hold a clusters files
+    '    fun-1 sec-3: Build the consensus
+    '    fun-1 sec-4: Bin reads to the consensus
+    '    fun-1 sec-5: Compare new consensus to old consensuses
+    '    fun-1 sec-6: Update list of clusters in bin
+    '    fun-1 sec-7: Clean up (& batch read assignment)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    double startDbl = 0;           /*Start time of a stage*/
+
+    struct readBin *bestBin = 0;   /*Bin with most similar consensus*/
+    struct readBin *lastClust = clustOn; /*Last cluster in the bin*/
+    struct readBin *tmpBin = 0;    /*Cluster working on*/
+    struct readBin *nextBin = clustOn->leftChild; /*To restore list*/
+
+    conSet->clustUC = 0;
+    *keptReadsUL = 0;
+
+    /*cmpCons also checks the bins after clustOn. Those bins may be
+      in the middle of clustering on another thread, so are hidden*/
+    clustOn->leftChild = 0;
+
+    if(
+          (conSet->readArenaBl & 1)
+       && clustOn->numReadsULng >= conSet->minReadsToBuildConUL
+    ) { /*If keeping the bins reads in memory (-read-arena)*/
+        errUC =
+            loadFqArena(
+                clustOn,
+                conSet->useStatBl & (clustOn->statPathCStr[0] != '\0')
+            );
+
+        if(errUC & 64)
+        { /*If had a memory allocation error*/
+            clustOn->leftChild = nextBin;
+            return 64;
+        } /*If had a memory allocation error*/
+
+        /*2: not a four line fastq, so cluster with the fastq files*/
+    } /*If keeping the bins reads in memory (-read-arena)*/
+
+    while(clustOn->numReadsULng >= conSet->minReadsToBuildConUL)
+    { /*While have reads to bin*/
+
+        /**************************************************************\
+        * Fun-1 Sec-2: Set up readBin to hold a clusters files
+        \**************************************************************/
+
+        errUC = 0; /*reset*/
+
+        if(tmpBin == 0)
+            tmpBin = malloc(sizeof(struct readBin));
+
+        if(tmpBin == 0)
+        { /*If had a memory allocation error*/
+            doneFqArena(clustOn, 0);
+            clustOn->leftChild = nextBin;
+            return 64;
+        } /*If had a memory allocation error*/
+
+        blankReadBin(tmpBin);
+        tmpBin->balUChar = 1; /*To mark keeping*/
+
+        /**************************************************************\
+        * Fun-1 Sec-3: Build the consensus
+        \**************************************************************/
+
+        errUC  =
+            buildCon(
+                clustOn,
+                0,           /*Path to fasta file with reference*/
+                threadsCStr, /*# threads to use with system calls*/
+                conSet,      /*settings for building a consensus*/
+                samStruct,   /*Will hold sam file data*/
+                refStruct,   /*For read median Q extraction*/
+                readToReadMinStats,
+                readToConMinStats
+        ); /*Builds a consensus using fastq file & best read*/
+
+        if(errUC & 16)
+            continue;
+            /*Unable to build consensus, let loop terminate*/
+
+        if(errUC & 64)
+        { /*If had a memory allocation error*/
+            freeReadBin(&tmpBin);
+            doneFqArena(clustOn, 0);
+            clustOn->leftChild = nextBin;
+            return 64;
+        } /*If had a memory allocation error*/
+
+        /**************************************************************\
+        * Fun-1 Sec-4: Bin reads to the consensus
+        \**************************************************************/
+
+        /*Copy the consensus name & sketch to the clusters bin*/
+        strcpy(tmpBin->consensusCStr, clustOn->consensusCStr);
+        tmpBin->sketchST = clustOn->sketchST;
+
+        if(skipClustBl & 1)
+        { /*If not clustering, move onto the next bin*/
+            lastClust->rightChild = tmpBin;
+            /*So can merge bins durning consensus comparisions*/
+            tmpBin->numReadsULng = lastClust->numReadsULng;
+            *keptReadsUL += tmpBin->numReadsULng;
+
+            strcpy(tmpBin->fqPathCStr, lastClust->fqPathCStr);
+            lastClust->fqPathCStr[0] = '\0';/*avoid deleting at end*/
+
+            /*Hand the bins read list (if any) to the cluster*/
+            tmpBin->arenaST = lastClust->arenaST;
+            tmpBin->headL = lastClust->headL;
+            tmpBin->tailL = lastClust->tailL;
+            tmpBin->dirtyBl = lastClust->dirtyBl;
+            lastClust->headL = -1;
+            lastClust->tailL = -1;
+            tmpBin = 0;
+            break;        /*If not clusterin, move to next bin*/
+        } /*If not clustering, move onto the next bin*/
+
+        startDbl = getBenchTime();
+
+        binReadToCon(
+            &conSet->clustUC,  /*Cluster on*/
+            clustOn,           /*Bin working on*/
+            tmpBin,            /*Bin to hold the cluster*/
+            samStruct,         /*To hold temporary input*/
+            readToConMinStats, /*Settings to keep read to con*/
+            threadsCStr        /*# threads to use with Minimap2*/
+        ); /*Find reads that mapp to the consensus*/
+
+        addBenchTime(benchReadToConUC, startDbl);
+
+        /*Find how many reads were kept in clustering*/
+        *keptReadsUL += tmpBin->numReadsULng;
+
+        /**************************************************************\
+        * Fun-1 Sec-5: Compare new consensus to old consensuses
+        \**************************************************************/
+
+        *clustOn->consensusCStr = '\0';
+        startDbl = getBenchTime();
+
+        bestBin =
+            cmpCons(
+                tmpBin,           /*Bin with consensus to compare*/
+                clustOn,          /*Other clusters to comapre to*/
+                samStruct,        /*Struct to hold input from minimap2*/
+                refStruct,        /*Struct to hold input from minimap2*/
+                conToConMinStats, /*Cons to consensus thresholds*/
+                threadsCStr,     /*Number threads to use with Minimap2*/
+                &conSet->numSkipConUL /*Pairs skipped by the sketches*/
+        ); /*Compares a consenses to other consensuses*/
+
+        addBenchTime(benchCmpConsUC, startDbl);
+
+        /**************************************************************\
+        * Fun-1 Sec-6: Update list of clusters in bin
+        \**************************************************************/
+
+        if(bestBin != 0)
+        { /*If the consensuses are to similar (the same?)*/
+            if(tmpBin->arenaST != 0)
+                mergeArenaBins(bestBin, tmpBin);
+            else
+                mergeBins(bestBin, tmpBin);
+
+            continue; /*This cluster is not worth keeping*/
+        } /*If the consensuses are to similar (the same?)*/
+
+        /*else add this bin to the end of the list*/
+        lastClust->rightChild = tmpBin;
+        lastClust = tmpBin;
+        tmpBin = 0;
+        ++conSet->clustUC;
+    } /*While have reads to bin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-7: Clean up (& batch read assignment)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(tmpBin != 0)
+        freeReadBin(&tmpBin); /*Make sure no loose ends*/
+
+    /*Write the bins & clusters fastq files from the read arena*/
+    doneFqArena(clustOn, 1);
+
+    if(
+          (conSet->batchAssignBl & 1)
+       && !(skipClustBl & 1)
+       && clustOn->rightChild != 0
+       && clustOn->rightChild->rightChild != 0
+    ) { /*If moving each read to the consensus it maps best to*/
+        startDbl = getBenchTime();
+
+        errUC =
+            binReadsToCons(
+                clustOn,           /*Bin with the clusters*/
+                samStruct,         /*To hold temporary input*/
+                readToConMinStats, /*Settings to keep read to con*/
+                threadsCStr        /*# threads to use with Minimap2*/
+            ); /*Map to all consensuses at once*/
+
+        addBenchTime(benchReadToConUC, startDbl);
+
+        if(errUC & 64)
+        { /*If had a memory allocation error*/
+            clustOn->leftChild = nextBin;
+            return 64;
+        } /*If had a memory allocation error*/
+
+        /*2: could not remap, so the first pass clusters are kept*/
+        *keptReadsUL = 0;
+
+        for(
+            tmpBin = clustOn->rightChild;
+            tmpBin != 0;
+            tmpBin = tmpBin->rightChild
+        ) *keptReadsUL += tmpBin->numReadsULng;
+    } /*If moving each read to the consensus it maps best to*/
+
+    clustOn->leftChild = nextBin;
+    return 1;
+} /*clustBin*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - errAryUC & keptAryUL in parmST for each bin clustered
+|    Returns: 0
+\---------------------------------------------------------------------*/
+void * clustBinsThread(
+    void *parmST /*clustBinsST structer with settings*/
+) /*Clusters bins until no bins are left to cluster*/
+{ /*clustBinsThread*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: clustBinsThread
+    '    fun-2 sec-1: Variable declerations
+    '    fun-2 sec-2: Cluster bins till no bins are left
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct clustBinsST *clustST = (struct clustBinsST *) parmST;
+    unsigned long binUL = 0; /*Bin this thread is working on*/
+
+    struct samEntry samStruct; /*Holds minimap2 output for this thread*/
+    struct samEntry refStruct; /*Holds best read for this thread*/
+
+    initSamEntry(&samStruct);
+    initSamEntry(&refStruct);
+
+    /*cmpCons reads the consensus into refStruct without allocating a
+      buffer first, so start with the same buffer readSamLine makes*/
+    samStruct.samEntryCStr = malloc(sizeof(char) * 1401);
+    refStruct.samEntryCStr = malloc(sizeof(char) * 1401);
+    samStruct.lenBuffULng = 1400;
+    refStruct.lenBuffULng = 1400;
+
+    if(samStruct.samEntryCStr == 0 || refStruct.samEntryCStr == 0)
+    { /*If had a memory allocation error*/
+        pthread_mutex_lock(&clustBinsMutex);
+        binUL = *clustST->nextBinUL;
+        ++(*clustST->nextBinUL);
+        pthread_mutex_unlock(&clustBinsMutex);
+
+        if(binUL < clustST->numBinsUL)
+            clustST->errAryUC[binUL] = 64; /*Report the memory error*/
+
+        freeStackSamEntry(&samStruct);
+        freeStackSamEntry(&refStruct);
+        return 0;
+    } /*If had a memory allocation error*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-2: Cluster bins till no bins are left
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(1)
+    { /*While have bins to cluster*/
+        pthread_mutex_lock(&clustBinsMutex);
+        binUL = *clustST->nextBinUL;
+        ++(*clustST->nextBinUL);
+        pthread_mutex_unlock(&clustBinsMutex);
+
+        if(binUL >= clustST->numBinsUL)
+            break; /*No bins left to cluster*/
+
+        clustST->errAryUC[binUL] =
+            clustBin(
+                clustST->binAry[binUL],
+                clustST->skipClustBl,
+                clustST->threadsCStr,
+                &clustST->conSet,
+                &samStruct,
+                &refStruct,
+                &clustST->readToReadMinStats,
+                &clustST->readToConMinStats,
+                &clustST->conToConMinStats,
+                &clustST->keptAryUL[binUL]
+        ); /*Cluster the bin*/
+
+        if(clustST->errAryUC[binUL] & 64)
+            break; /*Memory error, let the other threads finish*/
+    } /*While have bins to cluster*/
+
+    freeStackSamEntry(&samStruct);
+    freeStackSamEntry(&refStruct);
+
+    return 0;
+} /*clustBinsThread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - errAryUC to have the clustBin return value for each bin
+|        - keptAryUL to have the number of kept reads for each bin
+|    Note:
+|        - threadsCStr is split between the bins clustered at once
+\---------------------------------------------------------------------*/
+uint8_t clustBins(
+    struct readBin **binAry,       /*Bins to cluster*/
+    unsigned long numBinsUL,       /*Number of bins in binAry*/
+    uint32_t binThreadsUI,         /*Number bins to cluster at once*/
+    char *threadsCStr,             /*Total threads for minimap2*/
+    char skipClustBl,              /*1: Only build a consensus*/
+    struct conBuildStruct *conSet, /*Settings for consensus building*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats, /*Read cluster socring set*/
+    struct minAlnStats *conToConMinStats,  /*Consensus comparison set*/
+    uint8_t *errAryUC,             /*Gets errors for each bin*/
+    unsigned long *keptAryUL       /*Gets kept reads for each bin*/
+) /*Clusters a set of bins, using multiple threads when asked*/
+{ /*clustBins*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: clustBins
+    '    fun-3 sec-1: Variable declerations
+    '    fun-3 sec-2: Split the threads between the bins
+    '    fun-3 sec-3: Set up the settings for each thread
+    '    fun-3 sec-4: Cluster the bins
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t threadsUI = 0;      /*Threads each worker gives minimap2*/
+    uint32_t numStartedUI = 0;   /*Number of threads launched*/
+    unsigned long nextBinUL = 0; /*Next bin to cluster*/
+
+    pthread_t *threadsAry = 0;
+    struct clustBinsST *clustAryST = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-2: Split the threads between the bins
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(numBinsUL == 0)
+        return 1; /*Nothing to do*/
+
+    if(binThreadsUI > numBinsUL)
+        binThreadsUI = numBinsUL; /*No point in having idle threads*/
+
+    if(binThreadsUI < 1)
+        binThreadsUI = 1;
+
+    cStrToUInt(threadsCStr, &threadsUI);
+    threadsUI /= binThreadsUI;
+
+    if(threadsUI < 1)
+        threadsUI = 1;
+
+    for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+    { /*Loop: blank the return values*/
+        errAryUC[ulBin] = 0;
+        keptAryUL[ulBin] = 0;
+    } /*Loop: blank the return values*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-3: Set up the settings for each thread
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    threadsAry = malloc(sizeof(pthread_t) * binThreadsUI);
+
+    if(threadsAry == 0)
+        return 64;
+
+    clustAryST = malloc(sizeof(struct clustBinsST) * binThreadsUI);
+
+    if(clustAryST == 0)
+    { /*If had a memory allocation error*/
+        free(threadsAry);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    for(uint32_t uiThread = 0; uiThread < binThreadsUI; ++uiThread)
+    { /*Loop: Initalize the thread values*/
+        clustAryST[uiThread].skipClustBl = skipClustBl;
+        uIntToCStr(clustAryST[uiThread].threadsCStr, threadsUI);
+
+        clustAryST[uiThread].binAry = binAry;
+        clustAryST[uiThread].numBinsUL = numBinsUL;
+        clustAryST[uiThread].nextBinUL = &nextBinUL;
+
+        clustAryST[uiThread].errAryUC = errAryUC;
+        clustAryST[uiThread].keptAryUL = keptAryUL;
+
+        /*Each thread needs its own copy, since these are modified*/
+        clustAryST[uiThread].conSet = *conSet;
+        clustAryST[uiThread].conSet.numSkipConUL = 0;
+        clustAryST[uiThread].readToReadMinStats = *readToReadMinStats;
+        clustAryST[uiThread].readToConMinStats = *readToConMinStats;
+        clustAryST[uiThread].conToConMinStats = *conToConMinStats;
+    } /*Loop: Initalize the thread values*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-4: Cluster the bins
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    pthread_mutex_init(&clustBinsMutex, 0); /*intiate my mutext*/
+
+    if(binThreadsUI > 1)
+    { /*If working with multiple threads*/
+        for(uint32_t uiThread = 0; uiThread < binThreadsUI; ++uiThread)
+        { /*Loop: Launch threads*/
+            if(
+                pthread_create(
+                    &threadsAry[numStartedUI],
+                    0,
+                    clustBinsThread,
+                    &clustAryST[uiThread]
+                ) != 0
+            ) break; /*If could not launch, use the launched threads*/
+
+            ++numStartedUI;
+        } /*Loop: Launch threads*/
+    } /*If working with multiple threads*/
+
+    if(numStartedUI == 0)
+        clustBinsThread(&clustAryST[0]); /*Only one thread*/
+
+    /*Join all threads so have not loose threads*/
+    for(uint32_t uiThread = 0; uiThread < numStartedUI; ++uiThread)
+        pthread_join(threadsAry[uiThread], 0);
+
+    /*Each thread counted its own skipped consensus pairs*/
+    for(uint32_t uiThread = 0; uiThread < binThreadsUI; ++uiThread)
+        conSet->numSkipConUL +=
+            clustAryST[uiThread].conSet.numSkipConUL;
+
+    pthread_mutex_destroy(&clustBinsMutex);
+
+    free(threadsAry);
+    free(clustAryST);
+
+    return 1;
+} /*clustBins*/
@@ -0,0 +1,116 @@
+/*######################################################################
+# Use:
+#   o Holds functions to cluster reads in a list of bins. Each bin is
+#     independent of the other bins, so multiple bins can be clustered
+#     at the same time.
+# Includes:
+#   - "buildConFun.h"
+#   - "binReadsFun.h"
+#   o "trimSam.h"
+#   o "readExtract.h"
+#   o "fqAndFaFun.h"
+#   o "cStrFun.h"
+#   o "cStrToNumberFun.h"
+#   o "findCoInftBinTree.h"
+#   o "findCoInftChecks.h"
+#   o "samEntryStruct.h"
+#   o "defaultSettings.h"
+# C standard libraries:
+#   o <pthread.h>
+#   o <string.h>
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef CLUSTBINSFUN_H
+#define CLUSTBINSFUN_H
+
+#include <pthread.h> /*For multi-threading*/
+#include "buildConFun.h" /*Consensus building & comparing*/
+#include "binReadsFun.h" /*Binning reads to a consensus*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: clustBinsST
+|   o Holds the settings for one thread in clustBins. Every thread has
+|     its own copy of the settings, so no locks are needed for them.
+\---------------------------------------------------------------------*/
+typedef struct clustBinsST
+{ /*clustBinsST*/
+    char skipClustBl;         /*1: Only build a consensus for a bin*/
+    char threadsCStr[11];     /*Threads this worker gives minimap2*/
+
+    struct readBin **binAry;  /*Bins to cluster*/
+    unsigned long numBinsUL;  /*Number of bins in binAry*/
+    unsigned long *nextBinUL; /*Next bin to cluster (shared)*/
+
+    uint8_t *errAryUC;        /*Error returned for each bin*/
+    unsigned long *keptAryUL; /*Number of reads kept for each bin*/
+
+    struct conBuildStruct conSet;           /*Consensus settings*/
+    struct minAlnStats readToReadMinStats; /*Read pull settings*/
+    struct minAlnStats readToConMinStats;  /*Read cluster settings*/
+    struct minAlnStats conToConMinStats;   /*Consensus compare set*/
+}clustBinsST;
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - clustOn->rightChild to hold the list of clusters in the bin
+|        - keptReadsUL to hold the number of reads kept in clusters
+|    Note:
+|        - clustOn->leftChild is cleared while clustering, so only the
+|          clusters in this bin are compared. It is restored at the end.
+\---------------------------------------------------------------------*/
+uint8_t clustBin(
+    struct readBin *clustOn,       /*Bin to cluster*/
+    char skipClustBl,              /*1: Only build a consensus*/
+    char *threadsCStr,             /*Number threads for minimap2*/
+    struct conBuildStruct *conSet, /*Settings for consensus building*/
+    struct samEntry *samStruct,    /*Holds minimap2 output*/
+    struct samEntry *refStruct,    /*Holds best read or consensus*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats, /*Read cluster socring set*/
+    struct minAlnStats *conToConMinStats,  /*Consensus comparison set*/
+    unsigned long *keptReadsUL     /*Number of reads kept in clusters*/
+); /*Splits a bin into clusters & builds a consensus for each cluster*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - errAryUC & keptAryUL in parmST for each bin clustered
+|    Returns: 0
+\---------------------------------------------------------------------*/
+void * clustBinsThread(
+    void *parmST /*clustBinsST structer with settings*/
+); /*Clusters bins until no bins are left to cluster*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - errAryUC to have the clustBin return value for each bin
+|        - keptAryUL to have the number of kept reads for each bin
+|    Note:
+|        - threadsCStr is split between the bins clustered at once
+\---------------------------------------------------------------------*/
+uint8_t clustBins(
+    struct readBin **binAry,       /*Bins to cluster*/
+    unsigned long numBinsUL,       /*Number of bins in binAry*/
+    uint32_t binThreadsUI,         /*Number bins to cluster at once*/
+    char *threadsCStr,             /*Total threads for minimap2*/
+    char skipClustBl,              /*1: Only build a consensus*/
+    struct conBuildStruct *conSet, /*Settings for consensus building*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats, /*Read cluster socring set*/
+    struct minAlnStats *conToConMinStats,  /*Consensus comparison set*/
+    uint8_t *errAryUC,             /*Gets errors for each bin*/
+    unsigned long *keptAryUL       /*Gets kept reads for each bin*/
+); /*Clusters a set of bins, using multiple threads when asked*/
+
+#endif
@@ -0,0 +1,1940 @@
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF TOC: Start of Functions
+'   fun-1 initGraphClustSet:
+'     - Sets a graphClustSet structure to the default settings
+'   fun-2 getGraphEdges:
+'     - Finds the most similar reads (edges) for each read in an arena
+'   fun-3 makeReadGraph:
+'     - Makes a read graph with every read out of the graph
+'   fun-4 freeReadGraph:
+'     - Frees a read graph
+'   fun-5 graphMvToNewClust:
+'     - Moves a read into its own (new) cluster
+'   fun-6 graphMvToClust:
+'     - Moves a single read cluster (or new read) into a cluster
+'   fun-7 graphBreakClust:
+'     - Breaks a cluster into single read clusters
+'   fun-8 graphMergeClust:
+'     - Merges the smaller of two clusters into the larger cluster
+'   fun-9 graphClustReads:
+'     - Clusters the reads in a read graph using their edges
+'   fun-10 graphSplitBin:
+'     - Splits a bin into all of its read graph clusters
+'   fun-11 graphConFileName:
+'     - Makes the name a graph clusters file has after its consensus
+'   fun-12 graphBuildCon:
+'     - Builds the consensus for one read graph cluster
+'   fun-13 graphClustThread:
+'     - Splits bins or builds consensuses until none are left
+'   fun-14 graphClustBins:
+'     - Clusters a set of bins with the read graph
+'~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "clustGraphFun.h"
+
+pthread_mutex_t graphClustMutex; /*Locks the next bin/cluster counter*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: graphSet to have the defaults in defaultSettings.h
+\---------------------------------------------------------------------*/
+void initGraphClustSet(
+    struct graphClustSet *graphSet /*Structure to set to defaults*/
+) /*Sets a graphClustSet structure to the default settings*/
+{ /*initGraphClustSet*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: Sec-1 Sub-1: initGraphClustSet
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    graphSet->useGraphBl = defClustGraphBl;
+    graphSet->numEdgesUI = defGraphEdgesUI;
+    graphSet->minShareF = defGraphMinShareF;
+    graphSet->minEdgesUI = defGraphMinEdgesUI;
+
+    return;
+} /*initGraphClustSet*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found the edges
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o edgeAryUI to have the edges of each read, from
+|          edgeStartAryUL[read] to edgeStartAryUL[read + 1] (is
+|          allocated). The numEdgesUI most similar reads come first
+|          (best first), then the reads that picked this read
+|        o edgeStartAryUL to have where each reads edges start (number
+|          reads + 1 entries; is allocated)
+|        o maxEdgesUI to have the most edges a read has
+| Note:
+|    - Each read is only compared to reads that share a minimizer
+|      with it, so no alignments are done
+|    - Edges go both ways, like the all vs all mappings V2 used
+\---------------------------------------------------------------------*/
+uint8_t getGraphEdges(
+    struct fqArena *arenaST,        /*Arena with the bins reads*/
+    struct graphClustSet *graphSet, /*Number of edges & min shared*/
+    uint32_t **edgeAryUI,           /*Gets the edges for each read*/
+    unsigned long **edgeStartAryUL, /*Gets start of each reads edges*/
+    uint32_t *maxEdgesUI            /*Gets most edges a read has*/
+) /*Finds the most similar reads (edges) for each read in an arena*/
+{ /*getGraphEdges*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: getGraphEdges
+    '   fun-2 sec-1: Variable declerations
+    '   fun-2 sec-2: Find the minimizers in each read
+    '   fun-2 sec-3: Sort the minimizers & remove duplicates
+    '   fun-2 sec-4: Make the list of minimizers (buckets) in each read
+    '   fun-2 sec-5: Find the most similar reads for each read
+    '   fun-2 sec-6: Add the reverse edges (edges go both ways)
+    '   fun-2 sec-7: Clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t numEdgesUI = graphSet->numEdgesUI;
+    uint32_t minShareUI = (uint32_t) (graphSet->minShareF * 1000);
+    uint32_t scoreUI = 0;         /*Shared minimizers (per 1000)*/
+    uint32_t childUI = 0;         /*Child in the edge heap*/
+    uint32_t posUI = 0;           /*Position in the edge heap*/
+    uint32_t numHeapUI = 0;       /*Edges in the edge heap*/
+    uint32_t tmpUI = 0;
+    long retL = 0;
+    unsigned long numMinzUL = 0;  /*Number of minimizers*/
+    unsigned long lenMinzUL = 0;  /*Size of minzAry*/
+    unsigned long bucketUL = 0;   /*First minimizer in a bucket*/
+    unsigned long numTouchUL = 0; /*Reads sharing a minimizer*/
+    unsigned long numReadsUL = arenaST->numReadsUL;
+    char *seqCStr = 0;
+
+    struct mapMinz *minzAry = 0;  /*All minimizers (sorted by hash)*/
+    unsigned long *endAryUL = 0;  /*End of the bucket (bucket start)*/
+    unsigned long *startAryUL = 0;/*Start of each reads bucket list*/
+    unsigned long *bucketAryUL = 0; /*Buckets each read is in*/
+    uint32_t *cntAryUI = 0;       /*Minimizers each read shares*/
+    uint32_t *touchAryUI = 0;     /*Reads sharing a minimizer*/
+    uint32_t *heapScoreAryUI = 0; /*Score of each edge in the heap*/
+    uint32_t *heapReadAryUI = 0;  /*Read of each edge in the heap*/
+    uint32_t *topAryUI = 0;       /*Most similar reads for each read*/
+    uint32_t *numTopAryUI = 0;    /*Number similar reads for a read*/
+    uint32_t *readTopAryUI = 0;   /*Most similar reads for one read*/
+    uint32_t *revTopAryUI = 0;    /*Most similar reads for an edge*/
+    char pickedBl = 0;            /*1: Edge read picked the read too*/
+
+    *edgeAryUI = 0;
+    *edgeStartAryUL = 0;
+    *maxEdgesUI = 0;
+
+    if(numEdgesUI < 1)
+        numEdgesUI = 1;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-2: Find the minimizers in each read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Get the minimizers for each read*/
+        seqCStr = arenaST->buffCStr + arenaST->startAryUL[ulRead];
+
+        while(*seqCStr != '\n')
+            ++seqCStr; /*Move past the header*/
+
+        ++seqCStr;
+
+        retL =
+            getMapMinz(
+                seqCStr,
+                arenaST->lenSeqAryUI[ulRead],
+                (uint32_t) ulRead,
+                &minzAry,
+                &lenMinzUL,
+                numMinzUL
+        ); /*Add the reads minimizers to the list*/
+
+        if(retL < 0)
+        { /*If had a memory allocation error*/
+            free(minzAry);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        numMinzUL = retL;
+    } /*Loop: Get the minimizers for each read*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-3: Sort the minimizers & remove duplicates
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Sorted by hash, then read, so repeats in a read are together*/
+    qsort(minzAry, numMinzUL, sizeof(struct mapMinz), cmpMapMinz);
+    retL = 0;
+
+    for(unsigned long ulMinz = 0; ulMinz < numMinzUL; ++ulMinz)
+    { /*Loop: Only keep one copy of a minimizer per read*/
+        if(
+               retL > 0
+            && minzAry[retL - 1].hashUI == minzAry[ulMinz].hashUI
+            && minzAry[retL - 1].seqUI == minzAry[ulMinz].seqUI
+        ) continue;
+
+        minzAry[retL] = minzAry[ulMinz];
+        ++retL;
+    } /*Loop: Only keep one copy of a minimizer per read*/
+
+    numMinzUL = retL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-4: Make the list of minimizers (buckets) in each read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    endAryUL = malloc(sizeof(unsigned long) * (numMinzUL + 1));
+    startAryUL = calloc(numReadsUL + 1, sizeof(unsigned long));
+    bucketAryUL = malloc(sizeof(unsigned long) * (numMinzUL + 1));
+    cntAryUI = calloc(numReadsUL, sizeof(uint32_t));
+    touchAryUI = malloc(sizeof(uint32_t) * numReadsUL);
+    heapScoreAryUI = malloc(sizeof(uint32_t) * numEdgesUI);
+    heapReadAryUI = malloc(sizeof(uint32_t) * numEdgesUI);
+    topAryUI = malloc(sizeof(uint32_t) * numReadsUL * numEdgesUI);
+    numTopAryUI = calloc(numReadsUL, sizeof(uint32_t));
+    *edgeStartAryUL = calloc(numReadsUL + 1, sizeof(unsigned long));
+
+    if(
+          endAryUL == 0
+       || startAryUL == 0
+       || bucketAryUL == 0
+       || cntAryUI == 0
+       || touchAryUI == 0
+       || heapScoreAryUI == 0
+       || heapReadAryUI == 0
+       || topAryUI == 0
+       || numTopAryUI == 0
+       || *edgeStartAryUL == 0
+    ) { /*If had a memory allocation error*/
+        free(minzAry);
+        free(endAryUL);
+        free(startAryUL);
+        free(bucketAryUL);
+        free(cntAryUI);
+        free(touchAryUI);
+        free(heapScoreAryUI);
+        free(heapReadAryUI);
+        free(topAryUI);
+        free(numTopAryUI);
+        free(*edgeStartAryUL);
+        *edgeStartAryUL = 0;
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /*Find where each reads list starts (reads are in file order)*/
+    for(unsigned long ulMinz = 0; ulMinz < numMinzUL; ++ulMinz)
+        ++startAryUL[minzAry[ulMinz].seqUI + 1];
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+        startAryUL[ulRead + 1] += startAryUL[ulRead];
+
+    /*Fill the lists (startAryUL is moved forward, then moved back)*/
+    for(unsigned long ulMinz = 0; ulMinz < numMinzUL; ++ulMinz)
+    { /*Loop: Put each bucket in the lists of its reads*/
+        if(
+              ulMinz == 0
+           || minzAry[ulMinz].hashUI != minzAry[ulMinz - 1].hashUI
+        ) { /*If this is the start of a new bucket*/
+            bucketUL = ulMinz;
+            endAryUL[bucketUL] = ulMinz;
+        } /*If this is the start of a new bucket*/
+
+        ++endAryUL[bucketUL];
+
+        tmpUI = minzAry[ulMinz].seqUI;
+        bucketAryUL[startAryUL[tmpUI]] = bucketUL;
+        ++startAryUL[tmpUI];
+    } /*Loop: Put each bucket in the lists of its reads*/
+
+    for(unsigned long ulRead = numReadsUL; ulRead > 0; --ulRead)
+        startAryUL[ulRead] = startAryUL[ulRead - 1];
+
+    startAryUL[0] = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-5: Find the most similar reads for each read
+    ^   fun-2 sec-5 sub-1: Count the minimizers shared with each read
+    ^   fun-2 sec-5 sub-2: Keep the best edges in a heap (worst first)
+    ^   fun-2 sec-5 sub-3: Copy the edges out of the heap (best first)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Find the edges for each read*/
+
+        /**************************************************************\
+        * Fun-2 Sec-5 Sub-1: Count the minimizers shared with each read
+        \**************************************************************/
+
+        numTouchUL = 0;
+        numHeapUI = 0;
+
+        for(
+            unsigned long ulMinz = startAryUL[ulRead];
+            ulMinz < startAryUL[ulRead + 1];
+            ++ulMinz
+        ) { /*Loop: Check each bucket the read is in*/
+            bucketUL = bucketAryUL[ulMinz];
+
+            for(
+                unsigned long ulPos = bucketUL;
+                ulPos < endAryUL[bucketUL];
+                ++ulPos
+            ) { /*Loop: Count the reads in the bucket*/
+                tmpUI = minzAry[ulPos].seqUI;
+
+                if(tmpUI == ulRead)
+                    continue;
+
+                if(cntAryUI[tmpUI] == 0)
+                    touchAryUI[numTouchUL++] = tmpUI;
+
+                ++cntAryUI[tmpUI];
+            } /*Loop: Count the reads in the bucket*/
+        } /*Loop: Check each bucket the read is in*/
+
+        /**************************************************************\
+        * Fun-2 Sec-5 Sub-2: Keep the best edges in a heap (worst first)
+        \**************************************************************/
+
+        for(unsigned long ulTouch = 0; ulTouch < numTouchUL; ++ulTouch)
+        { /*Loop: Score each read that shares a minimizer*/
+            tmpUI = touchAryUI[ulTouch];
+            posUI =
+                (uint32_t) (startAryUL[tmpUI + 1] - startAryUL[tmpUI]);
+            childUI =
+                (uint32_t)
+                (startAryUL[ulRead + 1] - startAryUL[ulRead]);
+
+            if(childUI < posUI)
+                posUI = childUI; /*Use the read with fewer minimizers*/
+
+            scoreUI = (uint32_t) ((cntAryUI[tmpUI] * 1000UL) / posUI);
+            cntAryUI[tmpUI] = 0;
+
+            if(scoreUI < minShareUI)
+                continue;
+
+            if(numHeapUI == numEdgesUI)
+            { /*If the heap is full, replace the worst edge*/
+                if(
+                      scoreUI < heapScoreAryUI[0]
+                   || (
+                           scoreUI == heapScoreAryUI[0]
+                        && tmpUI > heapReadAryUI[0]
+                      )
+                ) continue; /*Worse than all kept edges*/
+
+                posUI = 0;
+
+                while(1)
+                { /*Loop: Move the new edge down the heap*/
+                    childUI = (posUI << 1) + 1;
+
+                    if(childUI >= numHeapUI)
+                        break;
+
+                    if(
+                          childUI + 1 < numHeapUI
+                       && (
+                              heapScoreAryUI[childUI + 1]
+                                < heapScoreAryUI[childUI]
+                           || (
+                                   heapScoreAryUI[childUI + 1]
+                                     == heapScoreAryUI[childUI]
+                                && heapReadAryUI[childUI + 1]
+                                     > heapReadAryUI[childUI]
+                              )
+                          )
+                    ) ++childUI; /*Use the worse child*/
+
+                    if(
+                          heapScoreAryUI[childUI] > scoreUI
+                       || (
+                               heapScoreAryUI[childUI] == scoreUI
+                            && heapReadAryUI[childUI] < tmpUI
+                          )
+                    ) break; /*New edge is worse than both children*/
+
+                    heapScoreAryUI[posUI] = heapScoreAryUI[childUI];
+                    heapReadAryUI[posUI] = heapReadAryUI[childUI];
+                    posUI = childUI;
+                } /*Loop: Move the new edge down the heap*/
+            } /*If the heap is full, replace the worst edge*/
+
+            else
+            { /*Else add the edge to the end of the heap*/
+                posUI = numHeapUI;
+                ++numHeapUI;
+
+                while(posUI > 0)
+                { /*Loop: Move the new edge up the heap*/
+                    childUI = (posUI - 1) >> 1; /*Parent of posUI*/
+
+                    if(
+                          heapScoreAryUI[childUI] < scoreUI
+                       || (
+                               heapScoreAryUI[childUI] == scoreUI
+                            && heapReadAryUI[childUI] > tmpUI
+                          )
+                    ) break; /*Parent is worse than the new edge*/
+
+                    heapScoreAryUI[posUI] = heapScoreAryUI[childUI];
+                    heapReadAryUI[posUI] = heapReadAryUI[childUI];
+                    posUI = childUI;
+                } /*Loop: Move the new edge up the heap*/
+            } /*Else add the edge to the end of the heap*/
+
+            heapScoreAryUI[posUI] = scoreUI;
+            heapReadAryUI[posUI] = tmpUI;
+        } /*Loop: Score each read that shares a minimizer*/
+
+        /**************************************************************\
+        * Fun-2 Sec-5 Sub-3: Copy the edges out of the heap (best first)
+        \**************************************************************/
+
+        numTopAryUI[ulRead] = numHeapUI;
+
+        while(numHeapUI > 0)
+        { /*Loop: Take the worst edge out until the heap is empty*/
+            --numHeapUI;
+            topAryUI[ulRead * numEdgesUI + numHeapUI] =
+                heapReadAryUI[0];
+
+            scoreUI = heapScoreAryUI[numHeapUI];
+            tmpUI = heapReadAryUI[numHeapUI];
+            posUI = 0;
+
+            while(1)
+            { /*Loop: Move the last edge down the heap*/
+                childUI = (posUI << 1) + 1;
+
+                if(childUI >= numHeapUI)
+                    break;
+
+                if(
+                      childUI + 1 < numHeapUI
+                   && (
+                          heapScoreAryUI[childUI + 1]
+                            < heapScoreAryUI[childUI]
+                       || (
+                               heapScoreAryUI[childUI + 1]
+                                 == heapScoreAryUI[childUI]
+                            && heapReadAryUI[childUI + 1]
+                                 > heapReadAryUI[childUI]
+                          )
+                      )
+                ) ++childUI; /*Use the worse child*/
+
+                if(
+                      heapScoreAryUI[childUI] > scoreUI
+                   || (
+                           heapScoreAryUI[childUI] == scoreUI
+                        && heapReadAryUI[childUI] < tmpUI
+                      )
+                ) break; /*Last edge is worse than both children*/
+
+                heapScoreAryUI[posUI] = heapScoreAryUI[childUI];
+                heapReadAryUI[posUI] = heapReadAryUI[childUI];
+                posUI = childUI;
+            } /*Loop: Move the last edge down the heap*/
+
+            heapScoreAryUI[posUI] = scoreUI;
+            heapReadAryUI[posUI] = tmpUI;
+        } /*Loop: Take the worst edge out until the heap is empty*/
+    } /*Loop: Find the edges for each read*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-6: Add the reverse edges (edges go both ways)
+    ^   fun-2 sec-6 sub-1: Count the edges for each read
+    ^   fun-2 sec-6 sub-2: Copy the edges each read picked
+    ^   fun-2 sec-6 sub-3: Add the reads that picked each read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Fun-2 Sec-6 Sub-1: Count the edges for each read
+    \******************************************************************/
+
+    /*V2 clustered all vs all mappings, so each read had an edge to
+      every read it mapped to. With only the reads a read picked, too
+      few edges reach each cluster to merge it, which split clonal bins
+      into clusters that were then discarded*/
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Count the edges for each read*/
+        readTopAryUI = topAryUI + ulRead * numEdgesUI;
+
+        for(uint32_t uiEdge=0; uiEdge < numTopAryUI[ulRead]; ++uiEdge)
+        { /*Loop: Count each edge both ways*/
+            tmpUI = readTopAryUI[uiEdge];
+            revTopAryUI = topAryUI + tmpUI * numEdgesUI;
+            pickedBl = 0;
+
+            for(uint32_t uiRev = 0; uiRev < numTopAryUI[tmpUI]; ++uiRev)
+                pickedBl |= (revTopAryUI[uiRev] == ulRead);
+
+            ++(*edgeStartAryUL)[ulRead + 1];
+
+            if(!pickedBl)
+                ++(*edgeStartAryUL)[tmpUI + 1];
+        } /*Loop: Count each edge both ways*/
+    } /*Loop: Count the edges for each read*/
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Find where each reads edges start*/
+        if((*edgeStartAryUL)[ulRead + 1] > *maxEdgesUI)
+            *maxEdgesUI = (uint32_t) (*edgeStartAryUL)[ulRead + 1];
+
+        (*edgeStartAryUL)[ulRead + 1] += (*edgeStartAryUL)[ulRead];
+    } /*Loop: Find where each reads edges start*/
+
+    *edgeAryUI =
+        malloc(sizeof(uint32_t) * ((*edgeStartAryUL)[numReadsUL] + 1));
+
+    if(*edgeAryUI == 0)
+    { /*If had a memory allocation error*/
+        free(minzAry);
+        free(endAryUL);
+        free(startAryUL);
+        free(bucketAryUL);
+        free(cntAryUI);
+        free(touchAryUI);
+        free(heapScoreAryUI);
+        free(heapReadAryUI);
+        free(topAryUI);
+        free(numTopAryUI);
+        free(*edgeStartAryUL);
+        *edgeStartAryUL = 0;
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /******************************************************************\
+    * Fun-2 Sec-6 Sub-2: Copy the edges each read picked
+    \******************************************************************/
+
+    /*cntAryUI is all zeros again, so it is used for the edges added*/
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Copy the most similar reads (best first)*/
+        readTopAryUI = topAryUI + ulRead * numEdgesUI;
+
+        for(uint32_t uiEdge=0; uiEdge < numTopAryUI[ulRead]; ++uiEdge)
+            (*edgeAryUI)[(*edgeStartAryUL)[ulRead] + uiEdge] =
+                readTopAryUI[uiEdge];
+
+        cntAryUI[ulRead] = numTopAryUI[ulRead];
+    } /*Loop: Copy the most similar reads (best first)*/
+
+    /******************************************************************\
+    * Fun-2 Sec-6 Sub-3: Add the reads that picked each read
+    \******************************************************************/
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Add the reverse edges*/
+        readTopAryUI = topAryUI + ulRead * numEdgesUI;
+
+        for(uint32_t uiEdge=0; uiEdge < numTopAryUI[ulRead]; ++uiEdge)
+        { /*Loop: Add this read to each read it picked*/
+            tmpUI = readTopAryUI[uiEdge];
+            revTopAryUI = topAryUI + tmpUI * numEdgesUI;
+            pickedBl = 0;
+
+            for(uint32_t uiRev = 0; uiRev < numTopAryUI[tmpUI]; ++uiRev)
+                pickedBl |= (revTopAryUI[uiRev] == ulRead);
+
+            if(pickedBl)
+                continue; /*Already has the edge*/
+
+            (*edgeAryUI)[(*edgeStartAryUL)[tmpUI] + cntAryUI[tmpUI]] =
+                (uint32_t) ulRead;
+            ++cntAryUI[tmpUI];
+        } /*Loop: Add this read to each read it picked*/
+    } /*Loop: Add the reverse edges*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-7: Clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    free(minzAry);
+    free(endAryUL);
+    free(startAryUL);
+    free(bucketAryUL);
+    free(cntAryUI);
+    free(touchAryUI);
+    free(heapScoreAryUI);
+    free(heapReadAryUI);
+    free(topAryUI);
+    free(numTopAryUI);
+
+    return 1;
+} /*getGraphEdges*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Pointer to a read graph with numReadsUL reads (none are in
+|          a cluster yet)
+|        o 0 for memory allocation errors
+\---------------------------------------------------------------------*/
+struct readGraph * makeReadGraph(
+    unsigned long numReadsUL,       /*Number of reads in the graph*/
+    uint32_t numEdgesUI             /*Max edges per read (stack size)*/
+) /*Makes a read graph with every read out of the graph*/
+{ /*makeReadGraph*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: makeReadGraph
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct readGraph *graphST = calloc(1, sizeof(struct readGraph));
+
+    if(graphST == 0)
+        return 0;
+
+    graphST->numReadsUL = numReadsUL;
+    graphST->clustAryL = malloc(sizeof(long) * numReadsUL);
+    graphST->nextAryL = malloc(sizeof(long) * numReadsUL);
+    graphST->prevAryL = malloc(sizeof(long) * numReadsUL);
+    graphST->firstAryL = malloc(sizeof(long) * numReadsUL);
+    graphST->lastAryL = malloc(sizeof(long) * numReadsUL);
+    graphST->numNodesAryUL = calloc(numReadsUL, sizeof(unsigned long));
+    graphST->readCntAryUL = calloc(numReadsUL, sizeof(unsigned long));
+    graphST->doneAryUC = calloc(numReadsUL, sizeof(uint8_t));
+    graphST->stackAryL = malloc(sizeof(long) * (numEdgesUI + 1));
+    graphST->numStackUL = 0;
+
+    if(
+          graphST->clustAryL == 0
+       || graphST->nextAryL == 0
+       || graphST->prevAryL == 0
+       || graphST->firstAryL == 0
+       || graphST->lastAryL == 0
+       || graphST->numNodesAryUL == 0
+       || graphST->readCntAryUL == 0
+       || graphST->doneAryUC == 0
+       || graphST->stackAryL == 0
+    ) { /*If had a memory allocation error*/
+        freeReadGraph(&graphST);
+        return 0;
+    } /*If had a memory allocation error*/
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Mark every read as not in the graph*/
+        graphST->clustAryL[ulRead] = -1;
+        graphST->nextAryL[ulRead] = -1;
+        graphST->prevAryL[ulRead] = -1;
+        graphST->firstAryL[ulRead] = -1;
+        graphST->lastAryL[ulRead] = -1;
+    } /*Loop: Mark every read as not in the graph*/
+
+    return graphST;
+} /*makeReadGraph*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: graphST & sets it to 0
+\---------------------------------------------------------------------*/
+void freeReadGraph(
+    struct readGraph **graphST      /*Read graph to free*/
+) /*Frees a read graph*/
+{ /*freeReadGraph*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: Sec-1 Sub-1: freeReadGraph
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(*graphST == 0)
+        return;
+
+    free((*graphST)->clustAryL);
+    free((*graphST)->nextAryL);
+    free((*graphST)->prevAryL);
+    free((*graphST)->firstAryL);
+    free((*graphST)->lastAryL);
+    free((*graphST)->numNodesAryUL);
+    free((*graphST)->readCntAryUL);
+    free((*graphST)->doneAryUC);
+    free((*graphST)->stackAryL);
+    free(*graphST);
+
+    *graphST = 0;
+    return;
+} /*freeReadGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have readL in a new cluster (named readL) with
+|          no other reads
+|        o The old cluster of readL to not have readL
+\---------------------------------------------------------------------*/
+void graphMvToNewClust(
+    struct readGraph *graphST,      /*Read graph with the read*/
+    long readL                      /*Read to move*/
+) /*Moves a read into its own (new) cluster*/
+{ /*graphMvToNewClust*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: graphMvToNewClust
+    '   fun-5 sec-1: Cut the read out of its old cluster
+    '   fun-5 sec-2: Rename the old cluster if it was named after read
+    '   fun-5 sec-3: Make the new cluster
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-1: Cut the read out of its old cluster
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    long clustL = graphST->clustAryL[readL];
+    long newClustL = 0;
+
+    if(clustL >= 0 && graphST->numNodesAryUL[clustL] > 1)
+    { /*If the read is in a cluster with other reads*/
+        if(graphST->prevAryL[readL] < 0)
+            graphST->firstAryL[clustL] = graphST->nextAryL[readL];
+        else
+            graphST->nextAryL[graphST->prevAryL[readL]] =
+                graphST->nextAryL[readL];
+
+        if(graphST->nextAryL[readL] < 0)
+            graphST->lastAryL[clustL] = graphST->prevAryL[readL];
+        else
+            graphST->prevAryL[graphST->nextAryL[readL]] =
+                graphST->prevAryL[readL];
+
+        --graphST->numNodesAryUL[clustL];
+
+        /**************************************************************\
+        * Fun-5 Sec-2: Rename the old cluster if it was named after read
+        \**************************************************************/
+
+        if(clustL == readL)
+        { /*If the cluster needs a new name*/
+            newClustL = graphST->firstAryL[clustL];
+
+            graphST->firstAryL[newClustL] = graphST->firstAryL[clustL];
+            graphST->lastAryL[newClustL] = graphST->lastAryL[clustL];
+            graphST->numNodesAryUL[newClustL] =
+                graphST->numNodesAryUL[clustL];
+            graphST->readCntAryUL[newClustL] =
+                graphST->readCntAryUL[clustL];
+
+            for(
+                long lNode = newClustL;
+                lNode >= 0;
+                lNode = graphST->nextAryL[lNode]
+            ) graphST->clustAryL[lNode] = newClustL;
+        } /*If the cluster needs a new name*/
+    } /*If the read is in a cluster with other reads*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-3: Make the new cluster
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    graphST->clustAryL[readL] = readL;
+    graphST->nextAryL[readL] = -1;
+    graphST->prevAryL[readL] = -1;
+    graphST->firstAryL[readL] = readL;
+    graphST->lastAryL[readL] = readL;
+    graphST->numNodesAryUL[readL] = 1;
+    graphST->readCntAryUL[readL] = 0;
+
+    return;
+} /*graphMvToNewClust*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have readL in clustL. readL must not be in a
+|          cluster or be the only read in its cluster
+\---------------------------------------------------------------------*/
+void graphMvToClust(
+    struct readGraph *graphST,      /*Read graph with the read*/
+    long readL,                     /*Read to move*/
+    long clustL                     /*Cluster to move the read to*/
+) /*Moves a single read cluster (or new read) into a cluster*/
+{ /*graphMvToClust*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: Sec-1 Sub-1: graphMvToClust
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    long oldClustL = graphST->clustAryL[readL];
+
+    if(oldClustL >= 0)
+    { /*If the read was a single read cluster*/
+        graphST->numNodesAryUL[oldClustL] = 0;
+        graphST->readCntAryUL[oldClustL] = 0;
+        graphST->firstAryL[oldClustL] = -1;
+        graphST->lastAryL[oldClustL] = -1;
+    } /*If the read was a single read cluster*/
+
+    graphST->clustAryL[readL] = clustL;
+    graphST->nextAryL[readL] = -1;
+    graphST->prevAryL[readL] = graphST->lastAryL[clustL];
+    graphST->nextAryL[graphST->lastAryL[clustL]] = readL;
+    graphST->lastAryL[clustL] = readL;
+    ++graphST->numNodesAryUL[clustL];
+
+    return;
+} /*graphMvToClust*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have each read in clustL in its own cluster
+\---------------------------------------------------------------------*/
+void graphBreakClust(
+    struct readGraph *graphST,      /*Read graph with the cluster*/
+    long clustL                     /*Cluster to break up*/
+) /*Breaks a cluster into single read clusters*/
+{ /*graphBreakClust*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: Sec-1 Sub-1: graphBreakClust
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    long nodeL = graphST->firstAryL[clustL];
+    long nextL = 0;
+
+    while(nodeL >= 0)
+    { /*Loop: Make each read its own cluster*/
+        nextL = graphST->nextAryL[nodeL];
+
+        graphST->clustAryL[nodeL] = nodeL;
+        graphST->nextAryL[nodeL] = -1;
+        graphST->prevAryL[nodeL] = -1;
+        graphST->firstAryL[nodeL] = nodeL;
+        graphST->lastAryL[nodeL] = nodeL;
+        graphST->numNodesAryUL[nodeL] = 1;
+        graphST->readCntAryUL[nodeL] = 0;
+
+        nodeL = nextL;
+    } /*Loop: Make each read its own cluster*/
+
+    return;
+} /*graphBreakClust*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o The cluster that was kept (has the reads of both)
+|    - Modifies:
+|        o graphST to have the smaller cluster merged into the larger
+|          cluster (clustOneL is kept on ties)
+\---------------------------------------------------------------------*/
+long graphMergeClust(
+    struct readGraph *graphST,      /*Read graph with the clusters*/
+    long clustOneL,                 /*First cluster to merge*/
+    long clustTwoL                  /*Second cluster to merge*/
+) /*Merges the smaller of two clusters into the larger cluster*/
+{ /*graphMergeClust*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: Sec-1 Sub-1: graphMergeClust
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    long keepL = clustOneL;
+    long mergeL = clustTwoL;
+
+    if(clustOneL == clustTwoL)
+        return clustOneL;
+
+    if(
+          graphST->numNodesAryUL[clustTwoL]
+        > graphST->numNodesAryUL[clustOneL]
+    ) { /*If the second cluster is larger*/
+        keepL = clustTwoL;
+        mergeL = clustOneL;
+    } /*If the second cluster is larger*/
+
+    /*Only the smaller cluster is renamed, so each read is renamed at
+      most log2(number reads) times*/
+    for(
+        long lNode = graphST->firstAryL[mergeL];
+        lNode >= 0;
+        lNode = graphST->nextAryL[lNode]
+    ) graphST->clustAryL[lNode] = keepL;
+
+    graphST->nextAryL[graphST->lastAryL[keepL]] =
+        graphST->firstAryL[mergeL];
+    graphST->prevAryL[graphST->firstAryL[mergeL]] =
+        graphST->lastAryL[keepL];
+    graphST->lastAryL[keepL] = graphST->lastAryL[mergeL];
+
+    graphST->numNodesAryUL[keepL] += graphST->numNodesAryUL[mergeL];
+    graphST->numNodesAryUL[mergeL] = 0;
+    graphST->readCntAryUL[mergeL] = 0;
+    graphST->firstAryL[mergeL] = -1;
+    graphST->lastAryL[mergeL] = -1;
+
+    return keepL;
+} /*graphMergeClust*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have every read in a cluster. Reads that were
+|          discarded have doneAryUC set to 4
+| Note:
+|    - Each read is assigned the same way V2 assigned the reads in a
+|      set of alignments (insertGraphNode & assignReadToCluster)
+\---------------------------------------------------------------------*/
+void graphClustReads(
+    struct readGraph *graphST,      /*Read graph to cluster*/
+    uint32_t *edgeAryUI,            /*Edges for each read*/
+    unsigned long *edgeStartAryUL,  /*Start of each reads edges*/
+    struct graphClustSet *graphSet  /*Min edges to keep a read*/
+) /*Clusters the reads in a read graph using their edges*/
+{ /*graphClustReads*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: graphClustReads
+    '   fun-9 sec-1: Variable declerations
+    '   fun-9 sec-2: Add the edges for a read to the graph
+    '   fun-9 sec-3: Discard reads with to few edges
+    '   fun-9 sec-4: Assign the read to a cluster (merge clusters)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long mappedUL = 0;   /*Edges kept for the read*/
+    unsigned long minEdgesUL = graphSet->minEdgesUI;
+    long refL = 0;                /*Read at the end of an edge*/
+    long clustL = 0;              /*Cluster of refL*/
+
+    for(
+        unsigned long ulRead = 0;
+        ulRead < graphST->numReadsUL;
+        ++ulRead
+    ) { /*Loop: Add each read to the graph*/
+
+        /**************************************************************\
+        * Fun-9 Sec-2: Add the edges for a read to the graph
+        \**************************************************************/
+
+        graphMvToNewClust(graphST, (long) ulRead);
+        mappedUL = 0;
+
+        for(
+            unsigned long ulEdge = edgeStartAryUL[ulRead];
+            ulEdge < edgeStartAryUL[ulRead + 1];
+            ++ulEdge
+        ) { /*Loop: Add each edge of the read*/
+            refL = edgeAryUI[ulEdge];
+
+            if(graphST->doneAryUC[refL] == 4)
+                continue; /*Already discarded this read*/
+
+            ++mappedUL;
+            clustL = graphST->clustAryL[refL];
+
+            if(clustL < 0 || graphST->numNodesAryUL[clustL] == 1)
+            { /*If the read is not in a cluster yet, take it*/
+                ++graphST->readCntAryUL[ulRead];
+                graphMvToClust(graphST, refL, (long) ulRead);
+                continue;
+            } /*If the read is not in a cluster yet, take it*/
+
+            if(graphST->readCntAryUL[clustL] == 0)
+            { /*If is the first edge to this cluster*/
+                graphST->stackAryL[graphST->numStackUL] = clustL;
+                ++graphST->numStackUL;
+            } /*If is the first edge to this cluster*/
+
+            ++graphST->readCntAryUL[clustL];
+        } /*Loop: Add each edge of the read*/
+
+        /**************************************************************\
+        * Fun-9 Sec-3: Discard reads with to few edges
+        \**************************************************************/
+
+        if(mappedUL < minEdgesUL)
+        { /*If the read is not worth keeping*/
+            graphBreakClust(graphST, (long) ulRead);
+            graphST->doneAryUC[ulRead] = 4;
+
+            while(graphST->numStackUL > 0)
+            { /*Loop: Reset the clusters the read had edges to*/
+                --graphST->numStackUL;
+                clustL = graphST->stackAryL[graphST->numStackUL];
+                graphST->readCntAryUL[clustL] = 0;
+            } /*Loop: Reset the clusters the read had edges to*/
+
+            continue;
+        } /*If the read is not worth keeping*/
+
+        /**************************************************************\
+        * Fun-9 Sec-4: Assign the read to a cluster (merge clusters)
+        \**************************************************************/
+
+        if(graphST->readCntAryUL[ulRead] < minEdgesUL)
+            graphBreakClust(graphST, (long) ulRead);
+            /*Not enough new reads to start a cluster*/
+        else
+            graphST->readCntAryUL[ulRead] = 0;
+
+        graphST->doneAryUC[ulRead] = 1;
+
+        while(graphST->numStackUL > 0)
+        { /*Loop: Merge the read with the clusters it has edges to*/
+            --graphST->numStackUL;
+            clustL = graphST->stackAryL[graphST->numStackUL];
+
+            if(graphST->readCntAryUL[clustL] > minEdgesUL)
+            { /*If shares enough edges to merge the clusters*/
+                graphST->readCntAryUL[clustL] = 0;
+
+                graphMergeClust(
+                    graphST,
+                    clustL,
+                    graphST->clustAryL[ulRead]
+                );
+            } /*If shares enough edges to merge the clusters*/
+
+            else
+                graphST->readCntAryUL[clustL] = 0;
+        } /*Loop: Merge the read with the clusters it has edges to*/
+
+        clustL = graphST->clustAryL[ulRead];
+
+        if(graphST->numNodesAryUL[clustL] < minEdgesUL)
+            graphST->doneAryUC[ulRead] = 4; /*Mark as ignore*/
+    } /*Loop: Add each read to the graph*/
+
+    return;
+} /*graphClustReads*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if split the bin
+|        o 2 if the bin could not be read (not a four line fastq), a
+|          cluster directory could not be made, or a file name would
+|          be to long
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o binST->rightChild to have the clusters with at least
+|          minReadsUL reads (largest first, at most 256). The fastq
+|          for each cluster is in a directory named after the bin &
+|          the cluster (bin--graph-number/bin.fastq)
+|        o binST->fqPathCStr to have the reads not in a cluster
+\---------------------------------------------------------------------*/
+uint8_t graphSplitBin(
+    struct readBin *binST,          /*Bin to split into clusters*/
+    struct graphClustSet *graphSet, /*Read graph settings*/
+    unsigned long minReadsUL        /*Min reads to keep a cluster*/
+) /*Splits a bin into all of its read graph clusters*/
+{ /*graphSplitBin*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: graphSplitBin
+    '   fun-10 sec-1: Variable declerations
+    '   fun-10 sec-2: Read in the bin & find the edges
+    '   fun-10 sec-3: Cluster the reads
+    '   fun-10 sec-4: Find the clusters to keep (largest first)
+    '   fun-10 sec-5: Make a readBin for each kept cluster
+    '   fun-10 sec-6: Write the fastq files & clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    char *tmpCStr = 0;
+    char *baseCStr = 0;            /*Name of the bins fastq (no dir)*/
+    char dirCStr[256];             /*Directory for a cluster*/
+    long clustL = 0;
+    long tmpL = 0;
+    unsigned long numClustUL = 0;  /*Number of clusters kept*/
+    unsigned long numReadsUL = 0;  /*Number of reads in the bin*/
+    uint32_t *edgeAryUI = 0;       /*Edges for each read*/
+    unsigned long *edgeStartAryUL = 0; /*Start of each reads edges*/
+    uint32_t maxEdgesUI = 0;       /*Most edges a read has*/
+    long *keepAryL = 0;            /*Clusters to keep*/
+    unsigned long *cntAryUL = 0;   /*Kept reads in each cluster*/
+
+    struct fqArena *arenaST = 0;
+    struct readGraph *graphST = 0;
+    struct readBin *lastClust = binST; /*Last cluster in the bin*/
+    struct readBin *clustST = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-2: Read in the bin & find the edges
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    binST->rightChild = 0;
+    errUC = loadFqArena(binST, 0);
+
+    if(!(errUC & 1))
+        return errUC; /*2: not a four line fastq; 64: memory error*/
+
+    arenaST = binST->arenaST;
+    numReadsUL = arenaST->numReadsUL;
+
+    errUC =
+        getGraphEdges(
+            arenaST,
+            graphSet,
+            &edgeAryUI,
+            &edgeStartAryUL,
+            &maxEdgesUI
+        );
+
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        doneFqArena(binST, 0);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-3: Cluster the reads
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    graphST = makeReadGraph(numReadsUL, maxEdgesUI);
+
+    if(graphST == 0)
+    { /*If had a memory allocation error*/
+        free(edgeAryUI);
+        free(edgeStartAryUL);
+        doneFqArena(binST, 0);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    graphClustReads(graphST, edgeAryUI, edgeStartAryUL, graphSet);
+
+    free(edgeAryUI);
+    free(edgeStartAryUL);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-4: Find the clusters to keep (largest first)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Only reads that were assigned are printed (same as V2)*/
+    cntAryUL = graphST->readCntAryUL;
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+        cntAryUL[ulRead] = 0;
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Count the kept reads in each cluster*/
+        if(graphST->doneAryUC[ulRead] == 1)
+            ++cntAryUL[graphST->clustAryL[ulRead]];
+    } /*Loop: Count the kept reads in each cluster*/
+
+    /*The clusters are named after reads, so the stack (one per read
+      in a cluster) has space for every kept cluster*/
+    keepAryL = graphST->stackAryL;
+    free(keepAryL);
+    keepAryL = malloc(sizeof(long) * (numReadsUL + 1));
+    graphST->stackAryL = keepAryL;
+
+    if(keepAryL == 0)
+    { /*If had a memory allocation error*/
+        freeReadGraph(&graphST);
+        doneFqArena(binST, 0);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Add clusters with enough reads (insertion sort)*/
+        if(cntAryUL[ulRead] < minReadsUL || cntAryUL[ulRead] == 0)
+            continue;
+
+        tmpL = numClustUL;
+
+        while(tmpL > 0 && cntAryUL[keepAryL[tmpL-1]] < cntAryUL[ulRead])
+        { /*Loop: Move the smaller clusters back*/
+            keepAryL[tmpL] = keepAryL[tmpL - 1];
+            --tmpL;
+        } /*Loop: Move the smaller clusters back*/
+
+        keepAryL[tmpL] = (long) ulRead;
+        ++numClustUL;
+    } /*Loop: Add clusters with enough reads (insertion sort)*/
+
+    if(numClustUL > 256)
+        numClustUL = 256; /*Cluster numbers are an unsigned char*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-5: Make a readBin for each kept cluster
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    baseCStr = binST->fqPathCStr;
+
+    for(tmpCStr = binST->fqPathCStr; *tmpCStr != '\0'; ++tmpCStr)
+    { /*Loop: Find the fastq name without the directory*/
+        if(*tmpCStr == '/')
+            baseCStr = tmpCStr + 1;
+    } /*Loop: Find the fastq name without the directory*/
+
+    errUC = 1;
+
+    for(unsigned long ulClust = 0; ulClust < numClustUL; ++ulClust)
+    { /*Loop: Move the reads in each kept cluster to a readBin*/
+        clustL = keepAryL[ulClust];
+
+        errUC =
+            graphConFileName(
+                dirCStr,
+                binST,
+                "--graph-",
+                (uint8_t) ulClust,
+                ""
+        ); /*Get the name of the clusters directory*/
+
+        if(
+              (errUC & 1)
+           && strlen(dirCStr) + strlen(baseCStr) + 1 >= 256
+        ) errUC = 2; /*The fastq name is to long*/
+
+        if((errUC & 1) && mkdir(dirCStr, 0777) != 0)
+            errUC = 2; /*Could not make the directory*/
+
+        if(!(errUC & 1))
+            break;
+
+        clustST = malloc(sizeof(struct readBin));
+
+        if(clustST == 0)
+        { /*If had a memory allocation error*/
+            rmdir(dirCStr);
+            errUC = 64;
+            break;
+        } /*If had a memory allocation error*/
+
+        blankReadBin(clustST);
+        clustST->balUChar = 1; /*To mark keeping*/
+        strcpy(clustST->refIdCStr, binST->refIdCStr);
+
+        tmpCStr = cStrCpInvsDelm(clustST->fqPathCStr, dirCStr);
+        *tmpCStr = '/';
+        cStrCpInvsDelm(tmpCStr + 1, baseCStr);
+
+        clustST->arenaST = arenaST;
+        clustST->headL = -1;
+        clustST->tailL = -1;
+        clustST->bestL = -1;
+        clustST->dirtyBl = 1; /*Fastq is written at the end*/
+
+        for(
+            long lNode = graphST->firstAryL[clustL];
+            lNode >= 0;
+            lNode = graphST->nextAryL[lNode]
+        ) { /*Loop: Move the kept reads to the cluster*/
+            if(graphST->doneAryUC[lNode] != 1)
+                continue;
+
+            unlinkArenaRead(
+                arenaST,
+                &binST->headL,
+                &binST->tailL,
+                lNode
+            );
+
+            appendArenaRead(
+                arenaST,
+                &clustST->headL,
+                &clustST->tailL,
+                lNode
+            );
+
+            ++clustST->numReadsULng;
+        } /*Loop: Move the kept reads to the cluster*/
+
+        binST->numReadsULng -= clustST->numReadsULng;
+        binST->dirtyBl = 1;
+
+        lastClust->rightChild = clustST;
+        lastClust = clustST;
+    } /*Loop: Move the reads in each kept cluster to a readBin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-6: Write the fastq files & clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    freeReadGraph(&graphST);
+
+    if(errUC & 1)
+        errUC = doneFqArena(binST, 1);
+
+    else
+        doneFqArena(binST, 0);
+
+    if(!(errUC & 1))
+    { /*If had an error, remove the clusters*/
+        while(binST->rightChild != 0)
+        { /*Loop: Remove each cluster & its directory*/
+            clustST = binST->rightChild;
+            binST->rightChild = clustST->rightChild;
+            binST->numReadsULng += clustST->numReadsULng;
+
+            binDeleteFiles(clustST);
+
+            tmpCStr = clustST->fqPathCStr;
+
+            while(*tmpCStr != '\0')
+                ++tmpCStr;
+
+            while(*tmpCStr != '/')
+                --tmpCStr;
+
+            *tmpCStr = '\0';
+            rmdir(clustST->fqPathCStr);
+            freeReadBin(&clustST);
+        } /*Loop: Remove each cluster & its directory*/
+    } /*If had an error, remove the clusters*/
+
+    return errUC;
+} /*graphSplitBin*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o nameCStr to be the bins fastq name without ".fastq" & with
+|          the cluster number (--graph-, --clust-) & endCStr added
+|    - Returns:
+|        o 1 if made the name
+|        o 2 if the name would not fit in 256 characters
+\---------------------------------------------------------------------*/
+uint8_t graphConFileName(
+    char *nameCStr,                 /*Gets the name (256 characters)*/
+    struct readBin *binST,          /*Bin the cluster is from*/
+    char *clustCStr,                /*"--graph-" or "--clust-"*/
+    uint8_t clustUC,                /*Number of the cluster*/
+    char *endCStr                   /*End of the name (ex ".fastq")*/
+) /*Makes the name a graph clusters file has after its consensus*/
+{ /*graphConFileName*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-11 TOC: Sec-1 Sub-1: graphConFileName
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *tmpCStr = 0;
+
+    /*6 is ".fastq" & 3 is the cluster number*/
+    if(
+          strlen(binST->fqPathCStr) - 6 + strlen(clustCStr) + 3
+        + strlen(endCStr)
+       >= 256
+    ) return 2;
+
+    tmpCStr = cStrCpInvsDelm(nameCStr, binST->fqPathCStr);
+    tmpCStr -= 6; /*get to '.' in ".fastq"*/
+    tmpCStr = cStrCpInvsDelm(tmpCStr, clustCStr);
+    tmpCStr = uCharToCStr(tmpCStr, clustUC);
+    strcpy(tmpCStr, endCStr);
+
+    return 1;
+} /*graphConFileName*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if built the consensus
+|        o 16 if could not build a consensus
+|        o 64 for memory allocation errors
+|        o buildCon errors otherwise
+|    - Modifies:
+|        o clustST to have its fastq & consensus in the bins scratch
+|          directory (bin--clust-number.fastq & --con.fasta) & the
+|          clusters directory is removed
+|        o clustST files are deleted if no consensus was built
+\---------------------------------------------------------------------*/
+uint8_t graphBuildCon(
+    struct readBin *clustST,        /*Cluster to build consensus for*/
+    struct readBin *binST,          /*Bin the cluster came from*/
+    uint8_t clustUC,                /*Number of the cluster in its bin*/
+    char *threadsCStr,              /*Number threads for minimap2*/
+    struct conBuildStruct *conSet,  /*Settings for consensus building*/
+    struct samEntry *samStruct,     /*Holds minimap2 output*/
+    struct samEntry *refStruct,     /*Holds the best read*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats  /*Consensus polish setting*/
+) /*Builds the consensus for one read graph cluster*/
+{ /*graphBuildCon*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-12 TOC: graphBuildCon
+    '   fun-12 sec-1: Variable declerations
+    '   fun-12 sec-2: Build the consensus
+    '   fun-12 sec-3: Move the files out of the clusters directory
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    char dirCStr[256];    /*Directory the cluster was built in*/
+    char nameCStr[256];   /*Name of a file after it is moved*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-2: Build the consensus
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*The cluster has no stats file, so the best read is picked by
+      median Q-score. The consensus header uses the cluster number*/
+    conSet->clustUC = clustUC;
+    conSet->useStatBl = 0;
+
+    errUC =
+        buildCon(
+            clustST,
+            0,           /*Path to fasta file with reference*/
+            threadsCStr, /*# threads to use with system calls*/
+            conSet,      /*settings for building a consensus*/
+            samStruct,   /*Will hold sam file data*/
+            refStruct,   /*For read median Q extraction*/
+            readToReadMinStats,
+            readToConMinStats
+    ); /*Builds a consensus using fastq file & best read*/
+
+    graphConFileName(dirCStr, binST, "--graph-", clustUC, "");
+
+    if(!(errUC & 1))
+    { /*If could not build a consensus*/
+        binDeleteFiles(clustST);
+        rmdir(dirCStr);
+        return errUC;
+    } /*If could not build a consensus*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-3: Move the files out of the clusters directory
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*The top reads are not needed after the consensus is built*/
+    remove(clustST->topReadsCStr);
+    remove(clustST->bestReadCStr);
+    clustST->topReadsCStr[0] = '\0';
+    clustST->bestReadCStr[0] = '\0';
+
+    graphConFileName(nameCStr, binST, "--clust-", clustUC, ".fastq");
+    rename(clustST->fqPathCStr, nameCStr);
+    strcpy(clustST->fqPathCStr, nameCStr);
+
+    graphConFileName(
+        nameCStr,
+        binST,
+        "--clust-",
+        clustUC,
+        "--con.fasta"
+    );
+
+    rename(clustST->consensusCStr, nameCStr);
+    strcpy(clustST->consensusCStr, nameCStr);
+
+    rmdir(dirCStr);
+    return 1;
+} /*graphBuildCon*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - errAryUC in parmST for each bin split or cluster built
+|    Returns: 0
+\---------------------------------------------------------------------*/
+void * graphClustThread(
+    void *parmST /*graphClustST structer with settings*/
+) /*Splits bins or builds consensuses until none are left*/
+{ /*graphClustThread*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-13 TOC: graphClustThread
+    '    fun-13 sec-1: Variable declerations
+    '    fun-13 sec-2: Split bins or build consensuses till none left
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct graphClustST *graphST = (struct graphClustST *) parmST;
+    unsigned long jobUL = 0; /*Bin or cluster this thread is on*/
+    double startDbl = 0;     /*Start time of a bin split*/
+
+    struct samEntry samStruct; /*Holds minimap2 output for this thread*/
+    struct samEntry refStruct; /*Holds best read for this thread*/
+
+    initSamEntry(&samStruct);
+    initSamEntry(&refStruct);
+
+    samStruct.samEntryCStr = malloc(sizeof(char) * 1401);
+    refStruct.samEntryCStr = malloc(sizeof(char) * 1401);
+    samStruct.lenBuffULng = 1400;
+    refStruct.lenBuffULng = 1400;
+
+    if(samStruct.samEntryCStr == 0 || refStruct.samEntryCStr == 0)
+    { /*If had a memory allocation error*/
+        pthread_mutex_lock(&graphClustMutex);
+        jobUL = *graphST->nextJobUL;
+        ++(*graphST->nextJobUL);
+        pthread_mutex_unlock(&graphClustMutex);
+
+        if(jobUL < graphST->numJobsUL)
+            graphST->errAryUC[jobUL] = 64; /*Report the memory error*/
+
+        freeStackSamEntry(&samStruct);
+        freeStackSamEntry(&refStruct);
+        return 0;
+    } /*If had a memory allocation error*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-13 Sec-2: Split bins or build consensuses till none left
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(1)
+    { /*While have bins or clusters to work on*/
+        pthread_mutex_lock(&graphClustMutex);
+        jobUL = *graphST->nextJobUL;
+        ++(*graphST->nextJobUL);
+        pthread_mutex_unlock(&graphClustMutex);
+
+        if(jobUL >= graphST->numJobsUL)
+            break; /*Nothing left to do*/
+
+        if(graphST->splitBl & 1)
+        { /*If splitting bins into clusters*/
+            startDbl = getBenchTime();
+
+            graphST->errAryUC[jobUL] =
+                graphSplitBin(
+                    graphST->binAry[jobUL],
+                    &graphST->graphSet,
+                    graphST->conSet.minReadsToBuildConUL
+            ); /*Split the bin into its clusters*/
+
+            addBenchTime(benchClustGraphUC, startDbl);
+        } /*If splitting bins into clusters*/
+
+        else
+            graphST->errAryUC[jobUL] =
+                graphBuildCon(
+                    graphST->clustAry[jobUL],
+                    graphST->clustBinAry[jobUL],
+                    graphST->clustNumAryUC[jobUL],
+                    graphST->threadsCStr,
+                    &graphST->conSet,
+                    &samStruct,
+                    &refStruct,
+                    &graphST->readToReadMinStats,
+                    &graphST->readToConMinStats
+            ); /*Build the consensus for the cluster*/
+
+        if(graphST->errAryUC[jobUL] & 64)
+            break; /*Memory error, let the other threads finish*/
+    } /*While have bins or clusters to work on*/
+
+    freeStackSamEntry(&samStruct);
+    freeStackSamEntry(&refStruct);
+
+    return 0;
+} /*graphClustThread*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - errAryUC to have the graphSplitBin error for each bin (or
+|          64 if a cluster had a memory error)
+|        - keptAryUL to have the number of kept reads for each bin
+|        - rightChild in each bin in binAry to have the clusters that
+|          a consensus was built for. Clusters in the same bin with
+|          similar consensuses are merged (cmpCons), as clustBin does
+|        - conSet->numSkipConUL to have the consensus pairs skipped by
+|          the k-mer sketches
+\---------------------------------------------------------------------*/
+uint8_t graphClustBins(
+    struct readBin **binAry,       /*Bins to cluster*/
+    unsigned long numBinsUL,       /*Number of bins in binAry*/
+    uint32_t binThreadsUI,         /*Number bins to work on at once*/
+    char *threadsCStr,             /*Total threads for minimap2*/
+    struct graphClustSet *graphSet,/*Settings for the read graph*/
+    struct conBuildStruct *conSet, /*Settings for consensus building*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats, /*Consensus polish setting*/
+    struct minAlnStats *conToConMinStats,  /*Consensus comparison set*/
+    uint8_t *errAryUC,             /*Gets errors for each bin*/
+    unsigned long *keptAryUL       /*Gets kept reads for each bin*/
+) /*Clusters a set of bins with a read graph & builds consensuses*/
+{ /*graphClustBins*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-14 TOC: graphClustBins
+    '    fun-14 sec-1: Variable declerations
+    '    fun-14 sec-2: Split the threads between the bins
+    '    fun-14 sec-3: Set up the settings for each thread
+    '    fun-14 sec-4: Split the bins into clusters
+    '    fun-14 sec-5: Build a consensus for every cluster
+    '    fun-14 sec-6: Remove failed clusters & count kept reads
+    '    fun-14 sec-7: Merge clusters in a bin with similar consensuses
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 1;
+    uint8_t clustUC = 0;
+    char builtBl = 0;            /*1: Ran the consensus step*/
+    uint32_t threadsUI = 0;      /*Threads each worker gives minimap2*/
+    uint32_t numStartedUI = 0;   /*Number of threads launched*/
+    uint32_t numWorkersUI = 0;   /*Number of workers for a step*/
+    unsigned long nextJobUL = 0; /*Next bin or cluster to work on*/
+    unsigned long numClustUL = 0;/*Number of clusters in all bins*/
+    unsigned long ulClust = 0;
+    double startDbl = 0;         /*Start time of a cmpCons call*/
+
+    char *tmpCStr = 0;
+    uint8_t *clustErrAryUC = 0;  /*Errors for each cluster*/
+    uint8_t *clustNumAryUC = 0;  /*Number of each cluster in its bin*/
+    struct readBin **clustAry = 0;    /*Clusters to build consensuses*/
+    struct readBin **clustBinAry = 0; /*Bin each cluster is from*/
+    struct readBin *clustST = 0;
+    struct readBin *lastClust = 0;
+    struct readBin *nextClust = 0;    /*Cluster after clustST*/
+    struct readBin *bestBin = 0;      /*Cluster with similar consensus*/
+    struct readBin *nextBin = 0;      /*To restore the list of bins*/
+
+    struct samEntry samStruct; /*Holds minimap2 output for cmpCons*/
+    struct samEntry refStruct; /*Holds consensus for cmpCons*/
+
+    pthread_t *threadsAry = 0;
+    struct graphClustST *graphAryST = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-2: Split the threads between the bins
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(numBinsUL == 0)
+        return 1; /*Nothing to do*/
+
+    if(binThreadsUI < 1)
+        binThreadsUI = 1;
+
+    cStrToUInt(threadsCStr, &threadsUI);
+    threadsUI /= binThreadsUI;
+
+    if(threadsUI < 1)
+        threadsUI = 1;
+
+    for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+    { /*Loop: blank the return values*/
+        errAryUC[ulBin] = 0;
+        keptAryUL[ulBin] = 0;
+    } /*Loop: blank the return values*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-3: Set up the settings for each thread
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    threadsAry = malloc(sizeof(pthread_t) * binThreadsUI);
+
+    if(threadsAry == 0)
+        return 64;
+
+    graphAryST = malloc(sizeof(struct graphClustST) * binThreadsUI);
+
+    if(graphAryST == 0)
+    { /*If had a memory allocation error*/
+        free(threadsAry);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    for(uint32_t uiThread = 0; uiThread < binThreadsUI; ++uiThread)
+    { /*Loop: Initalize the thread values*/
+        graphAryST[uiThread].splitBl = 1;
+        uIntToCStr(graphAryST[uiThread].threadsCStr, threadsUI);
+
+        graphAryST[uiThread].binAry = binAry;
+        graphAryST[uiThread].clustAry = 0;
+        graphAryST[uiThread].clustBinAry = 0;
+        graphAryST[uiThread].clustNumAryUC = 0;
+        graphAryST[uiThread].numJobsUL = numBinsUL;
+        graphAryST[uiThread].nextJobUL = &nextJobUL;
+        graphAryST[uiThread].errAryUC = errAryUC;
+
+        /*Each thread needs its own copy, since these are modified*/
+        graphAryST[uiThread].graphSet = *graphSet;
+        graphAryST[uiThread].conSet = *conSet;
+        graphAryST[uiThread].readToReadMinStats = *readToReadMinStats;
+        graphAryST[uiThread].readToConMinStats = *readToConMinStats;
+    } /*Loop: Initalize the thread values*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-4: Split the bins into clusters
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    pthread_mutex_init(&graphClustMutex, 0); /*intiate my mutext*/
+
+    numWorkersUI = binThreadsUI;
+
+    if(numWorkersUI > numBinsUL)
+        numWorkersUI = numBinsUL; /*No point in having idle threads*/
+
+    if(numWorkersUI > 1)
+    { /*If working with multiple threads*/
+        for(uint32_t uiThread = 0; uiThread < numWorkersUI; ++uiThread)
+        { /*Loop: Launch threads*/
+            if(
+                pthread_create(
+                    &threadsAry[numStartedUI],
+                    0,
+                    graphClustThread,
+                    &graphAryST[uiThread]
+                ) != 0
+            ) break; /*If could not launch, use the launched threads*/
+
+            ++numStartedUI;
+        } /*Loop: Launch threads*/
+    } /*If working with multiple threads*/
+
+    if(numStartedUI == 0)
+        graphClustThread(&graphAryST[0]); /*Only one thread*/
+
+    for(uint32_t uiThread = 0; uiThread < numStartedUI; ++uiThread)
+        pthread_join(threadsAry[uiThread], 0);
+
+    for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+    { /*Loop: Count the clusters in each bin*/
+        if(errAryUC[ulBin] & 64)
+            errUC = 64;
+
+        for(
+            clustST = binAry[ulBin]->rightChild;
+            clustST != 0;
+            clustST = clustST->rightChild
+        ) ++numClustUL;
+    } /*Loop: Count the clusters in each bin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-5: Build a consensus for every cluster
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(numClustUL > 0 && (errUC & 1))
+    { /*If have clusters to build consensuses for*/
+        clustAry = malloc(sizeof(struct readBin *) * numClustUL);
+        clustBinAry = malloc(sizeof(struct readBin *) * numClustUL);
+        clustNumAryUC = malloc(sizeof(uint8_t) * numClustUL);
+        clustErrAryUC = malloc(sizeof(uint8_t) * numClustUL);
+
+        if(
+              clustAry == 0
+           || clustBinAry == 0
+           || clustNumAryUC == 0
+           || clustErrAryUC == 0
+        ) errUC = 64;
+    } /*If have clusters to build consensuses for*/
+
+    if(numClustUL > 0 && (errUC & 1))
+    { /*If can build the consensuses*/
+        for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+        { /*Loop: Add the clusters to the job arrays*/
+            clustUC = 0;
+
+            for(
+                clustST = binAry[ulBin]->rightChild;
+                clustST != 0;
+                clustST = clustST->rightChild
+            ) { /*Loop: Add each cluster in the bin*/
+                clustAry[ulClust] = clustST;
+                clustBinAry[ulClust] = binAry[ulBin];
+                clustNumAryUC[ulClust] = clustUC;
+                clustErrAryUC[ulClust] = 0;
+                ++clustUC;
+                ++ulClust;
+            } /*Loop: Add each cluster in the bin*/
+        } /*Loop: Add the clusters to the job arrays*/
+
+        nextJobUL = 0;
+        numStartedUI = 0;
+        numWorkersUI = binThreadsUI;
+
+        if(numWorkersUI > numClustUL)
+            numWorkersUI = numClustUL;
+
+        for(uint32_t uiThread = 0; uiThread < numWorkersUI; ++uiThread)
+        { /*Loop: Point the threads to the clusters*/
+            graphAryST[uiThread].splitBl = 0;
+            graphAryST[uiThread].clustAry = clustAry;
+            graphAryST[uiThread].clustBinAry = clustBinAry;
+            graphAryST[uiThread].clustNumAryUC = clustNumAryUC;
+            graphAryST[uiThread].numJobsUL = numClustUL;
+            graphAryST[uiThread].errAryUC = clustErrAryUC;
+        } /*Loop: Point the threads to the clusters*/
+
+        if(numWorkersUI > 1)
+        { /*If working with multiple threads*/
+            for(uint32_t uiThread=0; uiThread<numWorkersUI; ++uiThread)
+            { /*Loop: Launch threads*/
+                if(
+                    pthread_create(
+                        &threadsAry[numStartedUI],
+                        0,
+                        graphClustThread,
+                        &graphAryST[uiThread]
+                    ) != 0
+                ) break; /*If could not launch, use launched threads*/
+
+                ++numStartedUI;
+            } /*Loop: Launch threads*/
+        } /*If working with multiple threads*/
+
+        if(numStartedUI == 0)
+            graphClustThread(&graphAryST[0]); /*Only one thread*/
+
+        for(uint32_t uiThread = 0; uiThread < numStartedUI; ++uiThread)
+            pthread_join(threadsAry[uiThread], 0);
+    } /*If can build the consensuses*/
+
+    pthread_mutex_destroy(&graphClustMutex);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-6: Remove failed clusters & count kept reads
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    ulClust = 0;
+    builtBl = (clustErrAryUC != 0 && (errUC & 1));
+
+    for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+    { /*Loop: Check the clusters in each bin*/
+        lastClust = binAry[ulBin];
+
+        while(lastClust->rightChild != 0)
+        { /*Loop: Check each cluster in the bin*/
+            clustST = lastClust->rightChild;
+
+            if(builtBl)
+            { /*If built consensuses*/
+                errAryUC[ulBin] |= clustErrAryUC[ulClust] & 64;
+                ++ulClust;
+
+                if(clustErrAryUC[ulClust - 1] & 1)
+                { /*If built a consensus for the cluster*/
+                    keptAryUL[ulBin] += clustST->numReadsULng;
+                    lastClust = clustST;
+                    continue;
+                } /*If built a consensus for the cluster*/
+            } /*If built consensuses*/
+
+            if(!builtBl || clustErrAryUC[ulClust - 1] == 0)
+            { /*If the cluster was never built (memory error)*/
+                binDeleteFiles(clustST);
+
+                tmpCStr = clustST->fqPathCStr;
+
+                while(*tmpCStr != '\0')
+                    ++tmpCStr;
+
+                while(*tmpCStr != '/')
+                    --tmpCStr;
+
+                *tmpCStr = '\0';
+                rmdir(clustST->fqPathCStr);
+            } /*If the cluster was never built (memory error)*/
+
+            /*graphBuildCon removes the files of failed clusters*/
+            lastClust->rightChild = clustST->rightChild;
+            freeReadBin(&clustST);
+        } /*Loop: Check each cluster in the bin*/
+
+        if(errAryUC[ulBin] & 64)
+            errUC = 64;
+    } /*Loop: Check the clusters in each bin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-7: Merge clusters in a bin with similar consensuses
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Main sec-8 only compares clusters to clusters in later bins, so
+      the clusters in a bin are compared here. The clusters are largest
+      first, so each cluster is only compared to larger clusters*/
+    initSamEntry(&samStruct);
+    initSamEntry(&refStruct);
+
+    if(errUC & 1)
+    { /*If had no memory errors*/
+        samStruct.samEntryCStr = malloc(sizeof(char) * 1401);
+        refStruct.samEntryCStr = malloc(sizeof(char) * 1401);
+        samStruct.lenBuffULng = 1400;
+        refStruct.lenBuffULng = 1400;
+
+        if(samStruct.samEntryCStr == 0 || refStruct.samEntryCStr == 0)
+            errUC = 64;
+    } /*If had no memory errors*/
+
+    for(
+        unsigned long ulBin = 0;
+        ulBin < numBinsUL && (errUC & 1);
+        ++ulBin
+    ) { /*Loop: Compare the clusters in each bin*/
+        if(
+              binAry[ulBin]->rightChild == 0
+           || binAry[ulBin]->rightChild->rightChild == 0
+        ) continue; /*Nothing to compare*/
+
+        /*cmpCons also checks the bins after this bin*/
+        nextBin = binAry[ulBin]->leftChild;
+        binAry[ulBin]->leftChild = 0;
+
+        clustST = binAry[ulBin]->rightChild;
+        binAry[ulBin]->rightChild = 0;
+        lastClust = binAry[ulBin];
+
+        while(clustST != 0)
+        { /*Loop: Compare each cluster to the kept clusters*/
+            nextClust = clustST->rightChild;
+            clustST->rightChild = 0;
+            startDbl = getBenchTime();
+
+            bestBin =
+                cmpCons(
+                    clustST,          /*Bin with consensus to compare*/
+                    binAry[ulBin],    /*Kept clusters to compare to*/
+                    &samStruct,       /*To hold input from minimap2*/
+                    &refStruct,       /*To hold the consensus*/
+                    conToConMinStats, /*Cons to consensus thresholds*/
+                    threadsCStr,      /*Threads to use with minimap2*/
+                    &conSet->numSkipConUL /*Pairs skipped by sketches*/
+            ); /*Compares a consenses to the larger consensuses*/
+
+            addBenchTime(benchCmpConsUC, startDbl);
+
+            if(bestBin != 0)
+            { /*If the consensuses are to similar (the same?)*/
+                mergeBins(bestBin, clustST);
+                freeReadBin(&clustST);
+            } /*If the consensuses are to similar (the same?)*/
+
+            else
+            { /*Else keep the cluster*/
+                lastClust->rightChild = clustST;
+                lastClust = clustST;
+            } /*Else keep the cluster*/
+
+            clustST = nextClust;
+        } /*Loop: Compare each cluster to the kept clusters*/
+
+        binAry[ulBin]->leftChild = nextBin;
+    } /*Loop: Compare the clusters in each bin*/
+
+    freeStackSamEntry(&samStruct);
+    freeStackSamEntry(&refStruct);
+
+    free(clustAry);
+    free(clustBinAry);
+    free(clustNumAryUC);
+    free(clustErrAryUC);
+    free(threadsAry);
+    free(graphAryST);
+
+    return errUC;
+} /*graphClustBins*/
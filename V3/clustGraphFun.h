@@ -0,0 +1,370 @@
+/*######################################################################
+# Use:
+#   o Holds the read graph clustering mode (-clust-graph). This is the
+#     V2 clusterGraph algorithm, but the edges come from shared
+#     minimizers (the most similar reads for each read) instead of an
+#     all vs all minimap2 run. A bin is split into all of its clusters
+#     in one pass & then one consensus is built for each cluster. The
+#     bins & clusters are worked on with -bin-threads threads.
+# Includes:
+#   - "clustBinsFun.h"
+#   o "buildConFun.h"
+#   o "binReadsFun.h"
+#   o "readMapFun.h"
+#   o "fqArenaFun.h"
+#   o "benchTimeFun.h"
+#   o "findCoInftBinTree.h"
+#   o "samEntryStruct.h"
+#   o "cStrFun.h"
+#   o "cStrToNumberFun.h"
+#   o "defaultSettings.h"
+# C standard libraries:
+#   - <sys/stat.h>
+#   o <pthread.h>
+#   o <unistd.h>
+#   o <string.h>
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef CLUSTGRAPHFUN_H
+#define CLUSTGRAPHFUN_H
+
+#include <sys/stat.h>      /*mkdir for each clusters directory*/
+#include "clustBinsFun.h"  /*buildCon, readBin, & the read arena*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' clustGraphFun SOH: Start Of Header
+'   o st-1 graphClustSet:
+'     - Settings for the read graph (-clust-graph)
+'   o st-2 readGraph:
+'     - Which cluster each read is in & the size of each cluster
+'   o st-3 graphClustST:
+'     - Settings for one thread in graphClustBins
+'   o fun-1 initGraphClustSet:
+'     - Sets a graphClustSet structure to the default settings
+'   o fun-2 getGraphEdges:
+'     - Finds the most similar reads (edges) for each read in an arena
+'   o fun-3 makeReadGraph:
+'     - Makes a read graph with every read out of the graph
+'   o fun-4 freeReadGraph:
+'     - Frees a read graph
+'   o fun-5 graphMvToNewClust:
+'     - Moves a read into its own (new) cluster
+'   o fun-6 graphMvToClust:
+'     - Moves a single read cluster (or new read) into a cluster
+'   o fun-7 graphBreakClust:
+'     - Breaks a cluster into single read clusters
+'   o fun-8 graphMergeClust:
+'     - Merges the smaller of two clusters into the larger cluster
+'   o fun-9 graphClustReads:
+'     - Clusters the reads in a read graph using their edges
+'   o fun-10 graphSplitBin:
+'     - Splits a bin into all of its read graph clusters
+'   o fun-11 graphConFileName:
+'     - Makes the name a graph clusters file has after its consensus
+'   o fun-12 graphBuildCon:
+'     - Builds the consensus for one read graph cluster
+'   o fun-13 graphClustThread:
+'     - Splits bins or builds consensuses until none are left
+'   o fun-14 graphClustBins:
+'     - Clusters a set of bins with the read graph
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: graphClustSet
+| Use:
+|   - Holds the settings for the read graph. An edge is kept for each
+|     of the numEdgesUI reads that share the most minimizers with a
+|     read (as a fraction of the smaller reads minimizers). Each edge
+|     goes both ways, so a read also has edges to the reads that
+|     picked it. minEdgesUI replaces both -min-shared-edges &
+|     -min-num-mapped-reads in V2.
+\---------------------------------------------------------------------*/
+typedef struct graphClustSet
+{ /*graphClustSet*/
+    char useGraphBl;     /*1: Cluster bins with the read graph*/
+    uint32_t numEdgesUI; /*Most similar reads each read picks*/
+    float minShareF;     /*Min fraction of shared minimizers (edge)*/
+    uint32_t minEdgesUI; /*Min edges to keep a read or merge clusters*/
+}graphClustSet;
+
+/*---------------------------------------------------------------------\
+| Struct-2: readGraph
+| Use:
+|   - Holds the clusters for the reads in one bin. Each read is its own
+|     node & clusters are named after a read in the cluster, so
+|     clustAryL[read] is also the index of the clusters counts.
+|   - The reads in a cluster are linked with nextAryL & prevAryL (-1
+|     ends a list), starting at firstAryL[cluster].
+|   - doneAryUC is 0 for reads not checked yet, 1 for reads assigned
+|     to a cluster, & 4 for reads that were discarded (as in V2).
+\---------------------------------------------------------------------*/
+typedef struct readGraph
+{ /*readGraph*/
+    unsigned long numReadsUL;     /*Number of reads in the graph*/
+
+    long *clustAryL;              /*Cluster of each read (-1 if none)*/
+    long *nextAryL;               /*Next read in the reads cluster*/
+    long *prevAryL;               /*Previous read in the cluster*/
+    long *firstAryL;              /*First read in each cluster*/
+    long *lastAryL;               /*Last read in each cluster*/
+    unsigned long *numNodesAryUL; /*Number of reads in each cluster*/
+    unsigned long *readCntAryUL;  /*Edges the read on has to cluster*/
+    uint8_t *doneAryUC;           /*0: not checked; 1: kept; 4: not*/
+
+    long *stackAryL;              /*Clusters the read on has edges to*/
+    unsigned long numStackUL;     /*Number of clusters in stackAryL*/
+}readGraph;
+
+/*---------------------------------------------------------------------\
+| Struct-3: graphClustST
+| Use:
+|   - Holds the settings for one thread in graphClustBins. The bins
+|     are split first (splitBl = 1), then one consensus is built for
+|     each cluster (splitBl = 0). Every thread has its own copy of the
+|     settings, so no locks are needed for them.
+\---------------------------------------------------------------------*/
+typedef struct graphClustST
+{ /*graphClustST*/
+    char splitBl;              /*1: Split bins; 0: build consensuses*/
+    char threadsCStr[11];      /*Threads this worker gives minimap2*/
+
+    struct readBin **binAry;   /*Bins to split*/
+    struct readBin **clustAry; /*Clusters to build consensuses for*/
+    struct readBin **clustBinAry; /*Bin each cluster came from*/
+    uint8_t *clustNumAryUC;    /*Number of each cluster in its bin*/
+    unsigned long numJobsUL;   /*Number of bins or clusters*/
+    unsigned long *nextJobUL;  /*Next bin or cluster (shared)*/
+
+    uint8_t *errAryUC;         /*Error returned for each job*/
+
+    struct graphClustSet graphSet;        /*Read graph settings*/
+    struct conBuildStruct conSet;         /*Consensus settings*/
+    struct minAlnStats readToReadMinStats;/*Read pull settings*/
+    struct minAlnStats readToConMinStats; /*Consensus polish settings*/
+}graphClustST;
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: graphSet to have the defaults in defaultSettings.h
+\---------------------------------------------------------------------*/
+void initGraphClustSet(
+    struct graphClustSet *graphSet /*Structure to set to defaults*/
+); /*Sets a graphClustSet structure to the default settings*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found the edges
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o edgeAryUI to have the edges of each read, from
+|          edgeStartAryUL[read] to edgeStartAryUL[read + 1] (is
+|          allocated). The numEdgesUI most similar reads come first
+|          (best first), then the reads that picked this read
+|        o edgeStartAryUL to have where each reads edges start (number
+|          reads + 1 entries; is allocated)
+|        o maxEdgesUI to have the most edges a read has
+| Note:
+|    - Each read is only compared to reads that share a minimizer
+|      with it, so no alignments are done
+|    - Edges go both ways, like the all vs all mappings V2 used
+\---------------------------------------------------------------------*/
+uint8_t getGraphEdges(
+    struct fqArena *arenaST,        /*Arena with the bins reads*/
+    struct graphClustSet *graphSet, /*Number of edges & min shared*/
+    uint32_t **edgeAryUI,           /*Gets the edges for each read*/
+    unsigned long **edgeStartAryUL, /*Gets start of each reads edges*/
+    uint32_t *maxEdgesUI            /*Gets most edges a read has*/
+); /*Finds the most similar reads (edges) for each read in an arena*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Pointer to a read graph with numReadsUL reads (none are in
+|          a cluster yet)
+|        o 0 for memory allocation errors
+\---------------------------------------------------------------------*/
+struct readGraph * makeReadGraph(
+    unsigned long numReadsUL,       /*Number of reads in the graph*/
+    uint32_t numEdgesUI             /*Max edges per read (stack size)*/
+); /*Makes a read graph with every read out of the graph*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: graphST & sets it to 0
+\---------------------------------------------------------------------*/
+void freeReadGraph(
+    struct readGraph **graphST      /*Read graph to free*/
+); /*Frees a read graph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have readL in a new cluster (named readL) with
+|          no other reads
+|        o The old cluster of readL to not have readL
+\---------------------------------------------------------------------*/
+void graphMvToNewClust(
+    struct readGraph *graphST,      /*Read graph with the read*/
+    long readL                      /*Read to move*/
+); /*Moves a read into its own (new) cluster*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have readL in clustL. readL must not be in a
+|          cluster or be the only read in its cluster
+\---------------------------------------------------------------------*/
+void graphMvToClust(
+    struct readGraph *graphST,      /*Read graph with the read*/
+    long readL,                     /*Read to move*/
+    long clustL                     /*Cluster to move the read to*/
+); /*Moves a single read cluster (or new read) into a cluster*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have each read in clustL in its own cluster
+\---------------------------------------------------------------------*/
+void graphBreakClust(
+    struct readGraph *graphST,      /*Read graph with the cluster*/
+    long clustL                     /*Cluster to break up*/
+); /*Breaks a cluster into single read clusters*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o The cluster that was kept (has the reads of both)
+|    - Modifies:
+|        o graphST to have the smaller cluster merged into the larger
+|          cluster (clustOneL is kept on ties)
+\---------------------------------------------------------------------*/
+long graphMergeClust(
+    struct readGraph *graphST,      /*Read graph with the clusters*/
+    long clustOneL,                 /*First cluster to merge*/
+    long clustTwoL                  /*Second cluster to merge*/
+); /*Merges the smaller of two clusters into the larger cluster*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o graphST to have every read in a cluster. Reads that were
+|          discarded have doneAryUC set to 4
+| Note:
+|    - Each read is assigned the same way V2 assigned the reads in a
+|      set of alignments (insertGraphNode & assignReadToCluster)
+\---------------------------------------------------------------------*/
+void graphClustReads(
+    struct readGraph *graphST,      /*Read graph to cluster*/
+    uint32_t *edgeAryUI,            /*Edges for each read*/
+    unsigned long *edgeStartAryUL,  /*Start of each reads edges*/
+    struct graphClustSet *graphSet  /*Min edges to keep a read*/
+); /*Clusters the reads in a read graph using their edges*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if split the bin
+|        o 2 if the bin could not be read (not a four line fastq), a
+|          cluster directory could not be made, or a file name would
+|          be to long
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o binST->rightChild to have the clusters with at least
+|          minReadsUL reads (largest first, at most 256). The fastq
+|          for each cluster is in a directory named after the bin &
+|          the cluster (bin--graph-number/bin.fastq)
+|        o binST->fqPathCStr to have the reads not in a cluster
+\---------------------------------------------------------------------*/
+uint8_t graphSplitBin(
+    struct readBin *binST,          /*Bin to split into clusters*/
+    struct graphClustSet *graphSet, /*Read graph settings*/
+    unsigned long minReadsUL        /*Min reads to keep a cluster*/
+); /*Splits a bin into all of its read graph clusters*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o nameCStr to be the bins fastq name without ".fastq" & with
+|          the cluster number (--graph-, --clust-) & endCStr added
+|    - Returns:
+|        o 1 if made the name
+|        o 2 if the name would not fit in 256 characters
+\---------------------------------------------------------------------*/
+uint8_t graphConFileName(
+    char *nameCStr,                 /*Gets the name (256 characters)*/
+    struct readBin *binST,          /*Bin the cluster is from*/
+    char *clustCStr,                /*"--graph-" or "--clust-"*/
+    uint8_t clustUC,                /*Number of the cluster*/
+    char *endCStr                   /*End of the name (ex ".fastq")*/
+); /*Makes the name a graph clusters file has after its consensus*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if built the consensus
+|        o 16 if could not build a consensus
+|        o 64 for memory allocation errors
+|        o buildCon errors otherwise
+|    - Modifies:
+|        o clustST to have its fastq & consensus in the bins scratch
+|          directory (bin--clust-number.fastq & --con.fasta) & the
+|          clusters directory is removed
+|        o clustST files are deleted if no consensus was built
+\---------------------------------------------------------------------*/
+uint8_t graphBuildCon(
+    struct readBin *clustST,        /*Cluster to build consensus for*/
+    struct readBin *binST,          /*Bin the cluster came from*/
+    uint8_t clustUC,                /*Number of the cluster in its bin*/
+    char *threadsCStr,              /*Number threads for minimap2*/
+    struct conBuildStruct *conSet,  /*Settings for consensus building*/
+    struct samEntry *samStruct,     /*Holds minimap2 output*/
+    struct samEntry *refStruct,     /*Holds the best read*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats  /*Consensus polish setting*/
+); /*Builds the consensus for one read graph cluster*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Modifies:
+|        - errAryUC in parmST for each bin split or cluster built
+|    Returns: 0
+\---------------------------------------------------------------------*/
+void * graphClustThread(
+    void *parmST /*graphClustST structer with settings*/
+); /*Splits bins or builds consensuses until none are left*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|        - 1: if succeded
+|        - 64: for memory allocation errors
+|    Modifies:
+|        - rightChild in each bin to have the list of clusters with a
+|          consensus
+|        - errAryUC to have the graphSplitBin return value for each bin
+|        - keptAryUL to have the number of kept reads for each bin
+|        - conSet->numSkipConUL to have the consensus pairs skipped by
+|          the k-mer sketches
+|    Note:
+|        - binThreadsUI bins (or clusters) are worked on at once & the
+|          threadsCStr are split between them
+|        - Clusters in the same bin with similar consensuses are merged
+|          (cmpCons), as clustBin does
+\---------------------------------------------------------------------*/
+uint8_t graphClustBins(
+    struct readBin **binAry,        /*Bins to cluster*/
+    unsigned long numBinsUL,        /*Number of bins in binAry*/
+    uint32_t binThreadsUI,          /*Number bins to cluster at once*/
+    char *threadsCStr,              /*Total threads for minimap2*/
+    struct graphClustSet *graphSet, /*Read graph settings*/
+    struct conBuildStruct *conSet,  /*Settings for consensus building*/
+    struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
+    struct minAlnStats *readToConMinStats, /*Consensus polish setting*/
+    struct minAlnStats *conToConMinStats,  /*Consensus comparison set*/
+    uint8_t *errAryUC,              /*Gets errors for each bin*/
+    unsigned long *keptAryUL        /*Gets kept reads for each bin*/
+); /*Clusters a set of bins with the read graph*/
+
+#endif
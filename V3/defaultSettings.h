@@ -37,6 +37,9 @@
 \**********************************************************************/
 
 #define minimap2CMD "minimap2 --eqx --secondary=no -a -x map-ont"
+/*All vs all consensus comparision; -X skips self mappings*/
+#define minimap2AllVsAllCMD \
+    "minimap2 --eqx --secondary=yes -X -p 0 -a -x map-ont"
 #define raconCMD "racon -m 8 -x 6 -g -8 -w 500"
 
 #define medakaCMD "/bin/bash -c \"source ~/medaka/venv/bin/activate;"
@@ -47,6 +50,83 @@
 /*Command for mapping reads to primers*/
 #define defMinimap2PrimCMD "minimap2 -k5 -w1 -s 20 -P"
 
+/*Command to save minimap2's reference index (-ref-cache). The preset
+  must match minimap2CMD, since the index is built with it*/
+#define minimap2IdxCMD "minimap2 -x map-ont -d"
+#define defMinimap2PresetCStr "map-ont" /*Preset used for cache names*/
+
+/*Commands to decompress gzip fastq files (printf format: threads, file).
+  bgzip splits BGZF files into blocks & decompresses the blocks on
+  -threads threads. pigz is the next fastest & gzip is the fall back*/
+#define defUnzipCMD \
+    "if command -v bgzip >/dev/null 2>&1; then exec bgzip -@ %s -dc %s;\
+ elif command -v pigz >/dev/null 2>&1; then exec pigz -p %s -dc %s;\
+ else exec gzip -dc %s; fi"
+
+/*Command to compress output fastq files (-gzip-out). bgzip makes BGZF
+  files, which can be decompressed in parallel*/
+#define defZipCMD \
+    "if command -v bgzip >/dev/null 2>&1; then exec bgzip -@ %s -f %s;\
+ elif command -v pigz >/dev/null 2>&1; then exec pigz -p %s -f %s;\
+ else exec gzip -f %s; fi"
+
+#define defGzipOutBl 0 /*1: gzip the kept fastq files (-gzip-out)*/
+
+/*1: Keep the reads of the bin being clustered in memory, so the best
+  read is not found by re-reading the bin for each cluster
+  (0 with -no-read-arena)*/
+#define defReadArenaBl 1
+
+/*1: After clustering a bin, map all its reads to all its consensuses
+  at once & move each read to the consensus it maps best to*/
+#define defBatchAssignBl 0
+
+/*Read graph clustering (-clust-graph); the V2 clusterGraph method*/
+#define defClustGraphBl 0       /*1: Cluster bins with the read graph*/
+#define defGraphEdgesUI 20      /*Most similar reads kept per read*/
+#define defGraphMinShareF 0.1   /*Min fraction of minimizers shared*/
+#define defGraphMinEdgesUI 5    /*Min edges to keep a read (V2 -n)*/
+
+/*Built in mapper (-in-map) settings; used in place of minimap2*/
+#define defInMapBl 0          /*1: Use the built in mapper*/
+#define defMapKmerUC 15       /*k-mer length (minimap2 -k)*/
+#define defMapWinUC 10        /*Minimizer window length (minimap2 -w)*/
+#define defMapMaxOccUI 1000   /*Skip minimizers in more positions*/
+#define defMapMaxGapUI 5000   /*Max gap between anchors in a chain*/
+#define defMapChainBandUI 500 /*Max indel between anchors in a chain*/
+#define defMapLookBackUI 50   /*Anchors to look back at when chaining*/
+#define defMapMinScoreI 40    /*Min chaining score (minimap2 -m)*/
+#define defMapMinAnchorsUI 3  /*Min anchors in a chain (minimap2 -n)*/
+#define defMapBandUI 40       /*Half width of the alignment band*/
+#define defMapMatchI 2        /*Match score (minimap2 map-ont -A)*/
+#define defMapSnpI 4          /*Mismatch penalty (minimap2 -B)*/
+#define defMapGapOpenI 4      /*Gap open penalty (minimap2 -O)*/
+#define defMapGapExtI 2       /*Gap extension penalty (minimap2 -E)*/
+#define defMapIdxMagicCStr "FCIMIDX1" /*First bytes of a saved index*/
+
+/*Built in pairwise aligner (alignSeq); used in place of minimap2 for
+  read to best read & consensus to consensus comparisons*/
+#define defPairAlnBl 1        /*1: Use the pairwise aligner*/
+#define defAlnMatchI 2        /*Match score*/
+#define defAlnSnpI 4          /*Mismatch penalty*/
+#define defAlnGapOpenI 4      /*Gap open penalty (first base adds ext)*/
+#define defAlnGapExtI 2       /*Penalty for each base in a gap*/
+#define defAlnGlobalBl 0      /*1: Global, 0: Semi-global (free ends)*/
+#define defAlnClipEndsBl 1    /*1: Soft mask ends that lower the score*/
+#define defAlnMaxCellsUL 67108864 /*Use the mapper for larger pairs*/
+
+/*k-mer sketch prescreen for the consensus comparisons (cmpCons)*/
+#define defSketchKmerUC 15    /*k-mer length for consensus sketches*/
+#define defSketchSizeUI 256   /*Number of smallest hashes to keep*/
+#define defSketchMarginF 0.05 /*Compare pairs estimated to be under
+                                -con-con-diff + this different*/
+
+/*Built in primer search (trimPrimers -in-prim); used in place of
+  minimap2 for primer trimming*/
+#define defInPrimBl 0         /*1: Use the built in primer search*/
+#define defPrimMaxErrF 0.2    /*Max edits, as fraction of primer length*/
+#define defPrimEndLenUI 0     /*Bases at each read end to search (0: all)*/
+
 /**********************************************************************\
 * Sec-3: General settings
 \**********************************************************************/
@@ -55,11 +135,24 @@
 #define defVersion 3.20230804  /*The Version number of this program*/
     /*Format is version.yearMonthDay*/
 #define defPrefix "out"      /*Default prefix to use*/
+#define defTmpDir "."        /*Where to make the run scratch directory*/
 #define defThreads "3"       /*Default number of threads to use*/
+#define defBinThreads 1      /*Default number of bins to cluster at once*/
+#define defMaxOpenBins 512   /*Max bins binReads keeps open at once*/
+#define defSamPipeBuff 65536 /*Bytes read at once when hashing files*/
 #define rmReadsWithSupAln 0
     /*1: remove reads with supplementary aligments*/
+#define defThreadBinBl 0
+    /*1: Score reads on -threads threads when binning (-thread-bin)*/
+#define defBinBatchUI 1024  /*Sam entries scored at once (-thread-bin)*/
+#define defIdSetSizeUL 1024 /*Starting size of the chimeric id set*/
 #define defReadsPerCon 300
     /*Maximum number of reads to use to build a consensus*/
+#define defPreselMultUI 4
+    /*Only map the defPreselMultUI * defReadsPerCon reads sharing the
+      most minimizers with the best read when picking the reads to
+      build a consensus with (0 maps all reads in the bin)*/
+#define defPreselMaxScoreUI 1000 /*Score for all minimizers shared*/
 #define minReadsPerBin 100 
     /*Minimum number reads to keep a bin or build a consensus*/
 #define defMinPercReads 0.003 /*(0.3% of all clustered reads)*/
@@ -86,6 +179,10 @@
 #define defUseRaconCon 0  /*1: Racon in consensus building*/
 #define defRoundsRacon 4    /*Default number of racon rounds/consensus*/
 
+#define defUsePoaCon 0    /*1: Built in POA in consensus building*/
+#define defRoundsPoa 2    /*Default number of POA rounds/consensus*/
+#define defPoaBandUI 64   /*Bases on each side of a reads diagonal*/
+
 #define defUseMedakaCon 0 /*1: Use medaka in consensus building*/
 #define defMedakaModel "r941_min_high_g351" /*Model to use with medaka*/
 #define defCondaBl 0      /*Default no, but my code will autofind*/
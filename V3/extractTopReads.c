@@ -416,6 +416,7 @@ int main(int lenArgsInt, char *argsCStr[])
             &numReadsExtractedUL,
             threadsCStr,
             &oneC,
+            0,  /*Map all reads*/
             &minStats,
             &samST,
             0,  /*Do not use reference in scoring (needs to be fastq)*/
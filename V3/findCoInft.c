@@ -26,6 +26,8 @@
 '      - main function that runs everything
 '    fun-1 getUserInput:
 '      - function to get user input with
+'    fun-2 mvScratchBin:
+'      - Moves a kept clusters files out of the run scratch directory
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -35,7 +37,9 @@
 /*My includes*/
 #include "buildConFun.h" /*Various dependencies through readExtract.h*/
 #include "binReadsFun.h" /*Functions for binning reads*/
-#include "trimPrimersSearch.h" /*For trimming reads with primers*/
+#include "clustBinsFun.h" /*Clustering bins (one or more at a time)*/
+#include "clustGraphFun.h" /*Clustering bins with a read graph*/
+#include "trimPrimersMyers.h"  /*For trimming reads with primers*/
 
 /*---------------------------------------------------------------------\
 | Output:
@@ -51,11 +55,18 @@ char * getUserInput(
     char **fqPathCStr, /*Holds path to fastq file*/
     char **refsPathCStr, /*Holds path to references*/
     char **primPathCStr,/*Holds path to primer fasta file for trimming*/
+    char **refCacheCStr, /*Directory to cache reference indexes in*/
+    char **benchTsvCStr, /*Tsv file to append stage times to*/
+    char **tmpDirCStr,   /*Directory to make the scratch directory in*/
     char *threadsCStr, /*Number threads for minimap2 & racon*/
+    uint32_t *binThreadsUI, /*Number of bins to cluster at once*/
     char *rmSupAlnBl,  /*1: Remove reads with supplemental alignments*/
+    char *threadBinBl, /*1: Score reads on threads when binning*/
     char *skipBinBl,   /*1: Skip the binning step, 0 do not*/
     char *skipClustBl, /*1: Skip the clusterin step, 0 do not*/
+    char *gzipOutBl,   /*1: gzip the kept clusters fastq files*/
     double *minReadsDbl,
+    struct graphClustSet *graphSet,  /*Read graph settings*/
     struct conBuildStruct *conSet,   /*Settings for consensus building*/
     struct minAlnStats *readToRefMinStats, /*Binning scoring settings*/
     struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
@@ -63,10 +74,27 @@ char * getUserInput(
     struct minAlnStats *conToConMinStats   /*Consensus comparison set*/
 ); /*Reads in user input*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o Each file in binST that exists & starts with workPrefCStr
+|          to start with prefCStr instead. The file is renamed, or
+|          copied if it is on another file system (-tmp-dir on tmpfs)
+|    - Returns:
+|        o 1 if moved all files
+|        o 2 if could not move a file (its name is not changed)
+\---------------------------------------------------------------------*/
+uint8_t mvScratchBin(
+    struct readBin *binST, /*Cluster with the files to move*/
+    char *workPrefCStr,    /*Prefix with the scratch directory*/
+    char *prefCStr         /*Prefix to move the files to*/
+); /*Moves a kept clusters files out of the run scratch directory*/
+
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' SOF: Start of functions
 '   o main: driver function to run find co-infections
 '   o getUserInput: Process user input provided by command line
+'   o mvScratchBin: Moves a clusters files out of the scratch dir
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 int main(
@@ -102,16 +130,26 @@ int main(
 
     /*User Input or related variables (non file names)*/
     char rmSupAlnBl = rmReadsWithSupAln;
+    char threadBinBl = defThreadBinBl; /*Bin with threads?*/
     char skipBinBl = defSkipBinBl;     /*Skip binning step?*/
     char skipClustBl = defSkipClustBl; /*Skip clustering step?*/
+    char gzipOutBl = defGzipOutBl;     /*gzip kept fastq files?*/
     char prefCStr[100];        /*Holds the user prefix*/
     char threadsCStr[7];      /*Number of threads for minimap2 & racon*/
+    uint32_t binThreadsUI = defBinThreads; /*Bins to cluster at once*/
     double minReadsDbl = defMinPercReads;
         /*What percentage of reads should the final cluster have*/
 
     char *fqPathCStr = 0;      /*Holds fastq file to process*/
     char *refsPathCStr = 0;    /*Holds references for binning*/
     char *primPathCStr = 0;    /*Holds primers for read trimming*/
+    char *refCacheCStr = 0;    /*Directory with cached ref indexes*/
+    char refIdxCStr[1024];     /*Cached index to bin with (-ref-cache)*/
+    char *benchTsvCStr = 0;    /*Tsv to append stage times to*/
+    char *tmpDirCStr = defTmpDir; /*Where to make the scratch dir*/
+    char scratchDirCStr[128];  /*Scratch directory for this run*/
+    char workPrefCStr[256];    /*Prefix in the scratch directory*/
+    unsigned long lenWorkPrefUL = 0; /*Length of workPrefCStr*/
     char logFileCStr[256];    /*Holds the name of the log file*/
     char readCntFileCStr[256]; /*Holds Number of reads per bin/cluster*/
 
@@ -126,6 +164,8 @@ int main(
     char *inutErrCStr = 0; /*holds user input error*/
 
     unsigned long totalKeptReadsUL = 0;
+    double runStartDbl = 0;    /*Start of the run (-bench-tsv)*/
+    double startDbl = 0;       /*Start of a stage (-bench-tsv)*/
 
     /*FILES opened*/
     FILE *logFILE = 0;      /*Holds the log*/
@@ -149,6 +189,7 @@ int main(
         /*Consensus to consensus mapping thresholds*/
  
     struct conBuildStruct conSet; /*Settings for building a consensus*/
+    struct graphClustSet graphSet; /*Settings for -clust-graph*/
 
     struct readBin *binTree = 0;   /*Tree of read bins*/
     struct readBin *bestBin = 0;   /*Bin with most similar consensus*/
@@ -156,6 +197,19 @@ int main(
     struct readBin *lastClust = 0; /*Last cluster worked on for a bin*/
     struct readBin *lastBin = 0;   /*For keeping list in order*/
     struct readBin *tmpBin = 0;    /*Pionts to a readBin to work on*/
+
+    /*For clustering bins at the same time*/
+    unsigned long numBinsUL = 0;   /*Number of bins to cluster*/
+    struct readBin **binAry = 0;   /*Bins to cluster (in list order)*/
+    uint8_t *binErrAryUC = 0;      /*Errors from clustering each bin*/
+    unsigned long *binKeptAryUL = 0; /*Kept reads in each bin*/
+
+    /*For comparing all consensuses at once*/
+    unsigned long numConUL = 0;    /*Number of clusters to compare*/
+    unsigned long ulCon = 0;       /*Cluster comparing to*/
+    unsigned long *nextBinAryUL = 0; /*First cluster in the next bin*/
+    char *simAryC = 0;             /*1: consensuses to similar*/
+    char allConFaCStr[256];        /*Multi-fasta with all consensuses*/
        
     /******************************************************************\
     * Main Sec-1 Sub-2: Help message
@@ -165,12 +219,71 @@ int main(
             \n findCoInfc -fastq reads.fastq -ref refs.fasta [Options]\
             \n    -fastq:\
             \n        - Fastq file with reads to search      [Required]\
+            \n        - Can be gzip or bgzip compressed. bgzip\
+            \n          files are decompressed on -threads\
+            \n          threads (if bgzip is installed).\
             \n    -ref:\
             \n        -Fasta file with references for bining [Required]\
             \n    -prefix:\
             \n        - Prefix to add to file names          [Out]\
             \n    -threads:\
             \n        - Number of threads to use             [3]\
+            \n    -bin-threads:                              [1]\
+            \n        - Number of bins to cluster at the\
+            \n          same time.\
+            \n        - The -threads are split between the\
+            \n          bins being clustered.\
+            \n    -in-map:                                   [No]\
+            \n        - Map with the built in minimizer mapper\
+            \n          instead of minimap2. It is single\
+            \n          threaded and does not report\
+            \n          supplementary alignments.\
+            \n        - Primers (-primers) are found with\
+            \n          the built in bit-parallel search.\
+            \n    -no-pair-aln:                              [No]\
+            \n        - Compare reads to the best read &\
+            \n          consensuses to consensuses with\
+            \n          minimap2 (or -in-map) instead of\
+            \n          the built in pairwise aligner.\
+            \n    -ref-cache:                                [None]\
+            \n        - Directory to keep reference indexes\
+            \n          in. The index for -ref is made once\
+            \n          & reused by later runs with the same\
+            \n          references (minimap2 .mmi or the\
+            \n          -in-map index).\
+            \n    -tmp-dir:                                  [.]\
+            \n        - Directory to make this runs scratch\
+            \n          directory (unique name) in. All\
+            \n          intermediate files go in the scratch\
+            \n          directory, so runs can share a working\
+            \n          directory. Use a tmpfs (/dev/shm) to\
+            \n          keep the temporary files in memory.\
+            \n        - The kept clusters are moved to -prefix\
+            \n          at the end.\
+            \n    -bench-tsv:                                [None]\
+            \n        - Time each stage & append the times\
+            \n          to this tsv file (run, stage, calls,\
+            \n          seconds). The run is the -prefix.\
+            \n        - Stages run on -bin-threads threads\
+            \n          are in thread seconds.\
+            \n    -gzip-out:                                 [No]\
+            \n        - Compress the kept clusters fastq files\
+            \n          with bgzip (or pigz or gzip).\
+            \n    -no-read-arena:                            [No]\
+            \n        - Do not keep the reads of the bin\
+            \n          being clustered in memory. The bins\
+            \n          fastq is re-read (& the median\
+            \n          Q-scores found again) for each\
+            \n          cluster.\
+            \n        - Uses less memory. Keeping the reads\
+            \n          needs the memory for one bins reads\
+            \n          per -bin-threads.\
+            \n    -batch-assign:                             [No]\
+            \n        - After clustering a bin, map all its\
+            \n          reads to all its consensuses at once.\
+            \n          Each read goes to the consensus it\
+            \n          maps best to, instead of the first\
+            \n          consensus that kept it.\
             \n    -primers:                                  [None]\
             \n        - Fasta file with primers to trim\
             \n          reads with.\
@@ -185,6 +298,13 @@ int main(
             \n    -max-reads-per-con:\
             \n        - Max number of reads to use in        [300]\
             \n          a consensus.\
+            \n    -presel-mult:                              [4]\
+            \n        - Only map the presel-mult *\
+            \n          -max-reads-per-con reads that share\
+            \n          the most minimizers with the best\
+            \n          read (or consensus) when picking the\
+            \n          reads to build a consensus with.\
+            \n        - 0 maps all reads in the bin.\
             \n    -min-con-length:                               [500]\
             \n       - Discard consensuses that are under the\
             \n         input length.\
@@ -225,6 +345,10 @@ int main(
             \n          Medaka if Racon and Medaka set.\
             \n    -enable-racon: [No]\
             \n       - Use Racon in building consensuses.\
+            \n    -enable-poa: [No]\
+            \n       - Use the built in partial order\
+            \n         alignment (POA) in building\
+            \n         consensuses (no Racon needed).\
             \n    -enable-medaka: [No]\
             \n       - Use Medaka in building consensuses.\
             \n    -model: [r941_min_high_g351]\
@@ -291,6 +415,13 @@ int main(
             \n    -max-reads-per-con:\
             \n        - Max number of reads to use in        [300]\
             \n          a consensus.\
+            \n    -presel-mult:                              [4]\
+            \n        - Only map the presel-mult *\
+            \n          -max-reads-per-con reads that share\
+            \n          the most minimizers with the best\
+            \n          read (or consensus) when picking the\
+            \n          reads to build a consensus with.\
+            \n        - 0 maps all reads in the bin.\
             \n    -extra-consensus-steps:                    [2]\
             \n        - Number of times to rebuild the\
             \n          consensus using a new set of best\
@@ -315,6 +446,17 @@ int main(
             \n    -rounds-racon:\
             \n        - Number of rounds to polish a         [4]\
             \n          consensus with racon\
+            \n    -enable-poa:                                  [No]\
+            \n        - Build the consensus with the built in\
+            \n          partial order alignment (POA). Runs\
+            \n          after the majority consensus & before\
+            \n          racon.\
+            \n    -rounds-poa:\
+            \n        - Number of rounds to build a          [2]\
+            \n          consensus with POA\
+            \n    -poa-band:                                    [64]\
+            \n        - Bases on each side of a reads\
+            \n          diagonal to align in POA.\
             \n    -enable-medaka:                               [No]\
             \n        - Do not use medaka to polish the\
             \n          consensus.\
@@ -341,7 +483,14 @@ int main(
             \n    - If this setting is off, then supplemental\
             \n      alignments are just ignored.\
             \n    - This setting requires running minimap2 with\
-            \n      just one thread for binning.\
+            \n      just one thread for binning, unless\
+            \n      -thread-bin is used.\
+            \n -thread-bin                               [No]\
+            \n    - Bin with all -threads. minimap2 gets\
+            \n      every thread & reads are scored on\
+            \n      -threads threads.\
+            \n    - -rm-sup-reads finds reads with\
+            \n      supplemental alignments by read id.\
             \n -read-ref-snps:                           [0.02 = 2%]\
             \n    - Minimum percentage of snps needed to\
             \n      discard a read during the read to\
@@ -520,6 +669,26 @@ int main(
             \n\
             \n     -skip-clust:                                [No]\
             \n        - Skip the clusterin step.\
+            \n     -clust-graph:                               [No]\
+            \n        - Split each bin into all of its clusters\
+            \n          at once with a read graph (V2 method).\
+            \n          Reads are joined to the reads that\
+            \n          share the most minimizers with them.\
+            \n          A consensus is then built for each\
+            \n          cluster (-bin-threads at once).\
+            \n        - The best read is picked by median Q.\
+            \n     -graph-edges:                               [20]\
+            \n        - Number of most similar reads to join\
+            \n          each read to (-clust-graph).\
+            \n        - Reads are also joined to the reads\
+            \n          that picked them.\
+            \n     -graph-min-share:                      [0.1 = 10%]\
+            \n        - Minimum fraction of minimizers two\
+            \n          reads must share to be joined.\
+            \n     -graph-min-edges:                           [5]\
+            \n        - Minimum number of joined reads needed\
+            \n          to keep a read in a cluster & to\
+            \n          merge two clusters (V2 -n).\
             \n     -min-read-con-map-length:                   [500]\
             \n        - Minimum aligned read length needed to\
             \n          keep a read to consensus mapping.\
@@ -631,6 +800,12 @@ int main(
             \n          and deletions needed to merge \
             \n          consensuses during the consensus to\
             \n          consensus comparison steps.\
+            \n     -con-con-sketch-margin:               [0.05 = 5%]\
+            \n        - Consensuses are first compared by\
+            \n          their k-mer sketches. Pairs estimated\
+            \n          to be more than -con-con-diff +\
+            \n          this different are not mapped.\
+            \n        - Use 1 to map all pairs.\
             \n\
             \n\
             \n The scoring settings for the consensus comparison steps\
@@ -684,6 +859,7 @@ int main(
     blankMinStatsConCon(&conToConMinStats);
 
     initConBuildStruct(&conSet);          /*default consensus settings*/
+    initGraphClustSet(&graphSet);         /*default graph settings*/
     conSet.useStatBl = 1;/*Select read with stats file from scoreReads*/
 
     initSamEntry(&samStruct);
@@ -711,11 +887,18 @@ int main(
             &fqPathCStr,
             &refsPathCStr,
             &primPathCStr,
+            &refCacheCStr,
+            &benchTsvCStr,
+            &tmpDirCStr,
             threadsCStr,
+            &binThreadsUI,
             &rmSupAlnBl,
+            &threadBinBl, /*1: Score reads on threads when binning*/
             &skipBinBl,   /*1: Skip the binning step, 0 do not*/
             &skipClustBl, /*1: Skip the clusterin step, 0 do not*/
+            &gzipOutBl,   /*1: gzip the kept clusters fastq files*/
             &minReadsDbl,
+            &graphSet,              /*read graph settings*/
             &conSet,                /*consensus building settings*/
             &readToRefMinStats,
             &readToReadMinStats,
@@ -801,6 +984,7 @@ int main(
 
     if(!(conSet.majConSet.useMajConBl |
          conSet.raconSet.useRaconBl |
+         conSet.poaSet.usePoaBl |
          conSet.medakaSet.useMedakaBl
     )) { /*If the user said to ingore all consensus building steps*/
         printf("Current settings have turned off all consensus");
@@ -868,8 +1052,11 @@ int main(
     fclose(logFILE); /*Closing to avoid system appending to open file*/
     logFILE = 0;
 
-    if(system(tmpCmdCStr) != 0)
-    { /*If minimap2 does not exist*/
+    /*-in-map also finds primers with the built in primer search*/
+    if(
+         !(readToRefMinStats.inMapBl & 1)
+      && system(tmpCmdCStr) != 0
+    ) { /*If minimap2 does not exist*/
         fprintf(stderr, "Minimap2 could not be found\n");
         logFILE = fopen(logFileCStr, "a");
         fprintf(logFILE, "Minimap2 could not be found\n");
@@ -1044,6 +1231,31 @@ int main(
 
         /*Print out file used for user*/
         fprintf(logFILE, "    -ref %s \\\n", refsPathCStr);
+
+        if(refCacheCStr != 0)
+        { /*If using a cached reference index*/
+            fprintf(logFILE, "    -ref-cache %s \\\n", refCacheCStr);
+
+            errUC =
+                getMapRefCache(
+                    refsPathCStr,
+                    refCacheCStr,
+                    readToRefMinStats.inMapBl,
+                    refIdxCStr
+                ); /*Find or make the index*/
+
+            if(errUC & 1)
+                refsPathCStr = refIdxCStr; /*Bin with the saved index*/
+            else
+            { /*Else could not make the index*/
+                fprintf(
+                    stderr,
+                    "Could not cache the -ref index in %s, using %s\n",
+                    refCacheCStr,
+                    refsPathCStr
+                ); /*Let user know the index is not cached*/
+            } /*Else could not make the index*/
+        } /*If using a cached reference index*/
     } /*If binning reads*/
 
     /******************************************************************\
@@ -1096,6 +1308,7 @@ int main(
 
     /*Print out the number of threads input*/
     fprintf(logFILE, "    -threads %s \\\n", threadsCStr);
+    fprintf(logFILE, "    -bin-threads %u \\\n", binThreadsUI);
 
     /*Print out the general settings*/
     fprintf(logFILE, "    -prefix %s \\\n", prefCStr);
@@ -1112,6 +1325,12 @@ int main(
         conSet.maxReadsToBuildConUL
     );
 
+    fprintf(
+        logFILE,
+        "    -presel-mult %u \\\n",
+        conSet.preselMultUI
+    );
+
     fprintf(
         logFILE,
         "    -extra-consensus-steps %u \\\n",
@@ -1126,6 +1345,52 @@ int main(
     if(rmSupAlnBl & 1)
         fprintf(logFILE, "    -rm-sup-reads \\\n");
 
+    if(threadBinBl & 1)
+        fprintf(logFILE, "    -thread-bin \\\n");
+
+    if(readToRefMinStats.inMapBl & 1)
+        fprintf(logFILE, "    -in-map \\\n");
+
+    if(!(readToReadMinStats.pairAlnBl & 1))
+        fprintf(logFILE, "    -no-pair-aln \\\n");
+
+    if(!(conSet.readArenaBl & 1))
+        fprintf(logFILE, "    -no-read-arena \\\n");
+
+    if(conSet.batchAssignBl & 1)
+        fprintf(logFILE, "    -batch-assign \\\n");
+
+    if(gzipOutBl & 1)
+        fprintf(logFILE, "    -gzip-out \\\n");
+
+    if(graphSet.useGraphBl & 1)
+    { /*If clustering with the read graph*/
+        fprintf(logFILE, "    -clust-graph \\\n");
+
+        fprintf(
+            logFILE,
+            "    -graph-edges %u \\\n",
+            graphSet.numEdgesUI
+        );
+
+        fprintf(
+            logFILE,
+            "    -graph-min-share %f \\\n",
+            graphSet.minShareF
+        );
+
+        fprintf(
+            logFILE,
+            "    -graph-min-edges %u \\\n",
+            graphSet.minEdgesUI
+        );
+    } /*If clustering with the read graph*/
+
+    if(benchTsvCStr != 0)
+        fprintf(logFILE, "    -bench-tsv %s \\\n", benchTsvCStr);
+
+    fprintf(logFILE, "    -tmp-dir %s \\\n", tmpDirCStr);
+
     if(!(conSet.useStatBl & 1) || skipBinBl & 1)
     { /*If using the median Q-score*/
         fprintf(logFILE, "    -pick-read-with-med-q \\\n");
@@ -1175,6 +1440,19 @@ int main(
         );
     } /*If using racon*/
 
+    if(conSet.poaSet.usePoaBl & 1)
+    { /*If using the built in POA*/
+        fprintf(logFILE, "    -enable-poa \\\n");
+
+        fprintf(
+           logFILE,
+           "    -rounds-poa %u \\\n",
+           conSet.poaSet.rndsPoaUC
+        );
+
+        fprintf(logFILE, "    -poa-band %u \\\n", conSet.poaSet.bandUI);
+    } /*If using the built in POA*/
+
     if(conSet.medakaSet.useMedakaBl & 1)
     { /*If using medaka*/
         fprintf(logFILE, "    -enable-medaka \\\n");
@@ -1458,6 +1736,13 @@ int main(
         conToConMinStats.minIndelsFlt
     );
 
+    fprintf(
+        logFILE,
+        "    -con-con-sketch-margin %f \\\n",
+        
+        conToConMinStats.sketchMarginFlt
+    );
+
     /******************************************************************\
     * Main Sec-5 Sub-6: Print out scoring settings for read mapping
     \******************************************************************/
@@ -1645,38 +1930,107 @@ int main(
     ^ Main Sec-6: Find initial bins with references
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(benchTsvCStr != 0)
+    { /*If timing each stage*/
+        enableBenchTime();
+        runStartDbl = getBenchTime();
+    } /*If timing each stage*/
+
+    /*Make a scratch directory only this run uses*/
+    sprintf(scratchDirCStr, "%s/findCoInft-tmp-XXXXXX", tmpDirCStr);
+
+    if(mkdtemp(scratchDirCStr) == 0)
+    { /*If could not make the scratch directory*/
+        fprintf(
+            stderr,
+            "Could not make a scratch directory in %s (-tmp-dir)\n",
+            tmpDirCStr
+        );
+
+        freeStackSamEntry(&samStruct);
+        freeStackSamEntry(&refStruct);
+        exit(1);
+    } /*If could not make the scratch directory*/
+
+    /*Bins are named with the part of the prefix after the last '/'*/
+    tmpCStr = prefCStr + strlen(prefCStr);
+
+    while(tmpCStr > prefCStr && *(tmpCStr - 1) != '/')
+        --tmpCStr;
+
+    sprintf(workPrefCStr, "%s/%s", scratchDirCStr, tmpCStr);
+    lenWorkPrefUL = strlen(workPrefCStr);
+
+    logFILE = fopen(logFileCStr, "a");
+    fprintf(logFILE, "Scratch directory: %s\n", scratchDirCStr);
+    fclose(logFILE);
+    logFILE = 0;
+
     if(primPathCStr != 0)
     { /*If trimming reads with primers*/
-        tmpCStr = cStrCpInvsDelm(primOutFqCStr, prefCStr);
+        tmpCStr = cStrCpInvsDelm(primOutFqCStr, workPrefCStr);
         tmpCStr = cStrCpInvsDelm(tmpCStr, "--trim.fastq");
-        trimPrimers(
-            primPathCStr,   /*Primers to trim with*/
-            0,              /*Not using a paf file*/
-            0,              /*Not using paf file from stdin*/
-            fqPathCStr,     /*reads to trim*/
-            primOutFqCStr,  /*Output file*/
-            threadsCStr,
-            1               /*Using the hashing algorithm*/
-        ); /*Trim the reads*/
+        startDbl = getBenchTime();
+
+        if(readToRefMinStats.inMapBl & 1)
+            trimPrimersInSearch(
+                primPathCStr,   /*Primers to trim with*/
+                fqPathCStr,     /*reads to trim*/
+                primOutFqCStr,  /*Output file*/
+                threadsCStr,
+                defPrimMaxErrF, /*Max edits (fraction of primer length)*/
+                defPrimEndLenUI /*Search the whole read*/
+            ); /*Trim the reads with the built in primer search*/
+
+        else
+            trimPrimers(
+                primPathCStr,   /*Primers to trim with*/
+                0,              /*Not using a paf file*/
+                0,              /*Not using paf file from stdin*/
+                fqPathCStr,     /*reads to trim*/
+                primOutFqCStr,  /*Output file*/
+                threadsCStr,
+                1               /*Using the hashing algorithm*/
+            ); /*Trim the reads*/
+
+        addBenchTime(benchTrimPrimersUC, startDbl);
 
         fqPathCStr = primOutFqCStr; /*Set this as the default fastq*/
     } /*If trimming reads with primers*/
 
     if(!(skipBinBl & 1))
     { /*If binning reads*/
-        binTree =
-            binReads(
-                fqPathCStr,        /*Fastq file to bin*/
-                refsPathCStr,      /*References to bin with*/
-                prefCStr,          /*prefix to name all bins with*/
-                threadsCStr,      /*Number of threads to use with minimap2*/
-                rmSupAlnBl,         /*Remove supplementary alignments*/
-                1,                  /*1: trim reads, 0: do not*/
-                &samStruct,
-                &refStruct,
-                &readToRefMinStats,
-                &errUC              /*Reports any errors*/
-        );
+        startDbl = getBenchTime();
+
+        if(threadBinBl & 1)
+            binTree =
+                binReadsThreaded(
+                    fqPathCStr,     /*Fastq file to bin*/
+                    refsPathCStr,   /*References to bin with*/
+                    workPrefCStr,   /*prefix to name all bins with*/
+                    threadsCStr,    /*Number of threads to use*/
+                    rmSupAlnBl,     /*Remove supplementary alignments*/
+                    1,              /*1: trim reads, 0: do not*/
+                    &readToRefMinStats,
+                    &errUC          /*Reports any errors*/
+            ); /*Bin reads with threads*/
+
+        else
+            binTree =
+                binReads(
+                    fqPathCStr,     /*Fastq file to bin*/
+                    refsPathCStr,   /*References to bin with*/
+                    workPrefCStr,   /*prefix to name all bins with*/
+                    threadsCStr,    /*Number of threads for minimap2*/
+                    rmSupAlnBl,     /*Remove supplementary alignments*/
+                    1,              /*1: trim reads, 0: do not*/
+                    &samStruct,
+                    &refStruct,
+                    &readToRefMinStats,
+                    &errUC          /*Reports any errors*/
+            );
+
+        addBenchTime(benchBinReadsUC, startDbl);
 
         if(primPathCStr != 0)
             remove(fqPathCStr); /*Not the original file*/
@@ -1727,13 +2081,11 @@ int main(
     ^ Main Sec-7: Non-reference based binning steps
     ^    main sec-7 sub-1: Set up for clustering or consnsus buidling
     ^    main sec-7 sub-2: Print read counts for bins & decide if keep
-    ^    main sec-7 sub-3: Set up readBin to hold a clusters files
-    ^    main sec-7 sub-4: Build the consensus
-    ^    main sec-7 sub-5: Copy best read back into to its orignal bin
-    ^    main sec-7 sub-6: Bin reads to the consensus
-    ^    main sec-7 sub-7: Compare new consensus to old consensuses
-    ^    main sec-7 sub-8: Update list of clusters in bin
-    ^    main sec-7 sub-9: Add clusters to bin & move to next bin
+    ^    main sec-7 sub-3: Make an array of the kept bins
+    ^    main sec-7 sub-4: Cluster the bins & build consensuses
+    ^        - Each bin is independent, so bins are clustered at the
+    ^          same time when -bin-threads is over 1
+    ^    main sec-7 sub-5: Check for errors & count kept reads
     ^        - Before going in the bin list is an balanced tree
     ^        - after this the bins are in a list, with the left pointer
     ^          pointing towards the bins & the right pointer pointing
@@ -1754,7 +2106,7 @@ int main(
         binTree->balUChar = 1; /*To mark keeping*/
 
         /*Make a copy of the fastq file to protect the original*/
-        tmpCStr = cStrCpInvsDelm(binTree->fqPathCStr, prefCStr);
+        tmpCStr = cStrCpInvsDelm(binTree->fqPathCStr, workPrefCStr);
         tmpCStr = cStrCpInvsDelm(tmpCStr, "--clust.fastq");
 
         filterReads(
@@ -1789,9 +2141,6 @@ int main(
 
     while(clustOn != 0)
     { /*While have reads to cluster*/
-        conSet.clustUC = 0;
-        lastClust = clustOn; /*Head of cluster list*/
-
         fprintf(
             statFILE,
             "%s\t%lu",
@@ -1823,191 +2172,132 @@ int main(
         fprintf(statFILE, "\tkept\tfirst-binning\n");
         fflush(statFILE); /*make sure io printed out*/
 
+        ++numBinsUL;
+        lastBin = clustOn; /*For reording the list*/
+        clustOn = clustOn->leftChild;
+    } /*While have reads to cluster*/
+
+    /******************************************************************\
+    * Main Sec-7 Sub-3: Make an array of the kept bins
+    \******************************************************************/
+
+    if(numBinsUL > 0)
+    { /*If have bins to cluster*/
+        binAry = malloc(sizeof(struct readBin *) * numBinsUL);
+        binErrAryUC = malloc(sizeof(uint8_t) * numBinsUL);
+        binKeptAryUL = malloc(sizeof(unsigned long) * numBinsUL);
+    } /*If have bins to cluster*/
+
+    if(numBinsUL > 0 &&
+       (binAry == 0 || binErrAryUC == 0 || binKeptAryUL == 0)
+    ) errUC = 64;
+
+    else
+    { /*Else have the memory to cluster*/
+        clustOn = binTree;
+
+        for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+        { /*Loop: Add bins to the array (in list order)*/
+            binAry[ulBin] = clustOn;
+            clustOn = clustOn->leftChild;
+        } /*Loop: Add bins to the array (in list order)*/
+
         /**************************************************************\
-        * Main Sec-7 Sub-3: Set up readBin to hold a clusters files
+        * Main Sec-7 Sub-4: Cluster the bins & build consensuses
         \**************************************************************/
- 
-        while(clustOn->numReadsULng >= conSet.minReadsToBuildConUL)
-        { /*While have reads to bin*/
-            errUC = 0; /*reset*/
 
-            if(tmpBin == 0)
-                tmpBin = malloc(sizeof(struct readBin));
+        if((graphSet.useGraphBl & 1) && !(skipClustBl & 1))
+            errUC =
+                graphClustBins(
+                    binAry,       /*Bins to cluster*/
+                    numBinsUL,    /*Number of bins to cluster*/
+                    binThreadsUI, /*Number bins to work on at once*/
+                    threadsCStr,  /*Total threads; split between bins*/
+                    &graphSet,    /*Settings for the read graph*/
+                    &conSet,      /*settings for building a consensus*/
+                    &readToReadMinStats,
+                    &readToConMinStats,
+                    &conToConMinStats,
+                    binErrAryUC,  /*Gets errors for each bin*/
+                    binKeptAryUL  /*Gets number of kept reads per bin*/
+            ); /*Split each bin into clusters & build their consensus*/
 
-            if(tmpBin != 0)
-            { /*If I need to blank the bin*/
-                blankReadBin(tmpBin);
-                tmpBin->balUChar = 1; /*To mark keeping*/
-            } /*If I need to blank the bin*/
+        else
+            errUC =
+                clustBins(
+                    binAry,       /*Bins to cluster*/
+                    numBinsUL,    /*Number of bins to cluster*/
+                    binThreadsUI, /*Number bins to cluster at once*/
+                    threadsCStr,  /*Total threads; split between bins*/
+                    skipClustBl,  /*1: only build consensuses*/
+                    &conSet,      /*settings for building a consensus*/
+                    &readToReadMinStats,
+                    &readToConMinStats,
+                    &conToConMinStats,
+                    binErrAryUC,  /*Gets errors for each bin*/
+                    binKeptAryUL  /*Gets number of kept reads per bin*/
+            ); /*Cluster each bin & build a consensus for each cluster*/
+    } /*Else have the memory to cluster*/
 
-            else
-            { /*Else memory allocation error*/
-                logFILE = fopen(logFileCStr, "a");
+    /******************************************************************\
+    * Main Sec-7 Sub-5: Check for errors & count kept reads
+    \******************************************************************/
 
-                fprintf(
-                    stderr,
-                    "Memory error in non-ref binning (main sec-7)\n"
-                ); /*Let user know about memory issue*/
+    for(unsigned long ulBin = 0; ulBin < numBinsUL; ++ulBin)
+    { /*Loop: Check each bin in list order*/
+        if(errUC & 64)
+            break;
 
-                fprintf(
-                    logFILE,
-                    "Memory error in non-ref binning (main sec-7)\n"
-                );
+        errUC |= binErrAryUC[ulBin] & 64;
+        totalKeptReadsUL += binKeptAryUL[ulBin];
+    } /*Loop: Check each bin in list order*/
 
-                fclose(logFILE);
-                freeStackSamEntry(&samStruct);
-                freeStackSamEntry(&refStruct);
-
-                freeBinTree(&binTree);
-
-                exit(1); 
-            } /*Else memory allocation error*/
-
-            /**********************************************************\
-            * Main Sec-7 Sub-4: Buld the consensus
-            \**********************************************************/
-
-             errUC  = 
-                 buildCon(
-                     clustOn,
-                     0,        /*Path to fasta file with reference*/
-                     threadsCStr, /*# threads to use with system calls*/
-                     &conSet,     /*settings for building a consensus*/
-                     &samStruct,  /*Will hold sam file data*/
-                     &refStruct,  /*For read median Q extraction*/
-                     &readToReadMinStats,
-                     &readToConMinStats
-            ); /*Builds a consensus using fastq file & best read*/
-
-            if(errUC & 16)
-                continue;
-                /*Unable to build consensus, let loop terminate*/
+    free(binAry);
+    free(binErrAryUC);
+    free(binKeptAryUL);
+    binAry = 0;
+    binErrAryUC = 0;
+    binKeptAryUL = 0;
 
-            if(errUC & 64)
-            { /*If had a memory allocation error*/
-                logFILE = fopen(logFileCStr, "a");
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        logFILE = fopen(logFileCStr, "a");
 
-                fprintf(
-                    stderr,
-                    "Memory error in cluster step (main sec-7 sub-2)\n"
-                ); /*Let user know about memory issue*/
+        fprintf(
+            stderr,
+            "Memory error in cluster step (main sec-7)\n"
+        ); /*Let user know about memory issue*/
 
-                fprintf(
-                    logFILE,
-                    "Memory error in cluster step (main sec-7 sub-2)\n"
-                );
+        fprintf(
+            logFILE,
+            "Memory error in cluster step (main sec-7)\n"
+        );
 
-                fclose(logFILE);
-                freeStackSamEntry(&samStruct);
-                freeStackSamEntry(&refStruct);
-
-                freeBinTree(&binTree);
-                exit(1); 
-            } /*If had a memory allocation error*/
-
-            /**********************************************************\
-            * Main Sec-7 Sub-5: Copy best read back to its oringal bin
-            * buildCon already did this
-            \**********************************************************/
-
-            /*++clustOn->numReadsULng;*/ /*Account for the best read*/
-            /*tmpFILE = fopen(clustOn->bestReadCStr, "r");
-            fqBinFILE = fopen(clustOn->fqPathCStr, "a");
-
-            while(fgets(
-                    refStruct.samEntryCStr,
-                    refStruct.lenBuffULng,
-                    tmpFILE
-                )*/ /*Read in file line*/
-            /*) fprintf(tmpFILE, "%s", refStruct.samEntryCStr);
-    
-            fclose(tmpFILE);
-            fclose(fqBinFILE);
-
-            remove(clustOn->bestReadCStr);*/
-                 /*Remove best read consensus*/
-
-            /**********************************************************\
-            * Main Sec-7 Sub-6: Bin reads to the consensus
-            \**********************************************************/
-
-            /*Copy the consensus name to the clusters bin*/
-            strcpy(tmpBin->consensusCStr, clustOn->consensusCStr);
-
-            if(skipClustBl & 1)
-            { /*If not clustering, move onto the next bin*/
-                lastClust->rightChild = tmpBin;
-                /*So can merge bins durning consensus comparisions*/
-                tmpBin->numReadsULng = lastClust->numReadsULng;
-                totalKeptReadsUL += tmpBin->numReadsULng;
-
-                strcpy(tmpBin->fqPathCStr, lastClust->fqPathCStr);
-                lastClust->fqPathCStr[0] = '\0';/*avoid deleting atEnd*/
-                tmpBin = 0;
-                break;        /*If not clusterin, move to next bin*/
-            } /*If not clustering, move onto the next bin*/
-
-            binReadToCon(
-                &conSet.clustUC,    /*Cluster on*/
-                clustOn,            /*Bin working on*/
-                tmpBin,             /*Bin to hold the cluster*/
-                &samStruct,         /*To hold temporary input*/
-                &readToConMinStats, /*Settings to keep read to con*/
-                threadsCStr         /*# threads to use with Minimap2*/
-            ); /*Find reads that mapp to the consensus*/
-
-            /*Find how many reads were kept in clustering*/
-            totalKeptReadsUL += tmpBin->numReadsULng;
-
-            /**********************************************************\
-            * Main Sec-7 Sub-7: Compare new consensus to old consensuses
-            \**********************************************************/
-
-            *clustOn->consensusCStr = '\0';
-
-            bestBin =
-                cmpCons(
-                    tmpBin,       /*Bin with consensus to compare*/
-                    clustOn,     /*Other clusters to comapre to*/
-                    &samStruct,  /*Struct to hold input from minimap2*/
-                    &refStruct,  /*Struct to hold input from minimap2*/
-                    &conToConMinStats, /*Cons to consensus thresholds*/
-                    threadsCStr  /*Number threads to use with Minimap2*/
-            ); /*Compares a consenses to other consensuses*/
-
-            /**********************************************************\
-            * Main Sec-7 Sub-8: Update list of clusters in bin
-            \**********************************************************/
-
-            if(bestBin != 0)
-            { /*If the consensuses are to similar (the same?)*/
-                mergeBins(bestBin, tmpBin);
-                continue; /*This cluster is not worth keeping*/
-            } /*If the consensuses are to similar (the same?)*/
+        fclose(logFILE);
+        fclose(statFILE);
+        freeStackSamEntry(&samStruct);
+        freeStackSamEntry(&refStruct);
 
-            /*else add this bin to the end of the list*/
-            lastClust->rightChild = tmpBin;
-            lastClust = tmpBin;
-            tmpBin = 0;
-            ++conSet.clustUC;
-        } /*While have reads to bin*/
+        freeBinTree(&binTree);
+        exit(1); 
+    } /*If had a memory allocation error*/
 
-        /**************************************************************\
-        * Main Sec-7 Sub-9: Add clusters to bin & move to next bin
-        \**************************************************************/
+    logFILE = fopen(logFileCStr, "a");
 
-        lastBin = clustOn; /*For reording the list*/
-        clustOn = clustOn->leftChild;
-    } /*While have reads to cluster*/
+    fprintf(
+        logFILE,
+        "Consensus pairs skipped by the k-mer sketches: %lu\n",
+        conSet.numSkipConUL
+    ); /*Let user know how many pairs were not mapped*/
 
-    if(tmpBin != 0)
-        freeReadBin(&tmpBin); /*Make sure no loose ends*/
+    fclose(logFILE);
+    logFILE = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     ^ Main Sec-8: Compare all consensus to remove false positives
     ^    main sec-8 sub-1: Remove empty bins (no clusters) from list
     ^    - Also remove uneeded files
-    ^    main sec-8 sub-2: Find most similar consensus to the cluster
+    ^    main sec-8 sub-2: Compare all consensuses with one minimap2 call
     ^    main sec-8 sub-3: If consensuses are to similar, merge clusters
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
@@ -2028,10 +2318,13 @@ int main(
 
             while(tmpBin != 0)
             { /*While have clusters to print out*/
+                /*Print the name the consensus will have when it is
+                  moved out of the scratch directory*/
                 fprintf(
                     statFILE,
-                    "%s\t%lu\tkept\tclustering\n",
-                    tmpBin->consensusCStr,
+                    "%s%s\t%lu\tkept\tclustering\n",
+                    prefCStr,
+                    tmpBin->consensusCStr + lenWorkPrefUL,
                     tmpBin->numReadsULng
                 ); /*While have clusters to print out*/
 
@@ -2066,90 +2359,194 @@ int main(
     } /*While have bins to check*/
 
     /******************************************************************\
-    * Main Sec-8 Sub-2: Find the most similar consensus to the cluster
+    * Main Sec-8 Sub-2: Compare all consensuses with one minimap2 call
     \******************************************************************/
 
-    /*Just rerun this step if just did clustering, should end pretty
-      quickly*/
+    /*Count the clusters that are still around*/
+    numConUL = 0;
     clustOn = binTree;
-    lastClust = 0;     /*marks when have to leave consensus*/
 
     while(clustOn != 0)
-    { /*While have bins to compare*/
-        tmpBin = clustOn->rightChild; /*First cluster in bin*/
+    { /*While have bins to count clusters for*/
+        tmpBin = clustOn->rightChild;
 
         while(tmpBin != 0)
-        { /*While have clusters to compare to other clusters*/
-            if(tmpBin->balUChar < 0)
-            { /*If have already merged this bin*/
+        { /*While have clusters to count*/
+            if(tmpBin->balUChar >= 0)
+                ++numConUL;
+
+            tmpBin = tmpBin->rightChild;
+        } /*While have clusters to count*/
+
+        clustOn = clustOn->leftChild;
+    } /*While have bins to count clusters for*/
+
+    if(numConUL > 0)
+    { /*If have clusters to compare*/
+        binAry = malloc(sizeof(struct readBin *) * numConUL);
+        nextBinAryUL = malloc(sizeof(unsigned long) * numConUL);
+        simAryC = malloc(sizeof(char) * numConUL * numConUL);
+
+        if(binAry == 0 || nextBinAryUL == 0 || simAryC == 0)
+            errUC = 64;
+    } /*If have clusters to compare*/
+
+    if(numConUL > 0 && !(errUC & 64))
+    { /*If have the memory to compare the consensuses*/
+        /*Add the clusters to the array in list order. nextBinAryUL
+          marks the first cluster in the next bin, since clusters
+          from the same bin were already compared when clustering*/
+        numConUL = 0;
+        clustOn = binTree;
+
+        while(clustOn != 0)
+        { /*While have bins to add clusters from*/
+            tmpBin = clustOn->rightChild;
+            ulCon = numConUL; /*First cluster in this bin*/
+
+            while(tmpBin != 0)
+            { /*While have clusters in this bin to add*/
+                if(tmpBin->balUChar >= 0)
+                { /*If the cluster was not removed*/
+                    binAry[numConUL] = tmpBin;
+                    ++numConUL;
+                } /*If the cluster was not removed*/
+
                 tmpBin = tmpBin->rightChild;
-                continue; /*Already merged this bin*/
-            } /*If have already merged this bin*/
+            } /*While have clusters in this bin to add*/
+
+            while(ulCon < numConUL)
+            { /*While have clusters in this bin to mark*/
+                nextBinAryUL[ulCon] = numConUL;
+                ++ulCon;
+            } /*While have clusters in this bin to mark*/
+
+            clustOn = clustOn->leftChild;
+        } /*While have bins to add clusters from*/
+
+        tmpCStr = cStrCpInvsDelm(allConFaCStr, workPrefCStr);
+        strcpy(tmpCStr, "--all-cons.fasta");
+        startDbl = getBenchTime();
+
+        errUC =
+            cmpAllCons(
+                binAry,            /*Clusters to compare*/
+                numConUL,          /*Number of clusters*/
+                allConFaCStr,      /*Multi-fasta to make*/
+                simAryC,           /*Gets the similarity matrix*/
+                &samStruct,        /*Struct to hold minimap2 output*/
+                &conToConMinStats, /*Cons to consensus thresholds*/
+                threadsCStr        /*Number threads to use with Minimap2*/
+        ); /*Find all consensuses that are to similar*/
+
+        addBenchTime(benchCmpConsUC, startDbl);
+
+        if(!(errUC & 1) && !(errUC & 64))
+        { /*If could not compare the consensuses*/
+            logFILE = fopen(logFileCStr, "a");
+
+            fprintf(
+                logFILE,
+                "Could not compare consensuses (main sec-8), error %u\n",
+                errUC
+            ); /*Let user know no clusters were merged*/
+
+            fclose(logFILE);
+
+            /*No clusters will be merged*/
+            memset(simAryC, 0, numConUL * numConUL * sizeof(char));
+        } /*If could not compare the consensuses*/
+    } /*If have the memory to compare the consensuses*/
+
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        logFILE = fopen(logFileCStr, "a");
+
+        fprintf(
+            stderr,
+            "Memory error in consensus compare step (main sec-8)\n"
+        ); /*Let user know about memory issue*/
+
+        fprintf(
+            logFILE,
+            "Memory error in consensus compare step (main sec-8)\n"
+        );
+
+        fclose(logFILE);
+        fclose(statFILE);
+        freeStackSamEntry(&samStruct);
+        freeStackSamEntry(&refStruct);
+
+        free(binAry);
+        free(nextBinAryUL);
+        free(simAryC);
+        freeBinTree(&binTree);
+        exit(1); 
+    } /*If had a memory allocation error*/
+
+    /******************************************************************\
+    * Main Sec-8 Sub-3: If consensuses to similar, mergeClusters
+    \******************************************************************/
+
+    startDbl = getBenchTime();
+
+    for(unsigned long ulClust = 0; ulClust < numConUL; ++ulClust)
+    { /*Loop: Check each cluster against the clusters in later bins*/
+        tmpBin = binAry[ulClust];
+
+        if(tmpBin->balUChar < 0)
+            continue; /*Already merged this bin*/
+
+        if(tmpBin->numReadsULng < conSet.minReadsToBuildConUL)
+        { /*If not enough reads to keep*/
+            binDeleteFiles(tmpBin); /*Remove its files*/
+            tmpBin->balUChar = -1;
+            continue;
+        } /*If not enough reads to keep*/
+
+        if((double) tmpBin->numReadsULng / (double) totalKeptReadsUL
+           < minReadsDbl
+        ) { /*If discarding the bin*/
+            binDeleteFiles(tmpBin); /*Remove its files*/
+            tmpBin->balUChar = -1; /*mark for removal*/
+            continue;
+        } /*If discarding the bin*/
+
+        /*mergeBins does not rebuild the consensus, so the similarity
+          of tmpBin to the other clusters does not change on a merge*/
+        for(ulCon = nextBinAryUL[ulClust]; ulCon < numConUL; ++ulCon)
+        { /*Loop: Merge clusters with highly similar consensuses*/
+            bestBin = binAry[ulCon];
 
-            if(tmpBin->numReadsULng < conSet.minReadsToBuildConUL)
-            { /*If not enough reads to keep*/
-                binDeleteFiles(tmpBin); /*Remove its files*/
+            if(bestBin->balUChar < 0)
+                continue; /*Already merged or discarded*/
+
+            if(!simAryC[ulClust * numConUL + ulCon])
+                continue; /*Consensuses are different*/
+
+            if(tmpBin->numReadsULng >= bestBin->numReadsULng)
+            { /*If the current cluster has more reads*/
+                mergeBins(tmpBin, bestBin);
+                bestBin->balUChar = -1;
+            } /*If the current cluster has more reads*/
+
+            else
+            { /*else, the best bin has more reads*/
+                mergeBins(bestBin, tmpBin);
                 tmpBin->balUChar = -1;
-                tmpBin = tmpBin->rightChild;
-                continue;
-            } /*If not enough reads to keep*/
+                break; /*Will hit the best bin later*/
+            } /*else, the best bin has more reads*/
+        } /*Loop: Merge clusters with highly similar consensuses*/
+    } /*Loop: Check each cluster against the clusters in later bins*/
 
-            if((double) tmpBin->numReadsULng / (double) totalKeptReadsUL
-               < minReadsDbl
-            ) { /*If discarding the bin*/
-                binDeleteFiles(tmpBin); /*Remove its files*/
-                tmpBin->balUChar = -1; /*mark for removal*/
-                tmpBin = tmpBin->rightChild;
-                continue;
-            } /*If discarding the bin*/
-
-            bestBin =
-                cmpCons(
-                    tmpBin,         /*Consensus to check*/
-                    clustOn->leftChild, /*Other bins & their clusters*/
-                    &samStruct,   /*Struct to hold input from minimap2*/
-                    &refStruct,   /*Struct to hold input from minimap2*/
-                    &conToConMinStats,  /*Cons to consensus thresholds*/
-                    threadsCStr  /*Number threads to use with Minimap2*/
-            ); /*Compares a consenses to other consensuses*/
-
-            /**********************************************************\
-            * Main Sec-8 Sub-3: If consensuses to similar, mergeClusters
-            \**********************************************************/
-
-            while(bestBin != 0)
-            { /*While have clusters with highly similar consensuses*/
-                if(tmpBin->numReadsULng >= bestBin->numReadsULng)
-                { /*If the current cluster has more reads*/
-                    mergeBins(tmpBin, bestBin);
-                    bestBin->balUChar = -1;
-                } /*If the current cluster has more reads*/
-
-                else
-                { /*else, the best bin has more reads*/
-                    mergeBins(bestBin, tmpBin);
-                    tmpBin->balUChar = -1;
-                    break; /*Will hit the best bin later*/
-                } /*else, the best bin has more reads*/
-
-                /*Restart search (no idea about best bin cluster)*/
-                bestBin =
-                    cmpCons(
-                        tmpBin,         /*Consensus to check*/
-                        clustOn->leftChild, /*Other bins*/
-                        &samStruct,         /*hold minimap2 output*/
-                        &refStruct,         /*hold input from minimap2*/
-                        &conToConMinStats,  /*min thresholds*/
-                        threadsCStr     /*Number threads with Minimap2*/
-                ); /*Compares a consenses to other consensuses*/
-            } /*While have clusters with highly similar consensuses*/
-
-           tmpBin = tmpBin->rightChild; /*Move to next cluster*/
-                /*First node is old bin, so is not a cluster*/
-        } /*While have clusters to compare to other clusters*/
-
-        clustOn = clustOn->leftChild; /*Move to next set of clusters*/
-    } /*While have bins to compare*/
+    addBenchTime(benchMergeConsUC, startDbl);
+
+    free(binAry);
+    free(nextBinAryUL);
+    free(simAryC);
+    binAry = 0;
+    nextBinAryUL = 0;
+    simAryC = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Main Sec-9: Build longest read consensuses
@@ -2172,6 +2569,27 @@ int main(
         { /*While have cluster stats to print out*/
             if(tmpBin->balUChar > -1)
             { /*If kept the cluster*/
+                /*Move the clusters files out of the scratch directory*/
+                errUC = mvScratchBin(tmpBin, workPrefCStr, prefCStr);
+
+                if(errUC & 2)
+                    fprintf(
+                        stderr,
+                        "Could not move %s out of %s\n",
+                        tmpBin->consensusCStr,
+                        scratchDirCStr
+                    ); /*Let user know the files are still in scratch*/
+
+                if(gzipOutBl & 1)
+                { /*If compressing the kept fastq files*/
+                    if(!(gzipFqFile(tmpBin->fqPathCStr,threadsCStr) & 1))
+                        fprintf(
+                            stderr,
+                            "Could not gzip %s\n",
+                            tmpBin->fqPathCStr
+                        ); /*Let user know the file is not compressed*/
+                } /*If compressing the kept fastq files*/
+
                 fprintf(
                     statFILE,
                     "%s\t%lu\tkept\tfinal-check\n",
@@ -2190,6 +2608,12 @@ int main(
     ^ Main Sec-10: Clean up and exit
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    if(benchTsvCStr != 0)
+    { /*If timing each stage*/
+        if(!(printBenchTimes(benchTsvCStr, prefCStr, runStartDbl) & 1))
+            fprintf(stderr, "Could not write to %s\n", benchTsvCStr);
+    } /*If timing each stage*/
+
     if(logFILE != 0)
         fclose(logFILE);
     if(statFILE != 0)
@@ -2216,6 +2640,8 @@ int main(
         } /*While have clusters to free*/
     } /*While have bins to free*/
 
+    /*Only removes the scratch directory if it is empty*/
+    remove(scratchDirCStr);
     exit(0);
 } /*main*/
 
@@ -2234,11 +2660,18 @@ char * getUserInput(
     char **fqPathCStr, /*Holds path to fastq file*/
     char **refsPathCStr, /*Holds path to references*/
     char **primPathCStr,/*Holds path to primer fasta file for trimming*/
+    char **refCacheCStr, /*Directory to cache reference indexes in*/
+    char **benchTsvCStr, /*Tsv file to append stage times to*/
+    char **tmpDirCStr,   /*Directory to make the scratch directory in*/
     char *threadsCStr, /*Number threads for minimap2 & racon*/
+    uint32_t *binThreadsUI, /*Number of bins to cluster at once*/
     char *rmSupAlnBl,  /*1: Remove reads with supplemental alignments*/
+    char *threadBinBl, /*1: Score reads on threads when binning*/
     char *skipBinBl,   /*1: Skip the binning step, 0 do not*/
     char *skipClustBl, /*1: Skip the clusterin step, 0 do not*/
+    char *gzipOutBl,   /*1: gzip the kept clusters fastq files*/
     double *minReadsDbl,
+    struct graphClustSet *graphSet,  /*Read graph settings*/
     struct conBuildStruct *conSet,   /*Settings for consensus building*/
     struct minAlnStats *readToRefMinStats, /*Binning scoring settings*/
     struct minAlnStats *readToReadMinStats,/*Read pull scoring setting*/
@@ -2292,12 +2725,34 @@ char * getUserInput(
         else if(strcmp(parmCStr, "-primers") == 0)
             *primPathCStr = inputCStr;  /*references*/
 
+        else if(strcmp(parmCStr, "-ref-cache") == 0)
+        { /*Else if caching the reference index*/
+            if(strlen(inputCStr) > 900)
+                return parmCStr; /*Index path would not fit*/
+
+            *refCacheCStr = inputCStr;
+        } /*Else if caching the reference index*/
+
+        else if(strcmp(parmCStr, "-bench-tsv") == 0)
+            *benchTsvCStr = inputCStr;  /*Stage times file*/
+
+        else if(strcmp(parmCStr, "-tmp-dir") == 0)
+        { /*Else if making the scratch directory somewhere else*/
+            if(strlen(inputCStr) > 100)
+                return parmCStr; /*Bin file names would not fit*/
+
+            *tmpDirCStr = inputCStr;
+        } /*Else if making the scratch directory somewhere else*/
+
         else if(strcmp(parmCStr, "-prefix") == 0)
             strcpy(prefCStr, inputCStr);     /*Have prefix to use*/
 
         else if(strcmp(parmCStr, "-threads") == 0)
             strcpy(threadsCStr, inputCStr);
 
+        else if(strcmp(parmCStr, "-bin-threads") == 0)
+            cStrToUInt(inputCStr, binThreadsUI);
+
         else if(strcmp(parmCStr, "-skip-bin") == 0)
         { /*Else if skipping the binning step*/
             *skipBinBl = 1;
@@ -2310,6 +2765,62 @@ char * getUserInput(
             --intArg; /*Account for this being a true or false*/
         } /*Else if skipping the clustering step*/
 
+        else if(strcmp(parmCStr, "-in-map") == 0)
+        { /*Else if using the built in mapper instead of minimap2*/
+            readToRefMinStats->inMapBl = 1;
+            readToReadMinStats->inMapBl = 1;
+            readToConMinStats->inMapBl = 1;
+            conToConMinStats->inMapBl = 1;
+            conSet->majConSet.inMapBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if using the built in mapper instead of minimap2*/
+
+        else if(strcmp(parmCStr, "-no-pair-aln") == 0)
+        { /*Else if not using the pairwise aligner*/
+            readToReadMinStats->pairAlnBl = 0;
+            conToConMinStats->pairAlnBl = 0;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if not using the pairwise aligner*/
+
+        else if(strcmp(parmCStr, "-gzip-out") == 0)
+        { /*Else if compressing the kept fastq files*/
+            *gzipOutBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if compressing the kept fastq files*/
+
+        else if(strcmp(parmCStr, "-no-read-arena") == 0)
+        { /*Else if re-reading a bins fastq while clustering*/
+            conSet->readArenaBl = 0;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if re-reading a bins fastq while clustering*/
+
+        else if(strcmp(parmCStr, "-read-arena") == 0)
+        { /*Else if keeping a bins reads in memory (the default)*/
+            conSet->readArenaBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if keeping a bins reads in memory (the default)*/
+
+        else if(strcmp(parmCStr, "-batch-assign") == 0)
+        { /*Else if reassigning reads to their best consensus*/
+            conSet->batchAssignBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if reassigning reads to their best consensus*/
+
+        else if(strcmp(parmCStr, "-clust-graph") == 0)
+        { /*Else if clustering bins with the read graph*/
+            graphSet->useGraphBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if clustering bins with the read graph*/
+
+        else if(strcmp(parmCStr, "-graph-edges") == 0)
+            cStrToUInt(inputCStr, &graphSet->numEdgesUI);
+
+        else if(strcmp(parmCStr, "-graph-min-share") == 0)
+            sscanf(inputCStr, "%f", &graphSet->minShareF);
+
+        else if(strcmp(parmCStr, "-graph-min-edges") == 0)
+            cStrToUInt(inputCStr, &graphSet->minEdgesUI);
+
         else if(strcmp(parmCStr, "-min-perc-reads") == 0)
             sscanf(inputCStr, "%lf", minReadsDbl);
 
@@ -2328,8 +2839,17 @@ char * getUserInput(
         else if(strcmp(parmCStr, "-max-reads-per-con") == 0)
             conSet->maxReadsToBuildConUL=strtoul(inputCStr,&tmpCStr,10);
 
+        else if(strcmp(parmCStr, "-presel-mult") == 0)
+            cStrToUInt(inputCStr, &conSet->preselMultUI);
+
         else if(strcmp(parmCStr, "-rounds-racon") == 0)
             cStrToUChar(inputCStr, &conSet->raconSet.rndsRaconUC);
+
+        else if(strcmp(parmCStr, "-rounds-poa") == 0)
+            cStrToUChar(inputCStr, &conSet->poaSet.rndsPoaUC);
+
+        else if(strcmp(parmCStr, "-poa-band") == 0)
+            cStrToUInt(inputCStr, &conSet->poaSet.bandUI);
  
         else if(strcmp(parmCStr, "-extra-consensus-steps") == 0)
             cStrToUInt(inputCStr, &conSet->numRndsToPolishUI);
@@ -2349,6 +2869,12 @@ char * getUserInput(
             --intArg; /*Account for this being a true or false*/
         } /*Else if user is ussing the best read instead of consensus*/
 
+        else if(strcmp(parmCStr, "-enable-poa") == 0)
+        { /*Else if user is using the built in POA*/
+            conSet->poaSet.usePoaBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if user is using the built in POA*/
+
         else if(strcmp(parmCStr, "-enable-medaka") == 0)
         { /*Else if user is ussing the best read instead of consensus*/
             conSet->medakaSet.useMedakaBl = 1;
@@ -2369,6 +2895,12 @@ char * getUserInput(
 
         else if(strcmp(parmCStr, "-rm-sup-reads") == 0)
            *rmSupAlnBl = !(*rmSupAlnBl);
+
+        else if(strcmp(parmCStr, "-thread-bin") == 0)
+        { /*Else if scoring reads on threads when binning*/
+            *threadBinBl = 1;
+            --intArg; /*Account for this being a true or false*/
+        } /*Else if scoring reads on threads when binning*/
            
         /**************************************************************\
         * Fun-1 Sec-2 Sub-2: Percent difference settings
@@ -2417,6 +2949,8 @@ char * getUserInput(
             sscanf(inputCStr, "%f", &conToConMinStats->minInssFlt);
         else if(strcmp(parmCStr, "-con-con-indels") == 0)
             sscanf(inputCStr, "%f", &conToConMinStats->minIndelsFlt);
+        else if(strcmp(parmCStr, "-con-con-sketch-margin") == 0)
+            sscanf(inputCStr, "%f", &conToConMinStats->sketchMarginFlt);
 
         /**************************************************************\
         * Fun-1 Sec-2 Sub-3: scoreReads read to reference settings
@@ -2594,3 +3128,76 @@ char * getUserInput(
 
     return 0;
 } /*getUserInput*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o Each file in binST that exists & starts with workPrefCStr
+|          to start with prefCStr instead. The file is renamed, or
+|          copied if it is on another file system (-tmp-dir on tmpfs)
+|    - Returns:
+|        o 1 if moved all files
+|        o 2 if could not move a file (its name is not changed)
+\---------------------------------------------------------------------*/
+uint8_t mvScratchBin(
+    struct readBin *binST, /*Cluster with the files to move*/
+    char *workPrefCStr,    /*Prefix with the scratch directory*/
+    char *prefCStr         /*Prefix to move the files to*/
+) /*Moves a kept clusters files out of the run scratch directory*/
+{ /*mvScratchBin*/
+    uint8_t errUC = 1;
+    unsigned long lenWorkPrefUL = strlen(workPrefCStr);
+    char newPathCStr[512];
+    char *pathAryCStr[5] =
+        {
+            binST->fqPathCStr,
+            binST->consensusCStr,
+            binST->statPathCStr,
+            binST->bestReadCStr,
+            binST->topReadsCStr
+        }; /*Files in the cluster*/
+
+    FILE *testFILE = 0;
+
+    for(uint8_t uCFile = 0; uCFile < 5; ++uCFile)
+    { /*Loop: Move each file in the cluster*/
+        if(strncmp(pathAryCStr[uCFile], workPrefCStr, lenWorkPrefUL))
+            continue; /*Not in the scratch directory (or no file)*/
+
+        testFILE = fopen(pathAryCStr[uCFile], "r");
+
+        if(testFILE == 0)
+            continue; /*File was already removed*/
+
+        fclose(testFILE);
+
+        sprintf(
+            newPathCStr,
+            "%s%s",
+            prefCStr,
+            pathAryCStr[uCFile] + lenWorkPrefUL
+        ); /*Make the name the file will have outside of scratch*/
+
+        if(strlen(newPathCStr) >= 256)
+        { /*If the new name will not fit in the bin*/
+            errUC = 2;
+            continue;
+        } /*If the new name will not fit in the bin*/
+
+        if(rename(pathAryCStr[uCFile], newPathCStr) != 0)
+        { /*If -tmp-dir is on another file system*/
+            if(!(copyFile(pathAryCStr[uCFile], newPathCStr) & 1))
+            { /*If could not copy the file*/
+                remove(newPathCStr);
+                errUC = 2;
+                continue;
+            } /*If could not copy the file*/
+
+            remove(pathAryCStr[uCFile]);
+        } /*If -tmp-dir is on another file system*/
+
+        strcpy(pathAryCStr[uCFile], newPathCStr);
+    } /*Loop: Move each file in the cluster*/
+
+    return errUC;
+} /*mvScratchBin*/
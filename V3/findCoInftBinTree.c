@@ -85,6 +85,16 @@ struct readBin * makeReadBin(
     retBin->numReadsULng = 1;  /*Their is only one read in this bin*/
     retBin->leftChild = 0;
     retBin->rightChild = 0;
+    retBin->bestReadCStr[0] = '\0'; /*Best read file is named later*/
+    retBin->topReadsCStr[0] = '\0';
+    retBin->consensusCStr[0] = '\0';
+    retBin->arenaST = 0;
+    retBin->headL = -1;
+    retBin->tailL = -1;
+    retBin->bestL = -1;
+    retBin->dirtyBl = 0;
+    retBin->sketchST.lenSketchUI = 0;
+    retBin->sketchST.numKmerUI = 0;
 
     /*******************************************************************
     # Fun-1 Sec-3: Copy reference id
@@ -1131,6 +1141,13 @@ void blankReadBin(
     binToBlank->rightChild = 0;
     binToBlank->leftChild = 0;
     binToBlank->balUChar = 0;
+    binToBlank->arenaST = 0;
+    binToBlank->headL = -1;
+    binToBlank->tailL = -1;
+    binToBlank->bestL = -1;
+    binToBlank->dirtyBl = 0;
+    binToBlank->sketchST.lenSketchUI = 0;
+    binToBlank->sketchST.numKmerUI = 0;
 
     return;
 } /*blankReadBin*/
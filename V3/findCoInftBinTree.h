@@ -15,6 +15,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <stdint.h>
+#include "kmerSketchFun.h"
+
+struct fqArena; /*Read arena from fqArenaFun.h (-read-arena)*/
 
 /*######################################################################
 # Struct-1: readBin
@@ -37,6 +40,20 @@ typedef struct readBin
     unsigned long
         numReadsULng;     /*Number of reads in this bin*/ 
 
+    struct fqArena
+        *arenaST;         /*Arena with this bins reads (0 if none)*/
+
+    long
+        headL,            /*First read of this bin in arenaST*/
+        tailL,            /*Last read of this bin in arenaST*/
+        bestL;            /*Best read (removed from list) in arenaST*/
+
+    char
+        dirtyBl;          /*1: fqPathCStr is behind arenaST*/
+
+    struct kmerSketch
+        sketchST;         /*k-mer sketch of the consensus (cmpCons)*/
+
     struct readBin
         *leftChild, 
         *rightChild;
@@ -34,6 +34,12 @@
 '     o Filters reads in a fastq file by length and mean/median Q-score
 '   fun-7 moveToNextFastqEntry:
 '     o Move to next entry in buffer holding data from a fastq file
+'   fun-8 openFqFILE:
+'     o Opens a fastq file, decompressing gzip (or BGZF) files
+'   fun-9 closeFqFILE:
+'     o Closes a fastq file opened with openFqFILE
+'   fun-10 gzipFqFile:
+'     o Compresses a fastq file with bgzip, pigz, or gzip
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*---------------------------------------------------------------------\
@@ -462,9 +468,10 @@ unsigned long getNumReadsInFq(
     char buffCS[1024];
     uint64_t tmpUL = 1024;
     unsigned long numReadsUL = 0;
-    FILE *fqFILE = fopen(fqFileCStr, "r");
+    char pipeBl = 0;
+    FILE *fqFILE = openFqFILE(fqFileCStr, 0, 0, &pipeBl);
 
-    if(fqFileCStr == 0)
+    if(fqFILE == 0)
         return 0; /*No fastq file to work with*/
 
     tmpCS = buffCS;
@@ -473,6 +480,7 @@ unsigned long getNumReadsInFq(
      while(moveToNextFastqEntry(buffCS, &tmpCS,1024, &tmpUL,fqFILE) & 2)
          ++numReadsUL;
 
+     closeFqFILE(fqFILE, pipeBl);
      return numReadsUL;
 } /*getnUmReadsInFq*/
 
@@ -565,6 +573,7 @@ unsigned char filterReads(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     unsigned char errUC = 0;
+    char pipeBl = 0;  /*1: fqFILE is a pipe from gzip*/
     FILE *fqFILE = 0;
     FILE *outFILE = 0;
 
@@ -575,7 +584,7 @@ unsigned char filterReads(
     if(fqCStr == 0)
         fqFILE = stdin;
     else
-        fqFILE = fopen(fqCStr, "r");
+        fqFILE = openFqFILE(fqCStr, 0, 0, &pipeBl);
 
     if(fqFILE == 0)
         return 2;
@@ -587,7 +596,7 @@ unsigned char filterReads(
 
     if(outFILE == 0)
     { /*If I could not open the output file*/
-        fclose(fqFILE);
+        closeFqFILE(fqFILE, pipeBl);
         return 4;
     } /*If I could not open the output file*/
 
@@ -630,7 +639,7 @@ unsigned char filterReads(
     ^ Fun-6 Sec-4: Clean up
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    fclose(fqFILE);
+    closeFqFILE(fqFILE, pipeBl);
     fclose(outFILE);
 
     if(errUC != 0)
@@ -797,3 +806,211 @@ uint8_t moveToNextFastqEntry(
 
     return 2; /*Copied name sucessfully*/
 } /*moveToNextFastqEntry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o FILE pointer to the fastq file, or to the decompressed fastq
+|       file if fqPathCStr is gzip (or BGZF) compressed
+|     o 0 if could not open fqPathCStr or had a memory error
+|   - Modifies:
+|     o pipeBl to be 1 if the returned FILE is a pipe, else 0
+| Note:
+|   - Close the returned FILE with closeFqFILE
+|   - Compressed files are found by the gzip magic number, so the file
+|     does not need to end in .gz
+|   - seekBl = 1 decompresses to a tmpfile() instead of a pipe for
+|     readers that use fseek. tmpfile() is removed when closed.
+\---------------------------------------------------------------------*/
+FILE * openFqFILE(
+    char *fqPathCStr,  /*Path to the fastq file to open*/
+    char *threadsCStr, /*Threads to decompress with (0 for default)*/
+    char seekBl,       /*1: Need to fseek on the returned FILE*/
+    char *pipeBl       /*Set to 1 if the returned FILE is a pipe*/
+) /*Opens a fastq file, decompressing gzip (or BGZF) files*/
+{ /*openFqFILE*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: openFqFILE
+    '   o fun-8 sec-1: Variable declerations
+    '   o fun-8 sec-2: Open the file & check if is gzip compressed
+    '   o fun-8 sec-3: Start the decompression pipe
+    '   o fun-8 sec-4: Copy the pipe to a tmpfile if need to seek
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    int firstByteI = 0;
+    int secByteI = 0;
+    unsigned long lenCmdUL = 0;
+    unsigned long bytesReadInUL = 0;
+    char *cmdCStr = 0;
+    char buffCStr[4096];
+    FILE *fqFILE = 0;
+    FILE *tmpFILE = 0;
+
+    *pipeBl = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Open the file & check if is gzip compressed
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(fqPathCStr == 0)
+        return 0;
+
+    fqFILE = fopen(fqPathCStr, "r");
+
+    if(fqFILE == 0)
+        return 0;
+
+    firstByteI = getc(fqFILE);
+    secByteI = getc(fqFILE);
+
+    /*gzip files (BGZF is gzip) start with 0x1f 0x8b (31 139)*/
+    if(firstByteI != 31 || secByteI != 139)
+    { /*If is an uncompressed file*/
+        rewind(fqFILE);
+        return fqFILE;
+    } /*If is an uncompressed file*/
+
+    fclose(fqFILE);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Start the decompression pipe
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(threadsCStr == 0)
+        threadsCStr = defThreads;
+
+    lenCmdUL =
+          strlen(defUnzipCMD)
+        + (strlen(threadsCStr) << 1)
+        + strlen(fqPathCStr) * 3;
+
+    cmdCStr = malloc(sizeof(char) * (lenCmdUL + 1));
+
+    if(cmdCStr == 0)
+        return 0;
+
+    sprintf(
+        cmdCStr,
+        defUnzipCMD,
+        threadsCStr,
+        fqPathCStr,
+        threadsCStr,
+        fqPathCStr,
+        fqPathCStr
+    ); /*Build the bgzip, pigz, or gzip command*/
+
+    fqFILE = popen(cmdCStr, "r");
+    free(cmdCStr);
+
+    if(fqFILE == 0)
+        return 0;
+
+    if(!(seekBl & 1))
+    { /*If the caller can read from a pipe*/
+        *pipeBl = 1;
+        return fqFILE;
+    } /*If the caller can read from a pipe*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-4: Copy the pipe to a tmpfile if need to seek
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    tmpFILE = tmpfile();
+
+    if(tmpFILE == 0)
+    { /*If could not make the temporary file*/
+        pclose(fqFILE);
+        return 0;
+    } /*If could not make the temporary file*/
+
+    bytesReadInUL = fread(buffCStr, sizeof(char), 4096, fqFILE);
+
+    while(bytesReadInUL > 0)
+    { /*While have decompressed data to copy*/
+        fwrite(buffCStr, sizeof(char), bytesReadInUL, tmpFILE);
+        bytesReadInUL = fread(buffCStr, sizeof(char), 4096, fqFILE);
+    } /*While have decompressed data to copy*/
+
+    pclose(fqFILE);
+    rewind(tmpFILE);
+    return tmpFILE;
+} /*openFqFILE*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o fqFILE with pclose if pipeBl is 1, else with fclose
+\---------------------------------------------------------------------*/
+void closeFqFILE(
+    FILE *fqFILE, /*FILE from openFqFILE*/
+    char pipeBl   /*pipeBl set by openFqFILE*/
+) /*Closes a fastq file opened with openFqFILE*/
+{ /*closeFqFILE*/
+    if(fqFILE == 0)
+        return;
+
+    if(pipeBl & 1)
+        pclose(fqFILE);
+    else
+        fclose(fqFILE);
+} /*closeFqFILE*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o Replaces fqPathCStr with fqPathCStr.gz
+|   - Returns:
+|     o 1 if compressed the file
+|     o 2 if could not compress the file
+|     o 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+uint8_t gzipFqFile(
+    char *fqPathCStr,  /*Path to the fastq file to compress*/
+    char *threadsCStr  /*Threads to compress with (0 for default)*/
+) /*Compresses a fastq file with bgzip, pigz, or gzip*/
+{ /*gzipFqFile*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: Sec-1 Sub-1: gzipFqFile
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long lenCmdUL = 0;
+    char *cmdCStr = 0;
+    int errI = 0;
+
+    if(threadsCStr == 0)
+        threadsCStr = defThreads;
+
+    lenCmdUL =
+          strlen(defZipCMD)
+        + (strlen(threadsCStr) << 1)
+        + strlen(fqPathCStr) * 3;
+
+    cmdCStr = malloc(sizeof(char) * (lenCmdUL + 1));
+
+    if(cmdCStr == 0)
+        return 64;
+
+    sprintf(
+        cmdCStr,
+        defZipCMD,
+        threadsCStr,
+        fqPathCStr,
+        threadsCStr,
+        fqPathCStr,
+        fqPathCStr
+    ); /*Build the bgzip, pigz, or gzip command*/
+
+    errI = system(cmdCStr);
+    free(cmdCStr);
+
+    if(errI != 0)
+        return 2;
+
+    return 1;
+} /*gzipFqFile*/
@@ -142,4 +142,50 @@ uint8_t moveToNextFastqEntry(
     FILE *fastqFile               /*Fastq file to get data from*/
 ); /*Moves to next fastq read, without printing out*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o FILE pointer to the fastq file, or to the decompressed fastq
+|       file if fqPathCStr is gzip (or BGZF) compressed
+|     o 0 if could not open fqPathCStr or had a memory error
+|   - Modifies:
+|     o pipeBl to be 1 if the returned FILE is a pipe, else 0
+| Note:
+|   - Close the returned FILE with closeFqFILE
+|   - Compressed files are found by the gzip magic number, so the file
+|     does not need to end in .gz
+|   - seekBl = 1 decompresses to a tmpfile() instead of a pipe for
+|     readers that use fseek. tmpfile() is removed when closed.
+\---------------------------------------------------------------------*/
+FILE * openFqFILE(
+    char *fqPathCStr,  /*Path to the fastq file to open*/
+    char *threadsCStr, /*Threads to decompress with (0 for default)*/
+    char seekBl,       /*1: Need to fseek on the returned FILE*/
+    char *pipeBl       /*Set to 1 if the returned FILE is a pipe*/
+); /*Opens a fastq file, decompressing gzip (or BGZF) files*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Closes:
+|     o fqFILE with pclose if pipeBl is 1, else with fclose
+\---------------------------------------------------------------------*/
+void closeFqFILE(
+    FILE *fqFILE, /*FILE from openFqFILE*/
+    char pipeBl   /*pipeBl set by openFqFILE*/
+); /*Closes a fastq file opened with openFqFILE*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o Replaces fqPathCStr with fqPathCStr.gz
+|   - Returns:
+|     o 1 if compressed the file
+|     o 2 if could not compress the file
+|     o 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+uint8_t gzipFqFile(
+    char *fqPathCStr,  /*Path to the fastq file to compress*/
+    char *threadsCStr  /*Threads to compress with (0 for default)*/
+); /*Compresses a fastq file with bgzip, pigz, or gzip*/
+
 #endif
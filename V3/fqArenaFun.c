@@ -0,0 +1,1085 @@
+/*######################################################################
+# Use:
+#   o Holds a read arena (-read-arena) that keeps the reads of the bin
+#     being clustered in memory. The bin & its clusters are lists of
+#     reads in the arena, so moving a read only changes two links.
+#     The reads left in the bin are also in a heap of best reads.
+######################################################################*/
+
+#include "fqArenaFun.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' fqArenaFun SOF:
+'   fun-1 loadFqArena:
+'     o Reads a bins fastq (& stats) file into a new arena
+'   fun-2 freeFqArena:
+'     o Frees an arena
+'   fun-3 unlinkArenaRead:
+'     o Removes a read from a read list
+'   fun-4 appendArenaRead:
+'     o Adds a read to the end of a read list
+'   fun-5 findArenaRead:
+'     o Finds a read in a read list by its read id
+'   fun-6 writeArenaRead:
+'     o Prints one read in the arena to a fastq file
+'   fun-7 syncArenaFq:
+'     o Writes a bins fastq file if it is out of date with the arena
+'   fun-8 arenaGetBestRead:
+'     o Takes the best read out of a bin & prints it to its file
+'   fun-9 arenaAddBestRead:
+'     o Puts the best read back at the end of its bin
+'   fun-10 mergeArenaBins:
+'     o Moves the reads in one cluster to the end of another cluster
+'   fun-11 doneFqArena:
+'     o Writes a bins & its clusters fastq files & frees their arena
+'   fun-12 moveArenaRead:
+'     o Moves a mapped read from a bin to another read list
+'   fun-13 arenaReadIsBetter:
+'     o Checks if one read in the arena is a better best read
+'   fun-14 arenaHeapSift:
+'     o Moves a read in the best read heap to its place
+'   fun-15 arenaHeapPush:
+'     o Adds a read to the best read heap
+'   fun-16 arenaHeapRemove:
+'     o Removes a read from the best read heap
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the reads were put in an arena
+|        o 2 if the fastq file could not be read, is not a four line
+|          fastq, or the stats file does not match the fastq file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o binST->arenaST to point to the new arena (owned by binST)
+|        o binST->headL & binST->tailL to be the list of all reads
+|        o arenaST->heapAryL to have all reads (ordered by mapq if
+|          useStatBl is 1 or by median Q-score & length if 0)
+| Note:
+|    - The stats file is only read when useStatBl is 1. Otherwise the
+|      median Q-score is found from the q-score entry
+\---------------------------------------------------------------------*/
+uint8_t loadFqArena(
+    struct readBin *binST, /*Bin with the fastq file to read in*/
+    char useStatBl         /*1: Get mapqs from the bins stats file*/
+) /*Reads a bins fastq (& stats) file into a new arena*/
+{ /*loadFqArena*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: loadFqArena
+    '   fun-1 sec-1: Variable declerations
+    '   fun-1 sec-2: Read in the fastq file
+    '   fun-1 sec-3: Allocate the read arrays
+    '   fun-1 sec-4: Find each fastq entry & its median Q-score
+    '   fun-1 sec-5: Get the mapqs from the stats file
+    '   fun-1 sec-6: Link the reads into the bins list & heap
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    long lenFileL = 0;
+    unsigned long posUL = 0;
+    unsigned long numLinesUL = 0;
+    unsigned long readUL = 0;
+    unsigned long seqStartUL = 0;
+    unsigned long qStartUL = 0;
+    uint32_t qHistAryUI[MAX_Q_SCORE];
+    char *idCStr = 0;
+
+    struct fqArena *arenaST = 0;
+    struct statRec statST;
+
+    FILE *inFILE = fopen(binST->fqPathCStr, "rb");
+
+    if(inFILE == 0)
+        return 2;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-2: Read in the fastq file
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fseek(inFILE, 0L, SEEK_END);
+    lenFileL = ftell(inFILE);
+    fseek(inFILE, 0L, SEEK_SET);
+
+    if(lenFileL <= 0)
+    { /*If the file is empty*/
+        fclose(inFILE);
+        return 2;
+    } /*If the file is empty*/
+
+    arenaST = calloc(1, sizeof(struct fqArena));
+
+    if(arenaST == 0)
+    { /*If had a memory allocation error*/
+        fclose(inFILE);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /*+1 to add a new line to the last entry if it is missing*/
+    arenaST->buffCStr = malloc(sizeof(char) * (lenFileL + 1));
+
+    if(arenaST->buffCStr == 0)
+    { /*If had a memory allocation error*/
+        fclose(inFILE);
+        freeFqArena(&arenaST);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    if(fread(arenaST->buffCStr, sizeof(char), lenFileL, inFILE)
+       != (unsigned long) lenFileL
+    ) { /*If could not read in the file*/
+        fclose(inFILE);
+        freeFqArena(&arenaST);
+        return 2;
+    } /*If could not read in the file*/
+
+    fclose(inFILE);
+
+    if(arenaST->buffCStr[lenFileL - 1] != '\n')
+    { /*If the last entry is missing its new line*/
+        arenaST->buffCStr[lenFileL] = '\n';
+        ++lenFileL;
+    } /*If the last entry is missing its new line*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-3: Allocate the read arrays
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(posUL = 0; posUL < (unsigned long) lenFileL; ++posUL)
+        numLinesUL += (arenaST->buffCStr[posUL] == '\n');
+
+    readUL = (numLinesUL >> 2) + 1; /*Four lines per read*/
+
+    arenaST->startAryUL = malloc(sizeof(unsigned long) * readUL);
+    arenaST->lenAryUL = malloc(sizeof(unsigned long) * readUL);
+    arenaST->lenSeqAryUI = malloc(sizeof(uint32_t) * readUL);
+    arenaST->mapqAryUC = calloc(readUL, sizeof(uint8_t));
+    arenaST->medQAryF = malloc(sizeof(float) * readUL);
+    arenaST->nextAryL = malloc(sizeof(long) * readUL);
+    arenaST->prevAryL = malloc(sizeof(long) * readUL);
+    arenaST->heapAryL = malloc(sizeof(long) * readUL);
+    arenaST->heapPosAryL = malloc(sizeof(long) * readUL);
+    arenaST->orderAryUL = malloc(sizeof(unsigned long) * readUL);
+
+    if(
+          arenaST->startAryUL == 0
+       || arenaST->lenAryUL == 0
+       || arenaST->lenSeqAryUI == 0
+       || arenaST->mapqAryUC == 0
+       || arenaST->medQAryF == 0
+       || arenaST->nextAryL == 0
+       || arenaST->prevAryL == 0
+       || arenaST->heapAryL == 0
+       || arenaST->heapPosAryL == 0
+       || arenaST->orderAryUL == 0
+    ) { /*If had a memory allocation error*/
+        freeFqArena(&arenaST);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-4: Find each fastq entry & its median Q-score
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Bin fastq files are written by samToFq, so each entry is a header,
+      a sequence, a spacer, & a q-score line. Anything else is left to
+      the file based functions*/
+    posUL = 0;
+    readUL = 0;
+
+    while(posUL < (unsigned long) lenFileL)
+    { /*Loop: Find each fastq entry*/
+        if(arenaST->buffCStr[posUL] != '@')
+            break; /*Not a fastq header*/
+
+        arenaST->startAryUL[readUL] = posUL;
+
+        while(arenaST->buffCStr[posUL] != '\n')
+            ++posUL; /*Move past the header*/
+
+        seqStartUL = ++posUL;
+
+        while(posUL < (unsigned long) lenFileL
+              && arenaST->buffCStr[posUL] != '\n'
+        ) ++posUL; /*Move past the sequence*/
+
+        arenaST->lenSeqAryUI[readUL] = posUL - seqStartUL;
+        ++posUL;
+
+        if(posUL >= (unsigned long) lenFileL
+           || arenaST->buffCStr[posUL] != '+'
+        ) break; /*Multi line or truncated entry*/
+
+        while(arenaST->buffCStr[posUL] != '\n')
+            ++posUL; /*Move past the spacer*/
+
+        qStartUL = ++posUL;
+
+        for(uint32_t uiQ = 0; uiQ < MAX_Q_SCORE; ++uiQ)
+            qHistAryUI[uiQ] = 0;
+
+        while(posUL < (unsigned long) lenFileL
+              && arenaST->buffCStr[posUL] != '\n'
+        ) { /*Loop: Build the q-score histogram*/
+            if(
+                  (uint8_t) arenaST->buffCStr[posUL] >= Q_ADJUST
+               && (uint8_t) arenaST->buffCStr[posUL]
+                    < Q_ADJUST + MAX_Q_SCORE
+            ) ++qHistAryUI[arenaST->buffCStr[posUL] - Q_ADJUST];
+
+            ++posUL;
+        } /*Loop: Build the q-score histogram*/
+
+        if(posUL - qStartUL != arenaST->lenSeqAryUI[readUL])
+            break; /*Multi line or truncated entry*/
+
+        ++posUL; /*Move to the next header*/
+
+        arenaST->lenAryUL[readUL] = posUL - arenaST->startAryUL[readUL];
+        arenaST->medQAryF[readUL] =
+            qHistToMed(qHistAryUI, arenaST->lenSeqAryUI[readUL]);
+
+        ++readUL;
+    } /*Loop: Find each fastq entry*/
+
+    if(posUL < (unsigned long) lenFileL || readUL == 0)
+    { /*If this is not a four line fastq file*/
+        freeFqArena(&arenaST);
+        return 2;
+    } /*If this is not a four line fastq file*/
+
+    arenaST->numReadsUL = readUL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-5: Get the mapqs from the stats file
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if((useStatBl & 1) && binST->statPathCStr[0] != '\0')
+    { /*If picking the best read with the stats file*/
+        inFILE = fopen(binST->statPathCStr, "rb");
+
+        if(inFILE == 0)
+        { /*If could not open the stats file*/
+            freeFqArena(&arenaST);
+            return 2;
+        } /*If could not open the stats file*/
+
+        readUL = 0;
+        errUC = readStatRec(inFILE, &statST);
+
+        /*binReads & binReadToCon print the stats in the same order as
+          the reads, so the id hashes should match record for record*/
+        while(errUC & 1)
+        { /*Loop: Read in the stats for each read*/
+            if(readUL >= arenaST->numReadsUL)
+                break;
+
+            idCStr =
+                arenaST->buffCStr + arenaST->startAryUL[readUL] + 1;
+
+            if(hashReadId(idCStr) != statST.idHashUL)
+                break; /*Ids do not match*/
+
+            arenaST->mapqAryUC[readUL] = statST.mapqUChar;
+            ++readUL;
+
+            errUC = readStatRec(inFILE, &statST);
+        } /*Loop: Read in the stats for each read*/
+
+        fclose(inFILE);
+
+        if(readUL != arenaST->numReadsUL || (errUC & 1))
+        { /*If the stats file does not match the fastq file*/
+            freeFqArena(&arenaST);
+            return 2;
+        } /*If the stats file does not match the fastq file*/
+    } /*If picking the best read with the stats file*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-6: Link the reads into the bins list & heap
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(readUL = 0; readUL < arenaST->numReadsUL; ++readUL)
+    { /*Loop: Link the reads in file order*/
+        arenaST->prevAryL[readUL] = (long) readUL - 1;
+        arenaST->nextAryL[readUL] = (long) readUL + 1;
+
+        arenaST->heapPosAryL[readUL] = -1;
+        arenaST->orderAryUL[readUL] = readUL;
+    } /*Loop: Link the reads in file order*/
+
+    arenaST->nextAryL[arenaST->numReadsUL - 1] = -1;
+
+    arenaST->heapStatBl =
+        (useStatBl & 1) && binST->statPathCStr[0] != '\0';
+    arenaST->numHeapUL = 0;
+    arenaST->nextOrderUL = arenaST->numReadsUL;
+
+    for(readUL = 0; readUL < arenaST->numReadsUL; ++readUL)
+        arenaHeapPush(arenaST, (long) readUL);
+
+    binST->arenaST = arenaST;
+    binST->headL = 0;
+    binST->tailL = arenaST->numReadsUL - 1;
+    binST->bestL = -1;
+    binST->dirtyBl = 0;
+    binST->numReadsULng = arenaST->numReadsUL;
+
+    return 1;
+} /*loadFqArena*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: the arena & sets arenaST to 0
+\---------------------------------------------------------------------*/
+void freeFqArena(
+    struct fqArena **arenaST /*Arena to free*/
+) /*Frees an arena*/
+{ /*freeFqArena*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: Sec-1 Sub-1: freeFqArena
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(*arenaST == 0)
+        return;
+
+    free((*arenaST)->buffCStr);
+    free((*arenaST)->startAryUL);
+    free((*arenaST)->lenAryUL);
+    free((*arenaST)->lenSeqAryUI);
+    free((*arenaST)->mapqAryUC);
+    free((*arenaST)->medQAryF);
+    free((*arenaST)->nextAryL);
+    free((*arenaST)->prevAryL);
+    free((*arenaST)->heapAryL);
+    free((*arenaST)->heapPosAryL);
+    free((*arenaST)->orderAryUL);
+    free(*arenaST);
+
+    *arenaST = 0;
+    return;
+} /*freeFqArena*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: the list (headL to tailL) to not have readL
+\---------------------------------------------------------------------*/
+void unlinkArenaRead(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long *headL,             /*First read in the list*/
+    long *tailL,             /*Last read in the list*/
+    long readL               /*Read to remove*/
+) /*Removes a read from a read list*/
+{ /*unlinkArenaRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: unlinkArenaRead
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(arenaST->prevAryL[readL] < 0)
+        *headL = arenaST->nextAryL[readL];
+    else
+        arenaST->nextAryL[arenaST->prevAryL[readL]] =
+            arenaST->nextAryL[readL];
+
+    if(arenaST->nextAryL[readL] < 0)
+        *tailL = arenaST->prevAryL[readL];
+    else
+        arenaST->prevAryL[arenaST->nextAryL[readL]] =
+            arenaST->prevAryL[readL];
+
+    arenaST->nextAryL[readL] = -1;
+    arenaST->prevAryL[readL] = -1;
+    return;
+} /*unlinkArenaRead*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: the list (headL to tailL) to end with readL
+\---------------------------------------------------------------------*/
+void appendArenaRead(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long *headL,             /*First read in the list*/
+    long *tailL,             /*Last read in the list*/
+    long readL               /*Read to add*/
+) /*Adds a read to the end of a read list*/
+{ /*appendArenaRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: Sec-1 Sub-1: appendArenaRead
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    arenaST->nextAryL[readL] = -1;
+    arenaST->prevAryL[readL] = *tailL;
+
+    if(*tailL < 0)
+        *headL = readL;
+    else
+        arenaST->nextAryL[*tailL] = readL;
+
+    *tailL = readL;
+    return;
+} /*appendArenaRead*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Index of the read with idCStr
+|        o -1 if idCStr is not in the list
+| Note:
+|    - idCStr ends at the first white space (sam query ids end in a
+|      tab). The head of the list is checked first, so reads looked up
+|      in the same order as the list are found right away
+\---------------------------------------------------------------------*/
+long findArenaRead(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long headL,              /*First read in the list to search*/
+    char *idCStr             /*Read id to find*/
+) /*Finds a read in a read list by its read id*/
+{ /*findArenaRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: findArenaRead
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *readIdCStr = 0;
+    char *tmpCStr = 0;
+
+    if(*idCStr == '@')
+        ++idCStr;
+
+    for(long readL = headL; readL >= 0; readL = arenaST->nextAryL[readL])
+    { /*Loop: Check each read in the list*/
+        readIdCStr = arenaST->buffCStr + arenaST->startAryUL[readL] + 1;
+        tmpCStr = idCStr;
+
+        while(*tmpCStr > 32 && *tmpCStr == *readIdCStr)
+        { /*Loop: Compare the read ids*/
+            ++tmpCStr;
+            ++readIdCStr;
+        } /*Loop: Compare the read ids*/
+
+        if(*tmpCStr <= 32 && *readIdCStr <= 32)
+            return readL; /*Both ids ended at the same point*/
+    } /*Loop: Check each read in the list*/
+
+    return -1;
+} /*findArenaRead*/
+
+/*---------------------------------------------------------------------\
+| Output: Prints: the fastq entry for readL to outFILE
+\---------------------------------------------------------------------*/
+void writeArenaRead(
+    struct fqArena *arenaST, /*Arena with the read*/
+    long readL,              /*Read to print*/
+    FILE *outFILE            /*File to print the read to*/
+) /*Prints one read in the arena to a fastq file*/
+{ /*writeArenaRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: Sec-1 Sub-1: writeArenaRead
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    fwrite(
+        arenaST->buffCStr + arenaST->startAryUL[readL],
+        sizeof(char),
+        arenaST->lenAryUL[readL],
+        outFILE
+    );
+
+    return;
+} /*writeArenaRead*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the fastq file is up to date
+|        o 2 if could not write the fastq file
+|    - Modifies:
+|        o binST->fqPathCStr to have the reads in the bins list, if
+|          binST->dirtyBl was 1
+\---------------------------------------------------------------------*/
+uint8_t syncArenaFq(
+    struct readBin *binST /*Bin to write the fastq file for*/
+) /*Writes a bins fastq file if it is out of date with the arena*/
+{ /*syncArenaFq*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: Sec-1 Sub-1: syncArenaFq
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    FILE *outFILE = 0;
+
+    if(binST->arenaST == 0 || !(binST->dirtyBl & 1))
+        return 1;
+
+    if(binST->fqPathCStr[0] == '\0')
+        return 1; /*Bin has no fastq file (reads moved to a cluster)*/
+
+    outFILE = fopen(binST->fqPathCStr, "w");
+
+    if(outFILE == 0)
+        return 2;
+
+    for(
+        long readL = binST->headL;
+        readL >= 0;
+        readL = binST->arenaST->nextAryL[readL]
+    ) writeArenaRead(binST->arenaST, readL, outFILE);
+
+    fclose(outFILE);
+    binST->dirtyBl = 0;
+
+    return 1;
+} /*syncArenaFq*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if extracted the best read
+|        o 4 if the bin has no reads or the file could not be made
+|    - Modifies:
+|        o binST->bestL to be the best read, which is taken out of the
+|          bins list
+|        o binST->numReadsULng to not count the best read
+|        o The order of the bins reads (useStatBl 0), as
+|          fqGetBestReadByMedQ changes it
+|    - Creates:
+|        o binST->bestReadCStr (fastq) with the best read
+| Note:
+|    - useStatBl 1 picks the read the same way extractBestRead does,
+|      useStatBl 0 picks the read the same way fqGetBestReadByMedQ does
+|    - useStatBl 1 takes the top of the best read heap, so binST must
+|      be the bin the arena was loaded for
+|    - useStatBl 0 walks the bins reads with the median Q-scores &
+|      lengths found when the arena was loaded (nothing is re-read)
+\---------------------------------------------------------------------*/
+uint8_t arenaGetBestRead(
+    struct readBin *binST, /*Bin to take the best read from*/
+    char useStatBl         /*1: Use mapq (stats), 0: Use median Q*/
+) /*Takes the best read out of a bin & prints it to its file*/
+{ /*arenaGetBestRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: arenaGetBestRead
+    '   fun-8 sec-1: Variable declerations
+    '   fun-8 sec-2: Find the best read
+    '   fun-8 sec-3: Print the best read & remove it from the bin
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    long bestL = -1;
+    long nextL = -1;
+    long prevL = -1;
+    char *tmpCStr = 0;
+    struct fqArena *arenaST = binST->arenaST;
+    FILE *outFILE = 0;
+
+    if(binST->headL < 0 || arenaST->numHeapUL == 0)
+        return 4; /*No reads in the bin*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Find the best read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(useStatBl & 1)
+    { /*If picking the read with the mapq*/
+        /*The heap was ordered by mapq when the arena was loaded*/
+        bestL = arenaST->heapAryL[0];
+        unlinkArenaRead(arenaST, &binST->headL, &binST->tailL, bestL);
+    } /*If picking the read with the mapq*/
+
+    else
+    { /*Else picking the read with the median Q-score*/
+        /*fqGetBestReadByMedQ prints the last best read where it found
+          the next better read. The reads are moved the same way, so
+          the bins fastq (& the mapper) sees the same read order*/
+        bestL = binST->headL;
+        unlinkArenaRead(arenaST, &binST->headL, &binST->tailL, bestL);
+
+        for(long readL = binST->headL; readL >= 0; readL = nextL)
+        { /*Loop: Find the best read like fqGetBestReadByMedQ*/
+            nextL = arenaST->nextAryL[readL];
+
+            if(!arenaReadIsBetter(arenaST, readL, bestL))
+                continue;
+
+            /*Put the last best read where readL was*/
+            prevL = arenaST->prevAryL[readL];
+            arenaST->prevAryL[bestL] = prevL;
+            arenaST->nextAryL[bestL] = readL;
+            arenaST->prevAryL[readL] = bestL;
+
+            if(prevL < 0)
+                binST->headL = bestL;
+            else
+                arenaST->nextAryL[prevL] = bestL;
+
+            unlinkArenaRead(
+                arenaST,
+                &binST->headL,
+                &binST->tailL,
+                readL
+            );
+
+            /*The last best read now breaks ties from readL's place*/
+            arenaST->orderAryUL[bestL] = arenaST->orderAryUL[readL];
+
+            if(arenaST->heapPosAryL[bestL] >= 0)
+                arenaHeapSift(
+                    arenaST,
+                    (unsigned long) arenaST->heapPosAryL[bestL]
+                );
+
+            bestL = readL;
+        } /*Loop: Find the best read like fqGetBestReadByMedQ*/
+    } /*Else picking the read with the median Q-score*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Print the best read & remove it from the bin
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if((useStatBl & 1) || binST->bestReadCStr[0] == '\0')
+    { /*If need to make the best read file name*/
+        tmpCStr = cStrCpInvsDelm(binST->bestReadCStr, binST->fqPathCStr);
+        tmpCStr -= 6; /*get to "." in ".fastq" ending*/
+        cStrCpInvsDelm(tmpCStr, "--best-read.fastq");
+    } /*If need to make the best read file name*/
+
+    outFILE = fopen(binST->bestReadCStr, "w");
+
+    if(outFILE == 0)
+        return 4;
+
+    writeArenaRead(arenaST, bestL, outFILE);
+    fclose(outFILE);
+
+    arenaHeapRemove(arenaST, bestL);
+    binST->bestL = bestL;
+    binST->dirtyBl = 1;
+    --binST->numReadsULng;
+
+    return 1;
+} /*arenaGetBestRead*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o binST to have binST->bestL at the end of its list & in the
+|          best read heap
+|        o binST->fqPathCStr to end with the best read if the file was
+|          up to date before the best read was removed
+\---------------------------------------------------------------------*/
+void arenaAddBestRead(
+    struct readBin *binST /*Bin to add the best read back to*/
+) /*Puts the best read back at the end of its bin*/
+{ /*arenaAddBestRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: Sec-1 Sub-1: arenaAddBestRead
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    FILE *outFILE = 0;
+
+    if(binST->bestL < 0)
+        return;
+
+    appendArenaRead(
+        binST->arenaST,
+        &binST->headL,
+        &binST->tailL,
+        binST->bestL
+    );
+
+    /*The read is now last in the list, so loses ties as if it was*/
+    binST->arenaST->orderAryUL[binST->bestL] =
+        binST->arenaST->nextOrderUL++;
+    arenaHeapPush(binST->arenaST, binST->bestL);
+
+    if(!(binST->dirtyBl & 1))
+    { /*If the file only needs the best read added*/
+        outFILE = fopen(binST->fqPathCStr, "a");
+
+        if(outFILE == 0)
+            binST->dirtyBl = 1;
+        else
+        { /*Else can add the best read to the end*/
+            writeArenaRead(binST->arenaST, binST->bestL, outFILE);
+            fclose(outFILE);
+        } /*Else can add the best read to the end*/
+    } /*If the file only needs the best read added*/
+
+    binST->bestL = -1;
+    return;
+} /*arenaAddBestRead*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o binToKeep to have the reads in binToMerge
+|    - Deletes:
+|        o All files in binToMerge (as mergeBins does)
+\---------------------------------------------------------------------*/
+void mergeArenaBins(
+    struct readBin *binToKeep, /*Cluster to merge into*/
+    struct readBin *binToMerge /*Cluster to merge into binToKeep*/
+) /*Moves the reads in one cluster to the end of another cluster*/
+{ /*mergeArenaBins*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: Sec-1 Sub-1: mergeArenaBins
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct fqArena *arenaST = binToKeep->arenaST;
+
+    if(binToMerge->headL >= 0)
+    { /*If have reads to move*/
+        if(binToKeep->headL < 0)
+            binToKeep->headL = binToMerge->headL;
+        else
+        { /*Else need to link the lists*/
+            arenaST->nextAryL[binToKeep->tailL] = binToMerge->headL;
+            arenaST->prevAryL[binToMerge->headL] = binToKeep->tailL;
+        } /*Else need to link the lists*/
+
+        binToKeep->tailL = binToMerge->tailL;
+        binToKeep->dirtyBl = 1;
+    } /*If have reads to move*/
+
+    binToKeep->numReadsULng += binToMerge->numReadsULng;
+
+    binToMerge->headL = -1;
+    binToMerge->tailL = -1;
+    binToMerge->arenaST = 0;
+
+    binDeleteFiles(binToMerge); /*Remove all files in the bin*/
+    return;
+} /*mergeArenaBins*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if all files were written (or syncBl was 0)
+|        o 2 if a fastq file could not be written
+|    - Modifies:
+|        o binST & its clusters (rightChild list) to have their fastq
+|          files written (syncBl 1) & arenaST set to 0
+|    - Frees:
+|        o The arena used by binST
+\---------------------------------------------------------------------*/
+uint8_t doneFqArena(
+    struct readBin *binST, /*Bin with the arena*/
+    char syncBl            /*1: Write out the fastq files*/
+) /*Writes a bins & its clusters fastq files & frees their arena*/
+{ /*doneFqArena*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-11 TOC: Sec-1 Sub-1: doneFqArena
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint8_t errUC = 1;
+    struct fqArena *arenaST = binST->arenaST;
+
+    if(arenaST == 0)
+        return 1;
+
+    for(struct readBin *tmpBin = binST; tmpBin; tmpBin=tmpBin->rightChild)
+    { /*Loop: Write out the bin & its clusters*/
+        if(tmpBin->arenaST != arenaST)
+            continue;
+
+        if((syncBl & 1) && !(syncArenaFq(tmpBin) & 1))
+            errUC = 2;
+
+        tmpBin->arenaST = 0;
+        tmpBin->headL = -1;
+        tmpBin->tailL = -1;
+        tmpBin->bestL = -1;
+        tmpBin->dirtyBl = 0;
+    } /*Loop: Write out the bin & its clusters*/
+
+    freeFqArena(&arenaST);
+    return errUC;
+} /*doneFqArena*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the read was moved
+|        o 0 if the read in samST is not in fromBin
+|    - Modifies:
+|        o fromBin to not have the read in samST
+|        o The list (toHeadL to toTailL) to end with the read
+|        o The reads mapq to be the mapq in samST
+|        o The reads entry to be samST as samToFq would print it
+|        o The best read heap to have the read at its new place
+|          (inBinBl 1) or to not have the read (inBinBl 0)
+\---------------------------------------------------------------------*/
+uint8_t moveArenaRead(
+    struct readBin *fromBin, /*Bin with the read (has the arena)*/
+    long *toHeadL,           /*First read in list to move the read to*/
+    long *toTailL,           /*Last read in list to move the read to*/
+    struct samEntry *samST,  /*Mapped read to move*/
+    char inBinBl             /*1: Read is staying in fromBin*/
+) /*Moves a mapped read from a bin to another read list*/
+{ /*moveArenaRead*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-12 TOC: Sec-1 Sub-1: moveArenaRead
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct fqArena *arenaST = fromBin->arenaST;
+    char *entryCStr = 0;
+
+    long readL =
+        findArenaRead(arenaST, fromBin->headL, samST->queryCStr);
+
+    if(readL < 0)
+        return 0;
+
+    /*The file version prints each mapped read with samToFq (read id
+      only & the strand the read mapped to). The entry is rewritten the
+      same way, so the fastq files match. The id & sequence can not be
+      longer than the entry, so it is rewritten in place*/
+    if(samST->readLenUInt <= arenaST->lenSeqAryUI[readL])
+    { /*If the mapped read fits in the reads entry*/
+        entryCStr = arenaST->buffCStr + arenaST->startAryUL[readL] + 1;
+
+        while(*entryCStr > 32)
+            ++entryCStr; /*The id is the same as the mapped reads id*/
+
+        *entryCStr++ = '\n';
+        memcpy(entryCStr, samST->seqCStr, samST->readLenUInt);
+        entryCStr += samST->readLenUInt;
+
+        memcpy(entryCStr, "\n+\n", 3);
+        entryCStr += 3;
+
+        memcpy(entryCStr, samST->qCStr, samST->readLenUInt);
+        entryCStr += samST->readLenUInt;
+        *entryCStr++ = '\n';
+
+        arenaST->lenAryUL[readL] =
+              (unsigned long) (entryCStr - arenaST->buffCStr)
+            - arenaST->startAryUL[readL];
+
+        if(samST->readLenUInt != arenaST->lenSeqAryUI[readL])
+        { /*If the mapper clipped the read*/
+            arenaST->lenSeqAryUI[readL] = samST->readLenUInt;
+            arenaST->medQAryF[readL] = samST->medianQFlt;
+        } /*If the mapper clipped the read*/
+    } /*If the mapped read fits in the reads entry*/
+
+    unlinkArenaRead(
+        fromBin->arenaST,
+        &fromBin->headL,
+        &fromBin->tailL,
+        readL
+    );
+
+    appendArenaRead(fromBin->arenaST, toHeadL, toTailL, readL);
+
+    /*The stats file is not rewritten, so keep the mapq to the latest
+      consensus for picking the next best read*/
+    fromBin->arenaST->mapqAryUC[readL] = samST->mapqUChar;
+
+    if(!(inBinBl & 1))
+        arenaHeapRemove(fromBin->arenaST, readL);
+
+    else if(fromBin->arenaST->heapPosAryL[readL] >= 0)
+    { /*Else if the read is staying in the best read heap*/
+        /*The mapper may not keep the read order, so ties are broken
+          by the order of the new list, as the file version does*/
+        fromBin->arenaST->orderAryUL[readL] =
+            fromBin->arenaST->nextOrderUL++;
+
+        arenaHeapSift(
+            fromBin->arenaST,
+            (unsigned long) fromBin->arenaST->heapPosAryL[readL]
+        ); /*The mapq & order changed*/
+    } /*Else if the read is staying in the best read heap*/
+
+    return 1;
+} /*moveArenaRead*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if readOneL is a better best read than readTwoL
+|        o 0 if readTwoL is as good or better
+\---------------------------------------------------------------------*/
+char arenaReadIsBetter(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long readOneL,           /*Read to check*/
+    long readTwoL            /*Read to compare to*/
+) /*Checks if one read in the arena is a better best read*/
+{ /*arenaReadIsBetter*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-13 TOC: Sec-1 Sub-1: arenaReadIsBetter
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*Median Q-scores are compared as integers, as in
+      fqGetBestReadByMedQ*/
+    int16_t oneQSht = (int16_t) arenaST->medQAryF[readOneL];
+    int16_t twoQSht = (int16_t) arenaST->medQAryF[readTwoL];
+
+    if(arenaST->heapStatBl & 1)
+    { /*If using the mapping quality from the stats file*/
+        if(arenaST->mapqAryUC[readOneL] != arenaST->mapqAryUC[readTwoL])
+            return
+                arenaST->mapqAryUC[readOneL]
+              > arenaST->mapqAryUC[readTwoL];
+
+        /*extractBestRead keeps the last read with the best mapq*/
+        return
+            arenaST->orderAryUL[readOneL]
+          > arenaST->orderAryUL[readTwoL];
+    } /*If using the mapping quality from the stats file*/
+
+    if(oneQSht != twoQSht)
+        return oneQSht > twoQSht;
+
+    if(arenaST->lenSeqAryUI[readOneL] != arenaST->lenSeqAryUI[readTwoL])
+        return
+            arenaST->lenSeqAryUI[readOneL]
+          > arenaST->lenSeqAryUI[readTwoL];
+
+    /*fqGetBestReadByMedQ keeps the first read with the best score*/
+    return arenaST->orderAryUL[readOneL] < arenaST->orderAryUL[readTwoL];
+} /*arenaReadIsBetter*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o arenaST->heapAryL to have the read at index posUL moved up
+|          or down to its place
+|        o arenaST->heapPosAryL for each read that was moved
+\---------------------------------------------------------------------*/
+void arenaHeapSift(
+    struct fqArena *arenaST, /*Arena with the best read heap*/
+    unsigned long posUL      /*Index in heapAryL of read to move*/
+) /*Moves a read in the best read heap to its place*/
+{ /*arenaHeapSift*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-14 TOC: arenaHeapSift
+    '   fun-14 sec-1: Variable declerations
+    '   fun-14 sec-2: Move the read up if it is better than its parent
+    '   fun-14 sec-3: Move the read down if a child is better
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    long readL = arenaST->heapAryL[posUL];
+    unsigned long parentUL = 0;
+    unsigned long childUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-2: Move the read up if it is better than its parent
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(posUL > 0)
+    { /*Loop: Move the read up the heap*/
+        parentUL = (posUL - 1) >> 1;
+
+        if(!arenaReadIsBetter(arenaST,readL,arenaST->heapAryL[parentUL]))
+            break;
+
+        arenaST->heapAryL[posUL] = arenaST->heapAryL[parentUL];
+        arenaST->heapPosAryL[arenaST->heapAryL[posUL]] = (long) posUL;
+        posUL = parentUL;
+    } /*Loop: Move the read up the heap*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-14 Sec-3: Move the read down if a child is better
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while((posUL << 1) + 1 < arenaST->numHeapUL)
+    { /*Loop: Move the read down the heap*/
+        childUL = (posUL << 1) + 1;
+
+        if(
+              childUL + 1 < arenaST->numHeapUL
+           && arenaReadIsBetter(
+                  arenaST,
+                  arenaST->heapAryL[childUL + 1],
+                  arenaST->heapAryL[childUL]
+              )
+        ) ++childUL; /*If the right child is the better child*/
+
+        if(!arenaReadIsBetter(arenaST,arenaST->heapAryL[childUL],readL))
+            break;
+
+        arenaST->heapAryL[posUL] = arenaST->heapAryL[childUL];
+        arenaST->heapPosAryL[arenaST->heapAryL[posUL]] = (long) posUL;
+        posUL = childUL;
+    } /*Loop: Move the read down the heap*/
+
+    arenaST->heapAryL[posUL] = readL;
+    arenaST->heapPosAryL[readL] = (long) posUL;
+    return;
+} /*arenaHeapSift*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: arenaST->heapAryL to have readL
+\---------------------------------------------------------------------*/
+void arenaHeapPush(
+    struct fqArena *arenaST, /*Arena with the best read heap*/
+    long readL               /*Read to add (not in the heap)*/
+) /*Adds a read to the best read heap*/
+{ /*arenaHeapPush*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-15 TOC: Sec-1 Sub-1: arenaHeapPush
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(arenaST->heapPosAryL[readL] >= 0)
+        return; /*Already in the heap*/
+
+    arenaST->heapAryL[arenaST->numHeapUL] = readL;
+    ++arenaST->numHeapUL;
+    arenaHeapSift(arenaST, arenaST->numHeapUL - 1);
+    return;
+} /*arenaHeapPush*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o arenaST->heapAryL to not have readL. Nothing is done if
+|          readL is not in the heap
+\---------------------------------------------------------------------*/
+void arenaHeapRemove(
+    struct fqArena *arenaST, /*Arena with the best read heap*/
+    long readL               /*Read to remove*/
+) /*Removes a read from the best read heap*/
+{ /*arenaHeapRemove*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-16 TOC: Sec-1 Sub-1: arenaHeapRemove
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    long posL = arenaST->heapPosAryL[readL];
+
+    if(posL < 0)
+        return; /*Not in the heap*/
+
+    arenaST->heapPosAryL[readL] = -1;
+    --arenaST->numHeapUL;
+
+    if((unsigned long) posL == arenaST->numHeapUL)
+        return; /*Was the last read in the heap*/
+
+    /*Move the last read into the empty spot & find its place*/
+    arenaST->heapAryL[posL] = arenaST->heapAryL[arenaST->numHeapUL];
+    arenaHeapSift(arenaST, (unsigned long) posL);
+    return;
+} /*arenaHeapRemove*/
@@ -0,0 +1,323 @@
+/*######################################################################
+# Use:
+#   o Holds a read arena (-read-arena). The reads in a bin are read in
+#     once & the bin & its clusters become lists of reads in the arena,
+#     so removing the best read or moving reads to a cluster does not
+#     rewrite the bins fastq file. Fastq files are only written when
+#     minimap2 (or the built in mapper) needs them.
+#   o The reads in the bin being clustered are also kept in a heap
+#     ordered by how good each read is, so the best read is found &
+#     removed in O(log n) instead of checking every read in the bin.
+# Includes:
+#   - "FCIStatsFun.h"
+#   - "findCoInftBinTree.h"
+#   - "cStrFun.h"
+#   o "samEntryStruct.h"
+#   o "cStrToNumberFun.h"
+#   o "printError.h"
+# C standard libraries:
+#   o <stdlib.h>
+#   o <string.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef FQARENAFUN_H
+#define FQARENAFUN_H
+
+#include "FCIStatsFun.h"       /*qHistToMed & samEntry/statRec*/
+#include "cStrFun.h"           /*cStrCpInvsDelm*/
+#include "findCoInftBinTree.h" /*readBin structure*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' fqArenaFun SOH: Start Of Header
+'   o st-1 fqArena:
+'     - All reads in a bin & the links for the read lists
+'   o fun-1 loadFqArena:
+'     - Reads a bins fastq (& stats) file into a new arena
+'   o fun-2 freeFqArena:
+'     - Frees an arena
+'   o fun-3 unlinkArenaRead:
+'     - Removes a read from a read list
+'   o fun-4 appendArenaRead:
+'     - Adds a read to the end of a read list
+'   o fun-5 findArenaRead:
+'     - Finds a read in a read list by its read id
+'   o fun-6 writeArenaRead:
+'     - Prints one read in the arena to a fastq file
+'   o fun-7 syncArenaFq:
+'     - Writes a bins fastq file if it is out of date with the arena
+'   o fun-8 arenaGetBestRead:
+'     - Takes the best read out of a bin & prints it to its file
+'   o fun-9 arenaAddBestRead:
+'     - Puts the best read back at the end of its bin
+'   o fun-10 mergeArenaBins:
+'     - Moves the reads in one cluster to the end of another cluster
+'   o fun-11 doneFqArena:
+'     - Writes a bins & its clusters fastq files & frees their arena
+'   o fun-12 moveArenaRead:
+'     - Moves a mapped read from a bin to another read list
+'   o fun-13 arenaReadIsBetter:
+'     - Checks if one read in the arena is a better best read
+'   o fun-14 arenaHeapSift:
+'     - Moves a read in the best read heap to its place
+'   o fun-15 arenaHeapPush:
+'     - Adds a read to the best read heap
+'   o fun-16 arenaHeapRemove:
+'     - Removes a read from the best read heap
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: fqArena
+| Use:
+|   - Holds every fastq entry in a bin, as they were in the bins fastq
+|     file, with the stats used to pick the best read. Each read is in
+|     at most one list (bin or cluster) at a time. The lists are linked
+|     with nextAryL & prevAryL (-1 ends a list).
+|   - The reads in the bin being clustered are also in a max heap
+|     (heapAryL), which is used to pick the best read. heapPosAryL is
+|     the index of each read in the heap (-1 if not in the heap).
+|   - orderAryUL is the order the reads were added to the bins list,
+|     which is used to break ties the same way the list order did.
+\---------------------------------------------------------------------*/
+typedef struct fqArena
+{ /*fqArena*/
+    char *buffCStr;            /*All fastq entries in the bin*/
+    unsigned long numReadsUL;  /*Number of reads in the arena*/
+
+    unsigned long *startAryUL; /*Start of each fastq entry*/
+    unsigned long *lenAryUL;   /*Bytes in each entry (with last '\n')*/
+    uint32_t *lenSeqAryUI;     /*Length of each read*/
+    uint8_t *mapqAryUC;        /*Mapping quality (from last mapping)*/
+    float *medQAryF;           /*Median Q-score of each read*/
+
+    long *nextAryL;            /*Next read in the reads list*/
+    long *prevAryL;            /*Previous read in the reads list*/
+
+    long *heapAryL;            /*Best read heap (best read first)*/
+    long *heapPosAryL;         /*Index of each read in heapAryL*/
+    unsigned long *orderAryUL; /*Order read was added to the bin*/
+    unsigned long numHeapUL;   /*Number of reads in the heap*/
+    unsigned long nextOrderUL; /*Order to give the next added read*/
+    char heapStatBl;           /*1: heap uses mapq; 0: median Q*/
+}fqArena;
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the reads were put in an arena
+|        o 2 if the fastq file could not be read, is not a four line
+|          fastq, or the stats file does not match the fastq file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o binST->arenaST to point to the new arena (owned by binST)
+|        o binST->headL & binST->tailL to be the list of all reads
+|        o arenaST->heapAryL to have all reads (ordered by mapq if
+|          useStatBl is 1 or by median Q-score & length if 0)
+| Note:
+|    - The stats file is only read when useStatBl is 1. Otherwise the
+|      median Q-score is found from the q-score entry
+\---------------------------------------------------------------------*/
+uint8_t loadFqArena(
+    struct readBin *binST, /*Bin with the fastq file to read in*/
+    char useStatBl         /*1: Get mapqs from the bins stats file*/
+); /*Reads a bins fastq (& stats) file into a new arena*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: the arena & sets arenaST to 0
+\---------------------------------------------------------------------*/
+void freeFqArena(
+    struct fqArena **arenaST /*Arena to free*/
+); /*Frees an arena*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: the list (headL to tailL) to not have readL
+\---------------------------------------------------------------------*/
+void unlinkArenaRead(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long *headL,             /*First read in the list*/
+    long *tailL,             /*Last read in the list*/
+    long readL               /*Read to remove*/
+); /*Removes a read from a read list*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: the list (headL to tailL) to end with readL
+\---------------------------------------------------------------------*/
+void appendArenaRead(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long *headL,             /*First read in the list*/
+    long *tailL,             /*Last read in the list*/
+    long readL               /*Read to add*/
+); /*Adds a read to the end of a read list*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Index of the read with idCStr
+|        o -1 if idCStr is not in the list
+| Note:
+|    - idCStr ends at the first white space (sam query ids end in a
+|      tab). The head of the list is checked first, so reads looked up
+|      in the same order as the list are found right away
+\---------------------------------------------------------------------*/
+long findArenaRead(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long headL,              /*First read in the list to search*/
+    char *idCStr             /*Read id to find*/
+); /*Finds a read in a read list by its read id*/
+
+/*---------------------------------------------------------------------\
+| Output: Prints: the fastq entry for readL to outFILE
+\---------------------------------------------------------------------*/
+void writeArenaRead(
+    struct fqArena *arenaST, /*Arena with the read*/
+    long readL,              /*Read to print*/
+    FILE *outFILE            /*File to print the read to*/
+); /*Prints one read in the arena to a fastq file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the fastq file is up to date
+|        o 2 if could not write the fastq file
+|    - Modifies:
+|        o binST->fqPathCStr to have the reads in the bins list, if
+|          binST->dirtyBl was 1
+\---------------------------------------------------------------------*/
+uint8_t syncArenaFq(
+    struct readBin *binST /*Bin to write the fastq file for*/
+); /*Writes a bins fastq file if it is out of date with the arena*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if extracted the best read
+|        o 4 if the bin has no reads or the file could not be made
+|    - Modifies:
+|        o binST->bestL to be the best read, which is taken out of the
+|          bins list
+|        o binST->numReadsULng to not count the best read
+|        o The order of the bins reads (useStatBl 0), as
+|          fqGetBestReadByMedQ changes it
+|    - Creates:
+|        o binST->bestReadCStr (fastq) with the best read
+| Note:
+|    - useStatBl 1 picks the read the same way extractBestRead does,
+|      useStatBl 0 picks the read the same way fqGetBestReadByMedQ does
+|    - useStatBl 1 takes the top of the best read heap, so binST must
+|      be the bin the arena was loaded for
+|    - useStatBl 0 walks the bins reads with the median Q-scores &
+|      lengths found when the arena was loaded (nothing is re-read)
+\---------------------------------------------------------------------*/
+uint8_t arenaGetBestRead(
+    struct readBin *binST, /*Bin to take the best read from*/
+    char useStatBl         /*1: Use mapq (stats), 0: Use median Q*/
+); /*Takes the best read out of a bin & prints it to its file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o binST to have binST->bestL at the end of its list & in the
+|          best read heap
+|        o binST->fqPathCStr to end with the best read if the file was
+|          up to date before the best read was removed
+\---------------------------------------------------------------------*/
+void arenaAddBestRead(
+    struct readBin *binST /*Bin to add the best read back to*/
+); /*Puts the best read back at the end of its bin*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o binToKeep to have the reads in binToMerge
+|    - Deletes:
+|        o All files in binToMerge (as mergeBins does)
+\---------------------------------------------------------------------*/
+void mergeArenaBins(
+    struct readBin *binToKeep, /*Cluster to merge into*/
+    struct readBin *binToMerge /*Cluster to merge into binToKeep*/
+); /*Moves the reads in one cluster to the end of another cluster*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if all files were written (or syncBl was 0)
+|        o 2 if a fastq file could not be written
+|    - Modifies:
+|        o binST & its clusters (rightChild list) to have their fastq
+|          files written (syncBl 1) & arenaST set to 0
+|    - Frees:
+|        o The arena used by binST
+\---------------------------------------------------------------------*/
+uint8_t doneFqArena(
+    struct readBin *binST, /*Bin with the arena*/
+    char syncBl            /*1: Write out the fastq files*/
+); /*Writes a bins & its clusters fastq files & frees their arena*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the read was moved
+|        o 0 if the read in samST is not in fromBin
+|    - Modifies:
+|        o fromBin to not have the read in samST
+|        o The list (toHeadL to toTailL) to end with the read
+|        o The reads mapq to be the mapq in samST
+|        o The reads entry to be samST as samToFq would print it
+|        o The best read heap to have the read at its new place
+|          (inBinBl 1) or to not have the read (inBinBl 0)
+\---------------------------------------------------------------------*/
+uint8_t moveArenaRead(
+    struct readBin *fromBin, /*Bin with the read (has the arena)*/
+    long *toHeadL,           /*First read in list to move the read to*/
+    long *toTailL,           /*Last read in list to move the read to*/
+    struct samEntry *samST,  /*Mapped read to move*/
+    char inBinBl             /*1: Read is staying in fromBin*/
+); /*Moves a mapped read from a bin to another read list*/
+
+/*---------------------------------------------------------------------| Output:
+|    - Returns:
+|        o 1 if readOneL is a better best read than readTwoL
+|        o 0 if readTwoL is as good or better
+| Note:
+|    - heapStatBl 1: The read with the higher mapq is better. Reads
+|      added later win ties (as in extractBestRead)
+|    - heapStatBl 0: The read with the higher median Q-score (as an
+|      integer), then the longer read is better. Reads added earlier
+|      win ties (as in fqGetBestReadByMedQ)
+\---------------------------------------------------------------------*/
+char arenaReadIsBetter(
+    struct fqArena *arenaST, /*Arena with the reads*/
+    long readOneL,           /*Read to check*/
+    long readTwoL            /*Read to compare to*/
+); /*Checks if one read in the arena is a better best read*/
+
+/*---------------------------------------------------------------------| Output:
+|    - Modifies:
+|        o arenaST->heapAryL to have the read at index posUL moved up
+|          or down to its place
+|        o arenaST->heapPosAryL for each read that was moved
+\---------------------------------------------------------------------*/
+void arenaHeapSift(
+    struct fqArena *arenaST, /*Arena with the best read heap*/
+    unsigned long posUL      /*Index in heapAryL of read to move*/
+); /*Moves a read in the best read heap to its place*/
+
+/*---------------------------------------------------------------------| Output: Modifies: arenaST->heapAryL to have readL
+\---------------------------------------------------------------------*/
+void arenaHeapPush(
+    struct fqArena *arenaST, /*Arena with the best read heap*/
+    long readL               /*Read to add (not in the heap)*/
+); /*Adds a read to the best read heap*/
+
+/*---------------------------------------------------------------------| Output:
+|    - Modifies:
+|        o arenaST->heapAryL to not have readL. Nothing is done if
+|          readL is not in the heap
+\---------------------------------------------------------------------*/
+void arenaHeapRemove(
+    struct fqArena *arenaST, /*Arena with the best read heap*/
+    long readL               /*Read to remove*/
+); /*Removes a read from the best read heap*/
+
+#endif
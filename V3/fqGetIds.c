@@ -13,10 +13,14 @@
 #      - Do not use with stdin-fastq (will break)
 #    -fastq file.fastq:
 #      - Fastq file to filter reads from                     [Required]
+#      - Can be gzipped (.fastq.gz)
 #      -no-hash:
 #          - Use a tree search instead of hashing.           [Default: hashing]
 #              - Default search is hash combined with tree. 
 #          - Adds more time, but uses slightly less memory. 
+#      -fp-hash:
+#          - Use a flat table of read id fingerprints.       [Default: hashing]
+#              - Faster lookups than the default hash & no trees.
 #    -v:
 #      - Print reads not provided by -f                      [Default: not set]
 #    -V:
@@ -89,7 +93,7 @@ int main(int lenArgsInt, char *argsCStr[])
         stdinFastqChar = 0,   /*If 1 taking input from stdin*/
         stdinFiltChar = 0,    /*If 1 taking input from stdin*/
         printReverseChar = 0, /*Print sequences not in filter file*/
-        useHashChar = 1,      /*Holds if user wanted hashing [1: use hash]*/
+        useHashChar = 1,      /*[1: use hash, 2: fingerprint hash]*/
         *inputChar = 0;       /*Holds arguemnt that had input error*/
 
     unsigned char
@@ -110,12 +114,16 @@ int main(int lenArgsInt, char *argsCStr[])
             \n      - Take filter file from stdin            [Default: not set]\
             \n    -fastq file.fastq:\
             \n      - Fastq file to filter reads from        [Required]\
+            \n      - Can be gzipped (.fastq.gz)\
             \n    - out:\
             \n      - Name of file to output reads to        [stdout]\
             \n    -no-hash:\
             \n      - Use a tree search instead of hashing.  [Default: hashing]\
             \n          - Default search is hash combined with tree.\
             \n      - Adds more time, but uses slightly less memory.\
+            \n    -fp-hash:\
+            \n      - Use a flat table of read id fingerprints.\
+            \n          - Faster lookups than the default hash.\
             \n    -v:\
             \n      - Print reads not provided by -f         [Default: not set]\
             \n    -V:\
@@ -166,6 +174,7 @@ int main(int lenArgsInt, char *argsCStr[])
         fprintf(
             stdout,  /*stdout so user can pipe & grab easily*/
             "fqGetIds from findCoInft version: %.8f\n",
+            defVersion
         ); /*Print out the version number*/
         exit(0);
     } /*Else if the user wanted the version number*/
@@ -350,6 +359,12 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
             intArg--;                  /*Account for incurment at end of loop*/
         } /*If user wants to do tree search instead*/
 
+        else if(strcmp(tmpCStr, "-fp-hash") == 0)
+        { /*If user wants the fingerprint hash table*/
+            *useHashChar = 2;
+            intArg--;                  /*Account for incurment at end of loop*/
+        } /*If user wants the fingerprint hash table*/
+
         else if(strcmp(tmpCStr, "-stdin-fastq") == 0)
         { /*If if taking input from stdin*/
             *stdinFastqChar = 1;
@@ -388,6 +403,14 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
         tmpCStr++;            /*find the end of the file name*/
 
     if(
+        tmpCStr - *fastqFileCStr > 3 &&
+        *(tmpCStr - 1) == 'z' &&
+        *(tmpCStr - 2) == 'g' &&
+        *(tmpCStr - 3) == '.'
+    ) tmpCStr -= 3; /*openFqFILE decompresses gzip fastq files*/
+
+    if(
+        tmpCStr - *fastqFileCStr < 6 ||
         *(tmpCStr - 1) != 'q' ||
         *(tmpCStr - 2) != 't' ||
         *(tmpCStr - 3) != 's' ||
@@ -398,11 +421,11 @@ char * checkInput(int *lenArgsInt,        /*Number of arugments user input*/
     { /*If input is not a fastq file*/
         fprintf(
             stderr,
-            "%s is not a fastq file (should end in .fastq)\n",
+            "%s is not a fastq file (.fastq or .fastq.gz)\n",
             *fastqFileCStr
         ); /*Warn user that provided fastq file is not a fastq file*/
 
-        return tmpCStr;
+        return *fastqFileCStr;
     } /*If input is not a fastq file*/
 
     return 0; /*input is valid*/
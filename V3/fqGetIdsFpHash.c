@@ -0,0 +1,608 @@
+/*######################################################################
+# Name: fqGetIdsFpHash
+# Use:
+#   o Flat open addressing (Robin Hood) hash table of read ids. Each
+#     slot holds two 64 bit fingerprints of the read ids big number
+#     (bigNum) inline, so the table needs no tree nodes or big numbers
+#     after it is built.
+# Includes:
+#   - "fqGetIdsStructs.h"
+# C standard includes:
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#include "fqGetIdsFpHash.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' fqGetIdsFpHash SOF:
+'   fun-1 initIdFpHash:
+'     o Sets an idFpHash structure to an empty table
+'   fun-2 makeIdFpHash:
+'     o Allocates an empty idFpHash table for a number of ids
+'   fun-3 bigNumToIdFp:
+'     o Finds the two fingerprints of a big number read id
+'   fun-4 insIdFp:
+'     o Inserts a read ids fingerprints into an idFpHash table
+'   fun-5 growIdFpHash:
+'     o Doubles the number of slots in an idFpHash table
+'   fun-6 insIdFpBatch:
+'     o Inserts a batch of fingerprints (prefetches the home slots)
+'   fun-7 findIdFpHash:
+'     o Finds a big number read id in an idFpHash table
+'   fun-8 freeIdFpHash:
+'     o Frees the slots in an idFpHash table
+'   fun-9 readListToIdFpHash:
+'     o Builds an idFpHash table from a readInfo list
+'   fun-10 idFileToIdFpHash:
+'     o Builds an idFpHash table from a file of read ids
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o hashST to be an empty table with no slots
+\---------------------------------------------------------------------*/
+void initIdFpHash(
+    struct idFpHash *hashST /*Table to initialize*/
+) /*Sets an idFpHash structure to an empty table*/
+{ /*initIdFpHash*/
+    hashST->slotAryST = 0;
+    hashST->maskUL = 0;
+    hashST->numIdsUL = 0;
+} /*initIdFpHash*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if made the table
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have at least two empty slots per id
+\---------------------------------------------------------------------*/
+uint8_t makeIdFpHash(
+    struct idFpHash *hashST, /*Table to set up (must be empty)*/
+    uint64_t numIdsUL        /*Number of ids expected*/
+) /*Allocates an empty idFpHash table for a number of ids*/
+{ /*makeIdFpHash*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: Sec-1 Sub-1: makeIdFpHash
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t numSlotsUL = defFpMinSlotsUL;
+
+    /*Keep the table at most half full, so probes stay short*/
+    while(numSlotsUL < (numIdsUL << 1))
+        numSlotsUL <<= 1;
+
+    hashST->slotAryST = calloc(numSlotsUL, sizeof(struct idFpSlot));
+
+    if(hashST->slotAryST == 0)
+        return 64;
+
+    hashST->maskUL = numSlotsUL - 1;
+    hashST->numIdsUL = 0;
+    return 1;
+} /*makeIdFpHash*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o fpOneUL & fpTwoUL to hold the fingerprints of idBigNum
+\---------------------------------------------------------------------*/
+void bigNumToIdFp(
+    struct bigNum *idBigNum, /*Read id to fingerprint*/
+    uint64_t *fpOneUL,       /*Set to the first fingerprint*/
+    uint64_t *fpTwoUL        /*Set to the second fingerprint*/
+) /*Finds the two fingerprints of a big number read id*/
+{ /*bigNumToIdFp*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: bigNumToIdFp
+    '   - The two fingerprints use different seeds & mixing, so two
+    '     ids only collide if both 64 bit fingerprints match
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t limbUL = 0;
+    uint64_t oneUL = defFpSeedOneUL ^ idBigNum->lenUsedElmChar;
+    uint64_t twoUL = defFpSeedTwoUL + idBigNum->lenUsedElmChar;
+
+    for(
+        uint8_t uCLimb = 0;
+        uCLimb < idBigNum->lenUsedElmChar;
+        ++uCLimb
+    ) { /*Loop: Mix each limb into the fingerprints*/
+        limbUL = (uint64_t) *(idBigNum->bigNumAryIOrL + uCLimb);
+
+        oneUL = (oneUL ^ limbUL) * defFpMulOneUL;
+        oneUL ^= oneUL >> 32;
+
+        twoUL = (twoUL + limbUL) * defFpMulTwoUL;
+        twoUL ^= twoUL >> 29;
+    } /*Loop: Mix each limb into the fingerprints*/
+
+    /*Murmur3 finalizer, so the low bits (home slot) are well mixed*/
+    oneUL ^= oneUL >> 33;
+    oneUL *= defFpMulOneUL;
+    oneUL ^= oneUL >> 33;
+    oneUL *= defFpMulTwoUL;
+    oneUL ^= oneUL >> 33;
+
+    twoUL ^= twoUL >> 33;
+    twoUL *= defFpMulTwoUL;
+    twoUL ^= twoUL >> 33;
+
+    *fpOneUL = oneUL;
+    *fpTwoUL = twoUL;
+} /*bigNumToIdFp*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if inserted the fingerprints
+|     o 2 if the fingerprints were already in the table (no insert)
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have the fingerprints (grows the table if needed)
+\---------------------------------------------------------------------*/
+uint8_t insIdFp(
+    struct idFpHash *hashST, /*Table to insert into*/
+    uint64_t fpOneUL,        /*First fingerprint of the read id*/
+    uint64_t fpTwoUL,        /*Second fingerprint of the read id*/
+    void *dataPtr            /*Data to keep with the id (can be 0)*/
+) /*Inserts a read ids fingerprints into an idFpHash table*/
+{ /*insIdFp*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: insIdFp
+    '   - Robin Hood insert: an id that is further from its home slot
+    '     takes the slot from an id that is closer to its home slot
+    '   o fun-4 sec-1: Variable declerations
+    '   o fun-4 sec-2: Make or grow the table if needed
+    '   o fun-4 sec-3: Find a slot for the id
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t posUL = 0;
+    char movedBl = 0;    /*1: Moved an id, so no duplicates left*/
+    struct idFpSlot carryST;
+    struct idFpSlot swapST;
+    struct idFpSlot *slotST = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Make or grow the table if needed
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(hashST->slotAryST == 0)
+    { /*If have no table yet*/
+        if(makeIdFpHash(hashST, 0) & 64)
+            return 64;
+    } /*If have no table yet*/
+
+    else if(((hashST->numIdsUL + 1) << 1) > hashST->maskUL + 1)
+    { /*Else if the table would be over half full*/
+        if(growIdFpHash(hashST) & 64)
+            return 64;
+    } /*Else if the table would be over half full*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-3: Find a slot for the id
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    carryST.fpOneUL = fpOneUL;
+    carryST.fpTwoUL = fpTwoUL;
+    carryST.dataPtr = dataPtr;
+    carryST.probeUI = 1;
+
+    posUL = fpOneUL & hashST->maskUL;
+
+    while(1)
+    { /*Loop: Find an empty slot*/
+        slotST = hashST->slotAryST + posUL;
+
+        if(slotST->probeUI == 0)
+        { /*If found an empty slot*/
+            *slotST = carryST;
+            ++hashST->numIdsUL;
+            return 1;
+        } /*If found an empty slot*/
+
+        if(
+              !movedBl
+           && slotST->fpOneUL == carryST.fpOneUL
+           && slotST->fpTwoUL == carryST.fpTwoUL
+        ) return 2; /*Duplicate id*/
+
+        if(slotST->probeUI < carryST.probeUI)
+        { /*If the id in this slot is closer to its home slot*/
+            swapST = *slotST;
+            *slotST = carryST;
+            carryST = swapST;
+            movedBl = 1;
+        } /*If the id in this slot is closer to its home slot*/
+
+        ++carryST.probeUI;
+        posUL = (posUL + 1) & hashST->maskUL;
+    } /*Loop: Find an empty slot*/
+} /*insIdFp*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if doubled the table
+|     o 64 for memory allocation errors (table is not changed)
+\---------------------------------------------------------------------*/
+uint8_t growIdFpHash(
+    struct idFpHash *hashST /*Table to double*/
+) /*Doubles the number of slots in an idFpHash table*/
+{ /*growIdFpHash*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: growIdFpHash
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct idFpSlot *oldAryST = hashST->slotAryST;
+    uint64_t oldSlotsUL = hashST->maskUL + 1;
+
+    hashST->slotAryST =
+        calloc(oldSlotsUL << 1, sizeof(struct idFpSlot));
+
+    if(hashST->slotAryST == 0)
+    { /*If had a memory allocation error*/
+        hashST->slotAryST = oldAryST;
+        return 64;
+    } /*If had a memory allocation error*/
+
+    hashST->maskUL = (oldSlotsUL << 1) - 1;
+    hashST->numIdsUL = 0;
+
+    /*The new table is under half full, so insIdFp will not grow it*/
+    for(uint64_t slotUL = 0; slotUL < oldSlotsUL; ++slotUL)
+    { /*Loop: Move each id to the new table*/
+        if((oldAryST + slotUL)->probeUI == 0)
+            continue;
+
+        insIdFp(
+            hashST,
+            (oldAryST + slotUL)->fpOneUL,
+            (oldAryST + slotUL)->fpTwoUL,
+            (oldAryST + slotUL)->dataPtr
+        );
+    } /*Loop: Move each id to the new table*/
+
+    free(oldAryST);
+    return 1;
+} /*growIdFpHash*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if inserted all fingerprints
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o dupAryUC to be 1 for duplicate ids & 0 for inserted ids
+\---------------------------------------------------------------------*/
+uint8_t insIdFpBatch(
+    struct idFpHash *hashST, /*Table to insert into*/
+    uint64_t *fpOneAryUL,    /*First fingerprints of the read ids*/
+    uint64_t *fpTwoAryUL,    /*Second fingerprints of the read ids*/
+    void **dataAry,          /*Data for each id (0 for no data)*/
+    uint8_t *dupAryUC,       /*Set to 1 if the id was a duplicate*/
+    uint32_t numIdsUI        /*Number of ids in the batch*/
+) /*Inserts a batch of fingerprints (prefetches the home slots)*/
+{ /*insIdFpBatch*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: Sec-1 Sub-1: insIdFpBatch
+    '   - Prefetching every home slot first lets the cache misses for
+    '     the batch overlap, instead of waiting on one miss per id
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint8_t errUC = 0;
+
+    /*Grow first, so the prefetched slots are the ones inserted into*/
+    while(
+           hashST->slotAryST != 0
+        && ((hashST->numIdsUL + numIdsUI) << 1) > hashST->maskUL + 1
+    ) { /*While the batch would make the table over half full*/
+        if(growIdFpHash(hashST) & 64)
+            return 64;
+    } /*While the batch would make the table over half full*/
+
+    #ifdef __GNUC__
+        if(hashST->slotAryST != 0)
+        { /*If have a table to prefetch from*/
+            for(uint32_t uiId = 0; uiId < numIdsUI; ++uiId)
+                __builtin_prefetch(
+                    hashST->slotAryST
+                        + (*(fpOneAryUL + uiId) & hashST->maskUL),
+                    1,
+                    1
+                ); /*Start loading the home slot for this id*/
+        } /*If have a table to prefetch from*/
+    #endif
+
+    for(uint32_t uiId = 0; uiId < numIdsUI; ++uiId)
+    { /*Loop: Insert each id in the batch*/
+        errUC =
+            insIdFp(
+                hashST,
+                *(fpOneAryUL + uiId),
+                *(fpTwoAryUL + uiId),
+                *(dataAry + uiId)
+            );
+
+        if(errUC & 64)
+            return 64;
+
+        *(dupAryUC + uiId) = (errUC == 2);
+    } /*Loop: Insert each id in the batch*/
+
+    return 1;
+} /*insIdFpBatch*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o Pointer to the slot with idBigNum
+|     o 0 if idBigNum is not in the table
+\---------------------------------------------------------------------*/
+struct idFpSlot * findIdFpHash(
+    struct idFpHash *hashST, /*Table to search*/
+    struct bigNum *idBigNum  /*Read id to find*/
+) /*Finds a big number read id in an idFpHash table*/
+{ /*findIdFpHash*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: Sec-1 Sub-1: findIdFpHash
+    '   - An id can not be past a slot whose id is closer to its home
+    '     slot than the id would be (Robin Hood), so stop there
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t fpOneUL = 0;
+    uint64_t fpTwoUL = 0;
+    uint64_t posUL = 0;
+    uint32_t probeUI = 1;
+    struct idFpSlot *slotST = 0;
+
+    if(hashST->slotAryST == 0)
+        return 0;
+
+    bigNumToIdFp(idBigNum, &fpOneUL, &fpTwoUL);
+    posUL = fpOneUL & hashST->maskUL;
+    slotST = hashST->slotAryST + posUL;
+
+    while(slotST->probeUI >= probeUI)
+    { /*Loop: Check the slots the id could be in*/
+        if(slotST->fpOneUL == fpOneUL && slotST->fpTwoUL == fpTwoUL)
+            return slotST;
+
+        ++probeUI;
+        posUL = (posUL + 1) & hashST->maskUL;
+        slotST = hashST->slotAryST + posUL;
+    } /*Loop: Check the slots the id could be in*/
+
+    return 0;
+} /*findIdFpHash*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The slots in hashST (data pointers are not freed)
+|   - Modifies:
+|     o hashST to be an empty table
+\---------------------------------------------------------------------*/
+void freeIdFpHash(
+    struct idFpHash *hashST /*Table to free*/
+) /*Frees the slots in an idFpHash table*/
+{ /*freeIdFpHash*/
+    free(hashST->slotAryST);
+    initIdFpHash(hashST);
+} /*freeIdFpHash*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if made the table
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have every read id in readList
+|   - Frees:
+|     o Every readInfo node in readList (the table does not need them)
+\---------------------------------------------------------------------*/
+uint8_t readListToIdFpHash(
+    struct readInfo *readList, /*List of ids (rightChild is next)*/
+    uint64_t numIdsUL,         /*Number of ids in readList*/
+    struct idFpHash *hashST    /*Table to build (must be empty)*/
+) /*Builds an idFpHash table from a readInfo list*/
+{ /*readListToIdFpHash*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: readListToIdFpHash
+    '   o fun-9 sec-1: Variable declerations
+    '   o fun-9 sec-2: Make the table
+    '   o fun-9 sec-3: Fingerprint & insert the ids in batches
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 1;
+    uint32_t lenBatchUI = 0;
+    uint64_t fpOneAryUL[defFpBatchUI];
+    uint64_t fpTwoAryUL[defFpBatchUI];
+    void *dataAry[defFpBatchUI];
+    uint8_t dupAryUC[defFpBatchUI];
+    struct readInfo *nextRead = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-2: Make the table
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errUC = makeIdFpHash(hashST, numIdsUL);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-3: Fingerprint & insert the ids in batches
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(readList != 0)
+    { /*Loop: Fingerprint each id in the list*/
+        nextRead = readList->rightChild;
+
+        if(errUC & 1)
+        { /*If have had no errors*/
+            bigNumToIdFp(
+                readList->idBigNum,
+                &fpOneAryUL[lenBatchUI],
+                &fpTwoAryUL[lenBatchUI]
+            );
+
+            dataAry[lenBatchUI] = 0;
+            ++lenBatchUI;
+        } /*If have had no errors*/
+
+        freeReadInfoStruct(&readList);
+        readList = nextRead;
+
+        if(lenBatchUI == defFpBatchUI || (readList == 0 && lenBatchUI))
+        { /*If have a full batch or the last ids*/
+            errUC =
+                insIdFpBatch(
+                    hashST,
+                    fpOneAryUL,
+                    fpTwoAryUL,
+                    dataAry,
+                    dupAryUC,
+                    lenBatchUI
+                );
+
+            lenBatchUI = 0;
+        } /*If have a full batch or the last ids*/
+    } /*Loop: Fingerprint each id in the list*/
+
+    return errUC;
+} /*readListToIdFpHash*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if made the table
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have every read id in idFILE (one id per line)
+\---------------------------------------------------------------------*/
+uint8_t idFileToIdFpHash(
+    FILE *idFILE,            /*File with one read id per line*/
+    char *buffCStr,          /*Buffer to read lines into*/
+    uint32_t lenBuffUI,      /*Size of buffCStr*/
+    struct idFpHash *hashST  /*Table to build (must be empty)*/
+) /*Builds an idFpHash table from a file of read ids*/
+{ /*idFileToIdFpHash*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: idFileToIdFpHash
+    '   o fun-10 sec-1: Variable declerations
+    '   o fun-10 sec-2: Set up the reused big number & the table
+    '   o fun-10 sec-3: Fingerprint & insert the ids in batches
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 1;
+    uint32_t lenBatchUI = 0;
+    uint64_t fpOneAryUL[defFpBatchUI];
+    uint64_t fpTwoAryUL[defFpBatchUI];
+    void *dataAry[defFpBatchUI];
+    uint8_t dupAryUC[defFpBatchUI];
+    char zeroCStr[] = "0";
+    char *tmpCStr = 0;
+    char fullLineBl = 1;    /*1: buffCStr started at a line start*/
+    char nextFullBl = 1;    /*1: Next fgets starts at a line start*/
+
+    /*Sized for defFpMaxIdLenUI, so strToBackwardsBigNum never
+      needs to resize the reused big number*/
+    int32_t lenBigNumI = defFpLenBigNumI;
+    struct bigNum *idBigNum = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-2: Set up the reused big number & the table
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    idBigNum = makeBigNumStruct(zeroCStr, &lenBigNumI);
+
+    if(idBigNum == 0)
+        return 64;
+
+    if(makeIdFpHash(hashST, 1024) & 64)
+    { /*If had a memory allocation error*/
+        freeBigNumStruct(&idBigNum);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-3: Fingerprint & insert the ids in batches
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(errUC & 1)
+    { /*Loop: Read in each read id*/
+        tmpCStr = fgets(buffCStr, lenBuffUI, idFILE);
+
+        if(tmpCStr != 0)
+        { /*If read in part of a line*/
+            while(*tmpCStr != '\0')
+                ++tmpCStr;
+
+            /*Lines longer than the buffer are only read in once*/
+            nextFullBl = (*(tmpCStr - 1) == '\n');
+
+            /*Keep the id in the limbs the big number has*/
+            if(tmpCStr - buffCStr > defFpMaxIdLenUI)
+                *(buffCStr + defFpMaxIdLenUI) = '\0';
+        } /*If read in part of a line*/
+
+        if(tmpCStr != 0 && fullLineBl && (unsigned char) *buffCStr > 32)
+        { /*If have a read id on this line*/
+            strToBackwardsBigNum(idBigNum, buffCStr, &lenBigNumI);
+
+            bigNumToIdFp(
+                idBigNum,
+                &fpOneAryUL[lenBatchUI],
+                &fpTwoAryUL[lenBatchUI]
+            );
+
+            dataAry[lenBatchUI] = 0;
+            ++lenBatchUI;
+        } /*If have a read id on this line*/
+
+        fullLineBl = nextFullBl;
+
+        if(lenBatchUI == defFpBatchUI || (tmpCStr == 0 && lenBatchUI))
+        { /*If have a full batch or the last ids*/
+            errUC =
+                insIdFpBatch(
+                    hashST,
+                    fpOneAryUL,
+                    fpTwoAryUL,
+                    dataAry,
+                    dupAryUC,
+                    lenBatchUI
+                );
+
+            lenBatchUI = 0;
+        } /*If have a full batch or the last ids*/
+
+        if(tmpCStr == 0)
+            break; /*End of file*/
+    } /*Loop: Read in each read id*/
+
+    freeBigNumStruct(&idBigNum);
+    return errUC;
+} /*idFileToIdFpHash*/
@@ -0,0 +1,216 @@
+/*######################################################################
+# Name: fqGetIdsFpHash
+# Use:
+#   o Flat open addressing (Robin Hood) hash table of read ids. Each
+#     slot holds two 64 bit fingerprints of the read ids big number
+#     (bigNum) inline, so the table needs no tree nodes or big numbers
+#     after it is built.
+# Includes:
+#   - "fqGetIdsStructs.h"
+# C standard includes:
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef FQGETIDSFPHASH_H
+#define FQGETIDSFPHASH_H
+
+#include "fqGetIdsStructs.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' fqGetIdsFpHash SOH: Start Of Header
+'   o st-1 idFpSlot:
+'     - One slot (fingerprints & data) in an idFpHash table
+'   o st-2 idFpHash:
+'     - Flat Robin Hood hash table of read id fingerprints
+'   o fun-1 initIdFpHash:
+'     - Sets an idFpHash structure to an empty table
+'   o fun-2 makeIdFpHash:
+'     - Allocates an empty idFpHash table for a number of ids
+'   o fun-3 bigNumToIdFp:
+'     - Finds the two fingerprints of a big number read id
+'   o fun-4 insIdFp:
+'     - Inserts a read ids fingerprints into an idFpHash table
+'   o fun-5 growIdFpHash:
+'     - Doubles the number of slots in an idFpHash table
+'   o fun-6 insIdFpBatch:
+'     - Inserts a batch of fingerprints (prefetches the home slots)
+'   o fun-7 findIdFpHash:
+'     - Finds a big number read id in an idFpHash table
+'   o fun-8 freeIdFpHash:
+'     - Frees the slots in an idFpHash table
+'   o fun-9 readListToIdFpHash:
+'     - Builds an idFpHash table from a readInfo list
+'   o fun-10 idFileToIdFpHash:
+'     - Builds an idFpHash table from a file of read ids
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defFpSeedOneUL 0x9E3779B97F4A7C15UL /*Golden ratio (2^64)*/
+#define defFpSeedTwoUL 0xC2B2AE3D27D4EB4FUL
+#define defFpMulOneUL 0xFF51AFD7ED558CCDUL  /*Murmur3 fmix64 numbers*/
+#define defFpMulTwoUL 0xC4CEB9FE1A85EC53UL
+#define defFpMinSlotsUL 16    /*Smallest table to make*/
+#define defFpBatchUI 16       /*Ids fingerprinted & prefetched at once*/
+
+/*Length to make the reused big number with. The big number functions
+  make about length / 16 limbs on 32 bit (short) builds, so this stays
+  under the 255 limb max of the unsigned char limb count, while still
+  holding defFpMaxIdLenUI characters with every limb type*/
+#define defFpLenBigNumI 4080
+#define defFpMaxIdLenUI 512   /*Longest id (in characters) to hash*/
+
+/*---------------------------------------------------------------------\
+| ST-1: idFpSlot
+| Use: One slot in an idFpHash table
+\---------------------------------------------------------------------*/
+typedef struct idFpSlot
+{ /*idFpSlot*/
+    uint64_t fpOneUL;  /*First fingerprint (also picks the home slot)*/
+    uint64_t fpTwoUL;  /*Second fingerprint (checks for collisions)*/
+    void *dataPtr;     /*Data for the read id (readPrim) or 0*/
+    uint32_t probeUI;  /*0: empty slot; else 1 + slots from home slot*/
+}idFpSlot;
+
+/*---------------------------------------------------------------------\
+| ST-2: idFpHash
+| Use: Flat Robin Hood hash table of read id fingerprints. The table
+|      doubles in size when it is over half full.
+\---------------------------------------------------------------------*/
+typedef struct idFpHash
+{ /*idFpHash*/
+    struct idFpSlot *slotAryST; /*Slots in the table (0 if no table)*/
+    uint64_t maskUL;            /*Number of slots - 1 (power of two)*/
+    uint64_t numIdsUL;          /*Number of read ids in the table*/
+}idFpHash;
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o hashST to be an empty table with no slots
+\---------------------------------------------------------------------*/
+void initIdFpHash(
+    struct idFpHash *hashST /*Table to initialize*/
+); /*Sets an idFpHash structure to an empty table*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if made the table
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have at least two empty slots per id
+\---------------------------------------------------------------------*/
+uint8_t makeIdFpHash(
+    struct idFpHash *hashST, /*Table to set up (must be empty)*/
+    uint64_t numIdsUL        /*Number of ids expected*/
+); /*Allocates an empty idFpHash table for a number of ids*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o fpOneUL & fpTwoUL to hold the fingerprints of idBigNum
+\---------------------------------------------------------------------*/
+void bigNumToIdFp(
+    struct bigNum *idBigNum, /*Read id to fingerprint*/
+    uint64_t *fpOneUL,       /*Set to the first fingerprint*/
+    uint64_t *fpTwoUL        /*Set to the second fingerprint*/
+); /*Finds the two fingerprints of a big number read id*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if inserted the fingerprints
+|     o 2 if the fingerprints were already in the table (no insert)
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have the fingerprints (grows the table if needed)
+\---------------------------------------------------------------------*/
+uint8_t insIdFp(
+    struct idFpHash *hashST, /*Table to insert into*/
+    uint64_t fpOneUL,        /*First fingerprint of the read id*/
+    uint64_t fpTwoUL,        /*Second fingerprint of the read id*/
+    void *dataPtr            /*Data to keep with the id (can be 0)*/
+); /*Inserts a read ids fingerprints into an idFpHash table*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if doubled the table
+|     o 64 for memory allocation errors (table is not changed)
+\---------------------------------------------------------------------*/
+uint8_t growIdFpHash(
+    struct idFpHash *hashST /*Table to double*/
+); /*Doubles the number of slots in an idFpHash table*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if inserted all fingerprints
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o dupAryUC to be 1 for duplicate ids & 0 for inserted ids
+\---------------------------------------------------------------------*/
+uint8_t insIdFpBatch(
+    struct idFpHash *hashST, /*Table to insert into*/
+    uint64_t *fpOneAryUL,    /*First fingerprints of the read ids*/
+    uint64_t *fpTwoAryUL,    /*Second fingerprints of the read ids*/
+    void **dataAry,          /*Data for each id (0 for no data)*/
+    uint8_t *dupAryUC,       /*Set to 1 if the id was a duplicate*/
+    uint32_t numIdsUI        /*Number of ids in the batch*/
+); /*Inserts a batch of fingerprints (prefetches the home slots)*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o Pointer to the slot with idBigNum
+|     o 0 if idBigNum is not in the table
+\---------------------------------------------------------------------*/
+struct idFpSlot * findIdFpHash(
+    struct idFpHash *hashST, /*Table to search*/
+    struct bigNum *idBigNum  /*Read id to find*/
+); /*Finds a big number read id in an idFpHash table*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The slots in hashST (data pointers are not freed)
+|   - Modifies:
+|     o hashST to be an empty table
+\---------------------------------------------------------------------*/
+void freeIdFpHash(
+    struct idFpHash *hashST /*Table to free*/
+); /*Frees the slots in an idFpHash table*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if made the table
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have every read id in readList
+|   - Frees:
+|     o Every readInfo node in readList (the table does not need them)
+\---------------------------------------------------------------------*/
+uint8_t readListToIdFpHash(
+    struct readInfo *readList, /*List of ids (rightChild is next)*/
+    uint64_t numIdsUL,         /*Number of ids in readList*/
+    struct idFpHash *hashST    /*Table to build (must be empty)*/
+); /*Builds an idFpHash table from a readInfo list*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if made the table
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o hashST to have every read id in idFILE (one id per line)
+\---------------------------------------------------------------------*/
+uint8_t idFileToIdFpHash(
+    FILE *idFILE,            /*File with one read id per line*/
+    char *buffCStr,          /*Buffer to read lines into*/
+    uint32_t lenBuffUI,      /*Size of buffCStr*/
+    struct idFpHash *hashST  /*Table to build (must be empty)*/
+); /*Builds an idFpHash table from a file of read ids*/
+
+#endif
@@ -31,7 +31,8 @@ uint8_t fastqExtract(
     char *outPathCStr,         /*Path to fastq file to to write reads*/
     uint8_t sizeReadStackUChar,/*Number of elements to use in stack*/
     uint32_t lenBuffUI,     /*Size of buffer to read input with*/
-    uint8_t hashSearchChar,    /*1: do hash search, 0: do Tree search*/
+    uint8_t hashSearchChar,    /*2: fingerprint hash, 1: hash search,
+                                 0: do Tree search*/
     uint8_t printReverseChar   /*1: Keep reads in filter file
                                  0: ingore reads in filter file*/
 ) /*Searches and extracts reads from a fastq file using read id's*/
@@ -66,9 +67,11 @@ uint8_t fastqExtract(
     struct readNodeStack readStack[sizeReadStackUChar + 2];
     struct readInfo *readTree = 0;
     struct readInfo **hashTbl = 0;
+    struct idFpHash fpHashST;    /*Fingerprint table (hashSearch 2)*/
 
     FILE *filtFILE = 0;          /*to file with ID's to search for*/
     FILE *fqFILE = 0; /*fastq file to search*/
+    char pipeBl = 0;  /*Always 0, seekBl = 1 never returns a pipe*/
     FILE *outFILE = 0;           /*File to write extracted reads to*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -86,10 +89,12 @@ uint8_t fastqExtract(
     if(filtFILE == 0)
         return 2;      /*No input file with read ids*/
 
+    /*gzip files are decompressed to a tmpfile, since the search uses
+      fseek to back up to the start of split read ids*/
     if(fqPathCStr == 0)
         fqFILE = stdin;
     else
-        fqFILE = fopen(fqPathCStr, "r");
+        fqFILE = openFqFILE(fqPathCStr, 0, 1, &pipeBl);
 
     if(fqFILE == 0)
     { /*If could not open the fastq file*/
@@ -115,8 +120,17 @@ uint8_t fastqExtract(
     /*Make sure start & end of my stacks are marked*/
     readStack[0].readNode = 0;
     readStack[sizeReadStackUChar + 1].readNode = 0;
+    initIdFpHash(&fpHashST);
 
-    if(hashSearchChar == 0)
+    if(hashSearchChar == 2)
+    { /*If using the flat fingerprint hash table*/
+        if(idFileToIdFpHash(filtFILE, buffCStr, lenBuffUI, &fpHashST) & 1)
+            hashFailedBool = 0;
+        else
+            freeIdFpHash(&fpHashST);
+    } /*If using the flat fingerprint hash table*/
+
+    else if(hashSearchChar == 0)
     { /*If just using the avl tree for searching*/
         readTree =
             buildAvlTree(
@@ -161,7 +175,8 @@ uint8_t fastqExtract(
             digPerKeyUChar,    /*Digits needed to get a key*/
             &printReverseChar,
             readTree,          /*AVL tree to search if hashTbl == 0*/
-            hashTbl            /*hash table to search*/
+            hashTbl,           /*hash table to search*/
+            fpHashST.slotAryST ? &fpHashST : 0 /*Fingerprint table*/
     );
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -172,7 +187,9 @@ uint8_t fastqExtract(
     fclose(outFILE); /*No longer need open*/
 
     /*Check if freeing tree or hash table with tree*/
-    if(hashSearchChar == 0)
+    if(hashSearchChar == 2)
+        freeIdFpHash(&fpHashST);
+    else if(hashSearchChar == 0)
         freeReadTree(&readTree, readStack);
     else
     { /*If used hashing, free the hashing variables*/
@@ -292,7 +309,8 @@ uint8_t extractReads(
     uint8_t digPerKeyUChar,     /*Digits needed to get a key*/
     uint8_t *printNonMatchBool, /*1: print non-match, 0: print match*/
     struct readInfo *readTree,  /*For AVL search (hashTbl == 0)*/
-    struct readInfo **hashTbl   /*Hash table to search for ids in*/
+    struct readInfo **hashTbl,  /*Hash table to search for ids in*/
+    struct idFpHash *fpHashST   /*Fingerprint table (0 to not use)*/
 ) /*Extract target reads from fastq file with hash table or tree*/
 { /*extractReadsInHash*/
 
@@ -380,7 +398,14 @@ uint8_t extractReads(
         # Fun-3 Sec-3 Sub-2: Determine if read is in tree
         ***********************************************************************/
 
-        if(hashTbl == 0)
+        if(fpHashST != 0)
+        { /*If using the flat fingerprint hash table*/
+            /*Only checking if found, so the slot works as the node*/
+            lastRead =
+                (struct readInfo *) findIdFpHash(fpHashST, idBigNum);
+        } /*If using the flat fingerprint hash table*/
+
+        else if(hashTbl == 0)
             lastRead = searchTree(idBigNum, readTree); /*Use avl tree*/
         else 
         { /*Else doing a hash table*/
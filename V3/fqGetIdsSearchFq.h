@@ -12,6 +12,7 @@
 
 #include "fqGetIdsFqFun.h" /*includes fqGetIdsStructs.h*/
 #include "fqGetIdsHash.h"
+#include "fqGetIdsFpHash.h"
     /*Includes:
           - fqGetIdsAVLTree.h:
               - <string.h>
@@ -32,7 +33,8 @@ uint8_t fastqExtract(
     char *outPathCStr,         /*Path to fastq file to to write reads*/
     uint8_t sizeReadStackUChar, /*Number of elements to use in stack*/
     uint32_t buffSizeUInt,      /*Size of buffer to read input with*/
-    uint8_t hashSearchChar,     /*1: do hash search, 0: do Tree search*/
+    uint8_t hashSearchChar,     /*2: fingerprint hash, 1: hash search,
+                                  0: do Tree search*/
     uint8_t printReverseChar    /*1: Keep reads in filter file
                                   0: ingore reads in filter file*/
 ); /*Searches and extracts reads from a fastq file using read id's*/
@@ -63,7 +65,8 @@ uint8_t extractReads(
     uint8_t digPerKeyUChar,     /*Digits needed to get a key*/
     uint8_t *printNonMatchBool, /*1: print non-match, 0: print match*/
     struct readInfo *readTree,  /*For AVL search (hashTbl == 0)*/
-    struct readInfo **hashTbl   /*Hash table to search for ids in*/
+    struct readInfo **hashTbl,  /*Hash table to search for ids in*/
+    struct idFpHash *fpHashST   /*Fingerprint table (0 to not use)*/
 ); /*Extract target reads from fastq file with hash table or tree*/
 
 #endif
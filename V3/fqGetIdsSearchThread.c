@@ -3,25 +3,28 @@
 '   - fun-1 fastqThreadExtractThread:
 '     o Calls function to set up hash table/AVL tree and extract reads
 '   - fun-2 extractReadsThread:
-'     o Extracts reads by id with multi-thread support
-'   - fun-3 getFileLen:
-'     o Get length of file (set up to be called by a separate thread)
-'   - fun-4 findStartPos:
-'     o Find starting position of a thread in a read id extraction
+'     o Extracts reads by id from one chunk of a mapped fastq file
+'   - fun-3 nextFqEntry:
+'     o Finds the end of a fastq entry in a memory buffer
+'   - fun-4 findFqChunkStart:
+'     o Finds the start of the next fastq entry in a memory buffer
+'   - fun-5 writeKeptReads:
+'     o Writes the kept fastq entries from each thread in input order
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #include "fqGetIdsSearchThread.h"
 
-pthread_mutex_t lockerMutex;
-
 /*---------------------------------------------------------------------\
 | Output:
 |   - Stdout: Prints out kept reads
 |   - Returns:
+|     o 0 if the fastq file is not valid
+|     o 1 for success
 |     o 2 if invalid filter file
 |     o 4 if invalid input fastq file
 |     o 8 if could not open the output file
 |     o 16 if both filter and fastq file coming from stdin
+|     o 64 for memory allocation errors
 \---------------------------------------------------------------------*/
 uint8_t fastqThreadExtract(
     char *filtPathCStr,        /*Path to file with read ids to extract*/
@@ -30,7 +33,8 @@ uint8_t fastqThreadExtract(
     unsigned char threadsUC,   /*Number of threads to use*/
     uint8_t sizeReadStackUC,   /*Number of elements to use in stack*/
     uint32_t lenBuffUI,        /*Size of buffer to read input with*/
-    uint8_t hashSearchC,    /*1: do hash search, 0: do Tree search*/
+    uint8_t hashSearchC,    /*2: fingerprint hash, 1: hash search,
+                              0: do Tree search*/
     uint8_t printReverseC   /*1: Keep reads in filter file
                                  0: ingore reads in filter file*/
 ) /*Searches and extracts reads from a fastq file using read id's*/
@@ -41,13 +45,14 @@ uint8_t fastqThreadExtract(
     '    fun-1 sec-1: Variable declerations
     '    fun-1 sec-2: Check if files exist
     '    fun-1 sec-3: Build the tree for reads
-    '    fun-1 sec-4: Call tree or hash table function to search file
-    '    fun-1 sec-5: Handle errors, clean up, & exit
+    '    fun-1 sec-4: Map the fastq file & split it into chunks
+    '    fun-1 sec-5: Call tree or hash table function to search file
+    '    fun-1 sec-6: Handle errors, clean up, & exit
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-1 Sec-1: Variable declerations
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char buffCStr[lenBuffUI + 1];  /*Holds the input line*/
 
@@ -62,17 +67,21 @@ uint8_t fastqThreadExtract(
 
     /*For multi-threading*/
     pthread_t threadsAry[threadsUC];
-    struct getFileLenStruct fileLenCall;
-    unsigned long startUL[threadsUC + 1];/*Starting point each thread*/
     struct extReadsST extAryST[threadsUC];
+    struct stat fqStatST;          /*Gets the size of the fastq file*/
+    char *mapCStr = 0;             /*Mapped fastq file*/
+    char *endMapCStr = 0;          /*One byte past the mapped file*/
+    size_t lenMapUL = 0;           /*Size of the mapped file*/
 
     /*Stack to use for searching tree. (depth = 73 = 10^18 nodes)*/
     struct readNodeStack readStack[sizeReadStackUC + 2];
     struct readInfo *readTree = 0;
     struct readInfo **hashTbl = 0;
+    struct idFpHash fpHashST;      /*Fingerprint table (hashSearch 2)*/
 
     FILE *filtFILE = 0;          /*to file with ID's to search for*/
-    FILE *fqAryFILE[threadsUC]; /*fastq file to search*/
+    FILE *fqFILE = 0;            /*fastq file to search*/
+    char pipeBl = 0;  /*Always 0, seekBl = 1 never returns a pipe*/
     FILE *outFILE = 0;           /*File to write extracted reads to*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -90,18 +99,19 @@ uint8_t fastqThreadExtract(
     if(filtFILE == 0)
         return 2;      /*No input file with read ids*/
 
+    /*gzip files are decompressed to a tmpfile, which can be mapped*/
     if(fqPathCStr == 0)
-        fqAryFILE[0] = stdin;
+        fqFILE = stdin;
     else
-        fqAryFILE[0] = fopen(fqPathCStr, "r");
+        fqFILE = openFqFILE(fqPathCStr, 0, 1, &pipeBl);
 
-    if(fqAryFILE[0] == 0)
+    if(fqFILE == 0)
     { /*If could not open the fastq file*/
         fclose(filtFILE);
         return 4;      /*No input file with reads to extract*/
     } /*If could not open the fastq file*/
 
-    if(outPathCStr == 0) 
+    if(outPathCStr == 0)
         outFILE = stdout;
     else
         outFILE = fopen(outPathCStr, "w");
@@ -109,7 +119,8 @@ uint8_t fastqThreadExtract(
     if(outFILE == 0)
     { /*if I could not open the output file*/
         fclose(filtFILE);
-        fclose(fqAryFILE[0]);
+        fclose(fqFILE);
+        return 8;
     } /*if I could not open the output file*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -119,16 +130,17 @@ uint8_t fastqThreadExtract(
     /*Make sure start & end of my stacks are marked*/
     readStack[0].readNode = 0;
     readStack[sizeReadStackUC + 1].readNode = 0;
+    initIdFpHash(&fpHashST);
 
-    if(threadsUC > 1)
-    { /*If I am using multiple threads*/
-        fileLenCall.lenFileUL = 0;
-        fileLenCall.inFILE = fqAryFILE[0];
-                       /*Thread to use, ?, function, parameters*/
-        pthread_create(&threadsAry[0], 0, getFileLen, &fileLenCall);
-    } /*If I am using multiple threads*/
+    if(hashSearchC == 2)
+    { /*If using the flat fingerprint hash table*/
+        if(idFileToIdFpHash(filtFILE, buffCStr, lenBuffUI, &fpHashST) & 1)
+            hashFailedBl = 0;
+        else
+            freeIdFpHash(&fpHashST);
+    } /*If using the flat fingerprint hash table*/
 
-    if(hashSearchC == 0)
+    else if(hashSearchC == 0)
     { /*If just using the avl tree for searching*/
         readTree =
             buildAvlTree(
@@ -156,9 +168,6 @@ uint8_t fastqThreadExtract(
 
     fclose(filtFILE); /*No longer need open*/
 
-    if(threadsUC > 1)
-        pthread_join(threadsAry[0], 0); /*Wait till 2nd thread finshes*/
-
     if(readTree == 0 && hashFailedBl == 1)
     { /*If calloc errored out in making the tree*/
         fprintf(
@@ -166,57 +175,97 @@ uint8_t fastqThreadExtract(
             "calloc failed: fastqGrepSearchFastq.c: Fun-1: 99\n"
         ); /*Warn user calloc failed*/
 
-        return 0;
+        fclose(fqFILE);
+        fclose(outFILE);
+        return 64;
     } /*If calloc errored out in making the tree*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-1 Sec-3: Assing file sections to each thread
+    ^ Fun-1 Sec-4: Map the fastq file & split it into chunks
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    if(threadsUC > 1)
-    { /*If have more than one thread*/
-       /*Get number of bytes for each thread to handel*/
-       startUL[threadsUC] = fileLenCall.lenFileUL; /*Ending piont*/
-
-       for(unsigned char ucThread = 0; ucThread < threadsUC; ++ucThread)
-       { /*Initalize the thread values*/
-           if(ucThread == 0)
-               startUL[ucThread] = 0;
-           else 
-           { /*Else if not on the first thread*/
-               if(ucThread == 1)
-                   startUL[1]= fileLenCall.lenFileUL / threadsUC;
-               else
-                   startUL[ucThread] +=startUL[ucThread - 1]+startUL[1];
-
-               fqAryFILE[ucThread] = fopen(fqPathCStr, "r");
-               fseek(fqAryFILE[ucThread], startUL[ucThread], SEEK_SET);
-           } /*Else if not on the first thread*/
-
-           extAryST[ucThread].startPosUL = &startUL[ucThread];
-           extAryST[ucThread].endPosUL = &startUL[ucThread + 1];
-           extAryST[ucThread].lenBuffUI = lenBuffUI;
-           extAryST[ucThread].majicNumUL = majicNumUL;
-           extAryST[ucThread].digPerKeyUC = digPerKeyUC;
-           extAryST[ucThread].printNonMatchBl = printReverseC;
-
-           extAryST[ucThread].readTree = readTree;
-           extAryST[ucThread].hashTbl = hashTbl;
-
-           extAryST[ucThread].fqFILE = fqAryFILE[ucThread];
-           extAryST[ucThread].outFILE = outFILE;
-       } /*Initalize the thread values*/
-    } /*If have more than one thread*/
+    /*stdin can not be mapped, so it is always read by one thread*/
+    if(threadsUC > 1 && fqFILE != stdin)
+    { /*If using multiple threads*/
+        if(
+              fstat(fileno(fqFILE), &fqStatST) == 0
+           && fqStatST.st_size > 0
+        ) { /*If have a file to map*/
+            lenMapUL = fqStatST.st_size;
+
+            mapCStr =
+                mmap(
+                    0,
+                    lenMapUL,
+                    PROT_READ,
+                    MAP_PRIVATE,
+                    fileno(fqFILE),
+                    0
+                ); /*Map the fastq file*/
+
+            if(mapCStr == MAP_FAILED)
+                mapCStr = 0;   /*Fall back to the one thread reader*/
+            else
+                madvise(mapCStr, lenMapUL, MADV_SEQUENTIAL);
+        } /*If have a file to map*/
+    } /*If using multiple threads*/
+
+    if(mapCStr != 0)
+    { /*If mapped the fastq file*/
+        endMapCStr = mapCStr + lenMapUL;
+
+        for(unsigned char ucThread = 0; ucThread < threadsUC; ++ucThread)
+        { /*Loop: Find the chunk for each thread*/
+            /*Move each even split to the next fastq entry*/
+            if(ucThread == 0)
+                extAryST[ucThread].startCStr = mapCStr;
+            else
+            { /*Else if not the first thread*/
+                extAryST[ucThread].startCStr =
+                    findFqChunkStart(
+                        mapCStr + (lenMapUL / threadsUC) * ucThread,
+                        mapCStr,
+                        endMapCStr
+                    ); /*Find the first entry in this chunk*/
+
+                /*A long entry can cover more than one even split*/
+                if(
+                   extAryST[ucThread].startCStr <
+                   extAryST[ucThread - 1].startCStr
+                ) extAryST[ucThread].startCStr =
+                      extAryST[ucThread - 1].startCStr;
+
+                extAryST[ucThread - 1].endCStr =
+                    extAryST[ucThread].startCStr;
+            } /*Else if not the first thread*/
+
+            extAryST[ucThread].majicNumUL = majicNumUL;
+            extAryST[ucThread].digPerKeyUC = digPerKeyUC;
+            extAryST[ucThread].printNonMatchBl = printReverseC;
+
+            extAryST[ucThread].readTree = readTree;
+            extAryST[ucThread].hashTbl = hashTbl;
+            extAryST[ucThread].fpHashST =
+                fpHashST.slotAryST ? &fpHashST : 0;
+
+            extAryST[ucThread].keptAryST = 0;
+            extAryST[ucThread].numKeptUL = 0;
+            extAryST[ucThread].lenKeptUL = 0;
+            extAryST[ucThread].retValUC = 0;
+        } /*Loop: Find the chunk for each thread*/
+
+        extAryST[threadsUC - 1].endCStr = endMapCStr;
+    } /*If mapped the fastq file*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-1 Sec-4: Call tree or hash table function to search fastq
+    ^ Fun-1 Sec-5: Call tree or hash table function to search fastq
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    if(threadsUC < 2)
+    if(mapCStr == 0)
     { /*If working with only one thread*/
         fastqErrUL =
             extractReads(
-                fqAryFILE[0], /*to fastq file to search through*/
+                fqFILE,       /*to fastq file to search through*/
                 outFILE,      /*File to write extracted reads to*/
                 buffCStr,     /*Buffer to hold input from fastq file*/
                 lenBuffUI,    /*Size of buffCStr*/
@@ -224,14 +273,13 @@ uint8_t fastqThreadExtract(
                 digPerKeyUC, /*Digits needed to get a key*/
                 &printReverseC,
                 readTree,       /*AVL tree to search if hashTbl == 0*/
-                hashTbl         /*hash table to search*/
+                hashTbl,        /*hash table to search*/
+                fpHashST.slotAryST ? &fpHashST : 0 /*Fingerprint table*/
         );
     } /*If working with only one thread*/
 
     else
     { /*Else I am working with multiple threads*/
-        pthread_mutex_init(&lockerMutex,0); /*intiate my mutext*/
-
         for(unsigned char ucThread = 0; ucThread <threadsUC; ++ucThread)
            pthread_create(
                &threadsAry[ucThread],
@@ -244,27 +292,43 @@ uint8_t fastqThreadExtract(
         for(unsigned char ucThread = 0; ucThread <threadsUC; ++ucThread)
             pthread_join(threadsAry[ucThread], 0);
 
-        pthread_mutex_destroy(&lockerMutex);
         fastqErrUL = 1;
 
         for(unsigned char ucThread=0; ucThread < threadsUC; ++ucThread)
-        { /*loop to close all my opened files*/
-            fclose(fqAryFILE[ucThread]);
-            fqAryFILE[ucThread] = 0;
-
-            if(extAryST[ucThread].retValUC == 0)
+        { /*Loop: Check if any threads had errors*/
+            if(extAryST[ucThread].retValUC & 64)
+                fastqErrUL = 64;
+            else if(extAryST[ucThread].retValUC == 0 && fastqErrUL == 1)
                 fastqErrUL = 0;
-        } /*loop to close all my opened files*/
+        } /*Loop: Check if any threads had errors*/
+
+        /*Output is only written if every thread finished, so the
+          output is the same for any number of threads*/
+        if(fastqErrUL == 1)
+        { /*If can print out the kept reads*/
+            fflush(outFILE);
+
+            if(!(writeKeptReads(fileno(outFILE), extAryST, threadsUC) & 1))
+                fastqErrUL = 8;
+        } /*If can print out the kept reads*/
+
+        for(unsigned char ucThread=0; ucThread < threadsUC; ++ucThread)
+            free(extAryST[ucThread].keptAryST);
+
+        munmap(mapCStr, lenMapUL);
     } /*Else I am working with multiple threads*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-1 Sec-5: Handle errors, clean up, & exit
+    ^ Fun-1 Sec-6: Handle errors, clean up, & exit
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    closeFqFILE(fqFILE, pipeBl);
     fclose(outFILE); /*No longer need open*/
 
     /*Check if freeing tree or hash table with tree*/
-    if(hashSearchC == 0)
+    if(hashSearchC == 2)
+        freeIdFpHash(&fpHashST);
+    else if(hashSearchC == 0)
         freeReadTree(&readTree, readStack);
     else
     { /*If used hashing, free the hashing variables*/
@@ -274,140 +338,121 @@ uint8_t fastqThreadExtract(
     if(fastqErrUL == 0)
         return 0;         /*Not a valid fastq file*/
 
+    if(fastqErrUL > 1)
+        return fastqErrUL; /*Memory or write error*/
+
     return 1; /*Success*/
 } /*fastqExtract*/
 
 /*---------------------------------------------------------------------\
 | Output:
-|    stdout: Prints out reads in hash table
+|   - Modifies:
+|     o keptAryST, numKeptUL, & lenKeptUL in parmST to hold the
+|       fastq entries to print out
+|     o retValUC in parmST to be 1 for success, 0 for an invalid
+|       fastq entry, & 64 for memory allocation errors
 \---------------------------------------------------------------------*/
 void * extractReadsThread(
     void *parmST /*extReadsST Structer with parameters*/
-) /*Extract target reads from fastq file with hash table or tree*/
-{ /*extractReadsInHash*/
+) /*Extract target reads from a mapped fastq chunk*/
+{ /*extractReadsThread*/
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-2 TOC:
-    #    fun-2 sec-1: Variable declerations
-    #    fun-2 sec-2: Extract target reads from fastq file
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC:
+    '    fun-2 sec-1: Variable declerations
+    '    fun-2 sec-2: Set up the reused big number
+    '    fun-2 sec-3: Extract target reads from the chunk
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-2 Sec-1: Variable declerations
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Cast input as the required struct*/
     struct extReadsST *extParmST = (struct extReadsST *) parmST;
-    uint8_t endOfFileC = 0;       /*Marks if at the end of the file*/
-
-    char *buffCStr = malloc(sizeof(char) * extParmST->lenBuffUI + 1);
-    char *readPosCStr = 0;      /*Position in buffCStr*/
-    char dummyConvertUC = '0';  /*blank number to initalize bignum*/
-    char *startReadCStr = 0;    /*Start of read id for a fastq entry*/
 
-    int32_t lenIdInt = 0;    /*Holds length of read id*/
-
-    uint64_t lenInputUL = 0;/*Holds number char fread grabbed from file*/
-    uint64_t posInFileUL = 0; /*Position at in the file*/
+    char *entryCStr = extParmST->startCStr;  /*Entry on*/
+    char *nextCStr = 0;           /*Entry after entryCStr*/
+    char *idCStr = 0;             /*Position in the read id*/
+    char idBuffCStr[defFpMaxIdLenUI + 1]; /*Copy of the read id*/
+    char zeroCStr[] = "0";      /*blank number to initalize bignum*/
+    uint32_t lenIdUI = 0;
+    int32_t lenIdInt = defFpLenBigNumI;  /*So never need to resize*/
 
     struct bigNum *idBigNum = 0;
+    struct iovec *lastRunST = 0;  /*Last run of kept entries*/
+    struct iovec *swapAryST = 0;  /*For resizing the kept list*/
 
-    struct readInfo *lastRead = 0; /*Holds node of read id found*/
+    void *lastRead = 0;           /*Holds node of read id found*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-2 Sec-2: Extract target reads from fastq file
-    ^    fun-2 sec-3 sub-1: Get the read name of a single fastq entry
-    ^    fun-2 sec-3 sub-2: Determine if read is in tree
-    ^    fun-2 sec-3 sub-3: Decide if should keep read
-    ^    fun-2 sec-3 sub-4: Keeping read, print out read
+    ^ Fun-2 Sec-2: Set up the reused big number
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    if(buffCStr == 0)
-    { /*If had a memory allocation error*/
-        free(buffCStr);
-        extParmST->retValUC = 64;
-        pthread_exit(0);
-    } /*If had a memory allocation error*/
-
-    /*Make sure the buffer is a c-string for fread*/
-    *(buffCStr + extParmST->lenBuffUI - 1) = '\0';
-    lenInputUL =
-            fread(
-                buffCStr,
-                sizeof(char),
-                extParmST->lenBuffUI,
-                extParmST->fqFILE
-    ); /*Read in the first few bytes*/
-
-    readPosCStr = buffCStr;
-
-    if(*extParmST->startPosUL != 0)
-    { /*If this is not the first thread*/
-        findStartPos(
-            &buffCStr,
-            &readPosCStr,
-            &lenInputUL,
-            extParmST
-        ); /*Find starting position of first read*/
-    } /*If this is not the first thread*/
-
-    else
-        extParmST->retValUC = 1; /*Else at the start of the file*/
-
-    if(!(extParmST->retValUC & 1))
-        return 0; /*Something when wrong*/
-
-    /*Intalize the bigNum struct*/
-    lenIdInt = 256;
-    idBigNum = makeBigNumStruct(&dummyConvertUC, &lenIdInt);
+    idBigNum = makeBigNumStruct(zeroCStr, &lenIdInt);
 
     if(idBigNum == 0)
     { /*If could not allocatem memory*/
-        free(buffCStr);
         extParmST->retValUC = 64;
-        pthread_exit(0);
+        return 0;
     } /*If could not allocatem memory*/
 
-    while(endOfFileC != 4)
-    { /*While there are lines in the file*/
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-3: Extract target reads from the chunk
+    ^    fun-2 sec-3 sub-1: Find the read id & end of the entry
+    ^    fun-2 sec-3 sub-2: Determine if read is in tree
+    ^    fun-2 sec-3 sub-3: Decide if should keep read
+    ^    fun-2 sec-3 sub-4: Keeping read, add it to the kept list
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    extParmST->retValUC = 1;
+
+    while(entryCStr < extParmST->endCStr)
+    { /*While there are entries in this threads chunk*/
 
         /**************************************************************\
-        * Fun-2 Sec-3 Sub-1: Get the read name of a single fastq entry
+        * Fun-2 Sec-3 Sub-1: Find the read id & end of the entry
         \**************************************************************/
 
-        endOfFileC =
-            parseFastqHeader(
-                buffCStr,       /*Buffer to hold file input*/
-                &startReadCStr, /*Will hold start of read name*/
-                &readPosCStr,   /*Start of read name, wil hold end*/
-                &lenInputUL,
-                extParmST->lenBuffUI,
-                &lenIdInt,     /*Will hold the lenght of read id*/
-                idBigNum,
-                extParmST->fqFILE
-        ); /*Get read name from file*/
-
-         if(endOfFileC == 0)
-         { /*If ended to early*/
-             free(buffCStr);
-             freeBigNumStruct(&idBigNum);
-             extParmST->retValUC = 0;
-             return 0; /*If fastq file ends on a header*/
-         } /*If ended to early*/
-
-         else if(endOfFileC == 4)
-             continue;            /*At end of file, return*/
+        nextCStr = nextFqEntry(entryCStr, extParmST->endCStr);
+
+        if(nextCStr == 0)
+        { /*If this is not a complete fastq entry*/
+            extParmST->retValUC = 0;
+            break;
+        } /*If this is not a complete fastq entry*/
+
+        /*Copy the id, so the big number has a c-string to convert.
+          Ids longer than the fingerprint table keeps are cut*/
+        idCStr = entryCStr + 1;
+        lenIdUI = 0;
+
+        while(
+              idCStr < nextCStr
+           && (unsigned char) *idCStr > 32
+           && lenIdUI < defFpMaxIdLenUI
+        ) { /*Loop: Copy the read id*/
+            idBuffCStr[lenIdUI] = *idCStr;
+            ++lenIdUI;
+            ++idCStr;
+        } /*Loop: Copy the read id*/
+
+        idBuffCStr[lenIdUI] = '\0';
+        strToBackwardsBigNum(idBigNum, idBuffCStr, &lenIdInt);
 
         /**************************************************************\
         * Fun-2 Sec-3 Sub-2: Determine if read is in tree
         \**************************************************************/
 
-        /*Check if using hash table or AVL tree*/
-        if(extParmST->hashTbl == 0)
+        if(extParmST->fpHashST != 0)
+            lastRead = findIdFpHash(extParmST->fpHashST, idBigNum);
+
+        else if(extParmST->hashTbl == 0)
             lastRead = searchTree(idBigNum, extParmST->readTree);
-        else 
+
+        else
         { /*Else doing a hash table*/
-            lastRead = 
+            lastRead =
                 findReadInHashTbl(
                     idBigNum,
                     &(extParmST->majicNumUL),
@@ -428,227 +473,266 @@ void * extractReadsThread(
         */
         if(((!!lastRead) ^ extParmST->printNonMatchBl) == 0)
         { /*If is a read I am not printing out*/
-             endOfFileC =
-                 moveToNextFastqEntry(
-                     buffCStr,
-                     &readPosCStr, /*Start of read name, wil hold end*/
-                     extParmST->lenBuffUI,
-                     &lenInputUL,/*Holds how many characters fread got*/
-                     extParmST->fqFILE
-             ); /*Move to next fastq entry*/
-
-             if(endOfFileC == 0)
-             { /*If ended to early*/
-                 free(buffCStr);
-                 freeBigNumStruct(&idBigNum);
-                 extParmST->retValUC = 0;
-                 pthread_exit(0);
-             } /*If ended to early*/
-
-             if(ftell(extParmST->fqFILE) >= *extParmST->endPosUL)
-             { /*If on the last buffer read in*/
-                 /*Find the positoin in the file*/
-                 posInFileUL =
-                     1 +                        /*Account for \n or @*/
-                     ftell(extParmST->fqFILE) - /*piont in file*/
-                     lenInputUL -          /*Number of bytes in buffer*/
-                     (readPosCStr - buffCStr);  /*byte of position on*/
-
-
-                 if(posInFileUL >= *extParmST->endPosUL)
-                 { /*If finshed all entries assigned to this thread*/
-                     free(buffCStr);
-                     freeBigNumStruct(&idBigNum);
-                     extParmST->retValUC = 1;
-                     pthread_exit(0);
-                 } /*If finshed all entries assigned to this thread*/
-             } /*If on the last buffer read in*/
-
+            entryCStr = nextCStr;
             continue;
-         } /*If is a read I am not printing out*/
+        } /*If is a read I am not printing out*/
 
-        /***************************************************************
-        * Fun-2 Sec-3 Sub-4: Keeping read, print out read
+        /**************************************************************\
+        * Fun-2 Sec-3 Sub-4: Keeping read, add it to the kept list
         \**************************************************************/
 
-         /*allow only one thread print fastq entries at a time*/
-         pthread_mutex_lock(&lockerMutex);
-
-         endOfFileC =
-             printFastqEntry(
-                 buffCStr,
-                 &readPosCStr,   /*Start of read name, wil hold end*/
-                 &startReadCStr, /*points to start of read name*/
-                 extParmST->lenBuffUI,
-                 &lenInputUL,
-                 extParmST->outFILE,
-                 extParmST->fqFILE
-         ); /*Print read & move to next read*/
-
-         /*Allow another thread to print out a fastq entry*/
-         pthread_mutex_unlock(&lockerMutex);
-
-         if(endOfFileC == 0)
-         { /*If ended to early*/
-             free(buffCStr);
-             freeBigNumStruct(&idBigNum);
-             extParmST->retValUC = 0;
-             pthread_exit(0);
-         } /*If ended to early*/
-
-         if(ftell(extParmST->fqFILE) >= *extParmST->endPosUL)
-         { /*If on the last buffer read in*/
-             /*Find the positoin in the file*/
-             posInFileUL =
-                 1 +                        /*Account for \n or @*/
-                 ftell(extParmST->fqFILE) - /*piont in file*/
-                 lenInputUL -              /*Number of bytes in buffer*/
-                 (readPosCStr - buffCStr);  /*byte of position on*/
-
-
-             if(posInFileUL >= *extParmST->endPosUL)
-             { /*If finshed all entries assigned to this thread*/
-                 free(buffCStr);
-                 freeBigNumStruct(&idBigNum);
-                 extParmST->retValUC = 1;
-                 pthread_exit(0);
-             } /*If finshed all entries assigned to this thread*/
-         } /*If on the last buffer read in*/
-    } /*While there are lines in the file*/
-
-    free(buffCStr);
+        if(
+              lastRunST != 0
+           && (char *) lastRunST->iov_base + lastRunST->iov_len
+               == entryCStr
+        ) { /*If this entry follows the last kept entry*/
+            lastRunST->iov_len += nextCStr - entryCStr;
+            entryCStr = nextCStr;
+            continue;
+        } /*If this entry follows the last kept entry*/
+
+        if(extParmST->numKeptUL >= extParmST->lenKeptUL)
+        { /*If need to make the kept list bigger*/
+            if(extParmST->lenKeptUL == 0)
+                extParmST->lenKeptUL = defMinKeptRuns;
+            else
+                extParmST->lenKeptUL <<= 1;
+
+            swapAryST =
+                realloc(
+                    extParmST->keptAryST,
+                    extParmST->lenKeptUL * sizeof(struct iovec)
+                );
+
+            if(swapAryST == 0)
+            { /*If had a memory allocation error*/
+                extParmST->retValUC = 64;
+                break;
+            } /*If had a memory allocation error*/
+
+            extParmST->keptAryST = swapAryST;
+        } /*If need to make the kept list bigger*/
+
+        lastRunST = extParmST->keptAryST + extParmST->numKeptUL;
+        lastRunST->iov_base = entryCStr;
+        lastRunST->iov_len = nextCStr - entryCStr;
+        ++extParmST->numKeptUL;
+
+        entryCStr = nextCStr;
+    } /*While there are entries in this threads chunk*/
+
     freeBigNumStruct(&idBigNum);
-    extParmST->retValUC = 1;
-    pthread_exit(0);
-} /*extractReadsInHash*/
+    return 0;
+} /*extractReadsThread*/
 
 /*---------------------------------------------------------------------\
 | Output:
-|   - Modifies:
-|     o lenFileUL in parmStruct to hold the file length
+|   - Returns:
+|     o Pointer to the start of the next fastq entry after entryCStr
+|       (endCStr if entryCStr is the last entry)
+|     o 0 if entryCStr is not a complete fastq entry
 \---------------------------------------------------------------------*/
-void * getFileLen(
-   void *parmST /*getFileLenStruct having file & return variable*/ 
-) /*Get the length of the file in parmStruct. Here for multi threading*/
-{ /*getFileLen*/
+char * nextFqEntry(
+    char *entryCStr, /*Start of the fastq entry (the '@')*/
+    char *endCStr    /*One byte past the end of the buffer*/
+) /*Finds the end of a fastq entry in a memory buffer*/
+{ /*nextFqEntry*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-3 TOC: Sec-1 Sub-1: getFileLen
+    ' Fun-3 TOC: nextFqEntry
+    '   - Sequences & q-scores can be on more than one line, so this
+    '     counts sequence bases & then reads q-score lines until it
+    '     has the same number of q-scores
+    '   o fun-3 sec-1: Variable declerations
+    '   o fun-3 sec-2: Move past the header & count sequence bases
+    '   o fun-3 sec-3: Move past the spacer & the q-score lines
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    struct getFileLenStruct *parmStruct =
-        (struct getFileLenStruct *) parmST;
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *posCStr = entryCStr;
+    char *lineEndCStr = 0;
+    uint64_t lenSeqUL = 0;
+    uint64_t lenQUL = 0;
+
+    if(posCStr >= endCStr || *posCStr != '@')
+        return 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-2: Move past the header & count sequence bases
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    posCStr = memchr(posCStr, '\n', endCStr - posCStr);
+
+    if(posCStr == 0)
+        return 0;  /*Entry is only a header*/
+
+    ++posCStr;
+
+    while(posCStr < endCStr && *posCStr != '+')
+    { /*Loop: Count the bases in the sequence lines*/
+        lineEndCStr = memchr(posCStr, '\n', endCStr - posCStr);
+
+        if(lineEndCStr == 0)
+            return 0;  /*File ends on a sequence line*/
+
+        lenSeqUL += lineEndCStr - posCStr;
+        lenSeqUL -= (lineEndCStr > posCStr && *(lineEndCStr-1) == '\r');
+        posCStr = lineEndCStr + 1;
+    } /*Loop: Count the bases in the sequence lines*/
+
+    if(posCStr >= endCStr)
+        return 0;  /*No spacer line*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-3: Move past the spacer & the q-score lines
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    posCStr = memchr(posCStr, '\n', endCStr - posCStr);
+
+    if(posCStr == 0)
+        return (lenSeqUL == 0) ? endCStr : 0; /*Spacer ends the file*/
+
+    ++posCStr;
+
+    if(lenSeqUL == 0)
+    { /*If this entry has no sequence*/
+        /*Skip the blank q-score line (if there is one)*/
+        if(posCStr < endCStr && *posCStr == '\n') ++posCStr;
+        return posCStr;
+    } /*If this entry has no sequence*/
+
+    while(lenQUL < lenSeqUL)
+    { /*Loop: Move past the q-score lines*/
+        if(posCStr >= endCStr)
+            return 0;  /*File ends before the q-score line ends*/
+
+        lineEndCStr = memchr(posCStr, '\n', endCStr - posCStr);
+
+        if(lineEndCStr == 0)
+            lineEndCStr = endCStr;  /*Last line has no new line*/
+
+        lenQUL += lineEndCStr - posCStr;
+        lenQUL -= (lineEndCStr > posCStr && *(lineEndCStr - 1) == '\r');
+        posCStr = lineEndCStr + (lineEndCStr < endCStr);
+    } /*Loop: Move past the q-score lines*/
 
-    fseek(parmStruct->inFILE, 0, SEEK_END);
-    parmStruct->lenFileUL = ftell(parmStruct->inFILE);
-    fseek(parmStruct->inFILE, 0, SEEK_SET);
+    if(lenQUL != lenSeqUL)
+        return 0;  /*Q-score & sequence lengths differ*/
 
-    pthread_exit(0);
-} /*getFileLen*/
+    return posCStr;
+} /*nextFqEntry*/
 
 /*---------------------------------------------------------------------\
 | Output:
 |   - Returns:
-|     o 1 if have more file to read into the buffer
-|     o 0 if read remaning part of file into buffer
-|   - Modifies:
-|     o startOfBuffCStr to piont to start of the next read
-|     o If neeed to read in more bytes, will modify buffCStr
-|     o lenInUL to hold the number of bytes read into buffCStr
-|     o extParmST->startPosUL to point to header of the next read
+|     o Pointer to the first fastq entry at or after posCStr
+|     o endCStr if there are no fastq entries after posCStr
 \---------------------------------------------------------------------*/
-unsigned char findStartPos(
-    char **buffCStr,             /*Pionts to the end of the buffer*/
-    char **startOfBuffCStr,      /*Pionts to the start of the buffer*/
-    uint64_t *lenInUL,           /*Number bytes read from fread*/
-    struct extReadsST *extParmST /*Holds parameters to use*/
-) /*Finds the next read after the starting position*/
-{ /*findStartPos*/
+char * findFqChunkStart(
+    char *posCStr,   /*Position to start searching at*/
+    char *startCStr, /*Start of the buffer (file)*/
+    char *endCStr    /*One byte past the end of the buffer*/
+) /*Finds the start of the next fastq entry in a memory buffer*/
+{ /*findFqChunkStart*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-4 TOC: findStarPos
-    '   o fun-4 sec-1: Variable declerations
-    '   o fun-4 sec-2: Find a point were I know I read past a header
-    '   o fun-4 sec-3: Update file location variables
+    ' Fun-4 TOC: Sec-1 Sub-1: findFqChunkStart
+    '   - q-score lines can start with '@', so a line starting with '@'
+    '     is only a header if it & the entry after it are complete
+    '     fastq entries
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-4 Sec-1: Variable declerations
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    char *nextCStr = 0;
 
-    uint64_t lastHeaderUL = 0; /*Postion of header to start at*/
-    unsigned long cntUL = *extParmST->startPosUL;
+    if(posCStr <= startCStr)
+        return startCStr;
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-4 Sec-2: Find a point were I know I have read past a header
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    /*Move to the start of the next line*/
+    --posCStr;
 
-    while(lastHeaderUL == 0)
-    { /*While I have to find the starting point*/
-        while(**startOfBuffCStr != ' ' || **startOfBuffCStr != '\t')
-        { /*While I have not found a new entry*/
-             if(**startOfBuffCStr == '+')
-             { /*If I may be on the spacer entry*/
-                 if(lastHeaderUL != 0 &&
-                    *(*startOfBuffCStr - 1) == '\n' &&
-                    *(*startOfBuffCStr + 1) == '\n'
-                 ) break; /*If on the spacer entry*/
-             } /*If I may be on the spacer entry*/
-
-             if(**startOfBuffCStr == '@')
-             { /*If this may be the header*/
-                 /*Check if I may have found a header*/
-                 if(*startOfBuffCStr != *buffCStr && 
-                    *(*startOfBuffCStr - 1) == '\n'
-                 ) { /*If I may have found the header line*/
-                     lastHeaderUL = cntUL;
-                     *extParmST->startPosUL = lastHeaderUL;
-                 } /*If I may have found the header line*/
-             } /*If this may be the header*/
-
-             if(**startOfBuffCStr == '\0')
-             { /*If need to read in more buffer*/
-                 *lenInUL =
-                     fread(
-                         *buffCStr,
-                         sizeof(char),
-                         extParmST->lenBuffUI,
-                         extParmST->fqFILE
-                 ); /*read in next part of file*/
-
-                 if(*lenInUL == 0)
-                 { /*If at the end of the file*/
-                     extParmST->retValUC = 2;
-                     return 0;
-                 } /*If at the end of the file*/
- 
-                 *startOfBuffCStr = *buffCStr;
-                 continue;
-             } /*If need to read in more buffer*/
-
-             /*Adjust start position so next read knows this reads end*/
-             ++cntUL;
-             ++(*startOfBuffCStr);
-        } /*While I have not found a new entry*/
-    } /*While I have to find the starting point*/
+    while(posCStr < endCStr)
+    { /*Loop: Check each line for a header*/
+        posCStr = memchr(posCStr, '\n', endCStr - posCStr);
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-4 Sec-3: Update file location variables
-    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-    
-    fseek(extParmST->fqFILE, lastHeaderUL, SEEK_SET);
-    *lenInUL = 
-        fread(
-            *buffCStr,
-            sizeof(char),
-            extParmST->lenBuffUI,
-            extParmST->fqFILE
-    ); /*re-read in the header*/
-
-    *startOfBuffCStr = *buffCStr;
-    *(*buffCStr + *lenInUL) = '\0';
-    /*Make sure the previous thread knows were to end*/
-    extParmST->retValUC = 1; /*So user knows succeded*/
+        if(posCStr == 0)
+            return endCStr;
+
+        ++posCStr;
+
+        if(posCStr >= endCStr || *posCStr != '@')
+            continue;
+
+        nextCStr = nextFqEntry(posCStr, endCStr);
+
+        if(nextCStr == 0)
+            continue;
+
+        if(nextCStr == endCStr || *nextCStr == '@')
+            return posCStr;
+    } /*Loop: Check each line for a header*/
+
+    return endCStr;
+} /*findFqChunkStart*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if wrote every kept entry
+|     o 2 if a write failed
+|   - Prints:
+|     o Kept entries from each thread (in thread order) to outFd
+\---------------------------------------------------------------------*/
+uint8_t writeKeptReads(
+    int outFd,                     /*File descriptor to write to*/
+    struct extReadsST *extAryST,   /*Kept entries for each thread*/
+    unsigned char threadsUC        /*Number of threads in extAryST*/
+) /*Writes the kept fastq entries from each thread in input order*/
+{ /*writeKeptReads*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: writeKeptReads
+    '   - writev can write less than asked, so the first iovec not
+    '     fully written is moved up & the rest of the batch resent
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct iovec *runAryST = 0;
+    unsigned long numRunsUL = 0;
+    int numIovI = 0;
+    ssize_t lenWroteSL = 0;
+
+    for(unsigned char ucThread = 0; ucThread < threadsUC; ++ucThread)
+    { /*Loop: Write out the kept entries from each thread*/
+        runAryST = extAryST[ucThread].keptAryST;
+        numRunsUL = extAryST[ucThread].numKeptUL;
+
+        while(numRunsUL > 0)
+        { /*Loop: Write out the runs in batches*/
+            numIovI =
+               numRunsUL > defMaxIovecs ? defMaxIovecs : (int) numRunsUL;
+
+            lenWroteSL = writev(outFd, runAryST, numIovI);
+
+            if(lenWroteSL < 0)
+                return 2;
+
+            while(numRunsUL > 0 && lenWroteSL >= runAryST->iov_len)
+            { /*Loop: Move past the runs that were fully written*/
+                lenWroteSL -= runAryST->iov_len;
+                ++runAryST;
+                --numRunsUL;
+            } /*Loop: Move past the runs that were fully written*/
+
+            if(lenWroteSL > 0)
+            { /*If only part of a run was written*/
+                runAryST->iov_base =
+                    (char *) runAryST->iov_base + lenWroteSL;
+                runAryST->iov_len -= lenWroteSL;
+            } /*If only part of a run was written*/
+        } /*Loop: Write out the runs in batches*/
+    } /*Loop: Write out the kept entries from each thread*/
 
     return 1;
-} /*findStartPos*/
+} /*writeKeptReads*/
@@ -1,48 +1,57 @@
 /*######################################################################
 # Name: fastqGrepSearchThread
 # Use:
-#    Extracts target reads from fastq file while using multiple threads
+#    Extracts target reads from fastq file while using multiple threads.
+#    The fastq file is memory mapped & split into chunks at fastq entry
+#    boundaries. Each thread keeps a list of kept entries, which are
+#    written out in input order with writev after all threads finish.
 # Requires:
 #    fastqGrepAVLTree
 #    fastqGrepStructs (called by fastqGrepAVLTree)
 #    fqGetIdsSearchFq (single thread version + some needed functions)
+# C standard (POSIX) includes:
+#    <pthread.h>
+#    <sys/mman.h>
+#    <sys/stat.h>
+#    <sys/uio.h>
+#    <unistd.h>
 ######################################################################*/
 
 #ifndef FQGREPSEARCHTHREAD_H
 #define FQGREPSEARCHTHREAD_H
 
-#include <pthread.h> /*For multi-threading*/
+#include <pthread.h>  /*For multi-threading*/
+#include <sys/mman.h> /*mmap & madvise*/
+#include <sys/stat.h> /*fstat (size of the fastq file)*/
+#include <sys/uio.h>  /*writev & struct iovec*/
+#include <unistd.h>   /*write*/
 #include "fqGetIdsSearchFq.h"
 
-/*---------------------------------------------------------------------\
-| Struct-1: getFileLenStruct
-|   o Here so that I can get the file length when using multiple threads
-\---------------------------------------------------------------------*/
-typedef struct getFileLenStruct
-{ /*getFileLenStruct*/
-    unsigned long lenFileUL;
-    FILE *inFILE;
-}getFileLenStruct;
+#define defMinKeptRuns 1024  /*Starting size of a threads kept list*/
+#define defMaxIovecs 1024    /*Max iovecs to give writev at once*/
 
 /*---------------------------------------------------------------------\
-| Struct-2: extReadsST
+| Struct-1: extReadsST
 |   o Structer to hold parameters for a multithread read extract
 \---------------------------------------------------------------------*/
 typedef struct extReadsST
 { /*extReadsST*/
     uint8_t retValUC;        /*Function error out state*/
-    unsigned long *endPosUL; /*Point to end read extraction at*/
-    unsigned long *startPosUL; /*Point to start read extraction at*/
-    uint32_t lenBuffUI;  /*size of buffer to create*/
+    char *startCStr;         /*First fastq entry in this threads chunk*/
+    char *endCStr;           /*One byte past the end of the chunk*/
     unsigned long majicNumUL; /*Magic number for kunths multiply hash*/
     uint8_t digPerKeyUC;   /*Digits needed to get a key*/
     uint8_t printNonMatchBl; /*1: print non-match, 0: print match*/
 
     struct readInfo *readTree;  /*For AVL search (hashTbl == 0)*/
     struct readInfo **hashTbl;  /*Hash table to search for ids in*/
+    struct idFpHash *fpHashST;  /*Fingerprint table (0 to not use)*/
 
-    FILE *fqFILE;
-    FILE *outFILE;
+    /*Kept fastq entries. These point into the mapped file, with
+      entries next to each other merged into one run*/
+    struct iovec *keptAryST;
+    unsigned long numKeptUL;    /*Number of runs in keptAryST*/
+    unsigned long lenKeptUL;    /*Size of keptAryST*/
 }extReadsST;
 
 
@@ -50,10 +59,13 @@ typedef struct extReadsST
 | Output:
 |   - Stdout: Prints out kept reads
 |   - Returns:
+|     o 0 if the fastq file is not valid
+|     o 1 for success
 |     o 2 if invalid filter file
 |     o 4 if invalid input fastq file
 |     o 8 if could not open the output file
 |     o 16 if both filter and fastq file coming from stdin
+|     o 64 for memory allocation errors
 \---------------------------------------------------------------------*/
 uint8_t fastqThreadExtract(
     char *filtPathCStr,        /*Path to file with read ids to extract*/
@@ -62,44 +74,60 @@ uint8_t fastqThreadExtract(
     unsigned char threadsUC,   /*Number of threads to use*/
     uint8_t sizeReadStackUC,   /*Number of elements to use in stack*/
     uint32_t lenBuffUI,        /*Size of buffer to read input with*/
-    uint8_t hashSearchC,    /*1: do hash search, 0: do Tree search*/
+    uint8_t hashSearchC,    /*2: fingerprint hash, 1: hash search,
+                              0: do Tree search*/
     uint8_t printReverseC   /*1: Keep reads in filter file
                                  0: ingore reads in filter file*/
 ); /*Searches and extracts reads from a fastq file using read id's*/
 
 /*---------------------------------------------------------------------\
 | Output:
-|    stdout: Prints out reads in hash table
+|   - Modifies:
+|     o keptAryST, numKeptUL, & lenKeptUL in parmST to hold the
+|       fastq entries to print out
+|     o retValUC in parmST to be 1 for success, 0 for an invalid
+|       fastq entry, & 64 for memory allocation errors
 \---------------------------------------------------------------------*/
 void * extractReadsThread(
     void *parmST /*extReadsST Structer with parameters*/
-); /*Extract target reads from fastq file with hash table or tree*/
+); /*Extract target reads from a mapped fastq chunk*/
 
 /*---------------------------------------------------------------------\
 | Output:
-|   - Modifies:
-|     o lenFileUL in parmStruct to hold the file length
+|   - Returns:
+|     o Pointer to the start of the next fastq entry after entryCStr
+|       (endCStr if entryCStr is the last entry)
+|     o 0 if entryCStr is not a complete fastq entry
 \---------------------------------------------------------------------*/
-void * getFileLen(
-   void *parmStruct /*Holds file & return varaibles*/ 
-); /*Get the length of the file in parmStruct. Here for multi threading*/
+char * nextFqEntry(
+    char *entryCStr, /*Start of the fastq entry (the '@')*/
+    char *endCStr    /*One byte past the end of the buffer*/
+); /*Finds the end of a fastq entry in a memory buffer*/
 
 /*---------------------------------------------------------------------\
 | Output:
 |   - Returns:
-|     o 1 if have more file to read into the buffer
-|     o 0 if read remaning part of file into buffer
-|   - Modifies:
-|     o startOfBuffCStr to piont to start of the next read
-|     o If neeed to read in more bytes, will modify buffCStr
-|     o lenInUL to hold the number of bytes read into buffCStr
-|     o extParmST->startPosUL to point to header of the next read
+|     o Pointer to the first fastq entry at or after posCStr
+|     o endCStr if there are no fastq entries after posCStr
+\---------------------------------------------------------------------*/
+char * findFqChunkStart(
+    char *posCStr,   /*Position to start searching at*/
+    char *startCStr, /*Start of the buffer (file)*/
+    char *endCStr    /*One byte past the end of the buffer*/
+); /*Finds the start of the next fastq entry in a memory buffer*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if wrote every kept entry
+|     o 2 if a write failed
+|   - Prints:
+|     o Kept entries from each thread (in thread order) to outFd
 \---------------------------------------------------------------------*/
-unsigned char findStartPos(
-    char **buffCStr,             /*Pionts to the end of the buffer*/
-    char **startOfBuffCStr,      /*Pionts to the start of the buffer*/
-    uint64_t *lenInUL,           /*Number bytes read from fread*/
-    struct extReadsST *extParmST /*Holds parameters to use*/
-); /*Finds the next read after the starting position*/
+uint8_t writeKeptReads(
+    int outFd,                     /*File descriptor to write to*/
+    struct extReadsST *extAryST,   /*Kept entries for each thread*/
+    unsigned char threadsUC        /*Number of threads in extAryST*/
+); /*Writes the kept fastq entries from each thread in input order*/
 
 #endif
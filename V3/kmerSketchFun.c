@@ -0,0 +1,333 @@
+/*######################################################################
+# Use:
+#   o Holds functions to sketch consensuses (smallest k-mer hashes) &
+#     to estimate how different two consensuses are from their sketches
+######################################################################*/
+
+#include "kmerSketchFun.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF TOC: Start of Functions
+'   o fun-1 blankKmerSketch:
+'     - Sets a kmerSketch structure to an empty sketch
+'   o fun-2 addHashToSketch:
+'     - Adds a k-mer hash to a sketch, if it is small enough
+'   o fun-3 sketchFaFile:
+'     - Sketches the first sequence in a fasta file
+'   o fun-4 cmpKmerSketch:
+'     - Checks if two sketches could be under a percent difference
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o sketchST to be an empty sketch
+\---------------------------------------------------------------------*/
+void blankKmerSketch(
+    struct kmerSketch *sketchST /*Sketch to blank*/
+) /*Sets a kmerSketch structure to an empty sketch*/
+{ /*blankKmerSketch*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: Sec-1 Sub-1: blankKmerSketch
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    sketchST->lenSketchUI = 0;
+    sketchST->numKmerUI = 0;
+} /*blankKmerSketch*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o sketchST to have hashUI, if it is one of the smallest
+|          hashes (duplicates are ignored)
+\---------------------------------------------------------------------*/
+void addHashToSketch(
+    uint32_t hashUI,            /*Hash of the k-mer to add*/
+    struct kmerSketch *sketchST /*Sketch to add the hash to*/
+) /*Adds a k-mer hash to a sketch, if it is small enough*/
+{ /*addHashToSketch*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: addHashToSketch
+    '   fun-2 sec-1: Variable declerations
+    '   fun-2 sec-2: Find where the hash goes in the sketch
+    '   fun-2 sec-3: Insert the hash
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t firstUI = 0;
+    uint32_t lastUI = sketchST->lenSketchUI;
+    uint32_t midUI = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-2: Find where the hash goes in the sketch
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(
+          sketchST->lenSketchUI == defSketchSizeUI
+       && hashUI >= sketchST->hashAryUI[defSketchSizeUI - 1]
+    ) return; /*Hash is larger than all kept hashes*/
+
+    while(firstUI < lastUI)
+    { /*While searching for the first larger or equal hash*/
+        midUI = (firstUI + lastUI) >> 1;
+
+        if(sketchST->hashAryUI[midUI] < hashUI)
+            firstUI = midUI + 1;
+        else
+            lastUI = midUI;
+    } /*While searching for the first larger or equal hash*/
+
+    if(
+          firstUI < sketchST->lenSketchUI
+       && sketchST->hashAryUI[firstUI] == hashUI
+    ) return; /*Already have this k-mer*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-3: Insert the hash
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(sketchST->lenSketchUI < defSketchSizeUI)
+        ++sketchST->lenSketchUI; /*Else the largest hash is dropped*/
+
+    for(uint32_t uiHash = sketchST->lenSketchUI - 1; uiHash > firstUI;
+        --uiHash
+    ) sketchST->hashAryUI[uiHash] = sketchST->hashAryUI[uiHash - 1];
+
+    sketchST->hashAryUI[firstUI] = hashUI;
+} /*addHashToSketch*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if sketched the sequence
+|        o 2 if could not open the fasta file
+|    - Modifies:
+|        o sketchST to have the sketch of the first sequence in the
+|          fasta file (empty sketch for errors)
+\---------------------------------------------------------------------*/
+uint8_t sketchFaFile(
+    char *faPathCStr,           /*Fasta file with the consensus*/
+    struct kmerSketch *sketchST /*Gets the sketch*/
+) /*Sketches the first sequence in a fasta file*/
+{ /*sketchFaFile*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: sketchFaFile
+    '   fun-3 sec-1: Variable declerations
+    '   fun-3 sec-2: Open the fasta file
+    '   fun-3 sec-3: Hash each k-mer in the first sequence
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t maskULng = (((uint64_t) 1) << (defSketchKmerUC << 1)) - 1;
+    uint8_t shiftUC = (defSketchKmerUC - 1) << 1;
+    uint64_t forKmerULng = 0;  /*Forward k-mer*/
+    uint64_t revKmerULng = 0;  /*Reverse complement k-mer*/
+    uint64_t keyULng = 0;
+    uint64_t baseULng = 0;
+    uint32_t lenKmerUI = 0;    /*Number of valid bases in the k-mer*/
+
+    char buffCStr[4096];
+    unsigned long lenBuffUL = 0;
+    char headerBl = 0;         /*1: On a header line*/
+    char seqBl = 0;            /*1: Past the first header*/
+    char doneBl = 0;           /*1: Hit the second sequence*/
+
+    FILE *faFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-2: Open the fasta file
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    blankKmerSketch(sketchST);
+    faFILE = fopen(faPathCStr, "r");
+
+    if(faFILE == 0)
+        return 2;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-3: Hash each k-mer in the first sequence
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    lenBuffUL = fread(buffCStr, sizeof(char), 4096, faFILE);
+
+    while(lenBuffUL > 0 && !doneBl)
+    { /*Loop: Read in the fasta file*/
+        for(unsigned long ulChar = 0; ulChar < lenBuffUL; ++ulChar)
+        { /*Loop: Hash each k-mer in the buffer*/
+            if(buffCStr[ulChar] == '>')
+            { /*If on a header*/
+                if(seqBl)
+                { /*If on the next sequence*/
+                    doneBl = 1;
+                    break;
+                } /*If on the next sequence*/
+
+                headerBl = 1;
+                seqBl = 1;
+                continue;
+            } /*If on a header*/
+
+            if(headerBl)
+            { /*If on a header*/
+                headerBl = buffCStr[ulChar] != '\n';
+                continue;
+            } /*If on a header*/
+
+            switch(buffCStr[ulChar] & ~32)
+            { /*Switch: Convert the base to two bits*/
+                case 'A': baseULng = 0; break;
+                case 'C': baseULng = 1; break;
+                case 'G': baseULng = 2; break;
+                case 'T': baseULng = 3; break;
+                case 'U': baseULng = 3; break;
+                default:  baseULng = 4; break;
+            } /*Switch: Convert the base to two bits*/
+
+            if(baseULng > 3)
+            { /*If not a base*/
+                if(buffCStr[ulChar] > 32)
+                    lenKmerUI = 0; /*Anonymous bases end the k-mer*/
+
+                continue; /*White space is ignored*/
+            } /*If not a base*/
+
+            forKmerULng = ((forKmerULng << 2) | baseULng) & maskULng;
+            revKmerULng =
+                (revKmerULng >> 2) | ((3 ^ baseULng) << shiftUC);
+            ++lenKmerUI;
+
+            if(lenKmerUI < defSketchKmerUC)
+                continue; /*Do not have a full k-mer yet*/
+
+            /*Hash the canonical k-mer (minimap2 hash64)*/
+            keyULng =
+                revKmerULng < forKmerULng ? revKmerULng : forKmerULng;
+
+            keyULng = (~keyULng + (keyULng << 21)) & maskULng;
+            keyULng = keyULng ^ keyULng >> 24;
+            keyULng = ((keyULng + (keyULng << 3)) + (keyULng << 8));
+            keyULng &= maskULng;
+            keyULng = keyULng ^ keyULng >> 14;
+            keyULng = ((keyULng + (keyULng << 2)) + (keyULng << 4));
+            keyULng &= maskULng;
+            keyULng = keyULng ^ keyULng >> 28;
+            keyULng = (keyULng + (keyULng << 31)) & maskULng;
+
+            ++sketchST->numKmerUI;
+            addHashToSketch((uint32_t) keyULng, sketchST);
+        } /*Loop: Hash each k-mer in the buffer*/
+
+        if(!doneBl)
+            lenBuffUL = fread(buffCStr, sizeof(char), 4096, faFILE);
+    } /*Loop: Read in the fasta file*/
+
+    fclose(faFILE);
+    return 1;
+} /*sketchFaFile*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the sequences could be under maxDiffF different (or
+|          one of the sketches is empty)
+|        o 0 if the sequences are estimated to be over maxDiffF
+|          different
+\---------------------------------------------------------------------*/
+uint8_t cmpKmerSketch(
+    struct kmerSketch *firstSketch,  /*First sketch to compare*/
+    struct kmerSketch *secSketch,    /*Second sketch to compare*/
+    float maxDiffF                   /*Max difference to keep a pair*/
+) /*Checks if two sketches could be under a percent difference*/
+{ /*cmpKmerSketch*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: cmpKmerSketch
+    '   fun-4 sec-1: Variable declerations
+    '   fun-4 sec-2: Find the shared hashes in the smallest hashes
+    '   fun-4 sec-3: Estimate the containment & compare to the cutoff
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t sizeUI = firstSketch->lenSketchUI;
+    uint32_t firstUI = 0;
+    uint32_t secUI = 0;
+    uint32_t numUnionUI = 0;   /*Smallest hashes in the union seen*/
+    uint32_t numSharedUI = 0;  /*Smallest hashes in both sketches*/
+    uint32_t firstHashUI = 0;
+    uint32_t secHashUI = 0;
+    uint32_t minKmerUI = firstSketch->numKmerUI;
+
+    float jaccardF = 0;
+    float containF = 0;
+    float cutoffF = 1;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Find the shared hashes in the smallest hashes
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(firstSketch->lenSketchUI == 0 || secSketch->lenSketchUI == 0)
+        return 1; /*Can not tell, so need to compare the sequences*/
+
+    if(maxDiffF >= 1)
+        return 1; /*Every pair is kept*/
+
+    if(secSketch->lenSketchUI < sizeUI)
+        sizeUI = secSketch->lenSketchUI;
+
+    if(secSketch->numKmerUI < minKmerUI)
+        minKmerUI = secSketch->numKmerUI;
+
+    while(
+          numUnionUI < sizeUI
+       && firstUI < firstSketch->lenSketchUI
+       && secUI < secSketch->lenSketchUI
+    ) { /*While have smallest hashes in the union to check*/
+        firstHashUI = firstSketch->hashAryUI[firstUI];
+        secHashUI = secSketch->hashAryUI[secUI];
+
+        if(firstHashUI == secHashUI)
+        { /*If both sketches have the hash*/
+            ++numSharedUI;
+            ++firstUI;
+            ++secUI;
+        } /*If both sketches have the hash*/
+
+        else if(firstHashUI < secHashUI)
+            ++firstUI;
+
+        else
+            ++secUI;
+
+        ++numUnionUI;
+    } /*While have smallest hashes in the union to check*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-3: Estimate the containment & compare to the cutoff
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*The union has (first + second) / (1 + jaccard) k-mers, so the
+      shorter sequence shares jaccard * union / shorter of its k-mers*/
+    jaccardF = numSharedUI / (float) numUnionUI;
+
+    containF =
+          jaccardF
+        * (firstSketch->numKmerUI + (float) secSketch->numKmerUI)
+        / ((1 + jaccardF) * minKmerUI);
+
+    for(uint32_t uiBase = 0; uiBase < defSketchKmerUC; ++uiBase)
+        cutoffF *= 1 - maxDiffF; /*Chance a k-mer has no differences*/
+
+    return containF >= cutoffF;
+} /*cmpKmerSketch*/
@@ -0,0 +1,102 @@
+/*######################################################################
+# Use:
+#   o Holds the kmerSketch structure & functions to sketch a consensus
+#     (smallest k-mer hashes) & to estimate how different two
+#     consensuses are from their sketches
+# Note:
+#   o The sketches are used to skip consensus pairs that are to
+#     different to be merged, before mapping them to each other
+#   o k-mers are canonical, so the sketch does not depend on strand
+# C standard libraries:
+#   - <stdio.h>
+#   - <stdint.h>
+######################################################################*/
+
+#ifndef KMERSKETCHFUN_H
+#define KMERSKETCHFUN_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "defaultSettings.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' kmerSketchFun SOH: Start Of Header
+'   o st-1 kmerSketch:
+'     - Holds the smallest k-mer hashes in a sequence
+'   o fun-1 blankKmerSketch:
+'     - Sets a kmerSketch structure to an empty sketch
+'   o fun-2 addHashToSketch:
+'     - Adds a k-mer hash to a sketch, if it is small enough
+'   o fun-3 sketchFaFile:
+'     - Sketches the first sequence in a fasta file
+'   o fun-4 cmpKmerSketch:
+'     - Checks if two sketches could be under a percent difference
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: kmerSketch
+| Use:
+|   - Holds the defSketchSizeUI smallest canonical k-mer hashes in a
+|     sequence (bottom sketch), sorted from smallest to largest
+\---------------------------------------------------------------------*/
+typedef struct kmerSketch
+{ /*kmerSketch*/
+    uint32_t hashAryUI[defSketchSizeUI]; /*Smallest hashes (sorted)*/
+    uint32_t lenSketchUI; /*Number of hashes in hashAryUI*/
+    uint32_t numKmerUI;   /*Number of k-mers in the sequence*/
+}kmerSketch;
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o sketchST to be an empty sketch
+\---------------------------------------------------------------------*/
+void blankKmerSketch(
+    struct kmerSketch *sketchST /*Sketch to blank*/
+); /*Sets a kmerSketch structure to an empty sketch*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o sketchST to have hashUI, if it is one of the smallest
+|          hashes (duplicates are ignored)
+\---------------------------------------------------------------------*/
+void addHashToSketch(
+    uint32_t hashUI,            /*Hash of the k-mer to add*/
+    struct kmerSketch *sketchST /*Sketch to add the hash to*/
+); /*Adds a k-mer hash to a sketch, if it is small enough*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if sketched the sequence
+|        o 2 if could not open the fasta file
+|    - Modifies:
+|        o sketchST to have the sketch of the first sequence in the
+|          fasta file (empty sketch for errors)
+\---------------------------------------------------------------------*/
+uint8_t sketchFaFile(
+    char *faPathCStr,           /*Fasta file with the consensus*/
+    struct kmerSketch *sketchST /*Gets the sketch*/
+); /*Sketches the first sequence in a fasta file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if the sequences could be under maxDiffF different (or
+|          one of the sketches is empty)
+|        o 0 if the sequences are estimated to be over maxDiffF
+|          different
+| Note:
+|    - The estimate is the fraction of the shorter sequences k-mers
+|      that are in the longer sequence (containment). For independent
+|      errors this is (1 - difference)^k, so alignments that only
+|      cover part of the longer sequence are not skipped
+\---------------------------------------------------------------------*/
+uint8_t cmpKmerSketch(
+    struct kmerSketch *firstSketch,  /*First sketch to compare*/
+    struct kmerSketch *secSketch,    /*Second sketch to compare*/
+    float maxDiffF                   /*Max difference to keep a pair*/
+); /*Checks if two sketches could be under a percent difference*/
+
+#endif
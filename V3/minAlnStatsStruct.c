@@ -68,6 +68,9 @@ void blankMinStats(
     minStats->minInssFlt = readRefMinPercInss;
     minStats->minIndelsFlt = readRefMinPercIndels;
     minStats->minDiffFlt = readRefMinPercDiff;
+    minStats->inMapBl = defInMapBl; /*1: Use built in mapper*/
+    minStats->pairAlnBl = defPairAlnBl; /*1: Score with the aligner*/
+    minStats->sketchMarginFlt = defSketchMarginF; /*cmpCons skips*/
     return;
 } /*blankMinStats*/
 
@@ -130,6 +133,9 @@ void blankMinStatsReadRead(
     minStats->minInssFlt = readReadMinPercInss;
     minStats->minIndelsFlt = readReadMinPercIndels;
     minStats->minDiffFlt = readReadMinPercDiff;
+    minStats->inMapBl = defInMapBl; /*1: Use built in mapper*/
+    minStats->pairAlnBl = defPairAlnBl; /*1: Score with the aligner*/
+    minStats->sketchMarginFlt = defSketchMarginF; /*cmpCons skips*/
     return;
 } /*blankMinStatsReadRead*/
 
@@ -192,6 +198,9 @@ void blankMinStatsReadCon(
     minStats->minInssFlt = readConMinPercInss;
     minStats->minIndelsFlt = readConMinPercIndels;
     minStats->minDiffFlt = readConMinPercDiff;
+    minStats->inMapBl = defInMapBl; /*1: Use built in mapper*/
+    minStats->pairAlnBl = defPairAlnBl; /*1: Score with the aligner*/
+    minStats->sketchMarginFlt = defSketchMarginF; /*cmpCons skips*/
     return;
 } /*blankMinStatsReadCon*/
 
@@ -254,6 +263,9 @@ void blankMinStatsConCon(
     minStats->minInssFlt = conConMinPercInss;
     minStats->minIndelsFlt = conConMinPercIndels;
     minStats->minDiffFlt = conConMinPercDiff;
+    minStats->inMapBl = defInMapBl; /*1: Use built in mapper*/
+    minStats->pairAlnBl = defPairAlnBl; /*1: Score with the aligner*/
+    minStats->sketchMarginFlt = defSketchMarginF; /*cmpCons skips*/
     return;
 } /*blankMinStatsConCon*/
 
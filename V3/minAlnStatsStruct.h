@@ -41,6 +41,11 @@ typedef struct minAlnStats
      float minInssFlt;
      float minIndelsFlt;
      float minDiffFlt;
+     char inMapBl; /*1: Map with the built in mapper, not minimap2*/
+     char pairAlnBl; /*1: Score with the pairwise aligner*/
+     float sketchMarginFlt;
+       /*cmpCons skips consensuses with a k-mer sketch difference
+         over minDiffFlt + sketchMarginFlt*/
 }minAlnStats; /*minAlnStats structer*/
 
 /*######################################################################
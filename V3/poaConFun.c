@@ -0,0 +1,1237 @@
+/*######################################################################
+# Name: poaConFun
+# Use:
+#   o Builds a consensus with partial order alignment (POA). The reads
+#     are aligned one at a time to a graph started from the best read
+#     (or last consensus) & the consensus is the heaviest path in the
+#     graph.
+# Includes:
+#   - "readMapFun.h"
+#   o "samEntryStruct.h"
+#   o "defaultSettings.h"
+#   o "fqAndFaFun.h"
+# C standard includes:
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' poaConFun SOF: Start Of Functions
+'  - fun-1 initPoaGraph:
+'    o Sets a poaGraph to have no nodes & no buffers
+'  - fun-2 freePoaGraph:
+'    o Frees the nodes, edges, & buffers in a poaGraph
+'  - fun-3 poaAddNode:
+'    o Adds a node to a poaGraph
+'  - fun-4 poaAddEdge:
+'    o Adds an edge (or a sequence to an edge) in a poaGraph
+'  - fun-5 poaSortGraph:
+'    o Sorts the nodes in a poaGraph into topological order
+'  - fun-6 poaSeqToGraph:
+'    o Starts a poaGraph with a backbone sequence
+'  - fun-7 poaAlignSeq:
+'    o Does a banded alignment of a sequence to a poaGraph
+'  - fun-8 poaAddAln:
+'    o Adds an aligned sequence to a poaGraph
+'  - fun-9 poaGetCon:
+'    o Gets the heaviest path (consensus) in a poaGraph
+'  - fun-10 poaGetBbMinz:
+'    o Gets the backbone minimizers that are only in the backbone once
+'  - fun-11 cmpPoaDiag:
+'    o qsort compare function for the diagonals in poaReadDiag
+'  - fun-12 poaReadDiag:
+'    o Finds the strand & diagonal of a read on the backbone
+'  - fun-13 poaRevCompSeq:
+'    o Reverse complements a sequence in place
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "poaConFun.h"
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: graphST to have no nodes, edges, or buffers
+\---------------------------------------------------------------------*/
+void initPoaGraph(
+    struct poaGraph *graphST /*Graph to initialize*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-1 TOC: Sec-1 Sub-1: initPoaGraph
+   '  - Sets a poaGraph to have no nodes & no buffers
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    graphST->baseAryC = 0;
+    graphST->weightAryUI = 0;
+    graphST->posAryUI = 0;
+    graphST->alnAryUI = 0;
+    graphST->firstInAryUI = 0;
+    graphST->firstOutAryUI = 0;
+    graphST->rankAryUI = 0;
+    graphST->orderAryUI = 0;
+    graphST->loAryL = 0;
+    graphST->conScoreAryL = 0;
+    graphST->conPredAryUI = 0;
+    graphST->numNodesUI = 0;
+    graphST->lenNodesUI = 0;
+
+    graphST->fromAryUI = 0;
+    graphST->toAryUI = 0;
+    graphST->edgeWeightAryUI = 0;
+    graphST->nextInAryUI = 0;
+    graphST->nextOutAryUI = 0;
+    graphST->numEdgesUI = 0;
+    graphST->lenEdgesUI = 0;
+
+    graphST->numSeqUI = 0;
+
+    graphST->scoreAryI = 0;
+    graphST->lenScoreUL = 0;
+    graphST->pathNodeAryUI = 0;
+    graphST->pathSeqAryL = 0;
+    graphST->numPathUI = 0;
+    graphST->lenPathUI = 0;
+
+    return;
+} /*initPoaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: every array in graphST & then initializes graphST
+\---------------------------------------------------------------------*/
+void freePoaGraph(
+    struct poaGraph *graphST /*Graph to free*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-2 TOC: Sec-1 Sub-1: freePoaGraph
+   '  - Frees the nodes, edges, & buffers in a poaGraph
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(graphST->baseAryC);
+    free(graphST->weightAryUI);
+    free(graphST->posAryUI);
+    free(graphST->alnAryUI);
+    free(graphST->firstInAryUI);
+    free(graphST->firstOutAryUI);
+    free(graphST->rankAryUI);
+    free(graphST->orderAryUI);
+    free(graphST->loAryL);
+    free(graphST->conScoreAryL);
+    free(graphST->conPredAryUI);
+
+    free(graphST->fromAryUI);
+    free(graphST->toAryUI);
+    free(graphST->edgeWeightAryUI);
+    free(graphST->nextInAryUI);
+    free(graphST->nextOutAryUI);
+
+    free(graphST->scoreAryI);
+    free(graphST->pathNodeAryUI);
+    free(graphST->pathSeqAryL);
+
+    initPoaGraph(graphST);
+    return;
+} /*freePoaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Index of the new node
+|        o defPoaNoNodeUI for memory allocation errors
+|    - Modifies:
+|        o The node arrays in graphST (resized if to small)
+\---------------------------------------------------------------------*/
+uint32_t poaAddNode(
+    struct poaGraph *graphST, /*Graph to add the node to*/
+    char baseC,               /*Base in the node*/
+    uint32_t posUI            /*Backbone position of the node*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-3 TOC: poaAddNode
+   '  - Adds a node to a poaGraph
+   '  o fun-3 sec-1: Make room for the node if needed
+   '  o fun-3 sec-2: Add the node
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-1: Make room for the node if needed
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t nodeUI = graphST->numNodesUI;
+    uint32_t lenUI = graphST->lenNodesUI << 1;
+    void *tmpPtr = 0;
+
+    if(nodeUI >= graphST->lenNodesUI)
+    { /*If need more room for nodes*/
+        if(lenUI < defPoaMinNodesUI)
+            lenUI = defPoaMinNodesUI;
+
+        /*Each array is kept when its realloc works, so a failed realloc
+          only leaves some arrays larger then lenNodesUI*/
+        tmpPtr = realloc(graphST->baseAryC, lenUI * sizeof(char));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->baseAryC = tmpPtr;
+
+        tmpPtr = realloc(graphST->weightAryUI, lenUI*sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->weightAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->posAryUI, lenUI * sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->posAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->alnAryUI, lenUI * sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->alnAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->firstInAryUI, lenUI*sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->firstInAryUI = tmpPtr;
+
+        tmpPtr= realloc(graphST->firstOutAryUI, lenUI*sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->firstOutAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->rankAryUI, lenUI * sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->rankAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->orderAryUI, lenUI * sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->orderAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->loAryL, lenUI * sizeof(long));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->loAryL = tmpPtr;
+
+        tmpPtr = realloc(graphST->conScoreAryL, lenUI * sizeof(long));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->conScoreAryL = tmpPtr;
+
+        tmpPtr = realloc(graphST->conPredAryUI, lenUI*sizeof(uint32_t));
+        if(tmpPtr == 0) return defPoaNoNodeUI;
+        graphST->conPredAryUI = tmpPtr;
+
+        graphST->lenNodesUI = lenUI;
+    } /*If need more room for nodes*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-2: Add the node
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    graphST->baseAryC[nodeUI] = baseC & ~32; /*Keep bases upper case*/
+    graphST->weightAryUI[nodeUI] = 0;
+    graphST->posAryUI[nodeUI] = posUI;
+    graphST->alnAryUI[nodeUI] = nodeUI; /*Only node in its ring*/
+    graphST->firstInAryUI[nodeUI] = defPoaNoNodeUI;
+    graphST->firstOutAryUI[nodeUI] = defPoaNoNodeUI;
+
+    ++graphST->numNodesUI;
+    return nodeUI;
+} /*poaAddNode*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if added the edge or added one to an old edges weight
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o The edge arrays in graphST (resized if to small)
+\---------------------------------------------------------------------*/
+uint8_t poaAddEdge(
+    struct poaGraph *graphST, /*Graph to add the edge to*/
+    uint32_t fromUI,          /*Node the edge starts at*/
+    uint32_t toUI             /*Node the edge ends at*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-4 TOC: poaAddEdge
+   '  - Adds an edge (or a sequence to an edge) in a poaGraph
+   '  o fun-4 sec-1: Check if the edge is already in the graph
+   '  o fun-4 sec-2: Make room for the edge if needed
+   '  o fun-4 sec-3: Add the edge
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Check if the edge is already in the graph
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t edgeUI = graphST->firstOutAryUI[fromUI];
+    uint32_t lenUI = graphST->lenEdgesUI << 1;
+    void *tmpPtr = 0;
+
+    while(edgeUI != defPoaNoNodeUI)
+    { /*Loop: Check the edges out of fromUI*/
+        if(graphST->toAryUI[edgeUI] == toUI)
+        { /*If already have the edge*/
+            ++graphST->edgeWeightAryUI[edgeUI];
+            return 1;
+        } /*If already have the edge*/
+
+        edgeUI = graphST->nextOutAryUI[edgeUI];
+    } /*Loop: Check the edges out of fromUI*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Make room for the edge if needed
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    edgeUI = graphST->numEdgesUI;
+
+    if(edgeUI >= graphST->lenEdgesUI)
+    { /*If need more room for edges*/
+        if(lenUI < defPoaMinNodesUI)
+            lenUI = defPoaMinNodesUI;
+
+        tmpPtr = realloc(graphST->fromAryUI, lenUI * sizeof(uint32_t));
+        if(tmpPtr == 0) return 64;
+        graphST->fromAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->toAryUI, lenUI * sizeof(uint32_t));
+        if(tmpPtr == 0) return 64;
+        graphST->toAryUI = tmpPtr;
+
+        tmpPtr =
+            realloc(graphST->edgeWeightAryUI, lenUI * sizeof(uint32_t));
+        if(tmpPtr == 0) return 64;
+        graphST->edgeWeightAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->nextInAryUI, lenUI*sizeof(uint32_t));
+        if(tmpPtr == 0) return 64;
+        graphST->nextInAryUI = tmpPtr;
+
+        tmpPtr = realloc(graphST->nextOutAryUI, lenUI*sizeof(uint32_t));
+        if(tmpPtr == 0) return 64;
+        graphST->nextOutAryUI = tmpPtr;
+
+        graphST->lenEdgesUI = lenUI;
+    } /*If need more room for edges*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-3: Add the edge
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    graphST->fromAryUI[edgeUI] = fromUI;
+    graphST->toAryUI[edgeUI] = toUI;
+    graphST->edgeWeightAryUI[edgeUI] = 1;
+
+    graphST->nextOutAryUI[edgeUI] = graphST->firstOutAryUI[fromUI];
+    graphST->firstOutAryUI[fromUI] = edgeUI;
+
+    graphST->nextInAryUI[edgeUI] = graphST->firstInAryUI[toUI];
+    graphST->firstInAryUI[toUI] = edgeUI;
+
+    ++graphST->numEdgesUI;
+    return 1;
+} /*poaAddEdge*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if sorted the graph
+|        o 2 if the graph has a cycle
+|    - Modifies:
+|        o orderAryUI & rankAryUI in graphST
+\---------------------------------------------------------------------*/
+uint8_t poaSortGraph(
+    struct poaGraph *graphST /*Graph to sort*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-5 TOC: poaSortGraph
+   '  - Sorts the nodes in a poaGraph into topological order (Kahn's
+   '    algorithm)
+   '  o fun-5 sec-1: Count the edges into each node
+   '  o fun-5 sec-2: Add nodes after all the nodes before them are in
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-1: Count the edges into each node
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t numOrderUI = 0;
+    uint32_t nodeUI = 0;
+    uint32_t edgeUI = 0;
+    uint32_t *rankAryUI = graphST->rankAryUI; /*Edges left until sort*/
+
+    for(uint32_t uiNode = 0; uiNode < graphST->numNodesUI; ++uiNode)
+        rankAryUI[uiNode] = 0;
+
+    for(uint32_t uiEdge = 0; uiEdge < graphST->numEdgesUI; ++uiEdge)
+        ++rankAryUI[graphST->toAryUI[uiEdge]];
+
+    for(uint32_t uiNode = 0; uiNode < graphST->numNodesUI; ++uiNode)
+    { /*Loop: Find the nodes with no edges into them*/
+        if(rankAryUI[uiNode] == 0)
+        { /*If nothing is before this node*/
+            graphST->orderAryUI[numOrderUI] = uiNode;
+            ++numOrderUI;
+        } /*If nothing is before this node*/
+    } /*Loop: Find the nodes with no edges into them*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-2: Add nodes after all the nodes before them are in
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t uiOrder = 0; uiOrder < numOrderUI; ++uiOrder)
+    { /*Loop: Go through the nodes in order (orderAryUI is the queue)*/
+        edgeUI = graphST->firstOutAryUI[graphST->orderAryUI[uiOrder]];
+
+        while(edgeUI != defPoaNoNodeUI)
+        { /*Loop: Remove the edges out of this node*/
+            nodeUI = graphST->toAryUI[edgeUI];
+            --rankAryUI[nodeUI];
+
+            if(rankAryUI[nodeUI] == 0)
+            { /*If all nodes before this node are sorted*/
+                graphST->orderAryUI[numOrderUI] = nodeUI;
+                ++numOrderUI;
+            } /*If all nodes before this node are sorted*/
+
+            edgeUI = graphST->nextOutAryUI[edgeUI];
+        } /*Loop: Remove the edges out of this node*/
+    } /*Loop: Go through the nodes in order (orderAryUI is the queue)*/
+
+    if(numOrderUI != graphST->numNodesUI)
+        return 2; /*Some nodes are in a cycle*/
+
+    for(uint32_t uiOrder = 0; uiOrder < numOrderUI; ++uiOrder)
+        rankAryUI[graphST->orderAryUI[uiOrder]] = uiOrder;
+
+    return 1;
+} /*poaSortGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if made the graph
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o graphST to only have the backbone sequence (buffers are kept)
+\---------------------------------------------------------------------*/
+uint8_t poaSeqToGraph(
+    struct poaGraph *graphST, /*Graph to start*/
+    char *seqCStr,            /*Backbone sequence*/
+    uint32_t lenSeqUI         /*Length of the backbone*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-6 TOC: Sec-1 Sub-1: poaSeqToGraph
+   '  - Starts a poaGraph with a backbone sequence
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint32_t nodeUI = 0;
+
+    graphST->numNodesUI = 0;
+    graphST->numEdgesUI = 0;
+    graphST->numSeqUI = 1; /*The backbone is the first sequence*/
+
+    for(uint32_t uiBase = 0; uiBase < lenSeqUI; ++uiBase)
+    { /*Loop: Add each backbone base as a node*/
+        nodeUI = poaAddNode(graphST, seqCStr[uiBase], uiBase);
+
+        if(nodeUI == defPoaNoNodeUI)
+            return 64;
+
+        graphST->weightAryUI[nodeUI] = 1;
+
+        if(uiBase > 0 && poaAddEdge(graphST, nodeUI - 1, nodeUI) & 64)
+            return 64;
+    } /*Loop: Add each backbone base as a node*/
+
+    poaSortGraph(graphST); /*A single sequence can not have cycles*/
+    return 1;
+} /*poaSeqToGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if aligned the sequence
+|        o 2 if the sequence did not align in the band
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o pathNodeAryUI, pathSeqAryL, & numPathUI in graphST to have
+|          the node each aligned base is on (defPoaNoNodeUI for
+|          insertions). Deletions & read ends that did not align (local
+|          alignment) are left out.
+\---------------------------------------------------------------------*/
+uint8_t poaAlignSeq(
+    struct poaGraph *graphST, /*Graph to align to (is sorted)*/
+    char *seqCStr,            /*Sequence to align*/
+    uint32_t lenSeqUI,        /*Length of the sequence*/
+    long diagL,               /*Backbone position - sequence position*/
+    uint32_t bandUI           /*Bases on each side of the diagonal*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-7 TOC: poaAlignSeq
+   '  - Does a banded local alignment of a sequence to a poaGraph. Row
+   '    r of the score matrix is the node with rank r & column c is
+   '    sequence base loAryL[r] + c (1 is the first base). Cells out of
+   '    the band are 0, which is the same as starting a new alignment.
+   '  o fun-7 sec-1: Variable declerations
+   '  o fun-7 sec-2: Make sure the buffers are large enough
+   '  o fun-7 sec-3: Score each node in topological order
+   '  o fun-7 sec-4: Trace back the best alignment
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    long widthL = (bandUI << 1) + 1; /*Columns in a row*/
+    unsigned long needUL = 0;
+    long loL = 0;        /*First sequence base in the rows band*/
+    long offL = 0;       /*Column shift from a row to its predecessor*/
+    long startL = 0;     /*First column a predecessor has*/
+    long endL = 0;       /*Column after the last a predecessor has*/
+    long seqL = 0;       /*Sequence base on*/
+    long colL = 0;
+
+    int32_t scoreI = 0;
+    int32_t prevI = 0;
+    int32_t matchI = 0;
+    int32_t bestI = 0;   /*Best score in the matrix*/
+    uint32_t bestRankUI = 0;
+    long bestSeqL = 0;
+
+    uint32_t nodeUI = 0;
+    uint32_t edgeUI = 0;
+    uint32_t predRankUI = 0;
+    uint32_t rankUI = 0;
+    uint32_t tmpUI = 0;
+    char baseC = 0;
+    char movedBl = 0;    /*1: found the cell the trace back came from*/
+    uint32_t heavyUI = 0; /*Weight of the best edge in the trace back*/
+
+    int32_t *rowAryI = 0;
+    int32_t *predAryI = 0;
+    int32_t *diagAryI = 0; /*Best predecessor score one base back*/
+    long *loAryL = graphST->loAryL;
+    void *tmpPtr = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-2: Make sure the buffers are large enough
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    needUL = (graphST->numNodesUI + 1) * widthL;
+
+    if(needUL > graphST->lenScoreUL)
+    { /*If need a larger score matrix*/
+        needUL += (needUL >> 1); /*So the graph can grow some*/
+        free(graphST->scoreAryI);
+        graphST->lenScoreUL = 0;
+        graphST->scoreAryI = malloc(needUL * sizeof(int32_t));
+
+        if(graphST->scoreAryI == 0)
+            return 64;
+
+        graphST->lenScoreUL = needUL;
+    } /*If need a larger score matrix*/
+
+    if(lenSeqUI + 1 > graphST->lenPathUI)
+    { /*If need a larger path*/
+        tmpPtr =
+            realloc(
+                graphST->pathNodeAryUI,
+                (lenSeqUI + 1) * sizeof(uint32_t)
+            );
+        if(tmpPtr == 0) return 64;
+        graphST->pathNodeAryUI = tmpPtr;
+
+        tmpPtr =
+            realloc(graphST->pathSeqAryL, (lenSeqUI + 1)*sizeof(long));
+        if(tmpPtr == 0) return 64;
+        graphST->pathSeqAryL = tmpPtr;
+
+        graphST->lenPathUI = lenSeqUI + 1;
+    } /*If need a larger path*/
+
+    diagAryI = graphST->scoreAryI + graphST->numNodesUI * widthL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-3: Score each node in topological order
+    ^   - fun-7 sec-3 sub-1: Find the best predecessor scores
+    ^   - fun-7 sec-3 sub-2: Add the match & insertion scores
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Fun-7 Sec-3 Sub-1: Find the best predecessor scores
+    \******************************************************************/
+
+    for(uint32_t uiRank = 0; uiRank < graphST->numNodesUI; ++uiRank)
+    { /*Loop: Score each node*/
+        nodeUI = graphST->orderAryUI[uiRank];
+        loL = (long) graphST->posAryUI[nodeUI] - diagL + 1 - bandUI;
+        loAryL[uiRank] = loL;
+        rowAryI = graphST->scoreAryI + uiRank * widthL;
+
+        for(colL = 0; colL < widthL; ++colL)
+        { /*Loop: Blank the row (0 is a new alignment)*/
+            rowAryI[colL] = 0;
+            diagAryI[colL] = 0;
+        } /*Loop: Blank the row (0 is a new alignment)*/
+
+        if(loL > (long) lenSeqUI || loL + widthL <= 1)
+            continue; /*The band is off the sequence*/
+
+        edgeUI = graphST->firstInAryUI[nodeUI];
+
+        while(edgeUI != defPoaNoNodeUI)
+        { /*Loop: Check each predecessor*/
+            predRankUI = graphST->rankAryUI[graphST->fromAryUI[edgeUI]];
+            predAryI = graphST->scoreAryI + predRankUI * widthL;
+            offL = loL - loAryL[predRankUI];
+
+            /*Deletions: predecessor at the same base (colL + offL)*/
+            startL = offL < 0 ? -offL : 0;
+            endL = offL > 0 ? widthL - offL : widthL;
+
+            for(colL = startL; colL < endL; ++colL)
+            { /*Loop: Score deletions*/
+                scoreI = predAryI[colL + offL] + defPoaGapI;
+                rowAryI[colL] =
+                    scoreI > rowAryI[colL] ? scoreI : rowAryI[colL];
+            } /*Loop: Score deletions*/
+
+            /*Matches: predecessor one base back (colL + offL - 1)*/
+            startL = offL < 1 ? 1 - offL : 0;
+            endL = offL > 1 ? widthL + 1 - offL : widthL;
+
+            for(colL = startL; colL < endL; ++colL)
+            { /*Loop: Find best predecessor one base back*/
+                scoreI = predAryI[colL + offL - 1];
+                diagAryI[colL] =
+                    scoreI > diagAryI[colL] ? scoreI : diagAryI[colL];
+            } /*Loop: Find best predecessor one base back*/
+
+            edgeUI = graphST->nextInAryUI[edgeUI];
+        } /*Loop: Check each predecessor*/
+
+        /**************************************************************\
+        * Fun-7 Sec-3 Sub-2: Add the match & insertion scores
+        \**************************************************************/
+
+        baseC = graphST->baseAryC[nodeUI];
+
+        for(colL = 0; colL < widthL; ++colL)
+        { /*Loop: Add matches & insertions*/
+            seqL = loL + colL;
+
+            if(seqL < 1 || seqL > (long) lenSeqUI)
+            { /*If this column is off the sequence*/
+                rowAryI[colL] = 0;
+                continue;
+            } /*If this column is off the sequence*/
+
+            if((seqCStr[seqL - 1] & ~32) == baseC)
+                scoreI = diagAryI[colL] + defPoaMatchI;
+            else
+                scoreI = diagAryI[colL] + defPoaMismatchI;
+
+            if(scoreI > rowAryI[colL])
+                rowAryI[colL] = scoreI;
+
+            scoreI = rowAryI[colL - (colL > 0)] + defPoaGapI;
+
+            if(colL > 0 && scoreI > rowAryI[colL])
+                rowAryI[colL] = scoreI; /*Insertion*/
+
+            if(rowAryI[colL] > bestI)
+            { /*If this is the best score so far*/
+                bestI = rowAryI[colL];
+                bestRankUI = uiRank;
+                bestSeqL = seqL;
+            } /*If this is the best score so far*/
+        } /*Loop: Add matches & insertions*/
+    } /*Loop: Score each node*/
+
+    graphST->numPathUI = 0;
+
+    if(bestI <= 0)
+        return 2; /*Nothing aligned*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-4: Trace back the best alignment
+    ^   - The moves are found again from the scores, so no direction
+    ^     matrix is kept. Matches are checked first, then deletions,
+    ^     then insertions.
+    ^   - Ties go to the heaviest edge, so reads in repeats follow the
+    ^     path most reads took instead of opening a parallel path.
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    rankUI = bestRankUI;
+    seqL = bestSeqL;
+
+    while(seqL > 0)
+    { /*Loop: Trace back the alignment*/
+        nodeUI = graphST->orderAryUI[rankUI];
+        colL = seqL - loAryL[rankUI];
+        scoreI = graphST->scoreAryI[rankUI * widthL + colL];
+
+        if(scoreI <= 0)
+            break; /*At the start of the alignment*/
+
+        if((seqCStr[seqL - 1] & ~32) == graphST->baseAryC[nodeUI])
+            matchI = defPoaMatchI;
+        else
+            matchI = defPoaMismatchI;
+
+        movedBl = 0;
+        heavyUI = 0;
+        edgeUI = graphST->firstInAryUI[nodeUI];
+
+        while(edgeUI != defPoaNoNodeUI)
+        { /*Loop: Check if came from a predecessor one base back*/
+            tmpUI = graphST->rankAryUI[graphST->fromAryUI[edgeUI]];
+            colL = seqL - 1 - loAryL[tmpUI];
+
+            if(seqL > 1 && colL >= 0 && colL < widthL)
+                prevI = graphST->scoreAryI[tmpUI * widthL + colL];
+            else
+                prevI = 0;
+
+            if(   prevI > 0
+               && prevI + matchI == scoreI
+               && graphST->edgeWeightAryUI[edgeUI] >= heavyUI
+            ){ /*If this base came from a heavier predecessor*/
+                movedBl = 1;
+                heavyUI = graphST->edgeWeightAryUI[edgeUI];
+                predRankUI = tmpUI;
+            } /*If this base came from a heavier predecessor*/
+
+            edgeUI = graphST->nextInAryUI[edgeUI];
+        } /*Loop: Check if came from a predecessor one base back*/
+
+        if(movedBl || scoreI == matchI)
+        { /*If the base was a match or mismatch*/
+            graphST->pathNodeAryUI[graphST->numPathUI] = nodeUI;
+            graphST->pathSeqAryL[graphST->numPathUI] = seqL - 1;
+            ++graphST->numPathUI;
+
+            if(!movedBl)
+                break; /*Alignment started at this base*/
+
+            rankUI = predRankUI;
+            --seqL;
+            continue;
+        } /*If the base was a match or mismatch*/
+
+        edgeUI = graphST->firstInAryUI[nodeUI];
+
+        while(edgeUI != defPoaNoNodeUI)
+        { /*Loop: Check if came from a deletion*/
+            tmpUI = graphST->rankAryUI[graphST->fromAryUI[edgeUI]];
+            colL = seqL - loAryL[tmpUI];
+
+            if(colL >= 0 && colL < widthL)
+                prevI = graphST->scoreAryI[tmpUI * widthL + colL];
+            else
+                prevI = 0;
+
+            if(   prevI + defPoaGapI == scoreI
+               && graphST->edgeWeightAryUI[edgeUI] >= heavyUI
+            ){ /*If the node was skipped for a heavier predecessor*/
+                movedBl = 1;
+                heavyUI = graphST->edgeWeightAryUI[edgeUI];
+                predRankUI = tmpUI;
+            } /*If the node was skipped for a heavier predecessor*/
+
+            edgeUI = graphST->nextInAryUI[edgeUI];
+        } /*Loop: Check if came from a deletion*/
+
+        if(movedBl)
+        { /*If was a deletion*/
+            rankUI = predRankUI;
+            continue;
+        } /*If was a deletion*/
+
+        colL = seqL - 1 - loAryL[rankUI];
+
+        if(seqL > 1 && colL >= 0)
+            prevI = graphST->scoreAryI[rankUI * widthL + colL];
+        else
+            prevI = 0;
+
+        if(prevI + defPoaGapI != scoreI)
+            break; /*Should never happen*/
+
+        /*Insertion; the base is put after the last node added*/
+        graphST->pathNodeAryUI[graphST->numPathUI] = defPoaNoNodeUI;
+        graphST->pathSeqAryL[graphST->numPathUI] = seqL - 1;
+        ++graphST->numPathUI;
+        --seqL;
+    } /*Loop: Trace back the alignment*/
+
+    for(uint32_t uiPath = 0; uiPath < graphST->numPathUI >> 1; ++uiPath)
+    { /*Loop: Put the path in sequence order*/
+        tmpUI = graphST->numPathUI - 1 - uiPath;
+
+        nodeUI = graphST->pathNodeAryUI[uiPath];
+        graphST->pathNodeAryUI[uiPath] = graphST->pathNodeAryUI[tmpUI];
+        graphST->pathNodeAryUI[tmpUI] = nodeUI;
+
+        seqL = graphST->pathSeqAryL[uiPath];
+        graphST->pathSeqAryL[uiPath] = graphST->pathSeqAryL[tmpUI];
+        graphST->pathSeqAryL[tmpUI] = seqL;
+    } /*Loop: Put the path in sequence order*/
+
+    return 1;
+} /*poaAlignSeq*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if added the sequence
+|        o 2 if the graph ended up with a cycle
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o graphST to have the sequence (graph is resorted)
+\---------------------------------------------------------------------*/
+uint8_t poaAddAln(
+    struct poaGraph *graphST, /*Graph with the alignment from
+                                poaAlignSeq*/
+    char *seqCStr             /*Sequence that was aligned*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-8 TOC: Sec-1 Sub-1: poaAddAln
+   '  - Adds an aligned sequence to a poaGraph. Mismatches reuse a node
+   '    in the aligned node ring when it has the same base.
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint32_t prevUI = defPoaNoNodeUI; /*Last node the sequence was on*/
+    uint32_t nodeUI = 0;
+    uint32_t alnUI = 0;
+    char baseC = 0;
+
+    for(uint32_t uiPath = 0; uiPath < graphST->numPathUI; ++uiPath)
+    { /*Loop: Add each aligned base*/
+        nodeUI = graphST->pathNodeAryUI[uiPath];
+        baseC = seqCStr[graphST->pathSeqAryL[uiPath]] & ~32;
+
+        if(nodeUI == defPoaNoNodeUI)
+        { /*If is an insertion*/
+            nodeUI =
+                poaAddNode(
+                    graphST,
+                    baseC,
+                    prevUI == defPoaNoNodeUI
+                        ? 0
+                        : graphST->posAryUI[prevUI]
+                );
+        } /*If is an insertion*/
+
+        else if(graphST->baseAryC[nodeUI] != baseC)
+        { /*Else if is a mismatch*/
+            alnUI = graphST->alnAryUI[nodeUI];
+
+            while(alnUI != nodeUI && graphST->baseAryC[alnUI] != baseC)
+                alnUI = graphST->alnAryUI[alnUI];
+
+            if(alnUI != nodeUI)
+                nodeUI = alnUI; /*Another sequence had this base*/
+
+            else
+            { /*Else need a new node in the ring*/
+                alnUI = poaAddNode(
+                    graphST,
+                    baseC,
+                    graphST->posAryUI[nodeUI]
+                );
+
+                if(alnUI != defPoaNoNodeUI)
+                { /*If made the node*/
+                    graphST->alnAryUI[alnUI]=graphST->alnAryUI[nodeUI];
+                    graphST->alnAryUI[nodeUI] = alnUI;
+                } /*If made the node*/
+
+                nodeUI = alnUI;
+            } /*Else need a new node in the ring*/
+        } /*Else if is a mismatch*/
+
+        if(nodeUI == defPoaNoNodeUI)
+            return 64;
+
+        ++graphST->weightAryUI[nodeUI];
+
+        if(prevUI != defPoaNoNodeUI)
+        { /*If need an edge from the last base*/
+            if(poaAddEdge(graphST, prevUI, nodeUI) & 64)
+                return 64;
+        } /*If need an edge from the last base*/
+
+        prevUI = nodeUI;
+    } /*Loop: Add each aligned base*/
+
+    ++graphST->numSeqUI;
+    return poaSortGraph(graphST);
+} /*poaAddAln*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Length of the consensus
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o conCStr to have the consensus (resized if to small)
+|        o lenConUL to have the size of conCStr
+\---------------------------------------------------------------------*/
+long poaGetCon(
+    struct poaGraph *graphST, /*Graph to get the consensus from*/
+    float minCovF,            /*Trim ends with less than this fraction
+                                of the sequences*/
+    char **conCStr,           /*Gets the consensus*/
+    unsigned long *lenConUL   /*Size of conCStr*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-9 TOC: poaGetCon
+   '  - Gets the heaviest path (consensus) in a poaGraph
+   '  o fun-9 sec-1: Variable declerations
+   '  o fun-9 sec-2: Find the heaviest path to each node
+   '  o fun-9 sec-3: Copy the path & trim low coverage ends
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t nodeUI = 0;
+    uint32_t edgeUI = 0;
+    uint32_t bestEdgeUI = 0;
+    uint32_t endNodeUI = defPoaNoNodeUI; /*Last node in the path*/
+    uint32_t *weightAryUI = graphST->edgeWeightAryUI;
+    long *scoreAryL = graphST->conScoreAryL;
+    long lenL = 0;
+    long startL = -1;    /*First base with enough coverage*/
+    long endL = -1;      /*Last base with enough coverage*/
+    float minWeightF = minCovF * graphST->numSeqUI;
+    char *tmpCStr = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-2: Find the heaviest path to each node
+    ^   - Each node takes its heaviest edge in (ties go to the
+    ^     predecessor with the best path)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t uiRank = 0; uiRank < graphST->numNodesUI; ++uiRank)
+    { /*Loop: Find the heaviest path to each node*/
+        nodeUI = graphST->orderAryUI[uiRank];
+        bestEdgeUI = defPoaNoNodeUI;
+        edgeUI = graphST->firstInAryUI[nodeUI];
+
+        while(edgeUI != defPoaNoNodeUI)
+        { /*Loop: Find the heaviest edge into the node*/
+            if(
+                  bestEdgeUI == defPoaNoNodeUI
+               || weightAryUI[edgeUI] > weightAryUI[bestEdgeUI]
+               || (
+                       weightAryUI[edgeUI] == weightAryUI[bestEdgeUI]
+                    &&   scoreAryL[graphST->fromAryUI[edgeUI]]
+                       > scoreAryL[graphST->fromAryUI[bestEdgeUI]]
+                  )
+            ) bestEdgeUI = edgeUI;
+
+            edgeUI = graphST->nextInAryUI[edgeUI];
+        } /*Loop: Find the heaviest edge into the node*/
+
+        if(bestEdgeUI == defPoaNoNodeUI)
+        { /*If this node starts a path*/
+            scoreAryL[nodeUI] = 0;
+            graphST->conPredAryUI[nodeUI] = defPoaNoNodeUI;
+        } /*If this node starts a path*/
+
+        else
+        { /*Else extend the path of the heaviest edge*/
+            graphST->conPredAryUI[nodeUI] =
+                graphST->fromAryUI[bestEdgeUI];
+
+            scoreAryL[nodeUI] =
+                  scoreAryL[graphST->fromAryUI[bestEdgeUI]]
+                + weightAryUI[bestEdgeUI];
+        } /*Else extend the path of the heaviest edge*/
+
+        if(
+              endNodeUI == defPoaNoNodeUI
+           || scoreAryL[nodeUI] > scoreAryL[endNodeUI]
+        ) endNodeUI = nodeUI;
+    } /*Loop: Find the heaviest path to each node*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-3: Copy the path & trim low coverage ends
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    nodeUI = endNodeUI;
+
+    while(nodeUI != defPoaNoNodeUI)
+    { /*Loop: Find the length of the path*/
+        ++lenL;
+        nodeUI = graphST->conPredAryUI[nodeUI];
+    } /*Loop: Find the length of the path*/
+
+    if((unsigned long) lenL + 1 > *lenConUL)
+    { /*If need a larger consensus buffer*/
+        tmpCStr = realloc(*conCStr, (lenL + 1) * sizeof(char));
+
+        if(tmpCStr == 0)
+            return -1;
+
+        *conCStr = tmpCStr;
+        *lenConUL = lenL + 1;
+    } /*If need a larger consensus buffer*/
+
+    nodeUI = endNodeUI;
+
+    for(long lBase = lenL - 1; lBase >= 0; --lBase)
+    { /*Loop: Copy the path (backwards)*/
+        (*conCStr)[lBase] = graphST->baseAryC[nodeUI];
+
+        if(graphST->weightAryUI[nodeUI] >= minWeightF)
+        { /*If this base has enough coverage*/
+            if(endL < 0)
+                endL = lBase;
+
+            startL = lBase;
+        } /*If this base has enough coverage*/
+
+        nodeUI = graphST->conPredAryUI[nodeUI];
+    } /*Loop: Copy the path (backwards)*/
+
+    if(endL < 0)
+    { /*If no base had enough coverage*/
+        (*conCStr)[0] = '\0';
+        return 0;
+    } /*If no base had enough coverage*/
+
+    lenL = endL - startL + 1;
+
+    for(long lBase = 0; lBase < lenL; ++lBase)
+        (*conCStr)[lBase] = (*conCStr)[lBase + startL];
+
+    (*conCStr)[lenL] = '\0';
+    return lenL;
+} /*poaGetCon*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of minimizers kept in minzAry
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o minzAry to have the minimizers sorted by hash (is resized
+|          when to small)
+\---------------------------------------------------------------------*/
+long poaGetBbMinz(
+    char *seqCStr,             /*Backbone sequence*/
+    uint32_t lenSeqUI,         /*Length of the backbone*/
+    struct mapMinz **minzAry,  /*Gets the minimizers*/
+    unsigned long *lenMinzUL   /*Number minimizers minzAry can hold*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-10 TOC: Sec-1 Sub-1: poaGetBbMinz
+   '  - Gets the backbone minimizers that are only in the backbone once
+   '    (repeats do not give a single position)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    long numMinzL = 0;
+    long keptL = 0;
+    long endL = 0;
+
+    numMinzL = getMapMinz(seqCStr, lenSeqUI, 0, minzAry, lenMinzUL, 0);
+
+    if(numMinzL < 0)
+        return -1;
+
+    qsort(*minzAry, numMinzL, sizeof(struct mapMinz), cmpMapMinz);
+
+    for(long lMinz = 0; lMinz < numMinzL; lMinz = endL + 1)
+    { /*Loop: Remove minimizers in the backbone more than once*/
+        endL = lMinz;
+
+        while(
+              endL + 1 < numMinzL
+           && (*minzAry)[endL + 1].hashUI == (*minzAry)[lMinz].hashUI
+        ) ++endL;
+
+        if(endL != lMinz)
+            continue; /*Minimizer is repeated*/
+
+        (*minzAry)[keptL] = (*minzAry)[lMinz];
+        ++keptL;
+    } /*Loop: Remove minimizers in the backbone more than once*/
+
+    return keptL;
+} /*poaGetBbMinz*/
+
+/*---------------------------------------------------------------------\
+| Output: Returns: -1 if one < two, 1 if one > two, else 0
+\---------------------------------------------------------------------*/
+int cmpPoaDiag(
+    const void *oneL, /*First diagonal (long)*/
+    const void *twoL  /*Second diagonal (long)*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-11 TOC: Sec-1 Sub-1: cmpPoaDiag
+   '  - qsort compare function for the diagonals in poaReadDiag
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(*(const long *) oneL < *(const long *) twoL)
+        return -1;
+
+    return *(const long *) oneL > *(const long *) twoL;
+} /*cmpPoaDiag*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found the strand & diagonal
+|        o 2 if to few minimizers were shared with the backbone
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revBl to be 1 if the read is on the other strand
+|        o diagL to be the median backbone position - read position
+|          (for the reverse complement when revBl is 1)
+|        o minzAry, lenMinzUL, diagAryL, & lenDiagUL (buffers)
+\---------------------------------------------------------------------*/
+uint8_t poaReadDiag(
+    struct mapMinz *bbMinzAry, /*Backbone minimizers from
+                                 poaGetBbMinz*/
+    unsigned long numBbMinzUL, /*Number of backbone minimizers*/
+    char *seqCStr,             /*Read to find the diagonal for*/
+    uint32_t lenSeqUI,         /*Length of the read*/
+    struct mapMinz **minzAry,  /*Buffer for the reads minimizers*/
+    unsigned long *lenMinzUL,  /*Size of minzAry*/
+    long **diagAryL,           /*Buffer for the diagonals*/
+    unsigned long *lenDiagUL,  /*Size of diagAryL*/
+    char *revBl,               /*Set to 1 if read is reverse strand*/
+    long *diagL                /*Gets the diagonal*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-12 TOC: poaReadDiag
+   '  - Finds the strand & diagonal of a read on the backbone
+   '  o fun-12 sec-1: Variable declerations & get the minimizers
+   '  o fun-12 sec-2: Vote on the strand & then find the diagonals
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-1: Variable declerations & get the minimizers
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    long numMinzL = 0;
+    unsigned long numForUL = 0;  /*Shared minimizers on same strand*/
+    unsigned long numRevUL = 0;  /*Shared minimizers on other strand*/
+    unsigned long numDiagUL = 0;
+    unsigned long startUL = 0;   /*For the binary search*/
+    unsigned long endUL = 0;
+    unsigned long midUL = 0;
+    char sameBl = 0;
+    long *tmpAryL = 0;
+
+    numMinzL = getMapMinz(seqCStr, lenSeqUI, 0, minzAry, lenMinzUL, 0);
+
+    if(numMinzL < 0)
+        return 64;
+
+    if((unsigned long) numMinzL > *lenDiagUL)
+    { /*If need more room for the diagonals*/
+        tmpAryL = realloc(*diagAryL, numMinzL * sizeof(long));
+
+        if(tmpAryL == 0)
+            return 64;
+
+        *diagAryL = tmpAryL;
+        *lenDiagUL = numMinzL;
+    } /*If need more room for the diagonals*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-12 Sec-2: Vote on the strand & then find the diagonals
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint8_t uiPass = 0; uiPass < 2; ++uiPass)
+    { /*Loop: Vote on the strand (pass 0) & get diagonals (pass 1)*/
+        for(long lMinz = 0; lMinz < numMinzL; ++lMinz)
+        { /*Loop: Find the reads minimizers in the backbone*/
+            startUL = 0;
+            endUL = numBbMinzUL;
+
+            while(startUL < endUL)
+            { /*Binary search for the minimizer in the backbone*/
+                midUL = (startUL + endUL) >> 1;
+
+                if(bbMinzAry[midUL].hashUI < (*minzAry)[lMinz].hashUI)
+                    startUL = midUL + 1;
+                else
+                    endUL = midUL;
+            } /*Binary search for the minimizer in the backbone*/
+
+            if(
+                  startUL >= numBbMinzUL
+               || bbMinzAry[startUL].hashUI != (*minzAry)[lMinz].hashUI
+            ) continue; /*Not in the backbone*/
+
+            sameBl = (char) bbMinzAry[startUL].strandUI;
+            sameBl = sameBl == (char) (*minzAry)[lMinz].strandUI;
+
+            if(uiPass == 0)
+            { /*If voting on the strand*/
+                numForUL += sameBl;
+                numRevUL += !sameBl;
+                continue;
+            } /*If voting on the strand*/
+
+            if(sameBl == *revBl)
+                continue; /*Minimizer is on the other strand*/
+
+            if(!*revBl)
+                (*diagAryL)[numDiagUL] =
+                      (long) bbMinzAry[startUL].posUI
+                    - (long) (*minzAry)[lMinz].posUI;
+            else
+                (*diagAryL)[numDiagUL] =
+                      (long) bbMinzAry[startUL].posUI
+                    - (
+                          (long) lenSeqUI
+                        - (long) (*minzAry)[lMinz].posUI
+                        - defMapKmerUC
+                      ); /*Position on the reverse complement*/
+
+            ++numDiagUL;
+        } /*Loop: Find the reads minimizers in the backbone*/
+
+        if(uiPass == 0)
+        { /*If finished voting*/
+            *revBl = numRevUL > numForUL;
+
+            if(
+                  numForUL < defPoaMinAnchorsUI
+               && numRevUL < defPoaMinAnchorsUI
+            ) return 2; /*To few shared minimizers to place the read*/
+        } /*If finished voting*/
+    } /*Loop: Vote on the strand (pass 0) & get diagonals (pass 1)*/
+
+    qsort(*diagAryL, numDiagUL, sizeof(long), cmpPoaDiag);
+    *diagL = (*diagAryL)[numDiagUL >> 1];
+    return 1;
+} /*poaReadDiag*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: seqCStr to be its reverse complement
+\---------------------------------------------------------------------*/
+void poaRevCompSeq(
+    char *seqCStr,    /*Sequence to reverse complement*/
+    uint32_t lenSeqUI /*Length of the sequence*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-13 TOC: Sec-1 Sub-1: poaRevCompSeq
+   '  - Reverse complements a sequence in place
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *startCStr = seqCStr;
+    char *endCStr = seqCStr + lenSeqUI - 1;
+    char tmpC = 0;
+
+    if(lenSeqUI == 0)
+        return;
+
+    while(startCStr < endCStr)
+    { /*Loop: Reverse the sequence*/
+        tmpC = *startCStr;
+        *startCStr = *endCStr;
+        *endCStr = tmpC;
+        ++startCStr;
+        --endCStr;
+    } /*Loop: Reverse the sequence*/
+
+    for(uint32_t uiBase = 0; uiBase < lenSeqUI; ++uiBase)
+    { /*Loop: Complement the bases*/
+        switch(seqCStr[uiBase] & ~32)
+        { /*Switch: find the complement base*/
+            case 'A': seqCStr[uiBase] = 'T'; break;
+            case 'C': seqCStr[uiBase] = 'G'; break;
+            case 'G': seqCStr[uiBase] = 'C'; break;
+            case 'T': seqCStr[uiBase] = 'A'; break;
+            case 'U': seqCStr[uiBase] = 'A'; break;
+            default:  seqCStr[uiBase] = 'N'; break;
+        } /*Switch: find the complement base*/
+    } /*Loop: Complement the bases*/
+
+    return;
+} /*poaRevCompSeq*/
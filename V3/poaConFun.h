@@ -0,0 +1,294 @@
+/*######################################################################
+# Name: poaConFun
+# Use:
+#   o Builds a consensus with partial order alignment (POA). The reads
+#     are aligned one at a time to a graph started from the best read
+#     (or last consensus) & the consensus is the heaviest path in the
+#     graph. This is done in memory, so no racon or minimap2 calls are
+#     needed (-enable-poa).
+#   o The alignments are banded around the diagonal found from the
+#     minimizers a read shares with the backbone. Reads are put on the
+#     same strand as the backbone with the same minimizers.
+# Includes:
+#   - "readMapFun.h"
+#   o "samEntryStruct.h"
+#   o "defaultSettings.h"
+#   o "fqAndFaFun.h"
+# C standard includes:
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef POACONFUN_H
+#define POACONFUN_H
+
+#include "readMapFun.h" /*Minimizers & reading fasta/fastq files*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' poaConFun SOH: Start Of Header
+'  - st-1 poaGraph:
+'    o Partial order graph & the buffers used to align to it
+'  - fun-1 initPoaGraph:
+'    o Sets a poaGraph to have no nodes & no buffers
+'  - fun-2 freePoaGraph:
+'    o Frees the nodes, edges, & buffers in a poaGraph
+'  - fun-3 poaAddNode:
+'    o Adds a node to a poaGraph
+'  - fun-4 poaAddEdge:
+'    o Adds an edge (or a sequence to an edge) in a poaGraph
+'  - fun-5 poaSortGraph:
+'    o Sorts the nodes in a poaGraph into topological order
+'  - fun-6 poaSeqToGraph:
+'    o Starts a poaGraph with a backbone sequence
+'  - fun-7 poaAlignSeq:
+'    o Does a banded alignment of a sequence to a poaGraph
+'  - fun-8 poaAddAln:
+'    o Adds an aligned sequence to a poaGraph
+'  - fun-9 poaGetCon:
+'    o Gets the heaviest path (consensus) in a poaGraph
+'  - fun-10 poaGetBbMinz:
+'    o Gets the backbone minimizers that are only in the backbone once
+'  - fun-11 cmpPoaDiag:
+'    o qsort compare function for the diagonals in poaReadDiag
+'  - fun-12 poaReadDiag:
+'    o Finds the strand & diagonal of a read on the backbone
+'  - fun-13 poaRevCompSeq:
+'    o Reverse complements a sequence in place
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defPoaNoNodeUI 0xffffffff /*Marks no node (or edge)*/
+#define defPoaMatchI 8            /*Score for a match (racon -m 8)*/
+#define defPoaMismatchI -6        /*Score for a mismatch (racon -x 6)*/
+#define defPoaGapI -8             /*Score for each gap (racon -g -8)*/
+#define defPoaMinCovF 0.2         /*Min fraction of the sequences a
+                                    consensus end base needs*/
+#define defPoaMinNodesUI 1024     /*Starting number of nodes & edges*/
+#define defPoaMinAnchorsUI 3      /*Min shared minimizers to align*/
+
+/*---------------------------------------------------------------------\
+| ST-1: poaGraph
+| Use:
+|   - Holds a partial order graph. Nodes & edges are indexes into the
+|     node & edge arrays. The edges into & out of a node are linked
+|     lists (firstInAryUI/nextInAryUI & firstOutAryUI/nextOutAryUI).
+|   - Nodes with different bases at the same alignment column are in
+|     a ring (alnAryUI), so a later read with the same base reuses the
+|     node instead of making a new one.
+|   - The alignment buffers are kept between reads & rounds, so they
+|     are only resized when a larger graph or read comes in.
+\---------------------------------------------------------------------*/
+typedef struct poaGraph
+{ /*poaGraph*/
+    char *baseAryC;          /*Base in each node*/
+    uint32_t *weightAryUI;   /*Sequences going through each node*/
+    uint32_t *posAryUI;      /*Backbone position (for the band)*/
+    uint32_t *alnAryUI;      /*Next node in the aligned node ring*/
+    uint32_t *firstInAryUI;  /*First edge into each node*/
+    uint32_t *firstOutAryUI; /*First edge out of each node*/
+    uint32_t *rankAryUI;     /*Topological rank of each node*/
+    uint32_t *orderAryUI;    /*Nodes in topological order*/
+    long *loAryL;            /*First read base in each ranks band*/
+    long *conScoreAryL;      /*Heaviest path score for each node*/
+    uint32_t *conPredAryUI;  /*Node before each node on the path*/
+    uint32_t numNodesUI;
+    uint32_t lenNodesUI;     /*Number of nodes the arrays can hold*/
+
+    uint32_t *fromAryUI;     /*Node each edge comes from*/
+    uint32_t *toAryUI;       /*Node each edge goes to*/
+    uint32_t *edgeWeightAryUI; /*Sequences using each edge*/
+    uint32_t *nextInAryUI;   /*Next edge into the same node*/
+    uint32_t *nextOutAryUI;  /*Next edge out of the same node*/
+    uint32_t numEdgesUI;
+    uint32_t lenEdgesUI;     /*Number of edges the arrays can hold*/
+
+    uint32_t numSeqUI;       /*Sequences added to the graph*/
+
+    int32_t *scoreAryI;      /*Banded score matrix (rank by band); the
+                               last row is scratch space*/
+    unsigned long lenScoreUL;/*Number of cells scoreAryI can hold*/
+    uint32_t *pathNodeAryUI; /*Node of each alignment step*/
+    long *pathSeqAryL;       /*Sequence base of each alignment step*/
+    uint32_t numPathUI;      /*Steps in the last alignment*/
+    uint32_t lenPathUI;      /*Steps the path arrays can hold*/
+}poaGraph;
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: graphST to have no nodes, edges, or buffers
+\---------------------------------------------------------------------*/
+void initPoaGraph(
+    struct poaGraph *graphST /*Graph to initialize*/
+); /*Sets a poaGraph to have no nodes & no buffers*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: every array in graphST & then initializes graphST
+\---------------------------------------------------------------------*/
+void freePoaGraph(
+    struct poaGraph *graphST /*Graph to free*/
+); /*Frees the nodes, edges, & buffers in a poaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Index of the new node
+|        o defPoaNoNodeUI for memory allocation errors
+|    - Modifies:
+|        o The node arrays in graphST (resized if to small)
+\---------------------------------------------------------------------*/
+uint32_t poaAddNode(
+    struct poaGraph *graphST, /*Graph to add the node to*/
+    char baseC,               /*Base in the node*/
+    uint32_t posUI            /*Backbone position of the node*/
+); /*Adds a node to a poaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if added the edge or added one to an old edges weight
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o The edge arrays in graphST (resized if to small)
+\---------------------------------------------------------------------*/
+uint8_t poaAddEdge(
+    struct poaGraph *graphST, /*Graph to add the edge to*/
+    uint32_t fromUI,          /*Node the edge starts at*/
+    uint32_t toUI             /*Node the edge ends at*/
+); /*Adds an edge (or a sequence to an edge) in a poaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if sorted the graph
+|        o 2 if the graph has a cycle
+|    - Modifies:
+|        o orderAryUI & rankAryUI in graphST
+\---------------------------------------------------------------------*/
+uint8_t poaSortGraph(
+    struct poaGraph *graphST /*Graph to sort*/
+); /*Sorts the nodes in a poaGraph into topological order*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if made the graph
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o graphST to only have the backbone sequence (buffers are kept)
+\---------------------------------------------------------------------*/
+uint8_t poaSeqToGraph(
+    struct poaGraph *graphST, /*Graph to start*/
+    char *seqCStr,            /*Backbone sequence*/
+    uint32_t lenSeqUI         /*Length of the backbone*/
+); /*Starts a poaGraph with a backbone sequence*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if aligned the sequence
+|        o 2 if the sequence did not align in the band
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o pathNodeAryUI, pathSeqAryL, & numPathUI in graphST to have
+|          the node each aligned base is on (defPoaNoNodeUI for
+|          insertions). Deletions & read ends that did not align (local
+|          alignment) are left out.
+\---------------------------------------------------------------------*/
+uint8_t poaAlignSeq(
+    struct poaGraph *graphST, /*Graph to align to (is sorted)*/
+    char *seqCStr,            /*Sequence to align*/
+    uint32_t lenSeqUI,        /*Length of the sequence*/
+    long diagL,               /*Backbone position - sequence position*/
+    uint32_t bandUI           /*Bases on each side of the diagonal*/
+); /*Does a banded alignment of a sequence to a poaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if added the sequence
+|        o 2 if the graph ended up with a cycle
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o graphST to have the sequence (graph is resorted)
+\---------------------------------------------------------------------*/
+uint8_t poaAddAln(
+    struct poaGraph *graphST, /*Graph with the alignment from
+                                poaAlignSeq*/
+    char *seqCStr             /*Sequence that was aligned*/
+); /*Adds an aligned sequence to a poaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Length of the consensus
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o conCStr to have the consensus (resized if to small)
+|        o lenConUL to have the size of conCStr
+\---------------------------------------------------------------------*/
+long poaGetCon(
+    struct poaGraph *graphST, /*Graph to get the consensus from*/
+    float minCovF,            /*Trim ends with less than this fraction
+                                of the sequences*/
+    char **conCStr,           /*Gets the consensus*/
+    unsigned long *lenConUL   /*Size of conCStr*/
+); /*Gets the heaviest path (consensus) in a poaGraph*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of minimizers kept in minzAry
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o minzAry to have the minimizers sorted by hash (is resized
+|          when to small)
+\---------------------------------------------------------------------*/
+long poaGetBbMinz(
+    char *seqCStr,             /*Backbone sequence*/
+    uint32_t lenSeqUI,         /*Length of the backbone*/
+    struct mapMinz **minzAry,  /*Gets the minimizers*/
+    unsigned long *lenMinzUL   /*Number minimizers minzAry can hold*/
+); /*Gets the backbone minimizers that are only in the backbone once*/
+
+/*---------------------------------------------------------------------\
+| Output: Returns: -1 if one < two, 1 if one > two, else 0
+\---------------------------------------------------------------------*/
+int cmpPoaDiag(
+    const void *oneL, /*First diagonal (long)*/
+    const void *twoL  /*Second diagonal (long)*/
+); /*qsort compare function for the diagonals in poaReadDiag*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found the strand & diagonal
+|        o 2 if to few minimizers were shared with the backbone
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revBl to be 1 if the read is on the other strand
+|        o diagL to be the median backbone position - read position
+|          (for the reverse complement when revBl is 1)
+|        o minzAry, lenMinzUL, diagAryL, & lenDiagUL (buffers)
+\---------------------------------------------------------------------*/
+uint8_t poaReadDiag(
+    struct mapMinz *bbMinzAry, /*Backbone minimizers from
+                                 poaGetBbMinz*/
+    unsigned long numBbMinzUL, /*Number of backbone minimizers*/
+    char *seqCStr,             /*Read to find the diagonal for*/
+    uint32_t lenSeqUI,         /*Length of the read*/
+    struct mapMinz **minzAry,  /*Buffer for the reads minimizers*/
+    unsigned long *lenMinzUL,  /*Size of minzAry*/
+    long **diagAryL,           /*Buffer for the diagonals*/
+    unsigned long *lenDiagUL,  /*Size of diagAryL*/
+    char *revBl,               /*Set to 1 if read is reverse strand*/
+    long *diagL                /*Gets the diagonal*/
+); /*Finds the strand & diagonal of a read on the backbone*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: seqCStr to be its reverse complement
+\---------------------------------------------------------------------*/
+void poaRevCompSeq(
+    char *seqCStr,    /*Sequence to reverse complement*/
+    uint32_t lenSeqUI /*Length of the sequence*/
+); /*Reverse complements a sequence in place*/
+
+#endif
@@ -10,6 +10,9 @@
 '   fun-4 fqGetBestReadByMedQ:
 '     - Extracts read with best medain Q-score from file.
 '     - It also considers length if integer Q-scores are the same.
+'   fun-5 preselBestXReads:
+'     - Selects the reads that share the most minimizers with the best
+'       read, so findBestXReads only maps these reads
 '~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 #include "readExtract.h"
@@ -41,7 +44,7 @@ uint8_t extractBestRead(
     '    fun-1 sec-1: variable declerations                            \
     '    fun-1 sec-2: Check if Bin exists & set up best read file name /
     '    fun-1 sec-3: Check if fastq & stats file can be opened        \
-    '    fun-1 sec-4: Open temporary stat file & write header          /
+    '    fun-1 sec-4: Open temporary stat file                         /
     '    fun-1 sec-5: Copy old stat file, except for best read         \
     '    fun-1 sec-6: Make temporay stat file the new bin stat file    /
     '    fun-1 sec-7: Extract the best read                            \
@@ -53,17 +56,15 @@ uint8_t extractBestRead(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char
-        *tmpFqCStr ="tmp-202301110827-reads-09876543211234567890.fastq",
-        *tmpStatCStr ="tmp-202301110827-stats-09876543211234567890.tsv",
+        tmpFqCStr[300],   /*Temporary fastq named after the bin*/
+        tmpStatCStr[300], /*Temporary stats file named after the bin*/
         *tmpCStr = 0;
 
     int8_t ignoreC = 0;
 
-    uint8_t
-        errUC = 0,     /*Holds error messages*/
-        onHeaderBool = 1; /*Tells if need to ignore the first line*/
+    uint8_t errUC = 0;     /*Holds error messages*/
 
-    struct readStat
+    struct statRec
         tmpRead,
         bestRead;            /*Holds best read to extract*/
 
@@ -93,11 +94,21 @@ uint8_t extractBestRead(
         "--best-read.fastq"
     ); /*Add in the best read ending*/
 
+    /*Name the temporary files after the bin, so that bins can be
+      processed at the same time without sharing files*/
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, binIn->fqPathCStr);
+    tmpCStr -= 6; /*Get on '.' part of ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--best-tmp.fastq");
+
+    tmpCStr = cStrCpInvsDelm(tmpStatCStr, binIn->fqPathCStr);
+    tmpCStr -= 6; /*Get on '.' part of ".fastq"*/
+    cStrCpInvsDelm(tmpCStr, "--best-tmp.bin");
+
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     ^ Fun-1 Sec-3: Check if can open fastq file & stats file           v
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    inFILE = fopen(binIn->statPathCStr, "r"); /*Open the stats file*/
+    inFILE = fopen(binIn->statPathCStr, "rb"); /*Open the stats file*/
 
     if(inFILE == 0)
         return 4;    /*The fastq file has nothing*/
@@ -113,20 +124,18 @@ uint8_t extractBestRead(
     fclose(outFILE); /*Was just a quick test to see if could open*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-1 Sec-4: Open temporary stat file & write header             v
+    ^ Fun-1 Sec-4: Open temporary stat file                            v
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Open the temporary stat file to write non-best read to*/
-    outFILE = fopen(tmpStatCStr, "w");
-    printStatHeader(outFILE);
+    outFILE = fopen(tmpStatCStr, "wb");
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-1 Sec-5: Copy old stat file, except for best read            v
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
     
-    /*Read in the frist line (assume is best read*/
-    errUC = readStatsFileLine(inFILE, &onHeaderBool, &bestRead);
-        /*onHeaderBool tells if have read in the header*/
+    /*Read in the frist record (assume is best read*/
+    errUC = readStatRec(inFILE, &bestRead);
 
     if(!(errUC & 1))
     { /*If had a file error*/
@@ -134,8 +143,8 @@ uint8_t extractBestRead(
         return 16;     /*File error, return 16 so user knows*/
     } /*If had a file error*/
 
-    /*Read in next line, so have something to compare*/
-    errUC = readStatsFileLine(inFILE, &onHeaderBool, &tmpRead);
+    /*Read in next record, so have something to compare*/
+    errUC = readStatRec(inFILE, &tmpRead);
 
     if(!(errUC & 1))
     { /*If had a file error*/
@@ -184,19 +193,15 @@ uint8_t extractBestRead(
 
         /*At this point ignoreC is 1 (discard) read or 0 (keep)*/
         if(ignoreC & 1)
-            printReadStat(&tmpRead, outFILE);
+            fwrite(&tmpRead, sizeof(struct statRec), 1, outFILE);
         else
         { /*else have a new best mapq*/
-            printReadStat(&bestRead, outFILE);
-            cpReadStat(&bestRead, &tmpRead); /*copy the read*/
+            fwrite(&bestRead, sizeof(struct statRec), 1, outFILE);
+            bestRead = tmpRead; /*copy the read*/
         } /*else have a new best mapq*/
 
-        errUC =
-            readStatsFileLine(
-                inFILE,     /*File with line to grab*/
-                &onHeaderBool, /*Tells if their is a header line*/
-                &tmpRead   /*Will hold the stats from the stats file*/
-        ); /*Read in the next line*/
+        /*Read in the next record*/
+        errUC = readStatRec(inFILE, &tmpRead);
     } /*While not at end of file or no problems*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -246,7 +251,7 @@ uint8_t extractBestRead(
 
     errUC = 
         fqOneIdExtract(
-            bestRead.queryIdCStr,
+            bestRead.idHashUL,
             inFILE,     /*fastq file to extract read from*/
             outFILE,
             otherOutFILE
@@ -284,10 +289,10 @@ uint8_t extractBestRead(
 #        - 4: If the fqFILE does not exist
 #        - 8: If the outFILE does not exist
 #        - 16: If an incomplete entry (EOF, but missing lines)
-#        - 32: If the idCStr (id looking for) entry is incomplete
+#        - 32: If the read (id looking for) entry is incomplete
 ----------------------------------------------------------------------*/
 uint8_t fqOneIdExtract(
-    char *idCStr,  /*'\0' terminated read id to extract*/
+    uint64_t idHashUL, /*hashReadId hash of the read id to extract*/
     FILE *fqFILE,     /*fastq file to extract read from*/
     FILE *keptFILE,   /*File with the target read*/
     FILE *outFILE     /*fastq file to write read to*/
@@ -316,7 +321,6 @@ uint8_t fqOneIdExtract(
 
     char
         *tmpCStr = 0,
-        *idIterCStr = 0,
         lineCStr[lenBuffUSht];
 
     FILE
@@ -350,25 +354,12 @@ uint8_t fqOneIdExtract(
     while(fgets(lineCStr, lenBuffUSht, fqFILE))
     { /*While have a line to read in*/
         tmpCStr = lineCStr;
-        idIterCStr = idCStr;
 
         /*Make sure off @ symbols for header*/
         if(*tmpCStr == '@')
             ++tmpCStr;
 
-        if(*idIterCStr == '@')
-            ++idIterCStr;
-
-        while(*tmpCStr == *idIterCStr)
-        { /*While the two strings are the same*/
-            ++tmpCStr;
-            ++idIterCStr;
-
-            if(*idIterCStr == '\0') /*idIterCStr always ends with null*/
-                break; /*Done with comparision*/
-        } /*While the two strings are the same*/
-
-        if(*idIterCStr == '\0')
+        if(hashReadId(tmpCStr) == idHashUL)
             tmpFILE = keptFILE;
         else
             tmpFILE = outFILE;
@@ -477,6 +468,7 @@ uint8_t fqOneIdExtract(
 |     - 4: if could not read reference
 |     - 8: if could not open the fastq file
 |     - 16: if minimap2 errored out or returned nothing
+|     - 64: for memory allocation errors
 | Note:
 |     - Score: percMult * (keptSNPs + keptIns + keptDels) / read length
 |     - minSimUSht ranges from 1 (0.01%) to precMult (100%)            
@@ -486,6 +478,9 @@ uint8_t findBestXReads(
     uint64_t *numReadsKeptULng,  /*Number of reads binned to con*/
     char *threadsCStr,           /*Number threads to use with minimap2*/
     const char *useMapqBl,       /*1: use mapping quality in selection*/
+    uint32_t preselMultUI,
+       /*Only map the preselMultUI * numReadConsULng reads sharing the
+         most minimizers with the best read (0 to map all reads)*/
     struct minAlnStats *minStats,/*Min stats to cluster reads together*/
     struct samEntry *samST,  /*Struct to use for reading sam file*/
     struct samEntry *refStruct,  /*holds the reference (0 to ignore)*/
@@ -519,12 +514,13 @@ uint8_t findBestXReads(
     uint8_t errUC = 0; /*Holds error output*/
     uint8_t oneUChar = 1;
     uint8_t zeroUChar = 0;
-    unsigned char lenStackUC = 128;
     unsigned char lenBigNum = 0;
 
     char minimapCmdCStr[2048];
     char *tmpCStr = 0;
     char buffCStr[lenBuffUInt];  /*Buffer to extract reads with*/
+    char preselFqCStr[300];      /*Reads selected by preselBestXReads*/
+    char *mapFqCStr = 0;         /*Fastq file to map to the best read*/
 
     int32_t lenIdUInt = 100;/*number of characters allowed for read id*/
 
@@ -532,22 +528,17 @@ uint8_t findBestXReads(
     uint16_t lowScoreUS = topScoreUSht; /*Lowest scoring kept read*/
     uint16_t scoreUS = 0;    /*Score of a single read*/
 
-    uint64_t hashSizeULng = 0;/*Size of hash table for read extraction*/
-    unsigned long majicNumULng = 0;     /*Number to use with hashing*/
-    uint8_t digPerKeyUChar = 0;     /*(int) log2(hashSizeULng)*/
-
-    struct readInfo **hashTbl = 0; /*Hash table for extraction*/
+    struct idFpHash fpHashST;   /*Hash table for extraction*/
     struct readInfo *tmpRead = 0;
     struct readInfo *readOn = 0;
     struct readInfo *swapRead = 0;
     struct readInfo *scoresAry[topScoreUSht];
         /*look up table for scores*/
 
-    struct readNodeStack searchStack[lenStackUC];  /*Used for fqGetIds*/
-
     FILE *testFILE = 0;
     FILE *bestReadsFILE = 0;  /*Holds the read to polish with*/
     FILE *stdinFILE = 0;
+    struct samMap samMapST; /*minimap2 or built in mapper output*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-3 Sec-2: Check if can open files and copy reference
@@ -594,6 +585,30 @@ uint8_t findBestXReads(
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     *numReadsKeptULng = 0; /*Make sure start at 0 reads*/
+    mapFqCStr = binTree->fqPathCStr;
+
+    if(!(noRefBl & 1) && preselMultUI > 0)
+    { /*If only mapping the reads most like the best read*/
+        tmpCStr = cStrCpInvsDelm(preselFqCStr, binTree->fqPathCStr);
+        tmpCStr -= 6; /*get to '.' in ".fastq"*/
+        cStrCpInvsDelm(tmpCStr, "--presel-tmp.fastq");
+
+        errUC =
+            preselBestXReads(
+                binTree->bestReadCStr,
+                binTree->fqPathCStr,
+                preselFqCStr,
+                (uint64_t) preselMultUI * *numReadConsULng
+            ); /*Select the reads to map*/
+
+        if(errUC & 64)
+            return 64;
+
+        if(errUC & 1)
+            mapFqCStr = preselFqCStr;
+
+        /*Else the bin is small (2), so map all reads*/
+    } /*If only mapping the reads most like the best read*/
 
     if(!(noRefBl & 1))
     { /*If using a reference*/
@@ -604,20 +619,33 @@ uint8_t findBestXReads(
            cpParmAndArg(
                tmpCStr,
                binTree->bestReadCStr,
-               binTree->fqPathCStr
+               mapFqCStr
         ); /*Finsh off the minimap2 command*/
         
-        /*Run minimap2 results*/
-        stdinFILE = popen(minimapCmdCStr, "r");
+        /*Run the aligner, minimap2, or the built in mapper*/
+        errUC =
+            openSamMap(
+                &samMapST,
+                minimapCmdCStr,
+                binTree->bestReadCStr,
+                mapFqCStr,
+                minStats->inMapBl | (minStats->pairAlnBl << 1),
+                0
+            );
 
         blankSamEntry(samST); /*Make sure start with blank*/
 
         /*Read in a single sam file line to check if valid (header)*/
-        errUC = readSamLine(samST, stdinFILE);
+        if(!(errUC & 64))
+            errUC = readSamMap(samST, &samMapST);
 
         if(!(errUC & 1))
         { /*If an error occured*/
-            pclose(stdinFILE);
+            closeSamMap(&samMapST);
+
+            if(mapFqCStr == preselFqCStr)
+                remove(preselFqCStr);
+
             return 16;
         } /*If an error occured*/
     } /*If using a reference*/
@@ -628,9 +656,7 @@ uint8_t findBestXReads(
         errUC = readRefFqSeq(stdinFILE, samST, 0);
     } /*Else just using the fastq file*/
 
-    /*Initalize my stack*/
-    searchStack[0].readNode = 0;
-    searchStack[lenStackUC - 1].readNode = 0;
+    initIdFpHash(&fpHashST);
 
     for(unsigned int IUElm = 0; IUElm < topScoreUSht; ++IUElm)
         scoresAry[IUElm] = 0; /*Intalize the scoring array*/
@@ -654,17 +680,17 @@ uint8_t findBestXReads(
     { /*While their is a samfile entry to read in*/
         if(!(noRefBl & 1))
         { /*If using minimap2 input*/
-            if(*samST->samEntryCStr == '@')
+            if(*samST->lineCStr == '@')
             { /*If was a header*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST,stdinFILE);
+                errUC = readSamMap(samST, &samMapST);
                 continue; /*Is a header line, move to next line in file*/
             } /*If was a header*/
 
             if(samST->flagUSht & (2048 | 256 | 4))
             { /*If was a suplemental, secondary, or unmapped alignment*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST,stdinFILE);
+                errUC = readSamMap(samST, &samMapST);
                 continue; /*Is a header line, move to next line*/
             } /*If was a suplemental, secondary, or unmapped alignment*/
 
@@ -674,7 +700,7 @@ uint8_t findBestXReads(
             if(errUC >> 2)
             { /*If entry did not have a sequence, discard*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST, stdinFILE);
+                errUC = readSamMap(samST, &samMapST);
                 continue;
             } /*If entry did not have a sequence, discard*/
         } /*If using minimap2 input*/
@@ -705,7 +731,7 @@ uint8_t findBestXReads(
             ) { /*If the read Is to different from the reference*/
                 /*Move to the next entry*/
                 blankSamEntry(samST); /*Make sure start with blank*/
-                errUC = readSamLine(samST,stdinFILE);
+                errUC = readSamMap(samST, &samMapST);
                 continue;
             } /*If the read Is to different from the reference*/
         } /*If readning from minimap2*/
@@ -814,16 +840,21 @@ uint8_t findBestXReads(
         } /*Else if only keeping better reads*/
 
         /*Move to the next read*/
-        if(!(noRefBl & 1)) errUC = readSamLine(samST,stdinFILE);
+        if(!(noRefBl & 1)) errUC = readSamMap(samST, &samMapST);
         else errUC = readRefFqSeq(stdinFILE, samST, 0);
     } /*While their is a samfile entry to read in*/
 
     /*check which file close method I need to use*/
-    if(!(errUC & 1)) pclose(stdinFILE);
-    else             fclose(stdinFILE);
+    if(!(noRefBl & 1)) closeSamMap(&samMapST);
+    else if(stdinFILE != 0) fclose(stdinFILE);
 
     stdinFILE = 0;
 
+    /*The reads are extracted from the bins fastq, which keeps the
+      full header of each read*/
+    if(mapFqCStr == preselFqCStr)
+        remove(preselFqCStr);
+
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-3 Sec-5: Set up the best x read file name                   v
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
@@ -867,15 +898,14 @@ uint8_t findBestXReads(
        } /*If I do not have a blank read*/
     } /*For all kept reads, set built the list for the hash table*/
 
-    hashTbl = 
-        readListToHash(
-            readOn,
-            numReadsKeptULng,
-            searchStack,        /*Used for searching the hash table*/
-            &hashSizeULng,      /*Will hold Size of hash table*/
-            &digPerKeyUChar,    /*Power of two hash size is at*/
-            &majicNumULng       /*Holds majick number for kunths hash*/
-    ); /*Build the hash table*/
+    /*The table keeps fingerprints, so the list is freed as it goes*/
+    errUC = readListToIdFpHash(readOn, *numReadsKeptULng, &fpHashST);
+
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        freeIdFpHash(&fpHashST);
+        return 64;
+    } /*If had a memory allocation error*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-3 Sec-7: Extract reads with fastq greps hash extract        v
@@ -889,25 +919,24 @@ uint8_t findBestXReads(
     else
         bestReadsFILE = stdout;
 
-    tmpRead = 0; /*So extract reads knows not doing AVL tree search*/
- 
     extractReads(
         testFILE,       /*File with reads to extract*/
         bestReadsFILE,  /*File to write reads to*/
         buffCStr,
         lenBuffUInt,
-        majicNumULng,   /*Holds majick number for kunths hash*/
-        digPerKeyUChar, /*Power of two hash size is at*/
+        0,              /*Kunths hash is not used*/
+        0,              /*Kunths hash is not used*/
         &zeroUChar,      /*Print the matches*/
-        tmpRead,
-        hashTbl
+        0,              /*No AVL tree*/
+        0,              /*No Kunths hash table*/
+        &fpHashST       /*Fingerprint table of kept reads*/
     );
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-3 Sec-8: Clean up
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    freeHashTbl(&hashTbl, &hashSizeULng, searchStack);
+    freeIdFpHash(&fpHashST);
 
     fclose(testFILE);
     fclose(bestReadsFILE);
@@ -949,7 +978,7 @@ uint8_t fqGetBestReadByMedQ(
 
     uint8_t errUC = 0;
     uint8_t flagUC = 0;
-    char *tmpFqCStr = "20232102-tmp10435y205y2034914701712097134.fastq";
+    char tmpFqCStr[300];  /*Temporary fastq named after the bin*/
     char *tmpCStr = 0;
     struct samEntry *swapStruct = 0;
 
@@ -966,6 +995,11 @@ uint8_t fqGetBestReadByMedQ(
     if(fqFILE == 0)
         return 4;
 
+    /*Name the temporary file after the bin, so bins can run at once*/
+    tmpCStr = cStrCpInvsDelm(tmpFqCStr, clustOn->fqPathCStr);
+    tmpCStr -= 6; /*get to "." in ".fastq" ending*/
+    cStrCpInvsDelm(tmpCStr, "--medQ-tmp.fastq");
+
     tmpFqFILE = fopen(tmpFqCStr, "w");
 
     if(tmpFqFILE == 0)
@@ -1058,3 +1092,328 @@ uint8_t fqGetBestReadByMedQ(
 
     return 1; /*Sucess*/
 } /*fqGetBestReadByMedQ*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|      o 1: if wrote the numKeepUL best reads to outPathCStr
+|      o 2: if the fastq file has numKeepUL or fewer reads (nothing
+|           is written, map the whole fastq file)
+|      o 4: if could not read the seed (best read or consensus)
+|      o 8: if could not open the fastq or output file
+|      o 64: for memory allocation errors
+|    Prints:
+|      o The reads that share the most minimizers with the seed to
+|        outPathCStr
+|    Note:
+|      o Score is the number of a reads minimizers that are in the seed
+|        per 1000 read minimizers (containment). Ties are broken by
+|        file order.
+\---------------------------------------------------------------------*/
+uint8_t preselBestXReads(
+    char *seedPathCStr, /*Best read or consensus (fasta or fastq)*/
+    char *fqPathCStr,   /*Fastq file to select reads from*/
+    char *outPathCStr,  /*Fastq file to write the selected reads to*/
+    uint64_t numKeepUL  /*Number of reads to select*/
+) /*Selects the reads that share the most minimizers with the seed*/
+{ /*preselBestXReads*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: preselBestXReads
+    '   fun-5 sec-1: variable declerations
+    '   fun-5 sec-2: Get the seeds minimizers
+    '   fun-5 sec-3: Score each read by its shared minimizers
+    '   fun-5 sec-4: Find the lowest score to keep
+    '   fun-5 sec-5: Print out the selected reads
+    '   fun-5 sec-6: Clean up
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-1: variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    long retL = 0;
+    uint32_t lenSeqUI = 0;
+    uint32_t scoreUI = 0;
+    uint32_t cutScoreUI = 0;    /*Lowest score kept*/
+    uint64_t numCutUL = 0;      /*Reads to keep with the lowest score*/
+    uint64_t numAboveUL = 0;    /*Reads kept with a higher score*/
+    unsigned long numReadsUL = 0;
+    unsigned long lenScoreUL = 0;
+    unsigned long numSeedUL = 0;/*Number of unique seed minimizers*/
+    unsigned long lenMinzUL = 0;
+    unsigned long sharedUL = 0; /*Read minimizers in the seed*/
+    unsigned long startUL = 0;  /*For the binary search*/
+    unsigned long endUL = 0;
+    unsigned long midUL = 0;
+
+    char *idCStr = 0;
+    char *seqCStr = 0;
+    char *qCStr = 0;
+    unsigned long lenIdUL = 0;
+    unsigned long lenSeqUL = 0;
+    unsigned long lenQUL = 0;
+
+    uint64_t cntAryUL[defPreselMaxScoreUI + 1]; /*Reads per score*/
+    uint16_t *scoreAryUS = 0;   /*Score of each read*/
+    uint16_t *tmpAryUS = 0;
+    uint32_t *seedAryUI = 0;    /*Sorted seed minimizer hashes*/
+    struct mapMinz *minzAry = 0;
+
+    FILE *inFILE = 0;
+    FILE *outFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-2: Get the seeds minimizers
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    inFILE = fopen(seedPathCStr, "r");
+
+    if(inFILE == 0)
+        return 4;
+
+    errUC =
+        readMapSeq(
+            inFILE,
+            &idCStr,
+            &lenIdUL,
+            &seqCStr,
+            &lenSeqUL,
+            &qCStr,
+            &lenQUL,
+            &lenSeqUI
+        ); /*Read in the seed*/
+
+    fclose(inFILE);
+    inFILE = 0;
+
+    if(errUC & 1)
+    { /*If have the seed*/
+        retL = getMapMinz(seqCStr,lenSeqUI,0,&minzAry,&lenMinzUL,0);
+
+        if(retL < 0)
+            errUC = 64;
+    } /*If have the seed*/
+
+    else if(!(errUC & 64))
+        errUC = 4; /*No sequence in the seed file*/
+
+    if(errUC & 1)
+        seedAryUI = malloc(sizeof(uint32_t) * (retL + 1));
+
+    if(errUC & 1 && seedAryUI == 0)
+        errUC = 64;
+
+    if(!(errUC & 1))
+    { /*If had an error*/
+        free(idCStr);
+        free(seqCStr);
+        free(qCStr);
+        free(minzAry);
+        return errUC;
+    } /*If had an error*/
+
+    qsort(minzAry, retL, sizeof(struct mapMinz), cmpMapMinz);
+
+    for(long lMinz = 0; lMinz < retL; ++lMinz)
+    { /*Loop: Keep one copy of each minimizer hash*/
+        if(
+               numSeedUL > 0
+            && seedAryUI[numSeedUL - 1] == minzAry[lMinz].hashUI
+        ) continue;
+
+        seedAryUI[numSeedUL] = minzAry[lMinz].hashUI;
+        ++numSeedUL;
+    } /*Loop: Keep one copy of each minimizer hash*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-3: Score each read by its shared minimizers
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t uiScore = 0; uiScore <= defPreselMaxScoreUI; ++uiScore)
+        cntAryUL[uiScore] = 0;
+
+    inFILE = fopen(fqPathCStr, "r");
+
+    if(inFILE == 0)
+        errUC = 8;
+
+    while(errUC & 1)
+    { /*Loop: Score each read*/
+        errUC =
+            readMapSeq(
+                inFILE,
+                &idCStr,
+                &lenIdUL,
+                &seqCStr,
+                &lenSeqUL,
+                &qCStr,
+                &lenQUL,
+                &lenSeqUI
+            ); /*Read in the next read*/
+
+        if(!(errUC & 1))
+            break; /*End of file (2) or memory error (64)*/
+
+        retL = getMapMinz(seqCStr,lenSeqUI,0,&minzAry,&lenMinzUL,0);
+
+        if(retL < 0)
+        { /*If had a memory allocation error*/
+            errUC = 64;
+            break;
+        } /*If had a memory allocation error*/
+
+        sharedUL = 0;
+
+        for(long lMinz = 0; lMinz < retL; ++lMinz)
+        { /*Loop: Count the reads minimizers that are in the seed*/
+            startUL = 0;
+            endUL = numSeedUL;
+
+            while(startUL < endUL)
+            { /*Binary search for the minimizer in the seed*/
+                midUL = (startUL + endUL) >> 1;
+
+                if(seedAryUI[midUL] < minzAry[lMinz].hashUI)
+                    startUL = midUL + 1;
+                else
+                    endUL = midUL;
+            } /*Binary search for the minimizer in the seed*/
+
+            if(
+                   startUL < numSeedUL
+                && seedAryUI[startUL] == minzAry[lMinz].hashUI
+            ) ++sharedUL;
+        } /*Loop: Count the reads minimizers that are in the seed*/
+
+        if(retL > 0)
+            scoreUI = (sharedUL * defPreselMaxScoreUI) / retL;
+        else
+            scoreUI = 0;
+
+        if(numReadsUL >= lenScoreUL)
+        { /*If need more room for the scores*/
+            lenScoreUL += 4096;
+            tmpAryUS =
+                realloc(scoreAryUS, sizeof(uint16_t) * lenScoreUL);
+
+            if(tmpAryUS == 0)
+            { /*If had a memory allocation error*/
+                errUC = 64;
+                break;
+            } /*If had a memory allocation error*/
+
+            scoreAryUS = tmpAryUS;
+        } /*If need more room for the scores*/
+
+        scoreAryUS[numReadsUL] = (uint16_t) scoreUI;
+        ++cntAryUL[scoreUI];
+        ++numReadsUL;
+    } /*Loop: Score each read*/
+
+    free(minzAry);
+    free(seedAryUI);
+
+    /*2 is the end of the file, so anything else is an error*/
+    if(errUC != 2 || numReadsUL <= numKeepUL)
+    { /*If had an error or have to few reads to select from*/
+        if(inFILE != 0)
+            fclose(inFILE);
+
+        free(idCStr);
+        free(seqCStr);
+        free(qCStr);
+        free(scoreAryUS);
+
+        return errUC; /*2: to few reads, 8: no file, 64: memory*/
+    } /*If had an error or have to few reads to select from*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-4: Find the lowest score to keep
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    cutScoreUI = defPreselMaxScoreUI;
+
+    while(numAboveUL + cntAryUL[cutScoreUI] < numKeepUL)
+    { /*Loop: Find the score the last kept read has*/
+        numAboveUL += cntAryUL[cutScoreUI];
+        --cutScoreUI;
+    } /*Loop: Find the score the last kept read has*/
+
+    numCutUL = numKeepUL - numAboveUL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-5: Print out the selected reads
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    outFILE = fopen(outPathCStr, "w");
+
+    if(outFILE == 0)
+        errUC = 8;
+    else
+    { /*Else can print out the kept reads*/
+        fseek(inFILE, 0, SEEK_SET);
+        errUC = 1;
+    } /*Else can print out the kept reads*/
+
+    for(unsigned long ulRead = 0; ulRead < numReadsUL; ++ulRead)
+    { /*Loop: Print out the kept reads*/
+        if(!(errUC & 1))
+            break;
+
+        errUC =
+            readMapSeq(
+                inFILE,
+                &idCStr,
+                &lenIdUL,
+                &seqCStr,
+                &lenSeqUL,
+                &qCStr,
+                &lenQUL,
+                &lenSeqUI
+            ); /*Read in the next read*/
+
+        if(!(errUC & 1))
+            break;
+
+        if(scoreAryUS[ulRead] < cutScoreUI)
+            continue;
+
+        if(scoreAryUS[ulRead] == cutScoreUI)
+        { /*If is a tie with the lowest kept score*/
+            if(numCutUL == 0)
+                continue;
+
+            --numCutUL;
+        } /*If is a tie with the lowest kept score*/
+
+        fprintf(outFILE, "@%s\n%s\n+\n%s\n", idCStr, seqCStr, qCStr);
+    } /*Loop: Print out the kept reads*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-6: Clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fclose(inFILE);
+
+    if(outFILE != 0)
+        fclose(outFILE);
+
+    free(idCStr);
+    free(seqCStr);
+    free(qCStr);
+    free(scoreAryUS);
+
+    if(!(errUC & 1))
+    { /*If had an error*/
+        remove(outPathCStr);
+
+        if(errUC & 64)
+            return 64;
+
+        return 8;
+    } /*If had an error*/
+
+    return 1;
+} /*preselBestXReads*/
@@ -24,6 +24,7 @@
 #            o <sdtint.h>
 #          - "printError.h"
 #            o <stdio.h>
+#   o "readMapFun.h"
 #   o fqGetIdsSearchFq
 #     - "fqGetIdsFqFun.h"
 #        o "fqGetIdsStructs.h"
@@ -46,6 +47,7 @@
 #include "fqAndFaFun.h"        /*Fastq and fasta functions*/
 #include "findCoInftBinTree.h" /*for readBin struct*/
 #include "fqGetIdsSearchFq.h"  /*For extracting reads by id*/
+#include "readMapFun.h"        /*Runs minimap2 or the built in mapper*/
 
 /*---------------------------------------------------------------------\
 | Output:                                                              |
@@ -77,10 +79,10 @@ uint8_t extractBestRead(
 #        - 4: If the fqFILE does not exist
 #        - 8: If the outFILE does not exist
 #        - 16: If an incomplete entry (EOF, but missing lines)
-#        - 32: If the idCStr (id looking for) entry is incomplete
+#        - 32: If the read (id looking for) entry is incomplete
 ----------------------------------------------------------------------*/
 uint8_t fqOneIdExtract(
-    char *idCStr,  /*'\0' terminated read id to extract*/
+    uint64_t idHashUL, /*hashReadId hash of the read id to extract*/
     FILE *fqFILE,     /*fastq file to extract read from*/
     FILE *keptFILE,   /*File with the target read*/
     FILE *outFILE     /*fastq file to write read to*/
@@ -93,6 +95,7 @@ uint8_t fqOneIdExtract(
 |     - 4: if could not read reference
 |     - 8: if could not open the fastq file
 |     - 16: if minimap2 errored out or returned nothing
+|     - 64: for memory allocation errors
 | Note:
 |     - Score: percMult * (keptSNPs + keptIns + keptDels) / read length
 |     - minSimUSht ranges from 1 (0.01%) to precMult (100%)            
@@ -102,6 +105,9 @@ uint8_t findBestXReads(
     uint64_t *numReadsKeptULng,  /*Number of reads binned to con*/
     char *threadsCStr,           /*Number threads to use with minimap2*/
     const char *useMapqBl,       /*1: use mapping quality in selection*/
+    uint32_t preselMultUI,
+       /*Only map the preselMultUI * numReadConsULng reads sharing the
+         most minimizers with the best read (0 to map all reads)*/
     struct minAlnStats *minStats,/*Min stats to cluster reads together*/
     struct samEntry *samStruct,  /*Struct to use for reading sam file*/
     struct samEntry *refStruct,  /*holds the reference (0 to ignore)*/
@@ -132,4 +138,28 @@ uint8_t fqGetBestReadByMedQ(
 ); /*Extracts read with best medain Q-score from file.
     It also considers length if integer Q-scores are the same.*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|    Returns:
+|      o 1: if wrote the numKeepUL best reads to outPathCStr
+|      o 2: if the fastq file has numKeepUL or fewer reads (nothing
+|           is written, map the whole fastq file)
+|      o 4: if could not read the seed (best read or consensus)
+|      o 8: if could not open the fastq or output file
+|      o 64: for memory allocation errors
+|    Prints:
+|      o The reads that share the most minimizers with the seed to
+|        outPathCStr
+|    Note:
+|      o Score is the number of a reads minimizers that are in the seed
+|        per 1000 read minimizers (containment). Ties are broken by
+|        file order.
+\---------------------------------------------------------------------*/
+uint8_t preselBestXReads(
+    char *seedPathCStr, /*Best read or consensus (fasta or fastq)*/
+    char *fqPathCStr,   /*Fastq file to select reads from*/
+    char *outPathCStr,  /*Fastq file to write the selected reads to*/
+    uint64_t numKeepUL  /*Number of reads to select*/
+); /*Selects the reads that share the most minimizers with the seed*/
+
 #endif
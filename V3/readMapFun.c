@@ -0,0 +1,3115 @@
+/*######################################################################
+# Use:
+#   o Holds a small minimizer mapper (index, chaining, & banded
+#     alignment) that makes samEntry records in memory, so short
+#     mappings (reads to a best read or consensus) do not have to start
+#     minimap2 or go through a pipe.
+#   o The samMap functions are the interface. They run minimap2 when
+#     the built in mapper is not being used.
+######################################################################*/
+
+#include "readMapFun.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' readMapFun SOF:
+'   fun-1 openSamMap:
+'     o Runs minimap2 or sets up the built in mapper
+'   fun-2 readSamMap:
+'     o Reads the next sam entry from minimap2 or the built in mapper
+'   fun-3 closeSamMap:
+'     o Closes minimap2 or frees the built in mappers memory
+'   fun-4 readMapSeq:
+'     o Reads in the next sequence in a fasta or fastq file
+'   fun-5 readMapLine:
+'     o Reads in a line of any length (no new line) into a buffer
+'   fun-6 getMapMinz:
+'     o Finds the minimizers in a sequence
+'   fun-7 buildMapRefIdx:
+'     o Reads in the references & makes the minimizer index
+'   fun-8 chainMapAnchors:
+'     o Chains the anchors shared by a query & the references
+'   fun-9 alnMapChain:
+'     o Does a banded local alignment around a chain
+'   fun-10 mapQuery:
+'     o Maps the current query & makes its sam entries
+'   fun-11 growSamMapBuff:
+'     o Makes sure the reverse complement buffers can hold the query
+'   fun-12 growSamMapAnchors:
+'     o Makes sure the anchor & chain arrays are large enough
+'   fun-13 growMapLine:
+'     o Makes sure the sam entry buffer has space for another entry
+'   fun-14 initSamMap:
+'     o Sets all variables in a samMap structure to defaults
+'   fun-15 freeMapRefIdx:
+'     o Frees the references & index in a mapRefIdx structure
+'   fun-16 cmpMapMinz:
+'     o qsort compare function for mapMinz structures
+'   fun-17 cmpMapAnchor:
+'     o qsort compare function for mapAnchor structures
+'   fun-18 cmpMapOrder:
+'     o qsort compare function for (score << 32 | anchor) values
+'   fun-19 cmpMapChain:
+'     o qsort compare function for mapChain structures
+'   fun-20 writeMapRefIdx:
+'     o Saves an index made by buildMapRefIdx to a file
+'   fun-21 readMapRefIdx:
+'     o Reads in an index saved by writeMapRefIdx
+'   fun-22 hashMapRefFile:
+'     o Hashes a file & the settings used to index it (FNV-1a)
+'   fun-23 getMapRefCache:
+'     o Finds or makes a saved index for a reference file (-ref-cache)
+'   fun-24 alnQuery:
+'     o Aligns the current query end to end to its best reference
+'   fun-25 revCompMapQuery:
+'     o Makes the reverse complement of the current query
+'   fun-26 addMapUnmapped:
+'     o Adds an unmapped sam entry for the current query
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if minimap2 was started or the mapper was set up
+|        o 2 if could not open the reference or query file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o mapST to have the minimap2 pipe or the reference index
+|    Note:
+|        o minimap2CmdCStr is only used when inMapBl is 0
+|        o inMapBl & 2 (align to the best reference) is ignored for
+|          all vs all mapping
+\---------------------------------------------------------------------*/
+uint8_t openSamMap(
+    struct samMap *mapST,  /*Structure to set up*/
+    char *minimap2CmdCStr, /*minimap2 command to run (no built in)*/
+    char *refCStr,         /*Fasta or fastq with the references*/
+    char *qryCStr,         /*Fasta or fastq with the queries*/
+    char inMapBl,          /*1: Use the built in mapper; 2: align
+                             to the best reference (alnQuery)*/
+    char allVsAllBl        /*1: All vs all (secondary & no self)*/
+) /*Starts minimap2 or sets up the built in mapper*/
+{ /*openSamMap*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: openSamMap
+    '   fun-1 sec-1: Variable declerations
+    '   fun-1 sec-2: Run minimap2 if not using the built in mapper
+    '   fun-1 sec-3: Build the index & open the query file
+    '   fun-1 sec-4: Make the sam file header
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    unsigned long lenIdUL = 0;
+
+    initSamMap(mapST);
+
+    if(allVsAllBl & 1)
+        inMapBl &= 1; /*Need every mapping, not just the best*/
+
+    mapST->inMapBl = inMapBl;
+    mapST->allVsAllBl = allVsAllBl;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-2: Run minimap2 if not using the built in mapper
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(!(inMapBl & 3))
+    { /*If using minimap2*/
+        mapST->pipeFILE = popen(minimap2CmdCStr, "r");
+
+        if(mapST->pipeFILE == 0)
+            return 2;
+
+        /*minimap2 output is read in blocks (see readSamLine)*/
+        initSamBlock(&mapST->samBlockST, mapST->pipeFILE);
+        return 1;
+    } /*If using minimap2*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-3: Build the index & open the query file
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errUC = buildMapRefIdx(&mapST->refIdx, refCStr);
+
+    if(!(errUC & 1))
+    { /*If could not build the index*/
+        closeSamMap(mapST);
+        return errUC;
+    } /*If could not build the index*/
+
+    mapST->qryFILE = openFqFILE(qryCStr, 0, 0, &mapST->qryPipeBl);
+
+    if(mapST->qryFILE == 0)
+    { /*If could not open the query file*/
+        closeSamMap(mapST);
+        return 2;
+    } /*If could not open the query file*/
+
+    mapST->skipAryUC = calloc(mapST->refIdx.numRefsUL, sizeof(uint8_t));
+
+    if(mapST->skipAryUC == 0)
+    { /*If had a memory allocation error*/
+        closeSamMap(mapST);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    if(inMapBl & 2)
+    { /*If aligning queries to their best reference*/
+        /*calloc gives the same (empty) values as initTwoBitAry*/
+        mapST->refBitAry =
+            calloc(mapST->refIdx.numRefsUL, sizeof(struct twoBitAry));
+        mapST->voteAryUI =
+            calloc(mapST->refIdx.numRefsUL << 1, sizeof(uint32_t));
+
+        if(mapST->refBitAry == 0 || mapST->voteAryUI == 0)
+        { /*If had a memory allocation error*/
+            closeSamMap(mapST);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        for(
+            unsigned long ulRef = 0;
+            ulRef < mapST->refIdx.numRefsUL;
+            ++ulRef
+        ) { /*Loop: Pack each reference for the aligner*/
+            errUC =
+                seqToTwoBitAry(
+                    mapST->refIdx.seqAryCStr[ulRef],
+                    mapST->refIdx.lenSeqAryUI[ulRef],
+                    &mapST->refBitAry[ulRef]
+                );
+
+            if(errUC & 64)
+            { /*If had a memory allocation error*/
+                closeSamMap(mapST);
+                return 64;
+            } /*If had a memory allocation error*/
+        } /*Loop: Pack each reference for the aligner*/
+    } /*If aligning queries to their best reference*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-1 Sec-4: Make the sam file header
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*The header is the first set of lines readSamMap returns*/
+    if(!(growMapLine(mapST, 128) & 1))
+    { /*If had a memory allocation error*/
+        closeSamMap(mapST);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    mapST->endLineUL +=
+        sprintf(
+            mapST->lineCStr + mapST->endLineUL,
+            "@HD\tVN:1.6\tSO:unsorted\tGO:query\n"
+        );
+
+    for(unsigned long ulRef = 0; ulRef < mapST->refIdx.numRefsUL; ++ulRef)
+    { /*Loop: Add each reference to the header*/
+        lenIdUL = strlen(mapST->refIdx.idAryCStr[ulRef]);
+
+        if(!(growMapLine(mapST, lenIdUL + 64) & 1))
+        { /*If had a memory allocation error*/
+            closeSamMap(mapST);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        mapST->endLineUL +=
+            sprintf(
+                mapST->lineCStr + mapST->endLineUL,
+                "@SQ\tSN:%s\tLN:%u\n",
+                mapST->refIdx.idAryCStr[ulRef],
+                mapST->refIdx.lenSeqAryUI[ulRef]
+            );
+    } /*Loop: Add each reference to the header*/
+
+    if(!(growMapLine(mapST, 128) & 1))
+    { /*If had a memory allocation error*/
+        closeSamMap(mapST);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    mapST->endLineUL +=
+        sprintf(
+            mapST->lineCStr + mapST->endLineUL,
+            "@PG\tID:findCoInft-in-map\tPN:findCoInft\tVN:%.8f\n",
+            defVersion
+        );
+
+    return 1;
+} /*openSamMap*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if succeded
+|        o 2 if end of file
+|        o 64 if memory allocation error
+|    - Modifies:
+|        o samST to have the next sam entry (same as readSamLine)
+| Note:
+|    - minimap2 entries point into mapST->samBlockST, so they are only
+|      valid till the next call or closeSamMap. Set copyLineBl to keep
+|      each entry in its own samEntryCStr.
+\---------------------------------------------------------------------*/
+uint8_t readSamMap(
+    struct samEntry *samST, /*Gets the next sam entry*/
+    struct samMap *mapST    /*minimap2 or built in mapper output*/
+) /*Reads the next sam entry from minimap2 or the built in mapper*/
+{ /*readSamMap*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: readSamMap
+    '   fun-2 sec-1: Variable declerations
+    '   fun-2 sec-2: Read from minimap2 if not using the built in mapper
+    '   fun-2 sec-3: Map the next query if out of sam entries
+    '   fun-2 sec-4: Copy the next sam entry into samST
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    char *lineCStr = 0;
+    char *tmpCStr = 0;
+    unsigned long lenLineUL = 0;
+    unsigned long lenBuffUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-2: Read from minimap2 if not using the built in mapper
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(mapST->pipeFILE == 0 && mapST->qryFILE == 0)
+    { /*If minimap2 or the mapper could not be started*/
+        if(samST->samEntryCStr == 0)
+        { /*If need a buffer (callers check for a header)*/
+            samST->samEntryCStr = malloc(sizeof(char) * 1401);
+
+            if(samST->samEntryCStr == 0)
+                return 64;
+
+            samST->lenBuffULng = 1400;
+        } /*If need a buffer (callers check for a header)*/
+
+        *samST->samEntryCStr = '\0';
+        samST->lineCStr = samST->samEntryCStr;
+        return 2;
+    } /*If minimap2 or the mapper could not be started*/
+
+    if(!(mapST->inMapBl & 3))
+    { /*If reading from minimap2*/
+        errUC = readSamLine(samST, &mapST->samBlockST);
+
+        if((errUC & 1) && (mapST->copyLineBl & 1))
+            errUC = copySamEntry(samST);
+
+        return errUC;
+    } /*If reading from minimap2*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-3: Map the next query if out of sam entries
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(mapST->onLineUL >= mapST->endLineUL)
+    { /*While need to map the next query*/
+        errUC =
+            readMapSeq(
+                mapST->qryFILE,
+                &mapST->qryIdCStr,
+                &mapST->lenIdUL,
+                &mapST->qrySeqCStr,
+                &mapST->lenSeqUL,
+                &mapST->qryQCStr,
+                &mapST->lenQUL,
+                &mapST->lenQryUI
+            ); /*Get the next query*/
+
+        if(!(errUC & 1))
+            return errUC; /*End of file or memory error*/
+
+        mapST->onLineUL = 0;
+        mapST->endLineUL = 0;
+
+        if(mapST->inMapBl & 2)
+            errUC = alnQuery(mapST);
+        else
+            errUC = mapQuery(mapST);
+
+        if(errUC & 64)
+            return 64;
+    } /*While need to map the next query*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-2 Sec-4: Copy the next sam entry into samST
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    lineCStr = mapST->lineCStr + mapST->onLineUL;
+    tmpCStr = lineCStr;
+
+    while(*tmpCStr != '\n')
+        ++tmpCStr;
+
+    lenLineUL = tmpCStr - lineCStr + 1; /*+ 1 for the new line*/
+
+    if(samST->samEntryCStr == 0 || samST->lenBuffULng < lenLineUL + 2)
+    { /*If the sam entry buffer is to small*/
+        lenBuffUL = samST->lenBuffULng < 1400 ? 1400 :samST->lenBuffULng;
+
+        while(lenBuffUL < lenLineUL + 2)
+            lenBuffUL <<= 1;
+
+        tmpCStr =
+            realloc(samST->samEntryCStr, sizeof(char) * (lenBuffUL + 1));
+
+        if(tmpCStr == 0)
+            return 64;
+
+        samST->samEntryCStr = tmpCStr;
+        samST->lenBuffULng = lenBuffUL;
+    } /*If the sam entry buffer is to small*/
+
+    memcpy(samST->samEntryCStr, lineCStr, lenLineUL);
+    samST->samEntryCStr[lenLineUL] = '\0';
+    samST->lineCStr = samST->samEntryCStr;
+    mapST->onLineUL += lenLineUL;
+
+    processSamEntry(samST);
+    return 1;
+} /*readSamMap*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Closes: The minimap2 pipe or the query file
+|    - Frees: All heap memory used by the built in mapper
+\---------------------------------------------------------------------*/
+void closeSamMap(
+    struct samMap *mapST /*Structure to close*/
+) /*Closes minimap2 or frees the built in mapper*/
+{ /*closeSamMap*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: closeSamMap
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    if(mapST->pipeFILE != 0)
+        pclose(mapST->pipeFILE);
+
+    freeSamBlock(&mapST->samBlockST);
+
+    closeFqFILE(mapST->qryFILE, mapST->qryPipeBl);
+
+    free(mapST->qryIdCStr);
+    free(mapST->qrySeqCStr);
+    free(mapST->qryQCStr);
+    free(mapST->revSeqCStr);
+    free(mapST->revQCStr);
+    free(mapST->skipAryUC);
+
+    free(mapST->minzAry);
+    free(mapST->anchorAry);
+    free(mapST->scoreAryI);
+    free(mapST->parentAryL);
+    free(mapST->orderAryULng);
+    free(mapST->usedAryUC);
+    free(mapST->chainAry);
+
+    free(mapST->hAryI);
+    free(mapST->fAryI);
+    free(mapST->dirAryUC);
+    free(mapST->loAryUI);
+    free(mapST->opCStr);
+    free(mapST->cigarCStr);
+    free(mapST->lineCStr);
+
+    if(mapST->refBitAry != 0)
+    { /*If packed the references for the aligner*/
+        for(
+            unsigned long ulRef = 0;
+            ulRef < mapST->refIdx.numRefsUL;
+            ++ulRef
+        ) freeTwoBitAry(&mapST->refBitAry[ulRef]);
+    } /*If packed the references for the aligner*/
+
+    free(mapST->refBitAry);
+    free(mapST->voteAryUI);
+    freeTwoBitAry(&mapST->qryBitST);
+    freeAlnStruct(&mapST->alnST);
+
+    freeMapRefIdx(&mapST->refIdx);
+    initSamMap(mapST);
+    return;
+} /*closeSamMap*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if read in a sequence
+|        o 2 if at the end of the file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o idCStr, seqCStr, & qCStr to have the id (no '>' or '@'),
+|          sequence, & q-score entry ('\0' for fasta). These are
+|          resized when to small
+|        o lenSeqUI to have the length of the sequence
+\---------------------------------------------------------------------*/
+uint8_t readMapSeq(
+    FILE *inFILE,           /*Fasta or fastq file to read*/
+    char **idCStr,          /*Holds the read id*/
+    unsigned long *lenIdUL, /*Size of idCStr*/
+    char **seqCStr,         /*Holds the sequence*/
+    unsigned long *lenSeqUL,/*Size of seqCStr*/
+    char **qCStr,           /*Holds the q-score entry*/
+    unsigned long *lenQUL,  /*Size of qCStr*/
+    uint32_t *lenSeqUI      /*Gets the length of the sequence*/
+) /*Reads in the next fasta or fastq entry*/
+{ /*readMapSeq*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: readMapSeq
+    '   fun-4 sec-1: Variable declerations
+    '   fun-4 sec-2: Read in the header
+    '   fun-4 sec-3: Read in the sequence
+    '   fun-4 sec-4: Read in the q-score entry (fastq only)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    long lenL = 0;
+    int nextCharI = 0;
+    char *tmpCStr = 0;
+    char *idStartCStr = 0;
+    char fastqBl = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Read in the header
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    do { /*Loop: Find the next header*/
+        lenL = readMapLine(inFILE, idCStr, lenIdUL, 0);
+
+        if(lenL == -1)
+            return 2;
+
+        if(lenL < -1)
+            return 64;
+    } while(**idCStr != '>' && **idCStr != '@');
+      /*Loop: Find the next header*/
+
+    fastqBl = (**idCStr == '@');
+
+    /*Remove the '>' or '@' & anything after the first white space*/
+    idStartCStr = *idCStr + 1;
+    tmpCStr = *idCStr;
+
+    while(*idStartCStr > 32)
+    { /*While have an id to copy*/
+        *tmpCStr = *idStartCStr;
+        ++tmpCStr;
+        ++idStartCStr;
+    } /*While have an id to copy*/
+
+    *tmpCStr = '\0';
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-3: Read in the sequence
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    *lenSeqUI = 0;
+    lenL = 0;
+
+    if(fastqBl)
+    { /*If is a fastq file (sequence is on one line)*/
+        lenL = readMapLine(inFILE, seqCStr, lenSeqUL, 0);
+
+        if(lenL < -1)
+            return 64;
+
+        if(lenL < 0)
+            lenL = 0;
+    } /*If is a fastq file (sequence is on one line)*/
+
+    else
+    { /*Else is a fasta file (sequence can be on multiple lines)*/
+        if(*seqCStr == 0)
+        { /*If have no sequence buffer*/
+            *seqCStr = malloc(sizeof(char) * 1024);
+
+            if(*seqCStr == 0)
+                return 64;
+
+            *lenSeqUL = 1024;
+        } /*If have no sequence buffer*/
+
+        **seqCStr = '\0';
+
+        while(1)
+        { /*Loop: Read in the sequence lines*/
+            nextCharI = getc(inFILE);
+
+            if(nextCharI == EOF)
+                break;
+
+            ungetc(nextCharI, inFILE);
+
+            if(nextCharI == '>')
+                break; /*Start of the next sequence*/
+
+            lenL = readMapLine(inFILE, seqCStr, lenSeqUL, *lenSeqUI);
+
+            if(lenL < -1)
+                return 64;
+
+            if(lenL < 0)
+                break;
+
+            *lenSeqUI = lenL;
+        } /*Loop: Read in the sequence lines*/
+
+        lenL = *lenSeqUI;
+    } /*Else is a fasta file (sequence can be on multiple lines)*/
+
+    *lenSeqUI = lenL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-4: Read in the q-score entry (fastq only)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(fastqBl)
+    { /*If need to read in the q-score entry*/
+        lenL = readMapLine(inFILE, qCStr, lenQUL, 0); /*The + line*/
+
+        if(lenL >= 0)
+            lenL = readMapLine(inFILE, qCStr, lenQUL, 0);
+
+        if(lenL < -1)
+            return 64;
+
+        if(lenL != *lenSeqUI)
+            **qCStr = '\0'; /*No or invalid q-score entry*/
+    } /*If need to read in the q-score entry*/
+
+    else
+    { /*Else is a fasta file*/
+        if(*qCStr == 0)
+        { /*If have no q-score buffer*/
+            *qCStr = malloc(sizeof(char) * 16);
+
+            if(*qCStr == 0)
+                return 64;
+
+            *lenQUL = 16;
+        } /*If have no q-score buffer*/
+
+        **qCStr = '\0';
+    } /*Else is a fasta file*/
+
+    return 1;
+} /*readMapSeq*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Length of buffCStr after the line was added (no new line)
+|        o -1 if at the end of the file
+|        o -2 for memory allocation errors
+|    - Modifies:
+|        o buffCStr to have the line at startUL (resized if to small)
+\---------------------------------------------------------------------*/
+long readMapLine(
+    FILE *inFILE,              /*File to read the line from*/
+    char **buffCStr,           /*Buffer to add the line to*/
+    unsigned long *lenBuffUL,  /*Size of buffCStr*/
+    unsigned long startUL      /*Position in buffCStr to add line at*/
+) /*Reads in a line of any length (no new line) into a buffer*/
+{ /*readMapLine*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: readMapLine
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long endUL = startUL;
+    unsigned long newLenUL = 0;
+    char *tmpCStr = 0;
+
+    while(1)
+    { /*Loop: Read in the line*/
+        if(*buffCStr == 0 || endUL + 2 >= *lenBuffUL)
+        { /*If need a larger buffer*/
+            newLenUL = *lenBuffUL < 512 ? 1024 : *lenBuffUL << 1;
+            tmpCStr = realloc(*buffCStr, sizeof(char) * newLenUL);
+
+            if(tmpCStr == 0)
+                return -2;
+
+            *buffCStr = tmpCStr;
+            *lenBuffUL = newLenUL;
+        } /*If need a larger buffer*/
+
+        if(fgets(*buffCStr + endUL, *lenBuffUL - endUL, inFILE) == 0)
+        { /*If at the end of the file*/
+            (*buffCStr)[endUL] = '\0';
+
+            if(endUL == startUL)
+                return -1;
+
+            return endUL;
+        } /*If at the end of the file*/
+
+        endUL += strlen(*buffCStr + endUL);
+
+        if((*buffCStr)[endUL - 1] == '\n')
+        { /*If read in the full line*/
+            --endUL;
+
+            while(endUL > startUL && (*buffCStr)[endUL - 1] == '\r')
+                --endUL;
+
+            (*buffCStr)[endUL] = '\0';
+            return endUL;
+        } /*If read in the full line*/
+    } /*Loop: Read in the line*/
+} /*readMapLine*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of minimizers in minzAry (startUL + new minimizers)
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o minzAry to have the minimizers after startUL (is resized
+|          when to small)
+\---------------------------------------------------------------------*/
+long getMapMinz(
+    char *seqCStr,             /*Sequence to get minimizers for*/
+    uint32_t lenSeqUI,         /*Length of seqCStr*/
+    uint32_t seqUI,            /*Index to assign to each minimizer*/
+    struct mapMinz **minzAry,  /*Gets the minimizers*/
+    unsigned long *lenMinzUL,  /*Number minimizers minzAry can hold*/
+    unsigned long startUL      /*First index in minzAry to fill*/
+) /*Finds the (w,k) minimizers in a sequence*/
+{ /*getMapMinz*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: getMapMinz
+    '   fun-6 sec-1: Variable declerations
+    '   fun-6 sec-2: Find the hash of each k-mer
+    '   fun-6 sec-3: Keep the smallest hash in each window
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t maskULng = (((uint64_t) 1) << (defMapKmerUC << 1)) - 1;
+    uint8_t shiftUC = (defMapKmerUC - 1) << 1;
+    uint64_t forKmerULng = 0;  /*Forward k-mer*/
+    uint64_t revKmerULng = 0;  /*Reverse complement k-mer*/
+    uint64_t keyULng = 0;
+    uint64_t baseULng = 0;
+    uint32_t lenKmerUI = 0;    /*Number of valid bases in the k-mer*/
+
+    /*Ring buffer with the last window of k-mers; hash 0xffffffff is
+      a k-mer with an anonymous base*/
+    struct mapMinz winAry[defMapWinUC];
+    uint32_t onWinUI = 0;
+    uint32_t minUI = 0;
+    long lastPosL = -1;        /*Position of last minimizer kept*/
+    unsigned long numUL = startUL;
+    struct mapMinz *tmpAry = 0;
+
+    for(uint32_t uiWin = 0; uiWin < defMapWinUC; ++uiWin)
+        winAry[uiWin].hashUI = 0xffffffff;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-6 Sec-2: Find the hash of each k-mer
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t uiBase = 0; uiBase < lenSeqUI; ++uiBase)
+    { /*Loop: Find the minimizers*/
+        switch(seqCStr[uiBase] & ~32)
+        { /*Switch: Convert the base to two bits*/
+            case 'A': baseULng = 0; break;
+            case 'C': baseULng = 1; break;
+            case 'G': baseULng = 2; break;
+            case 'T': baseULng = 3; break;
+            case 'U': baseULng = 3; break;
+            default:  baseULng = 4; break;
+        } /*Switch: Convert the base to two bits*/
+
+        if(baseULng > 3)
+            lenKmerUI = 0; /*Anonymous bases end the k-mer*/
+
+        else
+        { /*Else is a normal base*/
+            forKmerULng = ((forKmerULng << 2) | baseULng) & maskULng;
+            revKmerULng =
+                (revKmerULng >> 2) | ((3 ^ baseULng) << shiftUC);
+            ++lenKmerUI;
+        } /*Else is a normal base*/
+
+        if(uiBase + 1 < defMapKmerUC)
+            continue; /*Do not have a full k-mer yet*/
+
+        onWinUI = (onWinUI + 1) % defMapWinUC;
+        winAry[onWinUI].posUI = uiBase + 1 - defMapKmerUC;
+        winAry[onWinUI].seqUI = seqUI;
+
+        if(lenKmerUI < defMapKmerUC || forKmerULng == revKmerULng)
+            winAry[onWinUI].hashUI = 0xffffffff; /*No strand/N's*/
+
+        else
+        { /*Else hash the canonical k-mer (minimap2 hash64)*/
+            winAry[onWinUI].strandUI = revKmerULng < forKmerULng;
+            keyULng =
+                revKmerULng < forKmerULng ? revKmerULng : forKmerULng;
+
+            keyULng = (~keyULng + (keyULng << 21)) & maskULng;
+            keyULng = keyULng ^ keyULng >> 24;
+            keyULng = ((keyULng + (keyULng << 3)) + (keyULng << 8));
+            keyULng &= maskULng;
+            keyULng = keyULng ^ keyULng >> 14;
+            keyULng = ((keyULng + (keyULng << 2)) + (keyULng << 4));
+            keyULng &= maskULng;
+            keyULng = keyULng ^ keyULng >> 28;
+            keyULng = (keyULng + (keyULng << 31)) & maskULng;
+
+            winAry[onWinUI].hashUI = (uint32_t) keyULng;
+        } /*Else hash the canonical k-mer (minimap2 hash64)*/
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-6 Sec-3: Keep the smallest hash in each window
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        if(uiBase + 2 < defMapKmerUC + defMapWinUC)
+            continue; /*Do not have a full window yet*/
+
+        minUI = onWinUI;
+
+        for(uint32_t uiWin = 0; uiWin < defMapWinUC; ++uiWin)
+        { /*Loop: Find the smallest hash (oldest on ties)*/
+            if(winAry[uiWin].hashUI < winAry[minUI].hashUI)
+                minUI = uiWin;
+
+            else if(
+                   winAry[uiWin].hashUI == winAry[minUI].hashUI
+                && winAry[uiWin].posUI < winAry[minUI].posUI
+            ) minUI = uiWin;
+        } /*Loop: Find the smallest hash (oldest on ties)*/
+
+        if(winAry[minUI].hashUI == 0xffffffff)
+            continue; /*Window only has k-mers with anonymous bases*/
+
+        if((long) winAry[minUI].posUI == lastPosL)
+            continue; /*Already have this minimizer*/
+
+        if(numUL >= *lenMinzUL)
+        { /*If need more memory*/
+            tmpAry =
+                realloc(
+                    *minzAry,
+                    sizeof(struct mapMinz) *
+                        (*lenMinzUL < 512 ? 1024 : *lenMinzUL << 1)
+                );
+
+            if(tmpAry == 0)
+                return -1;
+
+            *minzAry = tmpAry;
+            *lenMinzUL = *lenMinzUL < 512 ? 1024 : *lenMinzUL << 1;
+        } /*If need more memory*/
+
+        (*minzAry)[numUL] = winAry[minUI];
+        lastPosL = winAry[minUI].posUI;
+        ++numUL;
+    } /*Loop: Find the minimizers*/
+
+    return numUL;
+} /*getMapMinz*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if built the index
+|        o 2 if could not open the reference file or had no sequences
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o refIdx to have the references & their sorted minimizers
+| Note:
+|    - refCStr can also be an index saved by writeMapRefIdx, which is
+|      read in instead of rebuilt
+\---------------------------------------------------------------------*/
+uint8_t buildMapRefIdx(
+    struct mapRefIdx *refIdx, /*Gets the index*/
+    char *refCStr             /*Fasta or fastq file with references*/
+) /*Reads in the references & builds their minimizer index*/
+{ /*buildMapRefIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-7 TOC: buildMapRefIdx
+    '   fun-7 sec-1: Variable declerations
+    '   fun-7 sec-2: Read in a saved index (-ref-cache)
+    '   fun-7 sec-3: Read in each reference & find its minimizers
+    '   fun-7 sec-4: Sort the minimizers by hash
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    long numMinzL = 0;
+    uint32_t lenSeqUI = 0;
+    unsigned long lenMinzUL = 0;
+    unsigned long newLenUL = 0;
+
+    char *idCStr = 0;
+    char *seqCStr = 0;
+    char *qCStr = 0;
+    unsigned long lenIdUL = 0;
+    unsigned long lenSeqUL = 0;
+    unsigned long lenQUL = 0;
+
+    char **tmpAryCStr = 0;
+    uint32_t *tmpAryUI = 0;
+    char magicCStr[8];
+
+    FILE *refFILE = fopen(refCStr, "r");
+
+    freeMapRefIdx(refIdx);
+
+    if(refFILE == 0)
+        return 2;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-2: Read in a saved index (-ref-cache)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(
+          fread(magicCStr, sizeof(char), 8, refFILE) == 8
+       && memcmp(magicCStr, defMapIdxMagicCStr, 8) == 0
+    ) { /*If this is an index saved by writeMapRefIdx*/
+        errUC = readMapRefIdx(refIdx, refFILE);
+        fclose(refFILE);
+        return errUC;
+    } /*If this is an index saved by writeMapRefIdx*/
+
+    rewind(refFILE); /*Is a fasta/fastq file*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-3: Read in each reference & find its minimizers
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errUC =
+        readMapSeq(
+            refFILE,
+            &idCStr,
+            &lenIdUL,
+            &seqCStr,
+            &lenSeqUL,
+            &qCStr,
+            &lenQUL,
+            &lenSeqUI
+        ); /*Read in the first reference*/
+
+    while(errUC & 1)
+    { /*While have references to read in*/
+        if(refIdx->numRefsUL >= refIdx->lenRefAryUL)
+        { /*If need more memory for the references*/
+            newLenUL = refIdx->lenRefAryUL + 16;
+
+            tmpAryCStr =
+                realloc(refIdx->idAryCStr, sizeof(char *) * newLenUL);
+            if(tmpAryCStr == 0) {errUC = 64; break;}
+            refIdx->idAryCStr = tmpAryCStr;
+
+            tmpAryCStr =
+                realloc(refIdx->seqAryCStr, sizeof(char *) * newLenUL);
+            if(tmpAryCStr == 0) {errUC = 64; break;}
+            refIdx->seqAryCStr = tmpAryCStr;
+
+            tmpAryUI =
+                realloc(refIdx->lenSeqAryUI, sizeof(uint32_t)*newLenUL);
+            if(tmpAryUI == 0) {errUC = 64; break;}
+            refIdx->lenSeqAryUI = tmpAryUI;
+
+            refIdx->lenRefAryUL = newLenUL;
+        } /*If need more memory for the references*/
+
+        refIdx->idAryCStr[refIdx->numRefsUL] =
+            malloc(sizeof(char) * (strlen(idCStr) + 1));
+        refIdx->seqAryCStr[refIdx->numRefsUL] =
+            malloc(sizeof(char) * (lenSeqUI + 1));
+
+        if(
+              refIdx->idAryCStr[refIdx->numRefsUL] == 0
+           || refIdx->seqAryCStr[refIdx->numRefsUL] == 0
+        ) { /*If had a memory allocation error*/
+            free(refIdx->idAryCStr[refIdx->numRefsUL]);
+            free(refIdx->seqAryCStr[refIdx->numRefsUL]);
+            errUC = 64;
+            break;
+        } /*If had a memory allocation error*/
+
+        strcpy(refIdx->idAryCStr[refIdx->numRefsUL], idCStr);
+        memcpy(refIdx->seqAryCStr[refIdx->numRefsUL], seqCStr,lenSeqUI);
+        refIdx->seqAryCStr[refIdx->numRefsUL][lenSeqUI] = '\0';
+        refIdx->lenSeqAryUI[refIdx->numRefsUL] = lenSeqUI;
+
+        numMinzL =
+            getMapMinz(
+                seqCStr,
+                lenSeqUI,
+                refIdx->numRefsUL,
+                &refIdx->minzAry,
+                &lenMinzUL,
+                refIdx->numMinzUL
+            ); /*Add the references minimizers to the index*/
+
+        ++refIdx->numRefsUL;
+
+        if(numMinzL < 0)
+        { /*If had a memory allocation error*/
+            errUC = 64;
+            break;
+        } /*If had a memory allocation error*/
+
+        refIdx->numMinzUL = numMinzL;
+
+        errUC =
+            readMapSeq(
+                refFILE,
+                &idCStr,
+                &lenIdUL,
+                &seqCStr,
+                &lenSeqUL,
+                &qCStr,
+                &lenQUL,
+                &lenSeqUI
+            ); /*Read in the next reference*/
+    } /*While have references to read in*/
+
+    fclose(refFILE);
+    free(idCStr);
+    free(seqCStr);
+    free(qCStr);
+
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        freeMapRefIdx(refIdx);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    if(refIdx->numRefsUL == 0)
+        return 2;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-4: Sort the minimizers by hash
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    qsort(
+        refIdx->minzAry,
+        refIdx->numMinzUL,
+        sizeof(struct mapMinz),
+        cmpMapMinz
+    );
+
+    return 1;
+} /*buildMapRefIdx*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of chains put in chainAry (sorted by score)
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o anchorAry in mapST is sorted by reference, strand, &
+|          position
+|        o scoreAryI & parentAryL in mapST to have the chains
+|        o chainAry in mapST to have the kept chains
+\---------------------------------------------------------------------*/
+long chainMapAnchors(
+    struct samMap *mapST,      /*Has the anchors to chain*/
+    unsigned long numAnchorsUL /*Number of anchors in anchorAry*/
+) /*Finds the best chains of anchors between a query & references*/
+{ /*chainMapAnchors*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-8 TOC: chainMapAnchors
+    '   fun-8 sec-1: Variable declerations
+    '   fun-8 sec-2: Find the best chain ending at each anchor
+    '   fun-8 sec-3: Pull out chains, starting with the best score
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct mapAnchor *anchorAry = mapST->anchorAry;
+    int32_t *scoreAryI = mapST->scoreAryI;
+    long *parentAryL = mapST->parentAryL;
+    struct mapChain *chainST = 0;
+
+    long backL = 0;            /*Anchor looking back at*/
+    long lastL = 0;            /*Last anchor in a chain*/
+    long endL = 0;             /*Last anchor to look back at*/
+    long numChainsL = 0;
+    int32_t bestScoreI = 0;
+    int32_t scoreI = 0;
+    int32_t gapCostI = 0;
+    int64_t refDiffL = 0;      /*Distance between anchors on ref*/
+    int64_t qryDiffL = 0;      /*Distance between anchors on query*/
+    int64_t gapL = 0;          /*Size of the indel between anchors*/
+    uint32_t numUI = 0;
+    uint32_t log2UI = 0;
+    uint32_t qryStartUI = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Find the best chain ending at each anchor
+    ^   - This is the minimap2 chaining score with a fixed look back
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    qsort(
+        anchorAry,
+        numAnchorsUL,
+        sizeof(struct mapAnchor),
+        cmpMapAnchor
+    );
+
+    for(long lAnc = 0; lAnc < (long) numAnchorsUL; ++lAnc)
+    { /*Loop: Find the best chain ending at each anchor*/
+        bestScoreI = defMapKmerUC;
+        parentAryL[lAnc] = -1;
+        endL = lAnc - defMapLookBackUI;
+
+        if(endL < 0)
+            endL = 0;
+
+        for(backL = lAnc - 1; backL >= endL; --backL)
+        { /*Loop: Look back at the previous anchors*/
+            if(
+                  anchorAry[backL].refUI != anchorAry[lAnc].refUI
+               || anchorAry[backL].strandUI != anchorAry[lAnc].strandUI
+            ) break; /*Anchors are on different references*/
+
+            refDiffL =
+                  (int64_t) anchorAry[lAnc].refPosUI
+                - (int64_t) anchorAry[backL].refPosUI;
+
+            if(refDiffL > defMapMaxGapUI)
+                break; /*Anchors are sorted, so all others are farther*/
+
+            qryDiffL =
+                  (int64_t) anchorAry[lAnc].qryPosUI
+                - (int64_t) anchorAry[backL].qryPosUI;
+
+            if(refDiffL <= 0 || qryDiffL <= 0 || qryDiffL >defMapMaxGapUI)
+                continue; /*Anchors are out of order or to far apart*/
+
+            gapL = refDiffL > qryDiffL ?
+                refDiffL - qryDiffL : qryDiffL - refDiffL;
+
+            if(gapL > defMapChainBandUI)
+                continue; /*Indel is to large*/
+
+            scoreI = refDiffL < qryDiffL ? refDiffL : qryDiffL;
+
+            if(scoreI > defMapKmerUC)
+                scoreI = defMapKmerUC;
+
+            gapCostI = 0;
+
+            if(gapL > 0)
+            { /*If need to find the gap cost*/
+                log2UI = 0;
+
+                for(int64_t lGap = gapL; lGap > 1; lGap >>= 1)
+                    ++log2UI;
+
+                /*0.01 * k * gap + 0.5 * log2(gap)*/
+                gapCostI = (gapL * defMapKmerUC) / 100 + (log2UI >> 1);
+            } /*If need to find the gap cost*/
+
+            scoreI += scoreAryI[backL] - gapCostI;
+
+            if(scoreI > bestScoreI)
+            { /*If this is a better chain*/
+                bestScoreI = scoreI;
+                parentAryL[lAnc] = backL;
+            } /*If this is a better chain*/
+        } /*Loop: Look back at the previous anchors*/
+
+        scoreAryI[lAnc] = bestScoreI;
+        mapST->usedAryUC[lAnc] = 0;
+
+        mapST->orderAryULng[lAnc] =
+            (((uint64_t) bestScoreI) << 32) | (uint64_t) lAnc;
+    } /*Loop: Find the best chain ending at each anchor*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Pull out chains, starting with the best score
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    qsort(
+        mapST->orderAryULng,
+        numAnchorsUL,
+        sizeof(uint64_t),
+        cmpMapOrder
+    ); /*Sort anchors from best to worst score*/
+
+    for(unsigned long ulAnc = 0; ulAnc < numAnchorsUL; ++ulAnc)
+    { /*Loop: Pull out chains*/
+        lastL = mapST->orderAryULng[ulAnc] & 0xffffffff;
+
+        if(mapST->usedAryUC[lastL])
+            continue; /*Anchor is in a better chain*/
+
+        numUI = 0;
+        backL = lastL;
+
+        while(backL >= 0 && !mapST->usedAryUC[backL])
+        { /*While have anchors in the chain*/
+            mapST->usedAryUC[backL] = 1;
+            qryStartUI = anchorAry[backL].qryPosUI;
+            ++numUI;
+            backL = parentAryL[backL];
+        } /*While have anchors in the chain*/
+
+        scoreI = scoreAryI[lastL];
+
+        if(backL >= 0)
+            scoreI -= scoreAryI[backL]; /*Chain ran into a better one*/
+
+        if(scoreI < defMapMinScoreI || numUI < defMapMinAnchorsUI)
+            continue;
+
+        chainST = mapST->chainAry + numChainsL;
+        chainST->scoreI = scoreI;
+        chainST->endUI = lastL;
+        chainST->numUI = numUI;
+        chainST->refUI = anchorAry[lastL].refUI;
+        chainST->strandUI = anchorAry[lastL].strandUI;
+        chainST->qryStartUI = qryStartUI;
+        chainST->qryEndUI = anchorAry[lastL].qryPosUI + defMapKmerUC;
+
+        if(chainST->strandUI)
+        { /*If need to convert to the forward query coordinates*/
+            qryStartUI = chainST->qryStartUI;
+            chainST->qryStartUI = mapST->lenQryUI - chainST->qryEndUI;
+            chainST->qryEndUI = mapST->lenQryUI - qryStartUI;
+        } /*If need to convert to the forward query coordinates*/
+
+        ++numChainsL;
+    } /*Loop: Pull out chains*/
+
+    qsort(
+        mapST->chainAry,
+        numChainsL,
+        sizeof(struct mapChain),
+        cmpMapChain
+    );
+
+    return numChainsL;
+} /*chainMapAnchors*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Alignment score (0 if nothing aligned)
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o cigarCStr in mapST to have the eqx cigar (soft masks on ends)
+|        o refStartUI & numDiffUI to have the first aligned reference
+|          base (index 0) & edit distance
+\---------------------------------------------------------------------*/
+long alnMapChain(
+    struct samMap *mapST,    /*Has the chain & scratch buffers*/
+    char *qrySeqCStr,        /*Query sequence (reverse complemented if
+                               the chain is on the reverse strand)*/
+    struct mapChain *chainST,/*Chain to align around*/
+    uint32_t *refStartUI,    /*Gets first aligned base on reference*/
+    uint32_t *numDiffUI      /*Gets number of differences (NM)*/
+) /*Does a banded local alignment of a query around a chain*/
+{ /*alnMapChain*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-9 TOC: alnMapChain
+    '   fun-9 sec-1: Variable declerations
+    '   fun-9 sec-2: Get the chain anchors & reference window
+    '   fun-9 sec-3: Make sure have memory for the alignment
+    '   fun-9 sec-4: Fill the banded alignment matrix
+    '   fun-9 sec-5: Trace back the alignment
+    '   fun-9 sec-6: Make the cigar
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Anything at or below this is out of the band*/
+    int32_t negI = -0x3fffffff;
+    int32_t gapOpenI = defMapGapOpenI + defMapGapExtI;
+
+    char *refSeqCStr = mapST->refIdx.seqAryCStr[chainST->refUI];
+    uint32_t lenRefUI = mapST->refIdx.lenSeqAryUI[chainST->refUI];
+    uint32_t lenQryUI = mapST->lenQryUI;
+    uint64_t *ancAryULng = mapST->orderAryULng; /*Chain anchors*/
+    struct mapAnchor *ancST = 0;
+    struct mapAnchor *nextAncST = 0;
+
+    long onAncL = 0;
+    long backL = 0;
+    int64_t centerL = 0;        /*Reference base in the band center*/
+    int64_t winStartL = 0;      /*First reference base in the window*/
+    int64_t winEndL = 0;        /*Last reference base in the window*/
+    long lenWinL = 0;
+    long loL = 0;               /*First column of the band in a row*/
+    long hiL = 0;               /*Last column of the band in a row*/
+    long prevLoL = 0;
+    long prevHiL = 0;
+    unsigned long bandUL = (defMapBandUI << 1) + 1;
+    unsigned long newLenUL = 0;
+
+    int32_t *hPrevAryI = 0;
+    int32_t *hCurAryI = 0;
+    int32_t *swapAryI = 0;
+    int32_t *fAryI = 0;
+    uint8_t *dirAryUC = 0;
+    uint8_t dirUC = 0;
+
+    int32_t diagI = 0;
+    int32_t upI = 0;
+    int32_t fUpI = 0;
+    int32_t eI = 0;
+    int32_t leftI = 0;
+    int32_t fI = 0;
+    int32_t hI = 0;
+    int32_t bestI = 0;
+    long bestRowL = 0;
+    long bestColL = 0;
+    char qryBaseC = 0;
+    char refBaseC = 0;
+
+    long rowL = 0;
+    long colL = 0;
+    uint8_t stateUC = 0;        /*0: match/snp, 1: deletion, 2: ins*/
+    unsigned long numOpUL = 0;
+    char opC = 0;
+    char *cigarCStr = 0;
+    uint32_t lenOpUI = 0;
+
+    void *tmpPtr = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-2: Get the chain anchors & reference window
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*orderAryULng is no longer needed after chaining, so it is reused
+      to hold the chains anchors (first to last)*/
+    backL = chainST->endUI;
+
+    for(long lAnc = chainST->numUI - 1; lAnc >= 0; --lAnc)
+    { /*Loop: Get the anchors in the chain*/
+        ancAryULng[lAnc] = backL;
+        backL = mapST->parentAryL[backL];
+    } /*Loop: Get the anchors in the chain*/
+
+    /*Center of the band on the first & last query base*/
+    ancST = mapST->anchorAry + ancAryULng[0];
+    winStartL = (int64_t) ancST->refPosUI - (int64_t) ancST->qryPosUI;
+
+    ancST = mapST->anchorAry + ancAryULng[chainST->numUI - 1];
+    winEndL =
+          (int64_t) ancST->refPosUI
+        + ((int64_t) lenQryUI - (int64_t) ancST->qryPosUI - 1);
+
+    winStartL -= defMapBandUI;
+    winEndL += defMapBandUI;
+
+    if(winStartL < 0)
+        winStartL = 0;
+
+    if(winEndL >= (int64_t) lenRefUI)
+        winEndL = (int64_t) lenRefUI - 1;
+
+    lenWinL = winEndL - winStartL + 1;
+
+    if(lenWinL <= 0 || lenQryUI == 0)
+        return 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-3: Make sure have memory for the alignment
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(mapST->lenRowUL < (unsigned long) lenWinL + 1)
+    { /*If need larger rows*/
+        newLenUL = lenWinL + 1;
+
+        tmpPtr = realloc(mapST->hAryI, sizeof(int32_t) * (newLenUL << 1));
+        if(tmpPtr == 0) return -1;
+        mapST->hAryI = tmpPtr;
+
+        tmpPtr = realloc(mapST->fAryI, sizeof(int32_t) * newLenUL);
+        if(tmpPtr == 0) return -1;
+        mapST->fAryI = tmpPtr;
+
+        mapST->lenRowUL = newLenUL;
+    } /*If need larger rows*/
+
+    if(mapST->lenDirUL < (unsigned long) lenQryUI * bandUL)
+    { /*If need a larger traceback matrix*/
+        newLenUL = (unsigned long) lenQryUI * bandUL;
+        tmpPtr = realloc(mapST->dirAryUC, sizeof(uint8_t) * newLenUL);
+        if(tmpPtr == 0) return -1;
+        mapST->dirAryUC = tmpPtr;
+        mapST->lenDirUL = newLenUL;
+    } /*If need a larger traceback matrix*/
+
+    if(mapST->lenLoUL < (unsigned long) lenQryUI + 1)
+    { /*If need more band starts*/
+        newLenUL = lenQryUI + 1;
+        tmpPtr = realloc(mapST->loAryUI, sizeof(uint32_t) * newLenUL);
+        if(tmpPtr == 0) return -1;
+        mapST->loAryUI = tmpPtr;
+        mapST->lenLoUL = newLenUL;
+    } /*If need more band starts*/
+
+    /*Worst case is every query & reference base is an operation,
+      which gives two characters per operation in the cigar*/
+    newLenUL = ((unsigned long) lenQryUI + lenWinL + 2) << 1;
+    newLenUL += 32;
+
+    if(mapST->lenOpUL < newLenUL)
+    { /*If need a larger cigar buffer*/
+        tmpPtr = realloc(mapST->opCStr, sizeof(char) * newLenUL);
+        if(tmpPtr == 0) return -1;
+        mapST->opCStr = tmpPtr;
+
+        tmpPtr = realloc(mapST->cigarCStr, sizeof(char) * newLenUL * 6);
+        if(tmpPtr == 0) return -1;
+        mapST->cigarCStr = tmpPtr;
+
+        mapST->lenOpUL = newLenUL;
+    } /*If need a larger cigar buffer*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-4: Fill the banded alignment matrix
+    ^   o fun-9 sec-4 sub-1: Set up the first row (local alignment)
+    ^   o fun-9 sec-4 sub-2: Find the band for the row
+    ^   o fun-9 sec-4 sub-3: Score each cell in the band
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /******************************************************************\
+    * Fun-9 Sec-4 Sub-1: Set up the first row (local alignment)
+    \******************************************************************/
+
+    /*Columns are 1 to lenWinL (0 is before the window). Rows are 1 to
+      lenQryUI. Direction bits: 0-1 cell source (0 start, 1 diagonal,
+      2 deletion, 3 insertion), 4 deletion extended, 8 ins extended*/
+    hPrevAryI = mapST->hAryI;
+    hCurAryI = mapST->hAryI + mapST->lenRowUL;
+    fAryI = mapST->fAryI;
+    dirAryUC = mapST->dirAryUC;
+
+    for(long lCol = 0; lCol <= lenWinL; ++lCol)
+    { /*Loop: Set up the first row*/
+        hPrevAryI[lCol] = 0;
+        fAryI[lCol] = negI;
+    } /*Loop: Set up the first row*/
+
+    prevLoL = 0;
+    prevHiL = lenWinL;
+    onAncL = 0;
+    ancST = mapST->anchorAry + ancAryULng[0];
+
+    for(rowL = 1; rowL <= (long) lenQryUI; ++rowL)
+    { /*Loop: Fill the alignment matrix*/
+
+        /**************************************************************\
+        * Fun-9 Sec-4 Sub-2: Find the band for the row
+        \**************************************************************/
+
+        /*The band follows the chain, with lines between anchors*/
+        while(
+              onAncL + 1 < (long) chainST->numUI
+           && mapST->anchorAry[ancAryULng[onAncL+1]].qryPosUI < rowL
+        ) { /*While the next anchor is before this query base*/
+            ++onAncL;
+            ancST = mapST->anchorAry + ancAryULng[onAncL];
+        } /*While the next anchor is before this query base*/
+
+        if(
+              (long) ancST->qryPosUI >= rowL
+           || onAncL + 1 >= (long) chainST->numUI
+        ) { /*If before the first anchor or after the last anchor*/
+            centerL =
+                  (int64_t) ancST->refPosUI
+                + (rowL - 1 - (int64_t) ancST->qryPosUI);
+        } /*If before the first anchor or after the last anchor*/
+
+        else
+        { /*Else between two anchors*/
+            nextAncST = mapST->anchorAry + ancAryULng[onAncL + 1];
+
+            centerL =
+                  (int64_t) ancST->refPosUI
+                +   (rowL - 1 - (int64_t) ancST->qryPosUI)
+                  * ((int64_t) nextAncST->refPosUI - ancST->refPosUI)
+                  / ((int64_t) nextAncST->qryPosUI - ancST->qryPosUI);
+        } /*Else between two anchors*/
+
+        centerL = centerL - winStartL + 1; /*To window columns*/
+        loL = centerL - defMapBandUI;
+        hiL = centerL + defMapBandUI;
+
+        if(loL < 1)
+            loL = 1;
+
+        if(hiL > lenWinL)
+            hiL = lenWinL;
+
+        mapST->loAryUI[rowL] = loL;
+
+        /**************************************************************\
+        * Fun-9 Sec-4 Sub-3: Score each cell in the band
+        \**************************************************************/
+
+        eI = negI;
+        leftI = negI;
+        qryBaseC = qrySeqCStr[rowL - 1] & ~32;
+
+        for(colL = loL; colL <= hiL; ++colL)
+        { /*Loop: Score each cell in the band*/
+            if(colL == 1)
+                diagI = 0; /*Before the window (local alignment)*/
+            else if(colL - 1 >= prevLoL && colL - 1 <= prevHiL)
+                diagI = hPrevAryI[colL - 1];
+            else
+                diagI = negI;
+
+            if(colL >= prevLoL && colL <= prevHiL)
+            { /*If the cell above is in the band*/
+                upI = hPrevAryI[colL];
+                fUpI = fAryI[colL];
+            } /*If the cell above is in the band*/
+
+            else
+            { /*Else the cell above is out of the band*/
+                upI = negI;
+                fUpI = negI;
+            } /*Else the cell above is out of the band*/
+
+            refBaseC = refSeqCStr[winStartL + colL - 1] & ~32;
+
+            if(qryBaseC == refBaseC && qryBaseC != 'N')
+                diagI += defMapMatchI;
+            else
+                diagI -= defMapSnpI;
+
+            dirUC = 0;
+
+            /*Deletion (from the cell to the left)*/
+            if(eI - defMapGapExtI >= leftI - gapOpenI)
+            { /*If extending the deletion*/
+                eI -= defMapGapExtI;
+                dirUC |= 4;
+            } /*If extending the deletion*/
+
+            else
+                eI = leftI - gapOpenI;
+
+            /*Insertion (from the cell above)*/
+            if(fUpI - defMapGapExtI >= upI - gapOpenI)
+            { /*If extending the insertion*/
+                fI = fUpI - defMapGapExtI;
+                dirUC |= 8;
+            } /*If extending the insertion*/
+
+            else
+                fI = upI - gapOpenI;
+
+            if(eI < negI)
+                eI = negI;
+
+            if(fI < negI)
+                fI = negI;
+
+            hI = 0; /*Local alignment, so can start anywhere*/
+
+            if(diagI > hI)
+            { /*If a match or snp is best*/
+                hI = diagI;
+                dirUC = (dirUC & ~3) | 1;
+            } /*If a match or snp is best*/
+
+            if(eI > hI)
+            { /*If a deletion is best*/
+                hI = eI;
+                dirUC = (dirUC & ~3) | 2;
+            } /*If a deletion is best*/
+
+            if(fI > hI)
+            { /*If an insertion is best*/
+                hI = fI;
+                dirUC = (dirUC & ~3) | 3;
+            } /*If an insertion is best*/
+
+            hCurAryI[colL] = hI;
+            fAryI[colL] = fI;
+            leftI = hI;
+            dirAryUC[(rowL - 1) * bandUL + (colL - loL)] = dirUC;
+
+            if(hI > bestI)
+            { /*If this is the best score*/
+                bestI = hI;
+                bestRowL = rowL;
+                bestColL = colL;
+            } /*If this is the best score*/
+        } /*Loop: Score each cell in the band*/
+
+        swapAryI = hPrevAryI;
+        hPrevAryI = hCurAryI;
+        hCurAryI = swapAryI;
+        prevLoL = loL;
+        prevHiL = hiL;
+    } /*Loop: Fill the alignment matrix*/
+
+    if(bestI <= 0)
+        return 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-5: Trace back the alignment
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    rowL = bestRowL;
+    colL = bestColL;
+    stateUC = 0;
+    numOpUL = 0;
+    *numDiffUI = 0;
+
+    while(rowL > 0 && colL > 0)
+    { /*While have operations to trace back*/
+        if(
+              colL < (long) mapST->loAryUI[rowL]
+           || colL - (long) mapST->loAryUI[rowL] >= (long) bandUL
+        ) break; /*Should not happen, but left the band*/
+
+        dirUC =
+            dirAryUC[(rowL-1) * bandUL + (colL - mapST->loAryUI[rowL])];
+
+        if(stateUC == 0)
+        { /*If on a match or snp*/
+            if((dirUC & 3) == 0)
+                break; /*Start of the alignment*/
+
+            if((dirUC & 3) == 2)
+            { /*If moving to a deletion*/
+                stateUC = 1;
+                continue;
+            } /*If moving to a deletion*/
+
+            if((dirUC & 3) == 3)
+            { /*If moving to an insertion*/
+                stateUC = 2;
+                continue;
+            } /*If moving to an insertion*/
+
+            qryBaseC = qrySeqCStr[rowL - 1] & ~32;
+            refBaseC = refSeqCStr[winStartL + colL - 1] & ~32;
+
+            if(qryBaseC == refBaseC && qryBaseC != 'N')
+                opC = '=';
+            else
+            { /*Else is a snp*/
+                opC = 'X';
+                ++(*numDiffUI);
+            } /*Else is a snp*/
+
+            --rowL;
+            --colL;
+        } /*If on a match or snp*/
+
+        else if(stateUC == 1)
+        { /*Else if on a deletion*/
+            opC = 'D';
+            stateUC = (dirUC & 4) ? 1 : 0;
+            ++(*numDiffUI);
+            --colL;
+        } /*Else if on a deletion*/
+
+        else
+        { /*Else on an insertion*/
+            opC = 'I';
+            stateUC = (dirUC & 8) ? 2 : 0;
+            ++(*numDiffUI);
+            --rowL;
+        } /*Else on an insertion*/
+
+        mapST->opCStr[numOpUL] = opC;
+        ++numOpUL;
+    } /*While have operations to trace back*/
+
+    *refStartUI = winStartL + colL;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-6: Make the cigar
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    cigarCStr = mapST->cigarCStr;
+
+    if(rowL > 0)
+    { /*If have soft masked bases at the start*/
+        cigarCStr = uIntToCStr(cigarCStr, rowL);
+        *cigarCStr++ = 'S';
+    } /*If have soft masked bases at the start*/
+
+    /*The operations are in reverse order*/
+    while(numOpUL > 0)
+    { /*While have operations to add to the cigar*/
+        opC = mapST->opCStr[numOpUL - 1];
+        lenOpUI = 0;
+
+        while(numOpUL > 0 && mapST->opCStr[numOpUL - 1] == opC)
+        { /*While have the same operation*/
+            ++lenOpUI;
+            --numOpUL;
+        } /*While have the same operation*/
+
+        cigarCStr = uIntToCStr(cigarCStr, lenOpUI);
+        *cigarCStr++ = opC;
+    } /*While have operations to add to the cigar*/
+
+    if(bestRowL < (long) lenQryUI)
+    { /*If have soft masked bases at the end*/
+        cigarCStr = uIntToCStr(cigarCStr, lenQryUI - bestRowL);
+        *cigarCStr++ = 'S';
+    } /*If have soft masked bases at the end*/
+
+    *cigarCStr = '\0';
+    return bestI;
+} /*alnMapChain*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if mapped (or did not map) the query
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have the sam entries for the query
+\---------------------------------------------------------------------*/
+uint8_t mapQuery(
+    struct samMap *mapST /*Has the query & index to map with*/
+) /*Maps the current query in mapST to the reference index*/
+{ /*mapQuery*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-10 TOC: mapQuery
+    '   fun-10 sec-1: Variable declerations
+    '   fun-10 sec-2: Make the reverse complement of the query
+    '   fun-10 sec-3: Find the anchors shared with the references
+    '   fun-10 sec-4: Chain the anchors
+    '   fun-10 sec-5: Align the best chains & make the sam entries
+    '   fun-10 sec-6: Make an unmapped entry if nothing mapped
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct mapRefIdx *refIdx = &mapST->refIdx;
+    struct mapMinz *qryMinzST = 0;
+    struct mapMinz *refMinzST = 0;
+    struct mapAnchor *ancST = 0;
+    struct mapChain *chainST = 0;
+
+    long numMinzL = 0;
+    long numChainsL = 0;
+    long alnScoreL = 0;
+    unsigned long numAnchorsUL = 0;
+    unsigned long firstUL = 0;  /*First hit in the index*/
+    unsigned long lastUL = 0;   /*One past last hit in the index*/
+    unsigned long midUL = 0;
+    unsigned long lenNeedUL = 0;
+
+    uint32_t refStartUI = 0;
+    uint32_t numDiffUI = 0;
+    uint32_t ovlpStartUI = 0;
+    uint32_t ovlpEndUI = 0;
+    uint32_t lenShortUI = 0;
+    int32_t secScoreI = 0;      /*Best score of an overlapping chain*/
+    uint32_t mapqUI = 0;
+    uint32_t log2UI = 0;
+    float mapqF = 0;
+    float lnF = 0;
+    char firstBl = 1;           /*1: Next entry is the primary*/
+    char *seqCStr = 0;
+    char *qCStr = 0;
+    char *tmpCStr = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-2: Make the reverse complement of the query
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(!(revCompMapQuery(mapST) & 1))
+        return 64;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-3: Find the anchors shared with the references
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    numMinzL =
+        getMapMinz(
+            mapST->qrySeqCStr,
+            mapST->lenQryUI,
+            0,
+            &mapST->minzAry,
+            &mapST->lenMinzUL,
+            0
+        ); /*Get the minimizers in the query*/
+
+    if(numMinzL < 0)
+        return 64;
+
+    for(long lMinz = 0; lMinz < numMinzL; ++lMinz)
+    { /*Loop: Find the references with each minimizer*/
+        qryMinzST = mapST->minzAry + lMinz;
+
+        /*Binary search for the first minimizer with the hash*/
+        firstUL = 0;
+        lastUL = refIdx->numMinzUL;
+
+        while(firstUL < lastUL)
+        { /*While searching for the first hit*/
+            midUL = (firstUL + lastUL) >> 1;
+
+            if(refIdx->minzAry[midUL].hashUI < qryMinzST->hashUI)
+                firstUL = midUL + 1;
+            else
+                lastUL = midUL;
+        } /*While searching for the first hit*/
+
+        lastUL = firstUL;
+
+        while(
+              lastUL < refIdx->numMinzUL
+           && refIdx->minzAry[lastUL].hashUI == qryMinzST->hashUI
+        ) ++lastUL;
+
+        if(lastUL - firstUL > defMapMaxOccUI)
+            continue; /*Repetitive minimizer*/
+
+        if(numAnchorsUL + (lastUL - firstUL) > mapST->lenAnchorUL)
+        { /*If need more memory for the anchors*/
+            if(!(growSamMapAnchors(mapST,numAnchorsUL+lastUL-firstUL)&1))
+                return 64;
+        } /*If need more memory for the anchors*/
+
+        for(unsigned long ulHit = firstUL; ulHit < lastUL; ++ulHit)
+        { /*Loop: Add an anchor for each hit*/
+            refMinzST = refIdx->minzAry + ulHit;
+
+            if((mapST->allVsAllBl & 1) && mapST->skipAryUC[refMinzST->seqUI])
+                continue; /*Self or dual mapping*/
+
+            ancST = mapST->anchorAry + numAnchorsUL;
+            ancST->refUI = refMinzST->seqUI;
+            ancST->refPosUI = refMinzST->posUI;
+            ancST->strandUI = qryMinzST->strandUI ^ refMinzST->strandUI;
+
+            if(ancST->strandUI)
+                ancST->qryPosUI =
+                    mapST->lenQryUI - qryMinzST->posUI - defMapKmerUC;
+            else
+                ancST->qryPosUI = qryMinzST->posUI;
+
+            ++numAnchorsUL;
+        } /*Loop: Add an anchor for each hit*/
+    } /*Loop: Find the references with each minimizer*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-4: Chain the anchors
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(numAnchorsUL > 0)
+        numChainsL = chainMapAnchors(mapST, numAnchorsUL);
+
+    if(numChainsL < 0)
+        return 64;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-5: Align the best chains & make the sam entries
+    ^   o fun-10 sec-5 sub-1: Find the mapping quality (minimap2 style)
+    ^   o fun-10 sec-5 sub-2: Align the chain
+    ^   o fun-10 sec-5 sub-3: Add the sam entry
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(long lChain = 0; lChain < numChainsL; ++lChain)
+    { /*Loop: Align chains & make sam entries*/
+        chainST = mapST->chainAry + lChain;
+
+        if(mapST->allVsAllBl & 1)
+        { /*If reporting the best chain for each reference*/
+            if(mapST->skipAryUC[chainST->refUI])
+                continue; /*Already have this reference*/
+
+            mapST->skipAryUC[chainST->refUI] = 1;
+        } /*If reporting the best chain for each reference*/
+
+        /**************************************************************\
+        * Fun-10 Sec-5 Sub-1: Find the mapping quality (minimap2 style)
+        \**************************************************************/
+
+        mapqUI = 0;
+
+        if(firstBl)
+        { /*If this is the primary alignment*/
+            secScoreI = 0;
+
+            for(long lOther = 0; lOther < numChainsL; ++lOther)
+            { /*Loop: Find the best chain covering the same bases*/
+                if(lOther == lChain)
+                    continue;
+
+                ovlpStartUI = chainST->qryStartUI;
+                ovlpEndUI = chainST->qryEndUI;
+
+                if(mapST->chainAry[lOther].qryStartUI > ovlpStartUI)
+                    ovlpStartUI = mapST->chainAry[lOther].qryStartUI;
+
+                if(mapST->chainAry[lOther].qryEndUI < ovlpEndUI)
+                    ovlpEndUI = mapST->chainAry[lOther].qryEndUI;
+
+                lenShortUI = chainST->qryEndUI - chainST->qryStartUI;
+
+                if(
+                    mapST->chainAry[lOther].qryEndUI
+                  - mapST->chainAry[lOther].qryStartUI < lenShortUI
+                ) lenShortUI =
+                      mapST->chainAry[lOther].qryEndUI
+                    - mapST->chainAry[lOther].qryStartUI;
+
+                if(ovlpEndUI <= ovlpStartUI)
+                    continue;
+
+                if((ovlpEndUI - ovlpStartUI) << 1 < lenShortUI)
+                    continue; /*Chains cover different parts of query*/
+
+                if(mapST->chainAry[lOther].scoreI > secScoreI)
+                    secScoreI = mapST->chainAry[lOther].scoreI;
+            } /*Loop: Find the best chain covering the same bases*/
+
+            /*40 * (1 - f2 / f1) * min(1, anchors / 10) * ln(f1)*/
+            log2UI = 0;
+
+            for(int32_t iScore = chainST->scoreI; iScore > 1; iScore >>= 1)
+                ++log2UI;
+
+            lnF =
+                (  (float) log2UI
+                 + (float) (chainST->scoreI - (1 << log2UI))
+                 / (float) (1 << log2UI)
+                ) * 0.6931f;
+
+            mapqF =
+                40.0f * (1.0f - (float)secScoreI / (float)chainST->scoreI)
+              * (chainST->numUI >= 10 ? 1.0f : chainST->numUI / 10.0f)
+              * lnF;
+
+            mapqUI = mapqF < 0 ? 0 : (uint32_t) (mapqF + 0.499f);
+
+            if(mapqUI > 60)
+                mapqUI = 60;
+        } /*If this is the primary alignment*/
+
+        /**************************************************************\
+        * Fun-10 Sec-5 Sub-2: Align the chain
+        \**************************************************************/
+
+        seqCStr =
+            chainST->strandUI ? mapST->revSeqCStr : mapST->qrySeqCStr;
+
+        alnScoreL =
+            alnMapChain(
+                mapST,
+                seqCStr,
+                chainST,
+                &refStartUI,
+                &numDiffUI
+            ); /*Align the query around the chain*/
+
+        if(alnScoreL < 0)
+            return 64;
+
+        if(alnScoreL == 0)
+            continue;
+
+        /**************************************************************\
+        * Fun-10 Sec-5 Sub-3: Add the sam entry
+        \**************************************************************/
+
+        qCStr = chainST->strandUI ? mapST->revQCStr : mapST->qryQCStr;
+
+        if(*qCStr == '\0')
+            qCStr = "*";
+
+        if(!firstBl)
+        { /*If is a secondary alignment (minimap2 prints no sequence)*/
+            seqCStr = "*";
+            qCStr = "*";
+        } /*If is a secondary alignment (minimap2 prints no sequence)*/
+
+        lenNeedUL =
+              strlen(mapST->qryIdCStr)
+            + strlen(refIdx->idAryCStr[chainST->refUI])
+            + strlen(mapST->cigarCStr)
+            + ((unsigned long) mapST->lenQryUI << 1)
+            + 128;
+
+        if(!(growMapLine(mapST, lenNeedUL) & 1))
+            return 64;
+
+        tmpCStr = mapST->lineCStr + mapST->endLineUL;
+
+        tmpCStr +=
+            sprintf(
+                tmpCStr,
+                "%s\t%u\t%s\t%u\t%u\t%s\t*\t0\t0\t%s\t%s",
+                mapST->qryIdCStr,
+                (chainST->strandUI << 4) | (firstBl ? 0 : 256),
+                refIdx->idAryCStr[chainST->refUI],
+                refStartUI + 1,
+                mapqUI,
+                mapST->cigarCStr,
+                seqCStr,
+                qCStr
+            ); /*Add the sam entry*/
+
+        tmpCStr +=
+            sprintf(
+                tmpCStr,
+                "\tNM:i:%u\tAS:i:%ld\ttp:A:%c\n",
+                numDiffUI,
+                alnScoreL,
+                firstBl ? 'P' : 'S'
+            ); /*Add the tags*/
+
+        mapST->endLineUL = tmpCStr - mapST->lineCStr;
+        firstBl = 0;
+
+        if(!(mapST->allVsAllBl & 1))
+            break; /*Only reporting the primary alignment*/
+    } /*Loop: Align chains & make sam entries*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-10 Sec-6: Make an unmapped entry if nothing mapped
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(firstBl)
+        return addMapUnmapped(mapST); /*The query did not map*/
+
+    return 1;
+} /*mapQuery*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if have enough memory
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revSeqCStr & revQCStr in mapST to hold the current query
+\---------------------------------------------------------------------*/
+uint8_t growSamMapBuff(
+    struct samMap *mapST /*Has the query & buffers to resize*/
+) /*Makes sure the reverse complement buffers can hold the query*/
+{ /*growSamMapBuff*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-11 TOC: Sec-1 Sub-1: growSamMapBuff
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *tmpCStr = 0;
+    unsigned long newLenUL = 0;
+
+    if(mapST->lenRevUL > mapST->lenQryUI)
+        return 1;
+
+    newLenUL = ((unsigned long) mapST->lenQryUI << 1) + 1;
+
+    tmpCStr = realloc(mapST->revSeqCStr, sizeof(char) * newLenUL);
+
+    if(tmpCStr == 0)
+        return 64;
+
+    mapST->revSeqCStr = tmpCStr;
+    tmpCStr = realloc(mapST->revQCStr, sizeof(char) * newLenUL);
+
+    if(tmpCStr == 0)
+        return 64;
+
+    mapST->revQCStr = tmpCStr;
+    mapST->lenRevUL = newLenUL;
+    return 1;
+} /*growSamMapBuff*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if have enough memory
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o anchorAry, scoreAryI, parentAryL, orderAryULng, usedAryUC,
+|          & chainAry in mapST to hold at least numAnchorsUL items
+\---------------------------------------------------------------------*/
+uint8_t growSamMapAnchors(
+    struct samMap *mapST,      /*Has the arrays to resize*/
+    unsigned long numAnchorsUL /*Number of anchors need to hold*/
+) /*Makes sure the anchor & chain arrays can hold numAnchorsUL*/
+{ /*growSamMapAnchors*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-12 TOC: Sec-1 Sub-1: growSamMapAnchors
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long newLenUL = mapST->lenAnchorUL;
+    void *tmpPtr = 0;
+
+    if(newLenUL < 1024)
+        newLenUL = 1024;
+
+    while(newLenUL < numAnchorsUL)
+        newLenUL <<= 1;
+
+    tmpPtr =
+        realloc(mapST->anchorAry, sizeof(struct mapAnchor) * newLenUL);
+    if(tmpPtr == 0) return 64;
+    mapST->anchorAry = tmpPtr;
+
+    tmpPtr = realloc(mapST->scoreAryI, sizeof(int32_t) * newLenUL);
+    if(tmpPtr == 0) return 64;
+    mapST->scoreAryI = tmpPtr;
+
+    tmpPtr = realloc(mapST->parentAryL, sizeof(long) * newLenUL);
+    if(tmpPtr == 0) return 64;
+    mapST->parentAryL = tmpPtr;
+
+    tmpPtr = realloc(mapST->orderAryULng, sizeof(uint64_t) * newLenUL);
+    if(tmpPtr == 0) return 64;
+    mapST->orderAryULng = tmpPtr;
+
+    tmpPtr = realloc(mapST->usedAryUC, sizeof(uint8_t) * newLenUL);
+    if(tmpPtr == 0) return 64;
+    mapST->usedAryUC = tmpPtr;
+
+    tmpPtr =
+        realloc(mapST->chainAry, sizeof(struct mapChain) * newLenUL);
+    if(tmpPtr == 0) return 64;
+    mapST->chainAry = tmpPtr;
+
+    mapST->lenAnchorUL = newLenUL;
+    return 1;
+} /*growSamMapAnchors*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if have enough memory
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have at least lenNeedUL free bytes
+\---------------------------------------------------------------------*/
+uint8_t growMapLine(
+    struct samMap *mapST,   /*Has the sam entry buffer to resize*/
+    unsigned long lenNeedUL /*Number of bytes that will be added*/
+) /*Makes sure the sam entry buffer has space for another entry*/
+{ /*growMapLine*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-13 TOC: Sec-1 Sub-1: growMapLine
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *tmpCStr = 0;
+    unsigned long newLenUL = mapST->lenLineUL;
+
+    if(mapST->endLineUL + lenNeedUL < mapST->lenLineUL)
+        return 1;
+
+    if(newLenUL < 4096)
+        newLenUL = 4096;
+
+    while(newLenUL <= mapST->endLineUL + lenNeedUL)
+        newLenUL <<= 1;
+
+    tmpCStr = realloc(mapST->lineCStr, sizeof(char) * newLenUL);
+
+    if(tmpCStr == 0)
+        return 64;
+
+    mapST->lineCStr = tmpCStr;
+    mapST->lenLineUL = newLenUL;
+    return 1;
+} /*growMapLine*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: mapST to have all values set to 0
+\---------------------------------------------------------------------*/
+void initSamMap(
+    struct samMap *mapST /*Structure to initialize*/
+) /*Sets all variables in a samMap structure to defaults*/
+{ /*initSamMap*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-14 TOC: Sec-1 Sub-1: initSamMap
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    mapST->inMapBl = 0;
+    mapST->allVsAllBl = 0;
+    mapST->pipeFILE = 0;
+    mapST->copyLineBl = 0;
+    initSamBlock(&mapST->samBlockST, 0);
+
+    mapST->refIdx.numRefsUL = 0;
+    mapST->refIdx.lenRefAryUL = 0;
+    mapST->refIdx.idAryCStr = 0;
+    mapST->refIdx.seqAryCStr = 0;
+    mapST->refIdx.lenSeqAryUI = 0;
+    mapST->refIdx.minzAry = 0;
+    mapST->refIdx.numMinzUL = 0;
+
+    mapST->qryFILE = 0;
+    mapST->qryPipeBl = 0;
+    mapST->qryIdCStr = 0;
+    mapST->qrySeqCStr = 0;
+    mapST->qryQCStr = 0;
+    mapST->revSeqCStr = 0;
+    mapST->revQCStr = 0;
+    mapST->skipAryUC = 0;
+    mapST->lenIdUL = 0;
+    mapST->lenSeqUL = 0;
+    mapST->lenQUL = 0;
+    mapST->lenRevUL = 0;
+    mapST->lenQryUI = 0;
+
+    mapST->minzAry = 0;
+    mapST->lenMinzUL = 0;
+    mapST->anchorAry = 0;
+    mapST->lenAnchorUL = 0;
+    mapST->scoreAryI = 0;
+    mapST->parentAryL = 0;
+    mapST->orderAryULng = 0;
+    mapST->usedAryUC = 0;
+    mapST->chainAry = 0;
+
+    mapST->hAryI = 0;
+    mapST->fAryI = 0;
+    mapST->lenRowUL = 0;
+    mapST->dirAryUC = 0;
+    mapST->lenDirUL = 0;
+    mapST->loAryUI = 0;
+    mapST->lenLoUL = 0;
+    mapST->opCStr = 0;
+    mapST->cigarCStr = 0;
+    mapST->lenOpUL = 0;
+
+    mapST->lineCStr = 0;
+    mapST->lenLineUL = 0;
+    mapST->endLineUL = 0;
+    mapST->onLineUL = 0;
+
+    initAlnSet(&mapST->alnSetST);
+    initAlnStruct(&mapST->alnST);
+    mapST->refBitAry = 0;
+    initTwoBitAry(&mapST->qryBitST);
+    mapST->voteAryUI = 0;
+
+    return;
+} /*initSamMap*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: all memory in refIdx & sets values to 0
+\---------------------------------------------------------------------*/
+void freeMapRefIdx(
+    struct mapRefIdx *refIdx /*Index to free*/
+) /*Frees the references & minimizers in a mapRefIdx structure*/
+{ /*freeMapRefIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-15 TOC: Sec-1 Sub-1: freeMapRefIdx
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    for(unsigned long ulRef = 0; ulRef < refIdx->numRefsUL; ++ulRef)
+    { /*Loop: Free each reference*/
+        free(refIdx->idAryCStr[ulRef]);
+        free(refIdx->seqAryCStr[ulRef]);
+    } /*Loop: Free each reference*/
+
+    free(refIdx->idAryCStr);
+    free(refIdx->seqAryCStr);
+    free(refIdx->lenSeqAryUI);
+    free(refIdx->minzAry);
+
+    refIdx->numRefsUL = 0;
+    refIdx->lenRefAryUL = 0;
+    refIdx->idAryCStr = 0;
+    refIdx->seqAryCStr = 0;
+    refIdx->lenSeqAryUI = 0;
+    refIdx->minzAry = 0;
+    refIdx->numMinzUL = 0;
+
+    return;
+} /*freeMapRefIdx*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts by hash, then reference, then position
+\---------------------------------------------------------------------*/
+int cmpMapMinz(
+    const void *oneST, /*First mapMinz structure*/
+    const void *twoST  /*Second mapMinz structure*/
+) /*qsort compare function for mapMinz structures*/
+{ /*cmpMapMinz*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-16 TOC: Sec-1 Sub-1: cmpMapMinz
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    const struct mapMinz *oneMinz = oneST;
+    const struct mapMinz *twoMinz = twoST;
+
+    if(oneMinz->hashUI != twoMinz->hashUI)
+        return oneMinz->hashUI < twoMinz->hashUI ? -1 : 1;
+
+    if(oneMinz->seqUI != twoMinz->seqUI)
+        return oneMinz->seqUI < twoMinz->seqUI ? -1 : 1;
+
+    if(oneMinz->posUI != twoMinz->posUI)
+        return oneMinz->posUI < twoMinz->posUI ? -1 : 1;
+
+    return 0;
+} /*cmpMapMinz*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts by reference, strand, reference position, then query
+|      position
+\---------------------------------------------------------------------*/
+int cmpMapAnchor(
+    const void *oneST, /*First mapAnchor structure*/
+    const void *twoST  /*Second mapAnchor structure*/
+) /*qsort compare function for mapAnchor structures*/
+{ /*cmpMapAnchor*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-17 TOC: Sec-1 Sub-1: cmpMapAnchor
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    const struct mapAnchor *oneAnc = oneST;
+    const struct mapAnchor *twoAnc = twoST;
+
+    if(oneAnc->refUI != twoAnc->refUI)
+        return oneAnc->refUI < twoAnc->refUI ? -1 : 1;
+
+    if(oneAnc->strandUI != twoAnc->strandUI)
+        return oneAnc->strandUI < twoAnc->strandUI ? -1 : 1;
+
+    if(oneAnc->refPosUI != twoAnc->refPosUI)
+        return oneAnc->refPosUI < twoAnc->refPosUI ? -1 : 1;
+
+    if(oneAnc->qryPosUI != twoAnc->qryPosUI)
+        return oneAnc->qryPosUI < twoAnc->qryPosUI ? -1 : 1;
+
+    return 0;
+} /*cmpMapAnchor*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts from highest to lowest value (best chain score first)
+\---------------------------------------------------------------------*/
+int cmpMapOrder(
+    const void *oneST, /*First uint64_t*/
+    const void *twoST  /*Second uint64_t*/
+) /*qsort compare function to sort (score << 32 | anchor) values*/
+{ /*cmpMapOrder*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-18 TOC: Sec-1 Sub-1: cmpMapOrder
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t oneULng = *(const uint64_t *) oneST;
+    uint64_t twoULng = *(const uint64_t *) twoST;
+
+    if(oneULng == twoULng)
+        return 0;
+
+    return oneULng > twoULng ? -1 : 1;
+} /*cmpMapOrder*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts from highest to lowest chain score
+\---------------------------------------------------------------------*/
+int cmpMapChain(
+    const void *oneST, /*First mapChain structure*/
+    const void *twoST  /*Second mapChain structure*/
+) /*qsort compare function for mapChain structures*/
+{ /*cmpMapChain*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-19 TOC: Sec-1 Sub-1: cmpMapChain
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    const struct mapChain *oneChain = oneST;
+    const struct mapChain *twoChain = twoST;
+
+    if(oneChain->scoreI != twoChain->scoreI)
+        return oneChain->scoreI > twoChain->scoreI ? -1 : 1;
+
+    /*Keep ties in the order they were found*/
+    if(oneChain->endUI != twoChain->endUI)
+        return oneChain->endUI < twoChain->endUI ? -1 : 1;
+
+    return 0;
+} /*cmpMapChain*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if saved the index
+|        o 2 if could not write to outCStr
+|    - Creates:
+|        o outCStr with the references & minimizers in refIdx
+| Note:
+|    - The format is defMapIdxMagicCStr, the k-mer & window length,
+|      the number of references, each id & sequence (length first), the
+|      number of minimizers, & then the minimizer array. It is only
+|      meant to be read back on the same machine
+\---------------------------------------------------------------------*/
+uint8_t writeMapRefIdx(
+    struct mapRefIdx *refIdx, /*Index to save*/
+    char *outCStr             /*File to save the index to*/
+) /*Saves an index made by buildMapRefIdx to a file*/
+{ /*writeMapRefIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-20 TOC: Sec-1 Sub-1: writeMapRefIdx
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint32_t tmpUI = 0;
+    uint64_t tmpULng = 0;
+    char errBl = 0;      /*1: A write failed*/
+    FILE *outFILE = fopen(outCStr, "wb");
+
+    if(outFILE == 0)
+        return 2;
+
+    fwrite(defMapIdxMagicCStr, sizeof(char), 8, outFILE);
+
+    tmpUI = defMapKmerUC;
+    fwrite(&tmpUI, sizeof(uint32_t), 1, outFILE);
+    tmpUI = defMapWinUC;
+    fwrite(&tmpUI, sizeof(uint32_t), 1, outFILE);
+
+    tmpULng = refIdx->numRefsUL;
+    fwrite(&tmpULng, sizeof(uint64_t), 1, outFILE);
+
+    for(unsigned long ulRef = 0; ulRef < refIdx->numRefsUL; ++ulRef)
+    { /*Loop: Save each reference*/
+        tmpUI = strlen(refIdx->idAryCStr[ulRef]);
+        fwrite(&tmpUI, sizeof(uint32_t), 1, outFILE);
+        fwrite(refIdx->idAryCStr[ulRef], sizeof(char), tmpUI, outFILE);
+
+        tmpUI = refIdx->lenSeqAryUI[ulRef];
+        fwrite(&tmpUI, sizeof(uint32_t), 1, outFILE);
+        fwrite(refIdx->seqAryCStr[ulRef], sizeof(char), tmpUI, outFILE);
+    } /*Loop: Save each reference*/
+
+    tmpULng = refIdx->numMinzUL;
+    fwrite(&tmpULng, sizeof(uint64_t), 1, outFILE);
+
+    tmpULng =
+        fwrite(
+            refIdx->minzAry,
+            sizeof(struct mapMinz),
+            refIdx->numMinzUL,
+            outFILE
+        );
+
+    if(tmpULng != refIdx->numMinzUL || ferror(outFILE))
+        errBl = 1;
+
+    if(fclose(outFILE) != 0 || errBl)
+    { /*If could not write out the full index*/
+        remove(outCStr);
+        return 2;
+    } /*If could not write out the full index*/
+
+    return 1;
+} /*writeMapRefIdx*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if read in the index
+|        o 2 if the file is not a complete index or was made with a
+|          different k-mer or window length
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o refIdx to have the saved references & minimizers
+| Note:
+|    - idxFILE should be just past defMapIdxMagicCStr
+\---------------------------------------------------------------------*/
+uint8_t readMapRefIdx(
+    struct mapRefIdx *refIdx, /*Gets the index*/
+    FILE *idxFILE             /*File made by writeMapRefIdx*/
+) /*Reads in an index saved by writeMapRefIdx*/
+{ /*readMapRefIdx*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-21 TOC: readMapRefIdx
+    '   fun-21 sec-1: Variable declerations & check the settings
+    '   fun-21 sec-2: Read in the references
+    '   fun-21 sec-3: Read in the minimizers
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-21 Sec-1: Variable declerations & check the settings
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t kmerUI = 0;
+    uint32_t winUI = 0;
+    uint32_t lenUI = 0;
+    uint64_t numULng = 0;
+    uint64_t numDoneULng = 0; /*References fully read in*/
+
+    freeMapRefIdx(refIdx);
+
+    if(fread(&kmerUI, sizeof(uint32_t), 1, idxFILE) != 1) return 2;
+    if(fread(&winUI, sizeof(uint32_t), 1, idxFILE) != 1) return 2;
+
+    if(kmerUI != defMapKmerUC || winUI != defMapWinUC)
+        return 2; /*Index was made with different settings*/
+
+    if(fread(&numULng, sizeof(uint64_t), 1, idxFILE) != 1) return 2;
+
+    if(numULng == 0)
+        return 2;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-21 Sec-2: Read in the references
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    refIdx->idAryCStr = calloc(numULng, sizeof(char *));
+    refIdx->seqAryCStr = calloc(numULng, sizeof(char *));
+    refIdx->lenSeqAryUI = calloc(numULng, sizeof(uint32_t));
+
+    if(
+          refIdx->idAryCStr == 0
+       || refIdx->seqAryCStr == 0
+       || refIdx->lenSeqAryUI == 0
+    ) { /*If had a memory allocation error*/
+        freeMapRefIdx(refIdx);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    refIdx->lenRefAryUL = numULng;
+
+    /*numRefsUL is only increased after both strings are allocated, so
+      freeMapRefIdx never sees a half made reference*/
+    for(unsigned long ulRef = 0; ulRef < numULng; ++ulRef)
+    { /*Loop: Read in each reference*/
+        if(fread(&lenUI, sizeof(uint32_t), 1, idxFILE) != 1)
+            break;
+
+        refIdx->idAryCStr[ulRef] = malloc(sizeof(char) * (lenUI + 1));
+
+        if(refIdx->idAryCStr[ulRef] == 0)
+        { /*If had a memory allocation error*/
+            freeMapRefIdx(refIdx);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        if(fread(refIdx->idAryCStr[ulRef], 1, lenUI, idxFILE) != lenUI)
+        { /*If the file is truncated*/
+            free(refIdx->idAryCStr[ulRef]);
+            break;
+        } /*If the file is truncated*/
+
+        refIdx->idAryCStr[ulRef][lenUI] = '\0';
+
+        if(fread(&lenUI, sizeof(uint32_t), 1, idxFILE) != 1)
+        { /*If the file is truncated*/
+            free(refIdx->idAryCStr[ulRef]);
+            break;
+        } /*If the file is truncated*/
+
+        refIdx->seqAryCStr[ulRef] = malloc(sizeof(char) * (lenUI + 1));
+
+        if(refIdx->seqAryCStr[ulRef] == 0)
+        { /*If had a memory allocation error*/
+            free(refIdx->idAryCStr[ulRef]);
+            freeMapRefIdx(refIdx);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        ++refIdx->numRefsUL;
+
+        if(fread(refIdx->seqAryCStr[ulRef], 1, lenUI, idxFILE) != lenUI)
+            break;
+
+        refIdx->seqAryCStr[ulRef][lenUI] = '\0';
+        refIdx->lenSeqAryUI[ulRef] = lenUI;
+        ++numDoneULng;
+    } /*Loop: Read in each reference*/
+
+    if(numDoneULng != numULng)
+    { /*If the file ended early*/
+        freeMapRefIdx(refIdx);
+        return 2;
+    } /*If the file ended early*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-21 Sec-3: Read in the minimizers
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(fread(&numULng, sizeof(uint64_t), 1, idxFILE) != 1)
+    { /*If the file ended early*/
+        freeMapRefIdx(refIdx);
+        return 2;
+    } /*If the file ended early*/
+
+    /*+1 so an index with no minimizers still gets an array*/
+    refIdx->minzAry = malloc(sizeof(struct mapMinz) * (numULng + 1));
+
+    if(refIdx->minzAry == 0)
+    { /*If had a memory allocation error*/
+        freeMapRefIdx(refIdx);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    refIdx->numMinzUL =
+        fread(refIdx->minzAry, sizeof(struct mapMinz), numULng, idxFILE);
+
+    if(refIdx->numMinzUL != numULng)
+    { /*If the file ended early*/
+        freeMapRefIdx(refIdx);
+        return 2;
+    } /*If the file ended early*/
+
+    return 1;
+} /*readMapRefIdx*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if hashed the file
+|        o 2 if could not open the file
+|    - Modifies:
+|        o hashULng to have the FNV-1a hash of the file & keyCStr
+\---------------------------------------------------------------------*/
+uint8_t hashMapRefFile(
+    char *fileCStr,    /*File to hash*/
+    char *keyCStr,     /*Settings to add to the hash (preset)*/
+    uint64_t *hashULng /*Gets the hash*/
+) /*Hashes the contents of a file with the settings used to index it*/
+{ /*hashMapRefFile*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-22 TOC: Sec-1 Sub-1: hashMapRefFile
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned char buffUCStr[defSamPipeBuff];
+    unsigned long lenReadUL = 0;
+    FILE *inFILE = fopen(fileCStr, "rb");
+
+    *hashULng = 14695981039346656037ULL; /*FNV-1a offset basis*/
+
+    if(inFILE == 0)
+        return 2;
+
+    lenReadUL = fread(buffUCStr, sizeof(char), defSamPipeBuff, inFILE);
+
+    while(lenReadUL > 0)
+    { /*Loop: Hash the file*/
+        for(unsigned long ulChar = 0; ulChar < lenReadUL; ++ulChar)
+        { /*Loop: Hash each byte in the buffer*/
+            *hashULng ^= buffUCStr[ulChar];
+            *hashULng *= 1099511628211ULL; /*FNV-1a prime*/
+        } /*Loop: Hash each byte in the buffer*/
+
+        lenReadUL =
+            fread(buffUCStr, sizeof(char), defSamPipeBuff, inFILE);
+    } /*Loop: Hash the file*/
+
+    fclose(inFILE);
+
+    while(*keyCStr != '\0')
+    { /*Loop: Add the settings to the hash*/
+        *hashULng ^= (unsigned char) *keyCStr;
+        *hashULng *= 1099511628211ULL;
+        ++keyCStr;
+    } /*Loop: Add the settings to the hash*/
+
+    return 1;
+} /*hashMapRefFile*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found or made the cached index
+|        o 2 if could not read refCStr or write to cacheDirCStr
+|        o 32 if minimap2 could not make the index
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o cachePathCStr to have the path to the cached index, which is
+|          used in place of refCStr. It needs to hold
+|          strlen(cacheDirCStr) + 64 characters
+|    - Creates:
+|        o cacheDirCStr/<hash>-<preset>.mmi (minimap2) or
+|          cacheDirCStr/<hash>-k<k>w<w>.idx (built in mapper) when the
+|          index is not cached yet
+| Note:
+|    - The file name has the hash of the references & the settings, so
+|      a changed reference file or preset gets a new index. Old indexes
+|      are never removed.
+\---------------------------------------------------------------------*/
+uint8_t getMapRefCache(
+    char *refCStr,       /*Fasta or fastq with the references*/
+    char *cacheDirCStr,  /*Directory to keep the indexes in*/
+    char inMapBl,        /*1: Index for the built in mapper*/
+    char *cachePathCStr  /*Gets the path to the cached index*/
+) /*Finds or makes a saved index for a reference file*/
+{ /*getMapRefCache*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-23 TOC: getMapRefCache
+    '   fun-23 sec-1: Variable declerations
+    '   fun-23 sec-2: Find the name of the cached index
+    '   fun-23 sec-3: Make the index if it is not cached
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-23 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint8_t errUC = 0;
+    uint64_t hashULng = 0;
+    char keyCStr[64];
+    char *tmpPathCStr = 0;
+    char *cmdCStr = 0;
+    FILE *testFILE = 0;
+    struct mapRefIdx refIdx;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-23 Sec-2: Find the name of the cached index
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(inMapBl & 1)
+        sprintf(keyCStr, "k%uw%u", defMapKmerUC, defMapWinUC);
+    else
+        sprintf(keyCStr, "%s", defMinimap2PresetCStr);
+
+    if(!(hashMapRefFile(refCStr, keyCStr, &hashULng) & 1))
+        return 2;
+
+    sprintf(
+        cachePathCStr,
+        "%s/%016llx-%s.%s",
+        cacheDirCStr,
+        (unsigned long long) hashULng,
+        keyCStr,
+        (inMapBl & 1) ? "idx" : "mmi"
+    );
+
+    testFILE = fopen(cachePathCStr, "rb");
+
+    if(testFILE != 0)
+    { /*If the index is already cached*/
+        fclose(testFILE);
+        return 1;
+    } /*If the index is already cached*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-23 Sec-3: Make the index if it is not cached
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Write to a file only this run uses, then rename it, so runs that
+      start at the same time never read a half written index*/
+    tmpPathCStr = malloc(sizeof(char) * (strlen(cachePathCStr) + 32));
+
+    if(tmpPathCStr == 0)
+        return 64;
+
+    sprintf(
+        tmpPathCStr,
+        "%s.%lu.tmp",
+        cachePathCStr,
+        (unsigned long) getpid()
+    );
+
+    if(inMapBl & 1)
+    { /*If making an index for the built in mapper*/
+        refIdx.numRefsUL = 0;
+        refIdx.lenRefAryUL = 0;
+        refIdx.idAryCStr = 0;
+        refIdx.seqAryCStr = 0;
+        refIdx.lenSeqAryUI = 0;
+        refIdx.minzAry = 0;
+        refIdx.numMinzUL = 0;
+
+        errUC = buildMapRefIdx(&refIdx, refCStr);
+
+        if(errUC & 1)
+            errUC = writeMapRefIdx(&refIdx, tmpPathCStr);
+
+        freeMapRefIdx(&refIdx);
+    } /*If making an index for the built in mapper*/
+
+    else
+    { /*Else making a minimap2 index*/
+        cmdCStr =
+            malloc(
+                sizeof(char)
+              * (strlen(tmpPathCStr) + strlen(refCStr) + 64)
+            );
+
+        if(cmdCStr == 0)
+        { /*If had a memory allocation error*/
+            free(tmpPathCStr);
+            return 64;
+        } /*If had a memory allocation error*/
+
+        sprintf(
+            cmdCStr,
+            "%s %s %s 2> /dev/null",
+            minimap2IdxCMD,
+            tmpPathCStr,
+            refCStr
+        );
+
+        if(system(cmdCStr) == 0)
+            errUC = 1;
+        else
+            errUC = 32;
+
+        free(cmdCStr);
+    } /*Else making a minimap2 index*/
+
+    if(errUC & 1)
+    { /*If made the index*/
+        if(rename(tmpPathCStr, cachePathCStr) != 0)
+            errUC = 2;
+    } /*If made the index*/
+
+    if(!(errUC & 1))
+        remove(tmpPathCStr);
+
+    free(tmpPathCStr);
+    return errUC;
+} /*getMapRefCache*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if aligned (or did not align) the query
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have the sam entry for the query
+|    Note:
+|        o The query is aligned (semi-global) to the reference & strand
+|          it shares the most minimizers with. Queries with to many
+|          cells for the aligner are mapped with mapQuery instead
+\---------------------------------------------------------------------*/
+uint8_t alnQuery(
+    struct samMap *mapST /*Has the query, index, & packed references*/
+) /*Aligns the current query end to end to its best reference*/
+{ /*alnQuery*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-24 TOC: alnQuery
+    '   - A read compared to the best read (or a consensus to another
+    '     consensus) has one short reference, so aligning the whole
+    '     query is cheaper than chaining & banding
+    '   fun-24 sec-1: Variable declerations
+    '   fun-24 sec-2: Find the reference & strand with the most hits
+    '   fun-24 sec-3: Align the query to the reference
+    '   fun-24 sec-4: Add the sam entry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-24 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct mapRefIdx *refIdx = &mapST->refIdx;
+    struct mapMinz *qryMinzST = 0;
+    struct mapMinz *refMinzST = 0;
+
+    long numMinzL = 0;
+    unsigned long numVotesUL = refIdx->numRefsUL << 1;
+    unsigned long bestUL = 0;   /*Best reference << 1 | strand*/
+    unsigned long refUL = 0;
+    unsigned long firstUL = 0;  /*First hit in the index*/
+    unsigned long lastUL = 0;   /*One past last hit in the index*/
+    unsigned long midUL = 0;
+    unsigned long lenNeedUL = 0;
+    uint32_t strandUI = 0;
+    uint8_t errUC = 0;
+    char *seqCStr = 0;
+    char *qCStr = 0;
+    char *tmpCStr = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-24 Sec-2: Find the reference & strand with the most hits
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(!(revCompMapQuery(mapST) & 1))
+        return 64;
+
+    numMinzL =
+        getMapMinz(
+            mapST->qrySeqCStr,
+            mapST->lenQryUI,
+            0,
+            &mapST->minzAry,
+            &mapST->lenMinzUL,
+            0
+        ); /*Get the minimizers in the query*/
+
+    if(numMinzL < 0)
+        return 64;
+
+    for(unsigned long ulVote = 0; ulVote < numVotesUL; ++ulVote)
+        mapST->voteAryUI[ulVote] = 0;
+
+    for(long lMinz = 0; lMinz < numMinzL; ++lMinz)
+    { /*Loop: Count the hits for each reference & strand*/
+        qryMinzST = mapST->minzAry + lMinz;
+
+        /*Binary search for the first minimizer with the hash*/
+        firstUL = 0;
+        lastUL = refIdx->numMinzUL;
+
+        while(firstUL < lastUL)
+        { /*While searching for the first hit*/
+            midUL = (firstUL + lastUL) >> 1;
+
+            if(refIdx->minzAry[midUL].hashUI < qryMinzST->hashUI)
+                firstUL = midUL + 1;
+            else
+                lastUL = midUL;
+        } /*While searching for the first hit*/
+
+        lastUL = firstUL;
+
+        while(
+              lastUL < refIdx->numMinzUL
+           && refIdx->minzAry[lastUL].hashUI == qryMinzST->hashUI
+        ) ++lastUL;
+
+        if(lastUL - firstUL > defMapMaxOccUI)
+            continue; /*Repetitive minimizer*/
+
+        for(unsigned long ulHit = firstUL; ulHit < lastUL; ++ulHit)
+        { /*Loop: Add a vote for each hit*/
+            refMinzST = refIdx->minzAry + ulHit;
+
+            ++mapST->voteAryUI[
+                  (refMinzST->seqUI << 1)
+                | (qryMinzST->strandUI ^ refMinzST->strandUI)
+            ];
+        } /*Loop: Add a vote for each hit*/
+    } /*Loop: Count the hits for each reference & strand*/
+
+    for(unsigned long ulVote = 1; ulVote < numVotesUL; ++ulVote)
+    { /*Loop: Find the reference & strand with the most hits*/
+        if(mapST->voteAryUI[ulVote] > mapST->voteAryUI[bestUL])
+            bestUL = ulVote;
+    } /*Loop: Find the reference & strand with the most hits*/
+
+    if(mapST->voteAryUI[bestUL] < defMapMinAnchorsUI)
+        return addMapUnmapped(mapST); /*Same cut off as the chains*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-24 Sec-3: Align the query to the reference
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    refUL = bestUL >> 1;
+    strandUI = bestUL & 1;
+    seqCStr = strandUI ? mapST->revSeqCStr : mapST->qrySeqCStr;
+
+    if(seqToTwoBitAry(seqCStr, mapST->lenQryUI, &mapST->qryBitST) & 64)
+        return 64;
+
+    errUC =
+        alignTwoBit(
+            &mapST->qryBitST,
+            seqCStr,
+            &mapST->refBitAry[refUL],
+            refIdx->seqAryCStr[refUL],
+            &mapST->alnSetST,
+            &mapST->alnST
+        );
+
+    if(errUC & 64)
+        return 64;
+
+    if(errUC & 4)
+        return mapQuery(mapST); /*To many cells for the aligner*/
+
+    if(!(errUC & 1) || mapST->alnST.numMatchUI == 0)
+        return addMapUnmapped(mapST);
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-24 Sec-4: Add the sam entry
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    qCStr = strandUI ? mapST->revQCStr : mapST->qryQCStr;
+
+    if(*qCStr == '\0')
+        qCStr = "*";
+
+    lenNeedUL =
+          strlen(mapST->qryIdCStr)
+        + strlen(refIdx->idAryCStr[refUL])
+        + strlen(mapST->alnST.cigarCStr)
+        + ((unsigned long) mapST->lenQryUI << 1)
+        + 128;
+
+    if(!(growMapLine(mapST, lenNeedUL) & 1))
+        return 64;
+
+    tmpCStr = mapST->lineCStr + mapST->endLineUL;
+
+    /*One short reference, so the mapping quality is always 60*/
+    tmpCStr +=
+        sprintf(
+            tmpCStr,
+            "%s\t%u\t%s\t%lu\t60\t%s\t*\t0\t0\t%s\t%s",
+            mapST->qryIdCStr,
+            strandUI << 4,
+            refIdx->idAryCStr[refUL],
+            mapST->alnST.refStartUL + 1,
+            mapST->alnST.cigarCStr,
+            seqCStr,
+            qCStr
+        ); /*Add the sam entry*/
+
+    tmpCStr +=
+        sprintf(
+            tmpCStr,
+            "\tNM:i:%u\tAS:i:%ld\ttp:A:P\n",
+              mapST->alnST.numSnpUI
+            + mapST->alnST.numInsUI
+            + mapST->alnST.numDelUI,
+            mapST->alnST.scoreL
+        ); /*Add the tags*/
+
+    mapST->endLineUL = tmpCStr - mapST->lineCStr;
+    return 1;
+} /*alnQuery*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if made the reverse complement
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revSeqCStr & revQCStr in mapST to have the reverse
+|          complement of the query
+|        o skipAryUC in mapST to mark self & dual mappings (all vs all)
+\---------------------------------------------------------------------*/
+uint8_t revCompMapQuery(
+    struct samMap *mapST /*Has the query to reverse complement*/
+) /*Makes the reverse complement of the current query*/
+{ /*revCompMapQuery*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-25 TOC: Sec-1 Sub-1: revCompMapQuery
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct mapRefIdx *refIdx = &mapST->refIdx;
+
+    if(!(growSamMapBuff(mapST) & 1))
+        return 64;
+
+    for(uint32_t uiBase = 0; uiBase < mapST->lenQryUI; ++uiBase)
+    { /*Loop: Reverse complement the query*/
+        switch(mapST->qrySeqCStr[mapST->lenQryUI - uiBase - 1] & ~32)
+        { /*Switch: complement the base*/
+            case 'A': mapST->revSeqCStr[uiBase] = 'T'; break;
+            case 'C': mapST->revSeqCStr[uiBase] = 'G'; break;
+            case 'G': mapST->revSeqCStr[uiBase] = 'C'; break;
+            case 'T': mapST->revSeqCStr[uiBase] = 'A'; break;
+            case 'U': mapST->revSeqCStr[uiBase] = 'A'; break;
+            default:  mapST->revSeqCStr[uiBase] = 'N'; break;
+        } /*Switch: complement the base*/
+
+        if(*mapST->qryQCStr != '\0')
+            mapST->revQCStr[uiBase] =
+                mapST->qryQCStr[mapST->lenQryUI - uiBase - 1];
+    } /*Loop: Reverse complement the query*/
+
+    mapST->revSeqCStr[mapST->lenQryUI] = '\0';
+    mapST->revQCStr[
+        *mapST->qryQCStr != '\0' ? mapST->lenQryUI : 0
+    ] = '\0';
+
+    if(mapST->allVsAllBl & 1)
+    { /*If need to mark self & dual mappings*/
+        for(unsigned long ulRef = 0; ulRef < refIdx->numRefsUL; ++ulRef)
+            mapST->skipAryUC[ulRef] =
+                strcmp(mapST->qryIdCStr, refIdx->idAryCStr[ulRef]) >= 0;
+    } /*If need to mark self & dual mappings*/
+
+    return 1;
+} /*revCompMapQuery*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if added the entry
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have an unmapped entry for the query
+\---------------------------------------------------------------------*/
+uint8_t addMapUnmapped(
+    struct samMap *mapST /*Has the query & sam entry buffer*/
+) /*Adds an unmapped sam entry for the current query*/
+{ /*addMapUnmapped*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-26 TOC: Sec-1 Sub-1: addMapUnmapped
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long lenNeedUL =
+          strlen(mapST->qryIdCStr)
+        + ((unsigned long) mapST->lenQryUI << 1)
+        + 64;
+    char *qCStr = *mapST->qryQCStr != '\0' ? mapST->qryQCStr : "*";
+
+    if(!(growMapLine(mapST, lenNeedUL) & 1))
+        return 64;
+
+    mapST->endLineUL +=
+        sprintf(
+            mapST->lineCStr + mapST->endLineUL,
+            "%s\t4\t*\t0\t0\t*\t*\t0\t0\t%s\t%s\n",
+            mapST->qryIdCStr,
+            mapST->lenQryUI > 0 ? mapST->qrySeqCStr : "*",
+            mapST->lenQryUI > 0 ? qCStr : "*"
+        ); /*Add the unmapped entry*/
+
+    return 1;
+} /*addMapUnmapped*/
@@ -0,0 +1,618 @@
+/*######################################################################
+# Use:
+#   o Holds a small minimizer mapper (index, chaining, & banded
+#     alignment) that makes samEntry records in memory. It is used
+#     instead of minimap2 when -in-map is set. Without -in-map the
+#     samMap functions just run minimap2 & read its output.
+#   o Can also align each query end to end to the reference it shares
+#     the most minimizers with (alignmentsFun). This is used for reads
+#     to the best read & consensus to consensus comparisons, which
+#     have one short reference.
+# Includes:
+#   - "samEntryStruct.h"
+#   - "defaultSettings.h"
+#   - "fqAndFaFun.h"
+#   - "alignmentsFun.h"
+#   o "twoBitArrays.h"
+#   o "cStrToNumberFun.h"
+#   o "printError.h"
+# C standard libraries:
+#   o <stdlib.h>
+#   o <string.h>
+#   o <stdio.h>
+#   o <stdint.h>
+#   - <unistd.h>
+######################################################################*/
+
+#ifndef READMAPFUN_H
+#define READMAPFUN_H
+
+#include "samEntryStruct.h"  /*Structer the mapper fills*/
+#include "defaultSettings.h" /*Mapper settings*/
+#include "fqAndFaFun.h"      /*Opens gzip compressed query files*/
+#include "alignmentsFun.h"   /*Pairwise aligner (inMapBl & 2)*/
+#include <unistd.h>          /*getpid for index cache temporary files*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' readMapFun SOH: Start Of Header
+'   o st-1 mapMinz:
+'     - One minimizer in a sequence
+'   o st-2 mapAnchor:
+'     - A minimizer shared by a query & a reference
+'   o st-3 mapChain:
+'     - A chain of anchors kept for alignment
+'   o st-4 mapRefIdx:
+'     - References & the minimizer index for the references
+'   o st-5 samMap:
+'     - Output stream from minimap2 or the built in mapper
+'   o fun-1 openSamMap:
+'     - Runs minimap2 or sets up the built in mapper
+'   o fun-2 readSamMap:
+'     - Reads the next sam entry from minimap2 or the built in mapper
+'   o fun-3 closeSamMap:
+'     - Closes minimap2 or frees the built in mappers memory
+'   o fun-4 readMapSeq:
+'     - Reads in the next sequence in a fasta or fastq file
+'   o fun-5 readMapLine:
+'     - Reads in a line of any length (no new line) into a buffer
+'   o fun-6 getMapMinz:
+'     - Finds the minimizers in a sequence
+'   o fun-7 buildMapRefIdx:
+'     - Reads in the references & makes the minimizer index
+'   o fun-8 chainMapAnchors:
+'     - Chains the anchors shared by a query & the references
+'   o fun-9 alnMapChain:
+'     - Does a banded local alignment around a chain
+'   o fun-10 mapQuery:
+'     - Maps the current query & makes its sam entries
+'   o fun-11 growSamMapBuff:
+'     - Makes sure the reverse complement buffers can hold the query
+'   o fun-12 growSamMapAnchors:
+'     - Makes sure the anchor & chain arrays are large enough
+'   o fun-13 growMapLine:
+'     - Makes sure the sam entry buffer has space for another entry
+'   o fun-14 initSamMap:
+'     - Sets all variables in a samMap structure to defaults
+'   o fun-15 freeMapRefIdx:
+'     - Frees the references & index in a mapRefIdx structure
+'   o fun-16 cmpMapMinz:
+'     - qsort compare function for mapMinz structures
+'   o fun-17 cmpMapAnchor:
+'     - qsort compare function for mapAnchor structures
+'   o fun-18 cmpMapOrder:
+'     - qsort compare function for (score << 32 | anchor) values
+'   o fun-19 cmpMapChain:
+'     - qsort compare function for mapChain structures
+'   o fun-20 writeMapRefIdx:
+'     - Saves an index made by buildMapRefIdx to a file
+'   o fun-21 readMapRefIdx:
+'     - Reads in an index saved by writeMapRefIdx
+'   o fun-22 hashMapRefFile:
+'     - Hashes a file & the settings used to index it (FNV-1a)
+'   o fun-23 getMapRefCache:
+'     - Finds or makes a saved index for a reference file (-ref-cache)
+'   o fun-24 alnQuery:
+'     - Aligns the current query end to end to its best reference
+'   o fun-25 revCompMapQuery:
+'     - Makes the reverse complement of the current query
+'   o fun-26 addMapUnmapped:
+'     - Adds an unmapped sam entry for the current query
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: mapMinz
+| Use:
+|   - Holds one minimizer (hash, sequence, position, & strand)
+\---------------------------------------------------------------------*/
+typedef struct mapMinz
+{ /*mapMinz*/
+    uint32_t hashUI;   /*Hash of the canonical k-mer*/
+    uint32_t seqUI;    /*Index of the reference (0 for queries)*/
+    uint32_t posUI;    /*Position of the first base in the k-mer*/
+    uint32_t strandUI; /*1: k-mer was reverse complement, else 0*/
+}mapMinz;
+
+/*---------------------------------------------------------------------\
+| Struct-2: mapAnchor
+| Use:
+|   - Holds a minimizer shared by the query & a reference. qryPosUI is
+|     on the reverse complement of the query when strandUI is 1
+\---------------------------------------------------------------------*/
+typedef struct mapAnchor
+{ /*mapAnchor*/
+    uint32_t refUI;    /*Index of the reference*/
+    uint32_t strandUI; /*1: query maps to reverse strand*/
+    uint32_t refPosUI; /*Position of the k-mer on the reference*/
+    uint32_t qryPosUI; /*Position of the k-mer on the query*/
+}mapAnchor;
+
+/*---------------------------------------------------------------------\
+| Struct-3: mapChain
+| Use:
+|   - Holds a chain of anchors. The anchors are found by following
+|     parentAryL (in samMap) back from endUI
+\---------------------------------------------------------------------*/
+typedef struct mapChain
+{ /*mapChain*/
+    int32_t scoreI;      /*Chaining score*/
+    uint32_t endUI;      /*Index of the last anchor in the chain*/
+    uint32_t numUI;      /*Number of anchors in the chain*/
+    uint32_t refUI;      /*Reference the chain is on*/
+    uint32_t strandUI;   /*1: Chain is on the reverse strand*/
+    uint32_t qryStartUI; /*First query base (forward strand)*/
+    uint32_t qryEndUI;   /*One past the last query base (forward)*/
+}mapChain;
+
+/*---------------------------------------------------------------------\
+| Struct-4: mapRefIdx
+| Use:
+|   - Holds the reference sequences & their minimizers (sorted by
+|     hash) for the built in mapper
+\---------------------------------------------------------------------*/
+typedef struct mapRefIdx
+{ /*mapRefIdx*/
+    unsigned long numRefsUL;   /*Number of references*/
+    unsigned long lenRefAryUL; /*Number references arrays can hold*/
+    char **idAryCStr;          /*Reference ids*/
+    char **seqAryCStr;         /*Reference sequences*/
+    uint32_t *lenSeqAryUI;     /*Length of each reference*/
+
+    struct mapMinz *minzAry;   /*All reference minimizers*/
+    unsigned long numMinzUL;   /*Number of minimizers in minzAry*/
+}mapRefIdx;
+
+/*---------------------------------------------------------------------\
+| Struct-5: samMap
+| Use:
+|   - Holds the output stream from minimap2 (pipeFILE) or the index,
+|     query, & scratch buffers for the built in mapper
+\---------------------------------------------------------------------*/
+typedef struct samMap
+{ /*samMap*/
+    char inMapBl;    /*1: Use the built in mapper, 0: minimap2,
+                       2: Align to the best reference (alnQuery)*/
+    char allVsAllBl; /*1: Report secondary alignments & skip self or
+                       dual mappings (minimap2 -X)*/
+
+    FILE *pipeFILE;  /*minimap2 output*/
+    struct samBlock samBlockST; /*Blocks of minimap2 output*/
+    char copyLineBl; /*1: Copy minimap2 lines out of samBlockST (caller
+                       keeps entries after reading the next entry)*/
+
+    /*Built in mapper*/
+    struct mapRefIdx refIdx; /*Reference index*/
+    FILE *qryFILE;           /*Fasta or fastq with queries to map*/
+    char qryPipeBl;          /*1: qryFILE is a pipe from gzip*/
+
+    char *qryIdCStr;         /*Id of the query on*/
+    char *qrySeqCStr;        /*Sequence of the query on*/
+    char *qryQCStr;          /*Q-score of the query ('\0' if fasta)*/
+    char *revSeqCStr;        /*Reverse complement of the query*/
+    char *revQCStr;          /*Reversed q-score entry of the query*/
+    uint8_t *skipAryUC;      /*1: Reference to skip (all vs all)*/
+    unsigned long lenIdUL;   /*Size of qryIdCStr*/
+    unsigned long lenSeqUL;  /*Size of qrySeqCStr*/
+    unsigned long lenQUL;    /*Size of qryQCStr*/
+    unsigned long lenRevUL;  /*Size of revSeqCStr & revQCStr*/
+    uint32_t lenQryUI;       /*Length of the query*/
+
+    struct mapMinz *minzAry;     /*Query minimizers*/
+    unsigned long lenMinzUL;     /*Minimizers minzAry can hold*/
+    struct mapAnchor *anchorAry; /*Anchors for the query*/
+    unsigned long lenAnchorUL;   /*Anchors the anchor arrays can hold*/
+    int32_t *scoreAryI;          /*Chain score at each anchor*/
+    long *parentAryL;            /*Previous anchor in chain*/
+    uint64_t *orderAryULng;      /*Anchors sorted by chain score*/
+    uint8_t *usedAryUC;          /*1: Anchor is in a kept chain*/
+    struct mapChain *chainAry;   /*Chains kept for alignment*/
+
+    int32_t *hAryI;          /*Alignment row scores (two rows)*/
+    int32_t *fAryI;          /*Alignment row insertion scores*/
+    unsigned long lenRowUL;  /*Length of one row in hAryI & fAryI*/
+    uint8_t *dirAryUC;       /*Alignment traceback directions*/
+    unsigned long lenDirUL;  /*Length of dirAryUC*/
+    uint32_t *loAryUI;       /*First column of each band row*/
+    unsigned long lenLoUL;   /*Length of loAryUI*/
+    char *opCStr;            /*Alignment operations (reverse order)*/
+    char *cigarCStr;         /*Cigar for the alignment*/
+    unsigned long lenOpUL;   /*Length of opCStr*/
+
+    char *lineCStr;          /*Sam entries for the query on*/
+    unsigned long lenLineUL; /*Size of the lineCStr buffer*/
+    unsigned long endLineUL; /*Number of bytes used in lineCStr*/
+    unsigned long onLineUL;  /*Start of the next line to output*/
+
+    /*Pairwise aligner (inMapBl & 2)*/
+    struct alnSet alnSetST;       /*Scores for the aligner*/
+    struct alnStruct alnST;       /*Aligner buffers & alignment*/
+    struct twoBitAry *refBitAry;  /*Packed references*/
+    struct twoBitAry qryBitST;    /*Packed query (strand aligned)*/
+    uint32_t *voteAryUI;          /*Minimizers shared with each
+                                    reference & strand (ref * 2)*/
+}samMap;
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if minimap2 was started or the mapper was set up
+|        o 2 if could not open the reference or query file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o mapST to have the minimap2 pipe or the reference index
+|    Note:
+|        o minimap2CmdCStr is only used when inMapBl is 0
+|        o inMapBl & 2 (align to the best reference) is ignored for
+|          all vs all mapping
+\---------------------------------------------------------------------*/
+uint8_t openSamMap(
+    struct samMap *mapST,  /*Structure to set up*/
+    char *minimap2CmdCStr, /*minimap2 command to run (no built in)*/
+    char *refCStr,         /*Fasta or fastq with the references*/
+    char *qryCStr,         /*Fasta or fastq with the queries*/
+    char inMapBl,          /*1: Use the built in mapper; 2: align
+                             to the best reference (alnQuery)*/
+    char allVsAllBl        /*1: All vs all (secondary & no self)*/
+); /*Starts minimap2 or sets up the built in mapper*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if succeded
+|        o 2 if end of file
+|        o 64 if memory allocation error
+|    - Modifies:
+|        o samST to have the next sam entry (same as readSamLine)
+| Note:
+|    - minimap2 entries point into mapST->samBlockST, so they are only
+|      valid till the next call or closeSamMap. Set copyLineBl to keep
+|      each entry in its own samEntryCStr.
+\---------------------------------------------------------------------*/
+uint8_t readSamMap(
+    struct samEntry *samST, /*Gets the next sam entry*/
+    struct samMap *mapST    /*minimap2 or built in mapper output*/
+); /*Reads the next sam entry from minimap2 or the built in mapper*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Closes: The minimap2 pipe or the query file
+|    - Frees: All heap memory used by the built in mapper
+\---------------------------------------------------------------------*/
+void closeSamMap(
+    struct samMap *mapST /*Structure to close*/
+); /*Closes minimap2 or frees the built in mapper*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if read in a sequence
+|        o 2 if at the end of the file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o idCStr, seqCStr, & qCStr to have the id (no '>' or '@'),
+|          sequence, & q-score entry ('\0' for fasta). These are
+|          resized when to small
+|        o lenSeqUI to have the length of the sequence
+\---------------------------------------------------------------------*/
+uint8_t readMapSeq(
+    FILE *inFILE,           /*Fasta or fastq file to read*/
+    char **idCStr,          /*Holds the read id*/
+    unsigned long *lenIdUL, /*Size of idCStr*/
+    char **seqCStr,         /*Holds the sequence*/
+    unsigned long *lenSeqUL,/*Size of seqCStr*/
+    char **qCStr,           /*Holds the q-score entry*/
+    unsigned long *lenQUL,  /*Size of qCStr*/
+    uint32_t *lenSeqUI      /*Gets the length of the sequence*/
+); /*Reads in the next fasta or fastq entry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Length of buffCStr after the line was added (no new line)
+|        o -1 if at the end of the file
+|        o -2 for memory allocation errors
+|    - Modifies:
+|        o buffCStr to have the line at startUL (resized if to small)
+\---------------------------------------------------------------------*/
+long readMapLine(
+    FILE *inFILE,              /*File to read the line from*/
+    char **buffCStr,           /*Buffer to add the line to*/
+    unsigned long *lenBuffUL,  /*Size of buffCStr*/
+    unsigned long startUL      /*Position in buffCStr to add line at*/
+); /*Reads in a line of any length (no new line) into a buffer*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of minimizers in minzAry (startUL + new minimizers)
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o minzAry to have the minimizers after startUL (is resized
+|          when to small)
+\---------------------------------------------------------------------*/
+long getMapMinz(
+    char *seqCStr,             /*Sequence to get minimizers for*/
+    uint32_t lenSeqUI,         /*Length of seqCStr*/
+    uint32_t seqUI,            /*Index to assign to each minimizer*/
+    struct mapMinz **minzAry,  /*Gets the minimizers*/
+    unsigned long *lenMinzUL,  /*Number minimizers minzAry can hold*/
+    unsigned long startUL      /*First index in minzAry to fill*/
+); /*Finds the (w,k) minimizers in a sequence*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if built the index
+|        o 2 if could not open the reference file or had no sequences
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o refIdx to have the references & their sorted minimizers
+\---------------------------------------------------------------------*/
+uint8_t buildMapRefIdx(
+    struct mapRefIdx *refIdx, /*Gets the index*/
+    char *refCStr             /*Fasta or fastq file with references*/
+); /*Reads in the references & builds their minimizer index*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Number of chains put in chainAry (sorted by score)
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o anchorAry in mapST is sorted by reference, strand, &
+|          position
+|        o scoreAryI & parentAryL in mapST to have the chains
+|        o chainAry in mapST to have the kept chains
+\---------------------------------------------------------------------*/
+long chainMapAnchors(
+    struct samMap *mapST,      /*Has the anchors to chain*/
+    unsigned long numAnchorsUL /*Number of anchors in anchorAry*/
+); /*Finds the best chains of anchors between a query & references*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Alignment score (0 if nothing aligned)
+|        o -1 for memory allocation errors
+|    - Modifies:
+|        o cigarCStr in mapST to have the eqx cigar (soft masks on ends)
+|        o refStartUI & numDiffUI to have the first aligned reference
+|          base (index 0) & edit distance
+\---------------------------------------------------------------------*/
+long alnMapChain(
+    struct samMap *mapST,    /*Has the chain & scratch buffers*/
+    char *qrySeqCStr,        /*Query sequence (reverse complemented if
+                               the chain is on the reverse strand)*/
+    struct mapChain *chainST,/*Chain to align around*/
+    uint32_t *refStartUI,    /*Gets first aligned base on reference*/
+    uint32_t *numDiffUI      /*Gets number of differences (NM)*/
+); /*Does a banded local alignment of a query around a chain*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if mapped (or did not map) the query
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have the sam entries for the query
+\---------------------------------------------------------------------*/
+uint8_t mapQuery(
+    struct samMap *mapST /*Has the query & index to map with*/
+); /*Maps the current query in mapST to the reference index*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if have enough memory
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revSeqCStr & revQCStr in mapST to hold the current query
+\---------------------------------------------------------------------*/
+uint8_t growSamMapBuff(
+    struct samMap *mapST /*Has the query & buffers to resize*/
+); /*Makes sure the reverse complement buffers can hold the query*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if have enough memory
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o anchorAry, scoreAryI, parentAryL, orderAryULng, usedAryUC,
+|          & chainAry in mapST to hold at least numAnchorsUL items
+\---------------------------------------------------------------------*/
+uint8_t growSamMapAnchors(
+    struct samMap *mapST,      /*Has the arrays to resize*/
+    unsigned long numAnchorsUL /*Number of anchors need to hold*/
+); /*Makes sure the anchor & chain arrays can hold numAnchorsUL*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if have enough memory
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have at least lenNeedUL free bytes
+\---------------------------------------------------------------------*/
+uint8_t growMapLine(
+    struct samMap *mapST,   /*Has the sam entry buffer to resize*/
+    unsigned long lenNeedUL /*Number of bytes that will be added*/
+); /*Makes sure the sam entry buffer has space for another entry*/
+
+/*---------------------------------------------------------------------\
+| Output: Modifies: mapST to have all values set to 0
+\---------------------------------------------------------------------*/
+void initSamMap(
+    struct samMap *mapST /*Structure to initialize*/
+); /*Sets all variables in a samMap structure to defaults*/
+
+/*---------------------------------------------------------------------\
+| Output: Frees: all memory in refIdx & sets values to 0
+\---------------------------------------------------------------------*/
+void freeMapRefIdx(
+    struct mapRefIdx *refIdx /*Index to free*/
+); /*Frees the references & minimizers in a mapRefIdx structure*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts by hash, then reference, then position
+\---------------------------------------------------------------------*/
+int cmpMapMinz(
+    const void *oneST, /*First mapMinz structure*/
+    const void *twoST  /*Second mapMinz structure*/
+); /*qsort compare function for mapMinz structures*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts by reference, strand, reference position, then query
+|      position
+\---------------------------------------------------------------------*/
+int cmpMapAnchor(
+    const void *oneST, /*First mapAnchor structure*/
+    const void *twoST  /*Second mapAnchor structure*/
+); /*qsort compare function for mapAnchor structures*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts from highest to lowest value (best chain score first)
+\---------------------------------------------------------------------*/
+int cmpMapOrder(
+    const void *oneST, /*First uint64_t*/
+    const void *twoST  /*Second uint64_t*/
+); /*qsort compare function to sort (score << 32 | anchor) values*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns: < 0 if oneST goes first, 0 if same, > 0 if after
+| Note:
+|    - Sorts from highest to lowest chain score
+\---------------------------------------------------------------------*/
+int cmpMapChain(
+    const void *oneST, /*First mapChain structure*/
+    const void *twoST  /*Second mapChain structure*/
+); /*qsort compare function for mapChain structures*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if saved the index
+|        o 2 if could not write to outCStr
+|    - Creates:
+|        o outCStr with the references & minimizers in refIdx
+| Note:
+|    - The format is defMapIdxMagicCStr, the k-mer & window length,
+|      the number of references, each id & sequence (length first), the
+|      number of minimizers, & then the minimizer array. It is only
+|      meant to be read back on the same machine
+\---------------------------------------------------------------------*/
+uint8_t writeMapRefIdx(
+    struct mapRefIdx *refIdx, /*Index to save*/
+    char *outCStr             /*File to save the index to*/
+); /*Saves an index made by buildMapRefIdx to a file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if read in the index
+|        o 2 if the file is not a complete index or was made with a
+|          different k-mer or window length
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o refIdx to have the saved references & minimizers
+| Note:
+|    - idxFILE should be just past defMapIdxMagicCStr
+\---------------------------------------------------------------------*/
+uint8_t readMapRefIdx(
+    struct mapRefIdx *refIdx, /*Gets the index*/
+    FILE *idxFILE             /*File made by writeMapRefIdx*/
+); /*Reads in an index saved by writeMapRefIdx*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if hashed the file
+|        o 2 if could not open the file
+|    - Modifies:
+|        o hashULng to have the FNV-1a hash of the file & keyCStr
+\---------------------------------------------------------------------*/
+uint8_t hashMapRefFile(
+    char *fileCStr,    /*File to hash*/
+    char *keyCStr,     /*Settings to add to the hash (preset)*/
+    uint64_t *hashULng /*Gets the hash*/
+); /*Hashes the contents of a file with the settings used to index it*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if found or made the cached index
+|        o 2 if could not read refCStr or write to cacheDirCStr
+|        o 32 if minimap2 could not make the index
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o cachePathCStr to have the path to the cached index, which is
+|          used in place of refCStr. It needs to hold
+|          strlen(cacheDirCStr) + 64 characters
+|    - Creates:
+|        o cacheDirCStr/<hash>-<preset>.mmi (minimap2) or
+|          cacheDirCStr/<hash>-k<k>w<w>.idx (built in mapper) when the
+|          index is not cached yet
+| Note:
+|    - The file name has the hash of the references & the settings, so
+|      a changed reference file or preset gets a new index. Old indexes
+|      are never removed.
+\---------------------------------------------------------------------*/
+uint8_t getMapRefCache(
+    char *refCStr,       /*Fasta or fastq with the references*/
+    char *cacheDirCStr,  /*Directory to keep the indexes in*/
+    char inMapBl,        /*1: Index for the built in mapper*/
+    char *cachePathCStr  /*Gets the path to the cached index*/
+); /*Finds or makes a saved index for a reference file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if aligned (or did not align) the query
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have the sam entry for the query
+|    Note:
+|        o The query is aligned (semi-global) to the reference & strand
+|          it shares the most minimizers with. Queries with to many
+|          cells for the aligner are mapped with mapQuery instead
+\---------------------------------------------------------------------*/
+uint8_t alnQuery(
+    struct samMap *mapST /*Has the query, index, & packed references*/
+); /*Aligns the current query end to end to its best reference*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if made the reverse complement
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revSeqCStr & revQCStr in mapST to have the reverse
+|          complement of the query
+|        o skipAryUC in mapST to mark self & dual mappings (all vs all)
+\---------------------------------------------------------------------*/
+uint8_t revCompMapQuery(
+    struct samMap *mapST /*Has the query to reverse complement*/
+); /*Makes the reverse complement of the current query*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if added the entry
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o lineCStr in mapST to have an unmapped entry for the query
+\---------------------------------------------------------------------*/
+uint8_t addMapUnmapped(
+    struct samMap *mapST /*Has the query & sam entry buffer*/
+); /*Adds an unmapped sam entry for the current query*/
+
+#endif
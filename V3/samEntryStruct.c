@@ -24,32 +24,51 @@
 '    fun-8 processSamEntry: Extract data from a sam file entry
 '    fun-9: readSamLine: Read in a line form a sam file,
 '        - calls processSamEntry
-'    fun-10 findSamCig: find cigar in buffer with sam file entry. Will
-'                       resize buffer if an incomplete entry.
-'    fun-11
-'      - readNextPartOfLine: read part of a line with fgets
-'    fun-12
+'        - the line is split in a samBlock (not copied)
+'    fun-10
 '      - printSamStats: Print stats in samEntry struct to tsv filE
-'    fun-13 samToFq: Prints out sam entry as fastq file
+'    fun-11 samToFq: Prints out sam entry as fastq file
 '      - This does not print out the stats printed with printSamStats
-'    fun-14 printSamEntry: Prints sam entry in a samEntry structer
+'    fun-12 printSamEntry: Prints sam entry in a samEntry structer
 '      - This does not print out the stats printed with printSamStats
-'    fun-15 printStatsHeader:
+'    fun-13 printStatsHeader:
 '      - Prints header for a stats file made using a samEntryStruct
-'    fun-16 blankReadStat:
+'    fun-14 blankReadStat:
 '      - Banks a readStat structer
-'    fun-17 cpReadStat:
+'    fun-15 cpReadStat:
 '      - Copies stats from on readStat struct to another readStat struct
-'    fun-18
+'    fun-16
 '      - Reads single line from file printed to by printSamStats 
-'    fun-19 printReadStat:
+'    fun-17 printReadStat:
 '      - Prints out the stats in a readStat structure to a file
-'    fun-20 samEntryToReadStat:
+'    fun-18 samEntryToReadStat:
 '      - Copies stats from a samEntry struct to a readStat struct
-'    fun-21 readInConFa:
+'    fun-19 readInConFa:
 '      - Reads in a single sequence from a fasta file
 '      - fasta file should have only one sequence and it should be
 '        in two lines (first line is header, second line is sequence)
+'    fun-20 samCigToAry:
+'      - Packs the cigar into an array the first time it is needed
+'    fun-21 cigAryToCStr:
+'      - Writes a packed cigar back to text
+'    fun-22 hashReadId:
+'      - Hashes a read id for the binary stats records
+'    fun-23 samToStatRec:
+'      - Copies the stats in a samEntry struct to a statRec struct
+'    fun-24 printStatRec:
+'      - Prints the stats in a samEntry struct as a binary record
+'    fun-25 readStatRec:
+'      - Reads one record from a binary stats file
+'    fun-26 statTsvToRec:
+'      - Converts a tsv stats file (scoreReads) to a binary stats file
+'    fun-27 statRecToTsv:
+'      - Exports a binary stats file as a tsv
+'    fun-28 initSamBlock:
+'      - Sets up a samBlock structure to read a sam file
+'    fun-29 freeSamBlock:
+'      - Frees the block in a samBlock structure
+'    fun-30 copySamEntry:
+'      - Copies a sam entry out of its samBlock into samEntryCStr
 <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
 #include "samEntryStruct.h"
@@ -73,6 +92,7 @@ void blankSamEntry(
     samEntryStruct->cigarCStr = 0;
     samEntryStruct->seqCStr = 0;
     samEntryStruct->qCStr = 0; 
+    samEntryStruct->lenCigUI = 0; /*Keeps cigAryUI for the next read*/
 
     if(samEntryStruct->samEntryCStr != 0)
         *samEntryStruct->samEntryCStr = '\0'; /*So user knows blanked*/
@@ -186,7 +206,7 @@ uint8_t deepCpSamReadStats(
     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
     char
-        *lineCStr = oldSamEntry->samEntryCStr,
+        *lineCStr = oldSamEntry->lineCStr,
         *cpLineCStr = newSamEntry->samEntryCStr;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -301,7 +321,10 @@ void initSamEntry(
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     samEntry->samEntryCStr = 0;
+    samEntry->lineCStr = 0;
     samEntry->lenBuffULng = 0;
+    samEntry->cigAryUI = 0;
+    samEntry->lenCigBuffUI = 0;
     blankSamEntry(samEntry);
 } /*initSamEntry*/
 
@@ -320,6 +343,11 @@ void freeStackSamEntry(
     if(samEntry->samEntryCStr != 0)
         free(samEntry->samEntryCStr);
 
+    if(samEntry->cigAryUI != 0)
+        free(samEntry->cigAryUI);
+
+    samEntry->cigAryUI = 0;
+    samEntry->lenCigBuffUI = 0;
     return;
 } /*freeStackSamEntry*/
 
@@ -338,6 +366,9 @@ void freeHeapSamEntry(
     if((*samEntry)->samEntryCStr != 0)
         free((*samEntry)->samEntryCStr);
 
+    if((*samEntry)->cigAryUI != 0)
+        free((*samEntry)->cigAryUI);
+
     free(*samEntry);
     *samEntry = 0;
 
@@ -368,7 +399,9 @@ void processSamEntry(
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char
-        *samIterUChar = samEntry->samEntryCStr; /*iterator*/
+        *samIterUChar = samEntry->lineCStr; /*iterator*/
+
+    samEntry->lenCigUI = 0; /*The cigar is packed when first needed*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-8 Sec-2: Check if their is a sam entry
@@ -467,606 +500,176 @@ void processSamEntry(
 #        - 2 if end of file
 #        - 64 if memory allocation error
 #    Modifies: All pointers in samStruct & the variables for read Lenth
+# Note:
+#    - Lines are found with memchr in blockST & the new line is
+#      replaced with '\0', so samStruct points into the block. A line
+#      is only copied when it crosses the end of the block. The block
+#      is doubled if a line does not fit in it.
+#    - samStruct->samEntryCStr is not used for the line, but is made if
+#      samStruct has no buffer (callers use it for other sequences)
 ######################################################################*/
 uint8_t readSamLine(
     struct samEntry *samStruct,
-    FILE *inFILE
+    struct samBlock *blockST
 ) /*Reads in sam entry & sets pointers in samStruct*/
 { /*readSamLine*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-9 TOC: readSamLine
     #     fun-9 sec-1: Variable declerations
-    #     fun-9 sec-2: Check if have buffer to read into & prepare buffer
-    #     fun-9 sec-3: Check if can read line in one go
-    #     fun-9 sec-4: Check if is header & need to read in more
-    #     fun-9 sec-5: If not read in cigar & find sequence length
-    #     fun-9 sec-6: Check if have full sequence from cigar read in
-    #     fun-9 sec-7: If not find sequence length
-    #     fun-9 sec-8: Use sequence length to get sequence & q-score
-    #     fun-9 sec-9: If not, read rest of cigar by adding 1kb chunks
-    #     fun-9 sec-10: Set sequence & q-score pointers
+    #     fun-9 sec-2: Check if have buffers to read into
+    #     fun-9 sec-3: Find the next line, reading blocks as needed
+    #     fun-9 sec-4: Set pointers & read length
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-9 Sec-1: Variable declerations
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    char
-        *oldBufAddUChar = 0,
-        *samIterUChar = 0;  /*Tells if fget error or end of file*/
-    uint64_t
-        newBuffSizeULng = 0;
+    char *lineCStr = 0;
+    char *endLineCStr = 0;
+    char *tmpCStr = 0;
+    unsigned long readUL = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-2: Check if have buffer to read into & prepare buffer
+    # Fun-9 Sec-2: Check if have buffers to read into
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     if(samStruct->samEntryCStr == 0)
     { /*If have no buffer*/
         samStruct->lenBuffULng = 1400;
         samStruct->samEntryCStr = malloc(sizeof(char) * 1401);
-    } /*If have no buffer*/
-
-    /*Set second to last character in buffer to null, so can tell if
-      read entire line*/
-    *(samStruct->samEntryCStr + samStruct->lenBuffULng - 2) = '\0';
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-3: Check if can read line in one go
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    samIterUChar =
-        fgets(
-            samStruct->samEntryCStr,
-            samStruct->lenBuffULng,
-            inFILE
-    ); /*See if can read in a single line*/
-
-    if(samIterUChar == 0)
-        return 2;           /*At end of the file*/
-
-    if(
-        *(samStruct->samEntryCStr + samStruct->lenBuffULng - 2)=='\0' ||
-        *(samStruct->samEntryCStr + samStruct->lenBuffULng - 2) =='\n'
-    ) { /*If grabed the entire line*/
-        processSamEntry(samStruct);
-        return 1;
-    } /*If grabed the entire line*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-4: Check if is header & need to read in more
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    if(*samStruct->samEntryCStr == '@')
-    { /*If is a header line*/
-        newBuffSizeULng = 1000; /*Should be close, read in small chunks*/
-    
-        while(
-          !(*(samStruct->samEntryCStr+samStruct->lenBuffULng-2)=='\0' ||
-           *(samStruct->samEntryCStr + samStruct->lenBuffULng -2)=='\n')
-        ) { /*While have not read in the full line*/
-            samIterUChar =
-                readNextPartOfLine(inFILE, samStruct, newBuffSizeULng);
-    
-            if(samStruct->samEntryCStr == 0)
-            { /*If memory allocation errory*/
-                printMemAlocErr(
-                    "samFileStructs.c",
-                    "readSamLine",
-                    10,
-                    533
-                ); /*Let user know of memory allocation failure*/
-    
-                return 64;
-            } /*If memory allocation errory*/
-        } /*While have not read in the full line*/
-
-        return 1;
-    } /*If is a header line*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-5: If not read in cigar & get sequence length from cigar
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    if(findSamCig(inFILE, samStruct) == 4)
-    { /*If memory allocation error or end of file*/
-        if(samStruct->samEntryCStr == 0)
-        { /*If memory allocation errory*/
-            printMemAlocErr(
-                "samFileStructs.c",
-                "readSamLine",
-                10,
-                454
-            ); /*Let user know of memory allocation failure*/
-
-            return 64;
-        } /*If memory allocation errory*/
-    } /*If memory allocation error or end of file*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-6: Check if have full sequence from cigar read in
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    /*Check if have full sequence and finish setting pionters*/
-    if(
-        *(samStruct->samEntryCStr + samStruct->lenBuffULng - 2)=='\0' ||
-        *(samStruct->samEntryCStr + samStruct->lenBuffULng - 2) =='\n'
-    ) { /*If now have the entire line*/
-        samIterUChar = samStruct->cigarCStr;
-
-        for(uint32_t intTab = 0; intTab < 4; ++intTab)
-        { /*Loop through cigar, RNEXT, PNEXT, & TLEN entires*/
-            while(*samIterUChar != '\t')
-                ++samIterUChar;
-            ++samIterUChar; /*get off the tab*/
-        } /*Loop through cigar, RNEXT, PNEXT, & TLEN entires*/
-
-        samStruct->seqCStr = samIterUChar;
-        samStruct->qCStr = samIterUChar + samStruct->readLenUInt + 1;
-            /*reaLenUint to move past sequence; +1 to get off the tab*/
-        return 1;
-    } /*If now have the entire line*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-7: If not find sequence length
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    samIterUChar = samStruct->cigarCStr;
-
-    while(*samIterUChar != '\t')
-    { /*While their are entries in the cigar*/
-        ++samIterUChar;
-        ++newBuffSizeULng; /*Find length of the cigar (avoid guessing)*/
-    } /*While their are entries in the cigar*/
-
-    /*MD entries will be bit longer than cigars, but can double cigar
-      to get a rough size. This way I only have to read in once or
-      twice*/
-    newBuffSizeULng = newBuffSizeULng << 1;
-
-    /*Figure out buffer size with sequence & q-score*/
-    newBuffSizeULng +=                    /*newBuff has Cigar length*/
-        (samStruct->readLenUInt << 1) +   /*Times by 2: seq + q-score*/
-        samStruct->cigarCStr - samStruct->samEntryCStr + /*pre cigar*/
-        2402;                             /*Extra buffer*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-7: Use sequence length to get sequence & q-score
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    if(newBuffSizeULng > samStruct->lenBuffULng)
-    { /*If the new buffer size with the sequence is bigger*/
-        newBuffSizeULng -= samStruct->lenBuffULng;
-        oldBufAddUChar = samStruct->samEntryCStr; /*For resting point*/
-
-        samIterUChar =
-            readNextPartOfLine(inFILE, samStruct, newBuffSizeULng);
 
         if(samStruct->samEntryCStr == 0)
         { /*If memory allocation errory*/
             printMemAlocErr(
                 "samFileStructs.c",
                 "readSamLine",
-                10,
-                510
+                9,
+                545
             ); /*Let user know of memory allocation failure*/
-
             return 64;
         } /*If memory allocation errory*/
+    } /*If have no buffer*/
 
-        /*Readjust previous pointers*/
-        samStruct->queryCStr = samStruct->samEntryCStr;
-    
-        samStruct->refCStr =
-            samStruct->samEntryCStr +
-            (samStruct->refCStr - oldBufAddUChar);
-
-        samStruct->cigarCStr =
-            samStruct->samEntryCStr +
-            (samStruct->cigarCStr - oldBufAddUChar);
-    } /*If the new buffer size with the sequence is bigger*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-9: If not, read rest of cigar by adding 1kb chunks
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    newBuffSizeULng = 1000; /*Should be close, so read in small chunks*/
+    if(blockST->buffCStr == 0)
+    { /*If have no block*/
+        blockST->buffCStr = malloc(sizeof(char) * (SAM_BLOCK_LEN + 1));
 
-    while(
-      !(*(samStruct->samEntryCStr + samStruct->lenBuffULng - 2)=='\0' ||
-        *(samStruct->samEntryCStr + samStruct->lenBuffULng - 2) =='\n')
-    ) { /*While have not read in the full line*/
-        oldBufAddUChar = samStruct->samEntryCStr;
-        samIterUChar =
-            readNextPartOfLine(inFILE, samStruct, newBuffSizeULng);
-
-        if(samStruct->samEntryCStr == 0)
+        if(blockST->buffCStr == 0)
         { /*If memory allocation errory*/
             printMemAlocErr(
                 "samFileStructs.c",
                 "readSamLine",
-                10,
-                533
+                9,
+                561
             ); /*Let user know of memory allocation failure*/
 
+            samStruct->lineCStr = samStruct->samEntryCStr;
+            *samStruct->samEntryCStr = '\0';
             return 64;
         } /*If memory allocation errory*/
 
-        /*Readjust previous pointers*/
-        samStruct->queryCStr = samStruct->samEntryCStr;
-    
-        samStruct->refCStr =
-            samStruct->samEntryCStr +
-            (samStruct->refCStr - oldBufAddUChar);
-
-        samStruct->cigarCStr =
-            samStruct->samEntryCStr +
-            (samStruct->cigarCStr - oldBufAddUChar);
-    } /*While have not read in the full line*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-9 Sec-10: Set sequence & q-score pointers
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    /*Have entire entry, just need to find additional pointers*/
-    samIterUChar = samStruct->cigarCStr;
-
-    /*SEQ IS ON Q-SCORE, FIX*/
-    for(uint32_t intTab = 0; intTab < 4; ++intTab)
-    { /*Loop through cigar, RNEXT, PNEXT, & TLEN entires*/
-        while(*samIterUChar != '\t')
-            ++samIterUChar;
-        ++samIterUChar; /*get off the tab*/
-    } /*Loop through cigar, RNEXT, PNEXT, & TLEN entires*/
-
-    samStruct->seqCStr = samIterUChar;
-
-    if(*samStruct->seqCStr != '*')  /*if their is a sequence*/
-    { /*If have a sequence entry*/
-        if(*samStruct->cigarCStr != '*')
-            samStruct->qCStr = samIterUChar + samStruct->readLenUInt +1;
-        else
-        { /*Else have no cigar entry, need to find length manually*/
-            while(*samIterUChar > 32)
-            { /*While have bases in the sequence*/
-                ++samStruct->unTrimReadLenUInt;
-                ++samIterUChar;
-            } /*While have bases in the sequence*/
-
-            samStruct->readLenUInt = samStruct->unTrimReadLenUInt;
-            ++samIterUChar;  /*Get off tab after sequence*/
-            samStruct->qCStr = samIterUChar;
-        } /*Else have no cigar entry, need to find length manually*/
-        /*reaLenUint to move past sequence; +1 to get off the tab*/
-    } /*If have a sequence entry*/
-
-    else
-        samStruct->qCStr = samIterUChar + 2; /*no sequence present*/
-   
-    return 1;                    /*Read in full line, nothing to do*/
-} /*readSamLine*/
-
-/*######################################################################
-# Output:
-#     Returns:
-#        - 1 if succeded
-#        - 4 if end of file or memory allocation error
-#     Modifies: samStruct->samEntryCStr, samStruct->lenBuffULng, &
-#               samStruct->unTrimedLenULng
-# Note:
-#    - This requires that samStruct->samEntryCStr has read in at least
-#      part of the sam entry
-######################################################################*/
-uint8_t findSamCig(
-    FILE *inFILE,               /*File to search for cigar in*/
-    struct samEntry *samStruct
-) /*Finds the cigar in same entry (uses fgets if needs more buffer) &
-    also finds the number of bases in query from cigar*/
-{ /*findSamCig*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 TOC: findSamCig
-    #    fun-10 sec-1: Variable declerations
-    #    fun-10 sec-2: Set query pointer & read to start of flag
-    #    fun-10 sec-3: Read in flag & move to start of reference id
-    #    fun-10 sec-4: Set reference id pointer & move to position
-    #    fun-10 sec-5: Read position & move to start of mapq
-    #    fun-10 sec-6: Read in mapq & move to start of cigar
-    #    fun-10 sec-7: Read in cigar
-    #    fun-10 sec-8: Find length of sequence in the cigar
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+        blockST->lenBuffUL = SAM_BLOCK_LEN;
+        blockST->startUL = 0;
+        blockST->endUL = 0;
+    } /*If have no block*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-1: Variable declerations
+    # Fun-9 Sec-3: Find the next line, reading blocks as needed
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    char
-        *oldBufAddUChar = 0,    /*Used for refinding pointers*/
-        *samIterUChar = samStruct->samEntryCStr;
-    uint32_t
-        cigEntryUInt = 0;
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-2: Set query pointer & read to start of flag
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    samStruct->queryCStr = samIterUChar;
-
-    while(*samIterUChar != '\t')
-    { /*While on the query id*/
-        if(*samIterUChar == '\0')
-        { /*If at end of buffer*/
-            samIterUChar =
-                readNextPartOfLine(
-                    inFILE,
-                    samStruct,
-                    samStruct->lenBuffULng /*Doubles buffer size*/
-            ); /*Read in next section of line & double buffer size*/
-
-            if(samIterUChar == 0)
-                return 4;         /*incomplete sam aligment*/
-
-            /*Readjust previous pointers*/
-            samStruct->queryCStr = samStruct->samEntryCStr;
-        } /*If at end of buffer*/
-
-        ++samIterUChar;
-    } /*While on the query id*/
-
-    ++samIterUChar;   /*Get off tab*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-3: Read in flag & move to start of reference id
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    /*Get how many characters the mapq is in the sam entry*/
-    cigEntryUInt = samIterUChar - samStruct->samEntryCStr;
-
-    /*Need to make sure entire flag is read in*/ 
-    for(uint32_t intIter = 0; *(samIterUChar+intIter) != '\t';++intIter)
-    { /*loop till at end of number*/
-        if(*(samIterUChar + intIter) == '\0')
-        { /*If at end of buffer*/
-            samIterUChar =
-                readNextPartOfLine(
-                    inFILE,
-                    samStruct,
-                    samStruct->lenBuffULng /*Doubles buffer size*/
-            ); /*Read in next section of line & double buffer size*/
-
-            if(samIterUChar == 0)
-                return 4;         /*incomplete sam aligment*/
-
-            /*Make sure pionter is set start of flag*/
-            samIterUChar = samStruct->samEntryCStr + cigEntryUInt;
-            /*Readjust previous pointers*/
-            samStruct->queryCStr = samStruct->samEntryCStr;
-        } /*If at end of buffer*/
-    } /*loop till at end of number*/
-
-    samIterUChar = cStrToUSht(samIterUChar, &samStruct->flagUSht);
-    ++samIterUChar;   /*Get off tab*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-4: Set reference id pointer & move to position
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    samStruct->refCStr = samIterUChar;
-
-    while(*samIterUChar != '\t')
-    { /*While on the reference id*/
-        if(*samIterUChar == '\0')
-        { /*If at end of buffer*/
-            oldBufAddUChar = samStruct->samEntryCStr;
-
-            samIterUChar =
-                readNextPartOfLine(
-                    inFILE,
-                    samStruct,
-                    samStruct->lenBuffULng /*Doubles buffer size*/
-            ); /*Read in next section of line & double buffer size*/
-
-            if(samIterUChar == 0)
-                return 4;         /*incomplete sam aligment*/
-
-            /*Readjust previous pointers*/
-            samStruct->queryCStr = samStruct->samEntryCStr;
-    
-            samStruct->refCStr =
-                samStruct->samEntryCStr +
-                (samStruct->refCStr - oldBufAddUChar);
-        } /*If at end of buffer*/
-
-        ++samIterUChar;
-    } /*While on the reference id*/
-
-    ++samIterUChar;   /*Get off tab*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-5: Get off position & move to start of mapq
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    for(uint32_t intIter = 0; *(samIterUChar+intIter) != '\t';++intIter)
-    { /*Loop while not sure if read in entire positoin entry*/
-        if(*samIterUChar == '\0')
-        { /*If at end of buffer*/
-            oldBufAddUChar = samStruct->samEntryCStr;
-
-            samIterUChar =
-                readNextPartOfLine(
-                    inFILE,
-                    samStruct,
-                    samStruct->lenBuffULng /*Doubles buffer size*/
-            ); /*Read in next section of line & double buffer size*/
-
-            if(samIterUChar == 0)
-                return 4;         /*incomplete sam aligment*/
-
-            /*Readjust previous pointers*/
-            samStruct->queryCStr = samStruct->samEntryCStr;
-    
-            samStruct->refCStr =
-                samStruct->samEntryCStr +
-                (samStruct->refCStr - oldBufAddUChar);
-        } /*If at end of buffer*/
-    } /*Loop while not sure if read in entire positoin entry*/
-
-    /*Record the position entry*/
-    samIterUChar = cStrToUInt(samIterUChar, &samStruct->posOnRefUInt);
-    ++samIterUChar;   /*Get off tab*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-6: Read in mapq & move to start of cigar
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+    while(1)
+    { /*Loop: Find the end of the next line*/
+        lineCStr = blockST->buffCStr + blockST->startUL;
+
+        endLineCStr =
+            memchr(lineCStr, '\n', blockST->endUL - blockST->startUL);
+
+        if(endLineCStr != 0)
+            break; /*Found the end of the line*/
+
+        if(blockST->eofBl)
+        { /*If read the whole file*/
+            if(blockST->startUL == blockST->endUL)
+            { /*If at the end of the file*/
+                /*The last line may be in a freed block, so point to
+                  an empty line (callers check for headers)*/
+                samStruct->lineCStr = samStruct->samEntryCStr;
+                *samStruct->samEntryCStr = '\0';
+                return 2;
+            } /*If at the end of the file*/
+
+            /*Last line did not end in a new line*/
+            endLineCStr = blockST->buffCStr + blockST->endUL;
+            break;
+        } /*If read the whole file*/
+
+        /*The line crosses the end of the block. Move the start of the
+          line to the front of the block, so the rest can be read in*/
+        if(blockST->startUL > 0)
+        { /*If the line is not at the start of the block*/
+            memmove(
+                blockST->buffCStr,
+                lineCStr,
+                blockST->endUL - blockST->startUL
+            );
 
-    /*Get how many characters the mapq is in the sam entry*/
-    cigEntryUInt = samIterUChar - samStruct->samEntryCStr;
+            blockST->endUL -= blockST->startUL;
+            blockST->startUL = 0;
+        } /*If the line is not at the start of the block*/
 
-    /*Need to make sure entire mapq is read in*/ 
-    for(uint32_t intIter = 0; *(samIterUChar+intIter) != '\t';++intIter)
-    { /*loop till at end of number*/
-        if(*(samIterUChar + intIter) == '\0')
-        { /*If at end of buffer*/
-            oldBufAddUChar = samStruct->samEntryCStr;
+        else if(blockST->endUL == blockST->lenBuffUL)
+        { /*Else if the line is longer than the block*/
+            tmpCStr =
+                realloc(
+                    blockST->buffCStr,
+                    sizeof(char) * ((blockST->lenBuffUL << 1) + 1)
+                ); /*Double the block size*/
 
-            samIterUChar =
-                readNextPartOfLine(
-                    inFILE,
-                    samStruct,
-                    samStruct->lenBuffULng /*Doubles buffer size*/
-            ); /*Read in next section of line & double buffer size*/
+            if(tmpCStr == 0)
+            { /*If memory allocation errory*/
+                printMemAlocErr(
+                    "samFileStructs.c",
+                    "readSamLine",
+                    9,
+                    632
+                ); /*Let user know of memory allocation failure*/
+                return 64;
+            } /*If memory allocation errory*/
 
-            if(samIterUChar == 0)
-                return 4;         /*incomplete sam aligment*/
+            blockST->buffCStr = tmpCStr;
+            blockST->lenBuffUL <<= 1;
+        } /*Else if the line is longer than the block*/
 
-            /*Make sure pionter points to start of mapq*/
-            samIterUChar = samStruct->samEntryCStr + cigEntryUInt;
+        readUL =
+            fread(
+                blockST->buffCStr + blockST->endUL,
+                sizeof(char),
+                blockST->lenBuffUL - blockST->endUL,
+                blockST->inFILE
+            ); /*Fill the rest of the block*/
 
-            /*Readjust previous pointers*/
-            samStruct->queryCStr = samStruct->samEntryCStr;
-    
-            samStruct->refCStr =
-                samStruct->samEntryCStr +
-                (samStruct->refCStr - oldBufAddUChar);
-        } /*If at end of buffer*/
-    } /*loop till at end of number*/
+        if(readUL == 0)
+            blockST->eofBl = 1;
 
-    samIterUChar = cStrToUChar(samIterUChar, &(samStruct->mapqUChar));
-    ++samIterUChar;   /*Get off tab*/
+        blockST->endUL += readUL;
+    } /*Loop: Find the end of the next line*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-7: Read in cigar
+    # Fun-9 Sec-4: Set pointers & read length
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    samStruct->cigarCStr = samIterUChar;
-
-    while(*samIterUChar != '\t')
-    { /*While checking if cigar is compelete*/
-        if(*samIterUChar == '\0')
-        { /*If at end of buffer*/
-            oldBufAddUChar = samStruct->samEntryCStr;
-
-            samIterUChar =
-                readNextPartOfLine(
-                    inFILE,
-                    samStruct,
-                    samStruct->lenBuffULng /*Doubles buffer size*/
-            ); /*Read in next section of line & double buffer size*/
-
-            if(samIterUChar == 0)
-                return 4;         /*incomplete sam aligment*/
-
-            /*Readjust previous pointers*/
-            samStruct->queryCStr = samStruct->samEntryCStr;
-    
-            samStruct->refCStr =
-                samStruct->samEntryCStr +
-                (samStruct->refCStr - oldBufAddUChar);
-
-            samStruct->cigarCStr =
-                samStruct->samEntryCStr +
-                (samStruct->cigarCStr - oldBufAddUChar);
-        } /*If at end of buffer*/
+    *endLineCStr = '\0'; /*Block has one byte past lenBuffUL for this*/
+    blockST->startUL = endLineCStr - blockST->buffCStr;
 
-        ++samIterUChar;
-    } /*While checking if cigar is compelete*/
+    if(blockST->startUL < blockST->endUL)
+        ++blockST->startUL; /*Move past the new line*/
 
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-10 Sec-8: Find length of sequence in the cigar
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    samIterUChar = samStruct->cigarCStr;
-
-    while(*samIterUChar != '\t')
-    { /*While have cigar entries to read in*/
-        samIterUChar = cStrToUInt(samIterUChar, &cigEntryUInt);
-
-        if(
-            *samIterUChar == 'X' || /*Mismatch --eqx format*/
-            *samIterUChar == '=' || /*Match --eqx format*/
-            *samIterUChar == 'M' || /*Mismatch or match (no --eqx)*/
-            *samIterUChar == 'I' || /*Indel*/
-            *samIterUChar == 'S' || /*Soft mask*/
-            *samIterUChar == '\t'   /*Last number is a match (--eqx)*/
-        )
-            samStruct->unTrimReadLenUInt += cigEntryUInt;
-        ++samIterUChar; /*Get off entry character type*/
-    } /*While have cigar entries to read in*/
-
-    samStruct->readLenUInt = samStruct->unTrimReadLenUInt;
+    samStruct->lineCStr = lineCStr;
+    processSamEntry(samStruct); /*Single pass over the line*/
     return 1;
-} /*findSamCig*/
-
-/*######################################################################
-# Output:
-#    Returns: pointer to unsigned char with fgets return value
-#        - 0 for eof or memory allocation error (no data read in)
-#        - pointer to start of buffer with characters read in
-#    Sets: the second to last entry (samStruct->lenBuffULng - 2) in
-#          samStruct->samEntryCStr to '\0'. This allows the user to 
-#          check if fgets read in the entire line.
-#          This position will be '\0' or '\n' if entire line read in.
-######################################################################*/
-char * readNextPartOfLine(
-    FILE *inFILE,                   /*File to read from*/
-    struct samEntry *samStruct,
-    uint64_t buffChangeULng         /*How much to increase buffer by*/
-) /*Reads in next part of line when fgets did not get a full line*/
-{ /*readNextPartOfLine*/
-
-    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-11 Sec-1 Sub-1 TOC: readNextPartOfLine
-    <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
-
-    char *tmpUCStr = 0;
-
-    samStruct->samEntryCStr =
-        realloc(
-            samStruct->samEntryCStr, 
-            sizeof(uint8_t) * (samStruct->lenBuffULng + buffChangeULng)
-        ); /*Rellocate memory*/
-
-    tmpUCStr = samStruct->samEntryCStr + samStruct->lenBuffULng - 1;
-    samStruct->lenBuffULng += buffChangeULng;
-
-    while(*tmpUCStr == '\0') /*Make sure on the first null*/
-    { /*While on a null, loop till not on null so can find first null*/
-        ++buffChangeULng;
-        --tmpUCStr;
-    } /*While on a null, loop till not on null so can find first null*/
-
-    ++tmpUCStr;
-    /*Not adjusting buff change because fgets reads in one off*/
-
-    if(samStruct->samEntryCStr == 0)
-        return 0;
-
-    /*Set my marker for non-entire line read in*/
-    *(samStruct->samEntryCStr + samStruct->lenBuffULng - 2) = '\0';
-
-    return fgets(tmpUCStr, buffChangeULng, inFILE);
-} /*readNextPartOfLine*/
+} /*readSamLine*/
 
 /*######################################################################
 # Output:
@@ -1081,15 +684,15 @@ void printSamStats(
 { /*printSamStats*/
 
     /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-    # Fun-12 TOC: printSamStats
-    #    fun-12 sec-1: Variable declerations
-    #    fun-12 sec-2: Print out the header
-    #    fun-12 sec-3: Convert query & reference ids to c-strings
-    #    fun-12 sec-4: Print out stats from the samEntry structer
+    # Fun-10 TOC: printSamStats
+    #    fun-10 sec-1: Variable declerations
+    #    fun-10 sec-2: Print out the header
+    #    fun-10 sec-3: Convert query & reference ids to c-strings
+    #    fun-10 sec-4: Print out stats from the samEntry structer
     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
     /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-    # Fun-12 Sec-1: Variable declerations
+    # Fun-10 Sec-1: Variable declerations
     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
     char
@@ -1097,7 +700,7 @@ void printSamStats(
         *tmpRefCStr = (*samEntryStruct).refCStr;
 
     /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-    # Fun-12 Sec-2: Print out the header
+    # Fun-10 Sec-2: Print out the header
     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
     if(*printHeaderChar == 1)
@@ -1107,7 +710,7 @@ void printSamStats(
     } /*If printing out the header entry*/
 
     /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-    # Fun-12 Sec-3: Convert query & reference ids to c-strings
+    # Fun-10 Sec-3: Convert query & reference ids to c-strings
     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
     while(*tmpQueryCStr != '\t')
@@ -1119,7 +722,7 @@ void printSamStats(
     *tmpRefCStr = '\0'; /*turn into c-string*/
 
     /*<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
-    # Fun-12 Sec-4: Print out stats from the samEntry structer
+    # Fun-10 Sec-4: Print out stats from the samEntry structer
     >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>*/
 
     /*Print out the entry stats*/
@@ -1168,21 +771,21 @@ void samToFq(
 { /*samToFq*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-13 TOC: samToFq
-    #    fun-13 sec-1: Variable declerations
-    #    fun-13 sec-2: Find length of query id
-    #    fun-13 sec-3: Print sam entry as fastq entry
+    # Fun-11 TOC: samToFq
+    #    fun-11 sec-1: Variable declerations
+    #    fun-11 sec-2: Find length of query id
+    #    fun-11 sec-3: Print sam entry as fastq entry
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-13 Sec-1: Variable declerations
+    # Fun-11 Sec-1: Variable declerations
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char *tmpQueryCStr = samStruct->queryCStr;
     uint16_t lenQueryUSht = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-13 Sec-2: Find length of query id
+    # Fun-11 Sec-2: Find length of query id
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     while(*tmpQueryCStr > 32)
@@ -1192,7 +795,7 @@ void samToFq(
     } /*wile not at end of query id*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-13 Sec-3: Print sam entry as fastq entry
+    # Fun-11 Sec-3: Print sam entry as fastq entry
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     if(*samStruct->queryCStr != '@') /*If need to print out @ header*/
@@ -1234,7 +837,7 @@ void printSamEntry(
 ) /*Prints out the sam entry in the samStruct, does not print stats*/
 { /*printSamEntry*/
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-14 Sec-1 Sub-1 TOC: printSamEntry
+    # Fun-12 Sec-1 Sub-1 TOC: printSamEntry
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*printing out query name since is start of sam entry. This allows
@@ -1245,7 +848,11 @@ void printSamEntry(
     if(samStruct->queryCStr != 0)
         fprintf(outFILE, "%s", samStruct->queryCStr);
     else
-        fprintf(outFILE, "%s", samStruct->samEntryCStr); /*header*/
+        fprintf(outFILE, "%s", samStruct->lineCStr); /*header*/
+
+    /*Lines in a samBlock had their new line replaced with '\0'*/
+    if(samStruct->lineCStr != samStruct->samEntryCStr)
+        fputc('\n', outFILE);
 } /*printSamEntry*/
 
 /*---------------------------------------------------------------------\
@@ -1258,7 +865,7 @@ void printStatHeader(
 { /*printStatHeader*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-15 TOC: Sec-1 Sub-1: printStatsHeader
+    ' Fun-13 TOC: Sec-1 Sub-1: printStatsHeader
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     if(statFILE == 0)
@@ -1285,7 +892,7 @@ void blankReadStat(
 { /*blankReadStat*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-16 TOC: Sec-1 Sub-1: blankReadStat
+    ' Fun-14 TOC: Sec-1 Sub-1: blankReadStat
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*Blank Ids and mapping quality*/
@@ -1329,7 +936,7 @@ void cpReadStat(
 { /*cpReadStat*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    ' Fun-17 TOC: Sec-1 Sub-1: cpReadStat
+    ' Fun-15 TOC: Sec-1 Sub-1: cpReadStat
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*Blank Ids and mapping quality*/
@@ -1375,21 +982,21 @@ uint8_t readStatsFileLine(
 { /*readStatsFileLine*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-18 TOC: readStatsFileLine
-    '    fun-18 sec-1: variable declerations
-    '    fun-18 sec-2: Initalize and read in first line
-    '    fun-18 sec-3: If need to, read past header
-    '    fun-18 sec-4: Copy read and reference id's
-    '    fun-18 sec-5: Get mapq and read lengths
-    '    fun-18 sec-6: Get number of matches and mismatches
-    '    fun-18 sec-7: Get number of insertions and deletions
-    '    fun-18 sec-8: Get Q-scores
-    '    fun-18 sec-9: Get aligned Q-scores
-    '    fun-18 sec-10: Get total number of SNPs, insertions, & deletions
+    ' Fun-16 TOC: readStatsFileLine
+    '    fun-16 sec-1: variable declerations
+    '    fun-16 sec-2: Initalize and read in first line
+    '    fun-16 sec-3: If need to, read past header
+    '    fun-16 sec-4: Copy read and reference id's
+    '    fun-16 sec-5: Get mapq and read lengths
+    '    fun-16 sec-6: Get number of matches and mismatches
+    '    fun-16 sec-7: Get number of insertions and deletions
+    '    fun-16 sec-8: Get Q-scores
+    '    fun-16 sec-9: Get aligned Q-scores
+    '    fun-16 sec-10: Get total number of SNPs, insertions, & deletions
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-1: variable declerations
+    # Fun-16 Sec-1: variable declerations
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     uint16_t lenBuffUSht = 1024; /*is greater than one full line*/
@@ -1401,7 +1008,7 @@ uint8_t readStatsFileLine(
         *eofCStr = 0;   /*Tells me if at end of file*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-2: Initalize and read in first line
+    # Fun-16 Sec-2: Initalize and read in first line
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     blankReadStat(readStruct); /*Make sure no leftover data*/ 
@@ -1420,7 +1027,7 @@ uint8_t readStatsFileLine(
         return 2;         /*End of file, so no line to read in*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-3: If need to, read past header
+    # Fun-16 Sec-3: If need to, read past header
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     if(*onHeaderBool == 1)
@@ -1435,7 +1042,7 @@ uint8_t readStatsFileLine(
     } /*If on the header, move past*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-4: Copy read and reference id's
+    # Fun-16 Sec-4: Copy read and reference id's
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     tmpCStr = buffCStr;
@@ -1470,7 +1077,7 @@ uint8_t readStatsFileLine(
     ++tmpCStr; /*Get off the tab*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-5: Copy mapq and read lengths
+    # Fun-16 Sec-5: Copy mapq and read lengths
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     tmpCStr = cStrToUChar(tmpCStr, &readStruct->mapqUChar); /*Get mapq*/
@@ -1485,7 +1092,7 @@ uint8_t readStatsFileLine(
     ++tmpCStr; /*Get off the tab*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-6: Get number of matches and mismatches
+    # Fun-16 Sec-6: Get number of matches and mismatches
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Get the number of matches*/
@@ -1501,7 +1108,7 @@ uint8_t readStatsFileLine(
     ++tmpCStr; /*Get off the tab*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-7: Get number of insertions and deletions
+    # Fun-16 Sec-7: Get number of insertions and deletions
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Get the number of kept insertions*/
@@ -1513,10 +1120,11 @@ uint8_t readStatsFileLine(
     ++tmpCStr; /*Get off the tab*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-18 Sec-8: Get mean and median aligned Q-scores
+    ^ Fun-16 Sec-8: Get mean and median aligned Q-scores
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    sscanf(tmpCStr, "%f", &readStruct->meanQFlt); /*Get mean Q-score*/
+    /*printSamStats prints the median Q-score before the mean*/
+    sscanf(tmpCStr, "%f", &readStruct->medianQFlt); /*Get median Q*/
 
     /*Move to the next entry*/
     while(*tmpCStr > 32)
@@ -1524,7 +1132,7 @@ uint8_t readStatsFileLine(
 
     ++tmpCStr; /*Get off the tab*/
 
-    sscanf(tmpCStr, "%f", &readStruct->medianQFlt); /*Get median Q*/
+    sscanf(tmpCStr, "%f", &readStruct->meanQFlt); /*Get mean Q-score*/
 
     /*Move to the next entry*/
     while(*tmpCStr > 32)
@@ -1533,11 +1141,11 @@ uint8_t readStatsFileLine(
     ++tmpCStr; /*Get off the tab*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-9: Get median and mean aligned Q-scores
+    # Fun-16 Sec-9: Get median and mean aligned Q-scores
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    /*Get the mean aligned Q-score*/
-    sscanf(tmpCStr, "%f", &readStruct->meanAligQFlt);
+    /*Get the median aligned Q-score*/
+    sscanf(tmpCStr, "%f", &readStruct->medianAligQFlt);
 
     /*Move to the next entry*/
     while(*tmpCStr > 32)
@@ -1545,8 +1153,8 @@ uint8_t readStatsFileLine(
 
     ++tmpCStr; /*Get off the tab*/
 
-    /*Get the median aligned Q-score*/
-    sscanf(tmpCStr, "%f", &readStruct->medianAligQFlt);
+    /*Get the mean aligned Q-score*/
+    sscanf(tmpCStr, "%f", &readStruct->meanAligQFlt);
 
     /*Move to the next entry*/
     while(*tmpCStr > 32)
@@ -1555,7 +1163,7 @@ uint8_t readStatsFileLine(
     ++tmpCStr; /*Get off the tab*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
-    # Fun-18 Sec-10: Get total number of SNPs, insertions, & deletions
+    # Fun-16 Sec-10: Get total number of SNPs, insertions, & deletions
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Get the number of SNPs*/
@@ -1584,7 +1192,7 @@ void printReadStat(
 { /*printReadStat*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-19 TOC: Sec-1 Sub-1: printReadStat                           /
+    ' Fun-17 TOC: Sec-1 Sub-1: printReadStat                           /
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     if(readToPrint == 0)
@@ -1636,16 +1244,16 @@ void samEntryToReadStat(
 { /*samEntryToReadBin*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-20 TOC: samEntryToReadStat
-    '    fun-20 sec-2: Copy stats
-    '    fun-20 sec-1: Variable declerations
-    '    fun-20 sec-3: Copy the query id
-    '    fun-20 sec-4: Copy the reference id
+    ' Fun-18 TOC: samEntryToReadStat
+    '    fun-18 sec-2: Copy stats
+    '    fun-18 sec-1: Variable declerations
+    '    fun-18 sec-3: Copy the query id
+    '    fun-18 sec-4: Copy the reference id
     '
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-20 Sec-1: Variable declerations
+    ^ Fun-18 Sec-1: Variable declerations
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char
@@ -1653,7 +1261,7 @@ void samEntryToReadStat(
         *tmpCpCStr = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-20 Sec-2: Copy stats
+    ^ Fun-18 Sec-2: Copy stats
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     newBin->mapqUChar = samStruct->mapqUChar;
@@ -1679,7 +1287,7 @@ void samEntryToReadStat(
     tmpCStr = samStruct->queryCStr;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-20 Sec-3: Copy the query id
+    ^ Fun-18 Sec-3: Copy the query id
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     while(*tmpCStr > 16)
@@ -1692,7 +1300,7 @@ void samEntryToReadStat(
     *tmpCpCStr = '\0'; /*Mark end of c-string*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-20 Sec-4: Copy the reference id
+    ^ Fun-18 Sec-4: Copy the reference id
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     tmpCpCStr = newBin->refIdCStr;
@@ -1728,15 +1336,15 @@ unsigned char readInConFa(
 { /*readInConFa*/
 
     /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
-    ' Fun-21 TOC: readInConFa
-    '   fun-21 sec-1: variable declerations
-    '   fun-21 sec-2: Check if file exists and read in header
-    '   fun-21 sec-2: Read in the sequence
-    '   fun-21 sec-3: Set up q-score null entry, get length, and return
+    ' Fun-19 TOC: readInConFa
+    '   fun-19 sec-1: variable declerations
+    '   fun-19 sec-2: Check if file exists and read in header
+    '   fun-19 sec-2: Read in the sequence
+    '   fun-19 sec-3: Set up q-score null entry, get length, and return
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-21 Sec-1: variable declerations
+    ^ Fun-19 Sec-1: variable declerations
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     char *tmpCStr = 0;
@@ -1744,7 +1352,7 @@ unsigned char readInConFa(
     FILE *faFILE = 0;
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-21 Sec-2: Check if file exists and move past header
+    ^ Fun-19 Sec-2: Check if file exists and move past header
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Open the reference file for reading*/
@@ -1778,7 +1386,7 @@ unsigned char readInConFa(
     } /*While have a header to read in*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-21 Sec-2: Read in the sequence
+    ^ Fun-19 Sec-2: Read in the sequence
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     tmpCStr = refStruct->samEntryCStr;
@@ -1820,7 +1428,7 @@ unsigned char readInConFa(
     fclose(faFILE);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-    ^ Fun-21 Sec-3: Set up q-score null entry, get length, and return
+    ^ Fun-19 Sec-3: Set up q-score null entry, get length, and return
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     refStruct->seqCStr = refStruct->samEntryCStr;
@@ -1841,3 +1449,728 @@ unsigned char readInConFa(
 
     return 1;
 } /*readInConFa*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - cigAryUI in samST to have one packed entry per cigar entry
+|      (length << CIG_LEN_SHIFT | operation). A number at the end of
+|      the cigar with no operation is stored with the operation '\t'
+|    - lenCigUI in samST to have the number of entries in cigAryUI
+|  - Returns
+|    - 1 if succeeded (or the cigar was already packed)
+|    - 64 memory allocation error
+\---------------------------------------------------------------------*/
+uint8_t samCigToAry(
+    struct samEntry *samST /*Sam entry with cigar to pack*/
+) /*Packs the cigar in a sam entry into an array*/
+{ /*samCigToAry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-20 TOC: samCigToAry
+    '   fun-20 sec-1: Variable declerations
+    '   fun-20 sec-2: Check if the cigar is already packed
+    '   fun-20 sec-3: Pack each cigar entry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-20 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *cigCStr = samST->cigarCStr;
+    uint32_t lenUI = 0;          /*Number of bases in a cigar entry*/
+    uint32_t *tmpAryUI = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-20 Sec-2: Check if the cigar is already packed
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(samST->lenCigUI != 0 || cigCStr == 0 || *cigCStr == '*')
+        return 1; /*Already packed or no cigar to pack*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-20 Sec-3: Pack each cigar entry
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(*cigCStr > 32)
+    { /*Loop: Pack each cigar entry*/
+        if(samST->lenCigUI >= samST->lenCigBuffUI)
+        { /*If need more memory for the cigar*/
+            tmpAryUI =
+                realloc(
+                    samST->cigAryUI,
+                    sizeof(uint32_t) * (samST->lenCigBuffUI + 256)
+                ); /*Cigars only grow 256 entries at a time*/
+
+            if(tmpAryUI == 0)
+            { /*If had a memory allocation error*/
+                printMemAlocErr(
+                    "samEntryStruct.c",
+                    "samCigToAry",
+                    20,
+                    1405
+                ); /*Let user know of memory allocation failure*/
+
+                samST->lenCigUI = 0;
+                return 64;
+            } /*If had a memory allocation error*/
+
+            samST->cigAryUI = tmpAryUI;
+            samST->lenCigBuffUI += 256;
+        } /*If need more memory for the cigar*/
+
+        lenUI = 0;
+
+        while(*cigCStr < 58 && *cigCStr > 47)
+        { /*Loop: Read the number of bases in the entry*/
+            lenUI = (lenUI * 10) + (*cigCStr - 48);
+            ++cigCStr;
+        } /*Loop: Read the number of bases in the entry*/
+
+        if(*cigCStr < 33)
+        { /*If a number at the end of the cigar has no operation*/
+            samST->cigAryUI[samST->lenCigUI] =
+                (lenUI << CIG_LEN_SHIFT) | '\t';
+
+            ++samST->lenCigUI;
+            break;
+        } /*If a number at the end of the cigar has no operation*/
+
+        samST->cigAryUI[samST->lenCigUI] =
+            (lenUI << CIG_LEN_SHIFT) | (uint8_t) *cigCStr;
+
+        ++samST->lenCigUI;
+        ++cigCStr; /*Move off the operation*/
+    } /*Loop: Pack each cigar entry*/
+
+    return 1;
+} /*samCigToAry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - cigCStr to have the text cigar in cigAryUI (no '\0' at end)
+|  - Returns
+|    - Pointer to the character after the last cigar entry in cigCStr
+\---------------------------------------------------------------------*/
+char * cigAryToCStr(
+    struct samEntry *samST, /*Sam entry with packed cigar to print*/
+    char *cigCStr           /*Buffer to write the cigar to*/
+) /*Writes a packed cigar as text*/
+{ /*cigAryToCStr*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-21 TOC: Sec-1 Sub-1: cigAryToCStr
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    for(uint32_t uiCig = 0; uiCig < samST->lenCigUI; ++uiCig)
+    { /*Loop: Write each cigar entry*/
+        cigCStr =
+            uIntToCStr(
+                cigCStr,
+                samST->cigAryUI[uiCig] >> CIG_LEN_SHIFT
+            );
+
+        /*A '\t' entry is a number with no operation (matches)*/
+        if((samST->cigAryUI[uiCig] & CIG_OP_MASK) != '\t')
+        { /*If the entry has an operation*/
+            *cigCStr = (char) (samST->cigAryUI[uiCig] & CIG_OP_MASK);
+            ++cigCStr;
+        } /*If the entry has an operation*/
+    } /*Loop: Write each cigar entry*/
+
+    return cigCStr;
+} /*cigAryToCStr*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Returns
+|    - FNV-1a hash of idCStr (stops at the first white space)
+\---------------------------------------------------------------------*/
+uint64_t hashReadId(
+    char *idCStr /*Read id to hash (no '@' or '>')*/
+) /*Hashes a read id for the binary stats records*/
+{ /*hashReadId*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-22 TOC: Sec-1 Sub-1: hashReadId
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t hashUL = 14695981039346656037ULL; /*FNV-1a*/
+
+    while(*idCStr > 32)
+    { /*Loop: Hash the id*/
+        hashUL ^= (uint8_t) *idCStr;
+        hashUL *= 1099511628211ULL;
+        ++idCStr;
+    } /*Loop: Hash the id*/
+
+    return hashUL;
+} /*hashReadId*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - recST to have the stats & read id hash in samST
+\---------------------------------------------------------------------*/
+void samToStatRec(
+    struct samEntry *samST, /*Sam entry with stats to copy*/
+    struct statRec *recST   /*Record to copy stats to*/
+) /*Copies the stats in a samEntry struct to a statRec struct*/
+{ /*samToStatRec*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-23 TOC: Sec-1 Sub-1: samToStatRec
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*Blank the padding, so the same stats always give the same bytes*/
+    memset(recST, 0, sizeof(struct statRec));
+
+    recST->idHashUL = hashReadId(samST->queryCStr);
+    recST->mapqUChar = samST->mapqUChar;
+
+    recST->medianQFlt = samST->medianQFlt;
+    recST->medianAligQFlt = samST->medianAligQFlt;
+    recST->meanQFlt = samST->meanQFlt;
+    recST->meanAligQFlt = samST->meanAligQFlt;
+
+    recST->readLenUInt = samST->readLenUInt;
+    recST->readAligLenUInt = samST->readAligLenUInt;
+
+    recST->numMatchUInt = samST->numMatchUInt;
+    recST->numKeptMatchUInt = samST->numKeptMatchUInt;
+    recST->numKeptSNPUInt = samST->numKeptSNPUInt;
+    recST->numSNPUInt = samST->numSNPUInt;
+    recST->numKeptDelUInt = samST->numKeptDelUInt;
+    recST->numDelUInt = samST->numDelUInt;
+    recST->numKeptInsUInt = samST->numKeptInsUInt;
+    recST->numInsUInt = samST->numInsUInt;
+
+    return;
+} /*samToStatRec*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Prints
+|    - The stats in samST as a binary record (statRec) to outFILE
+\---------------------------------------------------------------------*/
+void printStatRec(
+    struct samEntry *samST, /*Sam entry to print stats for*/
+    FILE *outFILE           /*Binary stats file to print to*/
+) /*Prints the stats in a sam entry as a binary stats record*/
+{ /*printStatRec*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-24 TOC: Sec-1 Sub-1: printStatRec
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    struct statRec recST;
+
+    if(outFILE == 0)
+        return;
+
+    samToStatRec(samST, &recST);
+    fwrite(&recST, sizeof(struct statRec), 1, outFILE);
+
+    return;
+} /*printStatRec*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - recST to have the next record in statFILE
+|  - Returns
+|    - 1 if read in a record
+|    - 2 if at the end of the file
+|    - 8 if statFILE is 0
+|    - 16 if the file ended part way through a record
+\---------------------------------------------------------------------*/
+uint8_t readStatRec(
+    FILE *statFILE,        /*Binary stats file to read from*/
+    struct statRec *recST  /*Will hold the record*/
+) /*Reads one record from a binary stats file*/
+{ /*readStatRec*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-25 TOC: Sec-1 Sub-1: readStatRec
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long numBytesUL = 0;
+
+    if(statFILE == 0)
+        return 8;
+
+    numBytesUL = fread(recST, 1, sizeof(struct statRec), statFILE);
+
+    if(numBytesUL == 0)
+        return 2; /*End of file*/
+
+    if(numBytesUL < sizeof(struct statRec))
+        return 16; /*Only part of a record*/
+
+    return 1;
+} /*readStatRec*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Prints
+|    - Each line in a scoreReads tsv file (tsvFILE) to recFILE as a
+|      binary stats record
+|  - Returns
+|    - 1 if converted every line
+|    - 16 if a line could not be read
+\---------------------------------------------------------------------*/
+uint8_t statTsvToRec(
+    FILE *tsvFILE, /*scoreReads tsv file (has a header)*/
+    FILE *recFILE  /*Binary stats file to print records to*/
+) /*Converts a tsv stats file to a binary stats file*/
+{ /*statTsvToRec*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-26 TOC: Sec-1 Sub-1: statTsvToRec
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint8_t errUC = 0;
+    uint8_t headBl = 1;   /*The tsv file starts with a header*/
+    struct readStat readST;
+    struct statRec recST;
+
+    errUC = readStatsFileLine(tsvFILE, &headBl, &readST);
+
+    while(errUC & 1)
+    { /*Loop: Convert each line*/
+        memset(&recST, 0, sizeof(struct statRec));
+
+        recST.idHashUL = hashReadId(readST.queryIdCStr);
+        recST.mapqUChar = readST.mapqUChar;
+
+        recST.medianQFlt = readST.medianQFlt;
+        recST.medianAligQFlt = readST.medianAligQFlt;
+        recST.meanQFlt = readST.meanQFlt;
+        recST.meanAligQFlt = readST.meanAligQFlt;
+
+        recST.readLenUInt = readST.readLenUInt;
+        recST.readAligLenUInt = readST.readAligLenUInt;
+
+        recST.numMatchUInt = readST.numMatchUInt;
+        recST.numKeptMatchUInt = readST.numKeptMatchUInt;
+        recST.numKeptSNPUInt = readST.numKeptSNPUInt;
+        recST.numSNPUInt = readST.numSNPUInt;
+        recST.numKeptDelUInt = readST.numKeptDelUInt;
+        recST.numDelUInt = readST.numDelUInt;
+        recST.numKeptInsUInt = readST.numKeptInsUInt;
+        recST.numInsUInt = readST.numInsUInt;
+
+        fwrite(&recST, sizeof(struct statRec), 1, recFILE);
+        errUC = readStatsFileLine(tsvFILE, &headBl, &readST);
+    } /*Loop: Convert each line*/
+
+    if(errUC != 2)
+        return 16;
+
+    return 1;
+} /*statTsvToRec*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Prints
+|    - The records in statPathCStr to tsvFILE as a tsv with a header.
+|      Read ids are found by hashing the read ids in fqPathCStr; ids
+|      with no read in the fastq file are printed as '*'
+|  - Returns
+|    - 1 if printed the tsv
+|    - 2 if could not open the stats or fastq file
+|    - 16 if the stats file ended part way through a record
+|    - 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+uint8_t statRecToTsv(
+    char *statPathCStr, /*Binary stats file to export*/
+    char *fqPathCStr,   /*Fastq file with the reads in statPathCStr*/
+    char *refIdCStr,    /*Reference id to print for each read*/
+    FILE *tsvFILE       /*File to print the tsv to*/
+) /*Exports a binary stats file as a tsv*/
+{ /*statRecToTsv*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-27 TOC: statRecToTsv
+    '   fun-27 sec-1: Variable declerations
+    '   fun-27 sec-2: Copy the read ids in the fastq file
+    '   fun-27 sec-3: Build the read id hash table
+    '   fun-27 sec-4: Print out each record
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-27 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char lineCStr[1024];
+    char *tmpCStr = 0;
+    char *idCStr = 0;
+    char startLineBl = 1;   /*1: lineCStr is the start of a line*/
+    uint8_t lineUC = 0;     /*Line in the fastq entry (0 is header)*/
+    uint8_t errUC = 1;
+
+    char *idBuffCStr = 0;   /*Every read id; each ends with '\0'*/
+    unsigned long lenBuffUL = 0;
+    unsigned long usedBuffUL = 0;
+    unsigned long lenIdUL = 0;
+
+    unsigned long *offAryUL = 0; /*Start of each id in idBuffCStr*/
+    uint64_t *hashAryUL = 0;     /*Hash of each id*/
+    unsigned long lenIdAryUL = 0;
+    unsigned long numIdsUL = 0;
+
+    unsigned long *slotAryUL = 0; /*Index of id + 1 (0 is empty)*/
+    unsigned long numSlotsUL = 2;
+    unsigned long slotUL = 0;
+
+    void *tmpPtr = 0;
+    struct statRec recST;
+    FILE *statFILE = 0;
+    FILE *fqFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-27 Sec-2: Copy the read ids in the fastq file
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    statFILE = fopen(statPathCStr, "rb");
+
+    if(statFILE == 0)
+        return 2;
+
+    fqFILE = fopen(fqPathCStr, "r");
+
+    if(fqFILE == 0)
+    { /*If could not open the fastq file*/
+        fclose(statFILE);
+        return 2;
+    } /*If could not open the fastq file*/
+
+    while(fgets(lineCStr, 1024, fqFILE))
+    { /*Loop: Read in each read id*/
+        if(startLineBl && lineUC == 0)
+        { /*If on a header, copy the read id*/
+            tmpCStr = lineCStr + 1; /*Move off the '@'*/
+
+            while(*tmpCStr > 32)
+                ++tmpCStr;
+
+            lenIdUL = tmpCStr - lineCStr; /*Includes space for '\0'*/
+
+            if(usedBuffUL + lenIdUL > lenBuffUL)
+            { /*If need more memory for the read ids*/
+                lenBuffUL = (lenBuffUL << 1) + 1024;
+                tmpPtr = realloc(idBuffCStr, lenBuffUL);
+
+                if(tmpPtr == 0)
+                { /*If had a memory allocation error*/
+                    errUC = 64;
+                    break;
+                } /*If had a memory allocation error*/
+
+                idBuffCStr = tmpPtr;
+            } /*If need more memory for the read ids*/
+
+            if(numIdsUL >= lenIdAryUL)
+            { /*If need more memory for the id offsets*/
+                lenIdAryUL = (lenIdAryUL << 1) + 256;
+
+                tmpPtr =
+                   realloc(offAryUL, lenIdAryUL * sizeof(unsigned long));
+
+                if(tmpPtr == 0)
+                { /*If had a memory allocation error*/
+                    errUC = 64;
+                    break;
+                } /*If had a memory allocation error*/
+
+                offAryUL = tmpPtr;
+                tmpPtr = realloc(hashAryUL,lenIdAryUL*sizeof(uint64_t));
+
+                if(tmpPtr == 0)
+                { /*If had a memory allocation error*/
+                    errUC = 64;
+                    break;
+                } /*If had a memory allocation error*/
+
+                hashAryUL = tmpPtr;
+            } /*If need more memory for the id offsets*/
+
+            memcpy(idBuffCStr + usedBuffUL, lineCStr + 1, lenIdUL - 1);
+            idBuffCStr[usedBuffUL + lenIdUL - 1] = '\0';
+
+            offAryUL[numIdsUL] = usedBuffUL;
+            hashAryUL[numIdsUL] = hashReadId(lineCStr + 1);
+            usedBuffUL += lenIdUL;
+            ++numIdsUL;
+        } /*If on a header, copy the read id*/
+
+        tmpCStr = lineCStr;
+
+        while(*tmpCStr != '\0')
+            ++tmpCStr;
+
+        /*Lines longer than the buffer take more than one fgets*/
+        startLineBl = (tmpCStr != lineCStr && tmpCStr[-1] == '\n');
+
+        if(startLineBl)
+            lineUC = (lineUC + 1) & 3; /*Four lines per read*/
+    } /*Loop: Read in each read id*/
+
+    fclose(fqFILE);
+    fqFILE = 0;
+
+    if(errUC & 64)
+    { /*If had a memory allocation error*/
+        printMemAlocErr("samEntryStruct.c", "statRecToTsv", 27, 1844);
+        free(idBuffCStr);
+        free(offAryUL);
+        free(hashAryUL);
+        fclose(statFILE);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-27 Sec-3: Build the read id hash table
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(numSlotsUL < (numIdsUL << 1))
+        numSlotsUL <<= 1; /*Keep the table at most half full*/
+
+    slotAryUL = calloc(numSlotsUL, sizeof(unsigned long));
+
+    if(slotAryUL == 0)
+    { /*If had a memory allocation error*/
+        printMemAlocErr("samEntryStruct.c", "statRecToTsv", 27, 1863);
+        free(idBuffCStr);
+        free(offAryUL);
+        free(hashAryUL);
+        fclose(statFILE);
+        return 64;
+    } /*If had a memory allocation error*/
+
+    for(unsigned long ulId = 0; ulId < numIdsUL; ++ulId)
+    { /*Loop: Add each read id to the hash table*/
+        slotUL = hashAryUL[ulId] & (numSlotsUL - 1);
+
+        while(slotAryUL[slotUL] != 0)
+            slotUL = (slotUL + 1) & (numSlotsUL - 1);
+
+        slotAryUL[slotUL] = ulId + 1;
+    } /*Loop: Add each read id to the hash table*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-27 Sec-4: Print out each record
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    printStatHeader(tsvFILE);
+    errUC = readStatRec(statFILE, &recST);
+
+    while(errUC & 1)
+    { /*Loop: Print out each record*/
+        idCStr = "*";
+        slotUL = recST.idHashUL & (numSlotsUL - 1);
+
+        while(slotAryUL[slotUL] != 0)
+        { /*Loop: Find the read id*/
+            if(hashAryUL[slotAryUL[slotUL] - 1] == recST.idHashUL)
+            { /*If found the read id*/
+                idCStr = idBuffCStr + offAryUL[slotAryUL[slotUL] - 1];
+                break;
+            } /*If found the read id*/
+
+            slotUL = (slotUL + 1) & (numSlotsUL - 1);
+        } /*Loop: Find the read id*/
+
+        fprintf(
+            tsvFILE,
+            "%s\t%s\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%u\t%f\t%f\t%f\t%f",
+            idCStr,
+            refIdCStr,
+            recST.mapqUChar,
+            recST.readLenUInt,
+            recST.readAligLenUInt,
+            recST.numMatchUInt,
+            recST.numKeptMatchUInt,
+            recST.numKeptSNPUInt,
+            recST.numKeptInsUInt,
+            recST.numKeptDelUInt,
+            recST.medianQFlt,
+            recST.meanQFlt,
+            recST.medianAligQFlt,
+            recST.meanAligQFlt
+        ); /*1st printf: print out stats*/
+
+        fprintf(
+            tsvFILE,
+            "\t%u\t%u\t%u\n",
+            recST.numSNPUInt,
+            recST.numInsUInt,
+            recST.numDelUInt
+        ); /*2nd fprintf: print out stats*/
+
+        errUC = readStatRec(statFILE, &recST);
+    } /*Loop: Print out each record*/
+
+    fclose(statFILE);
+    free(idBuffCStr);
+    free(offAryUL);
+    free(hashAryUL);
+    free(slotAryUL);
+
+    if(errUC != 2)
+        return 16;
+
+    return 1;
+} /*statRecToTsv*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - blockST to read from inFILE (the block is made by readSamLine)
+\---------------------------------------------------------------------*/
+void initSamBlock(
+    struct samBlock *blockST, /*Block to initialize*/
+    FILE *inFILE              /*Sam file to read from*/
+) /*Sets up a samBlock structure to read inFILE*/
+{ /*initSamBlock*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-28 TOC: Sec-1 Sub-1: initSamBlock
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    blockST->buffCStr = 0;
+    blockST->lenBuffUL = 0;
+    blockST->startUL = 0;
+    blockST->endUL = 0;
+    blockST->eofBl = 0;
+    blockST->inFILE = inFILE;
+} /*initSamBlock*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Frees
+|    - The block in blockST (inFILE is not closed)
+\---------------------------------------------------------------------*/
+void freeSamBlock(
+    struct samBlock *blockST /*Block to free*/
+) /*Frees the block in a stack allocated samBlock structure*/
+{ /*freeSamBlock*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-29 TOC: Sec-1 Sub-1: freeSamBlock
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(blockST->buffCStr);
+    blockST->buffCStr = 0;
+    blockST->lenBuffUL = 0;
+    blockST->startUL = 0;
+    blockST->endUL = 0;
+} /*freeSamBlock*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Returns
+|    - 1 if succeeded (or samStruct already had its own copy)
+|    - 64 memory allocation error
+|  - Modifies
+|    - samEntryCStr in samStruct to have the line in lineCStr with a
+|      new line at the end. The pointers in samStruct are moved to the
+|      copy, so they stay valid after the next readSamLine call.
+| Note:
+|  - Used by callers that keep an entry while reading the next entry
+|    or that edit the line in place (trimSam)
+\---------------------------------------------------------------------*/
+uint8_t copySamEntry(
+    struct samEntry *samStruct /*Sam entry to copy out of its block*/
+) /*Copies a sam entry out of a samBlock into samEntryCStr*/
+{ /*copySamEntry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-30 TOC: copySamEntry
+    '    fun-30 sec-1: Variable declerations
+    '    fun-30 sec-2: Make sure samEntryCStr can hold the line
+    '    fun-30 sec-3: Copy the line & move the pointers to the copy
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-30 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char *lineCStr = samStruct->lineCStr;
+    char *tmpCStr = 0;
+    unsigned long lenLineUL = 0;
+    unsigned long lenBuffUL = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-30 Sec-2: Make sure samEntryCStr can hold the line
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(lineCStr == 0 || lineCStr == samStruct->samEntryCStr)
+        return 1; /*Already in samEntryCStr*/
+
+    lenLineUL = strlen(lineCStr);
+
+    if(samStruct->samEntryCStr == 0 ||
+       samStruct->lenBuffULng < lenLineUL + 2
+    ) { /*If the sam entry buffer is to small*/
+        lenBuffUL = samStruct->lenBuffULng;
+
+        if(lenBuffUL < 1400)
+            lenBuffUL = 1400;
+
+        while(lenBuffUL < lenLineUL + 2)
+            lenBuffUL <<= 1;
+
+        tmpCStr =
+            realloc(
+                samStruct->samEntryCStr,
+                sizeof(char) * (lenBuffUL + 1)
+            ); /*Resize the buffer*/
+
+        if(tmpCStr == 0)
+        { /*If memory allocation errory*/
+            printMemAlocErr(
+                "samFileStructs.c",
+                "copySamEntry",
+                30,
+                2133
+            ); /*Let user know of memory allocation failure*/
+            return 64;
+        } /*If memory allocation errory*/
+
+        samStruct->samEntryCStr = tmpCStr;
+        samStruct->lenBuffULng = lenBuffUL;
+    } /*If the sam entry buffer is to small*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-30 Sec-3: Copy the line & move the pointers to the copy
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    memcpy(samStruct->samEntryCStr, lineCStr, lenLineUL);
+    samStruct->samEntryCStr[lenLineUL] = '\n';
+    samStruct->samEntryCStr[lenLineUL + 1] = '\0';
+
+    if(samStruct->queryCStr != 0)
+        samStruct->queryCStr =
+            samStruct->samEntryCStr + (samStruct->queryCStr - lineCStr);
+
+    if(samStruct->refCStr != 0)
+        samStruct->refCStr =
+            samStruct->samEntryCStr + (samStruct->refCStr - lineCStr);
+
+    if(samStruct->cigarCStr != 0)
+        samStruct->cigarCStr =
+            samStruct->samEntryCStr + (samStruct->cigarCStr - lineCStr);
+
+    if(samStruct->seqCStr != 0)
+        samStruct->seqCStr =
+            samStruct->samEntryCStr + (samStruct->seqCStr - lineCStr);
+
+    if(samStruct->qCStr != 0)
+        samStruct->qCStr =
+            samStruct->samEntryCStr + (samStruct->qCStr - lineCStr);
+
+    samStruct->lineCStr = samStruct->samEntryCStr;
+    return 1;
+} /*copySamEntry*/
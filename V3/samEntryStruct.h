@@ -23,6 +23,9 @@
 
 #define Q_ADJUST 33 /*offest to get q-score of 0*/
 #define MAX_Q_SCORE 94 /*highest possible Q-score*/
+#define CIG_LEN_SHIFT 8  /*Packed cigar entry: length << CIG_LEN_SHIFT*/
+#define CIG_OP_MASK 0xFF /*Packed cigar entry: entry & CIG_OP_MASK*/
+#define SAM_BLOCK_LEN 65536 /*Bytes readSamLine reads at once*/
 
 /*---------------------------------------------------------------------\
 | Struct-1: samEntry
@@ -30,6 +33,8 @@
 typedef struct samEntry
 { /*samEntry*/
     char *samEntryCStr;/*Holds the c-string for the sam entry*/
+    char *lineCStr;    /*Line the pointers are in: samEntryCStr or a
+                         line in a samBlock (see readSamLine)*/
 
     char
         *queryCStr,    /*points to the query name in samEntryCStr*/
@@ -65,6 +70,10 @@ typedef struct samEntry
         seqQHistUInt[MAX_Q_SCORE],  /*Histogram of base Q-scores*/
         seqQAlnHistUInt[MAX_Q_SCORE]; /*Histogram of kept base Q-score*/
 
+    uint32_t
+        *cigAryUI,     /*Packed cigar entries (see samCigToAry)*/
+        lenCigUI,      /*Entries in cigAryUI; 0 if not packed yet*/
+        lenCigBuffUI;  /*Number of entries cigAryUI can hold*/
 
     uint64_t
         totalQScoreULng, /*Q-score of all bases added together*/
@@ -106,6 +115,58 @@ typedef struct readStat
         numInsUInt;        /*total number of insertions in sam entry*/
 }readStat;
 
+/*---------------------------------------------------------------------\
+| Struct-3: statRec
+| Use:
+|    - Holds the stats for a single read in a binary stats file
+|      (--stats.bin). Records are fixed width & are in the same order
+|      as the reads in the bins fastq file, so the read id is kept as
+|      a hash (hashReadId) instead of a string.
+\---------------------------------------------------------------------*/
+typedef struct statRec
+{ /*statRec*/
+    uint64_t idHashUL;     /*hashReadId hash of the read id*/
+
+    float
+       medianQFlt,     /*holds the median read Q-score*/
+       medianAligQFlt, /*holds the aligned read median Q-score*/
+       meanQFlt,       /*holds the mean read Q-score*/
+       meanAligQFlt;   /*holds mean aligned read Q-score (no low Q)*/
+
+    uint32_t
+        readLenUInt,       /*Holds the read length of sam entry*/
+        readAligLenUInt,   /*Aligned read length of sam entry*/
+        numMatchUInt,      /*Holds number of matches*/
+        numKeptMatchUInt,  /*Holds number matches with Q-score > min Q*/
+        numKeptSNPUInt,    /*number of kept mismatches in sam entry*/
+        numSNPUInt,        /*total number of mismatches in sam entry*/
+        numKeptDelUInt,    /*number of kept deletions in sam entry*/
+        numDelUInt,        /*total number of deletions in sam entry*/
+        numKeptInsUInt,    /*number of kept insertions in sam entry*/
+        numInsUInt;        /*total number of insertions in sam entry*/
+
+    uint8_t mapqUChar;
+    uint8_t padAryUC[7];   /*Keeps the record width fixed (72 bytes)*/
+}statRec;
+
+/*---------------------------------------------------------------------\
+| Struct-4: samBlock
+| Use:
+|    - Holds a block of a sam file for readSamLine. Lines are split in
+|      the block, so sam entries point into the block instead of being
+|      copied. A line is only copied when it crosses the end of the
+|      block (moved to the start before the next read).
+\---------------------------------------------------------------------*/
+typedef struct samBlock
+{ /*samBlock*/
+    char *buffCStr;          /*Block of the sam file*/
+    unsigned long lenBuffUL; /*Bytes buffCStr can hold (no '\0')*/
+    unsigned long startUL;   /*Start of the next line in buffCStr*/
+    unsigned long endUL;     /*Number of bytes read into buffCStr*/
+    char eofBl;              /*1: Read all of inFILE*/
+    FILE *inFILE;            /*Sam file to read the blocks from*/
+}samBlock;
+
 
 /*######################################################################
 # Output: Modifies: Sets every variable but samEntryCStr to 0
@@ -176,6 +237,26 @@ void processSamEntry(
 ); /*Sets Q-score, cigar, & sequence pionters in samEntry. Also finds
     the mapping quality, sam flag, & sequence length*/
 
+/*######################################################################
+# Output:
+#    Modifies: blockST to read from inFILE (no memory is allocated)
+######################################################################*/
+void initSamBlock(
+    struct samBlock *blockST, /*Block to initialize*/
+    FILE *inFILE              /*Sam file to read from*/
+); /*Sets up a samBlock structure to read inFILE*/
+
+/*######################################################################
+# Output:
+#    Frees: The block in blockST (does not close inFILE)
+# Note:
+#    - Any samEntry that still points into the block (lineCStr is not
+#      samEntryCStr) is invalid after this call
+######################################################################*/
+void freeSamBlock(
+    struct samBlock *blockST /*Block to free*/
+); /*Frees the block in a stack allocated samBlock structure*/
+
 /*######################################################################
 # Output:
 #    Returns:
@@ -183,46 +264,28 @@ void processSamEntry(
 #        - 2 if end of file
 #        - 64 if memory allocation error
 #    Modifies: All pointers in samStruct & the variables for read Lenth
+# Note:
+#    - samStruct->lineCStr points into blockST & the new line is
+#      replaced with '\0'. The line is only valid till the next call
+#      with blockST or freeSamBlock. Use copySamEntry to keep it.
 ######################################################################*/
 uint8_t readSamLine(
     struct samEntry *samStruct,
-    FILE *inFILE
+    struct samBlock *blockST
 ); /*Reads in sam entry & sets pointers in samStruct*/
 
 /*######################################################################
 # Output:
-#     Returns:
-#        - 1 if succeded
-#        - 2 if end of file
-#        - 4 if end of file, but not a complete sam entry
+#    Returns:
+#        - 1 if succeded (or samStruct already had its own copy)
 #        - 64 if memory allocation error
-#     Modifies: samStruct->samEntryCStr, samStruct->lenBuffULng, &
-#               samStruct->unTrimedLenULng
-# Note:
-#    - This requires that samStruct->samEntryCStr has read in at least
-#      part of the sam entry
-######################################################################*/
-uint8_t findSamCig(
-    FILE *inFILE,               /*File to search for cigar in*/
-    struct samEntry *samStruct
-); /*Finds the cigar in same entry (uses fgets if needs more buffer) &
-    also finds the number of bases in query from cigar*/
-
-/*######################################################################
-# Output:
-#    Returns: pointer to unsigned char with fgets return value
-#        - 0 for eof or memory allocation error (no data read in)
-#        - pointer to start of buffer with characters read in
-#    Sets: the second to last entry (samStruct->lenBuffULng - 2) in
-#          samStruct->samEntryCStr to '\0'. This allows the user to 
-#          check if fgets read in the entire line.
-#          This position will be '\0' or '\n' if entire line read in.
+#    Modifies:
+#        - samEntryCStr in samStruct to have the line in lineCStr (ends
+#          in a new line) & the pointers in samStruct to point to it
 ######################################################################*/
-char * readNextPartOfLine(
-    FILE *inFILE,                   /*File to read from*/
-    struct samEntry *samStruct,
-    uint64_t buffChangeULng  /*How much to increase buffer by*/
-); /*Reads in next part of line when fgets did not get a full line*/
+uint8_t copySamEntry(
+    struct samEntry *samStruct /*Sam entry to copy out of its block*/
+); /*Copies a sam entry out of a samBlock into samEntryCStr*/
 
 /*######################################################################
 # Output:
@@ -337,6 +400,117 @@ unsigned char readInConFa(
     struct samEntry *refStruct /*Sam struct to hold consensus*/
 ); /*Reads in reference sequence in fasta file*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - cigAryUI in samST to have one packed entry per cigar entry
+|      (length << CIG_LEN_SHIFT | operation). A number at the end of
+|      the cigar with no operation is stored with the operation '\t'
+|    - lenCigUI in samST to have the number of entries in cigAryUI
+|  - Returns
+|    - 1 if succeeded (or the cigar was already packed)
+|    - 64 memory allocation error
+| Note:
+|  - The cigar is only read on the first call after processSamEntry or
+|    blankSamEntry. Later calls reuse cigAryUI.
+|  - Entries must be under 2^24 bases
+\---------------------------------------------------------------------*/
+uint8_t samCigToAry(
+    struct samEntry *samST /*Sam entry with cigar to pack*/
+); /*Packs the cigar in a sam entry into an array*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - cigCStr to have the text cigar in cigAryUI (no '\0' at end)
+|  - Returns
+|    - Pointer to the character after the last cigar entry in cigCStr
+| Note:
+|  - cigCStr can be samST->cigarCStr when entries have been removed
+|    from cigAryUI, since the new cigar is never longer than the old
+\---------------------------------------------------------------------*/
+char * cigAryToCStr(
+    struct samEntry *samST, /*Sam entry with packed cigar to print*/
+    char *cigCStr           /*Buffer to write the cigar to*/
+); /*Writes a packed cigar as text*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Returns
+|    - FNV-1a hash of idCStr (stops at the first white space)
+\---------------------------------------------------------------------*/
+uint64_t hashReadId(
+    char *idCStr /*Read id to hash (no '@' or '>')*/
+); /*Hashes a read id for the binary stats records*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - recST to have the stats & read id hash in samST
+\---------------------------------------------------------------------*/
+void samToStatRec(
+    struct samEntry *samST, /*Sam entry with stats to copy*/
+    struct statRec *recST   /*Record to copy stats to*/
+); /*Copies the stats in a samEntry struct to a statRec struct*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Prints
+|    - The stats in samST as a binary record (statRec) to outFILE
+\---------------------------------------------------------------------*/
+void printStatRec(
+    struct samEntry *samST, /*Sam entry to print stats for*/
+    FILE *outFILE           /*Binary stats file to print to*/
+); /*Prints the stats in a sam entry as a binary stats record*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Modifies
+|    - recST to have the next record in statFILE
+|  - Returns
+|    - 1 if read in a record
+|    - 2 if at the end of the file
+|    - 8 if statFILE is 0
+|    - 16 if the file ended part way through a record
+\---------------------------------------------------------------------*/
+uint8_t readStatRec(
+    FILE *statFILE,        /*Binary stats file to read from*/
+    struct statRec *recST  /*Will hold the record*/
+); /*Reads one record from a binary stats file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Prints
+|    - Each line in a scoreReads tsv file (tsvFILE) to recFILE as a
+|      binary stats record
+|  - Returns
+|    - 1 if converted every line
+|    - 16 if a line could not be read
+\---------------------------------------------------------------------*/
+uint8_t statTsvToRec(
+    FILE *tsvFILE, /*scoreReads tsv file (has a header)*/
+    FILE *recFILE  /*Binary stats file to print records to*/
+); /*Converts a tsv stats file to a binary stats file*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|  - Prints
+|    - The records in statPathCStr to tsvFILE as a tsv with a header.
+|      Read ids are found by hashing the read ids in fqPathCStr; ids
+|      with no read in the fastq file are printed as '*'
+|  - Returns
+|    - 1 if printed the tsv
+|    - 2 if could not open the stats or fastq file
+|    - 16 if the stats file ended part way through a record
+|    - 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+uint8_t statRecToTsv(
+    char *statPathCStr, /*Binary stats file to export*/
+    char *fqPathCStr,   /*Fastq file with the reads in statPathCStr*/
+    char *refIdCStr,    /*Reference id to print for each read*/
+    FILE *tsvFILE       /*File to print the tsv to*/
+); /*Exports a binary stats file as a tsv*/
+
 #endif
 
 /*
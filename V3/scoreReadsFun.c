@@ -67,6 +67,8 @@ uint8_t scoreReads(
         *refStruct =  malloc(sizeof(struct samEntry)),
         *oldSamStruct = malloc(sizeof(struct samEntry));
 
+    struct samBlock blockST; /*Block the sam lines are read into*/
+
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-1 Sec-2: Initalize the samEntry structers & read first line
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
@@ -74,8 +76,9 @@ uint8_t scoreReads(
     initSamEntry(samStruct);    /*Blank variables*/
     initSamEntry(oldSamStruct); /*Blank variables*/
     initSamEntry(refStruct); /*Blank variables*/
+    initSamBlock(&blockST, samFILE);
 
-    keepAlnUChar = readSamLine(samStruct, samFILE);
+    keepAlnUChar = readSamLine(samStruct, &blockST);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
     # Fun-1 Sec-3: Read in reference from fastq file if provided
@@ -94,6 +97,7 @@ uint8_t scoreReads(
             break;
          default:                           /*Issue with reference*/
             freeHeapSamEntry(&refStruct);
+            freeSamBlock(&blockST);
             return errUChar; /*2 = under min quality, 4 = invalid file*/
     } /*check if reference was provided*/
 
@@ -103,7 +107,7 @@ uint8_t scoreReads(
 
     while(keepAlnUChar & 1)
     { /*While I have lines to read in the sam file*/
-         if(
+         errUChar =
              setUpScoreAln(
                  &samStruct,
                  &oldSamStruct,
@@ -111,16 +115,24 @@ uint8_t scoreReads(
                  minStats,
                  useRefForDelBool, /*Use reference for only deletions*/
                  &refQBool        /*telling if ref has Q-score*/
-            ) & 1)
-                printSamStats(samStruct, &printHeadChar, outFILE);
-                /*Logic is >> 2 removes first two flags*/
+            );
+
+         if(errUChar & 64)
+         { /*If could not copy the line out of the block*/
+             keepAlnUChar = 64;
+             break;
+         } /*If could not copy the line out of the block*/
+
+         if(errUChar & 1)
+             printSamStats(samStruct, &printHeadChar, outFILE);
 
          blankSamEntry(samStruct);
-         keepAlnUChar = readSamLine(samStruct, samFILE);
+         keepAlnUChar = readSamLine(samStruct, &blockST);
     } /*While I have lines to read in the sam file*/
 
     freeHeapSamEntry(&samStruct);
     freeHeapSamEntry(&oldSamStruct);
+    freeSamBlock(&blockST);
 
     if(refStruct != 0)
         freeHeapSamEntry(&refStruct);
@@ -140,6 +152,7 @@ uint8_t scoreReads(
 #        -2: If is a header
 #        -4: If alignment does not meer the min stats
 #        -8: If is not mapped to any reference
+#        -64: If could not copy a new read out of the samBlock
 ######################################################################*/
 uint8_t setUpScoreAln(
     struct samEntry **samStruct,   /*will have index of samLineCStr*/
@@ -163,8 +176,10 @@ uint8_t setUpScoreAln(
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     struct samEntry *swapStruct = 0;
+    uint32_t *tmpCigAryUI = 0;  /*For swapping the packed cigars*/
+    uint32_t tmpLenCigUI = 0;
 
-    if(*(*samStruct)->samEntryCStr == '@')
+    if(*(*samStruct)->lineCStr == '@')
         return 2; /*This is a header line*/
 
     if(*(*samStruct)->refCStr == '*')
@@ -176,6 +191,11 @@ uint8_t setUpScoreAln(
     { /*If starting a new sequence*/
         findQScores(*samStruct);
 
+        /*Later entries for this read use its sequence, which would be
+          written over by the next readSamLine call*/
+        if(copySamEntry(*samStruct) & 64)
+            return 64;
+
         /*Swap pointers (this avoids doing a deep copy*/
         swapStruct = *samStruct;
         *samStruct = *oldSamStruct;
@@ -189,6 +209,18 @@ uint8_t setUpScoreAln(
         (*samStruct)->queryCStr = (*oldSamStruct)->queryCStr;
         (*samStruct)->posOnRefUInt = (*oldSamStruct)->posOnRefUInt;
 
+        /*The packed cigar goes with the cigar, so swap it back*/
+        tmpCigAryUI = (*samStruct)->cigAryUI;
+        tmpLenCigUI = (*samStruct)->lenCigBuffUI;
+
+        (*samStruct)->cigAryUI = (*oldSamStruct)->cigAryUI;
+        (*samStruct)->lenCigUI = (*oldSamStruct)->lenCigUI;
+        (*samStruct)->lenCigBuffUI = (*oldSamStruct)->lenCigBuffUI;
+
+        (*oldSamStruct)->cigAryUI = tmpCigAryUI;
+        (*oldSamStruct)->lenCigBuffUI = tmpLenCigUI;
+        (*oldSamStruct)->lenCigUI = 0;
+
         /*Not setting samEntryCStr, because that would result in memory
           loss or require a deep copy. Instead working with query, ref,
           cigar, sequence (set in cpSamEntry), & q-score (set in 
@@ -283,9 +315,7 @@ void scoreAln(
 
     char
         *refStartCStr = 0,
-        *refQCStr = 0,
-        *tmpCigCStr = 0,                  /*Holds errpr type*/
-        *cigarCStr = samStruct->cigarCStr;
+        *refQCStr = 0;
 
     int32_t
         intOne = 1,  /*for checkInss with deletions*/
@@ -296,6 +326,10 @@ void scoreAln(
     # Fun-3 Sec-2: Check if reading backwards & if have q-score entry
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
+    /*The cigar is only read once, even if trimSamEntry used it*/
+    if(samCigToAry(samStruct) & 64)
+        return; /*Memory error, stats are blank, so read is discarded*/
+
     if(refStruct != 0)
     { /*If have a reference sequence*/
         /*recored starting sequence positions so can reset at end*/
@@ -351,24 +385,12 @@ void scoreAln(
     # Fun-3 Sec-3: Process each cigar entry
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    while(*cigarCStr != '\t')
+    for(uint32_t uiCig = 0; uiCig < samStruct->lenCigUI; ++uiCig)
     { /*loop through all entries in the Cigar*/
+        /*A reverse complement read would loop from lenCigUI - 1 to 0*/
+        cigEntryUInt = samStruct->cigAryUI[uiCig] >> CIG_LEN_SHIFT;
 
-        /*switch(reverseBool)
-        {*/ /*Switch: check if reading cigar backwards or forwards*/
-          /*  case 0:*/
-                readCigEntry(&cigarCStr, &cigEntryUInt);
-                tmpCigCStr = cigarCStr;
-                ++cigarCStr; /*move to the next cigar eqx entry*/
-                /*break;*/
-            /*case 1:*/                   /*Is reverse complement*/
-                /*tmpCigCStr = cigarCStr;
-                readReverseCigEntry(&cigarCStr, &cigEntryUInt);*/
-                /*readReveres puts on next entry*/
-                /*break;
-        }*/ /*Switch: check if reading cigar backwards or forwards*/
-
-        switch(*tmpCigCStr)
+        switch(samStruct->cigAryUI[uiCig] & CIG_OP_MASK)
         { /*switch, check what kind of cigar entry*/
             case '=':
                 checkMatches(
@@ -529,62 +551,63 @@ void checkSNPs(
     # Fun-4 Sec-1 Sub-1 TOC: checkMismatches
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    uint8_t keepBool = 0; /*Keep or ignore mismatch*/
-    int32_t
-        refQInt = 0,
-        tmpQInt = 0; /*Want negatives*/
+    uint32_t lenUI = *cigEntryUInt; /*Number of SNPs*/
+    uint32_t keptUI = 0;            /*Number of SNPs to keep*/
+    char *refQCStr = 0;             /*Reference Q-scores to check*/
 
+    /*A SNP is kept if its Q-score is over minQChar (or there is no
+      Q-score entry). When the reference is used, the SNP is only kept
+      if the reference Q-score + 1 is under minQChar, so a low quality
+      reference base will not hide a SNP*/
+    if(refStruct != 0 && *refQBool != 0 && *useRefBool != 0)
+        refQCStr = refStruct->qCStr;
 
-    for(uint32_t uIntBase = 0; uIntBase < *cigEntryUInt; uIntBase++)
-    { /*Loop through all bases that are mismatches*/
-        tmpQInt = (*samStruct->qCStr-Q_ADJUST) & (!*qLineBool+MAX_UINT);
+    /*Get the stats & count the SNPs to keep*/
+    if(*qLineBool != 0)
+    { /*If have a Q-score entry*/
+        samStruct->totalAlnQScoreULng +=      /*For aligned mean*/
+            qRunStats(
+                samStruct->qCStr,
+                refQCStr,
+                lenUI,
+                minStats->minQChar,
+                -256,                   /*No minimum reference Q*/
+                minStats->minQChar - 1, /*Reference Q + 1 < minQChar*/
+                samStruct->seqQAlnHistUInt, /*aligned median*/
+                &keptUI
+            );
+    } /*If have a Q-score entry*/
+
+    else
+    { /*Else there is no Q-score entry*/
+        keptUI =
+            qRunCntKeep(
+                0,
+                refQCStr,
+                lenUI,
+                minStats->minQChar,
+                -256,                   /*No minimum reference Q*/
+                minStats->minQChar - 1  /*Reference Q + 1 < minQChar*/
+            );
+
+        samStruct->seqQAlnHistUInt[0] += lenUI; /*No Q-score is 0*/
+    } /*Else there is no Q-score entry*/
+
+    samStruct->numKeptSNPUInt += keptUI;
+    samStruct->numSNPUInt += lenUI;
+
+    samStruct->readAligLenUInt += lenUI; /*incurment aligned length*/
 
-        /*Here to avlid an if statement*/
-        keepBool =
-          ((uint32_t)(minStats->minQChar -tmpQInt) >> 31) | !*qLineBool;
-            /*minQChar - tmpQInt: is negative if tmpQInt is > minQChar
-              (uint32_t) converts minQChar - tmpQInt from to unsigned
-              >> 31 grabs the old negative flag so is 1 when
-                   minQChar - tmpQInt is negative
-              | !qlineBoolBool sets to one if have no Q-score entry*/
+    if(refStruct != 0)
+    { /*If have a reference, move past the SNPs*/
+        refStruct->qCStr += *refQBool * lenUI;
+        refStruct->seqCStr += lenUI;
+    } /*If have a reference, move past the SNPs*/
 
-        if(refStruct != 0)
-        { /*switch: Check if reference was provided*/
-            refQInt = (*refStruct->qCStr - Q_ADJUST + 1);
-                /*-1 = minQChar + 1, note the next line (keepBool &=)
-                    handles the no ref q-score case*/
-
-            keepBool &=
-                ((
-                     ((uint32_t) (refQInt - minStats->minQChar) >> 31) |
-                     !*refQBool
-                 ) | /*Check if a valid Q-score or have Q-score entry*/
-                 !*useRefBool /*Check if even using the refrence*/
-                );/*Sets keepBool to 1 if not using ref*/
-             /*(minQChar - refQInt): is negative if minQChar > refQInt
-               uint32_t: Converts to unisgned, so flag not negative
-               >> 31: only 1 if refQInt > minQChar (grabs negative flag)
-               | !refQBool: Sets to one if their was no q-score line
-               !useRefBool: Sets to one if not using the reference
-               keepBool &=: Sets keep bool to zero if previous calcs
-                            are 0 (reference is high quality and used)*/
-
-            refStruct->qCStr += *refQBool;
-            ++refStruct->seqCStr;
-        } /*switch: Check if reference was provided*/
-
-        ++samStruct->numSNPUInt; /*! flips bit*/
-        samStruct->numKeptSNPUInt += keepBool;
-
-        /*Get the stats*/
-        ++(samStruct->seqQAlnHistUInt[tmpQInt]);    /*aligned median*/
-        samStruct->totalAlnQScoreULng += tmpQInt; /*For aligned mean*/
-        ++(samStruct->readAligLenUInt);     /*incurment aligned length*/
-
-        /*Move to the next base in the sequence*/
-        switch(*qLineBool){case 1: samStruct->qCStr += *incInt;}
-        samStruct->seqCStr += *incInt;     /*move to next/previous base*/
-    } /*Loop through all bases that are mismatches*/
+    /*Move to the next base in the sequence*/
+    switch(*qLineBool)
+        {case 1: samStruct->qCStr += *incInt * (int32_t) lenUI;}
+    samStruct->seqCStr += *incInt * (int32_t) lenUI;
 
     return;
 } /*checkSNPs*/
@@ -613,60 +636,61 @@ void checkMatches(
     # Fun-5 Sec-1 Sub-1 TOC: checkMatches
     <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-    uint8_t keepBool = 0; /*Keep or ignore mismatch*/
+    uint32_t lenUI = *cigEntryUInt; /*Number of matches*/
+    uint32_t keptUI = 0;            /*Number of matches to keep*/
+    char *refQCStr = 0;             /*Reference Q-scores to check*/
 
-    int32_t
-        refQInt = 0,
-        tmpQInt = 0; /*Want negatives*/
+    /*A match is kept if its Q-score is over minQChar (or there is no
+      Q-score entry). When the reference is used, the reference
+      Q-score - 1 must also be over minQChar*/
+    if(refStruct != 0 && *refQBool != 0 && *useRefBool != 0)
+        refQCStr = refStruct->qCStr;
 
-    for(uint32_t uIntBase = 0; uIntBase < *cigEntryUInt; ++uIntBase)
-    { /*Loop through all bases that are matches*/
-        tmpQInt =
-            (*samStruct->qCStr - Q_ADJUST) & (!*qLineBool+MAX_UINT);
+    /*Get the stats & count the matches to keep*/
+    if(*qLineBool != 0)
+    { /*If have a Q-score entry*/
+        samStruct->totalAlnQScoreULng +=      /*For aligned mean*/
+            qRunStats(
+                samStruct->qCStr,
+                refQCStr,
+                lenUI,
+                minStats->minQChar,
+                minStats->minQChar + 1, /*Reference Q - 1 > minQChar*/
+                256,                    /*No maximum reference Q*/
+                samStruct->seqQAlnHistUInt, /*aligned median*/
+                &keptUI
+            );
+    } /*If have a Q-score entry*/
+
+    else
+    { /*Else there is no Q-score entry*/
+        keptUI =
+            qRunCntKeep(
+                0,
+                refQCStr,
+                lenUI,
+                minStats->minQChar,
+                minStats->minQChar + 1, /*Reference Q - 1 > minQChar*/
+                256                     /*No maximum reference Q*/
+            );
+
+        samStruct->seqQAlnHistUInt[0] += lenUI; /*No Q-score is 0*/
+    } /*Else there is no Q-score entry*/
+
+    samStruct->numKeptMatchUInt += keptUI;
+    samStruct->numMatchUInt += lenUI; /*Total matches*/
+
+    samStruct->readAligLenUInt += lenUI; /*incurment aligned length*/
 
-        keepBool =    /*Find if keeping the match*/
-          ((uint32_t)(minStats->minQChar -tmpQInt) >> 31) | !*qLineBool;
-            /*minQChar - tmpQInt: is negative if tmpQInt is > minQChar
-              (uint32_t) converts minQChar - tmpQInt from to unsigned
-              >> 31 grabs the old negative flag so is 1 when
-                   minQChar - tmpQInt is negative
-              | !qlineBoolBool sets to one if have no Q-score entry*/
-
-        if(refStruct != 0)
-        { /*switch: Check if reference was provided*/
-            refQInt = (*refStruct->qCStr - Q_ADJUST - 1);
-                /*-1 = minQChar + 1, note the next line (keepBool &=)
-                    handles the no ref q-score case*/
-            keepBool &=
-                ((
-                     ((uint32_t) (minStats->minQChar - refQInt) >> 31) |
-                     !*refQBool
-                 ) | /*Check if a valid Q-score or have Q-score entry*/
-                 !*useRefBool /*Check if even using the refrence*/
-                );/*Sets keepBool to 1 if not using ref*/
-             /*(minQChar - refQInt): is negative if refQInt > minQChar
-               uint32_t: Converts to unisgned, so flag not negative
-               >> 31: only 1 if refQInt > minQChar (grabs negative flag)
-               | !refQBool: Sets to one if their was no q-score line
-               !useRefBool: Sets to one if not using the reference
-               keepBool &=: Sets keep bool to zero if previous calcs
-                            are 0 (reference is low quality and used)*/
-
-            refStruct->qCStr += *refQBool;
-            ++refStruct->seqCStr;
-        } /*switch: Check if reference was provided*/
-
-        ++samStruct->numMatchUInt; /*Total matches*/
-        samStruct->numKeptMatchUInt += keepBool;
-
-        /*Get the stats*/
-        ++(samStruct->seqQAlnHistUInt[tmpQInt]);    /*aligned median*/
-        samStruct->totalAlnQScoreULng += tmpQInt; /*For aligned mean*/
-        ++(samStruct->readAligLenUInt);     /*incurment aligned length*/
+    if(refStruct != 0)
+    { /*If have a reference, move past the matches*/
+        refStruct->qCStr += *refQBool * lenUI;
+        refStruct->seqCStr += lenUI;
+    } /*If have a reference, move past the matches*/
 
-        switch(*qLineBool){case 1: samStruct->qCStr += *incInt;}
-        samStruct->seqCStr += *incInt;     /*move to next/previous base*/
-    } /*Loop through all bases that are mismatches*/
+    switch(*qLineBool)
+        {case 1: samStruct->qCStr += *incInt * (int32_t) lenUI;}
+    samStruct->seqCStr += *incInt * (int32_t) lenUI;
 
     return;
 } /*checkMatches*/
@@ -719,6 +743,31 @@ void checkInss(
     # Fun-6 Sec-2 Sub-1: Check if Q-scores eliminate insertion
     *******************************************************************/
 
+    if(*useRefForDelBool != 0)
+    { /*If looking at deletions, only the count changes*/
+        samStruct->numDelUInt += *cigEntryUInt;
+
+        switch(*qLineBool)
+        {case 1: samStruct->qCStr += *incInt * (int32_t) *cigEntryUInt;}
+
+        samStruct->seqCStr += *incInt * (int32_t) *cigEntryUInt;
+        return;
+    } /*If looking at deletions, only the count changes*/
+
+    /*Every insertion is added to the stats, even if it is discarded.
+      The Q-score total is added in the loop, since it only adds the
+      first bit of each Q-score (tmpQInt & !*useRefForDelBool)*/
+    if(*qLineBool != 0)
+        qRunHist(
+            samStruct->qCStr,
+            *cigEntryUInt,
+            samStruct->seqQHistUInt
+        );
+    else
+        samStruct->seqQHistUInt[0] += *cigEntryUInt; /*No Q-score is 0*/
+
+    samStruct->readAligLenUInt += *cigEntryUInt;
+
     for(uint32_t intIndel = 0; intIndel < *cigEntryUInt; intIndel++)
     { /*Loop through all insertions*/
         tmpQInt = (*samStruct->qCStr-Q_ADJUST) & (!*qLineBool+MAX_UINT);
@@ -731,40 +780,19 @@ void checkInss(
                    minQChar - tmpQInt is negative
               | !qlineBoolBool sets to one if have no Q-score entry*/
 
-        /*adds 0 when useRefForDelBool = 1*/
+        samStruct->totalAlnQScoreULng += tmpQInt & !*useRefForDelBool;
 
-        switch(*useRefForDelBool)
-        { /*Switch: check if checing for deletions*/
-            case 0: /*Looking at insertions*/
-                samStruct->readAligLenUInt += 1 & !(*useRefForDelBool);
-
-                samStruct->seqQHistUInt[tmpQInt] +=
-                    1 & !*useRefForDelBool;
-                samStruct->totalAlnQScoreULng +=
-                    tmpQInt & !*useRefForDelBool;
-
-                switch(keepBool)
-                { /*switch: decided if base is good quality*/
-                    case 0:
-                    { /*case: low base quality*/
-                        ++samStruct->numInsUInt;
-                        switch(*qLineBool)
-                            {case 1: samStruct->qCStr += *incInt;}
-                        samStruct->seqCStr += *incInt;
-
-                        continue; /*Restart at top of loop*/
-                    } /*case: low base quality*/
-                } /*switch: decided if base is good quality*/
-
-                break;
-            /*Case 0:*/
-
-            case 1: /*Looking at deletions*/
-                ++samStruct->numDelUInt;
+        switch(keepBool)
+        { /*switch: decided if base is good quality*/
+            case 0:
+            { /*case: low base quality*/
+                ++samStruct->numInsUInt;
                 switch(*qLineBool){case 1: samStruct->qCStr += *incInt;}
                 samStruct->seqCStr += *incInt;
-                continue;
-        } /*Switch: check if checing for deletions*/
+
+                continue; /*Restart at top of loop*/
+            } /*case: low base quality*/
+        } /*switch: decided if base is good quality*/
 
         /***************************************************************
         # Fun-6 Sec-2 Sub-2: Find the homopolymer length
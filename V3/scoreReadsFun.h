@@ -48,6 +48,7 @@ uint8_t scoreReads(
 #        -2: If is a header
 #        -4: If alignment does not meer the min stats
 #        -8: If is not mapped to any reference
+#        -64: If could not copy a new read out of the samBlock
 ######################################################################*/
 uint8_t setUpScoreAln(
     struct samEntry **samStruct,   /*will have index of samLineCStr*/
@@ -0,0 +1,368 @@
+/*######################################################################
+# Use:
+#   o Holds functions to read fasta or fastq entries into a seqStruct
+#     & to reverse complement a seqStruct
+######################################################################*/
+
+#include "sequenceFun.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF TOC: Start of Functions
+'   o fun-1 initSeqST:
+'     - Sets all variables in a seqStruct structure to defaults
+'   o fun-2 freeSeqST:
+'     - Frees the buffers in a seqStruct structure
+'   o fun-3 readSeqLine:
+'     - Adds the next line in a file (no new line) to a buffer
+'   o fun-4 readSeqST:
+'     - Reads the next fasta or fastq entry into a seqStruct
+'   o fun-5 revCompSeqST:
+'     - Reverse complements the sequence & reverses the q-score entry
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o All variables in seqST to be 0 (does not free)
+\---------------------------------------------------------------------*/
+void initSeqST(
+    struct seqStruct *seqST /*Structure to initialize*/
+) /*Sets all variables in a seqStruct structure to defaults*/
+{ /*initSeqST*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: Sec-1 Sub-1: initSeqST
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    seqST->idCStr = 0;
+    seqST->lenIdUL = 0;
+    seqST->lenIdBuffUL = 0;
+
+    seqST->seqCStr = 0;
+    seqST->lenSeqUL = 0;
+    seqST->lenSeqBuffUL = 0;
+
+    seqST->qCStr = 0;
+    seqST->lenQBuffUL = 0;
+    return;
+} /*initSeqST*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Frees: The id, sequence, & q-score buffers in seqST & then
+|      initializes seqST
+\---------------------------------------------------------------------*/
+void freeSeqST(
+    struct seqStruct *seqST /*Structure to free*/
+) /*Frees the buffers in a seqStruct structure*/
+{ /*freeSeqST*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: Sec-1 Sub-1: freeSeqST
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(seqST->idCStr);
+    free(seqST->seqCStr);
+    free(seqST->qCStr);
+    initSeqST(seqST);
+    return;
+} /*freeSeqST*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Length of buffCStr after the line was added (no new line)
+|        o -1 if at the end of the file
+|        o -2 for memory allocation errors
+|    - Modifies:
+|        o buffCStr to have the line at startUL (resized if to small)
+\---------------------------------------------------------------------*/
+long readSeqLine(
+    FILE *inFILE,            /*File to read the line from*/
+    char **buffCStr,         /*Buffer to add the line to*/
+    unsigned long *lenBuffUL,/*Size of buffCStr*/
+    unsigned long startUL    /*Where to add the line in buffCStr*/
+) /*Adds the next line in a file (no new line) to a buffer*/
+{ /*readSeqLine*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: Sec-1 Sub-1: readSeqLine
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long endUL = startUL;
+    unsigned long newLenUL = 0;
+    char *tmpCStr = 0;
+
+    while(1)
+    { /*Loop: Read in the line*/
+        if(*buffCStr == 0 || endUL + 2 >= *lenBuffUL)
+        { /*If need a larger buffer*/
+            newLenUL = *lenBuffUL < 512 ? 1024 : *lenBuffUL << 1;
+            tmpCStr = realloc(*buffCStr, sizeof(char) * newLenUL);
+
+            if(tmpCStr == 0)
+                return -2;
+
+            *buffCStr = tmpCStr;
+            *lenBuffUL = newLenUL;
+        } /*If need a larger buffer*/
+
+        if(fgets(*buffCStr + endUL, *lenBuffUL - endUL, inFILE) == 0)
+        { /*If at the end of the file*/
+            (*buffCStr)[endUL] = '\0';
+
+            if(endUL == startUL)
+                return -1;
+
+            return endUL;
+        } /*If at the end of the file*/
+
+        while((*buffCStr)[endUL] != '\0')
+            ++endUL;
+
+        if((*buffCStr)[endUL - 1] == '\n')
+        { /*If read in the full line*/
+            --endUL;
+
+            while(endUL > startUL && (*buffCStr)[endUL - 1] == '\r')
+                --endUL;
+
+            (*buffCStr)[endUL] = '\0';
+            return endUL;
+        } /*If read in the full line*/
+    } /*Loop: Read in the line*/
+} /*readSeqLine*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if read in a sequence
+|        o 2 if at the end of the file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o seqST to have the next entry. Only the first word of the
+|          header is kept as the id
+\---------------------------------------------------------------------*/
+uint8_t readSeqST(
+    FILE *inFILE,           /*Fasta or fastq file to read*/
+    struct seqStruct *seqST /*Gets the next entry*/
+) /*Reads the next fasta or fastq entry into a seqStruct*/
+{ /*readSeqST*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: readSeqST
+    '   fun-4 sec-1: Variable declerations
+    '   fun-4 sec-2: Read in the header
+    '   fun-4 sec-3: Read in the sequence
+    '   fun-4 sec-4: Read in the q-score entry (fastq only)
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    long lenL = 0;
+    int nextCharI = 0;
+    char fastqBl = 0;
+    char *tmpCStr = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Read in the header
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    do { /*Loop: Find the next header*/
+        lenL =
+           readSeqLine(inFILE,&seqST->idCStr,&seqST->lenIdBuffUL,0);
+
+        if(lenL == -1)
+            return 2;
+
+        if(lenL < -1)
+            return 64;
+    } while(*seqST->idCStr != '>' && *seqST->idCStr != '@');
+      /*Loop: Find the next header*/
+
+    fastqBl = (*seqST->idCStr == '@');
+
+    /*Remove the '>' or '@' & anything after the first white space*/
+    tmpCStr = seqST->idCStr;
+    seqST->lenIdUL = 0;
+
+    while(tmpCStr[seqST->lenIdUL + 1] > 32)
+    { /*While have an id to copy*/
+        tmpCStr[seqST->lenIdUL] = tmpCStr[seqST->lenIdUL + 1];
+        ++seqST->lenIdUL;
+    } /*While have an id to copy*/
+
+    tmpCStr[seqST->lenIdUL] = '\0';
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-3: Read in the sequence
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    seqST->lenSeqUL = 0;
+
+    if(fastqBl)
+    { /*If is a fastq file (sequence is on one line)*/
+        lenL =
+            readSeqLine(inFILE,&seqST->seqCStr,&seqST->lenSeqBuffUL,0);
+
+        if(lenL < -1)
+            return 64;
+
+        if(lenL > 0)
+            seqST->lenSeqUL = lenL;
+    } /*If is a fastq file (sequence is on one line)*/
+
+    else
+    { /*Else is a fasta file (sequence can be on multiple lines)*/
+        while(1)
+        { /*Loop: Read in the sequence lines*/
+            nextCharI = getc(inFILE);
+
+            if(nextCharI == EOF)
+                break;
+
+            ungetc(nextCharI, inFILE);
+
+            if(nextCharI == '>')
+                break; /*Start of the next sequence*/
+
+            lenL =
+                readSeqLine(
+                    inFILE,
+                    &seqST->seqCStr,
+                    &seqST->lenSeqBuffUL,
+                    seqST->lenSeqUL
+                ); /*Add the next line to the sequence*/
+
+            if(lenL < -1)
+                return 64;
+
+            if(lenL < 0)
+                break;
+
+            seqST->lenSeqUL = lenL;
+        } /*Loop: Read in the sequence lines*/
+    } /*Else is a fasta file (sequence can be on multiple lines)*/
+
+    if(seqST->seqCStr == 0)
+    { /*If the entry had no sequence*/
+        seqST->seqCStr = malloc(sizeof(char) * 16);
+
+        if(seqST->seqCStr == 0)
+            return 64;
+
+        seqST->lenSeqBuffUL = 16;
+    } /*If the entry had no sequence*/
+
+    seqST->seqCStr[seqST->lenSeqUL] = '\0';
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-4: Read in the q-score entry (fastq only)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    lenL = 0;
+
+    if(fastqBl)
+    { /*If need to read in the q-score entry*/
+        /*The + line*/
+        lenL = readSeqLine(inFILE, &seqST->qCStr, &seqST->lenQBuffUL,0);
+
+        if(lenL >= 0)
+            lenL =
+                readSeqLine(
+                    inFILE,
+                    &seqST->qCStr,
+                    &seqST->lenQBuffUL,
+                    0
+                ); /*Read in the q-score entry*/
+
+        if(lenL < -1)
+            return 64;
+    } /*If need to read in the q-score entry*/
+
+    if(seqST->qCStr == 0)
+    { /*If have no q-score buffer*/
+        seqST->qCStr = malloc(sizeof(char) * 16);
+
+        if(seqST->qCStr == 0)
+            return 64;
+
+        seqST->lenQBuffUL = 16;
+    } /*If have no q-score buffer*/
+
+    if(lenL != (long) seqST->lenSeqUL)
+        *seqST->qCStr = '\0'; /*Fasta or invalid q-score entry*/
+
+    return 1;
+} /*readSeqST*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o seqCStr in seqST to be reverse complemented
+|        o qCStr in seqST to be reversed (if it has a q-score entry)
+\---------------------------------------------------------------------*/
+void revCompSeqST(
+    struct seqStruct *seqST /*Sequence to reverse complement*/
+) /*Reverse complements the sequence & reverses the q-score entry*/
+{ /*revCompSeqST*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: revCompSeqST
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    char *startCStr = seqST->seqCStr;
+    char *endCStr = seqST->seqCStr + seqST->lenSeqUL - 1;
+    char swapC = 0;
+    char qEntryBl = (*seqST->qCStr != '\0');
+
+    if(seqST->lenSeqUL == 0)
+        return;
+
+    while(startCStr <= endCStr)
+    { /*Loop: Reverse complement the sequence*/
+        swapC = *startCStr;
+
+        switch(*endCStr & ~32)
+        { /*Switch: Complement the end base into the start*/
+            case 'A': *startCStr = 'T'; break;
+            case 'C': *startCStr = 'G'; break;
+            case 'G': *startCStr = 'C'; break;
+            case 'T': *startCStr = 'A'; break;
+            case 'U': *startCStr = 'A'; break;
+            default:  *startCStr = 'N'; break;
+        } /*Switch: Complement the end base into the start*/
+
+        switch(swapC & ~32)
+        { /*Switch: Complement the start base into the end*/
+            case 'A': *endCStr = 'T'; break;
+            case 'C': *endCStr = 'G'; break;
+            case 'G': *endCStr = 'C'; break;
+            case 'T': *endCStr = 'A'; break;
+            case 'U': *endCStr = 'A'; break;
+            default:  *endCStr = 'N'; break;
+        } /*Switch: Complement the start base into the end*/
+
+        ++startCStr;
+        --endCStr;
+    } /*Loop: Reverse complement the sequence*/
+
+    if(!qEntryBl)
+        return;
+
+    startCStr = seqST->qCStr;
+    endCStr = seqST->qCStr + seqST->lenSeqUL - 1;
+
+    while(startCStr < endCStr)
+    { /*Loop: Reverse the q-score entry*/
+        swapC = *startCStr;
+        *startCStr = *endCStr;
+        *endCStr = swapC;
+        ++startCStr;
+        --endCStr;
+    } /*Loop: Reverse the q-score entry*/
+
+    return;
+} /*revCompSeqST*/
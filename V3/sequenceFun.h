@@ -0,0 +1,113 @@
+/*######################################################################
+# Use:
+#   o Holds the seqStruct structure & functions to read fasta or fastq
+#     entries into it & to reverse complement it
+# C standard libraries:
+#   - <stdlib.h>
+#   - <stdio.h>
+#   - <stdint.h>
+######################################################################*/
+
+#ifndef SEQUENCEFUN_H
+#define SEQUENCEFUN_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' sequenceFun SOH: Start Of Header
+'   o st-1 seqStruct:
+'     - Holds the id, sequence, & q-score entry of a read or reference
+'   o fun-1 initSeqST:
+'     - Sets all variables in a seqStruct structure to defaults
+'   o fun-2 freeSeqST:
+'     - Frees the buffers in a seqStruct structure
+'   o fun-3 readSeqLine:
+'     - Adds the next line in a file (no new line) to a buffer
+'   o fun-4 readSeqST:
+'     - Reads the next fasta or fastq entry into a seqStruct
+'   o fun-5 revCompSeqST:
+'     - Reverse complements the sequence & reverses the q-score entry
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: seqStruct
+| Use:
+|   - Holds one fasta or fastq entry. The buffers are reused (resized
+|     when to small) for each entry read in
+\---------------------------------------------------------------------*/
+typedef struct seqStruct
+{ /*seqStruct*/
+    char *idCStr;            /*Id of the sequence (no '>' or '@')*/
+    unsigned long lenIdUL;   /*Length of the id*/
+    unsigned long lenIdBuffUL; /*Size of idCStr*/
+
+    char *seqCStr;           /*Sequence*/
+    unsigned long lenSeqUL;  /*Length of the sequence*/
+    unsigned long lenSeqBuffUL; /*Size of seqCStr*/
+
+    char *qCStr;             /*Q-score entry ('\0' for fasta)*/
+    unsigned long lenQBuffUL;/*Size of qCStr*/
+}seqStruct;
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o All variables in seqST to be 0 (does not free)
+\---------------------------------------------------------------------*/
+void initSeqST(
+    struct seqStruct *seqST /*Structure to initialize*/
+); /*Sets all variables in a seqStruct structure to defaults*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Frees: The id, sequence, & q-score buffers in seqST & then
+|      initializes seqST
+\---------------------------------------------------------------------*/
+void freeSeqST(
+    struct seqStruct *seqST /*Structure to free*/
+); /*Frees the buffers in a seqStruct structure*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o Length of buffCStr after the line was added (no new line)
+|        o -1 if at the end of the file
+|        o -2 for memory allocation errors
+|    - Modifies:
+|        o buffCStr to have the line at startUL (resized if to small)
+\---------------------------------------------------------------------*/
+long readSeqLine(
+    FILE *inFILE,            /*File to read the line from*/
+    char **buffCStr,         /*Buffer to add the line to*/
+    unsigned long *lenBuffUL,/*Size of buffCStr*/
+    unsigned long startUL    /*Where to add the line in buffCStr*/
+); /*Adds the next line in a file (no new line) to a buffer*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if read in a sequence
+|        o 2 if at the end of the file
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o seqST to have the next entry. Only the first word of the
+|          header is kept as the id
+\---------------------------------------------------------------------*/
+uint8_t readSeqST(
+    FILE *inFILE,           /*Fasta or fastq file to read*/
+    struct seqStruct *seqST /*Gets the next entry*/
+); /*Reads the next fasta or fastq entry into a seqStruct*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o seqCStr in seqST to be reverse complemented
+|        o qCStr in seqST to be reversed (if it has a q-score entry)
+\---------------------------------------------------------------------*/
+void revCompSeqST(
+    struct seqStruct *seqST /*Sequence to reverse complement*/
+); /*Reverse complements the sequence & reverses the q-score entry*/
+
+#endif
@@ -10,6 +10,15 @@
 #    -no-hash:
 #      o Do search with only the AVL tree (no hashing)       [Hashing]
 #      o Takes lonber, but uses slightly (~10%) less memory. 
+#    -in-prim:
+#      o Find primers with the built in bit-parallel search  [No]
+#        instead of minimap2 (no paf file or hash table)
+#    -prim-err:
+#      o Max edits in a primer hit, as a fraction of the     [0.2]
+#        primer length (-in-prim)
+#    -prim-end:
+#      o Bases at each read end to search for primers        [0]
+#        (-in-prim). 0 searches the whole read.
 #    -v:
 #      o Print version & exit
 # Output:
@@ -36,7 +45,7 @@
 #   o <stdint.h>
 ######################################################################*/
 
-#include "trimPrimersSearch.h" /*Holds functions to do read extraction*/
+#include "trimPrimersMyers.h" /*Built in primer search (& read extraction)*/
 
 /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
 ' SOP: Start Of Program
@@ -58,7 +67,10 @@ char * checkInput(
     char **fqFileCStr, /*Will hold path to reads fastq file*/
     char **outFileCStr,   /*Will hold path of output file*/
     char *hashBl,    /*Set to 0 if user wants tree search*/
-    char *threadsCStr /*Number of threads to use with minimap2*/
+    char *threadsCStr, /*Number of threads to use with minimap2*/
+    char *inPrimBl,    /*Set to 1 for the built in primer search*/
+    float *primErrF,   /*Max edits, as fraction of primer length*/
+    uint32_t *primEndLenUI /*Bases at each read end to search*/
 ); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    | Fun-1 TOC: Sec-1 Sub-1: checkInput
    |  - Checks user input & puts input into variables for later use
@@ -87,6 +99,9 @@ int main(int lenArgsInt, char *argsCStr[])
     char hashBl = 1;       /*Holds if user wanted hashing [1: use hash]*/
     char *inputChar = 0;   /*Holds arguemnt that had input error*/
     char threadsCStr[128]; /*Holds number of threads to use*/
+    char inPrimBl = defInPrimBl;  /*1: Use the built in primer search*/
+    float primErrF = defPrimMaxErrF; /*Max edits in a primer hit*/
+    uint32_t primEndLenUI = defPrimEndLenUI; /*0: search whole read*/
 
     unsigned char errUC = 0; /*For error messages*/
 
@@ -108,6 +123,15 @@ int main(int lenArgsInt, char *argsCStr[])
         \n   -no-hash:                                       [Hashing]\
         \n     o Do search with only the AVL tree (no hashing)\
         \n     o Takes lonber, but uses slightly (~10%) less memory.\
+        \n   -in-prim:                                       [No]\
+        \n     o Find primers with the built in bit-parallel\
+        \n       search instead of minimap2.\
+        \n   -prim-err:                                      [0.2]\
+        \n     o Max edits in a primer hit, as a fraction of\
+        \n       the primer length (-in-prim).\
+        \n   -prim-end:                                      [0]\
+        \n     o Bases at each read end to search for\
+        \n       primers (-in-prim). 0 searches the whole read.\
         \n   -v:\
         \n     o Print version & exit\
         \n   -out:                                           [stdout]\
@@ -130,7 +154,10 @@ int main(int lenArgsInt, char *argsCStr[])
                            &fqFileCStr,
                            &outFileCStr,
                            &hashBl,
-                           threadsCStr
+                           threadsCStr,
+                           &inPrimBl,
+                           &primErrF,
+                           &primEndLenUI
     ); /*Get the user input*/
 
     if(inputChar != 0)
@@ -280,16 +307,28 @@ int main(int lenArgsInt, char *argsCStr[])
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /*Trim the reads using the input primers*/
-    errUC =
-      trimPrimers(
-          primFileCStr,
-          pafFileCStr,
-          stdinPafBl,
-          fqFileCStr,
-          outFileCStr,
-          threadsCStr,
-          hashBl
-    );
+    if(inPrimBl & 1 && !(stdinPafBl & 1) && pafFileCStr == 0)
+        errUC =
+          trimPrimersInSearch(
+              primFileCStr,
+              fqFileCStr,
+              outFileCStr,
+              threadsCStr,
+              primErrF,
+              primEndLenUI
+        );
+
+    else
+        errUC =
+          trimPrimers(
+              primFileCStr,
+              pafFileCStr,
+              stdinPafBl,
+              fqFileCStr,
+              outFileCStr,
+              threadsCStr,
+              hashBl
+        );
 
     if(errUC & 64)
     { /*If had a memory allocation error*/
@@ -303,6 +342,18 @@ int main(int lenArgsInt, char *argsCStr[])
         exit(-1);
     } /*If had a memory allocation error*/
 
+    if(inPrimBl & 1 && errUC & 16)
+    { /*If the primers could not be used*/
+        fprintf(
+            stderr,
+            "%s has no primers, a non-IUPAC base, or a primer over"
+            " %i bases\n",
+            primFileCStr,
+            defMaxPrimLenUC
+        ); /*Let user know the primers were invalid*/
+        exit(-1);
+    } /*If the primers could not be used*/
+
     exit(0);
 } /*main function*/
 
@@ -320,7 +371,10 @@ char * checkInput(
     char **fqFileCStr, /*Will hold path to reads fastq file*/
     char **outFileCStr,   /*Will hold path of output file*/
     char *hashBl,    /*Set to 0 if user wants tree search*/
-    char *threadsCStr /*Number of threads to use with minimap2*/
+    char *threadsCStr, /*Number of threads to use with minimap2*/
+    char *inPrimBl,    /*Set to 1 for the built in primer search*/
+    float *primErrF,   /*Max edits, as fraction of primer length*/
+    uint32_t *primEndLenUI /*Bases at each read end to search*/
 ){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
    | Fun-1 TOC: Sec-1 Sub-1: checkInput
    |  - Checks user input & puts input into variables for later use
@@ -363,6 +417,18 @@ char * checkInput(
             --intArg;         /*Account for incurment at end of loop*/
         } /*If user wants to do tree search instead*/
 
+        else if(strcmp(tmpCStr, "-in-prim") == 0)
+        { /*If user wants the built in primer search*/
+            *inPrimBl = 1;
+            --intArg;         /*Account for incurment at end of loop*/
+        } /*If user wants the built in primer search*/
+
+        else if(strcmp(tmpCStr, "-prim-err") == 0)
+            sscanf(singleArgCStr, "%f", primErrF);
+
+        else if(strcmp(tmpCStr, "-prim-end") == 0)
+            cStrToUInt(singleArgCStr, primEndLenUI);
+
         else
             return tmpCStr;
 
@@ -45,6 +45,9 @@
 '     - Sets all variables in a hashTblVar to 0
 '   o fun-9 freeHashTblVarST:
 '     - "free" a hashTblVar structuer (here if needed for future)
+'   o fun-10 mergeDupReadPrim:
+'     - Moves the primer coordinates of a duplicate read id to the
+'       kept node for the read id
 /~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*---------------------------------------------------------------------\
@@ -56,7 +59,7 @@
 |     o 64 for memory allocation errors
 |   - Modifies:
 |     o Initializes hashST, so make sure that thier is no allocated 
-|       memory in hashTbl & readTree (both set to 0)
+|       memory in fpHashST & readTree (both empty)
 |     o Variables in hashST to hold the readPrim list (readTree) and 
 |       length of the readPrim list (hashVarST.numIdsUL)
 \---------------------------------------------------------------------*/
@@ -281,8 +284,8 @@ unsigned char makeReadPrimList(
 |     o 1 for succes
 |     o 64 for memory allocation error
 |   - Modifies:
-|     o Variables in hashST to support a hash table
-|     o hashST->readTree is set to 0
+|     o hashST->fpHashST to have the read ids in hashST->readTree
+|     o hashST->readTree to be a list of only the unique read ids
 \---------------------------------------------------------------------*/
 unsigned char readPrimListToHash(
     char listOnHeapBl,
@@ -292,8 +295,8 @@ unsigned char readPrimListToHash(
    ' Fun-2 TOC: readPrimListToHash
    '   - Make a read id hash table from a readPrim list of read ids
    '   o fun-2 sec-1: Variable declerations
-   '   o fun-2 sec-2: Find the hash table size & make hash table
-   '   o fun-2 sec-3: Build hash
+   '   o fun-2 sec-2: Make the hash table
+   '   o fun-2 sec-3: Build hash (in batches of defFpBatchUI ids)
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -301,38 +304,23 @@ unsigned char readPrimListToHash(
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    unsigned char errUC = 0;
+   uint32_t lenBatchUI = 0;
+   uint64_t fpOneAryUL[defFpBatchUI];
+   uint64_t fpTwoAryUL[defFpBatchUI];
+   void *readAry[defFpBatchUI];     /*readPrim nodes in the batch*/
+   uint8_t dupAryUC[defFpBatchUI];
    struct readPrim *tmpRead = 0;
+   struct readPrim *keptList = 0;   /*List of unique read ids*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun-2 Sec-2: Find hash table size & make hash tabel               v
+   ^ Fun-2 Sec-2: Make the hash table                                  v
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
-   /*Just using this as a temporary variable*/
-   hashST->hashVarST.lenHashUL = hashST->hashVarST.numIdsUL;
-
-   /*Find power of two to use*/
-   while(hashST->hashVarST.lenHashUL > 0)
-   { /*While need to find the next power of two*/
-       hashST->hashVarST.lenHashUL = hashST->hashVarST.lenHashUL >> 1;
-       ++hashST->hashVarST.lenLog2HashUC;
-   } /*While need to find the next power of two*/
-
-   /*Make hash table sparase by using double the needed size*/
-   ++hashST->hashVarST.lenLog2HashUC;
-
-   /*Find the length of the hash table*/
-   hashST->hashVarST.lenHashUL = 1 << hashST->hashVarST.lenLog2HashUC;
-
-   hashST->hashTbl =
-      calloc(
-          (hashST->hashVarST.lenHashUL + 1),
-          sizeof(struct readPrim *)
-   ); /*Set up the hash table, Calloc intalizes with 0's*/
-
-   if(hashST->hashTbl == 0) return 64; /*Memory alloction error*/
+   if(makeIdFpHash(&hashST->fpHashST, hashST->hashVarST.numIdsUL) & 64)
+       return 64; /*Memory alloction error*/
 
    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
-   ^ Fun-2 Sec-3: Build hash                                           v
+   ^ Fun-2 Sec-3: Build hash (in batches of defFpBatchUI ids)          v
    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
    while(hashST->readTree != 0)
@@ -340,24 +328,78 @@ unsigned char readPrimListToHash(
        tmpRead = hashST->readTree->rightChild;
        hashST->readTree->rightChild = 0;
 
-       errUC = insReadPrimSTInHash(hashST->readTree, hashST);
-
-       /*Free the read node if it was a duplicate node*/
-       if(errUC == 0 && listOnHeapBl & 1)
-           freeReadPrimST(&hashST->readTree);
+       bigNumToIdFp(
+           hashST->readTree->idBigNum,
+           &fpOneAryUL[lenBatchUI],
+           &fpTwoAryUL[lenBatchUI]
+       );
 
+       readAry[lenBatchUI] = hashST->readTree;
+       ++lenBatchUI;
        hashST->readTree = tmpRead;  /*move to the next read*/
+
+       if(lenBatchUI < defFpBatchUI && hashST->readTree != 0)
+           continue; /*Still filling the batch*/
+
+       errUC =
+           insIdFpBatch(
+               &hashST->fpHashST,
+               fpOneAryUL,
+               fpTwoAryUL,
+               readAry,
+               dupAryUC,
+               lenBatchUI
+           );
+
+       for(uint32_t uiRead = 0; uiRead < lenBatchUI; ++uiRead)
+       { /*Loop: Move the batch to the kept list or free duplicates*/
+           tmpRead = (struct readPrim *) readAry[uiRead];
+
+           if(dupAryUC[uiRead] && errUC & 1)
+           { /*If was a duplicate, merge its coordinates into the kept*/
+               mergeDupReadPrim(
+                   tmpRead,
+                   findReadPrimInHash(tmpRead->idBigNum, hashST)
+               );
+           } /*If was a duplicate, merge its coordinates into the kept*/
+
+           /*Free the read node if it was a duplicate node*/
+           if(dupAryUC[uiRead] && listOnHeapBl & 1 && errUC & 1)
+               freeReadPrimST(&tmpRead);
+           else
+           { /*Else keep the node in the list*/
+               tmpRead->rightChild = keptList;
+               keptList = tmpRead;
+           } /*Else keep the node in the list*/
+       } /*Loop: Move the batch to the kept list or free duplicates*/
+
+       lenBatchUI = 0;
+
+       if(errUC & 64)
+       { /*If had a memory allocation error*/
+           while(hashST->readTree != 0)
+           { /*Loop: Keep the rest of the list, so it can be freed*/
+               tmpRead = hashST->readTree->rightChild;
+               hashST->readTree->rightChild = keptList;
+               keptList = hashST->readTree;
+               hashST->readTree = tmpRead;
+           } /*Loop: Keep the rest of the list, so it can be freed*/
+       } /*If had a memory allocation error*/
    } /*While their are reads to put in hash table*/
 
-   return 1;  /*Return head of hash table*/
-} /*makeReadPrimHash function*/
+   hashST->readTree = keptList;
+
+   if(errUC & 64) return 64;
+   return 1;
+} /*readPrimListToHash function*/
 
 /*---------------------------------------------------------------------\
 | Output:
-|  - Modifies: Inserts readNode into the hashTbl.
+|  - Modifies: Inserts readNode into hashST->fpHashST
 |  - Returns:
-|    - 0 IF read is a duplicate
+|    - 0 If read is a duplicate
 |    - 1 If read is unique
+|    - 64 for memory allocation errors
 \---------------------------------------------------------------------*/
 unsigned char insReadPrimSTInHash(
     struct readPrim *readNode,   /*readNode to insert into hash table*/
@@ -367,28 +409,21 @@ unsigned char insReadPrimSTInHash(
     '   - Inserts readPrim node with big number read id into hash table
     \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    unsigned long hashUL = 0; /*Hold the hash value*/
-
-    /*Find the index in the hash table this id will be/is stored at*/
-    hashUL =
-       calcHash(
-           readNode->idBigNum,
-           &hashST->hashVarST.majicNumUL,
-           &hashST->hashVarST.lenLog2HashUC
-    );
-
-   if(*(hashST->hashTbl + hashUL) == 0) /*If 1st node at hash value*/
-   { /*If is the fist node in the tree*/
-       *(hashST->hashTbl + hashUL) = readNode;
-       return 1;
-   } /*If is the fist node in the tree*/
-
-   return
-      avlInsPrimReadST(
-          readNode,
-          hashST->hashTbl + hashUL,
-          hashST->readStack
-   ); /*Return the result of the insertion (0 duplicate, 1 unique)*/
+    uint8_t errUC = 0;
+    uint64_t fpOneUL = 0;
+    uint64_t fpTwoUL = 0;
+
+    bigNumToIdFp(readNode->idBigNum, &fpOneUL, &fpTwoUL);
+    errUC = insIdFp(&hashST->fpHashST, fpOneUL, fpTwoUL, readNode);
+
+    if(errUC & 64) return 64;
+    if(errUC == 1) return 1; /*Unique read*/
+
+    mergeDupReadPrim(
+        readNode,
+        findReadPrimInHash(readNode->idBigNum, hashST)
+    ); /*Move the primer coordinates to the kept node*/
+    return 0; /*Duplicate read*/
 } /*insReadPrimSTInHash*/
 
 /*---------------------------------------------------------------------\
@@ -405,29 +440,19 @@ struct readPrim * findReadPrimInHash(
    '   - Finds a big number read id in a hash table of read ids
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    struct readPrim *tmpTree = 0;
-    unsigned long hashUL = 0;
+    struct idFpSlot *slotST = findIdFpHash(&hashST->fpHashST, idBigNum);
 
-    hashUL =
-       calcHash(
-           idBigNum,
-           &hashST->hashVarST.majicNumUL,
-           &hashST->hashVarST.lenLog2HashUC
-    ); /*Find hash value and grab readPrim AVL tree at hash value*/
-
-    tmpTree = *(hashST->hashTbl + hashUL);
-
-   /*See if the read id exists in the AVL tree pulled from the table*/
-    return searchReadPrimTree(idBigNum, tmpTree);
+    if(slotST == 0) return 0;
+    return (struct readPrim *) slotST->dataPtr;
 } /*findReadPrimInHash*/
 
 /*---------------------------------------------------------------------\
 | Output:
 |  - Frees:
-|    o Hash table if hash table has entries
+|    o Hash table & the list of nodes in it if have a hash table
 |    o Read tree if hash table is empty (set to 0)
 |  - Modifies:
-|    o hashST->hashTbl is set to 0  (to mark has been freed)
+|    o hashST->fpHashST is set to empty (to mark has been freed)
 |    o hashST->readTree is set to 0 (to mark has been freed)
 \---------------------------------------------------------------------*/
 void freeReadPrimHashTblOrTree(
@@ -438,35 +463,26 @@ void freeReadPrimHashTblOrTree(
    '   - Frees a hash table or readTree (if hash table empty)
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-    struct readPrim *readTree = 0;
-    unsigned long numElmInTblUL = 0;
+    struct readPrim *nextRead = 0;
 
-    if(hashST->hashTbl != 0)
+    if(hashST->fpHashST.slotAryST != 0)
     { /*If have a hash table to free*/
-        readTree = *(hashST->hashTbl);
-
-        while(numElmInTblUL <= hashST->hashVarST.numIdsUL)
-        { /*While there are entries to free in the hash table*/
-            if(readTree != 0)
-                freeReadPrimTree(&readTree, hashST->readStack);
+        freeIdFpHash(&hashST->fpHashST);
 
-            /*Find the next tree in the hash table*/
-            numElmInTblUL++;
-            readTree = *(hashST->hashTbl + numElmInTblUL);
-        } /*While there are entries to free in the hash table*/
-
-        free(hashST->hashTbl);
-        hashST->hashTbl = 0;  /*So user knows their is nothing here*/
-        hashST->readTree = 0; /*All these nodes were in the hash table*/
+        while(hashST->readTree != 0)
+        { /*While there are nodes from the hash table to free*/
+            nextRead = hashST->readTree->rightChild;
+            freeReadPrimST(&hashST->readTree);
+            hashST->readTree = nextRead;
+        } /*While there are nodes from the hash table to free*/
 
         return;
     } /*If have a hash table to free*/
 
-    if(readTree != 0)
+    if(hashST->readTree != 0)
         freeReadPrimTree(&hashST->readTree, hashST->readStack);
 
     hashST->readTree = 0; /*So user knows their is nothing here*/
-    hashST->hashTbl = 0;  /*Make sure is 0*/
  
     return;
 } /*freeHashTblOrTree*/
@@ -475,7 +491,7 @@ void freeReadPrimHashTblOrTree(
 | Output:
 |   - Modifies:
 |     o readTree to be 0
-|     o hashTbl to be 0
+|     o fpHashST to be an empty table
 |     o readStack to have first stack set to 0
 |     o majicNumUL to hold the majic number for the hash
 |     o lenHashUL to be 0
@@ -490,7 +506,7 @@ void initReadPrimHashST(
 
    initHashTblVarST(&hashST->hashVarST);
    hashST->readTree = 0;
-   hashST->hashTbl = 0;
+   initIdFpHash(&hashST->fpHashST);
 
    /*Make sure start & end of my stacks are marked*/
    hashST->readStack[0].readNode = 0;
@@ -517,27 +533,11 @@ void freeReadPrimHashST(
    '   - Frees a readInfoHash structure
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
-   unsigned long numElmInTblUL = 0;
-
    if(hashElmOnHeapBl & 1)
        freeReadPrimHashTblOrTree(hashST); /*Free the hash table/tree*/
    else
-   { /*Else only the hash table (not the nodes) are on the heap*/
-       if(hashST->hashTbl != 0)
-       { /*If have a hash table to free*/
-
-           /*Make sure I only free the hash table*/
-           while(numElmInTblUL <= hashST->hashVarST.numIdsUL)
-           { /*While their are nodes in the hash table to blank*/
-               *(hashST->hashTbl + numElmInTblUL) = 0;
-               numElmInTblUL++;
-           } /*While their are nodes in the hash table to blank*/
-
-           free(hashST->hashTbl);
-       } /*If have a hash table to free*/
-   } /*Else only the hash table (not the nodes) are on the heap*/
-
-   hashST->hashTbl = 0;
+       freeIdFpHash(&hashST->fpHashST); /*Only the table is on heap*/
+
    hashST->readTree = 0;
    freeHashTblVarST(0, &hashST->hashVarST);
 
@@ -586,3 +586,31 @@ void freeHashTblVarST(
 
    return;
 } /*freeHashTblVarST*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o keptRead to have the primer coordinates from dupRead
+|     o dupRead->primCordST to be 0 (so freeing it keeps coordinates)
+\---------------------------------------------------------------------*/
+void mergeDupReadPrim(
+    struct readPrim *dupRead, /*Duplicate read id node (not in table)*/
+    struct readPrim *keptRead /*Node for the read id in the table*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-10 TOC: Sec-1 Sub-1: mergeDupReadPrim
+   '   - Moves a duplicate read ids primer coordinates to the kept node
+   '     (same as avlInsPrimReadST does for duplicates)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+   if(keptRead == 0 || keptRead == dupRead) return;
+   if(dupRead->primCordST == 0) return; /*Nothing to transfer*/
+
+   if(keptRead->primCordST == 0)
+       keptRead->primCordST = dupRead->primCordST;
+   else
+       insPrimCordST(dupRead->primCordST, &keptRead->primCordST);
+
+   /*So the user does not free coordiantes with the duplicate node*/
+   dupRead->primCordST = 0;
+   return;
+} /*mergeDupReadPrim*/
@@ -5,6 +5,7 @@
 #       also is has functions for freeing or searching the hash table
 # Includes:
 #   - "fqGetIdsHash.h"
+#   - "fqGetIdsFpHash.h"
 #   - "trimPrimersAVLTree.h"
 #   - "defaultSettings.h"
 #   - "cStrFun.h"
@@ -27,6 +28,7 @@
 #define TRIMPRIMERSHASH_H
 
 #include "fqGetIdsHash.h"    /*For hashing functions and trees*/
+#include "fqGetIdsFpHash.h"  /*For the fingerprint hash table*/
 #include "defaultSettings.h" /*For minimap2 command*/
 #include "cStrFun.h"         /*For copying strings*/
 
@@ -58,6 +60,9 @@
 '     - Sets all variables in a hashTblVar to 0
 '   o fun-9 freeHashTblVarST:
 '     - "free" a hashTblVar structuer (here if needed for future)
+'   o fun-10 mergeDupReadPrim:
+'     - Moves the primer coordinates of a duplicate read id to the
+'       kept node for the read id
 \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*---------------------------------------------------------------------\
@@ -80,8 +85,9 @@ typedef struct hashTblVar
 typedef struct readPrimHash
 { /*readPrimHashTree*/
     struct hashTblVar hashVarST;  /*Gereral hash variables*/
-    struct readPrim *readTree;    /*AVL tree or list*/
-    struct readPrim **hashTbl;    /*Hash table*/
+    struct readPrim *readTree;
+       /*AVL tree or list (list has the nodes in fpHashST)*/
+    struct idFpHash fpHashST;     /*Hash table (dataPtr is readPrim)*/
     struct readPrimStack readStack[defLenStack];
       /*For hash and tree search & free functions*/
       /*defLenStack from fqGetIdsHash*/
@@ -96,7 +102,7 @@ typedef struct readPrimHash
 |     o 64 for memory allocation errors
 |   - Modifies:
 |     o Initializes hashST, so make sure that thier is no allocated 
-|       memory in hashTbl & readTree (both set to 0)
+|       memory in fpHashST & readTree (both empty)
 |     o Variables in hashST to hold the readPrim list (readTree) and 
 |       length of the readPrim list (hashVarST.numIdsUL)
 \---------------------------------------------------------------------*/
@@ -124,8 +130,8 @@ unsigned char makeReadPrimList(
 |     o 1 for succes
 |     o 64 for memory allocation error
 |   - Modifies:
-|     o Variables in hashST to support a hash table
-|     o hashST->readTree is set to 0
+|     o hashST->fpHashST to have the read ids in hashST->readTree
+|     o hashST->readTree to be a list of only the unique read ids
 \---------------------------------------------------------------------*/
 unsigned char readPrimListToHash(
     char listOnHeapBl,
@@ -135,12 +141,17 @@ unsigned char readPrimListToHash(
    ' Fun-2 TOC: readPrimListToHash
    '   - Make a read id hash table from a readPrim list of read ids
    '   o fun-2 sec-1: Variable declerations
-   '   o fun-2 sec-2: Find the hash table size & make hash table
-   '   o fun-2 sec-3: Build hash
+   '   o fun-2 sec-2: Make the hash table
+   '   o fun-2 sec-3: Build hash (in batches of defFpBatchUI ids)
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
 /*---------------------------------------------------------------------\
-| Output: Modifies: Inserts readNode into the hashTbl.
+| Output:
+|  - Modifies: Inserts readNode into hashST->fpHashST
+|  - Returns:
+|    - 0 If read is a duplicate
+|    - 1 If read is unique
+|    - 64 for memory allocation errors
 \---------------------------------------------------------------------*/
 unsigned char insReadPrimSTInHash(
     struct readPrim *readNode,   /*readNode to insert into hash table*/
@@ -167,10 +178,10 @@ struct readPrim * findReadPrimInHash(
 /*---------------------------------------------------------------------\
 | Output:
 |  - Frees:
-|    o Hash table if hash table has entries
+|    o Hash table & the list of nodes in it if have a hash table
 |    o Read tree if hash table is empty (set to 0)
 |  - Modifies:
-|    o hashST->hashTbl is set to 0  (to mark has been freed)
+|    o hashST->fpHashST is set to empty (to mark has been freed)
 |    o hashST->readTree is set to 0 (to mark has been freed)
 \---------------------------------------------------------------------*/
 void freeReadPrimHashTblOrTree(
@@ -185,7 +196,7 @@ void freeReadPrimHashTblOrTree(
 | Output:
 |   - Modifies:
 |     o readTree to be 0
-|     o hashTbl to be 0
+|     o fpHashST to be an empty table
 |     o readStack to have first stack set to 0
 |     o majicNumUL to hold the majic number for the hash
 |     o lenHashUL to be 0
@@ -242,4 +253,19 @@ void freeHashTblVarST(
    '   - Frees a hashTblVarST structure
    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
 
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o keptRead to have the primer coordinates from dupRead
+|     o dupRead->primCordST to be 0 (so freeing it keeps coordinates)
+\---------------------------------------------------------------------*/
+void mergeDupReadPrim(
+    struct readPrim *dupRead, /*Duplicate read id node (not in table)*/
+    struct readPrim *keptRead /*Node for the read id in the table*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-10 TOC: Sec-1 Sub-1: mergeDupReadPrim
+   '   - Moves a duplicate read ids primer coordinates to the kept node
+   '     (same as avlInsPrimReadST does for duplicates)
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
 #endif
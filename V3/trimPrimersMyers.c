@@ -0,0 +1,830 @@
+/*######################################################################
+# Name: trimPrimersMyers
+# Use:
+#   o Finds primers in reads with Myers bit-parallel approximate
+#     matching & trims the reads while reading the fastq file. This
+#     replaces the minimap2 mapping, the paf file, & the read id hash
+#     table used by trimPrimers.
+# Output
+#   o Trimmed reads are output to a fastq file
+# Includes:
+#   - "trimPrimersSearch.h"
+#   o "trimPrimersHash.h"
+#   o "fqGetIdsHash.h"
+#   o "trimPrimersAVLTree.h"
+#   o "defaultSettings.h"
+#   o "cStrFun.h"
+#   o "fqGetIdsFqFun.h"
+#   o "trimPrimersStructs.h"
+#   o "fqGetIdsStructs.h"
+#   o "cStrToNumberFun.h"
+#   o "fqAndFaFun.h"
+#   o "FCIStatsFun.h"     (fqAndFqFun.h)
+#   o "minAlnStats.h"     (fqAndFaFun.h)
+#   o "samEntryStruct.h"  (fqAndFaFun.h->FCIstatsFun.h)
+#   o "printError.h"      (fqAndFaFun.h)
+# C standard includes:
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' trimPrimersMyers SOF: Start Of Functions
+'  - fun-1 initPrimSearch:
+'    o Sets a primSearch structure to have no primers
+'  - fun-2 freePrimSearch:
+'    o Frees the primers & hits in a primSearch structure
+'  - fun-3 iupacToBaseMask:
+'    o Converts an IUPAC base to a mask of the bases it matches
+'  - fun-4 addPrimPat:
+'    o Adds a primer (or its reverse complement) to a primSearch
+'  - fun-5 readPrimFa:
+'    o Reads the primers in a fasta file into a primSearch
+'  - fun-6 primPatFindStart:
+'    o Finds where a primer hit starts on a read
+'  - fun-7 primPatFindHits:
+'    o Finds the hits of one primer pattern in part of a read
+'  - fun-8 findPrimsInRead:
+'    o Finds every primer hit in a read & sorts the hits
+'  - fun-9 trimPrimersInSearch:
+'    o Trims primers from reads with the built in primer search
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#include "trimPrimersMyers.h"
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o searchST to have no primers or hits & endLenUI to 0
+\---------------------------------------------------------------------*/
+void initPrimSearch(
+    struct primSearch *searchST /*Structure to initialize*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-1 TOC: Sec-1 Sub-1: initPrimSearch
+   '  - Sets a primSearch structure to have no primers
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    searchST->patAryST = 0;
+    searchST->numPatUI = 0;
+    searchST->lenPatAryUI = 0;
+
+    searchST->cordAryST = 0;
+    searchST->numCordsUI = 0;
+    searchST->lenCordAryUI = 0;
+
+    searchST->endLenUI = 0;
+
+    for(uint32_t uiBase = 0; uiBase < 256; ++uiBase)
+        searchST->baseIndexAryUC[uiBase] = defPrimOtherBaseUC;
+
+    searchST->baseIndexAryUC['A'] = 0;
+    searchST->baseIndexAryUC['a'] = 0;
+    searchST->baseIndexAryUC['C'] = 1;
+    searchST->baseIndexAryUC['c'] = 1;
+    searchST->baseIndexAryUC['G'] = 2;
+    searchST->baseIndexAryUC['g'] = 2;
+    searchST->baseIndexAryUC['T'] = 3;
+    searchST->baseIndexAryUC['t'] = 3;
+    searchST->baseIndexAryUC['U'] = 3;
+    searchST->baseIndexAryUC['u'] = 3;
+
+    return;
+} /*initPrimSearch*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The patterns & hits in searchST (not searchST)
+\---------------------------------------------------------------------*/
+void freePrimSearch(
+    struct primSearch *searchST /*Structure to free variables in*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-2 TOC: Sec-1 Sub-1: freePrimSearch
+   '  - Frees the primers & hits in a primSearch structure
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(searchST->patAryST);
+    searchST->patAryST = 0;
+    searchST->numPatUI = 0;
+    searchST->lenPatAryUI = 0;
+
+    free(searchST->cordAryST);
+    searchST->cordAryST = 0;
+    searchST->numCordsUI = 0;
+    searchST->lenCordAryUI = 0;
+
+    return;
+} /*freePrimSearch*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o Mask of the bases baseC matches (1: A, 2: C, 4: G, 8: T)
+|     o 0 if baseC is not an IUPAC base
+\---------------------------------------------------------------------*/
+uint8_t iupacToBaseMask(
+    char baseC /*Base to convert*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-3 TOC: Sec-1 Sub-1: iupacToBaseMask
+   '  - Converts an IUPAC base to a mask of the bases it matches
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    switch(baseC & ~32) /*Removes lower case bit*/
+    { /*Switch: Find the bases this base matches*/
+        case 'A': return 1;
+        case 'C': return 2;
+        case 'G': return 4;
+        case 'T': return 8;
+        case 'U': return 8;
+        case 'R': return 1 | 4;     /*A or G*/
+        case 'Y': return 2 | 8;     /*C or T*/
+        case 'S': return 2 | 4;     /*C or G*/
+        case 'W': return 1 | 8;     /*A or T*/
+        case 'K': return 4 | 8;     /*G or T*/
+        case 'M': return 1 | 2;     /*A or C*/
+        case 'B': return 2 | 4 | 8; /*Not A*/
+        case 'D': return 1 | 4 | 8; /*Not C*/
+        case 'H': return 1 | 2 | 8; /*Not G*/
+        case 'V': return 1 | 2 | 4; /*Not T*/
+        case 'N': return 1 | 2 | 4 | 8;
+    } /*Switch: Find the bases this base matches*/
+
+    return 0;
+} /*iupacToBaseMask*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if added the primer
+|     o 16 if the primer is empty, too long, or has non-IUPAC bases
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o patAryST in searchST to have the primer
+\---------------------------------------------------------------------*/
+uint8_t addPrimPat(
+    struct primSearch *searchST, /*Search to add the primer to*/
+    char *primCStr,              /*Primer sequence*/
+    uint32_t lenPrimUI,          /*Number of bases in primCStr*/
+    char revCompBl,              /*1: Add the reverse complement*/
+    float maxErrF        /*Max edits, as a fraction of primer length*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-4 TOC: addPrimPat
+   '  - Adds a primer (or its reverse complement) to a primSearch
+   '  o fun-4 sec-1: Variable declerations
+   '  o fun-4 sec-2: Make sure have room for the pattern
+   '  o fun-4 sec-3: Make the match vectors
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    struct primPat *patST = 0;
+    struct primPat *swapAryST = 0; /*For resizing the pattern array*/
+    uint8_t maskUC = 0;            /*Bases a primer base matches*/
+    char baseC = 0;
+
+    if(lenPrimUI == 0 || lenPrimUI > defMaxPrimLenUC) return 16;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-2: Make sure have room for the pattern
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    if(searchST->numPatUI >= searchST->lenPatAryUI)
+    { /*If need to make the pattern array bigger*/
+        if(searchST->lenPatAryUI == 0)
+            searchST->lenPatAryUI = defMinPrimPatsUI;
+        else
+            searchST->lenPatAryUI <<= 1;
+
+        swapAryST =
+            realloc(
+                searchST->patAryST,
+                searchST->lenPatAryUI * sizeof(struct primPat)
+            );
+
+        if(swapAryST == 0) return 64;
+
+        searchST->patAryST = swapAryST;
+    } /*If need to make the pattern array bigger*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-4 Sec-3: Make the match vectors
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    patST = searchST->patAryST + searchST->numPatUI;
+
+    for(uint8_t ucBase = 0; ucBase < defPrimBasesUC; ++ucBase)
+    { /*Loop: Blank the match vectors*/
+        patST->peqAryUL[ucBase] = 0;
+        patST->revPeqAryUL[ucBase] = 0;
+    } /*Loop: Blank the match vectors*/
+
+    for(uint32_t uiBase = 0; uiBase < lenPrimUI; ++uiBase)
+    { /*Loop: Set the bits for each primer base*/
+        if(revCompBl & 1)
+        { /*If making the reverse complement pattern*/
+            baseC = primCStr[lenPrimUI - uiBase - 1];
+            maskUC = iupacToBaseMask(baseC);
+
+            /*Swap A (1) with T (8) & C (2) with G (4)*/
+            maskUC =
+                  ((maskUC & 1) << 3)
+                | ((maskUC & 2) << 1)
+                | ((maskUC & 4) >> 1)
+                | ((maskUC & 8) >> 3);
+        } /*If making the reverse complement pattern*/
+
+        else
+            maskUC = iupacToBaseMask(primCStr[uiBase]);
+
+        if(maskUC == 0) return 16; /*Not a base*/
+
+        for(uint8_t ucBase = 0; ucBase < 4; ++ucBase)
+        { /*Loop: Mark the bases this primer base matches*/
+            if(!(maskUC & (1 << ucBase))) continue;
+
+            patST->peqAryUL[ucBase] |= ((uint64_t) 1) << uiBase;
+            patST->revPeqAryUL[ucBase] |=
+                ((uint64_t) 1) << (lenPrimUI - uiBase - 1);
+        } /*Loop: Mark the bases this primer base matches*/
+    } /*Loop: Set the bits for each primer base*/
+
+    patST->lenUC = lenPrimUI;
+    patST->maxErrUC = (uint8_t) (lenPrimUI * maxErrF);
+
+    /*A hit with every base an edit is no hit*/
+    if(patST->maxErrUC >= lenPrimUI) patST->maxErrUC = lenPrimUI - 1;
+
+    ++searchST->numPatUI;
+    return 1;
+} /*addPrimPat*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if read in the primers
+|     o 2 if could not open the fasta file
+|     o 16 if had an invalid primer or no primers
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o patAryST in searchST to have each primer & its reverse
+|       complement
+\---------------------------------------------------------------------*/
+uint8_t readPrimFa(
+    char *faPathCStr,            /*Fasta file with the primers*/
+    struct primSearch *searchST, /*Search to add the primers to*/
+    float maxErrF        /*Max edits, as a fraction of primer length*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-5 TOC: readPrimFa
+   '  - Reads the primers in a fasta file into a primSearch
+   '  o fun-5 sec-1: Variable declerations
+   '  o fun-5 sec-2: Read in the primers
+   '  o fun-5 sec-3: Add the last primer & clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    char lineCStr[defPrimLineLenUI];
+    char primCStr[defMaxPrimLenUC + 1];
+    char *tmpCStr = 0;
+    char headerBl = 0;     /*1: On a header line*/
+    char lineStartBl = 1;  /*1: lineCStr is at the start of a line*/
+    uint32_t lenPrimUI = 0;
+    uint8_t errUC = 1;
+    FILE *faFILE = 0;
+
+    faFILE = fopen(faPathCStr, "r");
+
+    if(faFILE == 0) return 2;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-2: Read in the primers
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    while(fgets(lineCStr, defPrimLineLenUI, faFILE))
+    { /*While have lines in the fasta file*/
+        if(lineStartBl & 1 && lineCStr[0] == '>')
+        { /*If starting a new primer*/
+            if(lenPrimUI > 0)
+            { /*If have a primer to add*/
+                errUC =
+                  addPrimPat(searchST, primCStr, lenPrimUI, 0, maxErrF);
+
+                if(errUC & 1)
+                    errUC =
+                      addPrimPat(searchST,primCStr,lenPrimUI,1,maxErrF);
+
+                if(!(errUC & 1)) break;
+            } /*If have a primer to add*/
+
+            lenPrimUI = 0;
+            headerBl = 1;
+        } /*If starting a new primer*/
+
+        else if(lineStartBl & 1)
+            headerBl = 0;
+
+        /*Long lines are read in more than one piece*/
+        lineStartBl = (strchr(lineCStr, '\n') != 0);
+
+        if(headerBl & 1) continue;
+
+        for(tmpCStr = lineCStr; *tmpCStr != '\0'; ++tmpCStr)
+        { /*Loop: Copy the primer bases*/
+            if(*tmpCStr < 33) continue; /*White space*/
+
+            if(lenPrimUI >= defMaxPrimLenUC)
+            { /*If the primer is to long*/
+                errUC = 16;
+                break;
+            } /*If the primer is to long*/
+
+            primCStr[lenPrimUI] = *tmpCStr;
+            ++lenPrimUI;
+        } /*Loop: Copy the primer bases*/
+
+        if(!(errUC & 1)) break;
+    } /*While have lines in the fasta file*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-5 Sec-3: Add the last primer & clean up
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fclose(faFILE);
+
+    if(!(errUC & 1)) return errUC;
+
+    if(lenPrimUI > 0)
+    { /*If have a primer to add*/
+        errUC = addPrimPat(searchST, primCStr, lenPrimUI, 0, maxErrF);
+
+        if(errUC & 1)
+            errUC = addPrimPat(searchST, primCStr, lenPrimUI, 1, maxErrF);
+
+        if(!(errUC & 1)) return errUC;
+    } /*If have a primer to add*/
+
+    if(searchST->numPatUI == 0) return 16; /*No primers*/
+
+    return 1;
+} /*readPrimFa*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o Start of the best alignment of patST ending at endUI
+\---------------------------------------------------------------------*/
+uint32_t primPatFindStart(
+    struct primPat *patST,     /*Primer that was found*/
+    uint8_t *baseIndexAryUC,   /*Converts bases to peq indexes*/
+    char *seqCStr,             /*Read sequence*/
+    uint32_t endUI,            /*Last base of the hit*/
+    uint32_t minStartUI        /*Lowest start to look at*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-6 TOC: Sec-1 Sub-1: primPatFindStart
+   '  - Finds where a primer hit starts on a read. This aligns the
+   '    reversed primer to the read going backwards from endUI. The
+   '    top row is not free (| 1 on the horizontal vector), so the
+   '    score is the edit distance of the primer to the read from
+   '    the position on to endUI.
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    uint64_t posVectUL = ~((uint64_t) 0);  /*Positive vertical deltas*/
+    uint64_t negVectUL = 0;                /*Negative vertical deltas*/
+    uint64_t posHorUL = 0;                 /*Positive horizontal deltas*/
+    uint64_t negHorUL = 0;                 /*Negative horizontal deltas*/
+    uint64_t eqUL = 0;                     /*Primer bases matching*/
+    uint64_t xVectUL = 0;
+    uint64_t xHorUL = 0;
+    uint64_t lastBitUL = ((uint64_t) 1) << (patST->lenUC - 1);
+
+    uint32_t scoreUI = patST->lenUC;
+    uint32_t bestScoreUI = patST->lenUC;
+    uint32_t posUI = endUI + 1;
+    uint32_t bestStartUI = endUI + 1;
+    uint32_t maxLenUI = patST->lenUC + patST->maxErrUC;
+
+    while(posUI > minStartUI && endUI + 1 - posUI < maxLenUI)
+    { /*Loop: Align the primer backwards from the end*/
+        --posUI;
+
+        eqUL =
+          patST->revPeqAryUL[
+             baseIndexAryUC[(unsigned char) seqCStr[posUI]]
+          ];
+
+        xVectUL = eqUL | negVectUL;
+        xHorUL = (((eqUL & posVectUL) + posVectUL) ^ posVectUL) | eqUL;
+        posHorUL = negVectUL | ~(xHorUL | posVectUL);
+        negHorUL = posVectUL & xHorUL;
+
+        if(posHorUL & lastBitUL) ++scoreUI;
+        else if(negHorUL & lastBitUL) --scoreUI;
+
+        posHorUL = (posHorUL << 1) | 1;
+        negHorUL <<= 1;
+        posVectUL = negHorUL | ~(xVectUL | posHorUL);
+        negVectUL = posHorUL & xVectUL;
+
+        if(scoreUI < bestScoreUI)
+        { /*If this is a better start*/
+            bestScoreUI = scoreUI;
+            bestStartUI = posUI;
+        } /*If this is a better start*/
+    } /*Loop: Align the primer backwards from the end*/
+
+    /*If every start was as bad as deleting the primer, assume the
+      primer has no indels*/
+    if(bestStartUI > endUI)
+        bestStartUI =
+            endUI + 1 < patST->lenUC + minStartUI
+          ? minStartUI
+          : endUI + 1 - patST->lenUC;
+
+    return bestStartUI;
+} /*primPatFindStart*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if found all hits (or no hits)
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o cordAryST & numCordsUI in searchST to have the hits
+\---------------------------------------------------------------------*/
+uint8_t primPatFindHits(
+    struct primSearch *searchST, /*Has the hit array & base indexes*/
+    struct primPat *patST,       /*Primer to find*/
+    char *seqCStr,               /*Read sequence*/
+    uint32_t startUI,            /*First base to search*/
+    uint32_t endUI               /*One past the last base to search*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-7 TOC: primPatFindHits
+   '  - Finds the hits of one primer pattern in part of a read. This is
+   '    Myers 1999 bit-vector algorithm (with Hyyro's notation). The
+   '    score is the edit distance of the whole primer to the best
+   '    part of the read ending at the position.
+   '  o fun-7 sec-1: Variable declerations
+   '  o fun-7 sec-2: Find the best end of each hit
+   '  o fun-7 sec-3: Add the hit to the hit list
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint64_t posVectUL = ~((uint64_t) 0);  /*Positive vertical deltas*/
+    uint64_t negVectUL = 0;                /*Negative vertical deltas*/
+    uint64_t posHorUL = 0;                 /*Positive horizontal deltas*/
+    uint64_t negHorUL = 0;                 /*Negative horizontal deltas*/
+    uint64_t eqUL = 0;                     /*Primer bases matching*/
+    uint64_t xVectUL = 0;
+    uint64_t xHorUL = 0;
+    uint64_t lastBitUL = ((uint64_t) 1) << (patST->lenUC - 1);
+
+    uint32_t scoreUI = patST->lenUC;
+    uint32_t bestScoreUI = 0;
+    uint32_t bestEndUI = 0;
+    char inHitBl = 0;      /*1: Score is in the error budget*/
+    char lastBaseBl = 0;   /*1: On the last base to search*/
+
+    struct primCord *swapAryST = 0; /*For resizing the hit array*/
+    struct primCord *cordST = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-7 Sec-2: Find the best end of each hit
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(uint32_t uiPos = startUI; uiPos < endUI; ++uiPos)
+    { /*Loop: Score the primer ending at each base*/
+        eqUL =
+          patST->peqAryUL[
+             searchST->baseIndexAryUC[(unsigned char) seqCStr[uiPos]]
+          ];
+
+        xVectUL = eqUL | negVectUL;
+        xHorUL = (((eqUL & posVectUL) + posVectUL) ^ posVectUL) | eqUL;
+        posHorUL = negVectUL | ~(xHorUL | posVectUL);
+        negHorUL = posVectUL & xHorUL;
+
+        if(posHorUL & lastBitUL) ++scoreUI;
+        else if(negHorUL & lastBitUL) --scoreUI;
+
+        /*The top row is 0 (not shifting in a 1), so hits can start
+          anywhere in the read*/
+        posHorUL <<= 1;
+        negHorUL <<= 1;
+        posVectUL = negHorUL | ~(xVectUL | posHorUL);
+        negVectUL = posHorUL & xVectUL;
+
+        lastBaseBl = (uiPos + 1 == endUI);
+
+        if(scoreUI <= patST->maxErrUC)
+        { /*If this end is in the error budget*/
+            if(!(inHitBl & 1) || scoreUI < bestScoreUI)
+            { /*If this is the best end of the hit*/
+                bestScoreUI = scoreUI;
+                bestEndUI = uiPos;
+            } /*If this is the best end of the hit*/
+
+            inHitBl = 1;
+
+            if(!(lastBaseBl & 1)) continue;
+        } /*If this end is in the error budget*/
+
+        if(!(inHitBl & 1)) continue;
+
+        inHitBl = 0;
+
+        /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+        ^ Fun-7 Sec-3: Add the hit to the hit list
+        \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+        if(searchST->numCordsUI >= searchST->lenCordAryUI)
+        { /*If need to make the hit array bigger*/
+            if(searchST->lenCordAryUI == 0)
+                searchST->lenCordAryUI = defMinPrimHitsUI;
+            else
+                searchST->lenCordAryUI <<= 1;
+
+            swapAryST =
+                realloc(
+                    searchST->cordAryST,
+                    searchST->lenCordAryUI * sizeof(struct primCord)
+                );
+
+            if(swapAryST == 0) return 64;
+
+            searchST->cordAryST = swapAryST;
+        } /*If need to make the hit array bigger*/
+
+        /*Coordinates are the same as a paf file (end is one past the
+          last base), so trimAndPrintRead trims them the same*/
+        cordST = searchST->cordAryST + searchST->numCordsUI;
+
+        cordST->startUI =
+            primPatFindStart(
+                patST,
+                searchST->baseIndexAryUC,
+                seqCStr,
+                bestEndUI,
+                startUI
+            );
+
+        cordST->endUI = bestEndUI + 1;
+        cordST->nextCord = 0;
+        ++searchST->numCordsUI;
+    } /*Loop: Score the primer ending at each base*/
+
+    return 1;
+} /*primPatFindHits*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if searched the read
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o cordAryST & numCordsUI in searchST to have the hits sorted by
+|       start & linked (nextCord) in sorted order
+\---------------------------------------------------------------------*/
+uint8_t findPrimsInRead(
+    struct primSearch *searchST, /*Primers to search for*/
+    char *seqCStr,               /*Read sequence*/
+    uint32_t lenSeqUI            /*Number of bases in seqCStr*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-8 TOC: findPrimsInRead
+   '  - Finds every primer hit in a read & sorts the hits
+   '  o fun-8 sec-1: Variable declerations
+   '  o fun-8 sec-2: Search the read ends (or whole read)
+   '  o fun-8 sec-3: Sort & link the hits
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    uint32_t endLenUI = searchST->endLenUI;
+    struct primCord swapCordST;
+    uint32_t uiSwap = 0;
+
+    searchST->numCordsUI = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-2: Search the read ends (or whole read)
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Search the whole read if the ends overlap*/
+    if(endLenUI == 0 || lenSeqUI <= (endLenUI << 1))
+        endLenUI = 0;
+
+    for(uint32_t uiPat = 0; uiPat < searchST->numPatUI; ++uiPat)
+    { /*Loop: Find the hits for each primer*/
+        if(endLenUI == 0)
+        { /*If searching the whole read*/
+            if(
+               !(
+                 primPatFindHits(
+                    searchST,
+                    searchST->patAryST + uiPat,
+                    seqCStr,
+                    0,
+                    lenSeqUI
+                 ) & 1
+               )
+            ) return 64;
+
+            continue;
+        } /*If searching the whole read*/
+
+        if(
+           !(
+             primPatFindHits(
+                searchST,
+                searchST->patAryST + uiPat,
+                seqCStr,
+                0,
+                endLenUI
+             ) & 1
+           )
+        ) return 64;
+
+        if(
+           !(
+             primPatFindHits(
+                searchST,
+                searchST->patAryST + uiPat,
+                seqCStr,
+                lenSeqUI - endLenUI,
+                lenSeqUI
+             ) & 1
+           )
+        ) return 64;
+    } /*Loop: Find the hits for each primer*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-8 Sec-3: Sort & link the hits
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    /*Reads have few hits, so an insertion sort is fast enough*/
+    for(uint32_t uiCord = 1; uiCord < searchST->numCordsUI; ++uiCord)
+    { /*Loop: Sort the hits by starting position*/
+        swapCordST = searchST->cordAryST[uiCord];
+        uiSwap = uiCord;
+
+        while(
+              uiSwap > 0
+           && searchST->cordAryST[uiSwap - 1].startUI > swapCordST.startUI
+        ) { /*Loop: Move larger starts up*/
+            searchST->cordAryST[uiSwap] = searchST->cordAryST[uiSwap - 1];
+            --uiSwap;
+        } /*Loop: Move larger starts up*/
+
+        searchST->cordAryST[uiSwap] = swapCordST;
+    } /*Loop: Sort the hits by starting position*/
+
+    for(uint32_t uiCord = 1; uiCord < searchST->numCordsUI; ++uiCord)
+        searchST->cordAryST[uiCord - 1].nextCord =
+            searchST->cordAryST + uiCord;
+
+    if(searchST->numCordsUI > 0)
+        searchST->cordAryST[searchST->numCordsUI - 1].nextCord = 0;
+
+    return 1;
+} /*findPrimsInRead*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Stdout: Prints out the trimmed reads (if outPathCStr is 0)
+|   - Returns:
+|     o 1 for success
+|     o 2 if could not open the fasta file
+|     o 4 if could not open the fastq file
+|     o 8 if could not open the output file
+|     o 16 if had an invalid primer or no primers
+|     o 32 if was not a valid fastq file
+|     o 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+unsigned char trimPrimersInSearch(
+    char *faPathCStr,   /*Path to fasta file with primers*/
+    char *fqPathCStr,   /*Path to fastq file with reads to trim*/
+    char *outPathCStr,  /*Path to fastq file to write trimmed reads*/
+    char *threadsCStr,  /*Number of threads to decompress with*/
+    float maxErrF,      /*Max edits, as a fraction of primer length*/
+    uint32_t endLenUI   /*Bases at each read end to search (0: all)*/
+){ /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-9 TOC: trimPrimersInSearch
+   '  - Trims primers from reads with the built in primer search
+   '  o fun-9 sec-1: Variable declerations
+   '  o fun-9 sec-2: Read in the primers & open the files
+   '  o fun-9 sec-3: Find primers in & trim each read
+   '  o fun-9 sec-4: Clean up & exit
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-1: Variable declerations
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned char errUC = 0;
+    uint8_t EOFUC = 0;          /*Marks if at the end of the file*/
+    struct primSearch searchST;
+    struct readPrim readPrimST; /*Passes the hits to trimAndPrintRead*/
+    struct samEntry samST;      /*For reading in fastq entries*/
+
+    FILE *fqFILE = 0;
+    char pipeBl = 0;            /*1: fqFILE is a pipe from gzip*/
+    FILE *outFILE = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-2: Read in the primers & open the files
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    initPrimSearch(&searchST);
+    searchST.endLenUI = endLenUI;
+
+    errUC = readPrimFa(faPathCStr, &searchST, maxErrF);
+
+    if(!(errUC & 1))
+    { /*If could not read in the primers*/
+        freePrimSearch(&searchST);
+        return errUC;
+    } /*If could not read in the primers*/
+
+    fqFILE = openFqFILE(fqPathCStr, threadsCStr, 0, &pipeBl);
+
+    if(fqFILE == 0)
+    { /*If could not open the fastq file*/
+        freePrimSearch(&searchST);
+        return 4;
+    } /*If could not open the fastq file*/
+
+    if(outPathCStr == 0)
+        outFILE = stdout;
+    else
+        outFILE = fopen(outPathCStr, "w");
+
+    if(outFILE == 0)
+    { /*If could not open the output file*/
+        closeFqFILE(fqFILE, pipeBl);
+        freePrimSearch(&searchST);
+        return 8;
+    } /*If could not open the output file*/
+
+    readPrimST.balUC = 0;
+    readPrimST.idBigNum = 0;
+    readPrimST.primCordST = 0;
+    readPrimST.leftChild = 0;
+    readPrimST.rightChild = 0;
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-3: Find primers in & trim each read
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    errUC = 1;
+    initSamEntry(&samST);
+    EOFUC = readRefFqSeq(fqFILE, &samST, 0);
+            /*Inputing 0, so that new lines are removed*/
+
+    while(EOFUC & 1)
+    { /*While there are reads to trim*/
+        if(
+           !(
+             findPrimsInRead(&searchST,samST.seqCStr,samST.readLenUInt)
+             & 1
+           )
+        ) { /*If had a memory error*/
+            errUC = 64;
+            break;
+        } /*If had a memory error*/
+
+        /*Reads without primers are not printed (same as a read with
+          no mappings in the paf file)*/
+        if(searchST.numCordsUI > 0)
+        { /*If this read had primers*/
+            readPrimST.primCordST = searchST.cordAryST;
+            trimAndPrintRead(&samST, &readPrimST, outFILE);
+        } /*If this read had primers*/
+
+        EOFUC = readRefFqSeq(fqFILE, &samST, 0);
+    } /*While there are reads to trim*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-9 Sec-4: Clean up & exit
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    fflush(outFILE);
+    closeFqFILE(fqFILE, pipeBl);
+    if(outFILE != stdout) fclose(outFILE);
+    freeStackSamEntry(&samST);
+    freePrimSearch(&searchST);
+
+    if(errUC & 64) return 64;
+    if(EOFUC == 0) return 1;  /*End of file*/
+    if(EOFUC & 64) return 64;
+
+    return 32;                /*Not a valid fastq file*/
+} /*trimPrimersInSearch*/
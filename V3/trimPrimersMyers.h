@@ -0,0 +1,274 @@
+/*######################################################################
+# Name: trimPrimersMyers
+# Use:
+#   o Finds primers in reads with Myers bit-parallel approximate
+#     matching & trims the reads while reading the fastq file. This
+#     replaces the minimap2 mapping, the paf file, & the read id hash
+#     table used by trimPrimers.
+# Output
+#   o Trimmed reads are output to a fastq file
+# Includes:
+#   - "trimPrimersSearch.h"
+#   o "trimPrimersHash.h"
+#   o "fqGetIdsHash.h"
+#   o "trimPrimersAVLTree.h"
+#   o "defaultSettings.h"
+#   o "cStrFun.h"
+#   o "fqGetIdsFqFun.h"
+#   o "trimPrimersStructs.h"
+#   o "fqGetIdsStructs.h"
+#   o "cStrToNumberFun.h"
+#   o "fqAndFaFun.h"
+#   o "FCIStatsFun.h"     (fqAndFqFun.h)
+#   o "minAlnStats.h"     (fqAndFaFun.h)
+#   o "samEntryStruct.h"  (fqAndFaFun.h->FCIstatsFun.h)
+#   o "printError.h"      (fqAndFaFun.h)
+# C standard includes:
+#   o <stdlib.h>
+#   o <stdio.h>
+#   o <stdint.h>
+######################################################################*/
+
+#ifndef TRIMPRIMERSMYERS_H
+#define TRIMPRIMERSMYERS_H
+
+#include "trimPrimersSearch.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' trimPrimersMyers SOH: Start Of Header
+'  - st-1 primPat:
+'    o Myers bit vectors for one primer (or its reverse complement)
+'  - st-2 primSearch:
+'    o Primer patterns & the list of primer hits in the current read
+'  - fun-1 initPrimSearch:
+'    o Sets a primSearch structure to have no primers
+'  - fun-2 freePrimSearch:
+'    o Frees the primers & hits in a primSearch structure
+'  - fun-3 iupacToBaseMask:
+'    o Converts an IUPAC base to a mask of the bases it matches
+'  - fun-4 addPrimPat:
+'    o Adds a primer (or its reverse complement) to a primSearch
+'  - fun-5 readPrimFa:
+'    o Reads the primers in a fasta file into a primSearch
+'  - fun-6 primPatFindStart:
+'    o Finds where a primer hit starts on a read
+'  - fun-7 primPatFindHits:
+'    o Finds the hits of one primer pattern in part of a read
+'  - fun-8 findPrimsInRead:
+'    o Finds every primer hit in a read & sorts the hits
+'  - fun-9 trimPrimersInSearch:
+'    o Trims primers from reads with the built in primer search
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#define defMaxPrimLenUC 64   /*Longest primer (one 64 bit vector)*/
+#define defPrimBasesUC 5     /*A, C, G, T, & anything else (N)*/
+#define defPrimOtherBaseUC 4 /*Index for non A, C, G, or T bases*/
+#define defMinPrimPatsUI 16  /*Starting size of the pattern array*/
+#define defMinPrimHitsUI 16  /*Starting size of the hit array*/
+#define defPrimLineLenUI 1024 /*Size of buffer for primer fasta lines*/
+
+/*---------------------------------------------------------------------\
+| ST-1: primPat
+| Use: Holds the Myers match vectors for one primer. Bit i of
+|      peqAryUL[base] is 1 if primer base i matches base.
+\---------------------------------------------------------------------*/
+typedef struct primPat
+{ /*primPat*/
+    uint64_t peqAryUL[defPrimBasesUC];    /*Match vectors*/
+    uint64_t revPeqAryUL[defPrimBasesUC]; /*Vectors for primer reversed*/
+    uint8_t lenUC;    /*Number of bases in the primer*/
+    uint8_t maxErrUC; /*Most edits allowed in a hit*/
+}primPat;
+
+/*---------------------------------------------------------------------\
+| ST-2: primSearch
+| Use: Holds the primer patterns (forward & reverse complement) & the
+|      hits for the read being trimmed. The hits are reused for each
+|      read, so reads need no memory allocations.
+\---------------------------------------------------------------------*/
+typedef struct primSearch
+{ /*primSearch*/
+    struct primPat *patAryST; /*Primer patterns*/
+    uint32_t numPatUI;        /*Number of patterns in patAryST*/
+    uint32_t lenPatAryUI;     /*Size of patAryST*/
+
+    struct primCord *cordAryST; /*Hits in the current read (linked in
+                                  sorted order by nextCord)*/
+    uint32_t numCordsUI;        /*Number of hits in cordAryST*/
+    uint32_t lenCordAryUI;      /*Size of cordAryST*/
+
+    uint32_t endLenUI;   /*Bases at each read end to search (0: all)*/
+    uint8_t baseIndexAryUC[256]; /*Converts a base to a peqAryUL index*/
+}primSearch;
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Modifies:
+|     o searchST to have no primers or hits & endLenUI to 0
+\---------------------------------------------------------------------*/
+void initPrimSearch(
+    struct primSearch *searchST /*Structure to initialize*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-1 TOC: Sec-1 Sub-1: initPrimSearch
+   '  - Sets a primSearch structure to have no primers
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Frees:
+|     o The patterns & hits in searchST (not searchST)
+\---------------------------------------------------------------------*/
+void freePrimSearch(
+    struct primSearch *searchST /*Structure to free variables in*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-2 TOC: Sec-1 Sub-1: freePrimSearch
+   '  - Frees the primers & hits in a primSearch structure
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o Mask of the bases baseC matches (1: A, 2: C, 4: G, 8: T)
+|     o 0 if baseC is not an IUPAC base
+\---------------------------------------------------------------------*/
+uint8_t iupacToBaseMask(
+    char baseC /*Base to convert*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-3 TOC: Sec-1 Sub-1: iupacToBaseMask
+   '  - Converts an IUPAC base to a mask of the bases it matches
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if added the primer
+|     o 16 if the primer is empty, too long, or has non-IUPAC bases
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o patAryST in searchST to have the primer
+\---------------------------------------------------------------------*/
+uint8_t addPrimPat(
+    struct primSearch *searchST, /*Search to add the primer to*/
+    char *primCStr,              /*Primer sequence*/
+    uint32_t lenPrimUI,          /*Number of bases in primCStr*/
+    char revCompBl,              /*1: Add the reverse complement*/
+    float maxErrF        /*Max edits, as a fraction of primer length*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-4 TOC: addPrimPat
+   '  - Adds a primer (or its reverse complement) to a primSearch
+   '  o fun-4 sec-1: Variable declerations
+   '  o fun-4 sec-2: Make sure have room for the pattern
+   '  o fun-4 sec-3: Make the match vectors
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if read in the primers
+|     o 2 if could not open the fasta file
+|     o 16 if had an invalid primer or no primers
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o patAryST in searchST to have each primer & its reverse
+|       complement
+\---------------------------------------------------------------------*/
+uint8_t readPrimFa(
+    char *faPathCStr,            /*Fasta file with the primers*/
+    struct primSearch *searchST, /*Search to add the primers to*/
+    float maxErrF        /*Max edits, as a fraction of primer length*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-5 TOC: readPrimFa
+   '  - Reads the primers in a fasta file into a primSearch
+   '  o fun-5 sec-1: Variable declerations
+   '  o fun-5 sec-2: Read in the primers
+   '  o fun-5 sec-3: Add the last primer & clean up
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o Start of the best alignment of patST ending at endUI
+\---------------------------------------------------------------------*/
+uint32_t primPatFindStart(
+    struct primPat *patST,     /*Primer that was found*/
+    uint8_t *baseIndexAryUC,   /*Converts bases to peq indexes*/
+    char *seqCStr,             /*Read sequence*/
+    uint32_t endUI,            /*Last base of the hit*/
+    uint32_t minStartUI        /*Lowest start to look at*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-6 TOC: Sec-1 Sub-1: primPatFindStart
+   '  - Finds where a primer hit starts on a read
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if found all hits (or no hits)
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o cordAryST & numCordsUI in searchST to have the hits
+\---------------------------------------------------------------------*/
+uint8_t primPatFindHits(
+    struct primSearch *searchST, /*Has the hit array & base indexes*/
+    struct primPat *patST,       /*Primer to find*/
+    char *seqCStr,               /*Read sequence*/
+    uint32_t startUI,            /*First base to search*/
+    uint32_t endUI               /*One past the last base to search*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-7 TOC: primPatFindHits
+   '  - Finds the hits of one primer pattern in part of a read
+   '  o fun-7 sec-1: Variable declerations
+   '  o fun-7 sec-2: Find the best end of each hit
+   '  o fun-7 sec-3: Add the hit to the hit list
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Returns:
+|     o 1 if searched the read
+|     o 64 for memory allocation errors
+|   - Modifies:
+|     o cordAryST & numCordsUI in searchST to have the hits sorted by
+|       start & linked (nextCord) in sorted order
+\---------------------------------------------------------------------*/
+uint8_t findPrimsInRead(
+    struct primSearch *searchST, /*Primers to search for*/
+    char *seqCStr,               /*Read sequence*/
+    uint32_t lenSeqUI            /*Number of bases in seqCStr*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-8 TOC: findPrimsInRead
+   '  - Finds every primer hit in a read & sorts the hits
+   '  o fun-8 sec-1: Variable declerations
+   '  o fun-8 sec-2: Search the read ends (or whole read)
+   '  o fun-8 sec-3: Sort & link the hits
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|   - Stdout: Prints out the trimmed reads (if outPathCStr is 0)
+|   - Returns:
+|     o 1 for success
+|     o 2 if could not open the fasta file
+|     o 4 if could not open the fastq file
+|     o 8 if could not open the output file
+|     o 16 if had an invalid primer or no primers
+|     o 32 if was not a valid fastq file
+|     o 64 for memory allocation errors
+\---------------------------------------------------------------------*/
+unsigned char trimPrimersInSearch(
+    char *faPathCStr,   /*Path to fasta file with primers*/
+    char *fqPathCStr,   /*Path to fastq file with reads to trim*/
+    char *outPathCStr,  /*Path to fastq file to write trimmed reads*/
+    char *threadsCStr,  /*Number of threads to decompress with*/
+    float maxErrF,      /*Max edits, as a fraction of primer length*/
+    uint32_t endLenUI   /*Bases at each read end to search (0: all)*/
+); /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+   ' Fun-9 TOC: trimPrimersInSearch
+   '  - Trims primers from reads with the built in primer search
+   '  o fun-9 sec-1: Variable declerations
+   '  o fun-9 sec-2: Read in the primers & open the files
+   '  o fun-9 sec-3: Find primers in & trim each read
+   '  o fun-9 sec-4: Clean up & exit
+   \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+#endif
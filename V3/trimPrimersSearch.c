@@ -82,6 +82,7 @@ unsigned char trimPrimers(
     struct readPrimHash hashST;
     FILE *pafFILE = 0;           /*For skipping minimap2*/
     FILE *fqFILE = 0;            /*For getting reads from fastq file*/
+    char pipeBl = 0;             /*1: fqFILE is a pipe from gzip*/
     FILE *outFILE = 0;           /*File to write extracted reads to*/
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
@@ -173,11 +174,11 @@ unsigned char trimPrimers(
     else
         outFILE = fopen(outPathCStr, "w");
 
-    fqFILE = fopen(fqPathCStr, "r");
+    fqFILE = openFqFILE(fqPathCStr, threadsCStr, 0, &pipeBl);
     errUC = extracAndTrimReads(fqFILE, outFILE, &hashST);
 
     fflush(outFILE); /*Make sure nothing in buffer*/
-    fclose(fqFILE); /*No longer need open*/
+    closeFqFILE(fqFILE, pipeBl); /*No longer need open*/
     fclose(outFILE); /*No longer need open*/
     freeReadPrimHashST(0, 1, &hashST);
 
@@ -245,7 +246,7 @@ unsigned char extracAndTrimReads(
         strToBackwardsBigNum(idBigNum, samST.queryCStr, &lenIdInt);
 
         /*Checking if doing an avl tree or hash table search*/
-        if(hashST->hashTbl == 0)
+        if(hashST->fpHashST.slotAryST == 0)
             lastRead = searchReadPrimTree(idBigNum, hashST->readTree);
         else lastRead = findReadPrimInHash(idBigNum, hashST);
 
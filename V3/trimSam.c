@@ -42,18 +42,20 @@ void trimSamReads(
     unsigned char
         errorFlagUChar = 0;/*Tells me if memory allocation error*/
     struct samEntry samStruct;
+    struct samBlock blockST;         /*Block the lines are read into*/
 
     initSamEntry(&samStruct);        /*Blank the structure for reading*/
-    errorFlagUChar = readSamLine(&samStruct, samFILE);
+    initSamBlock(&blockST, samFILE);
+    errorFlagUChar = readSamLine(&samStruct, &blockST);
 
     while(errorFlagUChar & 1)
     { /*While there are lines in the same file to convert*/
 
-        if(*(samStruct.samEntryCStr) == '@')
+        if(*(samStruct.lineCStr) == '@')
         { /*If was a header*/
             printSamEntry(&samStruct, outFILE);
             blankSamEntry(&samStruct);
-            errorFlagUChar = readSamLine(&samStruct, samFILE);
+            errorFlagUChar = readSamLine(&samStruct, &blockST);
             continue; /*Is a header line, move to next line in file*/
         } /*If was a header*/
 
@@ -69,10 +71,11 @@ void trimSamReads(
             /*Else if printing umapped reads as well as mapped*/
 
         blankSamEntry(&samStruct);
-        errorFlagUChar = readSamLine(&samStruct, samFILE);
+        errorFlagUChar = readSamLine(&samStruct, &blockST);
     } /*While there are lines in the same file to convert*/
 
     freeStackSamEntry(&samStruct);
+    freeSamBlock(&blockST);
     return;
 } /*trimSamReads*/
 
@@ -83,8 +86,10 @@ void trimSamReads(
 |        - 2 if header (invalid and ignored)
 |        - 4 if an unmapped read (no reference)
 |        - 8 if no sequence line
+|        - 64 if memory allocation error (packing the cigar)
 |    Modifies:
 |        - Trims cigar, sequence, & q-score entries in samStruct.
+|        - cigAryUI in samStruct to have the trimmed (packed) cigar
 \---------------------------------------------------------------------*/
 uint8_t trimSamEntry(
     struct samEntry *samStruct   /*has sam line to trim softmasks*/
@@ -112,20 +117,22 @@ uint8_t trimSamEntry(
         uCharTabCnt = 0;                     /*Counts number of tabs*/
 
     uint32_t
+        startCigUI = 0,       /*First cigar entry to keep*/
+        endCigUI = 0,         /*Cigar entry after the last to keep*/
         lenStartTrimUInt = 0, /*Number of bases soft masked at start*/
         lenEndTrimUInt = 0;   /*Number of bases soft masked at end*/
         
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-2 Sec-2: Find how much to trim & trim cigar entry
-    ^    fun-2 sec-2 sub-1: Check start of cigar & trim if needed
-    ^    fun-2 sec-2 sub-2: Check end of cigar & trim if needed
+    ^    fun-2 sec-2 sub-1: Check start & end of cigar for soft masks
+    ^    fun-2 sec-2 sub-2: Remove soft masks from the cigar
     \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
 
     /******************************************************************\
-    * Fun-2 Sec-2 Sub-1: Check start of cigar & trim if needed
+    * Fun-2 Sec-2 Sub-1: Check start & end of cigar for soft masks
     \******************************************************************/
 
-    if(*(samStruct->samEntryCStr) == '@')
+    if(*(samStruct->lineCStr) == '@')
         return 2;             /*Is a header line, invalid entry*/
 
     if(samStruct->flagUSht & 4)
@@ -133,51 +140,46 @@ uint8_t trimSamEntry(
     if(*(samStruct->seqCStr) == '*')
         return 8;             /*No seqence provided for this alignment*/
 
-    incSamUCStr = cStrToUInt(incSamUCStr, &lenStartTrimUInt);
+    /*The packed cigar is kept for scoreAln, so is only read once*/
+    if(samCigToAry(samStruct) & 64)
+        return 64;
 
-    if(*incSamUCStr != 'S')
-    { /*If no softmasking at start, set varaibles for no trim*/
-        lenStartTrimUInt = 0; /*If no soft masking at start*/
+    endCigUI = samStruct->lenCigUI;
 
-        while(*incSamUCStr > 32)
-            ++incSamUCStr;        /*Move to end of cigar entry*/
-        delUCStr = incSamUCStr;
-    } /*If no softmasking at start, set varaibles for no trim*/
+    if(
+          endCigUI > 0
+       && (samStruct->cigAryUI[0] & CIG_OP_MASK) == 'S'
+    ) { /*If the start is soft masked*/
+        lenStartTrimUInt = samStruct->cigAryUI[0] >> CIG_LEN_SHIFT;
+        startCigUI = 1;
+    } /*If the start is soft masked*/
 
-    else
-    { /*Else is a soft mask and need to remove*/
-        ++incSamUCStr;            /*Move off soft mask marker*/
+    if(
+          endCigUI > startCigUI
+       && (samStruct->cigAryUI[endCigUI - 1] & CIG_OP_MASK) == 'S'
+    ) { /*If the end is soft masked*/
+        --endCigUI;
+        lenEndTrimUInt = samStruct->cigAryUI[endCigUI] >> CIG_LEN_SHIFT;
+    } /*If the end is soft masked*/
 
-        while(*incSamUCStr > 32)
-        { /*While not at the end of the cigar*/
-            *delUCStr = *incSamUCStr;
-            ++incSamUCStr;        /*Move to end of cigar entry*/
-            ++delUCStr;           /*Move to next base to replace*/
-        } /*While not at the end of the cigar*/
-    } /*Else is a soft mask and need to remove*/
+    if(lenStartTrimUInt == 0 && lenEndTrimUInt == 0)
+        return 0; /*Nothing to trim*/
 
     /******************************************************************\
-    * Fun-2 Sec-2 Sub-2: Check end of cigar & trim if needed
+    * Fun-2 Sec-2 Sub-2: Remove soft masks from the cigar
     \******************************************************************/
 
-    --delUCStr;        /*Move back to last cigar entry*/
+    while(*incSamUCStr > 32)
+        ++incSamUCStr;        /*Move to end of old cigar entry*/
 
-    if(*delUCStr != 'S')
-    { /*If their is not softmasking at the end*/
-        lenEndTrimUInt = 0; /*If no soft masking at start*/
+    samStruct->lenCigUI = endCigUI - startCigUI;
 
-        if(lenStartTrimUInt == 0)
-            return 0; /*Nothing to trim*/
-        ++delUCStr;             /*Account for the minus one*/
-    } /*If their is not softmasking at the end*/
+    for(uint32_t uiCig = 0; uiCig < samStruct->lenCigUI; ++uiCig)
+        samStruct->cigAryUI[uiCig] =
+            samStruct->cigAryUI[uiCig + startCigUI];
 
-    else
-    { /*Else I am trimming bases off the end*/
-        /*Get number of bases to trim*/
-        --delUCStr;       /*Move of 'S' marker for soft masking*/
-        delUCStr = backwarsCStrToUInt(delUCStr, &lenEndTrimUInt);
-        ++delUCStr;       /*Move off the entry before the soft mask*/
-    } /*Else I am trimming bases off the end*/
+    /*The new cigar is shorter, so can be written over the old cigar*/
+    delUCStr = cigAryToCStr(samStruct, samStruct->cigarCStr);
 
     /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
     ^ Fun-2 Sec-3: Trim the sequence entry
@@ -37,8 +37,10 @@ void trimSamReads(
 |        - 2 if header (invalid and ignored)
 |        - 4 if an unmapped read (no reference)
 |        - 8 if no sequence line
+|        - 64 if memory allocation error (packing the cigar)
 |    Modifies:
 |        - Trims cigar, sequence, & q-score entries in samStruct.
+|        - cigAryUI in samStruct to have the trimmed (packed) cigar
 \---------------------------------------------------------------------*/
 uint8_t trimSamEntry(
     struct samEntry *samStruct   /*has sam line to trim softmasks*/
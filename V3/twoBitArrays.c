@@ -0,0 +1,218 @@
+/*######################################################################
+# Use:
+#   o Holds functions to pack sequences into two bit arrays & to read
+#     the bases back out of them
+######################################################################*/
+
+#include "twoBitArrays.h"
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' SOF TOC: Start of Functions
+'   o fun-1 initTwoBitAry:
+'     - Sets all variables in a twoBitAry structure to defaults
+'   o fun-2 freeTwoBitAry:
+'     - Frees the packed sequence in a twoBitAry structure
+'   o fun-3 seqToTwoBitAry:
+'     - Packs a text sequence into a twoBitAry structure
+'   o fun-4 revCompTwoBitAry:
+'     - Reverse complements a packed sequence into another structure
+'   o fun-5 getTwoBitAryBase:
+'     - Gets the two bit code of a base in a packed sequence
+'   o fun-6 twoBitAryToCodes:
+'     - Unpacks a range of bases into one byte codes
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o All variables in twoBitST to be 0 (does not free)
+\---------------------------------------------------------------------*/
+void initTwoBitAry(
+    struct twoBitAry *twoBitST /*Structure to initialize*/
+) /*Sets all variables in a twoBitAry structure to defaults*/
+{ /*initTwoBitAry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-1 TOC: Sec-1 Sub-1: initTwoBitAry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    twoBitST->seqAryUC = 0;
+    twoBitST->lenSeqUL = 0;
+    twoBitST->lenAryUL = 0;
+    return;
+} /*initTwoBitAry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Frees: seqAryUC in twoBitST & then initializes twoBitST
+\---------------------------------------------------------------------*/
+void freeTwoBitAry(
+    struct twoBitAry *twoBitST /*Structure to free*/
+) /*Frees the packed sequence in a twoBitAry structure*/
+{ /*freeTwoBitAry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-2 TOC: Sec-1 Sub-1: freeTwoBitAry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    free(twoBitST->seqAryUC);
+    initTwoBitAry(twoBitST);
+    return;
+} /*freeTwoBitAry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if packed the sequence
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o twoBitST to hold the packed sequence (resized if to small)
+\---------------------------------------------------------------------*/
+uint8_t seqToTwoBitAry(
+    char *seqCStr,             /*Sequence to pack*/
+    unsigned long lenSeqUL,    /*Number of bases in seqCStr*/
+    struct twoBitAry *twoBitST /*Gets the packed sequence*/
+) /*Packs a text sequence into a twoBitAry structure*/
+{ /*seqToTwoBitAry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-3 TOC: seqToTwoBitAry
+    '   fun-3 sec-1: Make sure have room for the sequence
+    '   fun-3 sec-2: Pack the bases
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-1: Make sure have room for the sequence
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    unsigned long needUL = (lenSeqUL >> 2) + 1;
+    uint8_t codeUC = 0;
+    uint8_t *tmpAryUC = 0;
+
+    if(needUL > twoBitST->lenAryUL)
+    { /*If need more memory for the sequence*/
+        tmpAryUC =
+            realloc(twoBitST->seqAryUC, needUL * sizeof(uint8_t));
+
+        if(tmpAryUC == 0)
+            return 64;
+
+        twoBitST->seqAryUC = tmpAryUC;
+        twoBitST->lenAryUL = needUL;
+    } /*If need more memory for the sequence*/
+
+    /*>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>\
+    ^ Fun-3 Sec-2: Pack the bases
+    \<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<*/
+
+    for(unsigned long ulByte = 0; ulByte < needUL; ++ulByte)
+        twoBitST->seqAryUC[ulByte] = 0;
+
+    for(unsigned long ulBase = 0; ulBase < lenSeqUL; ++ulBase)
+    { /*Loop: Pack each base*/
+        switch(seqCStr[ulBase] & ~32)
+        { /*Switch: Get the code for the base*/
+            case 'C': codeUC = 1; break;
+            case 'G': codeUC = 2; break;
+            case 'T': codeUC = 3; break;
+            case 'U': codeUC = 3; break;
+            default:  codeUC = 0; break; /*A & anything else*/
+        } /*Switch: Get the code for the base*/
+
+        twoBitST->seqAryUC[ulBase >> 2] |=
+            codeUC << ((ulBase & 3) << 1);
+    } /*Loop: Pack each base*/
+
+    twoBitST->lenSeqUL = lenSeqUL;
+    return 1;
+} /*seqToTwoBitAry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if reverse complemented the sequence
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revST to have the reverse complement of twoBitST
+\---------------------------------------------------------------------*/
+uint8_t revCompTwoBitAry(
+    struct twoBitAry *twoBitST, /*Sequence to reverse complement*/
+    struct twoBitAry *revST     /*Gets the reverse complement*/
+) /*Reverse complements a packed sequence into another structure*/
+{ /*revCompTwoBitAry*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-4 TOC: Sec-1 Sub-1: revCompTwoBitAry
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    unsigned long lenSeqUL = twoBitST->lenSeqUL;
+    unsigned long needUL = (lenSeqUL >> 2) + 1;
+    uint8_t codeUC = 0;
+    uint8_t *tmpAryUC = 0;
+
+    if(needUL > revST->lenAryUL)
+    { /*If need more memory for the sequence*/
+        tmpAryUC = realloc(revST->seqAryUC, needUL * sizeof(uint8_t));
+
+        if(tmpAryUC == 0)
+            return 64;
+
+        revST->seqAryUC = tmpAryUC;
+        revST->lenAryUL = needUL;
+    } /*If need more memory for the sequence*/
+
+    for(unsigned long ulByte = 0; ulByte < needUL; ++ulByte)
+        revST->seqAryUC[ulByte] = 0;
+
+    for(unsigned long ulBase = 0; ulBase < lenSeqUL; ++ulBase)
+    { /*Loop: Copy the complement of each base backwards*/
+        codeUC = getTwoBitAryBase(twoBitST, lenSeqUL - ulBase - 1) ^ 3;
+        revST->seqAryUC[ulBase >> 2] |= codeUC << ((ulBase & 3) << 1);
+    } /*Loop: Copy the complement of each base backwards*/
+
+    revST->lenSeqUL = lenSeqUL;
+    return 1;
+} /*revCompTwoBitAry*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o The two bit code (0 to 3) of the base at posUL
+\---------------------------------------------------------------------*/
+uint8_t getTwoBitAryBase(
+    struct twoBitAry *twoBitST, /*Packed sequence*/
+    unsigned long posUL         /*Base to get (index 0)*/
+) /*Gets the two bit code of a base in a packed sequence*/
+{ /*getTwoBitAryBase*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-5 TOC: Sec-1 Sub-1: getTwoBitAryBase
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    return (twoBitST->seqAryUC[posUL >> 2] >> ((posUL & 3) << 1)) & 3;
+} /*getTwoBitAryBase*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o codeAryUC to have the two bit codes (one per byte) of the
+|          bases from startUL to startUL + lenUL - 1
+\---------------------------------------------------------------------*/
+void twoBitAryToCodes(
+    struct twoBitAry *twoBitST, /*Packed sequence*/
+    unsigned long startUL,      /*First base to unpack*/
+    unsigned long lenUL,        /*Number of bases to unpack*/
+    uint8_t *codeAryUC          /*Gets the codes*/
+) /*Unpacks a range of bases into one byte codes*/
+{ /*twoBitAryToCodes*/
+
+    /*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+    ' Fun-6 TOC: Sec-1 Sub-1: twoBitAryToCodes
+    \~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+    for(unsigned long ulBase = 0; ulBase < lenUL; ++ulBase)
+        codeAryUC[ulBase] =
+            getTwoBitAryBase(twoBitST, startUL + ulBase);
+
+    return;
+} /*twoBitAryToCodes*/
@@ -0,0 +1,120 @@
+/*######################################################################
+# Use:
+#   o Holds the twoBitAry structure & functions to pack sequences into
+#     two bit arrays (four bases per byte) & to read bases back out
+# Note:
+#   o A is 0, C is 1, G is 2, & T/U is 3, so the complement of a base
+#     is its code ^ 3
+#   o Anything that is not an A, C, G, T, or U (N's, IUPAC codes) is
+#     stored as an A. The aligner builds the cigar from the text
+#     sequences, so these still show up as mismatches in the cigar
+# C standard libraries:
+#   - <stdlib.h>
+#   - <stdint.h>
+######################################################################*/
+
+#ifndef TWOBITARRAYS_H
+#define TWOBITARRAYS_H
+
+#include <stdlib.h>
+#include <stdint.h>
+
+/*~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\
+' twoBitArrays SOH: Start Of Header
+'   o st-1 twoBitAry:
+'     - Holds a two bit packed sequence
+'   o fun-1 initTwoBitAry:
+'     - Sets all variables in a twoBitAry structure to defaults
+'   o fun-2 freeTwoBitAry:
+'     - Frees the packed sequence in a twoBitAry structure
+'   o fun-3 seqToTwoBitAry:
+'     - Packs a text sequence into a twoBitAry structure
+'   o fun-4 revCompTwoBitAry:
+'     - Reverse complements a packed sequence into another structure
+'   o fun-5 getTwoBitAryBase:
+'     - Gets the two bit code of a base in a packed sequence
+'   o fun-6 twoBitAryToCodes:
+'     - Unpacks a range of bases into one byte codes
+\~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~*/
+
+/*---------------------------------------------------------------------\
+| Struct-1: twoBitAry
+| Use:
+|   - Holds a sequence packed four bases per byte. Base 0 is in the
+|     lowest two bits of the first byte
+\---------------------------------------------------------------------*/
+typedef struct twoBitAry
+{ /*twoBitAry*/
+    uint8_t *seqAryUC;    /*Packed sequence*/
+    unsigned long lenSeqUL; /*Number of bases in seqAryUC*/
+    unsigned long lenAryUL; /*Number of bytes seqAryUC can hold*/
+}twoBitAry;
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o All variables in twoBitST to be 0 (does not free)
+\---------------------------------------------------------------------*/
+void initTwoBitAry(
+    struct twoBitAry *twoBitST /*Structure to initialize*/
+); /*Sets all variables in a twoBitAry structure to defaults*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Frees: seqAryUC in twoBitST & then initializes twoBitST
+\---------------------------------------------------------------------*/
+void freeTwoBitAry(
+    struct twoBitAry *twoBitST /*Structure to free*/
+); /*Frees the packed sequence in a twoBitAry structure*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if packed the sequence
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o twoBitST to hold the packed sequence (resized if to small)
+\---------------------------------------------------------------------*/
+uint8_t seqToTwoBitAry(
+    char *seqCStr,             /*Sequence to pack*/
+    unsigned long lenSeqUL,    /*Number of bases in seqCStr*/
+    struct twoBitAry *twoBitST /*Gets the packed sequence*/
+); /*Packs a text sequence into a twoBitAry structure*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o 1 if reverse complemented the sequence
+|        o 64 for memory allocation errors
+|    - Modifies:
+|        o revST to have the reverse complement of twoBitST
+\---------------------------------------------------------------------*/
+uint8_t revCompTwoBitAry(
+    struct twoBitAry *twoBitST, /*Sequence to reverse complement*/
+    struct twoBitAry *revST     /*Gets the reverse complement*/
+); /*Reverse complements a packed sequence into another structure*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Returns:
+|        o The two bit code (0 to 3) of the base at posUL
+\---------------------------------------------------------------------*/
+uint8_t getTwoBitAryBase(
+    struct twoBitAry *twoBitST, /*Packed sequence*/
+    unsigned long posUL         /*Base to get (index 0)*/
+); /*Gets the two bit code of a base in a packed sequence*/
+
+/*---------------------------------------------------------------------\
+| Output:
+|    - Modifies:
+|        o codeAryUC to have the two bit codes (one per byte) of the
+|          bases from startUL to startUL + lenUL - 1
+\---------------------------------------------------------------------*/
+void twoBitAryToCodes(
+    struct twoBitAry *twoBitST, /*Packed sequence*/
+    unsigned long startUL,      /*First base to unpack*/
+    unsigned long lenUL,        /*Number of bases to unpack*/
+    uint8_t *codeAryUC          /*Gets the codes*/
+); /*Unpacks a range of bases into one byte codes*/
+
+#endif
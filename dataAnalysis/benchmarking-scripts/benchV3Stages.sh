@@ -0,0 +1,238 @@
+#!/bin/bash
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# TOC:
+#   sec-1: variable declerations
+#   sec-2: Get and check user input
+#   sec-3: Simulate reads & time each findCoInft stage
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+########################################################################
+# Name: benchV3Stages.sh
+# Use:
+#   Times each stage of findCoInft (V3) on deterministic synthetic
+#   amplicon reads made from reference pairs. This is run by make bench
+#   in V3. The times are appended to a tsv (findCoInft -bench-tsv), so
+#   runs from different commits can be compared.
+# Input:
+#   -bin-dir:                                                     [.]
+#     o Directory with findCoInft & benchSimReads
+#   -pairs:                            [three PCV2 genotype pairs]
+#     o Space separated list of reference pair fasta files
+#   -map-ref:                [PCV2--2-percent-different--database]
+#     o Fasta file to bin reads with
+#   -num-reads:                                                [2000]
+#     o Number of reads to simulate for each pair
+#   -seed:                                                     [1026]
+#     o Seed for benchSimReads
+#   -threads:                                                     [3]
+#     o Number of threads to use with findCoInft
+#   -rounds:                                                      [1]
+#     o Number of times to run findCoInft on each pair
+#   -label:                                  [git commit or "local"]
+#     o Label added to the run name (first column)
+#   -tsv:                                         [bench--stages.tsv]
+#     o File to append the stage times to
+#   -in-map:                                   [Yes if no minimap2]
+#     o Use the built in mapper (yes or no)
+# Output:
+#   File: tsv with run, stage, calls, & seconds      [-tsv]
+#     o The run is label--pair--round-number
+########################################################################
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-1: Variable declerations
+#    sec-1 sub-1: varaibles holding user input
+#    sec-1 sub-2: script variables
+#    sec-1 sub-3: Help message
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#***********************************************************************
+# Sec-1 Sub-1: Variables holding user input
+#***********************************************************************
+
+scriptDirStr="$(cd "$(dirname "$0")" && pwd)"; # this script's directory
+dataDirStr="$(dirname "$scriptDirStr")";        # dataAnalysis directory
+
+binDirStr=".";                # directory with findCoInft
+pairsStr="$dataDirStr/PCV2--genotype--reference-pairs/50-50--genotype-A--genotype-B.fasta
+  $dataDirStr/PCV2--genotype--reference-pairs/75-25--genotype-A--genotype-G.fasta
+  $dataDirStr/PCV2--genotype--reference-pairs/95-5--genotype-D--genotype-G.fasta";
+mapRefStr="$dataDirStr/databases/PCV2--2-percent-different--database.fasta";
+numReadsInt=2000;             # number of reads to simulate per pair
+seedInt=1026;                 # seed for benchSimReads
+threadsInt=3;                 # threads for findCoInft
+roundsInt=1;                  # times to run findCoInft on each pair
+labelStr="";                  # label for the runs
+tsvStr="bench--stages.tsv";   # file to save times to
+inMapStr="";                  # yes: use -in-map, no: use minimap2
+
+#***********************************************************************
+# Sec-1 Sub-2: script varaibles
+#***********************************************************************
+
+workDirStr="";  # directory to run findCoInft in
+pairNameStr=""; # name of the reference pair
+extraArgsStr="";# -in-map for findCoInft (if using the built in mapper)
+
+#***********************************************************************
+# Sec-1 Sub-3: Help message
+#***********************************************************************
+
+helpStr="$(basename "$0") [-bin-dir V3] [-pairs \"pair.fasta ...\"] [...]
+  Use:
+    Times each stage of findCoInft on deterministic synthetic reads made
+    from reference pairs with benchSimReads
+  Input:
+    -bin-dir:                                                     [.]
+      o Directory with findCoInft & benchSimReads
+    -pairs:                            [three PCV2 genotype pairs]
+      o Space separated list of reference pair fasta files
+    -map-ref:                [PCV2--2-percent-different--database]
+      o Fasta file to bin reads with
+    -num-reads:                                                [2000]
+      o Number of reads to simulate for each pair
+    -seed:                                                     [1026]
+      o Seed for benchSimReads
+    -threads:                                                     [3]
+      o Number of threads to use with findCoInft
+    -rounds:                                                      [1]
+      o Number of times to run findCoInft on each pair
+    -label:                                  [git commit or \"local\"]
+      o Label added to the run name (first column)
+    -tsv:                                         [bench--stages.tsv]
+      o File to append the stage times to
+    -in-map:                                   [yes if no minimap2]
+      o yes: use the built in mapper; no: use minimap2
+  Output:
+    File: tsv with run, stage, calls, & seconds             [-tsv]
+"; # help message
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-2: Get user input
+#   sec-2 sub-1: get user input
+#   sec-2 sub-2: check user input
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#***********************************************************************
+# Sec-2 Sub-1: get user input
+#***********************************************************************
+
+while [ $# -gt 0 ]; do
+# While there is input to read
+
+  if [[ "$1" == "-h" ]]; then
+    printf "%s\n" "$helpStr";
+    exit;
+  fi # if the user wants the help message
+
+  if [[ "$2" == "" ]]; then
+    printf "%s\n%s has no arguments\n" \
+        "$helpStr" \
+        "$1";
+    exit 1;
+  fi # if argument is blank
+
+  case $1 in
+    -bin-dir) binDirStr="$2";;
+    -pairs) pairsStr="$2";;
+    -map-ref) mapRefStr="$2";;
+    -num-reads) numReadsInt="$2";;
+    -seed) seedInt="$2";;
+    -threads) threadsInt="$2";;
+    -rounds) roundsInt="$2";;
+    -label) labelStr="$2";;
+    -tsv) tsvStr="$2";;
+    -in-map) inMapStr="$2";;
+    *) printf "%s\n%s is not valid\n" \
+          "$helpStr" \
+          "$1";
+        exit 1;;
+  esac
+
+  shift;  # move to parameter
+  shift;  # move to next argument
+done # while their are user arguemnts to check
+
+#***********************************************************************
+# Sec-2 Sub-2: check user input
+#***********************************************************************
+
+binDirStr="$(cd "$binDirStr" && pwd)";
+tsvStr="$(cd "$(dirname "$tsvStr")" && pwd)/$(basename "$tsvStr")";
+mapRefStr="$(cd "$(dirname "$mapRefStr")" && pwd)/$(basename "$mapRefStr")";
+
+for progStr in findCoInft benchSimReads; do
+  if [[ ! -x "$binDirStr/$progStr" ]]; then
+    printf "%s is not in %s (make all; make benchSimReads)\n" \
+        "$progStr" \
+        "$binDirStr";
+    exit 1;
+  fi # if the program was not built
+done # loop: check if have the programs
+
+if [[ ! -f "$mapRefStr" ]]; then
+  printf "Could not open %s (-map-ref)\n" "$mapRefStr";
+  exit 1;
+fi # if the binning references do not exist
+
+if [[ "$labelStr" == "" ]]; then
+  labelStr="$(git -C "$scriptDirStr" rev-parse --short HEAD 2>/dev/null)";
+  if [[ "$labelStr" == "" ]]; then labelStr="local"; fi
+fi # if need to make a label
+
+if [[ "$inMapStr" == "" ]]; then
+  if command -v minimap2 > /dev/null 2>&1; then
+    inMapStr="no";
+  else
+    inMapStr="yes";
+  fi # check if minimap2 is installed
+fi # if need to pick the mapper
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-3: Simulate reads & time each findCoInft stage
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+workDirStr="$(mktemp -d "${TMPDIR:-/tmp}/benchV3.XXXXXX")";
+
+for pairStr in $pairsStr; do
+# Loop: Time findCoInft for each reference pair
+  pairNameStr="$(basename "$pairStr" | sed 's/\.fa[sta]*$//')";
+
+  "$binDirStr/benchSimReads" \
+      -ref "$pairStr" \
+      -num-reads "$numReadsInt" \
+      -seed "$seedInt" \
+      -primers "$workDirStr/primers.fasta" \
+      -out "$workDirStr/reads.fastq" ||
+    { rm -r "$workDirStr"; exit 1; };
+
+  if [[ "$inMapStr" == "yes" ]]; then
+    extraArgsStr="-in-map";
+  else
+    extraArgsStr="";
+  fi # if using the built in mapper
+
+  for ((roundInt = 1; roundInt <= roundsInt; ++roundInt)); do
+  # Loop: Run findCoInft the requested number of times
+    (
+      cd "$workDirStr" &&
+      "$binDirStr/findCoInft" \
+          -fastq reads.fastq \
+          -ref "$mapRefStr" \
+          -prefix "$labelStr--$pairNameStr--$roundInt" \
+          -threads "$threadsInt" \
+          -bench-tsv "$tsvStr" \
+          -primers "$workDirStr/primers.fasta" \
+          $extraArgsStr > /dev/null 2>&1
+    ) ||
+      printf "findCoInft failed on %s (round %s)\n" \
+          "$pairNameStr" \
+          "$roundInt";
+
+    rm -f "$workDirStr/$labelStr--$pairNameStr--$roundInt"--*;
+  done # Loop: Run findCoInft the requested number of times
+done # Loop: Time findCoInft for each reference pair
+
+rm -r "$workDirStr";
+printf "Stage times appended to %s\n" "$tsvStr";
@@ -0,0 +1,264 @@
+#!/bin/bash
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# TOC:
+#   sec-1: variable declerations
+#   sec-2: Get and check user input
+#   sec-3: Check -clust-graph on clonal samples
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+########################################################################
+# Name: checkClustGraph.sh
+# Use:
+#   Checks that findCoInft -clust-graph keeps a clonal sample (reads
+#   from one reference) as a single cluster. Each seed is a different
+#   set of benchSimReads reads. This is run by make checkGraph in V3.
+# Input:
+#   -bin-dir:                                                     [.]
+#     o Directory with findCoInft & benchSimReads
+#   -ref:                      [GQ370123 from 50-50--GQ370123-GQ370128]
+#     o Fasta file with the reference for the clonal sample (only the
+#       first sequence is used)
+#   -map-ref:                 [HCV--2-percent-different--database]
+#     o Fasta file to bin reads with
+#   -num-reads:                                                [1000]
+#     o Number of reads to simulate for each seed
+#   -seeds:                                                 ["1 2 3"]
+#     o Space separated list of seeds for benchSimReads
+#   -min-kept:                                                   [95]
+#     o Minimum percent of binned reads the cluster must keep
+#   -max-read-length:                                          [3000]
+#     o Max read length for findCoInft (the HCV reads are longer
+#       than the findCoInft default)
+#   -in-map:                                   [Yes if no minimap2]
+#     o Use the built in mapper (yes or no)
+# Output:
+#   stdout: seed, number clusters, binned reads, & kept reads
+#   Exit: 1 if any seed did not end with one cluster that kept
+#         -min-kept percent of the binned reads
+########################################################################
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-1: Variable declerations
+#    sec-1 sub-1: varaibles holding user input
+#    sec-1 sub-2: script variables
+#    sec-1 sub-3: Help message
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#***********************************************************************
+# Sec-1 Sub-1: Variables holding user input
+#***********************************************************************
+
+scriptDirStr="$(cd "$(dirname "$0")" && pwd)"; # this script's directory
+dataDirStr="$(dirname "$scriptDirStr")";        # dataAnalysis directory
+
+binDirStr=".";                # directory with findCoInft
+refStr="$dataDirStr/HCV--reference-pairs/50-50--GQ370123-GQ370128.fasta";
+mapRefStr="$dataDirStr/databases/HCV--2-percent-different--database.fasta";
+numReadsInt=1000;             # number of reads to simulate per seed
+seedsStr="1 2 3";             # seeds for benchSimReads
+minKeptInt=95;                # min percent of binned reads to keep
+maxLenInt=3000;               # max read length for findCoInft
+inMapStr="";                  # yes: use -in-map, no: use minimap2
+
+#***********************************************************************
+# Sec-1 Sub-2: script varaibles
+#***********************************************************************
+
+workDirStr="";  # directory to run findCoInft in
+extraArgsStr="";# -in-map for findCoInft (if using the built in mapper)
+countsStr="";   # read counts tsv from findCoInft
+numClustInt=0;  # number of final clusters
+binReadsInt=0;  # number of reads kept in the first binning step
+keptReadsInt=0; # number of reads in the final clusters
+errInt=0;       # 1 if a seed failed the check
+
+#***********************************************************************
+# Sec-1 Sub-3: Help message
+#***********************************************************************
+
+helpStr="$(basename "$0") [-bin-dir V3] [-seeds \"1 2 3\"] [...]
+  Use:
+    Checks that findCoInft -clust-graph keeps a clonal sample (reads
+    from one reference) as a single cluster
+  Input:
+    -bin-dir:                                                     [.]
+      o Directory with findCoInft & benchSimReads
+    -ref:                      [GQ370123 from 50-50--GQ370123-GQ370128]
+      o Fasta file with the reference for the clonal sample (only the
+        first sequence is used)
+    -map-ref:                 [HCV--2-percent-different--database]
+      o Fasta file to bin reads with
+    -num-reads:                                                [1000]
+      o Number of reads to simulate for each seed
+    -seeds:                                                 [\"1 2 3\"]
+      o Space separated list of seeds for benchSimReads
+    -min-kept:                                                   [95]
+      o Minimum percent of binned reads the cluster must keep
+    -max-read-length:                                          [3000]
+      o Max read length for findCoInft
+    -in-map:                                   [yes if no minimap2]
+      o yes: use the built in mapper; no: use minimap2
+  Output:
+    stdout: seed, number clusters, binned reads, & kept reads
+    Exit: 1 if any seed did not end with one cluster that kept
+          -min-kept percent of the binned reads
+"; # help message
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-2: Get user input
+#   sec-2 sub-1: get user input
+#   sec-2 sub-2: check user input
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#***********************************************************************
+# Sec-2 Sub-1: get user input
+#***********************************************************************
+
+while [ $# -gt 0 ]; do
+# While there is input to read
+
+  if [[ "$1" == "-h" ]]; then
+    printf "%s\n" "$helpStr";
+    exit;
+  fi # if the user wants the help message
+
+  if [[ "$2" == "" ]]; then
+    printf "%s\n%s has no arguments\n" \
+        "$helpStr" \
+        "$1";
+    exit 1;
+  fi # if argument is blank
+
+  case $1 in
+    -bin-dir) binDirStr="$2";;
+    -ref) refStr="$2";;
+    -map-ref) mapRefStr="$2";;
+    -num-reads) numReadsInt="$2";;
+    -seeds) seedsStr="$2";;
+    -min-kept) minKeptInt="$2";;
+    -max-read-length) maxLenInt="$2";;
+    -in-map) inMapStr="$2";;
+    *) printf "%s\n%s is not valid\n" \
+          "$helpStr" \
+          "$1";
+        exit 1;;
+  esac
+
+  shift;  # move to parameter
+  shift;  # move to next argument
+done # while their are user arguemnts to check
+
+#***********************************************************************
+# Sec-2 Sub-2: check user input
+#***********************************************************************
+
+binDirStr="$(cd "$binDirStr" && pwd)";
+
+for progStr in findCoInft benchSimReads; do
+  if [[ ! -x "$binDirStr/$progStr" ]]; then
+    printf "%s is not in %s (make all; make benchSimReads)\n" \
+        "$progStr" \
+        "$binDirStr";
+    exit 1;
+  fi # if the program was not built
+done # loop: check if have the programs
+
+for fileStr in "$refStr" "$mapRefStr"; do
+  if [[ ! -f "$fileStr" ]]; then
+    printf "Could not open %s\n" "$fileStr";
+    exit 1;
+  fi # if the reference file does not exist
+done # loop: check if have the references
+
+mapRefStr="$(cd "$(dirname "$mapRefStr")" && pwd)/$(basename "$mapRefStr")";
+
+if [[ "$inMapStr" == "" ]]; then
+  if command -v minimap2 > /dev/null 2>&1; then
+    inMapStr="no";
+  else
+    inMapStr="yes";
+  fi # check if minimap2 is installed
+fi # if need to pick the mapper
+
+if [[ "$inMapStr" == "yes" ]]; then
+  extraArgsStr="-in-map";
+fi # if using the built in mapper
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-3: Check -clust-graph on clonal samples
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+workDirStr="$(mktemp -d "${TMPDIR:-/tmp}/checkGraph.XXXXXX")";
+
+# Only keep the first reference, so every read is from one reference
+awk '/^>/{++numSeqInt;} numSeqInt == 1' "$refStr" \
+  > "$workDirStr/clonal.fasta";
+
+printf "seed\tclusters\tbinned-reads\tkept-reads\tcheck\n";
+
+for seedInt in $seedsStr; do
+# Loop: Check -clust-graph for each seed
+  "$binDirStr/benchSimReads" \
+      -ref "$workDirStr/clonal.fasta" \
+      -num-reads "$numReadsInt" \
+      -seed "$seedInt" \
+      -primers "$workDirStr/primers.fasta" \
+      -out "$workDirStr/reads.fastq" > /dev/null 2>&1 ||
+    { rm -r "$workDirStr"; exit 1; };
+
+  (
+    cd "$workDirStr" &&
+    "$binDirStr/findCoInft" \
+        -fastq reads.fastq \
+        -ref "$mapRefStr" \
+        -prefix "clonal--$seedInt" \
+        -primers primers.fasta \
+        -max-read-length "$maxLenInt" \
+        -clust-graph \
+        $extraArgsStr > /dev/null 2>&1
+  );
+
+  countsStr="$workDirStr/clonal--$seedInt--read-counts.tsv";
+
+  if [[ -f "$countsStr" ]]; then
+    binReadsInt="$(
+      awk '$3 == "kept" && $4 == "first-binning" {sum += $2;}
+           END{print sum + 0;}' "$countsStr"
+    )";
+    numClustInt="$(
+      awk '$3 == "kept" && $4 == "final-check" {++num;}
+           END{print num + 0;}' "$countsStr"
+    )";
+    keptReadsInt="$(
+      awk '$3 == "kept" && $4 == "final-check" {sum += $2;}
+           END{print sum + 0;}' "$countsStr"
+    )";
+  else
+    binReadsInt=0;
+    numClustInt=0;
+    keptReadsInt=0;
+  fi # check if findCoInft made the read counts
+
+  if [[ "$numClustInt" -eq 1 ]] &&
+     [[ "$binReadsInt" -gt 0 ]] &&
+     [[ $((keptReadsInt * 100)) -ge $((binReadsInt * minKeptInt)) ]];
+  then
+    checkStr="pass";
+  else
+    checkStr="fail";
+    errInt=1;
+  fi # check if kept the clonal sample as one cluster
+
+  printf "%s\t%s\t%s\t%s\t%s\n" \
+      "$seedInt" \
+      "$numClustInt" \
+      "$binReadsInt" \
+      "$keptReadsInt" \
+      "$checkStr";
+
+  rm -rf "$workDirStr/clonal--$seedInt"--*;
+done # Loop: Check -clust-graph for each seed
+
+rm -r "$workDirStr";
+exit "$errInt";
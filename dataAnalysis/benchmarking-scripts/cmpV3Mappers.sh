@@ -0,0 +1,442 @@
+#!/bin/bash
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# TOC:
+#   fun-1: identFun
+#   sec-1: variable declerations
+#   sec-2: Get and check user input
+#   sec-3: Run both mappers on each pair & compare the consensuses
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+########################################################################
+# Name: cmpV3Mappers.sh
+# Use:
+#   Runs findCoInft (V3) with minimap2 & with the built in mapper
+#   (-in-map) on the same synthetic reads for each PCV2 reference pair.
+#   It then reports if both mappers found the same clusters & how close
+#   their consensuses are to each other & to the references.
+# Input:
+#   -bin-dir:                                                     [.]
+#     o Directory with findCoInft, benchSimReads, & alignSeq
+#   -pairs:                  [all PCV2 genotype & similarity pairs]
+#     o Space separated list of reference pair fasta files
+#   -map-ref:                [PCV2--2-percent-different--database]
+#     o Fasta file to bin reads with
+#   -num-reads:                                                [1000]
+#     o Number of reads to simulate for each pair
+#   -seed:                                                     [1026]
+#     o Seed for benchSimReads
+#   -threads:                                                     [3]
+#     o Number of threads to use with findCoInft
+#   -min-ident:                                                [0.99]
+#     o Min identity for two sequences to be counted as the same
+#   -trim:                                                      [yes]
+#     o yes: trim primers (-primers); no: do not trim primers
+#     o -in-map trims with the built in primer search & minimap2
+#       runs trim with minimap2, so use no to compare only the
+#       mappers
+#   -tsv:                                      [cmp--mappers.tsv]
+#     o File to save the comparison for each pair to
+# Output:
+#   File: tsv with the comparison for each pair              [-tsv]
+#     o pair: name of the reference pair
+#     o mm2Clust: number of consensuses made with minimap2
+#     o inMapClust: number of consensuses made with -in-map
+#     o sharedClust: minimap2 consensuses with an -in-map consensus
+#       that is over -min-ident identity
+#     o minConIdent: lowest identity between a minimap2 consensus &
+#       its closest -in-map consensus (NA if no consensuses)
+#     o numRefs: number of references in the pair
+#     o mm2Refs: references with a minimap2 consensus that is over
+#       -min-ident identity
+#     o inMapRefs: references with a -in-map consensus that is over
+#       -min-ident identity
+#   stdout: totals for all pairs
+########################################################################
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Fun-1: identFun
+# Use:
+#   Finds the identity of the closest sequence in a fasta file to a
+#   query sequence
+# Input:
+#   $1: Fasta file with the query (first entry is used)
+#   $2: Fasta file with the sequences to compare to
+# Output:
+#   stdout: highest identity (matches / (matches + snps + indels));
+#           0 if there were no sequences
+# Note:
+#   - Soft masked ends are not counted, since -in-map consensuses are
+#     trimmed to the primers & minimap2 consensuses may not be
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+identFun()
+{ # identFun
+  awk -v outStr="$workDirStr/ident--ref.fasta" \
+    '{if($0 ~ /^>/) ++numSeqI; if(numSeqI) print > (outStr numSeqI);}' \
+    "$2";
+
+  for refFileStr in "$workDirStr/ident--ref.fasta"*; do
+  # Loop: Align the query to each sequence
+    if [[ ! -f "$refFileStr" ]]; then continue; fi
+
+    "$binDirStr/alignSeq" -ref "$refFileStr" -query "$1" 2>/dev/null;
+    rm "$refFileStr";
+  done | # Loop: Align the query to each sequence
+    awk \
+      'BEGIN{bestF = 0;};
+       /^@/{next;};
+       {
+         cigStr = $6;
+         matchI = 0;
+         totalI = 0;
+
+         while(match(cigStr, /^[0-9]+[=XIDS]/))
+         { # Loop: Count the matches & differences in the cigar
+           numI = substr(cigStr, 1, RLENGTH - 1) + 0;
+           typeStr = substr(cigStr, RLENGTH, 1);
+           if(typeStr == "=") matchI += numI;
+           if(typeStr != "S") totalI += numI;
+           cigStr = substr(cigStr, RLENGTH + 1);
+         } # Loop: Count the matches & differences in the cigar
+
+         if(totalI > 0 && matchI / totalI > bestF)
+           bestF = matchI / totalI;
+       };
+       END{printf "%.4f", bestF;};';
+} # identFun
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-1: Variable declerations
+#    sec-1 sub-1: varaibles holding user input
+#    sec-1 sub-2: script variables
+#    sec-1 sub-3: Help message
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#***********************************************************************
+# Sec-1 Sub-1: Variables holding user input
+#***********************************************************************
+
+scriptDirStr="$(cd "$(dirname "$0")" && pwd)"; # this script's directory
+dataDirStr="$(dirname "$scriptDirStr")";        # dataAnalysis directory
+
+binDirStr=".";                # directory with findCoInft
+pairsStr="$(ls "$dataDirStr/PCV2--genotype--reference-pairs/"*.fasta \
+               "$dataDirStr/PCV2--similarity--reference-pairs/"*.fasta)";
+mapRefStr="$dataDirStr/databases/PCV2--2-percent-different--database.fasta";
+numReadsInt=1000;             # number of reads to simulate per pair
+seedInt=1026;                 # seed for benchSimReads
+threadsInt=3;                 # threads for findCoInft
+minIdentFlt=0.99;             # min identity to count as the same
+trimStr="yes";                # yes: trim primers, no: do not trim
+tsvStr="cmp--mappers.tsv";    # file to save the comparison to
+
+#***********************************************************************
+# Sec-1 Sub-2: script varaibles
+#***********************************************************************
+
+workDirStr="";  # directory to run findCoInft in
+pairNameStr=""; # name of the reference pair
+mapStr="";      # mapper findCoInft is running with (mm2 or inMap)
+extraArgsStr="";# -in-map for findCoInft (if using the built in mapper)
+primArgsStr=""; # -primers for findCoInft (if trimming primers)
+
+numMm2Int=0;    # number of minimap2 consensuses for a pair
+numInMapInt=0;  # number of -in-map consensuses for a pair
+numSharedInt=0; # minimap2 consensuses with a matching -in-map one
+minIdentStr=""; # lowest identity between the two mappers consensuses
+numRefsInt=0;   # number of references in a pair
+mm2RefsInt=0;   # references found with minimap2
+inMapRefsInt=0; # references found with -in-map
+identStr="";    # identity from identFun
+
+numPairsInt=0;     # number of pairs compared
+sameClustInt=0;    # pairs where both mappers made the same clusters
+sameRefsInt=0;     # pairs where both mappers found the same refs
+failInt=0;         # number of findCoInft runs that failed
+
+#***********************************************************************
+# Sec-1 Sub-3: Help message
+#***********************************************************************
+
+helpStr="$(basename "$0") [-bin-dir V3] [-pairs \"pair.fasta ...\"] [...]
+  Use:
+    Runs findCoInft with minimap2 & with the built in mapper (-in-map)
+    on the same synthetic reads for each reference pair & compares the
+    clusters & consensuses the two mappers made
+  Input:
+    -bin-dir:                                                     [.]
+      o Directory with findCoInft, benchSimReads, & alignSeq
+    -pairs:                  [all PCV2 genotype & similarity pairs]
+      o Space separated list of reference pair fasta files
+    -map-ref:                [PCV2--2-percent-different--database]
+      o Fasta file to bin reads with
+    -num-reads:                                                [1000]
+      o Number of reads to simulate for each pair
+    -seed:                                                     [1026]
+      o Seed for benchSimReads
+    -threads:                                                     [3]
+      o Number of threads to use with findCoInft
+    -min-ident:                                                [0.99]
+      o Min identity for two sequences to be counted as the same
+    -trim:                                                      [yes]
+      o yes: trim primers (-primers); no: do not trim primers
+      o -in-map trims with the built in primer search & minimap2
+        runs trim with minimap2, so use no to compare only the
+        mappers
+    -tsv:                                      [cmp--mappers.tsv]
+      o File to save the comparison for each pair to
+  Output:
+    File: tsv with the comparison for each pair               [-tsv]
+      o pair, mm2Clust, inMapClust, sharedClust, minConIdent, numRefs,
+        mm2Refs, & inMapRefs
+    stdout: totals for all pairs
+"; # help message
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-2: Get user input
+#   sec-2 sub-1: get user input
+#   sec-2 sub-2: check user input
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#***********************************************************************
+# Sec-2 Sub-1: get user input
+#***********************************************************************
+
+while [ $# -gt 0 ]; do
+# While there is input to read
+
+  if [[ "$1" == "-h" ]]; then
+    printf "%s\n" "$helpStr";
+    exit;
+  fi # if the user wants the help message
+
+  if [[ "$2" == "" ]]; then
+    printf "%s\n%s has no arguments\n" \
+        "$helpStr" \
+        "$1";
+    exit 1;
+  fi # if argument is blank
+
+  case $1 in
+    -bin-dir) binDirStr="$2";;
+    -pairs) pairsStr="$2";;
+    -map-ref) mapRefStr="$2";;
+    -num-reads) numReadsInt="$2";;
+    -seed) seedInt="$2";;
+    -threads) threadsInt="$2";;
+    -min-ident) minIdentFlt="$2";;
+    -trim) trimStr="$2";;
+    -tsv) tsvStr="$2";;
+    *) printf "%s\n%s is not valid\n" \
+          "$helpStr" \
+          "$1";
+        exit 1;;
+  esac
+
+  shift;  # move to parameter
+  shift;  # move to next argument
+done # while their are user arguemnts to check
+
+#***********************************************************************
+# Sec-2 Sub-2: check user input
+#***********************************************************************
+
+binDirStr="$(cd "$binDirStr" && pwd)";
+tsvStr="$(cd "$(dirname "$tsvStr")" && pwd)/$(basename "$tsvStr")";
+mapRefStr="$(cd "$(dirname "$mapRefStr")" && pwd)/$(basename "$mapRefStr")";
+
+for progStr in findCoInft benchSimReads alignSeq; do
+  if [[ ! -x "$binDirStr/$progStr" ]]; then
+    printf "%s is not in %s (make all benchSimReads alignSeq)\n" \
+        "$progStr" \
+        "$binDirStr";
+    exit 1;
+  fi # if the program was not built
+done # loop: check if have the programs
+
+if ! command -v minimap2 > /dev/null 2>&1; then
+  printf "minimap2 is not installed (needed to compare the mappers)\n";
+  exit 1;
+fi # if minimap2 is not installed
+
+if [[ ! -f "$mapRefStr" ]]; then
+  printf "Could not open %s (-map-ref)\n" "$mapRefStr";
+  exit 1;
+fi # if the binning references do not exist
+
+if [[ "$trimStr" == "no" ]]; then
+  primArgsStr="";
+else
+  primArgsStr="-primers ../primers.fasta";
+fi # if trimming primers
+
+#>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+# Sec-3: Run both mappers on each pair & compare the consensuses
+#   sec-3 sub-1: Simulate reads & run findCoInft with both mappers
+#   sec-3 sub-2: Compare the minimap2 & -in-map consensuses
+#   sec-3 sub-3: Check which references each mapper found
+#   sec-3 sub-4: Print the totals
+#<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+#***********************************************************************
+# Sec-3 Sub-1: Simulate reads & run findCoInft with both mappers
+#***********************************************************************
+
+workDirStr="$(mktemp -d "${TMPDIR:-/tmp}/cmpV3Map.XXXXXX")";
+
+printf "pair\tmm2Clust\tinMapClust\tsharedClust\tminConIdent" > "$tsvStr";
+printf "\tnumRefs\tmm2Refs\tinMapRefs\n" >> "$tsvStr";
+
+for pairStr in $pairsStr; do
+# Loop: Compare the mappers for each reference pair
+  pairNameStr="$(basename "$pairStr" | sed 's/\.fa[sta]*$//')";
+
+  "$binDirStr/benchSimReads" \
+      -ref "$pairStr" \
+      -num-reads "$numReadsInt" \
+      -seed "$seedInt" \
+      -primers "$workDirStr/primers.fasta" \
+      -out "$workDirStr/reads.fastq" ||
+    { rm -r "$workDirStr"; exit 1; };
+
+  for mapStr in mm2 inMap; do
+  # Loop: Run findCoInft with each mapper
+    rm -rf "${workDirStr:?}/$mapStr";
+    mkdir "$workDirStr/$mapStr";
+
+    if [[ "$mapStr" == "inMap" ]]; then
+      extraArgsStr="-in-map";
+    else
+      extraArgsStr="";
+    fi # if using the built in mapper
+
+    (
+      cd "$workDirStr/$mapStr" &&
+      "$binDirStr/findCoInft" \
+          -fastq ../reads.fastq \
+          -ref "$mapRefStr" \
+          -prefix "$pairNameStr" \
+          -threads "$threadsInt" \
+          $primArgsStr \
+          $extraArgsStr > /dev/null 2>&1
+    ) ||
+      {
+        printf "findCoInft (%s) failed on %s\n" "$mapStr" "$pairNameStr";
+        failInt=$((failInt + 1));
+      };
+
+    cat "$workDirStr/$mapStr/"*--con.fasta \
+      > "$workDirStr/$mapStr--cons.fasta" 2>/dev/null;
+  done # Loop: Run findCoInft with each mapper
+
+  #*********************************************************************
+  # Sec-3 Sub-2: Compare the minimap2 & -in-map consensuses
+  #*********************************************************************
+
+  numMm2Int="$(ls "$workDirStr/mm2/"*--con.fasta 2>/dev/null | wc -l)";
+  numInMapInt="$(ls "$workDirStr/inMap/"*--con.fasta 2>/dev/null | wc -l)";
+  numSharedInt=0;
+  minIdentStr="NA";
+
+  for conStr in "$workDirStr/mm2/"*--con.fasta; do
+  # Loop: Find the closest -in-map consensus to each minimap2 consensus
+    if [[ ! -f "$conStr" ]]; then continue; fi
+
+    identStr="$(identFun "$conStr" "$workDirStr/inMap--cons.fasta")";
+
+    if awk -v a="$identStr" -v b="$minIdentFlt" 'BEGIN{exit !(a>=b)}';
+    then
+      numSharedInt=$((numSharedInt + 1));
+    fi # if the consensuses are the same
+
+    if [[ "$minIdentStr" == "NA" ]]; then
+      minIdentStr="$identStr";
+    elif awk -v a="$identStr" -v b="$minIdentStr" 'BEGIN{exit !(a<b)}';
+    then
+      minIdentStr="$identStr";
+    fi # if this is the lowest identity
+  done # Loop: Find the closest -in-map consensus to each minimap2 one
+
+  #*********************************************************************
+  # Sec-3 Sub-3: Check which references each mapper found
+  #*********************************************************************
+
+  awk -v outStr="$workDirStr/pair--ref.fasta" \
+    '{if($0 ~ /^>/) ++numSeqI; if(numSeqI) print > (outStr numSeqI);}' \
+    "$pairStr";
+
+  numRefsInt=0;
+  mm2RefsInt=0;
+  inMapRefsInt=0;
+
+  for refStr in "$workDirStr/pair--ref.fasta"*; do
+  # Loop: Check if each mapper made a consensus for each reference
+    numRefsInt=$((numRefsInt + 1));
+
+    identStr="$(identFun "$refStr" "$workDirStr/mm2--cons.fasta")";
+
+    if awk -v a="$identStr" -v b="$minIdentFlt" 'BEGIN{exit !(a>=b)}';
+    then
+      mm2RefsInt=$((mm2RefsInt + 1));
+    fi # if minimap2 found this reference
+
+    identStr="$(identFun "$refStr" "$workDirStr/inMap--cons.fasta")";
+
+    if awk -v a="$identStr" -v b="$minIdentFlt" 'BEGIN{exit !(a>=b)}';
+    then
+      inMapRefsInt=$((inMapRefsInt + 1));
+    fi # if -in-map found this reference
+
+    rm "$refStr";
+  done # Loop: Check if each mapper made a consensus for each reference
+
+  printf "%s\t%s\t%s\t%s\t%s\t%s\t%s\t%s\n" \
+      "$pairNameStr" \
+      "$numMm2Int" \
+      "$numInMapInt" \
+      "$numSharedInt" \
+      "$minIdentStr" \
+      "$numRefsInt" \
+      "$mm2RefsInt" \
+      "$inMapRefsInt" \
+    >> "$tsvStr";
+
+  numPairsInt=$((numPairsInt + 1));
+
+  if [[ "$numMm2Int" -eq "$numInMapInt" &&
+        "$numSharedInt" -eq "$numMm2Int" ]];
+  then
+    sameClustInt=$((sameClustInt + 1));
+  fi # if both mappers made the same clusters
+
+  if [[ "$mm2RefsInt" -eq "$inMapRefsInt" ]]; then
+    sameRefsInt=$((sameRefsInt + 1));
+  fi # if both mappers found the same number of references
+done # Loop: Compare the mappers for each reference pair
+
+#***********************************************************************
+# Sec-3 Sub-4: Print the totals
+#***********************************************************************
+
+rm -r "$workDirStr";
+
+printf "Pairs compared: %s\n" "$numPairsInt";
+printf "Pairs with the same clusters (identity >= %s): %s\n" \
+    "$minIdentFlt" \
+    "$sameClustInt";
+printf "Pairs where both mappers found the same references: %s\n" \
+    "$sameRefsInt";
+printf "findCoInft runs that failed: %s\n" "$failInt";
+awk -F '\t' \
+  'NR > 1 {
+     numRefsI += $6;
+     mm2I += $7;
+     inMapI += $8;
+   };
+   END{
+     printf "References found: minimap2 %i of %i; -in-map %i of %i\n",
+       mm2I, numRefsI, inMapI, numRefsI;
+   };' \
+  "$tsvStr";
+printf "Comparison for each pair saved to %s\n" "$tsvStr";
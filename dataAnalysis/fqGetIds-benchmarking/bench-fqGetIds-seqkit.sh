@@ -7,6 +7,7 @@
 #    sec-3: Loop though each percentage (hard coded) & build filter file
 #    sec-4: Run blank cases to ensure to create more stability
 #    sec-5: Run time trials
+#    sec-8: Run time trials for the fqGetIds tree & fingerprint modes
 #<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
 
 #>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
@@ -245,6 +246,44 @@ for intPer in 1 10 100 250 350 500 600 750 850 1000; do
             "$timeStr" \
           >> "$statsFileStr";
 
+        #>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
+        # Sec-8: Get time and stats for the fqGetIds search modes
+        #   - tree: AVL tree only (-no-hash)
+        #   - fpHash: flat table of read id fingerprints (-fp-hash)
+        #<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<
+
+        for modeStr in "-no-hash" "-fp-hash"; do
+        # For the non-default search modes
+            /usr/bin/time \
+                -f "%e\t%S\t%U\t%M\t%P" \
+                -o "tmp-time.tsv" \
+              ../fqGetIds \
+                -f "tmp-test-benchmark.filt" \
+                -fastq "$fastqStr" \
+                "$modeStr" \
+              > "tmp--benchmark--test.fastq";
+
+            timeStr="$(cat "tmp-time.tsv")";
+            numReadsI="$(
+                sed -n "$sedCmdStr" "tmp--benchmark--test.fastq" | wc -l
+            )"; # find number of reads extracted
+
+            if [[ "$modeStr" == "-no-hash" ]]; then
+                progStr="fqGetIdsTree";
+            else
+                progStr="fqGetIdsFpHash";
+            fi # find the program name for the stats file
+
+            printf "%s\t%s\t%s\t%s\t%s\t%s\n" \
+                "$progStr" \
+                "$metaStr" \
+                "$numReadsI" \
+                "$intRep" \
+                "1" \
+                "$timeStr" \
+              >> "$statsFileStr";
+        done # For the non-default search modes
+
         #>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>
         # Sec-?: Clean up
         #<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<